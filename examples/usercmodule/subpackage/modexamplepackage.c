@@ -60,6 +60,16 @@ static mp_obj_t example_package___init__(void) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(example_package___init___obj, example_package___init__);
 
+#if MICROPY_MODULE_BUILTIN_LAZY_INIT
+// __lazy_init__ is called the first time a non-dunder attribute is used after
+//   each import, so it can also run more than once.
+static mp_obj_t example_package___lazy_init__(void) {
+    mp_printf(&mp_plat_print, "example_package.__lazy_init__\n");
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(example_package___lazy_init___obj, example_package___lazy_init__);
+#endif
+
 // The "initialised" state is stored on mp_state so that it is cleared on soft
 // reset.
 MP_REGISTER_ROOT_POINTER(int example_package_initialised);
@@ -68,6 +78,9 @@ MP_REGISTER_ROOT_POINTER(int example_package_initialised);
 static const mp_rom_map_elem_t example_package_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_example_package) },
     { MP_ROM_QSTR(MP_QSTR___init__), MP_ROM_PTR(&example_package___init___obj) },
+    #if MICROPY_MODULE_BUILTIN_LAZY_INIT
+    { MP_ROM_QSTR(MP_QSTR___lazy_init__), MP_ROM_PTR(&example_package___lazy_init___obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_foo), MP_ROM_PTR(&example_package_foo_user_cmodule) },
     { MP_ROM_QSTR(MP_QSTR_f), MP_ROM_PTR(&example_package_f_obj) },
 };
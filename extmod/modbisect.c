@@ -0,0 +1,134 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objlist.h"
+#include "py/runtime.h"
+
+#if MICROPY_PY_BISECT
+
+// the algorithm here is modelled on CPython's bisect.py
+
+static mp_obj_t bisect_get(mp_obj_t seq, size_t i) {
+    // Lists and tuples are read directly. The length is checked each time
+    // because a key function may have changed the list.
+    if (mp_obj_is_type(seq, &mp_type_list) || mp_obj_is_type(seq, &mp_type_tuple)) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(seq, &len, &items);
+        if (i < len) {
+            return items[i];
+        }
+    }
+    return mp_obj_subscr(seq, MP_OBJ_NEW_SMALL_INT(i), MP_OBJ_SENTINEL);
+}
+
+static bool bisect_lt(mp_obj_t lhs, mp_obj_t rhs) {
+    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        return MP_OBJ_SMALL_INT_VALUE(lhs) < MP_OBJ_SMALL_INT_VALUE(rhs);
+    }
+    return mp_binary_op(MP_BINARY_OP_LESS, lhs, rhs) == mp_const_true;
+}
+
+// Returns the index at which to insert x into the sorted sequence a, after
+// any equal items if right is true or before them otherwise. If insert is
+// true, also inserts x there.
+static size_t bisect_helper(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, bool right, bool insert) {
+    enum { ARG_a, ARG_x, ARG_lo, ARG_hi, ARG_key };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_lo, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_hi, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t seq = args[ARG_a].u_obj;
+    mp_obj_t key = args[ARG_key].u_obj;
+    mp_obj_t x = args[ARG_x].u_obj;
+    size_t lo = mp_arg_validate_int_min(args[ARG_lo].u_int, 0, MP_QSTR_lo);
+    size_t hi;
+    if (args[ARG_hi].u_obj == mp_const_none) {
+        hi = mp_obj_get_int(mp_obj_len(seq));
+    } else {
+        hi = mp_arg_validate_int_min(mp_obj_get_int(args[ARG_hi].u_obj), 0, MP_QSTR_hi);
+    }
+    // As in CPython, with insort the key function is applied to x too.
+    if (insert && key != mp_const_none) {
+        x = mp_call_function_1(key, x);
+    }
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        mp_obj_t item = bisect_get(seq, mid);
+        if (key != mp_const_none) {
+            item = mp_call_function_1(key, item);
+        }
+        if (right ? !bisect_lt(x, item) : bisect_lt(item, x)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (insert) {
+        if (mp_obj_is_type(seq, &mp_type_list)) {
+            mp_obj_list_t *list = MP_OBJ_TO_PTR(seq);
+            mp_obj_list_insert(list, MIN(lo, list->len), args[ARG_x].u_obj);
+        } else {
+            mp_obj_t dest[4];
+            mp_load_method(seq, MP_QSTR_insert, dest);
+            dest[2] = MP_OBJ_NEW_SMALL_INT(lo);
+            dest[3] = args[ARG_x].u_obj;
+            mp_call_method_n_kw(2, 0, dest);
+        }
+    }
+    return lo;
+}
+
+static mp_obj_t mod_bisect_bisect_left(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return MP_OBJ_NEW_SMALL_INT(bisect_helper(n_args, pos_args, kw_args, false, false));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_bisect_bisect_left_obj, 2, mod_bisect_bisect_left);
+
+static mp_obj_t mod_bisect_bisect_right(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return MP_OBJ_NEW_SMALL_INT(bisect_helper(n_args, pos_args, kw_args, true, false));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_bisect_bisect_right_obj, 2, mod_bisect_bisect_right);
+
+static mp_obj_t mod_bisect_insort_left(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    bisect_helper(n_args, pos_args, kw_args, false, true);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_bisect_insort_left_obj, 2, mod_bisect_insort_left);
+
+static mp_obj_t mod_bisect_insort_right(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    bisect_helper(n_args, pos_args, kw_args, true, true);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_bisect_insort_right_obj, 2, mod_bisect_insort_right);
+
+static const mp_rom_map_elem_t mp_module_bisect_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_bisect) },
+    { MP_ROM_QSTR(MP_QSTR_bisect), MP_ROM_PTR(&mod_bisect_bisect_right_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bisect_left), MP_ROM_PTR(&mod_bisect_bisect_left_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bisect_right), MP_ROM_PTR(&mod_bisect_bisect_right_obj) },
+    { MP_ROM_QSTR(MP_QSTR_insort), MP_ROM_PTR(&mod_bisect_insort_right_obj) },
+    { MP_ROM_QSTR(MP_QSTR_insort_left), MP_ROM_PTR(&mod_bisect_insort_left_obj) },
+    { MP_ROM_QSTR(MP_QSTR_insort_right), MP_ROM_PTR(&mod_bisect_insort_right_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(mp_module_bisect_globals, mp_module_bisect_globals_table);
+
+const mp_obj_module_t mp_module_bisect = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&mp_module_bisect_globals,
+};
+
+MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_bisect, mp_module_bisect);
+
+#endif // MICROPY_PY_BISECT
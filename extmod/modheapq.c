@@ -31,6 +31,14 @@
 
 // the algorithm here is modelled on CPython's heapq.py
 
+// CIRCUITPY-CHANGE: compare small ints without going through mp_binary_op
+static bool heapq_lt(mp_obj_t lhs, mp_obj_t rhs) {
+    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        return MP_OBJ_SMALL_INT_VALUE(lhs) < MP_OBJ_SMALL_INT_VALUE(rhs);
+    }
+    return mp_binary_op(MP_BINARY_OP_LESS, lhs, rhs) == mp_const_true;
+}
+
 static mp_obj_list_t *heapq_get_heap(mp_obj_t heap_in) {
     if (!mp_obj_is_type(heap_in, &mp_type_list)) {
         mp_raise_TypeError(MP_ERROR_TEXT("heap must be a list"));
@@ -43,7 +51,7 @@ static void heapq_heap_siftdown(mp_obj_list_t *heap, mp_uint_t start_pos, mp_uin
     while (pos > start_pos) {
         mp_uint_t parent_pos = (pos - 1) >> 1;
         mp_obj_t parent = heap->items[parent_pos];
-        if (mp_binary_op(MP_BINARY_OP_LESS, item, parent) == mp_const_true) {
+        if (heapq_lt(item, parent)) {
             heap->items[pos] = parent;
             pos = parent_pos;
         } else {
@@ -59,7 +67,7 @@ static void heapq_heap_siftup(mp_obj_list_t *heap, mp_uint_t pos) {
     mp_obj_t item = heap->items[pos];
     for (mp_uint_t child_pos = 2 * pos + 1; child_pos < end_pos; child_pos = 2 * pos + 1) {
         // choose right child if it's <= left child
-        if (child_pos + 1 < end_pos && mp_binary_op(MP_BINARY_OP_LESS, heap->items[child_pos], heap->items[child_pos + 1]) == mp_const_false) {
+        if (child_pos + 1 < end_pos && !heapq_lt(heap->items[child_pos], heap->items[child_pos + 1])) {
             child_pos += 1;
         }
         // bubble up the smaller child
@@ -103,12 +111,203 @@ static mp_obj_t mod_heapq_heapify(mp_obj_t heap_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_heapq_heapify_obj, mod_heapq_heapify);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_HEAPQ_PRIORITYQUEUE
+
+// A heap of items ordered by a number held in C, so ordering never calls
+// back into the runtime. Items with equal priorities come out in the order
+// they were pushed.
+typedef struct _heapq_entry_t {
+    union {
+        mp_int_t i;
+        #if MICROPY_PY_BUILTINS_FLOAT
+        mp_float_t f;
+        #endif
+    } priority;
+    mp_uint_t seq;
+    mp_obj_t item;
+    bool is_float;
+} heapq_entry_t;
+
+typedef struct _mp_obj_priorityqueue_t {
+    mp_obj_base_t base;
+    size_t len;
+    size_t alloc;
+    mp_uint_t seq;
+    heapq_entry_t *heap;
+} mp_obj_priorityqueue_t;
+
+static bool heapq_entry_lt(const heapq_entry_t *a, const heapq_entry_t *b) {
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (a->is_float || b->is_float) {
+        mp_float_t fa = a->is_float ? a->priority.f : (mp_float_t)a->priority.i;
+        mp_float_t fb = b->is_float ? b->priority.f : (mp_float_t)b->priority.i;
+        if (fa != fb) {
+            return fa < fb;
+        }
+    } else
+    #endif
+    if (a->priority.i != b->priority.i) {
+        return a->priority.i < b->priority.i;
+    }
+    // The sequence number wraps, so compare the difference.
+    return (mp_int_t)(a->seq - b->seq) < 0;
+}
+
+static void priorityqueue_siftdown(mp_obj_priorityqueue_t *self, size_t pos) {
+    heapq_entry_t entry = self->heap[pos];
+    while (pos > 0) {
+        size_t parent_pos = (pos - 1) >> 1;
+        if (!heapq_entry_lt(&entry, &self->heap[parent_pos])) {
+            break;
+        }
+        self->heap[pos] = self->heap[parent_pos];
+        pos = parent_pos;
+    }
+    self->heap[pos] = entry;
+}
+
+static void priorityqueue_siftup(mp_obj_priorityqueue_t *self, size_t pos) {
+    heapq_entry_t entry = self->heap[pos];
+    for (size_t child_pos = 2 * pos + 1; child_pos < self->len; child_pos = 2 * pos + 1) {
+        if (child_pos + 1 < self->len && heapq_entry_lt(&self->heap[child_pos + 1], &self->heap[child_pos])) {
+            child_pos += 1;
+        }
+        if (!heapq_entry_lt(&self->heap[child_pos], &entry)) {
+            break;
+        }
+        self->heap[pos] = self->heap[child_pos];
+        pos = child_pos;
+    }
+    self->heap[pos] = entry;
+}
+
+static heapq_entry_t *priorityqueue_first(mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == 0) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty heap"));
+    }
+    return &self->heap[0];
+}
+
+static mp_obj_t priorityqueue_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp_int_t capacity = n_args > 0 ? mp_arg_validate_int_min(mp_obj_get_int(args[0]), 0, MP_QSTR_capacity) : 0;
+    mp_obj_priorityqueue_t *self = mp_obj_malloc(mp_obj_priorityqueue_t, type);
+    self->len = 0;
+    self->alloc = MAX(capacity, 4);
+    self->seq = 0;
+    self->heap = m_new(heapq_entry_t, self->alloc);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t priorityqueue_push(mp_obj_t self_in, mp_obj_t priority, mp_obj_t item) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    heapq_entry_t entry;
+    #if MICROPY_PY_BUILTINS_FLOAT
+    entry.is_float = mp_obj_is_float(priority);
+    if (entry.is_float) {
+        entry.priority.f = mp_obj_get_float(priority);
+    } else
+    #else
+    entry.is_float = false;
+    #endif
+    {
+        entry.priority.i = mp_obj_get_int(priority);
+    }
+    entry.seq = self->seq++;
+    entry.item = item;
+    if (self->len == self->alloc) {
+        self->heap = m_renew(heapq_entry_t, self->heap, self->alloc, self->alloc * 2);
+        self->alloc *= 2;
+    }
+    self->heap[self->len++] = entry;
+    priorityqueue_siftdown(self, self->len - 1);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(priorityqueue_push_obj, priorityqueue_push);
+
+static mp_obj_t priorityqueue_pop(mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t item = priorityqueue_first(self_in)->item;
+    self->len -= 1;
+    self->heap[0] = self->heap[self->len];
+    self->heap[self->len].item = MP_OBJ_NULL; // so we don't retain a pointer
+    if (self->len) {
+        priorityqueue_siftup(self, 0);
+    }
+    return item;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_pop_obj, priorityqueue_pop);
+
+static mp_obj_t priorityqueue_peek(mp_obj_t self_in) {
+    return priorityqueue_first(self_in)->item;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_peek_obj, priorityqueue_peek);
+
+static mp_obj_t priorityqueue_peek_priority(mp_obj_t self_in) {
+    heapq_entry_t *entry = priorityqueue_first(self_in);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (entry->is_float) {
+        return mp_obj_new_float(entry->priority.f);
+    }
+    #endif
+    return mp_obj_new_int(entry->priority.i);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_peek_priority_obj, priorityqueue_peek_priority);
+
+static mp_obj_t priorityqueue_clear(mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    for (size_t i = 0; i < self->len; i++) {
+        self->heap[i].item = MP_OBJ_NULL;
+    }
+    self->len = 0;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_clear_obj, priorityqueue_clear);
+
+static mp_obj_t priorityqueue_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(self->len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(self->len);
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+}
+
+static const mp_rom_map_elem_t priorityqueue_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_push), MP_ROM_PTR(&priorityqueue_push_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&priorityqueue_pop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peek), MP_ROM_PTR(&priorityqueue_peek_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peek_priority), MP_ROM_PTR(&priorityqueue_peek_priority_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&priorityqueue_clear_obj) },
+};
+static MP_DEFINE_CONST_DICT(priorityqueue_locals_dict, priorityqueue_locals_dict_table);
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    heapq_priorityqueue_type,
+    MP_QSTR_PriorityQueue,
+    MP_TYPE_FLAG_NONE,
+    make_new, priorityqueue_make_new,
+    unary_op, priorityqueue_unary_op,
+    locals_dict, &priorityqueue_locals_dict
+    );
+
+#endif // MICROPY_PY_HEAPQ_PRIORITYQUEUE
+
 #if !MICROPY_ENABLE_DYNRUNTIME
 static const mp_rom_map_elem_t mp_module_heapq_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_heapq) },
     { MP_ROM_QSTR(MP_QSTR_heappush), MP_ROM_PTR(&mod_heapq_heappush_obj) },
     { MP_ROM_QSTR(MP_QSTR_heappop), MP_ROM_PTR(&mod_heapq_heappop_obj) },
     { MP_ROM_QSTR(MP_QSTR_heapify), MP_ROM_PTR(&mod_heapq_heapify_obj) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_HEAPQ_PRIORITYQUEUE
+    { MP_ROM_QSTR(MP_QSTR_PriorityQueue), MP_ROM_PTR(&heapq_priorityqueue_type) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_heapq_globals, mp_module_heapq_globals_table);
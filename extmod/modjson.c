@@ -25,18 +25,54 @@
  */
 
 #include <stdio.h>
+// CIRCUITPY-CHANGE
+#include <string.h>
 
 // CIRCUITPY-CHANGE
 #include "py/binary.h"
 #include "py/objarray.h"
 #include "py/objlist.h"
 #include "py/objstringio.h"
+#include "py/objtype.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 
 #if MICROPY_PY_JSON
 
+// CIRCUITPY-CHANGE
+
+// dump() collects its output in a small buffer so that the stream sees a few
+// large writes rather than one write per token.
+
+#define CIRCUITPY_JSON_WRITE_CHUNK_SIZE 64
+
+typedef struct _json_dump_buf_t {
+    mp_obj_t stream_obj;
+    size_t len;
+    char buf[CIRCUITPY_JSON_WRITE_CHUNK_SIZE];
+} json_dump_buf_t;
+
+static void json_dump_buf_flush(json_dump_buf_t *d) {
+    if (d->len != 0) {
+        mp_stream_write_adaptor(MP_OBJ_TO_PTR(d->stream_obj), d->buf, d->len);
+        d->len = 0;
+    }
+}
+
+static void json_dump_buf_strn(void *data, const char *str, size_t len) {
+    json_dump_buf_t *d = data;
+    if (d->len + len > sizeof(d->buf)) {
+        json_dump_buf_flush(d);
+        if (len > sizeof(d->buf)) {
+            mp_stream_write_adaptor(MP_OBJ_TO_PTR(d->stream_obj), str, len);
+            return;
+        }
+    }
+    memcpy(d->buf + d->len, str, len);
+    d->len += len;
+}
+
 #if MICROPY_PY_JSON_SEPARATORS
 
 enum {
@@ -73,10 +109,13 @@ static mp_obj_t mod_json_dump_helper(size_t n_args, const mp_obj_t *pos_args, mp
         return mp_obj_new_str_from_utf8_vstr(&vstr);
     } else {
         // dump(obj, stream)
-        print_ext.base.data = MP_OBJ_TO_PTR(pos_args[1]);
-        print_ext.base.print_strn = mp_stream_write_adaptor;
+        // CIRCUITPY-CHANGE
+        json_dump_buf_t dump_buf = { .stream_obj = pos_args[1], .len = 0 };
+        print_ext.base.data = &dump_buf;
+        print_ext.base.print_strn = json_dump_buf_strn;
         mp_get_stream_raise(pos_args[1], MP_STREAM_OP_WRITE);
         mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
+        json_dump_buf_flush(&dump_buf);
         return mp_const_none;
     }
 }
@@ -95,8 +134,11 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_dumps_obj, 1, mod_json_dumps);
 
 static mp_obj_t mod_json_dump(mp_obj_t obj, mp_obj_t stream) {
     mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
+    // CIRCUITPY-CHANGE
+    json_dump_buf_t dump_buf = { .stream_obj = stream, .len = 0 };
+    mp_print_t print = {&dump_buf, json_dump_buf_strn};
     mp_obj_print_helper(&print, obj, PRINT_JSON);
+    json_dump_buf_flush(&dump_buf);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mod_json_dump_obj, mod_json_dump);
@@ -137,6 +179,8 @@ typedef struct _json_stream_t {
     // CIRCUITPY-CHANGE
     mp_obj_t python_readinto[2 + 1];
     mp_obj_array_t bytearray_obj;
+    const byte *buf;
+    size_t buf_size;
     size_t start;
     size_t end;
     byte cur;
@@ -147,56 +191,73 @@ typedef struct _json_stream_t {
 #define S_CUR(s) ((s).cur)
 #define S_NEXT(s) (json_stream_next(&(s)))
 
+// CIRCUITPY-CHANGE: the parser consumes bytes from s->buf, which is refilled
+// by up to s->buf_size bytes at a time. loads() points s->buf straight at the
+// input and has no read function.
 static byte json_stream_next(json_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    // CIRCUITPY-CHANGE
-    JSON_DEBUG("  usjon_stream_next err:%2d cur: %c \n", s->errcode, s->cur);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
+    if (s->start == s->end && s->read != NULL) {
+        mp_uint_t ret = s->read(s->stream_obj, (void *)s->buf, s->buf_size, &s->errcode);
+        if (ret == MP_STREAM_ERROR) {
+            mp_raise_OSError(s->errcode);
+        }
+        s->start = 0;
+        s->end = ret;
     }
-    if (ret == 0) {
+    if (s->start == s->end) {
         s->cur = S_EOF;
+    } else {
+        s->cur = s->buf[s->start++];
     }
+    JSON_DEBUG("  usjon_stream_next err:%2d cur: %c \n", s->errcode, s->cur);
     return s->cur;
 }
 
 // CIRCUITPY-CHANGE
 
-// We read from an object's `readinto` method in chunks larger than the json
-// parser needs to reduce the number of function calls done.
+// We read from streams in chunks larger than the json parser needs to reduce
+// the number of function calls done. Native streams are only read ahead when
+// they can seek back over the unused bytes afterwards; others (eg a UART) are
+// read a byte at a time so that nothing after the JSON object is consumed.
 
 #define CIRCUITPY_JSON_READ_CHUNK_SIZE 64
 
 static mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode) {
-    (void)size;  // Ignore size because we know it's always 1.
+    (void)buf;  // Ignore buf and size because readinto fills bytearray_obj.
+    (void)size;
     json_stream_t *s = obj;
-
-    if (s->start == s->end) {
-        *errcode = 0;
-        mp_obj_t ret = mp_call_method_n_kw(1, 0, s->python_readinto);
-        if (ret == mp_const_none) {
-            *errcode = MP_EAGAIN;
-            return MP_STREAM_ERROR;
-        }
-        s->start = 0;
-        s->end = mp_obj_get_int(ret);
-        if (s->end == 0) {
-            return 0;
-        }
+    mp_obj_t ret = mp_call_method_n_kw(1, 0, s->python_readinto);
+    if (ret == mp_const_none) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
     }
-
-    *((uint8_t *)buf) = ((uint8_t *)s->bytearray_obj.items)[s->start];
-    s->start++;
-    return 1;
+    return mp_obj_get_int(ret);
 }
 
-static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
-    const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
+// CIRCUITPY-CHANGE: load() passes a stream, loads() passes a buffer.
+static mp_obj_t _mod_json_load(mp_obj_t stream_obj, const mp_buffer_info_t *bufinfo, mp_obj_t object_hook) {
+    #if !MICROPY_PY_JSON_OBJECT_HOOK
+    (void)object_hook;
+    #endif
     json_stream_t s;
     uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
-    if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
+    const mp_stream_p_t *stream_p = NULL;
+    struct mp_stream_seek_t seek_s = { .offset = 0, .whence = MP_SEEK_CUR };
+    bool seekable = false;
+    // It is legal for a stream to have contents after JSON.
+    // E.g., A UART is not closed after receiving an object; in load() we will
+    //   return the first complete JSON object, while in loads() we will retain
+    //   strict adherence to the buffer's complete semantic.
+    bool return_first_json = bufinfo == NULL;
+    s.errcode = 0;
+    s.start = 0;
+    s.end = 0;
+    s.cur = 0;
+    if (bufinfo != NULL) {
+        s.stream_obj = MP_OBJ_NULL;
+        s.read = NULL;
+        s.buf = bufinfo->buf;
+        s.end = bufinfo->len;
+    } else if ((stream_p = mp_proto_get(0, stream_obj)) == NULL) {
         mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
         s.bytearray_obj.base.type = &mp_type_bytearray;
         s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
@@ -206,12 +267,19 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
         s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
         s.stream_obj = &s;
         s.read = json_python_readinto;
+        s.buf = character_buffer;
+        s.buf_size = CIRCUITPY_JSON_READ_CHUNK_SIZE;
     } else {
         stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
         s.stream_obj = stream_obj;
         s.read = stream_p->read;
+        s.buf = character_buffer;
+        // Only native streams are probed, a Python ioctl() can't take seek_s.
+        seekable = stream_p->ioctl != NULL
+            && mp_obj_is_native_type(mp_obj_get_type(stream_obj))
+            && stream_p->ioctl(stream_obj, MP_STREAM_SEEK, (uintptr_t)&seek_s, &s.errcode) != MP_STREAM_ERROR;
         s.errcode = 0;
-        s.cur = 0;
+        s.buf_size = seekable ? CIRCUITPY_JSON_READ_CHUNK_SIZE : 1;
     }
 
     JSON_DEBUG("got JSON stream\n");
@@ -357,6 +425,29 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                     // no object at all
                     goto fail;
                 }
+                // CIRCUITPY-CHANGE
+                #if MICROPY_PY_JSON_OBJECT_HOOK
+                mp_obj_t hooked = stack_top;
+                if (object_hook != mp_const_none && stack_top_type == &mp_type_dict) {
+                    hooked = mp_call_function_1(object_hook, stack_top);
+                }
+                if (stack.len == 0) {
+                    // finished; compound object
+                    stack_top = hooked;
+                    goto success;
+                }
+                // replace the object where it was stored in its parent
+                stack.len -= 2;
+                mp_obj_t parent_key = stack.items[stack.len + 1];
+                stack_top = stack.items[stack.len];
+                stack_top_type = mp_obj_get_type(stack_top);
+                if (stack_top_type == &mp_type_list) {
+                    mp_obj_list_t *parent = MP_OBJ_TO_PTR(stack_top);
+                    parent->items[parent->len - 1] = hooked;
+                } else {
+                    mp_obj_dict_store(stack_top, parent_key, hooked);
+                }
+                #else
                 if (stack.len == 0) {
                     // finished; compound object
                     goto success;
@@ -364,6 +455,7 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                 stack.len -= 1;
                 stack_top = stack.items[stack.len];
                 stack_top_type = mp_obj_get_type(stack_top);
+                #endif
                 goto cont;
             }
             default:
@@ -378,6 +470,10 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             }
         } else {
             // append to list or dict
+            // CIRCUITPY-CHANGE
+            #if MICROPY_PY_JSON_OBJECT_HOOK
+            mp_obj_t parent_key = stack_key;
+            #endif
             if (stack_top_type == &mp_type_list) {
                 mp_obj_list_append(stack_top, next);
             } else {
@@ -398,6 +494,11 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                 } else {
                     mp_obj_list_append(MP_OBJ_FROM_PTR(&stack), stack_top);
                 }
+                // CIRCUITPY-CHANGE: the key is needed to store the result of
+                // object_hook in a dict parent.
+                #if MICROPY_PY_JSON_OBJECT_HOOK
+                mp_obj_list_append(MP_OBJ_FROM_PTR(&stack), parent_key);
+                #endif
                 stack_top = next;
                 stack_top_type = mp_obj_get_type(stack_top);
             }
@@ -405,11 +506,6 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
     }
 success:
     // CIRCUITPY-CHANGE
-
-    // It is legal for a stream to have contents after JSON.
-    // E.g., A UART is not closed after receiving an object; in load() we will
-    //   return the first complete JSON object, while in loads() we will retain
-    //   strict adherence to the buffer's complete semantic.
     if (!return_first_json) {
         while (unichar_isspace(S_CUR(s))) {
             S_NEXT(s);
@@ -424,6 +520,13 @@ success:
         goto fail;
     }
     vstr_clear(&vstr);
+    // CIRCUITPY-CHANGE: give back what was read ahead past the last character
+    // the parser looked at.
+    if (seekable && s.end != s.start) {
+        seek_s.offset = -(mp_off_t)(s.end - s.start);
+        seek_s.whence = MP_SEEK_CUR;
+        stream_p->ioctl(stream_obj, MP_STREAM_SEEK, (uintptr_t)&seek_s, &s.errcode);
+    }
     return stack_top;
 
 fail:
@@ -431,21 +534,51 @@ fail:
 }
 
 // CIRCUITPY-CHANGE
+#if MICROPY_PY_JSON_OBJECT_HOOK
+
+static mp_obj_t mod_json_load_helper(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, bool from_buffer) {
+    enum { ARG_object_hook };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_object_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (from_buffer) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(pos_args[0], &bufinfo, MP_BUFFER_READ);
+        return _mod_json_load(MP_OBJ_NULL, &bufinfo, args[ARG_object_hook].u_obj);
+    }
+    return _mod_json_load(pos_args[0], NULL, args[ARG_object_hook].u_obj);
+}
+
+static mp_obj_t mod_json_load(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return mod_json_load_helper(n_args, pos_args, kw_args, false);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_load_obj, 1, mod_json_load);
+
+static mp_obj_t mod_json_loads(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return mod_json_load_helper(n_args, pos_args, kw_args, true);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_loads_obj, 1, mod_json_loads);
+
+#else
+
 static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
-    return _mod_json_load(stream_obj, true);
+    return _mod_json_load(stream_obj, NULL, mp_const_none);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_load_obj, mod_json_load);
 
 static mp_obj_t mod_json_loads(mp_obj_t obj) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
-    vstr_t vstr = {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    // CIRCUITPY-CHANGE
-    return _mod_json_load(MP_OBJ_FROM_PTR(&sio), false);
+    return _mod_json_load(MP_OBJ_NULL, &bufinfo, mp_const_none);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
 
+#endif
+
 static const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_json_dump_obj) },
@@ -45,8 +45,25 @@
 
 #define FLAG_DEBUG 0x1000
 
+// CIRCUITPY-CHANGE
+#if MICROPY_ENABLE_DYNRUNTIME
+#undef MICROPY_PY_RE_CACHE_SIZE
+#define MICROPY_PY_RE_CACHE_SIZE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_RE_PIKEVM
+#define re1_5_exec re1_5_pikevm
+#else
+#define re1_5_exec re1_5_recursiveloopprog
+#endif
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_RE_CACHE_SIZE
+    mp_obj_t pattern;
+    #endif
     ByteProg re;
 } mp_obj_re_t;
 
@@ -58,6 +75,8 @@ typedef struct _mp_obj_match_t {
 } mp_obj_match_t;
 
 static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args);
+// CIRCUITPY-CHANGE
+static mp_obj_t re_compile_cached(mp_obj_t pattern);
 #if !MICROPY_ENABLE_DYNRUNTIME
 static const mp_obj_type_t re_type;
 #endif
@@ -200,7 +219,8 @@ static mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
         self = MP_OBJ_TO_PTR(args[0]);
     } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
+        // CIRCUITPY-CHANGE
+        self = MP_OBJ_TO_PTR(re_compile_cached(args[0]));
     }
     Subject subj;
     size_t len;
@@ -241,7 +261,7 @@ static mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, caps, char *, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char *)match->caps, 0, caps_num * sizeof(char *));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    int res = re1_5_exec(&self->re, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, caps, char *, caps_num, match);
         return mp_const_none;
@@ -282,7 +302,7 @@ static mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char **)caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        int res = re1_5_exec(&self->re, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -315,7 +335,8 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
         self = MP_OBJ_TO_PTR(args[0]);
     } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
+        // CIRCUITPY-CHANGE
+        self = MP_OBJ_TO_PTR(re_compile_cached(args[0]));
     }
     mp_obj_t replace = args[1];
     mp_obj_t where = args[2];
@@ -342,7 +363,7 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char *)match->caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        int res = re1_5_exec(&self->re, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -452,19 +473,17 @@ static MP_DEFINE_CONST_OBJ_TYPE(
     );
 #endif
 
-static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
-    (void)n_args;
-    const char *re_str = mp_obj_str_get_str(args[0]);
+// CIRCUITPY-CHANGE: split out of mod_re_compile
+static mp_obj_t re_compile(mp_obj_t pattern, int flags) {
+    (void)flags;
+    const char *re_str = mp_obj_str_get_str(pattern);
     int size = re1_5_sizecode(re_str);
     if (size == -1) {
         goto error;
     }
     mp_obj_re_t *o = mp_obj_malloc_var(mp_obj_re_t, re.insts, char, size, (mp_obj_type_t *)&re_type);
-    #if MICROPY_PY_RE_DEBUG
-    int flags = 0;
-    if (n_args > 1) {
-        flags = mp_obj_get_int(args[1]);
-    }
+    #if MICROPY_PY_RE_CACHE_SIZE
+    o->pattern = pattern;
     #endif
     int error = re1_5_compilecode(&o->re, re_str);
     if (error != 0) {
@@ -478,8 +497,58 @@ static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
     #endif
     return MP_OBJ_FROM_PTR(o);
 }
+
+static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
+    // CIRCUITPY-CHANGE
+    int flags = 0;
+    if (n_args > 1) {
+        flags = mp_obj_get_int(args[1]);
+    }
+    #if MICROPY_PY_RE_CACHE_SIZE
+    if (flags == 0) {
+        return re_compile_cached(args[0]);
+    }
+    #endif
+    return re_compile(args[0], flags);
+}
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
 
+// CIRCUITPY-CHANGE
+// Compile a pattern, reusing a recent compilation of the same string.
+static mp_obj_t re_compile_cached(mp_obj_t pattern) {
+    #if MICROPY_PY_RE_CACHE_SIZE
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    mp_obj_t o = MP_OBJ_NULL;
+    size_t i = 0;
+    if (mp_obj_is_str_or_bytes(pattern)) {
+        for (; i < MICROPY_PY_RE_CACHE_SIZE && cache[i] != MP_OBJ_NULL; i++) {
+            mp_obj_re_t *cached = MP_OBJ_TO_PTR(cache[i]);
+            if (mp_obj_str_equal(cached->pattern, pattern)) {
+                o = cache[i];
+                break;
+            }
+        }
+    }
+    if (o == MP_OBJ_NULL) {
+        o = re_compile(pattern, 0);
+        if (i == MICROPY_PY_RE_CACHE_SIZE) {
+            // Drop the least recently used entry.
+            i -= 1;
+        }
+    }
+    // Keep the cache in most recently used order.
+    memmove(cache + 1, cache, i * sizeof(mp_obj_t));
+    cache[0] = o;
+    return o;
+    #else
+    return re_compile(pattern, 0);
+    #endif
+}
+
+#if MICROPY_PY_RE_CACHE_SIZE
+MP_REGISTER_ROOT_POINTER(mp_obj_t re_cache[MICROPY_PY_RE_CACHE_SIZE]);
+#endif
+
 #if !MICROPY_ENABLE_DYNRUNTIME
 static const mp_rom_map_elem_t mp_module_re_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_re) },
@@ -510,9 +579,177 @@ MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
 #define re1_5_fatal(x) assert(!x)
 
 #include "lib/re1.5/compilecode.c"
+// CIRCUITPY-CHANGE
+#if !MICROPY_PY_RE_PIKEVM
 #include "lib/re1.5/recursiveloop.c"
+#endif
 #include "lib/re1.5/charclass.c"
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_RE_PIKEVM
+
+// A Pike VM runs all the ways the program can go in lock step over the
+// subject, so a match takes time proportional to the subject length times the
+// program length, where backtracking can take exponential time. Threads are
+// kept in priority order, and only the first thread to reach each instruction
+// at a given position survives, which gives the same matches as backtracking.
+
+typedef struct _re_pike_list_t {
+    int n;
+    int *pc;
+    const char **caps;
+} re_pike_list_t;
+
+typedef struct _re_pike_t {
+    const char *code;
+    Subject *input;
+    int nsubp;
+    int gen;
+    int *marks;
+    const char **work;
+} re_pike_t;
+
+// Add the thread at pc to the list, following the instructions that don't
+// consume input. vm->work holds the thread's captures.
+static void re_pike_add(re_pike_t *vm, re_pike_list_t *l, int pc, const char *sp) {
+    re1_5_stack_chk();
+    if (vm->marks[pc] == vm->gen) {
+        return;
+    }
+    vm->marks[pc] = vm->gen;
+    const char *code = vm->code;
+    switch (code[pc]) {
+        case Jmp:
+            re_pike_add(vm, l, pc + 2 + (signed char)code[pc + 1], sp);
+            return;
+        case Split:
+            re_pike_add(vm, l, pc + 2, sp);
+            re_pike_add(vm, l, pc + 2 + (signed char)code[pc + 1], sp);
+            return;
+        case RSplit:
+            re_pike_add(vm, l, pc + 2 + (signed char)code[pc + 1], sp);
+            re_pike_add(vm, l, pc + 2, sp);
+            return;
+        case Save: {
+            int n = (unsigned char)code[pc + 1];
+            if (n >= vm->nsubp) {
+                re_pike_add(vm, l, pc + 2, sp);
+                return;
+            }
+            const char *old = vm->work[n];
+            vm->work[n] = sp;
+            re_pike_add(vm, l, pc + 2, sp);
+            vm->work[n] = old;
+            return;
+        }
+        case Bol:
+            if (sp == vm->input->begin_line) {
+                re_pike_add(vm, l, pc + 1, sp);
+            }
+            return;
+        case Eol:
+            if (sp == vm->input->end) {
+                re_pike_add(vm, l, pc + 1, sp);
+            }
+            return;
+        default:
+            l->pc[l->n] = pc;
+            memcpy(&l->caps[l->n * vm->nsubp], vm->work, vm->nsubp * sizeof(char *));
+            l->n++;
+            return;
+    }
+}
+
+int re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored) {
+    // Each list holds at most one thread per instruction.
+    size_t caps_len = (2 * prog->len + 1) * nsubp;
+    size_t ints_len = 2 * prog->len + prog->bytelen;
+    size_t alloc = caps_len * sizeof(char *) + ints_len * sizeof(int);
+    byte *mem = m_new(byte, alloc);
+    const char **caps = (const char **)mem;
+    int *ints = (int *)(mem + caps_len * sizeof(char *));
+
+    re_pike_list_t lists[2] = {
+        { 0, ints, caps },
+        { 0, ints + prog->len, caps + prog->len * nsubp },
+    };
+    re_pike_list_t *clist = &lists[0];
+    re_pike_list_t *nlist = &lists[1];
+    re_pike_t vm = {
+        .code = prog->insts,
+        .input = input,
+        .nsubp = nsubp,
+        .gen = 1,
+        .marks = ints + 2 * prog->len,
+        .work = caps + 2 * prog->len * nsubp,
+    };
+    memset(vm.marks, 0, prog->bytelen * sizeof(int));
+    memcpy(vm.work, subp, nsubp * sizeof(char *));
+
+    int matched = 0;
+    const char *sp = input->begin;
+    re_pike_add(&vm, clist, HANDLE_ANCHORED(0, is_anchored), sp);
+    while (clist->n != 0) {
+        vm.gen++;
+        nlist->n = 0;
+        for (int i = 0; i < clist->n; i++) {
+            int pc = clist->pc[i];
+            const char *code = prog->insts + pc;
+            const char **thread_caps = &clist->caps[i * nsubp];
+            if (*code == Match) {
+                // Threads after this one have lower priority, so drop them.
+                matched = 1;
+                memcpy(subp, thread_caps, nsubp * sizeof(char *));
+                break;
+            }
+            if (sp >= input->end) {
+                continue;
+            }
+            switch (*code) {
+                case Char:
+                    if (*sp != code[1]) {
+                        continue;
+                    }
+                    pc += 2;
+                    break;
+                case Any:
+                    pc += 1;
+                    break;
+                case Class:
+                case ClassNot:
+                    if (!_re1_5_classmatch(code + 1, sp)) {
+                        continue;
+                    }
+                    pc += *(unsigned char *)(code + 1) * 2 + 2;
+                    break;
+                case NamedClass:
+                    if (!_re1_5_namedclassmatch(code + 1, sp)) {
+                        continue;
+                    }
+                    pc += 2;
+                    break;
+                default:
+                    re1_5_fatal("pikevm");
+                    continue;
+            }
+            memcpy(vm.work, thread_caps, nsubp * sizeof(char *));
+            re_pike_add(&vm, nlist, pc, sp + 1);
+        }
+        if (sp >= input->end) {
+            break;
+        }
+        sp++;
+        re_pike_list_t *tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+    }
+
+    m_del(byte, mem, alloc);
+    return matched;
+}
+
+#endif
+
 #if MICROPY_PY_RE_DEBUG
 // Make sure the output print statements go to the same output as other Python output.
 #define printf(...) mp_printf(&mp_plat_print, __VA_ARGS__)
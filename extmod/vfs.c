@@ -31,6 +31,8 @@
 #include "py/objstr.h"
 #include "py/mperrno.h"
 #include "extmod/vfs.h"
+// CIRCUITPY-CHANGE: for mp_module_path_cache_invalidate()
+#include "py/builtin.h"
 
 #if MICROPY_VFS
 
@@ -107,6 +109,24 @@ static mp_vfs_mount_t *lookup_path(mp_obj_t path_in, mp_obj_t *path_out) {
     return vfs;
 }
 
+// CIRCUITPY-CHANGE: forget where modules were found when files may appear,
+// move or disappear.
+#if MICROPY_MODULE_PATH_CACHE
+static void invalidate_module_paths(qstr meth_name, const mp_obj_t *args) {
+    if (meth_name == MP_QSTR_stat || meth_name == MP_QSTR_ilistdir ||
+        meth_name == MP_QSTR_getcwd || meth_name == MP_QSTR_statvfs) {
+        return;
+    }
+    if (meth_name == MP_QSTR_open && mp_obj_is_str(args[1])) {
+        const char *mode = mp_obj_str_get_str(args[1]);
+        if (strpbrk(mode, "wax+") == NULL) {
+            return;
+        }
+    }
+    mp_module_path_cache_invalidate();
+}
+#endif
+
 static mp_obj_t mp_vfs_proxy_call(mp_vfs_mount_t *vfs, qstr meth_name, size_t n_args, const mp_obj_t *args) {
     assert(n_args <= PROXY_MAX_ARGS);
     if (vfs == MP_VFS_NONE) {
@@ -117,6 +137,10 @@ static mp_obj_t mp_vfs_proxy_call(mp_vfs_mount_t *vfs, qstr meth_name, size_t n_
         // can't do operation on root dir
         mp_raise_OSError(MP_EPERM);
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MODULE_PATH_CACHE
+    invalidate_module_paths(meth_name, args);
+    #endif
     mp_obj_t meth[2 + PROXY_MAX_ARGS];
     mp_load_method(vfs->obj, meth_name, meth);
     if (args != NULL) {
@@ -343,6 +367,10 @@ mp_obj_t mp_vfs_chdir(mp_obj_t path_in) {
         mp_vfs_proxy_call(vfs, MP_QSTR_chdir, 1, &path_out);
     }
     MP_STATE_VM(vfs_cur) = vfs;
+    // CIRCUITPY-CHANGE: relative entries of sys.path now mean something else.
+    #if MICROPY_MODULE_PATH_CACHE
+    mp_module_path_cache_invalidate();
+    #endif
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_chdir_obj, mp_vfs_chdir);
@@ -52,6 +52,8 @@
 #define MP_BLOCKDEV_FLAG_CONCURRENT_WRITE_PROTECTED (0x0020)
 // Bit set when something has claimed the right to mutate the blockdev.
 #define MP_BLOCKDEV_FLAG_LOCKED (0x0040)
+// Single block reads and writes go through the block cache.
+#define MP_BLOCKDEV_FLAG_CACHED (0x0080)
 
 // constants for block protocol ioctl
 #define MP_BLOCKDEV_IOCTL_INIT          (1)
@@ -109,6 +111,14 @@ int mp_vfs_blockdev_read_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t b
 int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf);
 int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, const uint8_t *buf);
 mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t arg);
+// CIRCUITPY-CHANGE: block cache. NULL means all devices. flush writes back
+// dirty blocks; drop also forgets the device's blocks, for unmounting.
+#if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+int mp_vfs_blockdev_cache_flush(mp_vfs_blockdev_t *self);
+int mp_vfs_blockdev_cache_drop(mp_vfs_blockdev_t *self);
+void mp_vfs_blockdev_cache_reset(void);
+void mp_vfs_blockdev_cache_gc_collect(void);
+#endif
 
 mp_vfs_mount_t *mp_vfs_lookup_path(const char *path, const char **path_out);
 mp_import_stat_t mp_vfs_import_stat(const char *path);
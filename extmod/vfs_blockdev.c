@@ -37,6 +37,11 @@
 #if CIRCUITPY_SDIOIO
 #include "shared-bindings/sdioio/SDCard.h"
 #endif
+#if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+#include <string.h>
+#include "py/gc.h"
+#include "supervisor/port_heap.h"
+#endif
 
 
 #if MICROPY_VFS
@@ -46,6 +51,10 @@ void mp_vfs_blockdev_init(mp_vfs_blockdev_t *self, mp_obj_t bdev) {
     mp_load_method_maybe(bdev, MP_QSTR_writeblocks, self->writeblocks);
     mp_load_method_maybe(bdev, MP_QSTR_ioctl, self->u.ioctl);
 
+    // CIRCUITPY-CHANGE: Devices set up here are user block devices, which go
+    // through the block cache. The internal flash has a cache of its own.
+    self->flags |= MP_BLOCKDEV_FLAG_CACHED;
+
     // CIRCUITPY-CHANGE: Support native SD cards.
     #if CIRCUITPY_SDCARDIO
     if (mp_obj_get_type(bdev) == &sdcardio_SDCard_type) {
@@ -63,7 +72,16 @@ void mp_vfs_blockdev_init(mp_vfs_blockdev_t *self, mp_obj_t bdev) {
     #endif
     #if CIRCUITPY_SDIOIO
     if (mp_obj_get_type(bdev) == &sdioio_SDCard_type) {
-        // TODO: Enable native blockdev for SDIO too.
+        self->flags |= MP_BLOCKDEV_FLAG_NATIVE | MP_BLOCKDEV_FLAG_HAVE_IOCTL;
+        self->readblocks[0] = mp_const_none;
+        self->readblocks[1] = bdev;
+        self->readblocks[2] = (mp_obj_t)sdioio_sdcard_readblocks; // native version
+        self->writeblocks[0] = mp_const_none;
+        self->writeblocks[1] = bdev;
+        self->writeblocks[2] = (mp_obj_t)sdioio_sdcard_writeblocks; // native version
+        self->u.ioctl[0] = mp_const_none;
+        self->u.ioctl[1] = bdev;
+        self->u.ioctl[2] = (mp_obj_t)sdioio_sdcard_ioctl; // native version
     }
     #endif
     if (self->u.ioctl[0] != MP_OBJ_NULL) {
@@ -76,7 +94,9 @@ void mp_vfs_blockdev_init(mp_vfs_blockdev_t *self, mp_obj_t bdev) {
     }
 }
 
-int mp_vfs_blockdev_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
+// CIRCUITPY-CHANGE: mp_vfs_blockdev_read() and mp_vfs_blockdev_write() go
+// through the block cache when it is enabled.
+static int blockdev_read_uncached(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
     if (self->flags & MP_BLOCKDEV_FLAG_NATIVE) {
         // CIRCUITPY-CHANGE: Pass the blockdev object into native readblocks so
         // it has the corresponding state.
@@ -105,7 +125,7 @@ int mp_vfs_blockdev_read_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t b
     }
 }
 
-int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf) {
+static int blockdev_write_uncached(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf) {
     if (self->writeblocks[0] == MP_OBJ_NULL) {
         // read-only block device
         return -MP_EROFS;
@@ -144,7 +164,224 @@ int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t
     }
 }
 
+// CIRCUITPY-CHANGE: Write-back LRU cache of single blocks, shared by all user
+// block devices. FatFs reads and writes the FAT and directories one sector at
+// a time through its single sector window, so those sectors are cached.
+// Multi-block transfers are file data, and go straight to the device.
+#if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+
+#define CACHE_BLOCK_SIZE (512)
+
+typedef struct {
+    // NULL when the entry is unused. This points into the first GC block of
+    // the fs_user_mount_t, so mp_vfs_blockdev_cache_gc_collect() keeps the
+    // filesystem alive while it has blocks in the cache.
+    mp_vfs_blockdev_t *dev;
+    uint32_t block_num;
+    uint32_t last_used;
+    bool dirty;
+} cache_entry_t;
+
+static cache_entry_t cache_entries[CIRCUITPY_BLOCKDEV_CACHE_SECTORS];
+// Allocated from the port heap when first needed.
+static uint8_t *cache_data;
+static uint32_t cache_clock;
+
+static bool cache_usable(mp_vfs_blockdev_t *self) {
+    if (!(self->flags & MP_BLOCKDEV_FLAG_CACHED) || self->block_size != CACHE_BLOCK_SIZE) {
+        return false;
+    }
+    if (cache_data == NULL) {
+        cache_data = port_malloc(CIRCUITPY_BLOCKDEV_CACHE_SECTORS * CACHE_BLOCK_SIZE, true);
+    }
+    return cache_data != NULL;
+}
+
+static uint8_t *cache_block(size_t i) {
+    return cache_data + i * CACHE_BLOCK_SIZE;
+}
+
+static int cache_find(mp_vfs_blockdev_t *self, size_t block_num) {
+    for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+        if (cache_entries[i].dev == self && cache_entries[i].block_num == block_num) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int cache_write_back(size_t i) {
+    cache_entry_t *entry = &cache_entries[i];
+    if (!entry->dirty) {
+        return 0;
+    }
+    int ret = blockdev_write_uncached(entry->dev, entry->block_num, 1, cache_block(i));
+    if (ret == 0) {
+        entry->dirty = false;
+    }
+    return ret;
+}
+
+// Free up the least recently used entry, or an unused one, and return it.
+// Returns -1 and sets *ret if a dirty block couldn't be written back.
+static int cache_evict(int *ret) {
+    size_t victim = 0;
+    for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+        if (cache_entries[i].dev == NULL) {
+            return i;
+        }
+        if (cache_entries[i].last_used < cache_entries[victim].last_used) {
+            victim = i;
+        }
+    }
+    *ret = cache_write_back(victim);
+    if (*ret != 0) {
+        return -1;
+    }
+    cache_entries[victim].dev = NULL;
+    return victim;
+}
+
+static void cache_touch(size_t i) {
+    cache_entries[i].last_used = ++cache_clock;
+}
+
+int mp_vfs_blockdev_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
+    if (!cache_usable(self)) {
+        return blockdev_read_uncached(self, block_num, num_blocks, buf);
+    }
+    if (num_blocks > 1) {
+        int ret = blockdev_read_uncached(self, block_num, num_blocks, buf);
+        if (ret != 0) {
+            return ret;
+        }
+        // Cached blocks may be newer than the device.
+        for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+            cache_entry_t *entry = &cache_entries[i];
+            if (entry->dev == self && entry->block_num >= block_num && entry->block_num < block_num + num_blocks) {
+                memcpy(buf + (entry->block_num - block_num) * CACHE_BLOCK_SIZE, cache_block(i), CACHE_BLOCK_SIZE);
+            }
+        }
+        return 0;
+    }
+    int i = cache_find(self, block_num);
+    if (i < 0) {
+        int ret;
+        i = cache_evict(&ret);
+        if (i < 0) {
+            return ret;
+        }
+        // The entry is only filled in once the read has succeeded, because
+        // a Python block device can raise.
+        ret = blockdev_read_uncached(self, block_num, 1, cache_block(i));
+        if (ret != 0) {
+            return ret;
+        }
+        cache_entries[i].dev = self;
+        cache_entries[i].block_num = block_num;
+        cache_entries[i].dirty = false;
+    }
+    cache_touch(i);
+    memcpy(buf, cache_block(i), CACHE_BLOCK_SIZE);
+    return 0;
+}
+
+int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf) {
+    if (self->writeblocks[0] == MP_OBJ_NULL || !cache_usable(self)) {
+        return blockdev_write_uncached(self, block_num, num_blocks, buf);
+    }
+    if (num_blocks > 1) {
+        int ret = blockdev_write_uncached(self, block_num, num_blocks, buf);
+        if (ret != 0) {
+            return ret;
+        }
+        // Keep cached copies up to date. They now match the device.
+        for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+            cache_entry_t *entry = &cache_entries[i];
+            if (entry->dev == self && entry->block_num >= block_num && entry->block_num < block_num + num_blocks) {
+                memcpy(cache_block(i), buf + (entry->block_num - block_num) * CACHE_BLOCK_SIZE, CACHE_BLOCK_SIZE);
+                entry->dirty = false;
+            }
+        }
+        return 0;
+    }
+    int i = cache_find(self, block_num);
+    if (i < 0) {
+        int ret;
+        i = cache_evict(&ret);
+        if (i < 0) {
+            return ret;
+        }
+        cache_entries[i].dev = self;
+        cache_entries[i].block_num = block_num;
+    }
+    cache_touch(i);
+    memcpy(cache_block(i), buf, CACHE_BLOCK_SIZE);
+    cache_entries[i].dirty = true;
+    return 0;
+}
+
+int mp_vfs_blockdev_cache_flush(mp_vfs_blockdev_t *self) {
+    int result = 0;
+    for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+        if (cache_entries[i].dev != NULL && (self == NULL || cache_entries[i].dev == self)) {
+            int ret = cache_write_back(i);
+            if (result == 0) {
+                result = ret;
+            }
+        }
+    }
+    return result;
+}
+
+int mp_vfs_blockdev_cache_drop(mp_vfs_blockdev_t *self) {
+    int result = mp_vfs_blockdev_cache_flush(self);
+    for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+        if (self == NULL || cache_entries[i].dev == self) {
+            cache_entries[i].dev = NULL;
+        }
+    }
+    return result;
+}
+
+void mp_vfs_blockdev_cache_reset(void) {
+    // Python block devices can raise, and there is no one to catch it now.
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_vfs_blockdev_cache_flush(NULL);
+        nlr_pop();
+    }
+    for (size_t i = 0; i < CIRCUITPY_BLOCKDEV_CACHE_SECTORS; i++) {
+        cache_entries[i].dev = NULL;
+    }
+    cache_clock = 0;
+    port_free(cache_data);
+    cache_data = NULL;
+}
+
+void mp_vfs_blockdev_cache_gc_collect(void) {
+    gc_collect_root((void **)cache_entries, sizeof(cache_entries) / (sizeof(void *)));
+}
+
+#else
+
+int mp_vfs_blockdev_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
+    return blockdev_read_uncached(self, block_num, num_blocks, buf);
+}
+
+int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf) {
+    return blockdev_write_uncached(self, block_num, num_blocks, buf);
+}
+
+#endif // CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+
 mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t arg) {
+    // CIRCUITPY-CHANGE: The device can't sync blocks that are still in the cache.
+    #if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+    if (cmd == MP_BLOCKDEV_IOCTL_SYNC || cmd == MP_BLOCKDEV_IOCTL_DEINIT) {
+        mp_vfs_blockdev_cache_flush(self);
+    }
+    #endif
     if (self->flags & MP_BLOCKDEV_FLAG_HAVE_IOCTL) {
         // CIRCUITPY-CHANGE: Support native IOCTL so it can run outside of the VM.
         if (self->flags & MP_BLOCKDEV_FLAG_NATIVE) {
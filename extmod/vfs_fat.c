@@ -46,6 +46,7 @@
 #include "extmod/vfs_fat.h"
 #include "shared/timeutils/timeutils.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/reload_filter.h"
 
 #if FF_MAX_SS == FF_MIN_SS
 #define SECSIZE(fs) (FF_MIN_SS)
@@ -65,6 +66,8 @@ static mp_import_stat_t fat_vfs_import_stat(void *vfs_in, const char *path) {
     fs_user_mount_t *vfs = vfs_in;
     FILINFO fno;
     assert(vfs != NULL);
+    // CIRCUITPY-CHANGE: a module added here later could change what imports.
+    reload_filter_track_lookup(&vfs->fatfs, path, false);
     FRESULT res = f_stat(&vfs->fatfs, path, &fno);
     if (res == FR_OK) {
         if ((fno.fattrib & AM_DIR) != 0) {
@@ -138,11 +141,112 @@ static mp_obj_t fat_vfs_mkfs(mp_obj_t bdev_in) {
 static MP_DEFINE_CONST_FUN_OBJ_1(fat_vfs_mkfs_fun_obj, fat_vfs_mkfs);
 static MP_DEFINE_CONST_STATICMETHOD_OBJ(fat_vfs_mkfs_obj, MP_ROM_PTR(&fat_vfs_mkfs_fun_obj));
 
+// CIRCUITPY-CHANGE
+static mp_obj_t fat_vfs_mtime(const FILINFO *fno) {
+    #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_NONE
+    // On non-longint builds, the number of seconds since 1970 (epoch) is too
+    // large to fit in a smallint, so just return 31-DEC-1999 (0).
+    return MP_OBJ_NEW_SMALL_INT(946684800);
+    #else
+    return mp_obj_new_int_from_uint(
+        timeutils_seconds_since_epoch(
+            1980 + ((fno->fdate >> 9) & 0x7f),
+            (fno->fdate >> 5) & 0x0f,
+            fno->fdate & 0x1f,
+            (fno->ftime >> 11) & 0x1f,
+            (fno->ftime >> 5) & 0x3f,
+            2 * (fno->ftime & 0x1f)
+            ));
+    #endif
+}
+
+// CIRCUITPY-CHANGE: stat() keeps the directory of the last lookup open, along
+// with its position in it. stat()ing the files of one directory, typically in
+// listdir() order, then finds each entry where the previous search stopped,
+// instead of walking the path and scanning the directory from the start every
+// time. Any block written to the filesystem drops the cache, so renames and
+// removals, including ones by USB or a workflow, can't leave it stale.
+#define STAT_CACHE_PATH_LEN (64)
+
+static struct {
+    FATFS *fs;
+    FF_DIR dir;
+    char path[STAT_CACHE_PATH_LEN];
+} stat_cache;
+
+void fat_vfs_stat_cache_invalidate(FATFS *fs) {
+    if (fs == NULL || stat_cache.fs == fs) {
+        stat_cache.fs = NULL;
+    }
+}
+
+// FAT names are case insensitive. Only ASCII is folded here; other names
+// that differ just in case fall back to f_stat().
+static bool fat_vfs_name_equal(const char *a, const char *b) {
+    while (*a != 0 && unichar_tolower((unsigned char)*a) == unichar_tolower((unsigned char)*b)) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+static bool fat_vfs_stat_cached(FATFS *fs, const char *path, FILINFO *fno) {
+    const char *name = strrchr(path, '/');
+    if (path[0] != '/' || name[1] == 0 ||
+        strcmp(name, "/.") == 0 || strcmp(name, "/..") == 0) {
+        return false;
+    }
+    size_t dir_len = name - path;
+    name++;
+    if (dir_len >= STAT_CACHE_PATH_LEN) {
+        return false;
+    }
+    if (stat_cache.fs != fs || stat_cache.dir.obj.id != fs->id ||
+        strncmp(stat_cache.path, path, dir_len) != 0 || stat_cache.path[dir_len] != 0) {
+        stat_cache.fs = NULL;
+        char dir_path[STAT_CACHE_PATH_LEN];
+        memcpy(dir_path, path, dir_len);
+        dir_path[dir_len] = 0;
+        if (f_opendir(fs, &stat_cache.dir, dir_len == 0 ? "/" : dir_path) != FR_OK) {
+            return false;
+        }
+        memcpy(stat_cache.path, dir_path, dir_len + 1);
+        stat_cache.fs = fs;
+    }
+
+    // Search from where the last lookup stopped, wrapping around once.
+    bool wrapped = false;
+    for (;;) {
+        if (f_readdir(&stat_cache.dir, fno) != FR_OK) {
+            stat_cache.fs = NULL;
+            return false;
+        }
+        if (fno->fname[0] == 0) {
+            if (wrapped) {
+                return false;
+            }
+            wrapped = true;
+            f_readdir(&stat_cache.dir, NULL);
+            continue;
+        }
+        if (fat_vfs_name_equal(fno->fname, name)) {
+            return true;
+        }
+        #if FF_USE_LFN
+        if (fat_vfs_name_equal(fno->altname, name)) {
+            return true;
+        }
+        #endif
+    }
+}
+
 typedef struct _mp_vfs_fat_ilistdir_it_t {
     mp_obj_base_t base;
     mp_fun_1_t iternext;
     mp_fun_1_t finaliser;
     bool is_str;
+    // CIRCUITPY-CHANGE
+    bool with_mtime;
     FF_DIR dir;
 } mp_vfs_fat_ilistdir_it_t;
 
@@ -174,6 +278,12 @@ static mp_obj_t mp_vfs_fat_ilistdir_it_iternext(mp_obj_t self_in) {
             // file
             t->items[1] = MP_OBJ_NEW_SMALL_INT(MP_S_IFREG);
         }
+        // CIRCUITPY-CHANGE: (name, type, size, mtime) for fat_vfs_ilistdir_stat().
+        if (self->with_mtime) {
+            t->items[2] = mp_obj_new_int_from_uint(fno.fsize);
+            t->items[3] = fat_vfs_mtime(&fno);
+            return MP_OBJ_FROM_PTR(t);
+        }
         t->items[2] = MP_OBJ_NEW_SMALL_INT(0); // no inode number
         t->items[3] = mp_obj_new_int_from_uint(fno.fsize);
 
@@ -211,6 +321,9 @@ static mp_obj_t fat_vfs_ilistdir_func(size_t n_args, const mp_obj_t *args) {
     iter->iternext = mp_vfs_fat_ilistdir_it_iternext;
     iter->finaliser = mp_vfs_fat_ilistdir_it_del;
     iter->is_str = is_str_type;
+    // CIRCUITPY-CHANGE
+    iter->with_mtime = false;
+    reload_filter_track_lookup(&self->fatfs, path, true);
     FRESULT res = f_opendir(&self->fatfs, &iter->dir, path);
     if (res != FR_OK) {
         // CIRCUITPY-CHANGE
@@ -221,6 +334,14 @@ static mp_obj_t fat_vfs_ilistdir_func(size_t n_args, const mp_obj_t *args) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_ilistdir_obj, 1, 2, fat_vfs_ilistdir_func);
 
+// CIRCUITPY-CHANGE
+mp_obj_t fat_vfs_ilistdir_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
+    mp_obj_t args[2] = { vfs_in, path_in };
+    mp_vfs_fat_ilistdir_it_t *iter = MP_OBJ_TO_PTR(fat_vfs_ilistdir_func(2, args));
+    iter->with_mtime = true;
+    return MP_OBJ_FROM_PTR(iter);
+}
+
 static mp_obj_t fat_vfs_remove_internal(mp_obj_t vfs_in, mp_obj_t path_in, mp_int_t attr) {
     mp_obj_fat_vfs_t *self = MP_OBJ_TO_PTR(vfs_in);
     // CIRCUITPY-CHANGE
@@ -338,7 +459,8 @@ static mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
         fno.fdate = 0x2821; // Jan 1, 2000
         fno.ftime = 0;
         fno.fattrib = AM_DIR;
-    } else {
+    } else if (!fat_vfs_stat_cached(&self->fatfs, path, &fno)) {
+        // CIRCUITPY-CHANGE: only walk the path if the cached directory misses.
         FRESULT res = f_stat(&self->fatfs, path, &fno);
         if (res != FR_OK) {
             // CIRCUITPY-CHANGE
@@ -354,21 +476,7 @@ static mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
         mode |= MP_S_IFREG;
     }
     // CIRCUITPY-CHANGE
-    #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_NONE
-    // On non-longint builds, the number of seconds since 1970 (epoch) is too
-    // large to fit in a smallint, so just return 31-DEC-1999 (0).
-    mp_obj_t seconds_obj = MP_OBJ_NEW_SMALL_INT(946684800);
-    #else
-    mp_obj_t seconds_obj = mp_obj_new_int_from_uint(
-        timeutils_seconds_since_epoch(
-            1980 + ((fno.fdate >> 9) & 0x7f),
-            (fno.fdate >> 5) & 0x0f,
-            fno.fdate & 0x1f,
-            (fno.ftime >> 11) & 0x1f,
-            (fno.ftime >> 5) & 0x3f,
-            2 * (fno.ftime & 0x1f)
-            ));
-    #endif
+    mp_obj_t seconds_obj = fat_vfs_mtime(&fno);
     t->items[0] = MP_OBJ_NEW_SMALL_INT(mode); // st_mode
     t->items[1] = MP_OBJ_NEW_SMALL_INT(0); // st_ino
     t->items[2] = MP_OBJ_NEW_SMALL_INT(0); // st_dev
@@ -443,7 +551,13 @@ static mp_obj_t vfs_fat_mount(mp_obj_t self_in, mp_obj_t readonly, mp_obj_t mkfs
 static MP_DEFINE_CONST_FUN_OBJ_3(vfs_fat_mount_obj, vfs_fat_mount);
 
 static mp_obj_t vfs_fat_umount(mp_obj_t self_in) {
-    (void)self_in;
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE: the object may be freed once it's unmounted.
+    fat_vfs_stat_cache_invalidate(&self->fatfs);
+    // CIRCUITPY-CHANGE: write back and forget the cached blocks of the device.
+    #if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+    mp_vfs_blockdev_cache_drop(&self->blockdev);
+    #endif
     // keep the FAT filesystem mounted internally so the VFS methods can still be used
     return mp_const_none;
 }
@@ -47,6 +47,13 @@ extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
 MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 
+// CIRCUITPY-CHANGE: Iterates over (name, type, size, mtime) tuples for the
+// entries of a directory, without a lookup per entry.
+mp_obj_t fat_vfs_ilistdir_stat(mp_obj_t vfs_in, mp_obj_t path_in);
+// CIRCUITPY-CHANGE: Forget the directory that stat() keeps open for fs, or for
+// any filesystem when fs is NULL.
+void fat_vfs_stat_cache_invalidate(FATFS *fs);
+
 // CIRCUITPY-CHANGE
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
@@ -36,12 +36,17 @@
 #include "py/mphal.h"
 
 #include "py/runtime.h"
+#include "py/builtin.h"
 #include "py/binary.h"
 #include "py/objarray.h"
 #include "py/mperrno.h"
 #include "lib/oofatfs/ff.h"
 #include "lib/oofatfs/diskio.h"
 #include "extmod/vfs_fat.h"
+// CIRCUITPY-CHANGE
+#if CIRCUITPY_OS_GETENV_CACHE
+#include "shared-module/os/__init__.h"
+#endif
 
 typedef void *bdev_t;
 static fs_user_mount_t *disk_get_device(void *bdev) {
@@ -83,6 +88,17 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE: directory entries may be changing.
+    fat_vfs_stat_cache_invalidate(&vfs->fatfs);
+    // CIRCUITPY-CHANGE: settings.toml may be changing.
+    #if CIRCUITPY_OS_GETENV_CACHE
+    os_getenv_cache_invalidate();
+    #endif
+    // CIRCUITPY-CHANGE: modules may be appearing or disappearing.
+    #if MICROPY_MODULE_PATH_CACHE
+    mp_module_path_cache_invalidate();
+    #endif
+
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
     if (ret == -MP_EROFS) {
@@ -37,6 +37,7 @@
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs_fat.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/reload_filter.h"
 
 // this table converts from FRESULT to POSIX errno
 const byte fresult_to_errno_table[20] = {
@@ -193,6 +194,51 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &vfs_fat_rawfile_locals_dict
     );
 
+// CIRCUITPY-CHANGE: fast seek support.
+// Number of DWORDs in the on-stack map tried first. It holds three fragments,
+// which covers most files without walking the FAT a second time.
+#define LINKMAP_STACK_SIZE (8)
+
+// Build the file's cluster link map so that seeks look up their cluster in
+// the map instead of following the FAT chain from the start of the file. If
+// there isn't enough memory the file still works, just without fast seek.
+static void file_obj_create_linkmap(pyb_file_obj_t *o) {
+    FATFS *fs = o->fp.obj.fs;
+    #if FF_MAX_SS != FF_MIN_SS
+    FSIZE_t cluster_size = (FSIZE_t)fs->csize * fs->ssize;
+    #else
+    FSIZE_t cluster_size = (FSIZE_t)fs->csize * FF_MIN_SS;
+    #endif
+    // A file within one cluster has no chain to follow.
+    if (f_size(&o->fp) <= cluster_size) {
+        return;
+    }
+    DWORD temp_table[LINKMAP_STACK_SIZE];
+    temp_table[0] = LINKMAP_STACK_SIZE;
+    o->fp.cltbl = temp_table;
+    FRESULT res = f_lseek(&o->fp, CREATE_LINKMAP);
+    // On success temp_table[0] is the size used, otherwise the size needed.
+    DWORD size = temp_table[0];
+    DWORD *cltbl = NULL;
+    if (res == FR_OK || res == FR_NOT_ENOUGH_CORE) {
+        cltbl = m_malloc_maybe(size * sizeof(DWORD));
+    }
+    o->fp.cltbl = cltbl;
+    if (cltbl == NULL) {
+        return;
+    }
+    if (res == FR_OK) {
+        memcpy(cltbl, temp_table, size * sizeof(DWORD));
+    } else if (res == FR_NOT_ENOUGH_CORE) {
+        cltbl[0] = size;
+        res = f_lseek(&o->fp, CREATE_LINKMAP);
+    }
+    if (res != FR_OK) {
+        m_del(DWORD, cltbl, size);
+        o->fp.cltbl = NULL;
+    }
+}
+
 // Factory function for I/O stream classes
 static mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_in) {
     fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
@@ -254,6 +300,8 @@ static mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
     pyb_file_obj_t *o = mp_obj_malloc_with_finaliser(pyb_file_obj_t, type);
 
     const char *fname = mp_obj_str_get_str(path_in);
+    // CIRCUITPY-CHANGE: a new file here could change what the open finds.
+    reload_filter_track_lookup(&self->fatfs, fname, false);
     FRESULT res = f_open(&self->fatfs, &o->fp, fname, mode);
     if (res != FR_OK) {
         m_del_obj(pyb_file_obj_t, o);
@@ -262,22 +310,8 @@ static mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
     // CIRCUITPY-CHANGE: does fast seek.
     // If we're reading, turn on fast seek.
     if (mode == FA_READ) {
-        // One call to determine how much space we need.
-        DWORD temp_table[2];
-        temp_table[0] = 2;
-        o->fp.cltbl = temp_table;
-        f_lseek(&o->fp, CREATE_LINKMAP);
-        DWORD size = (temp_table[0] + 1) * 2;
-
-        // Now allocate the size and construct the map.
-        o->fp.cltbl = m_malloc_maybe(size * sizeof(DWORD));
-        if (o->fp.cltbl != NULL) {
-            o->fp.cltbl[0] = size;
-            res = f_lseek(&o->fp, CREATE_LINKMAP);
-            if (res != FR_OK) {
-                o->fp.cltbl = NULL;
-            }
-        }
+        file_obj_create_linkmap(o);
+        reload_filter_track_file(&o->fp);
     }
 
     // for 'a' mode, we must begin at the end of the file
@@ -32,6 +32,10 @@
 #include "shared/timeutils/timeutils.h"
 #include "extmod/vfs.h"
 #include "extmod/vfs_lfs.h"
+// CIRCUITPY-CHANGE: extra includes
+#if CIRCUITPY_RTC
+#include "shared-bindings/rtc/RTC.h"
+#endif
 
 enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime };
 
@@ -128,8 +132,19 @@ const char *mp_vfs_lfs2_make_path(mp_obj_vfs_lfs2_t *self, mp_obj_t path_in);
 mp_obj_t mp_vfs_lfs2_file_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_in);
 
 static void lfs_get_mtime(uint8_t buf[8]) {
+    // CIRCUITPY-CHANGE: Microcontroller ports have no mp_hal_time_ns(), so take
+    // the time from the RTC as get_fattime() does.
+    #if CIRCUITPY_RTC
+    timeutils_struct_time_t tm;
+    common_hal_rtc_get_time(&tm);
+    uint64_t ns = timeutils_seconds_since_epoch_to_nanoseconds_since_1970(
+        timeutils_seconds_since_epoch(tm.tm_year, tm.tm_mon, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec));
+    #elif CIRCUITPY_LITTLEFS
+    uint64_t ns = 0;
+    #else
     // On-disk storage of timestamps uses 1970 as the Epoch, so convert from host's Epoch.
     uint64_t ns = timeutils_nanoseconds_since_epoch_to_nanoseconds_since_1970(mp_hal_time_ns());
+    #endif
     // Store "ns" to "buf" in little-endian format (essentially htole64).
     for (size_t i = 0; i < 8; ++i) {
         buf[i] = ns;
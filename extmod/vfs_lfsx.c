@@ -501,6 +501,8 @@ static mp_import_stat_t MP_VFS_LFSx(import_stat)(void *self_in, const char *path
 }
 
 static const mp_vfs_proto_t MP_VFS_LFSx(proto) = {
+    // CIRCUITPY-CHANGE
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_vfs)
     .import_stat = MP_VFS_LFSx(import_stat),
 };
 
@@ -67,11 +67,22 @@
 #define MBEDTLS_SSL_PROTO_TLS1_1
 #define MBEDTLS_SSL_PROTO_TLS1_2
 #define MBEDTLS_SSL_SERVER_NAME_INDICATION
+// Lets SSLContext resume sessions with servers that keep no session state.
+#define MBEDTLS_SSL_SESSION_TICKETS
 
-// Use a smaller output buffer to reduce size of SSL context
+// Record buffer sizes come from the board, see CIRCUITPY_SSL_IN_CONTENT_LEN.
+// A receive buffer under 16 kB asks servers for smaller records with the max
+// fragment length extension, so servers that ignore it will fail to connect.
+#ifndef CIRCUITPY_SSL_IN_CONTENT_LEN
+#define CIRCUITPY_SSL_IN_CONTENT_LEN (16384)
+#endif
+#ifndef CIRCUITPY_SSL_OUT_CONTENT_LEN
+#define CIRCUITPY_SSL_OUT_CONTENT_LEN (4096)
+#endif
+#define MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
 #define MBEDTLS_SSL_MAX_CONTENT_LEN (16384)
-#define MBEDTLS_SSL_IN_CONTENT_LEN  (MBEDTLS_SSL_MAX_CONTENT_LEN)
-#define MBEDTLS_SSL_OUT_CONTENT_LEN (4096)
+#define MBEDTLS_SSL_IN_CONTENT_LEN  (CIRCUITPY_SSL_IN_CONTENT_LEN)
+#define MBEDTLS_SSL_OUT_CONTENT_LEN (CIRCUITPY_SSL_OUT_CONTENT_LEN)
 
 // Enable mbedtls modules
 #define MBEDTLS_AES_C
@@ -700,7 +700,8 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int output		/* CIRCUITPY-CHANGE: 0 to only advance the stream and DC values */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -758,7 +759,8 @@ static JRESULT mcu_load (
 				}
 			} while (++z < 64);		/* Next AC element */
 
-			if (JD_FORMAT != 2 || !cmp) {	/* C components may not be processed if in grayscale output */
+			// CIRCUITPY-CHANGE: skip the IDCT for MCUs that won't be output
+			if (output && (JD_FORMAT != 2 || !cmp)) {	/* C components may not be processed if in grayscale output */
 				if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
 					d = (jd_yuv_t)((*tmp / 256) + 128);
 					if (JD_FASTDECODE >= 1) {
@@ -1010,6 +1012,9 @@ JRESULT jd_prepare (
 
 			jd->width = LDB_WORD(&seg[3]);		/* Image width in unit of pixel */
 			jd->height = LDB_WORD(&seg[1]);		/* Image height in unit of pixel */
+			// CIRCUITPY-CHANGE
+			jd->roi_left = 0; jd->roi_top = 0;
+			jd->roi_right = jd->width; jd->roi_bottom = jd->height;
 			jd->ncomp = seg[5];					/* Number of color components */
 			if (jd->ncomp != 3 && jd->ncomp != 1) return JDR_FMT3;	/* Err: Supports only Grayscale and Y/Cb/Cr */
 
@@ -1139,17 +1144,22 @@ JRESULT jd_decomp (
 	rst = rsc = 0;
 
 	rc = JDR_OK;
-	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
+	// CIRCUITPY-CHANGE: stop after the region of interest
+	for (y = 0; y < jd->height && y < jd->roi_bottom; y += my) {		/* Vertical loop of MCUs */
 		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
 			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
 				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
-			if (rc != JDR_OK) return rc;
-			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
+			// CIRCUITPY-CHANGE: MCUs outside the region of interest are only huffman decoded
+			int output = x < jd->roi_right && x + mx > jd->roi_left && y + my > jd->roi_top;
+			rc = mcu_load(jd, output);			/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
 			if (rc != JDR_OK) return rc;
+			if (output) {
+				rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
+				if (rc != JDR_OK) return rc;
+			}
 		}
 	}
 
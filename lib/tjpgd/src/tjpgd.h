@@ -86,6 +86,8 @@ struct JDEC {
 	size_t sz_pool;				/* Size of momory pool (bytes available) */
 	size_t (*infunc)(JDEC*, uint8_t*, size_t);	/* Pointer to jpeg stream input function */
 	void* device;				/* Pointer to I/O device identifiler for the session */
+	// CIRCUITPY-CHANGE: only decode MCUs overlapping this region of the full size image
+	uint16_t roi_left, roi_top, roi_right, roi_bottom;	/* Set to the whole image by jd_prepare; right and bottom are exclusive */
 };
 
 
@@ -12,6 +12,7 @@
 
 #include "genhdr/mpversion.h"
 #include "py/nlr.h"
+#include "py/builtin.h"
 #include "py/compile.h"
 #include "py/frozenmod.h"
 #include "py/mphal.h"
@@ -30,7 +31,10 @@
 #include "supervisor/cpu.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/perf.h"
+#include "supervisor/shared/trace.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/reload_filter.h"
 #include "supervisor/shared/safe_mode.h"
 #include "supervisor/shared/serial.h"
 #include "supervisor/shared/stack.h"
@@ -78,10 +82,34 @@
 #include "shared-bindings/epaperdisplay/EPaperDisplay.h"
 #endif
 
+#if CIRCUITPY_HASHLIB_SHA256_HW
+#include "shared-module/hashlib/__init__.h"
+#endif
+
+#if CIRCUITPY_COUNTIO_RECORDER
+#include "shared-module/countio/CountRecorder.h"
+#endif
+
+#if CIRCUITPY_GNSSIO
+#include "shared-module/gnssio/__init__.h"
+#endif
+
+#if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_VIDEO
+#include "shared-module/usb_video/__init__.h"
+#endif
+
 #if CIRCUITPY_KEYPAD
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_PYUSB
+#include "shared-module/usb/core/Transfer.h"
+#endif
+
+#if CIRCUITPY_MDNS
+#include "shared-module/mdns/__init__.h"
+#endif
+
 #if CIRCUITPY_MEMORYMONITOR
 #include "shared-module/memorymonitor/__init__.h"
 #endif
@@ -111,7 +139,7 @@
 uint8_t value_out = 0;
 #endif
 
-#if MICROPY_ENABLE_PYSTACK && CIRCUITPY_OS_GETENV
+#if (MICROPY_ENABLE_PYSTACK || MICROPY_ENABLE_GC) && CIRCUITPY_OS_GETENV
 #include "shared-module/os/__init__.h"
 #endif
 
@@ -126,6 +154,35 @@ static uint8_t *_pystack;
 
 static const char line_clear[] = "\x1b[2K\x1b[0G";
 
+// With CIRCUITPY_FAST_BOOT set, a reset by the watchdog or a deep sleep alarm runs code.py
+// before USB and the other workflows start, because nobody is expected to be attached. They
+// start once code.py finishes without going back to deep sleep.
+static bool workflow_deferred = false;
+
+static bool fast_boot_requested(void) {
+    #if CIRCUITPY_OS_GETENV
+    const mcu_reset_reason_t reset_reason = common_hal_mcu_processor_get_reset_reason();
+    if (get_safe_mode() != SAFE_MODE_NONE ||
+        (reset_reason != RESET_REASON_DEEP_SLEEP_ALARM && reset_reason != RESET_REASON_WATCHDOG)) {
+        return false;
+    }
+    mp_int_t fast_boot = 0;
+    (void)common_hal_os_getenv_int("CIRCUITPY_FAST_BOOT", &fast_boot);
+    return fast_boot != 0;
+    #else
+    return false;
+    #endif
+}
+
+static void start_workflow(void) {
+    workflow_deferred = false;
+    supervisor_workflow_start();
+
+    #if CIRCUITPY_STATUS_BAR
+    supervisor_status_bar_request_update(true);
+    #endif
+}
+
 #if MICROPY_ENABLE_PYSTACK || MICROPY_ENABLE_GC
 static uint8_t *_allocate_memory(safe_mode_t safe_mode, const char *env_key, size_t default_size, size_t *final_size) {
     *final_size = default_size;
@@ -137,12 +194,14 @@ static uint8_t *_allocate_memory(safe_mode_t safe_mode, const char *env_key, siz
         }
     }
     #endif
-    uint8_t *ptr = port_malloc(*final_size, false);
+    // The pystack and the first heap area hold the most used objects, so keep
+    // them in internal RAM if possible.
+    uint8_t *ptr = port_malloc_fast(*final_size);
 
     #if CIRCUITPY_OS_GETENV
     if (ptr == NULL) {
         // Fallback to the build size.
-        ptr = port_malloc(default_size, false);
+        ptr = port_malloc_fast(default_size);
     }
     #endif
     if (ptr == NULL) {
@@ -203,6 +262,12 @@ static void start_mp(safe_mode_t safe_mode) {
     mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR__slash_lib));
 
     mp_obj_list_init((mp_obj_list_t *)mp_sys_argv, 0);
+
+    #if CIRCUITPY_LITTLEFS
+    filesystem_mount_littlefs();
+    #endif
+
+    trace_event(TRACE_EVENT_VM_START, 0);
 }
 
 static void stop_mp(void) {
@@ -213,6 +278,13 @@ static void stop_mp(void) {
     while (gc_nbytes(vfs) > 0) {
         vfs = vfs->next;
     }
+    #if MICROPY_MODULE_PATH_CACHE
+    // Modules found in the unmounted filesystems, or relative to another
+    // current directory, are gone.
+    if (vfs != MP_STATE_VM(vfs_mount_table) || vfs != MP_STATE_VM(vfs_cur)) {
+        mp_module_path_cache_invalidate();
+    }
+    #endif
     MP_STATE_VM(vfs_mount_table) = vfs;
     MP_STATE_VM(vfs_cur) = vfs;
     #endif
@@ -231,6 +303,10 @@ static void stop_mp(void) {
     port_free(_heap);
     _heap = NULL;
 
+    #if MICROPY_MODULE_RETAIN
+    mp_module_retain_collect();
+    #endif
+
     #if MICROPY_ENABLE_PYSTACK
     port_free(_pystack);
     _pystack = NULL;
@@ -314,6 +390,8 @@ static void count_strn(void *data, const char *str, size_t len) {
 }
 
 static void cleanup_after_vm(mp_obj_t exception) {
+    trace_event(TRACE_EVENT_VM_END, 0);
+
     // Get the traceback of any exception from this run off the heap.
     // MP_OBJ_SENTINEL means "this run does not contribute to traceback storage, don't touch it"
     // MP_OBJ_NULL (=0) means "this run completed successfully, clear any stored traceback"
@@ -344,6 +422,11 @@ static void cleanup_after_vm(mp_obj_t exception) {
         }
     }
 
+    // Write back cached blocks while user block devices and their buses still work.
+    #if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+    mp_vfs_blockdev_cache_reset();
+    #endif
+
     // Reset port-independent devices, like CIRCUITPY_BLEIO_HCI.
     reset_devices();
 
@@ -373,6 +456,33 @@ static void cleanup_after_vm(mp_obj_t exception) {
     keypad_reset();
     #endif
 
+    #if CIRCUITPY_COUNTIO_RECORDER
+    countio_countrecorder_reset();
+    #endif
+
+    #if CIRCUITPY_GNSSIO
+    gnssio_reset();
+    #endif
+
+    // A frame passed to usb_video's send() is on the heap.
+    #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_VIDEO
+    usb_video_reset();
+    #endif
+
+    // Cached and browsed services are on the heap.
+    #if CIRCUITPY_MDNS
+    mdns_reset();
+    #endif
+
+    // Queued transfers point into buffers on the heap.
+    #if CIRCUITPY_PYUSB
+    usb_core_transfers_reset();
+    #endif
+
+    #if CIRCUITPY_HASHLIB_SHA256_HW
+    hashlib_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
@@ -453,6 +563,11 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
         usb_setup_with_vm();
         #endif
 
+        #if CIRCUITPY_AUTORELOAD_FILTER
+        fs_user_mount_t *circuitpy = filesystem_circuitpy();
+        reload_filter_reset(circuitpy == NULL ? NULL : &circuitpy->fatfs);
+        #endif
+
         // Check if a different run file has been allocated
         if (next_code_configuration != NULL) {
             next_code_configuration->options &= ~SUPERVISOR_NEXT_CODE_OPT_NEWLY_SET;
@@ -497,6 +612,10 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
         cleanup_after_vm(_exec_result.exception);
         _exec_result.exception = NULL;
 
+        if (workflow_deferred && !(_exec_result.return_code & PYEXEC_DEEP_SLEEP)) {
+            start_workflow();
+        }
+
         // If a new next code file was set, that is a reason to keep it (obviously). Stuff this into
         // the options because it can be treated like any other reason-for-stickiness bit. The
         // source is different though: it comes from the options that will apply to the next run,
@@ -654,8 +773,9 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
             // for USB to connect (enumeration delay), or for the BLE workflow to start.
             // We wait CIRCUITPY_WORKFLOW_CONNECTION_SLEEP_DELAY seconds after a restart.
             // But if we woke up from a real deep sleep, don't wait for connection. The user will need to
-            // do a hard reset to get out of the real deep sleep.
-            else if (awoke_from_true_deep_sleep ||
+            // do a hard reset to get out of the real deep sleep. A fast boot never started the
+            // workflows, so there is nothing to wait for either.
+            else if (awoke_from_true_deep_sleep || workflow_deferred ||
                      port_get_raw_ticks(NULL) > CIRCUITPY_WORKFLOW_CONNECTION_SLEEP_DELAY * 1024) {
                 // OK to start sleeping, real or fake.
                 #if CIRCUITPY_DISPLAYIO
@@ -814,17 +934,18 @@ static void __attribute__ ((noinline)) run_boot_py(safe_mode_t safe_mode) {
 
     // If not in safe mode, run boot before initing USB and capture output in a file.
 
-    // There is USB setup to do even if boot.py is not actually run.
-    const bool ok_to_run = filesystem_present()
-        && safe_mode == SAFE_MODE_NONE
-        && MP_STATE_VM(vfs_mount_table) != NULL;
-
     static const char *const boot_py_filenames[] = {"boot.py", "boot.txt"};
 
     // Do USB setup even if boot.py is not run.
 
     start_mp(safe_mode);
 
+    // There is USB setup to do even if boot.py is not actually run.
+    // A LittleFS CIRCUITPY is only mounted once the VM has started.
+    const bool ok_to_run = filesystem_present()
+        && safe_mode == SAFE_MODE_NONE
+        && MP_STATE_VM(vfs_mount_table) != NULL;
+
     #if CIRCUITPY_USB_DEVICE
     // Set up default USB values after boot.py VM starts but before running boot.py.
     usb_set_defaults();
@@ -859,17 +980,17 @@ static void __attribute__ ((noinline)) run_boot_py(safe_mode_t safe_mode) {
 
 
         #ifdef CIRCUITPY_BOOT_OUTPUT_FILE
-        // Get the base filesystem.
-        fs_user_mount_t *vfs = (fs_user_mount_t *)MP_STATE_VM(vfs_mount_table)->obj;
-        FATFS *fs = &vfs->fatfs;
+        // Get the base filesystem. boot_out.txt is only kept on a FAT CIRCUITPY.
+        fs_user_mount_t *vfs = filesystem_circuitpy();
+        FATFS *fs = vfs != NULL ? &vfs->fatfs : NULL;
 
         boot_output = NULL;
         #if CIRCUITPY_STATUS_BAR
         supervisor_status_bar_resume();
         #endif
-        bool write_boot_output = true;
+        bool write_boot_output = fs != NULL;
         FIL boot_output_file;
-        if (f_open(fs, &boot_output_file, CIRCUITPY_BOOT_OUTPUT_FILE, FA_READ) == FR_OK) {
+        if (write_boot_output && f_open(fs, &boot_output_file, CIRCUITPY_BOOT_OUTPUT_FILE, FA_READ) == FR_OK) {
             char *file_contents = m_new(char, boot_text.alloc);
             UINT chars_read;
             if (f_read(&boot_output_file, file_contents, 1 + boot_text.len, &chars_read) == FR_OK) {
@@ -1071,11 +1192,11 @@ int __attribute__((used)) main(void) {
 
     run_boot_py(get_safe_mode());
 
-    supervisor_workflow_start();
-
-    #if CIRCUITPY_STATUS_BAR
-    supervisor_status_bar_request_update(true);
-    #endif
+    if (fast_boot_requested()) {
+        workflow_deferred = true;
+    } else {
+        start_workflow();
+    }
 
     // Boot script is finished, so now go into REPL or run code.py.
     int exit_code = PYEXEC_FORCED_EXIT;
@@ -1117,6 +1238,8 @@ int __attribute__((used)) main(void) {
 }
 
 void gc_collect(void) {
+    uint32_t perf_start = perf_begin();
+    trace_event(TRACE_EVENT_GC_START, 0);
     gc_collect_start();
 
     mp_uint_t regs[10];
@@ -1126,6 +1249,10 @@ void gc_collect(void) {
     // have lost their references in the VM even though they are mounted.
     gc_collect_root((void **)&MP_STATE_VM(vfs_mount_table), sizeof(mp_vfs_mount_t) / sizeof(mp_uint_t));
 
+    #if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+    mp_vfs_blockdev_cache_gc_collect();
+    #endif
+
     port_gc_collect();
 
     background_callback_gc_collect();
@@ -1158,6 +1285,8 @@ void gc_collect(void) {
     // range.
     gc_collect_root((void **)sp, ((mp_uint_t)port_stack_get_top() - sp) / sizeof(mp_uint_t));
     gc_collect_end();
+    perf_end(PERF_COUNTER_GC, perf_start);
+    trace_event(TRACE_EVENT_GC_END, 0);
 }
 
 // Ports may provide an implementation of this function if it is needed
@@ -9,6 +9,8 @@ CHIP_FAMILY ?= max32
 
 # Necessary to build CircuitPython
 LONGINT_IMPL ?= MPZ
+# The Cortex-M4 multiplies 32 x 32 -> 64 bits in one instruction.
+MPZ_DIG_SIZE ?= 32
 INTERNAL_LIBM ?= 1
 
 # Req'd for OS; all max32 have TRNG
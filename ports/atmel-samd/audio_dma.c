@@ -14,7 +14,9 @@
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-module/audiocore/__init__.h"
 #include "supervisor/background_callback.h"
+#include "supervisor/shared/trace.h"
 
 #include "py/mpstate.h"
 #include "py/runtime.h"
@@ -78,8 +80,6 @@ static void audio_dma_convert_samples(
     uint8_t *available_output_buffer, uint32_t available_output_buffer_length,
     uint8_t **output, uint32_t *output_length,
     uint8_t *output_spacing) {
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wcast-align"
     if (dma->signed_to_unsigned || dma->unsigned_to_signed) {
 
         // Must convert.
@@ -92,32 +92,17 @@ static void audio_dma_convert_samples(
             mp_raise_RuntimeError(MP_ERROR_TEXT("Internal audio buffer too small"));
         }
 
-        uint32_t out_i = 0;
         if (dma->bytes_per_sample == 1) {
-            for (uint32_t i = 0; i < input_length; i += dma->spacing) {
-                if (dma->signed_to_unsigned) {
-                    ((uint8_t *)*output)[out_i] = ((int8_t *)input)[i] + 0x80;
-                } else {
-                    ((int8_t *)*output)[out_i] = ((uint8_t *)input)[i] - 0x80;
-                }
-                out_i += 1;
-            }
+            audiosample_convert_8_8(*output, input, *output_length, dma->spacing, 0x80);
         } else if (dma->bytes_per_sample == 2) {
-            for (uint32_t i = 0; i < input_length / 2; i += dma->spacing) {
-                if (dma->signed_to_unsigned) {
-                    ((uint16_t *)*output)[out_i] = ((int16_t *)input)[i] + 0x8000;
-                } else {
-                    ((int16_t *)*output)[out_i] = ((uint16_t *)input)[i] - 0x8000;
-                }
-                out_i += 1;
-            }
+            audiosample_convert_16_16((uint16_t *)(void *)*output, (const uint16_t *)(void *)input,
+                *output_length / 2, dma->spacing, 0x8000, 0, false);
         }
     } else {
         *output = input;
         *output_length = input_length;
         *output_spacing = dma->spacing;
     }
-    #pragma GCC diagnostic pop
 }
 
 static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
@@ -386,6 +371,7 @@ void audio_dma_evsys_handler(void) {
         if (!block_done) {
             continue;
         }
+        trace_event(TRACE_EVENT_DMA_ISR, dma->dma_channel);
 
         // By the time we get here, the write-back descriptor has been set to the
         // current running descriptor. Fill the buffer that the next chained descriptor
@@ -323,39 +323,46 @@ static void setup_dma(audiobusio_pdmin_obj_t *self, uint32_t length,
 // higher sample rate than specified.  Then after the audio is
 // recorded, a more expensive filter non-real-time filter could be
 // used to down-sample and low-pass.
-const uint16_t sinc_filter[OVERSAMPLING] = {
-    0, 2, 9, 21, 39, 63, 94, 132,
-    179, 236, 302, 379, 467, 565, 674, 792,
-    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
-    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
-    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
-    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
-    674, 565, 467, 379, 302, 236, 179, 132,
-    94, 63, 39, 21, 9, 2, 0, 0
-};
+// The filter taps are applied four PDM bits at a time: each row holds the
+// sum of the taps for every possible value of the four bits it covers, so
+// a sample takes 16 table lookups instead of 64 tests and adds. Bits arrive
+// most significant first, so bit 3 of each nibble is the row's first tap.
+#define PDM_NIBBLE(a, b, c, d) { \
+        0, a, b, a + b, c, a + c, b + c, a + b + c, \
+        d, a + d, b + d, a + b + d, c + d, a + c + d, b + c + d, a + b + c + d \
+}
 
-#ifdef SAMD21
-#define REPEAT_16_TIMES(X) do { for (uint8_t j = 0; j < 4; j++) { X X X X } } while (0)
-#else
-#define REPEAT_16_TIMES(X) do { X X X X X X X X X X X X X X X X } while (0)
-#endif
+static const uint16_t sinc_filter_nibbles[OVERSAMPLING / 4][16] = {
+    PDM_NIBBLE(21, 9, 2, 0),
+    PDM_NIBBLE(132, 94, 63, 39),
+    PDM_NIBBLE(379, 302, 236, 179),
+    PDM_NIBBLE(792, 674, 565, 467),
+    PDM_NIBBLE(1341, 1196, 1055, 920),
+    PDM_NIBBLE(1913, 1776, 1633, 1487),
+    PDM_NIBBLE(2352, 2263, 2159, 2042),
+    PDM_NIBBLE(2516, 2506, 2474, 2422),
+    PDM_NIBBLE(2352, 2422, 2474, 2506),
+    PDM_NIBBLE(1913, 2042, 2159, 2263),
+    PDM_NIBBLE(1341, 1487, 1633, 1776),
+    PDM_NIBBLE(792, 920, 1055, 1196),
+    PDM_NIBBLE(379, 467, 565, 674),
+    PDM_NIBBLE(132, 179, 236, 302),
+    PDM_NIBBLE(21, 39, 63, 94),
+    PDM_NIBBLE(0, 0, 2, 9),
+};
 
 static uint16_t filter_sample(uint32_t pdm_samples[4]) {
     uint16_t running_sum = 0;
-    const uint16_t *filter_ptr = sinc_filter;
+    const uint16_t (*row)[16] = sinc_filter_nibbles;
     for (uint8_t i = 0; i < OVERSAMPLING / 16; i++) {
         // The sample is 16-bits right channel in the upper two bytes and 16-bits left channel
         // in the lower two bytes.
         // We just ignore the upper bits
         uint32_t pdm_sample = pdm_samples[i];
-        REPEAT_16_TIMES({
-            if (pdm_sample & 0x8000) {
-                running_sum += *filter_ptr;
-            }
-            filter_ptr++;
-            pdm_sample <<= 1;
+        for (uint8_t j = 0; j < 4; j++) {
+            running_sum += (*row++)[(pdm_sample >> 12) & 0xf];
+            pdm_sample <<= 4;
         }
-            );
     }
     return running_sum;
 }
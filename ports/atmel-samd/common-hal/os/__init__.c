@@ -12,6 +12,8 @@
 
 #include "shared-bindings/os/__init__.h"
 
+#include <string.h>
+
 #ifdef SAM_D5X_E5X
 #include "hal/include/hal_rand_sync.h"
 #endif
@@ -55,7 +57,14 @@ bool common_hal_os_urandom(uint8_t *buffer, mp_uint_t length) {
     rand_sync_init(&random, TRNG);
     rand_sync_enable(&random);
 
-    rand_sync_read_buf8(&random, buffer, length);
+    // Every read waits for a whole 32-bit word, so use all of it.
+    while (length > 0) {
+        uint32_t word = rand_sync_read32(&random);
+        size_t n = MIN(length, sizeof(word));
+        memcpy(buffer, &word, n);
+        buffer += n;
+        length -= n;
+    }
 
     rand_sync_disable(&random);
     rand_sync_deinit(&random);
@@ -24,6 +24,7 @@ ifeq ($(CHIP_FAMILY),samd21)
 # fit in 256kB of flash
 
 CIRCUITPY_AESIO ?= 0
+CIRCUITPY_ARRAY_OPS ?= 0
 CIRCUITPY_ATEXIT ?= 0
 CIRCUITPY_AUDIOMIXER ?= 0
 CIRCUITPY_AUDIOMP3 ?= 0
@@ -155,4 +156,11 @@ CIRCUITPY_ULAB_OPTIMIZE_SIZE ?= 1
 endif # same51
 ######################################################################
 
+# The Cortex-M4 chips have the DWT cycle counter, and a 32 x 32 -> 64 bit
+# multiply for 32 bit mpz digits.
+ifneq ($(CHIP_FAMILY),samd21)
+CIRCUITPY_PERF_COUNTERS ?= 1
+MPZ_DIG_SIZE ?= 32
+endif
+
 CIRCUITPY_BUILD_EXTENSIONS ?= uf2
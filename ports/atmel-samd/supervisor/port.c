@@ -314,6 +314,11 @@ safe_mode_t port_init(void) {
     #endif
 
     samd_peripherals_enable_cache();
+
+    #if CIRCUITPY_PERF_COUNTERS
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
     #endif
 
     #ifdef SAMD21
@@ -471,6 +476,12 @@ uint32_t port_get_saved_word(void) {
     return *safe_word;
 }
 
+#if CIRCUITPY_PERF_COUNTERS
+uint32_t port_get_cpu_cycles(void) {
+    return DWT->CYCCNT;
+}
+#endif
+
 // TODO: Move this to an RTC backup register so we can preserve it when only the BACKUP power domain
 // is enabled.
 static volatile uint64_t overflowed_ticks = 0;
@@ -123,11 +123,20 @@ bool spi_flash_sector_command(uint8_t command, uint32_t address) {
     return true;
 }
 
+// Set when the device supports the 1-1-4 quad input page program.
+static bool quad_page_program = false;
+
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t length) {
     samd_peripherals_disable_and_clear_cache();
 
-    QSPI->INSTRCTRL.bit.INSTR = CMD_PAGE_PROGRAM;
-    uint32_t mode = QSPI_INSTRFRAME_WIDTH_SINGLE_BIT_SPI;
+    uint32_t mode;
+    if (quad_page_program) {
+        QSPI->INSTRCTRL.bit.INSTR = CMD_QUAD_PAGE_PROGRAM;
+        mode = QSPI_INSTRFRAME_WIDTH_QUAD_OUTPUT;
+    } else {
+        QSPI->INSTRCTRL.bit.INSTR = CMD_PAGE_PROGRAM;
+        mode = QSPI_INSTRFRAME_WIDTH_SINGLE_BIT_SPI;
+    }
 
     QSPI->INSTRFRAME.reg = mode |
         QSPI_INSTRFRAME_ADDRLEN_24BITS |
@@ -240,5 +249,10 @@ void spi_flash_init(void) {
 void spi_flash_init_device(const external_flash_device *device) {
     check_quad_enable(device);
 
+    // Quad programs need all four data lines connected.
+    #if !defined(EXTERNAL_FLASH_QSPI_SINGLE) && !defined(EXTERNAL_FLASH_QSPI_DUAL)
+    quad_page_program = device->supports_qspi_writes;
+    #endif
+
     // TODO(tannewt): Adjust the speed for the found device.
 }
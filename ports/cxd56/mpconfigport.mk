@@ -7,6 +7,8 @@ CIRCUITPY_TRANSLATE_OBJECT = 1
 
 # Longints can be implemented as mpz, as longlong, or not
 LONGINT_IMPL = MPZ
+# The Cortex-M4 multiplies 32 x 32 -> 64 bits in one instruction.
+MPZ_DIG_SIZE ?= 32
 
 CIRCUITPY_AUDIOBUSIO = 0
 CIRCUITPY_AUDIOIO = 0
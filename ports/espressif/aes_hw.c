@@ -0,0 +1,58 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// aesio's AES engine on ESP32 chips.
+
+#include "shared-module/aesio/__init__.h"
+
+// ESP-IDF implements these with the AES peripheral, using DMA for CBC and CTR
+// on the chips that have it.
+#include "mbedtls/aes.h"
+
+#if CIRCUITPY_AESIO_HW
+
+bool aesio_hw_crypt(const uint8_t *key, size_t key_length, enum AES_MODE mode, bool encrypt,
+    uint8_t iv[AES_BLOCKLEN], const uint8_t *src, uint8_t *dest, size_t len) {
+    mbedtls_aes_context aes;
+    mbedtls_aes_init(&aes);
+    // CTR mode only ever encrypts.
+    bool encrypt_key = encrypt || mode == AES_MODE_CTR;
+    int ret;
+    if (encrypt_key) {
+        ret = mbedtls_aes_setkey_enc(&aes, key, key_length * 8);
+    } else {
+        ret = mbedtls_aes_setkey_dec(&aes, key, key_length * 8);
+    }
+    if (ret == 0) {
+        int op = encrypt ? MBEDTLS_AES_ENCRYPT : MBEDTLS_AES_DECRYPT;
+        switch (mode) {
+            case AES_MODE_ECB:
+                for (size_t i = 0; i < len && ret == 0; i += AES_BLOCKLEN) {
+                    ret = mbedtls_aes_crypt_ecb(&aes, op, src + i, dest + i);
+                }
+                break;
+            case AES_MODE_CBC:
+                ret = mbedtls_aes_crypt_cbc(&aes, op, len, iv, src, dest);
+                break;
+            case AES_MODE_CTR: {
+                // len is whole blocks, so no key stream is left over.
+                size_t offset = 0;
+                uint8_t stream[AES_BLOCKLEN];
+                ret = mbedtls_aes_crypt_ctr(&aes, len, &offset, iv, stream, src, dest);
+                break;
+            }
+            default:
+                ret = -1;
+                break;
+        }
+    }
+    mbedtls_aes_free(&aes);
+    // Parameters are checked before anything is written, so a failure leaves
+    // dest and iv as they were.
+    return ret == 0;
+}
+
+#endif
@@ -21,6 +21,9 @@
 #include "esp_camera.h"
 #include "sensor.h"
 
+// Each frame buffer is a whole frame in PSRAM.
+#define MAX_FRAMEBUFFER_COUNT (8)
+
 //| class Camera:
 //|     def __init__(
 //|         self,
@@ -67,7 +70,9 @@
 //|         :param pixel_format: The pixel format of the captured image
 //|         :param frame_size: The size of captured image
 //|         :param jpeg_quality: For `PixelFormat.JPEG`, the quality. Higher numbers increase quality. If the quality is too high, the JPEG data will be larger than the available buffer size and the image will be unusable or truncated. The exact range of appropriate values depends on the sensor and must be determined empirically.
-//|         :param framebuffer_count: The number of framebuffers (1 for single-buffered and 2 for double-buffered)
+//|         :param framebuffer_count: The number of framebuffers (1 for single-buffered and 2 for double-buffered).
+//|             Up to 8 may be used. With more than one, the camera keeps capturing into the free buffers
+//|             while Python works on a frame, so the sensor's full frame rate can be sustained.
 //|         :param grab_mode: When to grab a new frame
 //|         """
 static mp_obj_t espcamera_camera_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -118,7 +123,7 @@ static mp_obj_t espcamera_camera_make_new(const mp_obj_type_t *type, size_t n_ar
     framesize_t frame_size = validate_frame_size(args[ARG_frame_size].u_obj, MP_QSTR_frame_size);
     pixformat_t pixel_format = validate_pixel_format(args[ARG_pixel_format].u_obj, MP_QSTR_pixel_format);
     mp_int_t jpeg_quality = mp_arg_validate_int_range(args[ARG_jpeg_quality].u_int, 2, 55, MP_QSTR_jpeg_quality);
-    mp_int_t framebuffer_count = mp_arg_validate_int_range(args[ARG_framebuffer_count].u_int, 1, 2, MP_QSTR_framebuffer_count);
+    mp_int_t framebuffer_count = mp_arg_validate_int_range(args[ARG_framebuffer_count].u_int, 1, MAX_FRAMEBUFFER_COUNT, MP_QSTR_framebuffer_count);
 
     espcamera_camera_obj_t *self = mp_obj_malloc_with_finaliser(espcamera_camera_obj_t, &espcamera_camera_type);
     common_hal_espcamera_camera_construct(
@@ -184,20 +189,7 @@ static MP_DEFINE_CONST_FUN_OBJ_1(espcamera_camera_frame_available_get_obj, espca
 MP_PROPERTY_GETTER(espcamera_camera_frame_available_obj,
     (mp_obj_t)&espcamera_camera_frame_available_get_obj);
 
-//|     def take(
-//|         self, timeout: Optional[float] = 0.25
-//|     ) -> Optional[displayio.Bitmap | ReadableBuffer]:
-//|         """Record a frame. Wait up to 'timeout' seconds for a frame to be captured.
-//|
-//|         In the case of timeout, `None` is returned.
-//|         If `pixel_format` is `PixelFormat.JPEG`, the returned value is a read-only `memoryview`.
-//|         Otherwise, the returned value is a read-only `displayio.Bitmap`.
-//|         """
-static mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
-    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
-    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
-    check_for_deinit(self);
-    camera_fb_t *result = common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000));
+static mp_obj_t frame_to_obj(espcamera_camera_obj_t *self, camera_fb_t *result) {
     if (!result) {
         return mp_const_none;
     }
@@ -213,8 +205,65 @@ static mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
         return bitmap;
     }
 }
+
+//|     def take(
+//|         self, timeout: Optional[float] = 0.25
+//|     ) -> Optional[displayio.Bitmap | ReadableBuffer]:
+//|         """Record a frame. Wait up to 'timeout' seconds for a frame to be captured.
+//|
+//|         In the case of timeout, `None` is returned.
+//|         If `pixel_format` is `PixelFormat.JPEG`, the returned value is a read-only `memoryview`.
+//|         Otherwise, the returned value is a read-only `displayio.Bitmap`.
+//|         """
+static mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
+    check_for_deinit(self);
+    return frame_to_obj(self, common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000)));
+}
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_obj, 1, 2, espcamera_camera_take);
 
+//|     def take_latest(self) -> Optional[displayio.Bitmap | ReadableBuffer]:
+//|         """Return the most recently captured frame without waiting, or `None` if no
+//|         new frame has been captured since the last one taken. Older frames that are
+//|         waiting are released back to the camera and counted in `frames_dropped`.
+//|
+//|         Like `take`, the frame is only valid until the next call to `take` or `take_latest`.
+//|         """
+static mp_obj_t espcamera_camera_take_latest(mp_obj_t self_in) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return frame_to_obj(self, common_hal_espcamera_camera_take_latest(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(espcamera_camera_take_latest_obj, espcamera_camera_take_latest);
+
+//|     frame_timestamp_ns: int
+//|     """When the frame last returned by `take` or `take_latest` finished capturing, on the
+//|     same clock as `time.monotonic_ns()`. 0 before any frame is taken."""
+static mp_obj_t espcamera_camera_get_frame_timestamp_ns(const mp_obj_t self_in) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_ull(common_hal_espcamera_camera_get_frame_timestamp_us(self) * 1000);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(espcamera_camera_get_frame_timestamp_ns_obj, espcamera_camera_get_frame_timestamp_ns);
+
+MP_PROPERTY_GETTER(espcamera_camera_frame_timestamp_ns_obj,
+    (mp_obj_t)&espcamera_camera_get_frame_timestamp_ns_obj);
+
+//|     frames_dropped: int
+//|     """The number of frames the sensor produced that were never returned by `take` or
+//|     `take_latest`, because no buffer was free or a newer frame was taken instead.
+//|     It is estimated from the gaps between frame timestamps, and is reset by `reconfigure`."""
+static mp_obj_t espcamera_camera_get_frames_dropped(const mp_obj_t self_in) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_espcamera_camera_get_frames_dropped(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(espcamera_camera_get_frames_dropped_obj, espcamera_camera_get_frames_dropped);
+
+MP_PROPERTY_GETTER(espcamera_camera_frames_dropped_obj,
+    (mp_obj_t)&espcamera_camera_get_frames_dropped_obj);
+
 
 //|     def reconfigure(
 //|         self,
@@ -257,9 +306,9 @@ static mp_obj_t espcamera_camera_reconfigure(mp_uint_t n_args, const mp_obj_t *p
         args[ARG_grab_mode].u_obj != MP_ROM_NONE
         ?  validate_grab_mode(args[ARG_grab_mode].u_obj, MP_QSTR_grab_mode)
         : common_hal_espcamera_camera_get_grab_mode(self);
-    bool framebuffer_count =
+    mp_int_t framebuffer_count =
         args[ARG_framebuffer_count].u_obj != MP_ROM_NONE
-        ?  mp_obj_get_int(args[ARG_framebuffer_count].u_obj)
+        ?  mp_arg_validate_int_range(mp_obj_get_int(args[ARG_framebuffer_count].u_obj), 1, MAX_FRAMEBUFFER_COUNT, MP_QSTR_framebuffer_count)
         : common_hal_espcamera_camera_get_framebuffer_count(self);
 
     common_hal_espcamera_camera_reconfigure(self, frame_size, pixel_format, grab_mode, framebuffer_count);
@@ -910,7 +959,7 @@ MP_PROPERTY_GETTER(espcamera_camera_grab_mode_obj,
 
 
 //|     framebuffer_count: int
-//|     """True if double buffering is used"""
+//|     """The number of frame buffers the camera captures into"""
 //|
 static mp_obj_t espcamera_camera_get_framebuffer_count(const mp_obj_t self_in) {
     espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -944,6 +993,8 @@ static const mp_rom_map_elem_t espcamera_camera_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_exposure_ctrl), MP_ROM_PTR(&espcamera_camera_exposure_ctrl_obj) },
     { MP_ROM_QSTR(MP_QSTR_frame_available), MP_ROM_PTR(&espcamera_camera_frame_available_obj) },
     { MP_ROM_QSTR(MP_QSTR_frame_size), MP_ROM_PTR(&espcamera_camera_frame_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frame_timestamp_ns), MP_ROM_PTR(&espcamera_camera_frame_timestamp_ns_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frames_dropped), MP_ROM_PTR(&espcamera_camera_frames_dropped_obj) },
     { MP_ROM_QSTR(MP_QSTR_gain_ceiling), MP_ROM_PTR(&espcamera_camera_gain_ceiling_obj) },
     { MP_ROM_QSTR(MP_QSTR_gain_ctrl), MP_ROM_PTR(&espcamera_camera_gain_ctrl_obj) },
     { MP_ROM_QSTR(MP_QSTR_grab_mode), MP_ROM_PTR(&espcamera_camera_grab_mode_obj) },
@@ -961,6 +1012,7 @@ static const mp_rom_map_elem_t espcamera_camera_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_special_effect), MP_ROM_PTR(&espcamera_camera_special_effect_obj) },
     { MP_ROM_QSTR(MP_QSTR_supports_jpeg), MP_ROM_PTR(&espcamera_camera_supports_jpeg_obj) },
     { MP_ROM_QSTR(MP_QSTR_take), MP_ROM_PTR(&espcamera_camera_take_obj) },
+    { MP_ROM_QSTR(MP_QSTR_take_latest), MP_ROM_PTR(&espcamera_camera_take_latest_obj) },
     { MP_ROM_QSTR(MP_QSTR_vflip), MP_ROM_PTR(&espcamera_camera_vflip_obj) },
     { MP_ROM_QSTR(MP_QSTR_wb_mode), MP_ROM_PTR(&espcamera_camera_wb_mode_obj) },
     { MP_ROM_QSTR(MP_QSTR_whitebal), MP_ROM_PTR(&espcamera_camera_whitebal_obj) },
@@ -37,6 +37,9 @@ extern void common_hal_espcamera_camera_deinit(espcamera_camera_obj_t *self);
 extern bool common_hal_espcamera_camera_deinited(espcamera_camera_obj_t *self);
 extern bool common_hal_espcamera_camera_available(espcamera_camera_obj_t *self);
 extern camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int timeout_ms);
+extern camera_fb_t *common_hal_espcamera_camera_take_latest(espcamera_camera_obj_t *self);
+extern uint64_t common_hal_espcamera_camera_get_frame_timestamp_us(espcamera_camera_obj_t *self);
+extern uint32_t common_hal_espcamera_camera_get_frames_dropped(espcamera_camera_obj_t *self);
 extern void common_hal_espcamera_camera_reconfigure(espcamera_camera_obj_t *self, framesize_t frame_size, pixformat_t pixel_format, camera_grab_mode_t grab_mode, mp_int_t framebuffer_count);
 
 #define DECLARE_SENSOR_GETSET(type, name, field_name, setter_function_name) \
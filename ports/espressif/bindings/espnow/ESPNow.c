@@ -104,6 +104,8 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow___exit___obj, 4, 4, espnow_obj
 //|         """Send a message to the peer's mac address.
 //|
 //|         This blocks until a timeout of ``2`` seconds if the ESP-NOW internal buffers are full.
+//|         It does not wait for the peer to acknowledge the message, so several messages can be
+//|         in flight at once. Use `send_pending` to limit how far sending runs ahead.
 //|
 //|         :param ReadableBuffer message: The message to send (length <= 250 bytes).
 //|         :param Peer peer: Send message to this peer. If `None`, send to all registered peers.
@@ -151,6 +153,30 @@ static mp_obj_t espnow_read(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_obj, espnow_read);
 
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Move as many whole packets as fit from the receive buffer into ``buffer``.
+//|
+//|         Unlike `read`, this allocates nothing, so it can keep up with a busy link.
+//|         Each packet is stored as a record of 12 header bytes followed by the message:
+//|         the 6 byte mac address, the rssi (signed byte), the message length (byte) and
+//|         the receive time in milliseconds (4 bytes, little endian).
+//|
+//|         This is non-blocking.
+//|
+//|         :param WriteableBuffer buffer: Where to store the packet records.
+//|         :returns: The number of bytes stored. ``0`` if no packet is available or the next one does not fit."""
+//|         ...
+static mp_obj_t espnow_readinto(mp_obj_t self_in, mp_obj_t buffer_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    return mp_obj_new_int_from_uint(common_hal_espnow_readinto(self, bufinfo.buf, bufinfo.len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(espnow_readinto_obj, espnow_readinto);
+
 //|     send_success: int
 //|     """The number of tx packets received by the peer(s) ``ESP_NOW_SEND_SUCCESS``. (read-only)"""
 //|
@@ -175,6 +201,19 @@ MP_DEFINE_CONST_FUN_OBJ_1(espnow_send_get_failure_obj, espnow_send_get_failure);
 MP_PROPERTY_GETTER(espnow_send_failure_obj,
     (mp_obj_t)&espnow_send_get_failure_obj);
 
+//|     send_pending: int
+//|     """The number of sent packets still waiting for ``ESP_NOW_SEND_SUCCESS`` or
+//|     ``ESP_NOW_SEND_FAIL``. (read-only)"""
+//|
+static mp_obj_t espnow_get_send_pending(const mp_obj_t self_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_espnow_get_send_pending(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espnow_get_send_pending_obj, espnow_get_send_pending);
+
+MP_PROPERTY_GETTER(espnow_send_pending_obj,
+    (mp_obj_t)&espnow_get_send_pending_obj);
+
 //|     read_success: int
 //|     """The number of rx packets captured in the buffer. (read-only)"""
 //|
@@ -247,6 +286,29 @@ MP_PROPERTY_GETSET(espnow_phy_rate_obj,
     (mp_obj_t)&espnow_get_phy_rate_obj,
     (mp_obj_t)&espnow_set_phy_rate_obj);
 
+//|     long_range: bool
+//|     """Also use the Espressif long range (LR) mode. LR trades throughput for range
+//|     and is only understood by other Espressif devices."""
+//|
+static mp_obj_t espnow_get_long_range(const mp_obj_t self_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_espnow_get_long_range(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espnow_get_long_range_obj, espnow_get_long_range);
+
+static mp_obj_t espnow_set_long_range(const mp_obj_t self_in, const mp_obj_t value) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+    common_hal_espnow_set_long_range(self, mp_obj_is_true(value));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(espnow_set_long_range_obj, espnow_set_long_range);
+
+MP_PROPERTY_GETSET(espnow_long_range_obj,
+    (mp_obj_t)&espnow_get_long_range_obj,
+    (mp_obj_t)&espnow_set_long_range_obj);
+
 // --- Peer Related Properties ---
 
 //|     peers: Peers
@@ -273,9 +335,11 @@ static const mp_rom_map_elem_t espnow_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_send),         MP_ROM_PTR(&espnow_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_send_success), MP_ROM_PTR(&espnow_send_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_send_failure), MP_ROM_PTR(&espnow_send_failure_obj)},
+    { MP_ROM_QSTR(MP_QSTR_send_pending), MP_ROM_PTR(&espnow_send_pending_obj)},
 
     // Read messages
     { MP_ROM_QSTR(MP_QSTR_read),         MP_ROM_PTR(&espnow_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),     MP_ROM_PTR(&espnow_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_success), MP_ROM_PTR(&espnow_read_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_read_failure), MP_ROM_PTR(&espnow_read_failure_obj)},
 
@@ -283,6 +347,7 @@ static const mp_rom_map_elem_t espnow_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_pmk),      MP_ROM_PTR(&espnow_set_pmk_obj) },
     { MP_ROM_QSTR(MP_QSTR_buffer_size),  MP_ROM_PTR(&espnow_buffer_size_obj) },
     { MP_ROM_QSTR(MP_QSTR_phy_rate),     MP_ROM_PTR(&espnow_phy_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_long_range),   MP_ROM_PTR(&espnow_long_range_obj) },
 
     // Peer related properties
     { MP_ROM_QSTR(MP_QSTR_peers),        MP_ROM_PTR(&espnow_peers_obj) },
@@ -0,0 +1,210 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/util.h"
+#include "bindings/espulp/RingBuffer.h"
+
+#include "py/binary.h"
+#include "py/runtime.h"
+#include "py/objproperty.h"
+
+#include "sdkconfig.h"
+
+//| class RingBuffer:
+//|     def __init__(self, offset: int, capacity: int, *, threshold: Optional[int] = None) -> None:
+//|         """A queue of 32 bit words in ULP memory that a ULP program fills and
+//|         the main core empties. It lets the ULP sample for a long time and wake
+//|         the main core only once enough samples are waiting.
+//|
+//|         The buffer starts ``offset`` bytes into ULP memory, after the ULP
+//|         program. It is five header words followed by ``capacity`` data words:
+//|
+//|         ====  ==========  ===============================================
+//|         Word  Name        Use
+//|         ====  ==========  ===============================================
+//|         0     magic       Marks the buffer as set up
+//|         1     capacity    Number of data words
+//|         2     threshold   Number of waiting words at which to wake the main core
+//|         3     head        Index the ULP writes next. Only the ULP writes it.
+//|         4     tail        Index the main core reads next
+//|         ====  ==========  ===============================================
+//|
+//|         The ULP program stores a sample at ``5 + head``, then advances ``head``,
+//|         unless that would make it equal to ``tail``, which means the buffer is
+//|         full. Once ``(head - tail) % capacity`` reaches ``threshold`` it wakes
+//|         the main core, which `ULPAlarm` reports. The FSM ULP stores 16 bit
+//|         values, so only the low 16 bits of ``head`` are used.
+//|
+//|         A buffer already set up with the same ``capacity`` keeps its contents,
+//|         so samples taken while the main core was in deep sleep can be read
+//|         after it wakes.
+//|
+//|         :param int offset: Byte offset of the buffer in ULP memory, a multiple of 4.
+//|         :param int capacity: Number of data words. At most ``capacity - 1`` are waiting at once.
+//|         :param int threshold: Number of waiting words at which the ULP program
+//|             should wake the main core. Defaults to a full buffer.
+//|         """
+//|         ...
+static mp_obj_t espulp_ringbuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_offset, ARG_capacity, ARG_threshold };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_offset, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_capacity, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_threshold, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const mp_int_t max_words = CONFIG_ULP_COPROC_RESERVE_MEM / 4;
+    mp_int_t offset = mp_arg_validate_int_range(args[ARG_offset].u_int, 0, (max_words - ESPULP_RINGBUFFER_DATA - 2) * 4, MP_QSTR_offset);
+    if (offset % 4 != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_offset);
+    }
+    mp_int_t capacity = mp_arg_validate_int_range(args[ARG_capacity].u_int, 2, max_words - ESPULP_RINGBUFFER_DATA - offset / 4, MP_QSTR_capacity);
+    mp_int_t threshold = capacity - 1;
+    if (args[ARG_threshold].u_obj != mp_const_none) {
+        threshold = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_threshold].u_obj), 1, capacity - 1, MP_QSTR_threshold);
+    }
+
+    espulp_ringbuffer_obj_t *self = mp_obj_malloc(espulp_ringbuffer_obj_t, &espulp_ringbuffer_type);
+    common_hal_espulp_ringbuffer_construct(self, offset, capacity, threshold);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void check_for_deinit(espulp_ringbuffer_obj_t *self) {
+    if (common_hal_espulp_ringbuffer_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def deinit(self) -> None:
+//|         """Stops using the buffer. Its contents are left in ULP memory."""
+//|         ...
+static mp_obj_t espulp_ringbuffer_deinit(mp_obj_t self_in) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_espulp_ringbuffer_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(espulp_ringbuffer_deinit_obj, espulp_ringbuffer_deinit);
+
+//|     def __enter__(self) -> RingBuffer:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+static mp_obj_t espulp_ringbuffer_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return espulp_ringbuffer_deinit(args[0]);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espulp_ringbuffer___exit___obj, 4, 4, espulp_ringbuffer_obj___exit__);
+
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Moves waiting words into ``buffer``, oldest first, and returns how
+//|         many were moved. A buffer of 16 bit items, such as ``array.array("H")``,
+//|         receives the low 16 bits of each word. Any other buffer receives whole
+//|         little endian 32 bit words."""
+//|         ...
+static mp_obj_t espulp_ringbuffer_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    size_t itemsize = mp_binary_get_size('@', bufinfo.typecode, NULL) == 2 ? 2 : 4;
+    size_t count = common_hal_espulp_ringbuffer_readinto(self, bufinfo.buf, itemsize, bufinfo.len / itemsize);
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(espulp_ringbuffer_readinto_obj, espulp_ringbuffer_readinto);
+
+//|     def clear(self) -> None:
+//|         """Discards all waiting words."""
+//|         ...
+static mp_obj_t espulp_ringbuffer_clear(mp_obj_t self_in) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_espulp_ringbuffer_clear(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(espulp_ringbuffer_clear_obj, espulp_ringbuffer_clear);
+
+//|     capacity: int
+//|     """The number of data words. (read-only)"""
+static mp_obj_t espulp_ringbuffer_get_capacity(mp_obj_t self_in) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_ringbuffer_get_capacity(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_ringbuffer_get_capacity_obj, espulp_ringbuffer_get_capacity);
+
+MP_PROPERTY_GETTER(espulp_ringbuffer_capacity_obj,
+    (mp_obj_t)&espulp_ringbuffer_get_capacity_obj);
+
+//|     threshold: int
+//|     """The number of waiting words at which the ULP program should wake the
+//|     main core."""
+static mp_obj_t espulp_ringbuffer_get_threshold(mp_obj_t self_in) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_ringbuffer_get_threshold(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_ringbuffer_get_threshold_obj, espulp_ringbuffer_get_threshold);
+
+static mp_obj_t espulp_ringbuffer_set_threshold(mp_obj_t self_in, mp_obj_t threshold_in) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t capacity = common_hal_espulp_ringbuffer_get_capacity(self);
+    mp_int_t threshold = mp_arg_validate_int_range(mp_obj_get_int(threshold_in), 1, capacity - 1, MP_QSTR_threshold);
+    common_hal_espulp_ringbuffer_set_threshold(self, threshold);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(espulp_ringbuffer_set_threshold_obj, espulp_ringbuffer_set_threshold);
+
+MP_PROPERTY_GETSET(espulp_ringbuffer_threshold_obj,
+    (mp_obj_t)&espulp_ringbuffer_get_threshold_obj,
+    (mp_obj_t)&espulp_ringbuffer_set_threshold_obj);
+
+//|     def __len__(self) -> int:
+//|         """The number of words waiting to be read."""
+//|         ...
+//|
+static mp_obj_t espulp_ringbuffer_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    espulp_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t count = common_hal_espulp_ringbuffer_get_count(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(count != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(count);
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+static const mp_rom_map_elem_t espulp_ringbuffer_locals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit),      MP_ROM_PTR(&espulp_ringbuffer_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__),   MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__),    MP_ROM_PTR(&espulp_ringbuffer___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),    MP_ROM_PTR(&espulp_ringbuffer_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear),       MP_ROM_PTR(&espulp_ringbuffer_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_capacity),    MP_ROM_PTR(&espulp_ringbuffer_capacity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_threshold),   MP_ROM_PTR(&espulp_ringbuffer_threshold_obj) },
+};
+static MP_DEFINE_CONST_DICT(espulp_ringbuffer_locals_dict, espulp_ringbuffer_locals_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    espulp_ringbuffer_type,
+    MP_QSTR_RingBuffer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, espulp_ringbuffer_make_new,
+    locals_dict, &espulp_ringbuffer_locals_dict,
+    unary_op, espulp_ringbuffer_unary_op
+    );
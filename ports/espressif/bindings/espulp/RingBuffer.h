@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/espulp/RingBuffer.h"
+
+extern const mp_obj_type_t espulp_ringbuffer_type;
+
+void common_hal_espulp_ringbuffer_construct(espulp_ringbuffer_obj_t *self, uint32_t offset, uint32_t capacity, uint32_t threshold);
+bool common_hal_espulp_ringbuffer_deinited(espulp_ringbuffer_obj_t *self);
+void common_hal_espulp_ringbuffer_deinit(espulp_ringbuffer_obj_t *self);
+
+uint32_t common_hal_espulp_ringbuffer_get_capacity(espulp_ringbuffer_obj_t *self);
+uint32_t common_hal_espulp_ringbuffer_get_threshold(espulp_ringbuffer_obj_t *self);
+void common_hal_espulp_ringbuffer_set_threshold(espulp_ringbuffer_obj_t *self, uint32_t threshold);
+uint32_t common_hal_espulp_ringbuffer_get_count(espulp_ringbuffer_obj_t *self);
+size_t common_hal_espulp_ringbuffer_readinto(espulp_ringbuffer_obj_t *self, void *data, size_t itemsize, size_t len);
+void common_hal_espulp_ringbuffer_clear(espulp_ringbuffer_obj_t *self);
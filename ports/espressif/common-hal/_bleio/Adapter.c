@@ -451,8 +451,11 @@ mp_obj_t common_hal_bleio_adapter_connect(bleio_adapter_obj_t *self, bleio_addre
 
     // TODO: If we have keys, then try and encrypt the connection.
 
-    // TODO: Negotiate for better PHY and data lengths since we are the central. These are
+    // Negotiate for better PHY and data lengths since we are the central. These are
     // nice-to-haves so ignore any errors.
+    ble_gap_set_prefered_le_phy(conn_handle, BLE_GAP_LE_PHY_1M_MASK | BLE_GAP_LE_PHY_2M_MASK,
+        BLE_GAP_LE_PHY_1M_MASK | BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_CODED_ANY);
+    ble_gap_set_data_len(conn_handle, BLE_HCI_SET_DATALEN_TX_OCTETS_MAX, BLE_HCI_SET_DATALEN_TX_TIME_MAX);
 
     // Make the connection object and return it.
     for (size_t i = 0; i < BLEIO_TOTAL_CONNECTION_COUNT; i++) {
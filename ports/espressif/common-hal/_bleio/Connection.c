@@ -58,8 +58,7 @@ int bleio_connection_event_cb(struct ble_gap_event *event, void *connection_in)
         }
 
         case BLE_GAP_EVENT_PHY_UPDATE_COMPLETE: {
-            // Nothing to do here. CircuitPython doesn't tell the user what PHY
-            // we're on.
+            // Nothing to do here. The phy property reads the current PHY from NimBLE.
             break;
         }
 
@@ -178,6 +177,24 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     CHECK_NIMBLE_ERROR(ble_gap_update_params(self->conn_handle, &updated));
 }
 
+mp_int_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self) {
+    uint8_t tx_phy;
+    uint8_t rx_phy;
+    CHECK_NIMBLE_ERROR(ble_gap_read_le_phy(self->conn_handle, &tx_phy, &rx_phy));
+    return tx_phy == BLE_HCI_LE_PHY_2M ? 2 : 1;
+}
+
+void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, mp_int_t phy) {
+    uint8_t phys = phy == 2 ? BLE_GAP_LE_PHY_2M_MASK : BLE_GAP_LE_PHY_1M_MASK;
+    CHECK_NIMBLE_ERROR(ble_gap_set_prefered_le_phy(self->conn_handle, phys, phys, BLE_GAP_LE_PHY_CODED_ANY));
+}
+
+void common_hal_bleio_connection_request_larger_packets(bleio_connection_internal_t *self) {
+    // The ATT MTU is already exchanged when the connection is made.
+    CHECK_NIMBLE_ERROR(ble_gap_set_data_len(self->conn_handle,
+        BLE_HCI_SET_DATALEN_TX_OCTETS_MAX, BLE_HCI_SET_DATALEN_TX_TIME_MAX));
+}
+
 // Zero when discovery is in process. BLE_HS_EDONE or a BLE_HS_ error code when done.
 static volatile int _last_discovery_status;
 
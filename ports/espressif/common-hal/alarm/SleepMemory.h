@@ -20,8 +20,9 @@
 // RTC_DATA_ATTR will allocate storage in RTC_SLOW_MEM unless CONFIG_ESP32S2_RTCDATA_IN_FAST_MEM
 // is set. Any memory not allocated by us can be used by the ESP-IDF for heap or other purposes.
 
-// Use half of RTC_SLOW_MEM or RTC_FAST_MEM.
-#if defined(CONFIG_IDF_TARGET_ESP32H2)
+// Use half of RTC_SLOW_MEM or RTC_FAST_MEM, unless the board sets its own size.
+#if defined(SLEEP_MEMORY_LENGTH)
+#elif defined(CONFIG_IDF_TARGET_ESP32H2)
 // H2 has 4k of low power RAM
 #define SLEEP_MEMORY_LENGTH (2 * 1024)
 #elif defined(CONFIG_IDF_TARGET_ESP32)
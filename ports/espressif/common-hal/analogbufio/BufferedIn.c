@@ -295,3 +295,8 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     #endif // DEBUG_ANALOGBUFIO
     return captured_samples;
 }
+
+uint32_t common_hal_analogbufio_bufferedin_get_loop_position(analogbufio_bufferedin_obj_t *self) {
+    // readinto() always fills the buffer once, so there is no loop to report.
+    return 0;
+}
@@ -24,6 +24,9 @@
 // The number of output channels is fixed at 2
 #define CIRCUITPY_OUTPUT_SLOTS (2)
 
+// Number of allocated I2S channels. Their DMA stops in light sleep.
+static uint8_t i2s_channel_count;
+
 static void i2s_fill_buffer(i2s_t *self) {
     if (self->next_buffer_size == 0) {
         // Error, no new buffer queued.
@@ -125,9 +128,12 @@ void port_i2s_allocate_init(i2s_t *self, bool left_justified) {
     if (err == ESP_ERR_NOT_FOUND) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Peripheral in use"));
     }
+    i2s_channel_count++;
     self->playing = false;
     self->paused = false;
     self->stopping = false;
+    // Refilling the DMA buffers must not wait behind display refreshes.
+    self->callback.priority = BACKGROUND_CALLBACK_PRIORITY_REALTIME;
 
     i2s_event_callbacks_t callbacks = {
         .on_recv = NULL,
@@ -142,6 +148,11 @@ void port_i2s_deinit(i2s_t *self) {
     port_i2s_stop(self);
     i2s_del_channel(self->handle);
     self->handle = NULL;
+    i2s_channel_count--;
+}
+
+bool port_i2s_any_allocated(void) {
+    return i2s_channel_count > 0;
 }
 
 void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop) {
@@ -34,6 +34,7 @@ typedef struct {
 
 void port_i2s_allocate_init(i2s_t *self, bool left_justified);
 void port_i2s_deinit(i2s_t *self);
+bool port_i2s_any_allocated(void);
 
 void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop);
 void port_i2s_stop(i2s_t *self);
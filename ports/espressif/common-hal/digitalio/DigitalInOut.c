@@ -9,6 +9,8 @@
 
 #include "driver/gpio.h"
 #include "hal/gpio_hal.h"
+#include "soc/gpio_reg.h"
+#include "soc/soc_caps.h"
 
 static bool _pin_is_input(uint8_t pin_number) {
     const uint32_t iomux = READ_PERI_REG(GPIO_PIN_MUX_REG[pin_number]);
@@ -142,3 +144,43 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
     }
     return PULL_NONE;
 }
+
+bool common_hal_digitalio_has_reg_op(digitalinout_reg_op_t op) {
+    return op != DIGITALINOUT_REG_TOGGLE;
+}
+
+volatile uint32_t *common_hal_digitalio_digitalinout_get_reg(digitalio_digitalinout_obj_t *self, digitalinout_reg_op_t op, uint32_t *mask) {
+    const uint8_t pin = self->pin->number;
+
+    #if SOC_GPIO_PIN_COUNT > 32
+    if (pin >= 32) {
+        *mask = 1u << (pin - 32);
+        switch (op) {
+            case DIGITALINOUT_REG_READ:
+                return (volatile uint32_t *)GPIO_IN1_REG;
+            case DIGITALINOUT_REG_WRITE:
+                return (volatile uint32_t *)GPIO_OUT1_REG;
+            case DIGITALINOUT_REG_SET:
+                return (volatile uint32_t *)GPIO_OUT1_W1TS_REG;
+            case DIGITALINOUT_REG_RESET:
+                return (volatile uint32_t *)GPIO_OUT1_W1TC_REG;
+            default:
+                return NULL;
+        }
+    }
+    #endif
+
+    *mask = 1u << pin;
+    switch (op) {
+        case DIGITALINOUT_REG_READ:
+            return (volatile uint32_t *)GPIO_IN_REG;
+        case DIGITALINOUT_REG_WRITE:
+            return (volatile uint32_t *)GPIO_OUT_REG;
+        case DIGITALINOUT_REG_SET:
+            return (volatile uint32_t *)GPIO_OUT_W1TS_REG;
+        case DIGITALINOUT_REG_RESET:
+            return (volatile uint32_t *)GPIO_OUT_W1TC_REG;
+        default:
+            return NULL;
+    }
+}
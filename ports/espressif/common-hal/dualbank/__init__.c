@@ -12,98 +12,263 @@
 #include "esp_log.h"
 #include "esp_ota_ops.h"
 #include "esp_app_format.h"
+#include "mbedtls/sha256.h"
+
+#include "supervisor/port_heap.h"
+
+// Writes are gathered into whole flash sectors, and flash is erased a block
+// at a time as writes reach it, which is much faster than erasing each sector
+// or the whole partition up front.
+#define WRITE_SIZE (4096)
+#define ERASE_SIZE (65536)
 
 static const esp_partition_t *update_partition = NULL;
-static esp_ota_handle_t update_handle = 0;
 
-static const char *TAG = "dualbank";
+// Blocks from prepared_start to prepared_end are erased or hold data of this
+// update.
+static size_t prepared_start;
+static size_t prepared_end;
+// The end of the furthest write.
+static size_t written_end;
 
-void dualbank_reset(void) {
-    if (esp_ota_abort(update_handle) == ESP_OK) {
-        update_handle = 0;
-        update_partition = NULL;
-    }
-}
+// Sector sized and DMA capable, so flash writes go out in large chunks.
+static uint8_t *staged;
+static size_t staged_offset;
+static size_t staged_len;
+
+// The hash of the partition up to hashed_end. Sequential writes are hashed as
+// they arrive, with the hardware SHA engine when mbedtls is configured to use
+// it. Anything else is read back from flash when the hash is needed.
+static mbedtls_sha256_context sha256;
+static size_t hashed_end;
+
+static const char *TAG = "dualbank";
 
 static void __attribute__((noreturn)) task_fatal_error(void) {
     ESP_LOGE(TAG, "Exiting task due to fatal error...");
     mp_raise_RuntimeError(MP_ERROR_TEXT("Update failed"));
 }
 
-void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset) {
-    esp_err_t err;
+static void check_err(esp_err_t err, const char *what) {
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s failed (%s)", what, esp_err_to_name(err));
+        task_fatal_error();
+    }
+}
+
+static void write_flash(size_t offset, const void *buf, size_t len) {
+    check_err(esp_partition_write(update_partition, offset, buf, len), "esp_partition_write");
+}
+
+static void flush_staged(void) {
+    if (staged_len > 0) {
+        // Clear first, so a failed write isn't retried.
+        size_t len = staged_len;
+        staged_len = 0;
+        write_flash(staged_offset, staged, len);
+    }
+}
+
+static void start_update(void) {
+    if (update_partition != NULL) {
+        return;
+    }
+    update_partition = esp_ota_get_next_update_partition(NULL);
+    assert(update_partition != NULL);
 
     const esp_partition_t *running = esp_ota_get_running_partition();
-    const esp_partition_t *last_invalid = esp_ota_get_last_invalid_partition();
+    ESP_LOGI(TAG, "Running partition type %d subtype %d (offset 0x%08lu)",
+        running->type, running->subtype, running->address);
 
-    if (update_partition == NULL) {
-        update_partition = esp_ota_get_next_update_partition(NULL);
-        assert(update_partition != NULL);
+    ESP_LOGI(TAG, "Writing partition type %d subtype %d (offset 0x%08lu)\n",
+        update_partition->type, update_partition->subtype, update_partition->address);
 
-        ESP_LOGI(TAG, "Running partition type %d subtype %d (offset 0x%08lu)",
-            running->type, running->subtype, running->address);
+    prepared_start = 0;
+    prepared_end = 0;
+    written_end = 0;
+    staged_len = 0;
+    mbedtls_sha256_init(&sha256);
+    mbedtls_sha256_starts(&sha256, 0);
+    hashed_end = 0;
+}
 
-        ESP_LOGI(TAG, "Writing partition type %d subtype %d (offset 0x%08lu)\n",
-            update_partition->type, update_partition->subtype, update_partition->address);
+void dualbank_reset(void) {
+    if (update_partition != NULL) {
+        // Keep what was written, so that the update can be resumed.
+        if (staged_len > 0) {
+            esp_partition_write(update_partition, staged_offset, staged, staged_len);
+            staged_len = 0;
+        }
+        mbedtls_sha256_free(&sha256);
+        update_partition = NULL;
     }
+    if (staged != NULL) {
+        port_free(staged);
+        staged = NULL;
+    }
+}
 
-    if (update_handle == 0) {
-        if (len > sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t)) {
-            esp_app_desc_t new_app_info;
-            memcpy(&new_app_info, &((char *)buf)[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
-            ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
+static void check_new_app(const void *buf, size_t len) {
+    if (len <= sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t)) {
+        ESP_LOGE(TAG, "received package is not fit len");
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
+    }
 
-            esp_app_desc_t running_app_info;
-            if (esp_ota_get_partition_description(running, &running_app_info) == ESP_OK) {
-                ESP_LOGI(TAG, "Running firmware version: %s", running_app_info.version);
-            }
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    const esp_partition_t *last_invalid = esp_ota_get_last_invalid_partition();
 
-            esp_app_desc_t invalid_app_info;
-            if (esp_ota_get_partition_description(last_invalid, &invalid_app_info) == ESP_OK) {
-                ESP_LOGI(TAG, "Last invalid firmware version: %s", invalid_app_info.version);
-            }
+    esp_app_desc_t new_app_info;
+    memcpy(&new_app_info, &((char *)buf)[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
+    ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
 
-            // check new version with running version
-            if (memcmp(new_app_info.version, running_app_info.version, sizeof(new_app_info.version)) == 0) {
-                ESP_LOGW(TAG, "New version is the same as running version.");
-                mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is duplicate"));
-            }
+    esp_app_desc_t running_app_info;
+    if (esp_ota_get_partition_description(running, &running_app_info) == ESP_OK) {
+        ESP_LOGI(TAG, "Running firmware version: %s", running_app_info.version);
+    }
 
-            // check new version with last invalid partition
-            if (last_invalid != NULL) {
-                if (memcmp(new_app_info.version, invalid_app_info.version, sizeof(new_app_info.version)) == 0) {
-                    ESP_LOGW(TAG, "New version is the same as invalid version.");
-                    mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is invalid"));
-                }
-            }
+    esp_app_desc_t invalid_app_info;
+    if (esp_ota_get_partition_description(last_invalid, &invalid_app_info) == ESP_OK) {
+        ESP_LOGI(TAG, "Last invalid firmware version: %s", invalid_app_info.version);
+    }
 
-            err = esp_ota_begin(update_partition, OTA_SIZE_UNKNOWN, &update_handle);
-            if (err != ESP_OK) {
-                ESP_LOGE(TAG, "esp_ota_begin failed (%s)", esp_err_to_name(err));
-                task_fatal_error();
-            }
-        } else {
-            ESP_LOGE(TAG, "received package is not fit len");
-            mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
+    // check new version with running version
+    if (memcmp(new_app_info.version, running_app_info.version, sizeof(new_app_info.version)) == 0) {
+        ESP_LOGW(TAG, "New version is the same as running version.");
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is duplicate"));
+    }
+
+    // check new version with last invalid partition
+    if (last_invalid != NULL) {
+        if (memcmp(new_app_info.version, invalid_app_info.version, sizeof(new_app_info.version)) == 0) {
+            ESP_LOGW(TAG, "New version is the same as invalid version.");
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is invalid"));
         }
     }
+}
+
+// Hash what is in flash up to end.
+static void hash_flash(size_t end) {
+    uint8_t chunk[64];
+    while (hashed_end < end) {
+        uint8_t *buf = staged != NULL ? staged : chunk;
+        size_t n = MIN(end - hashed_end, staged != NULL ? (size_t)WRITE_SIZE : sizeof(chunk));
+        check_err(esp_partition_read(update_partition, hashed_end, buf, n), "esp_partition_read");
+        mbedtls_sha256_update(&sha256, buf, n);
+        hashed_end += n;
+    }
+}
+
+// Erase the blocks between the prepared ones and the range being written.
+static void prepare(size_t offset, size_t len) {
+    size_t start = offset / ERASE_SIZE * ERASE_SIZE;
+    size_t end = MIN((offset + len + ERASE_SIZE - 1) / ERASE_SIZE * ERASE_SIZE, update_partition->size);
+    if (prepared_start == prepared_end) {
+        prepared_start = start;
+        prepared_end = start;
+    }
+    if (start < prepared_start) {
+        check_err(esp_partition_erase_range(update_partition, start, prepared_start - start), "esp_partition_erase_range");
+        prepared_start = start;
+    }
+    if (end > prepared_end) {
+        check_err(esp_partition_erase_range(update_partition, prepared_end, end - prepared_end), "esp_partition_erase_range");
+        prepared_end = end;
+    }
+}
+
+void common_hal_dualbank_resume(size_t offset) {
+    start_update();
+    if (offset > update_partition->size) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
+    }
+    if (prepared_start == prepared_end) {
+        // Writing stopped at offset, in a block that was already erased.
+        prepared_start = 0;
+        prepared_end = MIN((offset + ERASE_SIZE - 1) / ERASE_SIZE * ERASE_SIZE, update_partition->size);
+    }
+    written_end = MAX(written_end, offset);
+}
+
+void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset) {
+    start_update();
 
     if (offset == 0) {
-        err = esp_ota_write(update_handle, buf, len);
-    } else {
-        err = esp_ota_write_with_offset(update_handle, buf, len, offset);
+        check_new_app(buf, len);
     }
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "esp_ota_write failed (%s)", esp_err_to_name(err));
-        task_fatal_error();
+    if (offset > update_partition->size || len > update_partition->size - offset) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
+    }
+    if (staged == NULL) {
+        staged = port_malloc(WRITE_SIZE, true);
+        if (staged == NULL) {
+            m_malloc_fail(WRITE_SIZE);
+        }
+    }
+
+    prepare(offset, len);
+
+    if (offset >= hashed_end && offset <= written_end) {
+        if (offset > hashed_end) {
+            // Such as after resuming.
+            flush_staged();
+            hash_flash(offset);
+        }
+        mbedtls_sha256_update(&sha256, buf, len);
+        hashed_end += len;
+    }
+    written_end = MAX(written_end, offset + len);
+
+    const uint8_t *data = buf;
+    size_t remaining = len;
+    size_t pos = offset;
+    if (staged_len > 0 && pos != staged_offset + staged_len) {
+        flush_staged();
+    }
+    while (remaining > 0) {
+        if (staged_len == 0) {
+            // Whole sectors go straight to flash.
+            size_t direct = (remaining / WRITE_SIZE) * WRITE_SIZE;
+            if (direct > 0 && pos % WRITE_SIZE == 0) {
+                write_flash(pos, data, direct);
+                data += direct;
+                pos += direct;
+                remaining -= direct;
+                continue;
+            }
+            staged_offset = pos;
+        }
+        // Stage up to the end of the sector.
+        size_t n = MIN(remaining, WRITE_SIZE - (staged_offset % WRITE_SIZE) - staged_len);
+        memcpy(staged + staged_len, data, n);
+        staged_len += n;
+        data += n;
+        pos += n;
+        remaining -= n;
+        if ((staged_offset + staged_len) % WRITE_SIZE == 0) {
+            flush_staged();
+        }
     }
 }
 
+void common_hal_dualbank_sha256(uint8_t digest[32]) {
+    start_update();
+    flush_staged();
+    // Data that wasn't written in order is read back.
+    hash_flash(written_end);
+    // Finish a copy, so that writing can go on.
+    mbedtls_sha256_context finished;
+    mbedtls_sha256_init(&finished);
+    mbedtls_sha256_clone(&finished, &sha256);
+    mbedtls_sha256_finish(&finished, digest);
+    mbedtls_sha256_free(&finished);
+}
+
 void common_hal_dualbank_switch(void) {
-    if (esp_ota_end(update_handle) == ESP_OK) {
-        update_handle = 0;
-        update_partition = NULL;
+    if (update_partition != NULL) {
+        flush_staged();
     }
+    // This validates the image, so the update doesn't need esp_ota_end() to
+    // read it all again first.
     esp_err_t err = esp_ota_set_boot_partition(esp_ota_get_next_update_partition(NULL));
     if (err != ESP_OK) {
         if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
@@ -113,4 +278,8 @@ void common_hal_dualbank_switch(void) {
         ESP_LOGE(TAG, "esp_ota_set_boot_partition failed (%s)!", esp_err_to_name(err));
         task_fatal_error();
     }
+    if (update_partition != NULL) {
+        mbedtls_sha256_free(&sha256);
+        update_partition = NULL;
+    }
 }
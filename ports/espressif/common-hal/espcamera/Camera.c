@@ -14,6 +14,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/util.h"
 #include "common-hal/microcontroller/Pin.h"
+#include "supervisor/shared/trace.h"
 
 #include "esp-camera/driver/private_include/cam_hal.h"
 
@@ -109,7 +110,8 @@ void common_hal_espcamera_camera_construct(
     self->camera_config.fb_count = framebuffer_count;
     self->camera_config.grab_mode = grab_mode;
 
-
+    self->buffer_to_return = NULL;
+    reset_frame_stats(self);
 
     i2c_lock(self);
     esp_err_t result = esp_camera_init(&self->camera_config);
@@ -156,12 +158,66 @@ bool common_hal_espcamera_camera_available(espcamera_camera_obj_t *self) {
     return esp_camera_fb_available();
 }
 
-camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int timeout_ms) {
+static void return_buffer(espcamera_camera_obj_t *self) {
     if (self->buffer_to_return) {
         esp_camera_fb_return(self->buffer_to_return);
         self->buffer_to_return = NULL;
     }
-    return self->buffer_to_return = esp_camera_fb_get_timeout(timeout_ms);
+}
+
+static void reset_frame_stats(espcamera_camera_obj_t *self) {
+    self->frame_timestamp_us = 0;
+    self->frame_period_us = 0;
+    self->frames_dropped = 0;
+}
+
+// The driver doesn't count the frames it overwrites or skips, so work out
+// how many sensor frames went by from the gap since the last frame taken.
+static camera_fb_t *account_frame(espcamera_camera_obj_t *self, camera_fb_t *fb) {
+    if (fb == NULL) {
+        return NULL;
+    }
+    uint64_t timestamp_us = (uint64_t)fb->timestamp.tv_sec * 1000000 + fb->timestamp.tv_usec;
+    uint32_t dropped = self->frames_dropped;
+    if (self->frame_timestamp_us != 0 && timestamp_us > self->frame_timestamp_us) {
+        uint64_t gap = timestamp_us - self->frame_timestamp_us;
+        if (self->frame_period_us == 0 || gap < self->frame_period_us) {
+            self->frame_period_us = gap;
+        }
+        self->frames_dropped += (gap + self->frame_period_us / 2) / self->frame_period_us - 1;
+    }
+    self->frame_timestamp_us = timestamp_us;
+    trace_event(TRACE_EVENT_FRAME, MIN(self->frames_dropped - dropped, UINT16_MAX));
+    return self->buffer_to_return = fb;
+}
+
+camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int timeout_ms) {
+    return_buffer(self);
+    return account_frame(self, esp_camera_fb_get_timeout(timeout_ms));
+}
+
+camera_fb_t *common_hal_espcamera_camera_take_latest(espcamera_camera_obj_t *self) {
+    return_buffer(self);
+    camera_fb_t *latest = NULL;
+    while (esp_camera_fb_available()) {
+        camera_fb_t *fb = esp_camera_fb_get_timeout(0);
+        if (fb == NULL) {
+            break;
+        }
+        if (latest) {
+            esp_camera_fb_return(latest);
+        }
+        latest = fb;
+    }
+    return account_frame(self, latest);
+}
+
+uint64_t common_hal_espcamera_camera_get_frame_timestamp_us(espcamera_camera_obj_t *self) {
+    return self->frame_timestamp_us;
+}
+
+uint32_t common_hal_espcamera_camera_get_frames_dropped(espcamera_camera_obj_t *self) {
+    return self->frames_dropped;
 }
 
 #define SENSOR_GETSET(type, name, field_name, setter_function_name) \
@@ -215,6 +271,10 @@ void common_hal_espcamera_camera_reconfigure(espcamera_camera_obj_t *self, frame
         frame_size = sensor_info->max_size;
     }
 
+    // cam_deinit() frees the frame buffers, including one Python may hold.
+    return_buffer(self);
+    reset_frame_stats(self);
+
     i2c_lock(self);
     cam_deinit();
     self->camera_config.pixel_format = pixel_format;
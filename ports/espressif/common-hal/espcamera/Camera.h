@@ -15,6 +15,11 @@ typedef struct espcamera_camera_obj {
     mp_obj_base_t base;
     camera_config_t camera_config;
     camera_fb_t *buffer_to_return;
+    // Capture time of the last frame returned, in microseconds since boot.
+    uint64_t frame_timestamp_us;
+    // Shortest gap seen between frames, taken as the sensor's frame period.
+    uint32_t frame_period_us;
+    uint32_t frames_dropped;
     pwmio_pwmout_obj_t pwm;
     busio_i2c_obj_t *i2c;
 } espcamera_obj_t;
@@ -51,6 +51,20 @@ typedef struct {
     uint8_t msg[0];             // Message is up to 250 bytes
 } __attribute__((packed)) espnow_packet_t;
 
+// recv_cb runs in the wifi task, so the receive buffer is shared with it.
+static portMUX_TYPE recv_buffer_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Copy from the front of the buffer without consuming it.
+static void ringbuf_peek_n(ringbuf_t *r, uint8_t *buf, size_t bufsize) {
+    size_t index = r->next_read;
+    for (size_t i = 0; i < bufsize; i++) {
+        buf[i] = r->buf[index];
+        if (++index >= r->size) {
+            index = 0;
+        }
+    }
+}
+
 // --- The ESP-NOW send and recv callback routines ---
 
 // Callback triggered when a sent packet is acknowledged by the peer (or not).
@@ -72,20 +86,22 @@ static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg,
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
     ringbuf_t *buf = self->recv_buffer;
 
-    if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
-        self->read_failure++;
-        return;
-    }
-
     espnow_header_t header;
     header.magic = ESPNOW_MAGIC;
     header.msg_len = msg_len;
     header.rssi = esp_now_info->rx_ctrl->rssi;
     header.time_ms = mp_hal_ticks_ms();
 
+    portENTER_CRITICAL(&recv_buffer_lock);
+    if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
+        portEXIT_CRITICAL(&recv_buffer_lock);
+        self->read_failure++;
+        return;
+    }
     ringbuf_put_n(buf, (uint8_t *)&header, sizeof(header));
     ringbuf_put_n(buf, esp_now_info->src_addr, ESP_NOW_ETH_ALEN);
     ringbuf_put_n(buf, msg, msg_len);
+    portEXIT_CRITICAL(&recv_buffer_lock);
 
     self->read_success++;
 }
@@ -149,8 +165,34 @@ void espnow_reset(void) {
 
 void common_hal_espnow_set_phy_rate(espnow_obj_t *self, mp_int_t value) {
     self->phy_rate = mp_arg_validate_int_range(value, 0, WIFI_PHY_RATE_MAX - 1, MP_QSTR_phy_rate);
+    if (!common_hal_espnow_deinited(self)) {
+        CHECK_ESP_RESULT(esp_wifi_config_espnow_rate(ESP_IF_WIFI_STA, self->phy_rate));
+        CHECK_ESP_RESULT(esp_wifi_config_espnow_rate(ESP_IF_WIFI_AP, self->phy_rate));
+    }
 };
 
+bool common_hal_espnow_get_long_range(espnow_obj_t *self) {
+    uint8_t protocol = 0;
+    esp_wifi_get_protocol(WIFI_IF_STA, &protocol);
+    return (protocol & WIFI_PROTOCOL_LR) != 0;
+}
+
+void common_hal_espnow_set_long_range(espnow_obj_t *self, bool value) {
+    // Long range only reaches other Espressif devices, which is fine for
+    // ESP-NOW. Keep the other protocols so that wifi keeps working.
+    wifi_interface_t ifs[] = { WIFI_IF_STA, WIFI_IF_AP };
+    for (size_t i = 0; i < MP_ARRAY_SIZE(ifs); i++) {
+        uint8_t protocol = 0;
+        CHECK_ESP_RESULT(esp_wifi_get_protocol(ifs[i], &protocol));
+        if (value) {
+            protocol |= WIFI_PROTOCOL_LR;
+        } else {
+            protocol &= ~WIFI_PROTOCOL_LR;
+        }
+        CHECK_ESP_RESULT(esp_wifi_set_protocol(ifs[i], protocol));
+    }
+}
+
 void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key) {
     CHECK_ESP_RESULT(esp_now_set_pmk(key));
 }
@@ -168,33 +210,51 @@ mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *mess
         RUN_BACKGROUND_TASKS;
     }
     CHECK_ESP_RESULT(err);
+    if (mac == NULL) {
+        // send_cb runs once for each peer.
+        esp_now_peer_num_t num;
+        esp_now_get_peer_num(&num);
+        self->send_count += num.total_num;
+    } else {
+        self->send_count++;
+    }
 
     return mp_const_none;
 }
 
-mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
-    if (!ringbuf_num_filled(self->recv_buffer)) {
-        return mp_const_none;
-    }
+size_t common_hal_espnow_get_send_pending(espnow_obj_t *self) {
+    return self->send_count - self->send_success - self->send_failure;
+}
 
-    // Read the packet header from the incoming buffer
-    espnow_header_t header;
-    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+// Take the next packet out of the receive buffer. mac must hold
+// ESP_NOW_ETH_ALEN bytes and msg ESP_NOW_MAX_DATA_LEN.
+static bool get_packet(espnow_obj_t *self, espnow_header_t *header, uint8_t *mac, uint8_t *msg) {
+    ringbuf_t *buf = self->recv_buffer;
+    portENTER_CRITICAL(&recv_buffer_lock);
+    if (!ringbuf_num_filled(buf)) {
+        portEXIT_CRITICAL(&recv_buffer_lock);
+        return false;
+    }
+    bool ok = ringbuf_get_n(buf, (uint8_t *)header, sizeof(*header)) == sizeof(*header) &&
+        header->magic == ESPNOW_MAGIC &&
+        header->msg_len <= ESP_NOW_MAX_DATA_LEN &&
+        ringbuf_get_n(buf, mac, ESP_NOW_ETH_ALEN) == ESP_NOW_ETH_ALEN &&
+        ringbuf_get_n(buf, msg, header->msg_len) == header->msg_len;
+    portEXIT_CRITICAL(&recv_buffer_lock);
+    if (!ok) {
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
+    return true;
+}
 
-    uint8_t msg_len = header.msg_len;
-
+mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+    espnow_header_t header;
     uint8_t mac_buf[ESP_NOW_ETH_ALEN];
-    uint8_t msg_buf[msg_len];
-
-    // Check the message packet header format and read the message data
-    if (header.magic != ESPNOW_MAGIC ||
-        msg_len > ESP_NOW_MAX_DATA_LEN ||
-        ringbuf_get_n(self->recv_buffer, mac_buf, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
-        ringbuf_get_n(self->recv_buffer, msg_buf, msg_len) != msg_len) {
-        mp_arg_error_invalid(MP_QSTR_buffer);
+    uint8_t msg_buf[ESP_NOW_MAX_DATA_LEN];
+    if (!get_packet(self, &header, mac_buf, msg_buf)) {
+        return mp_const_none;
     }
+    uint8_t msg_len = header.msg_len;
 
     mp_obj_t elems[4] = {
         mp_obj_new_bytes(mac_buf, ESP_NOW_ETH_ALEN),
@@ -205,3 +265,32 @@ mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
 
     return namedtuple_make_new((const mp_obj_type_t *)&espnow_packet_type_obj, 4, 0, elems);
 }
+
+size_t common_hal_espnow_readinto(espnow_obj_t *self, uint8_t *dest, size_t len) {
+    size_t written = 0;
+    while (true) {
+        // Only take packets that fit whole.
+        espnow_header_t header;
+        portENTER_CRITICAL(&recv_buffer_lock);
+        bool available = ringbuf_num_filled(self->recv_buffer) >= sizeof(header);
+        if (available) {
+            ringbuf_peek_n(self->recv_buffer, (uint8_t *)&header, sizeof(header));
+        }
+        portEXIT_CRITICAL(&recv_buffer_lock);
+        if (!available || written + ESPNOW_RECORD_HEADER_LEN + header.msg_len > len) {
+            break;
+        }
+
+        uint8_t *record = dest + written;
+        uint8_t *msg = record + ESPNOW_RECORD_HEADER_LEN;
+        get_packet(self, &header, record, msg);
+        record[6] = header.rssi;
+        record[7] = header.msg_len;
+        record[8] = header.time_ms;
+        record[9] = header.time_ms >> 8;
+        record[10] = header.time_ms >> 16;
+        record[11] = header.time_ms >> 24;
+        written += ESPNOW_RECORD_HEADER_LEN + header.msg_len;
+    }
+    return written;
+}
@@ -19,6 +19,7 @@ typedef struct _espnow_obj_t {
     size_t recv_buffer_size;
     wifi_phy_rate_t phy_rate;
     espnow_peers_obj_t *peers;
+    volatile size_t send_count;
     volatile size_t send_success;
     volatile size_t send_failure;
     volatile size_t read_success;
@@ -37,3 +38,11 @@ extern void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key);
 
 extern mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *message, const uint8_t *mac);
 extern mp_obj_t common_hal_espnow_read(espnow_obj_t *self);
+
+// readinto() record: mac (6), rssi (1), msg_len (1), time_ms (4, little endian), msg.
+#define ESPNOW_RECORD_HEADER_LEN (12)
+extern size_t common_hal_espnow_readinto(espnow_obj_t *self, uint8_t *dest, size_t len);
+extern size_t common_hal_espnow_get_send_pending(espnow_obj_t *self);
+
+extern bool common_hal_espnow_get_long_range(espnow_obj_t *self);
+extern void common_hal_espnow_set_long_range(espnow_obj_t *self, bool value);
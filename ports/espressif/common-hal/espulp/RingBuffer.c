@@ -0,0 +1,85 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "bindings/espulp/RingBuffer.h"
+
+#include "py/runtime.h"
+
+#include "soc/soc.h"
+
+#define RINGBUFFER_MAGIC (0x52494e47) // "RING"
+#define INDEX_MASK (0xffff)
+
+void common_hal_espulp_ringbuffer_construct(espulp_ringbuffer_obj_t *self, uint32_t offset, uint32_t capacity, uint32_t threshold) {
+    self->words = (volatile uint32_t *)(SOC_RTC_DATA_LOW + offset);
+    // Keep what the ULP collected while the main core was in deep sleep.
+    if (self->words[ESPULP_RINGBUFFER_MAGIC] != RINGBUFFER_MAGIC ||
+        self->words[ESPULP_RINGBUFFER_CAPACITY] != capacity) {
+        self->words[ESPULP_RINGBUFFER_CAPACITY] = capacity;
+        self->words[ESPULP_RINGBUFFER_HEAD] = 0;
+        self->words[ESPULP_RINGBUFFER_TAIL] = 0;
+        self->words[ESPULP_RINGBUFFER_MAGIC] = RINGBUFFER_MAGIC;
+    }
+    self->words[ESPULP_RINGBUFFER_THRESHOLD] = threshold;
+}
+
+bool common_hal_espulp_ringbuffer_deinited(espulp_ringbuffer_obj_t *self) {
+    return self->words == NULL;
+}
+
+void common_hal_espulp_ringbuffer_deinit(espulp_ringbuffer_obj_t *self) {
+    // The memory belongs to the ULP program, so it is left as is.
+    self->words = NULL;
+}
+
+uint32_t common_hal_espulp_ringbuffer_get_capacity(espulp_ringbuffer_obj_t *self) {
+    return self->words[ESPULP_RINGBUFFER_CAPACITY];
+}
+
+uint32_t common_hal_espulp_ringbuffer_get_threshold(espulp_ringbuffer_obj_t *self) {
+    return self->words[ESPULP_RINGBUFFER_THRESHOLD];
+}
+
+void common_hal_espulp_ringbuffer_set_threshold(espulp_ringbuffer_obj_t *self, uint32_t threshold) {
+    self->words[ESPULP_RINGBUFFER_THRESHOLD] = threshold;
+}
+
+uint32_t common_hal_espulp_ringbuffer_get_count(espulp_ringbuffer_obj_t *self) {
+    uint32_t capacity = self->words[ESPULP_RINGBUFFER_CAPACITY];
+    uint32_t head = self->words[ESPULP_RINGBUFFER_HEAD] & INDEX_MASK;
+    uint32_t tail = self->words[ESPULP_RINGBUFFER_TAIL];
+    if (head >= capacity) {
+        // The ULP program wrote a bad index. Treat the buffer as empty.
+        return 0;
+    }
+    return (head + capacity - tail) % capacity;
+}
+
+size_t common_hal_espulp_ringbuffer_readinto(espulp_ringbuffer_obj_t *self, void *data, size_t itemsize, size_t len) {
+    uint32_t capacity = self->words[ESPULP_RINGBUFFER_CAPACITY];
+    uint32_t tail = self->words[ESPULP_RINGBUFFER_TAIL];
+    size_t count = MIN(common_hal_espulp_ringbuffer_get_count(self), len);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t word = self->words[ESPULP_RINGBUFFER_DATA + tail];
+        if (itemsize == 2) {
+            uint16_t half = word;
+            memcpy((uint8_t *)data + i * 2, &half, 2);
+        } else {
+            memcpy((uint8_t *)data + i * 4, &word, 4);
+        }
+        tail = (tail + 1) % capacity;
+    }
+    // Only advance the tail once the words are copied, so the ULP doesn't
+    // overwrite them while they are read.
+    self->words[ESPULP_RINGBUFFER_TAIL] = tail;
+    return count;
+}
+
+void common_hal_espulp_ringbuffer_clear(espulp_ringbuffer_obj_t *self) {
+    self->words[ESPULP_RINGBUFFER_TAIL] = self->words[ESPULP_RINGBUFFER_HEAD] & INDEX_MASK;
+}
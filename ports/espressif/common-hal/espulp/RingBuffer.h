@@ -0,0 +1,26 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// Layout of the ring buffer in ULP memory, in 32 bit words. The main core
+// writes everything but the head, which only the ULP program writes. The FSM
+// ULP stores 16 bit values, so indices are masked to 16 bits when read.
+enum {
+    ESPULP_RINGBUFFER_MAGIC,
+    ESPULP_RINGBUFFER_CAPACITY,
+    ESPULP_RINGBUFFER_THRESHOLD,
+    ESPULP_RINGBUFFER_HEAD,
+    ESPULP_RINGBUFFER_TAIL,
+    ESPULP_RINGBUFFER_DATA,
+};
+
+typedef struct {
+    mp_obj_base_t base;
+    volatile uint32_t *words;
+} espulp_ringbuffer_obj_t;
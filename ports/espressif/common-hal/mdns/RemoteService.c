@@ -43,6 +43,13 @@ mp_int_t common_hal_mdns_remoteservice_get_port(mdns_remoteservice_obj_t *self)
     return self->result->port;
 }
 
+uint32_t mdns_remoteservice_get_ttl(mdns_remoteservice_obj_t *self) {
+    if (self->result == NULL) {
+        return 0;
+    }
+    return self->result->ttl;
+}
+
 uint32_t mdns_remoteservice_get_ipv4_address(mdns_remoteservice_obj_t *self) {
     if (self->result == NULL ||
         self->result->ip_protocol != MDNS_IP_PROTOCOL_V4 ||
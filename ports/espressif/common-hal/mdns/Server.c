@@ -18,6 +18,14 @@
 // could be created.)
 static mdns_server_obj_t *_active_object = NULL;
 
+// The IDF only returns a search's results once it ends, and only deletes
+// searches that have ended. So a browse that is replaced or reset while it runs
+// moves to _abandoned_search until it ends.
+static mdns_search_once_t *_browse_search = NULL;
+static mdns_search_once_t *_abandoned_search = NULL;
+// Results of the last browse, waiting for browse_results().
+static mdns_result_t *_browse_results = NULL;
+
 void mdns_server_construct(mdns_server_obj_t *self, bool workflow) {
     if (_active_object != NULL) {
         if (self == _active_object) {
@@ -72,6 +80,9 @@ void common_hal_mdns_server_deinit(mdns_server_obj_t *self) {
     }
     self->inited = false;
     _active_object = NULL;
+    // mdns_free() deletes any searches still running.
+    _browse_search = NULL;
+    _abandoned_search = NULL;
     mdns_free();
 }
 
@@ -143,17 +154,8 @@ size_t mdns_server_find(mdns_server_obj_t *self, const char *service_type, const
     return num_results;
 }
 
-mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
-    mdns_search_once_t *search = mdns_query_async_new(NULL, service_type, protocol, MDNS_TYPE_PTR, timeout * 1000, 255, NULL);
-    if (search == NULL) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
-    }
-    uint8_t num_results;
-    mdns_result_t *results;
-    while (!mdns_query_async_get_results(search, 1, &results, &num_results)) {
-        RUN_BACKGROUND_TASKS;
-    }
-    mdns_query_async_delete(search);
+// Moves each result into its own RemoteService.
+static mp_obj_t remote_services_tuple(mdns_result_t *results, size_t num_results) {
     mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_results, NULL));
     // The empty tuple object is shared and stored in flash so return early if
     // we got it. Without this we'll crash when trying to set len below.
@@ -187,6 +189,87 @@ mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *servic
     return MP_OBJ_FROM_PTR(tuple);
 }
 
+mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
+    mdns_search_once_t *search = mdns_query_async_new(NULL, service_type, protocol, MDNS_TYPE_PTR, timeout * 1000, 255, NULL);
+    if (search == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+    }
+    uint8_t num_results;
+    mdns_result_t *results;
+    while (!mdns_query_async_get_results(search, 1, &results, &num_results)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    mdns_query_async_delete(search);
+    return remote_services_tuple(results, num_results);
+}
+
+// Waits up to timeout_ms for the search to end. If it has, deletes it, sets
+// results and returns true.
+static bool end_search(mdns_search_once_t *search, uint32_t timeout_ms, mdns_result_t **results) {
+    uint8_t num_results;
+    if (!mdns_query_async_get_results(search, timeout_ms, results, &num_results)) {
+        return false;
+    }
+    mdns_query_async_delete(search);
+    return true;
+}
+
+static void poll_searches(void) {
+    mdns_result_t *results;
+    if (_abandoned_search != NULL && end_search(_abandoned_search, 0, &results)) {
+        _abandoned_search = NULL;
+        mdns_query_results_free(results);
+    }
+    if (_browse_search != NULL && end_search(_browse_search, 0, &results)) {
+        _browse_search = NULL;
+        _browse_results = results;
+    }
+}
+
+void mdns_server_browse_reset(void) {
+    poll_searches();
+    if (_browse_search != NULL) {
+        if (_abandoned_search != NULL) {
+            // Only one search can wait to end, so let the older one finish.
+            mdns_result_t *results;
+            while (!end_search(_abandoned_search, 1, &results)) {
+                RUN_BACKGROUND_TASKS;
+            }
+            mdns_query_results_free(results);
+        }
+        _abandoned_search = _browse_search;
+        _browse_search = NULL;
+    }
+    if (_browse_results != NULL) {
+        mdns_query_results_free(_browse_results);
+        _browse_results = NULL;
+    }
+}
+
+void common_hal_mdns_server_browse(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
+    mdns_server_browse_reset();
+    _browse_search = mdns_query_async_new(NULL, service_type, protocol, MDNS_TYPE_PTR, timeout * 1000, 255, NULL);
+    if (_browse_search == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+    }
+}
+
+mp_obj_t common_hal_mdns_server_get_browse_results(mdns_server_obj_t *self) {
+    poll_searches();
+    mdns_result_t *results = _browse_results;
+    _browse_results = NULL;
+    size_t num_results = 0;
+    for (mdns_result_t *r = results; r != NULL; r = r->next) {
+        num_results++;
+    }
+    return remote_services_tuple(results, num_results);
+}
+
+bool common_hal_mdns_server_get_browsing(mdns_server_obj_t *self) {
+    poll_searches();
+    return _browse_search != NULL;
+}
+
 void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_int_t port, const char *txt_records[], size_t num_txt_records) {
     if (mdns_service_exists(service_type, protocol, NULL)) {
         mdns_service_port_set(service_type, protocol, port);
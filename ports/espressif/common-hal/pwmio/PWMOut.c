@@ -157,6 +157,16 @@ void common_hal_pwmio_pwmout_deinit(pwmio_pwmout_obj_t *self) {
     self->deinited = true;
 }
 
+// The LEDC clock stops in light sleep, so an active channel keeps the chip awake.
+bool pwmout_any_active(void) {
+    for (size_t i = 0; i < LEDC_CHANNEL_MAX; i++) {
+        if (reserved_channels[i] != INDEX_EMPTY) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty) {
     ledc_set_duty(LEDC_LOW_SPEED_MODE, self->chan_handle.channel, duty >> (16 - self->duty_resolution));
     ledc_update_duty(LEDC_LOW_SPEED_MODE, self->chan_handle.channel);
@@ -18,3 +18,5 @@ typedef struct {
     bool variable_frequency : 1;
     bool deinited : 1;
 } pwmio_pwmout_obj_t;
+
+bool pwmout_any_active(void);
@@ -62,6 +62,14 @@ static uint8_t socket_fd_state[CONFIG_LWIP_MAX_SOCKETS];
 #define SOCKET_CONNECT_POLL_INTERVAL_MS 100
 
 static socketpool_socket_obj_t *user_socket[CONFIG_LWIP_MAX_SOCKETS];
+
+// Readiness that select.poll() is waiting for on each user socket. The select
+// task watches for it and wakes the CircuitPython task, then clears it. Polling
+// the socket again arms it again.
+#define USER_WAIT_READ  (1 << 0)
+#define USER_WAIT_WRITE (1 << 1)
+static volatile uint8_t user_socket_wait[CONFIG_LWIP_MAX_SOCKETS];
+
 StaticTask_t socket_select_task_buffer;
 TaskHandle_t socket_select_task_handle;
 static int socket_change_fd = -1;
@@ -69,23 +77,35 @@ static int socket_change_fd = -1;
 static void socket_select_task(void *arg) {
     uint64_t signal;
     fd_set readfds;
+    fd_set writefds;
     fd_set excptfds;
 
     while (true) {
         FD_ZERO(&readfds);
+        FD_ZERO(&writefds);
         FD_ZERO(&excptfds);
         FD_SET(socket_change_fd, &readfds);
         int max_fd = socket_change_fd;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
-            if ((socket_fd_state[i] == FDSTATE_OPEN) && (user_socket[i] == NULL)) {
-                int sockfd = i + LWIP_SOCKET_OFFSET;
-                max_fd = MAX(max_fd, sockfd);
+            if (socket_fd_state[i] != FDSTATE_OPEN) {
+                continue;
+            }
+            int sockfd = i + LWIP_SOCKET_OFFSET;
+            uint8_t wait = user_socket[i] == NULL ? USER_WAIT_READ : user_socket_wait[i];
+            if (wait == 0) {
+                continue;
+            }
+            max_fd = MAX(max_fd, sockfd);
+            if (wait & USER_WAIT_READ) {
                 FD_SET(sockfd, &readfds);
-                FD_SET(sockfd, &excptfds);
             }
+            if (wait & USER_WAIT_WRITE) {
+                FD_SET(sockfd, &writefds);
+            }
+            FD_SET(sockfd, &excptfds);
         }
 
-        int num_triggered = select(max_fd + 1, &readfds, NULL, &excptfds, NULL);
+        int num_triggered = select(max_fd + 1, &readfds, &writefds, &excptfds, NULL);
         // Hard error (or someone closed a socket on another thread)
         if (num_triggered == -1) {
             assert(errno == EBADF);
@@ -97,23 +117,34 @@ static void socket_select_task(void *arg) {
         // Notice event trigger
         if (FD_ISSET(socket_change_fd, &readfds)) {
             read(socket_change_fd, &signal, sizeof(signal));
-            num_triggered--;
         }
 
         // Handle active FDs, close the dead ones
+        bool workflow_ready = false;
+        bool user_ready = false;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             int sockfd = i + LWIP_SOCKET_OFFSET;
-            if (socket_fd_state[i] != FDSTATE_CLOSED) {
-                if (FD_ISSET(sockfd, &readfds) || FD_ISSET(sockfd, &excptfds)) {
-                    if (socket_fd_state[i] == FDSTATE_CLOSING) {
-                        socket_fd_state[i] = FDSTATE_CLOSED;
-                        num_triggered--;
-                    }
-                }
+            if (socket_fd_state[i] == FDSTATE_CLOSED) {
+                continue;
+            }
+            if (!FD_ISSET(sockfd, &readfds) && !FD_ISSET(sockfd, &writefds) && !FD_ISSET(sockfd, &excptfds)) {
+                continue;
+            }
+            if (socket_fd_state[i] == FDSTATE_CLOSING) {
+                socket_fd_state[i] = FDSTATE_CLOSED;
+            } else if (user_socket[i] == NULL) {
+                workflow_ready = true;
+            } else {
+                user_socket_wait[i] = 0;
+                user_ready = true;
             }
         }
 
-        if (num_triggered > 0) {
+        if (user_ready) {
+            // Ends the wait in select.poll() so it checks its sockets again.
+            port_wake_main_task();
+        }
+        if (workflow_ready) {
             // Wake up CircuitPython by queuing request
             supervisor_workflow_request_background();
             ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
@@ -134,6 +165,7 @@ void socket_user_reset(void) {
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             socket_fd_state[i] = FDSTATE_CLOSED;
             user_socket[i] = NULL;
+            user_socket_wait[i] = 0;
         }
         socket_change_fd = eventfd(0, 0);
         // Run this at the same priority as CP so that the web workflow background task can be
@@ -181,10 +213,27 @@ static bool register_open_socket(int fd) {
 
 static void mark_user_socket(int fd, socketpool_socket_obj_t *obj) {
     socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_OPEN;
+    user_socket_wait[fd - LWIP_SOCKET_OFFSET] = 0;
     user_socket[fd - LWIP_SOCKET_OFFSET] = obj;
     // No need to wakeup select task
 }
 
+// Have the select task wake us when the socket is ready, because select.poll()
+// is about to wait for it.
+static void wait_for_user_socket(socketpool_socket_obj_t *self, uint8_t wait) {
+    int fd = self->num;
+    if (fd < LWIP_SOCKET_OFFSET || user_socket[fd - LWIP_SOCKET_OFFSET] == NULL) {
+        return;
+    }
+    size_t i = fd - LWIP_SOCKET_OFFSET;
+    if ((user_socket_wait[i] & wait) == wait) {
+        return;
+    }
+    user_socket_wait[i] |= wait;
+    uint64_t signal = 1;
+    write(socket_change_fd, &signal, sizeof(signal));
+}
+
 static bool _socketpool_socket(socketpool_socketpool_obj_t *self,
     socketpool_socketpool_addressfamily_t family, socketpool_socketpool_sock_t type,
     int proto,
@@ -403,10 +452,17 @@ void socketpool_socket_close(socketpool_socket_obj_t *self) {
             lwip_shutdown(fd, SHUT_RDWR);
             lwip_close(fd);
         } else {
+            bool watched = user_socket_wait[fd - LWIP_SOCKET_OFFSET] != 0;
+            user_socket_wait[fd - LWIP_SOCKET_OFFSET] = 0;
             lwip_shutdown(fd, SHUT_RDWR);
             lwip_close(fd);
             socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_CLOSED;
             user_socket[fd - LWIP_SOCKET_OFFSET] = NULL;
+            if (watched) {
+                // Stop the select task from waiting on the closed socket.
+                uint64_t signal = 1;
+                write(socket_change_fd, &signal, sizeof(signal));
+            }
         }
     }
     self->num = -1;
@@ -641,6 +697,23 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     return bytes_sent;
 }
 
+size_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *self,
+    const char *host, size_t hostlen, uint32_t port, const mp_obj_t *buffers, size_t count) {
+
+    struct sockaddr_storage addr;
+    resolve_host_or_throw(self, host, &addr, port);
+
+    for (size_t i = 0; i < count; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_READ);
+        int bytes_sent = lwip_sendto(self->num, bufinfo.buf, bufinfo.len, 0, (struct sockaddr *)&addr, addr.s2_len);
+        if (bytes_sent < 0) {
+            mp_raise_BrokenPipeError();
+        }
+    }
+    return count;
+}
+
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms) {
     self->timeout_ms = timeout_ms;
 }
@@ -666,6 +739,9 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, &fds, NULL, &fds, &immediate);
 
+    if (num_triggered == 0) {
+        wait_for_user_socket(self, USER_WAIT_READ);
+    }
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -678,6 +754,9 @@ bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, NULL, &fds, &fds, &immediate);
 
+    if (num_triggered == 0) {
+        wait_for_user_socket(self, USER_WAIT_WRITE);
+    }
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -144,20 +144,101 @@ mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self) {
     return config->sta.listen_interval;
 }
 
+// Called from the esp_timer task as well as the CircuitPython task.
+static void apply_power_save(wifi_radio_obj_t *self) {
+    wifi_ps_type_t ps = WIFI_PS_NONE;
+    if (!self->staying_awake) {
+        if (self->power_management == POWER_MANAGEMENT_MIN) {
+            ps = WIFI_PS_MIN_MODEM;
+        } else if (self->power_management == POWER_MANAGEMENT_MAX) {
+            ps = WIFI_PS_MAX_MODEM;
+        }
+    }
+    esp_wifi_set_ps(ps);
+
+    uint64_t now = esp_timer_get_time();
+    if (ps == WIFI_PS_NONE) {
+        if (self->awake_since == 0) {
+            self->awake_since = now;
+        }
+    } else if (self->awake_since != 0) {
+        self->awake_total += now - self->awake_since;
+        self->awake_since = 0;
+    }
+}
+
+static void stay_awake_done(void *arg) {
+    wifi_radio_obj_t *self = arg;
+    self->staying_awake = false;
+    apply_power_save(self);
+}
+
+void wifi_radio_reset_power_management(wifi_radio_obj_t *self) {
+    if (self->stay_awake_timer == NULL) {
+        esp_timer_create_args_t args = {
+            .callback = stay_awake_done,
+            .arg = self,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "CircuitPython Wifi",
+        };
+        esp_timer_create(&args, &self->stay_awake_timer);
+    }
+    esp_timer_stop(self->stay_awake_timer);
+    self->staying_awake = false;
+    // The ESP-IDF default.
+    self->power_management = POWER_MANAGEMENT_MIN;
+    self->awake_since = 0;
+    self->awake_total = 0;
+    self->beacon_timeouts = 0;
+    apply_power_save(self);
+}
+
 void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, const mp_int_t listen_interval) {
     wifi_config_t *config = &self->sta_config;
     config->sta.listen_interval = listen_interval;
     if (listen_interval == 1) {
-        esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+        self->power_management = POWER_MANAGEMENT_MIN;
     } else if (listen_interval > 1) {
-        esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+        self->power_management = POWER_MANAGEMENT_MAX;
     } else {
-        esp_wifi_set_ps(WIFI_PS_NONE);
+        self->power_management = POWER_MANAGEMENT_NONE;
     }
+    apply_power_save(self);
 
     esp_wifi_set_config(ESP_IF_WIFI_STA, config);
 }
 
+wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self) {
+    return self->power_management;
+}
+
+void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management) {
+    self->power_management = power_management;
+    apply_power_save(self);
+}
+
+void common_hal_wifi_radio_stay_awake(wifi_radio_obj_t *self, uint32_t duration_ms) {
+    esp_timer_stop(self->stay_awake_timer);
+    self->staying_awake = duration_ms > 0;
+    apply_power_save(self);
+    if (self->staying_awake) {
+        esp_timer_start_once(self->stay_awake_timer, (uint64_t)duration_ms * 1000);
+    }
+}
+
+uint64_t common_hal_wifi_radio_get_awake_time_ms(wifi_radio_obj_t *self) {
+    uint64_t total = self->awake_total;
+    uint64_t since = self->awake_since;
+    if (since != 0) {
+        total += esp_timer_get_time() - since;
+    }
+    return total / 1000;
+}
+
+uint32_t common_hal_wifi_radio_get_beacon_timeouts(wifi_radio_obj_t *self) {
+    return self->beacon_timeouts;
+}
+
 mp_obj_t common_hal_wifi_radio_get_mac_address_ap(wifi_radio_obj_t *self) {
     uint8_t mac[MAC_ADDRESS_LENGTH];
     esp_wifi_get_mac(ESP_IF_WIFI_AP, mac);
@@ -12,6 +12,9 @@
 
 #include "shared-bindings/wifi/ScannedNetworks.h"
 #include "shared-bindings/wifi/Network.h"
+#include "shared-bindings/wifi/PowerManagement.h"
+
+#include "esp_timer.h"
 
 #include "esp_netif_types.h"
 
@@ -42,6 +45,17 @@ typedef struct {
     uint8_t retries_left;
     uint8_t starting_retries;
     uint8_t last_disconnect_reason;
+    // Power saving as configured, which stay_awake() overrides for a while.
+    wifi_power_management_t power_management;
+    bool staying_awake;
+    esp_timer_handle_t stay_awake_timer;
+    // Time with power saving off, in microseconds. awake_since is 0 when
+    // power saving is on.
+    uint64_t awake_since;
+    uint64_t awake_total;
+    uint32_t beacon_timeouts;
 } wifi_radio_obj_t;
 
+void wifi_radio_reset_power_management(wifi_radio_obj_t *self);
+
 extern void common_hal_wifi_radio_gc_collect(wifi_radio_obj_t *self);
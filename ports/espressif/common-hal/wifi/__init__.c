@@ -84,6 +84,9 @@ static void event_handler(void *arg, esp_event_base_t event_base,
             case WIFI_EVENT_STA_CONNECTED:
                 ESP_LOGW(TAG, "connected");
                 break;
+            case WIFI_EVENT_STA_BEACON_TIMEOUT:
+                radio->beacon_timeouts++;
+                break;
             case WIFI_EVENT_STA_DISCONNECTED: {
                 ESP_LOGW(TAG, "disconnected");
                 wifi_event_sta_disconnected_t *d = (wifi_event_sta_disconnected_t *)event_data;
@@ -216,6 +219,7 @@ void common_hal_wifi_init(bool user_initiated) {
 
     const char *default_lwip_local_hostname = cpy_default_hostname;
     ESP_ERROR_CHECK(esp_netif_set_hostname(self->netif, default_lwip_local_hostname));
+    wifi_radio_reset_power_management(self);
     // set station mode to avoid the default SoftAP
     common_hal_wifi_radio_start_station(self);
     // start wifi
@@ -236,6 +240,10 @@ void wifi_reset(void) {
     common_hal_wifi_monitor_deinit(MP_STATE_VM(wifi_monitor_singleton));
     wifi_radio_obj_t *radio = &common_hal_wifi_radio_obj;
     common_hal_wifi_radio_set_enabled(radio, false);
+    if (radio->stay_awake_timer != NULL) {
+        esp_timer_stop(radio->stay_awake_timer);
+    }
+    radio->staying_awake = false;
     #ifndef CONFIG_IDF_TARGET_ESP32
     ESP_ERROR_CHECK(esp_event_handler_instance_unregister(WIFI_EVENT,
         ESP_EVENT_ANY_ID,
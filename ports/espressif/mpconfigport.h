@@ -19,6 +19,16 @@
 
 #define CIRCUITPY_USB_DEVICE_INSTANCE 1
 
+// Whole rows of a 320 pixel wide, 16 bit display per bus write.
+#define CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE (4 * 320 * 2)
+
+// The socket select task wakes select.poll() when a user socket it waits on
+// becomes ready, so only other objects, like UARTs, still need polling.
+#define CIRCUITPY_EVENT_WAIT_MAX_MS (10)
+
+// time.sleep() calls this long or longer light sleep when nothing needs the clocks.
+#define CIRCUITPY_AUTO_LIGHT_SLEEP_MS (100)
+
 #include "py/circuitpy_mpconfig.h"
 
 #define MICROPY_NLR_SETJMP                  (1)
@@ -35,6 +45,9 @@
 
 #define CIRCUITPY_INTERNAL_NVM_START_ADDR (0x9000)
 
+// ESP-IDF's mbedtls hashes with the SHA peripheral (CONFIG_MBEDTLS_HARDWARE_SHA).
+#define CIRCUITPY_HASHLIB_ALT_BACKEND "esp_sha"
+
 // 20kB is statically allocated to nvs, but when overwriting an existing
 // item, it's temporarily necessary to store both the old and new copies.
 // Additionally, there is some overhad for the names and values of items
@@ -26,6 +26,8 @@ INTERNAL_LIBM = 0
 
 # Longints can be implemented as mpz, as longlong, or not
 LONGINT_IMPL = MPZ
+# Both the Xtensa and RISC-V cores give the high word of a 32 x 32 bit multiply.
+MPZ_DIG_SIZE ?= 32
 
 # Default to no-psram
 CIRCUITPY_ESP_PSRAM_SIZE ?= 0
@@ -46,6 +48,12 @@ CIRCUITPY_WIFI_RADIO_SETTABLE_LISTEN_INTERVAL = 1
 # Never use our copy of MBEDTLS
 CIRCUITPY_HASHLIB_MBEDTLS_ONLY = 0
 
+# Every chip has a CPU cycle counter.
+CIRCUITPY_PERF_COUNTERS ?= 1
+
+# mbedtls uses the AES peripheral.
+CIRCUITPY_AESIO_HW ?= $(CIRCUITPY_AESIO)
+
 # These modules are implemented in ports/<port>/common-hal:
 CIRCUITPY_ALARM ?= 1
 CIRCUITPY_ALARM_TOUCH ?= 0
@@ -62,6 +70,7 @@ CIRCUITPY_ESPIDF ?= 1
 CIRCUITPY_ESPULP ?= 1
 CIRCUITPY_FRAMEBUFFERIO ?= 1
 CIRCUITPY_FREQUENCYIO ?= 1
+CIRCUITPY_GNSSIO ?= 1
 CIRCUITPY_HASHLIB ?= 1
 CIRCUITPY_I2CTARGET ?= 0
 CIRCUITPY_MAX3421E ?= 1
@@ -72,6 +81,7 @@ CIRCUITPY_PS2IO ?= 1
 CIRCUITPY_RGBMATRIX ?= 1
 CIRCUITPY_ROTARYIO ?= 1
 CIRCUITPY_SDIOIO ?= 1
+CIRCUITPY_STORAGE_PARTITION ?= 1
 CIRCUITPY_SYNTHIO_MAX_CHANNELS ?= 12
 CIRCUITPY_TOUCHIO_USE_NATIVE ?= 1
 CIRCUITPY_WATCHDOG ?= 1
@@ -220,6 +230,9 @@ CIRCUITPY_TOUCHIO_USE_NATIVE = 0
 # UF2 missing.
 UF2_BOOTLOADER = 0
 USB_HIGHSPEED = 1
+# Room for several 512 byte high speed packets per CDC FIFO.
+USB_CDC_RX_BUFSIZE ?= 2048
+USB_CDC_TX_BUFSIZE ?= 2048
 CIRCUITPY_USB_HID = 0
 CIRCUITPY_USB_MIDI = 0
 CIRCUITPY_TUSB_MEM_ALIGN = 64
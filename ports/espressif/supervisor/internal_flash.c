@@ -33,8 +33,11 @@
 
 // TODO: Split the caching out of supervisor/shared/external_flash so we can use it.
 #define SECTOR_SIZE 4096
+#define NO_CACHE 0xffffffff
 static uint8_t _cache[SECTOR_SIZE];
-static uint32_t _cache_lba = 0xffffffff;
+static uint32_t _cache_lba = NO_CACHE;
+// The cached sector has been written to but not erased and programmed yet.
+static bool _cache_dirty = false;
 
 #if CIRCUITPY_STORAGE_EXTEND
 #if FF_MAX_SS == FF_MIN_SS
@@ -77,9 +80,6 @@ uint32_t supervisor_flash_get_block_count(void) {
     #endif
 }
 
-void port_internal_flash_flush(void) {
-}
-
 static void single_partition_rw(const esp_partition_t *partition, uint8_t *data,
     const uint32_t offset, const uint32_t size_total, const bool op) {
     if (op == OP_READ) {
@@ -116,6 +116,18 @@ static void multi_partition_rw(uint8_t *data,
 }
 #endif
 
+void port_internal_flash_flush(void) {
+    if (!_cache_dirty) {
+        return;
+    }
+    #if CIRCUITPY_STORAGE_EXTEND
+    multi_partition_rw(_cache, _cache_lba, SECTOR_SIZE, OP_WRITE);
+    #else
+    single_partition_rw(_partition[0], _cache, _cache_lba, SECTOR_SIZE, OP_WRITE);
+    #endif
+    _cache_dirty = false;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     const uint32_t offset = block * FILESYSTEM_BLOCK_SIZE;
     const uint32_t read_total = num_blocks * FILESYSTEM_BLOCK_SIZE;
@@ -124,6 +136,13 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     #else
     single_partition_rw(_partition[0], dest, offset, read_total, OP_READ);
     #endif
+    // The flash may be behind the cached sector, so use the cache where the
+    // two overlap.
+    if (_cache_dirty && _cache_lba < offset + read_total && offset < _cache_lba + SECTOR_SIZE) {
+        uint32_t start = MAX(offset, _cache_lba);
+        uint32_t end = MIN(offset + read_total, _cache_lba + SECTOR_SIZE);
+        memcpy(dest + (start - offset), _cache + (start - _cache_lba), end - start);
+    }
     return 0; // success
 }
 
@@ -135,6 +154,8 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32
         uint32_t sector_offset = block_address / blocks_per_sector * SECTOR_SIZE;
         uint8_t block_offset = block_address % blocks_per_sector;
         if (_cache_lba != sector_offset) {
+            port_internal_flash_flush();
+            _cache_lba = NO_CACHE;
             supervisor_flash_read_blocks(_cache, sector_offset / FILESYSTEM_BLOCK_SIZE, blocks_per_sector);
             _cache_lba = sector_offset;
         }
@@ -148,11 +169,10 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32
                 FILESYSTEM_BLOCK_SIZE);
             block++;
         }
-        #if CIRCUITPY_STORAGE_EXTEND
-        multi_partition_rw(_cache, sector_offset, SECTOR_SIZE, OP_WRITE);
-        #else
-        single_partition_rw(_partition[0], _cache, sector_offset, SECTOR_SIZE, OP_WRITE);
-        #endif
+        // Erasing and programming is deferred until another sector is
+        // written or the filesystem is flushed, so that sequential writes
+        // into the same sector cost a single erase.
+        _cache_dirty = true;
     }
     return 0; // success
 }
@@ -179,3 +199,53 @@ void supervisor_flash_update_extended(void) {
     storage_extended = (_partition[0]->size < fatfs_bytes());
     #endif
 }
+
+#if CIRCUITPY_STORAGE_PARTITION
+// The partition is a data partition labelled "user" in the board's partition
+// table. It is mapped into the data address space the first time it is read.
+static const esp_partition_t *_user_partition;
+static const uint8_t *_user_partition_mapped;
+
+static const esp_partition_t *user_partition(void) {
+    if (_user_partition == NULL) {
+        _user_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+            ESP_PARTITION_SUBTYPE_ANY, "user");
+    }
+    return _user_partition;
+}
+
+uint32_t supervisor_flash_partition_get_size(void) {
+    const esp_partition_t *partition = user_partition();
+    return partition == NULL ? 0 : partition->size;
+}
+
+const uint8_t *supervisor_flash_partition_get_mapped(void) {
+    const esp_partition_t *partition = user_partition();
+    if (_user_partition_mapped == NULL && partition != NULL) {
+        // The mapping is kept for as long as CircuitPython runs so that
+        // memoryviews of it stay valid.
+        const void *ptr;
+        esp_partition_mmap_handle_t handle;
+        if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &ptr, &handle) == ESP_OK) {
+            _user_partition_mapped = ptr;
+        }
+    }
+    return _user_partition_mapped;
+}
+
+bool supervisor_flash_partition_read(uint32_t address, uint8_t *dest, uint32_t len) {
+    const esp_partition_t *partition = user_partition();
+    return partition != NULL && esp_partition_read(partition, address, dest, len) == ESP_OK;
+}
+
+bool supervisor_flash_partition_prog(uint32_t address, const uint8_t *src, uint32_t len) {
+    const esp_partition_t *partition = user_partition();
+    return partition != NULL && esp_partition_write(partition, address, src, len) == ESP_OK;
+}
+
+bool supervisor_flash_partition_erase(uint32_t address) {
+    const esp_partition_t *partition = user_partition();
+    return partition != NULL &&
+           esp_partition_erase_range(partition, address, SUPERVISOR_FLASH_PARTITION_ERASE_SIZE) == ESP_OK;
+}
+#endif
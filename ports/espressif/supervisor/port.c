@@ -51,6 +51,19 @@
 #include "shared-bindings/_bleio/__init__.h"
 #endif
 
+#if CIRCUITPY_AUDIOBUSIO_I2SOUT
+#include "common-hal/audiobusio/__init__.h"
+#endif
+
+#if CIRCUITPY_PWMIO
+#include "common-hal/pwmio/PWMOut.h"
+#endif
+
+#if CIRCUITPY_WIFI
+#include "shared-bindings/wifi/__init__.h"
+#include "shared-bindings/wifi/Radio.h"
+#endif
+
 #if CIRCUITPY_ESPCAMERA
 #include "esp_camera.h"
 #endif
@@ -76,10 +89,14 @@
 
 #include "bootloader_flash_config.h"
 
+#include "driver/uart.h"
+#include "esp_cpu.h"
 #include "esp_debug_helpers.h"
 #include "esp_efuse.h"
 #include "esp_ipc.h"
+#include "esp_memory_utils.h"
 #include "esp_rom_efuse.h"
+#include "esp_sleep.h"
 #include "esp_timer.h"
 
 #ifdef CONFIG_IDF_TARGET_ESP32
@@ -96,6 +113,7 @@
 
 static esp_timer_handle_t _tick_timer;
 static esp_timer_handle_t _sleep_timer;
+static esp_timer_handle_t _deadline_timer;
 
 TaskHandle_t circuitpython_task = NULL;
 
@@ -228,6 +246,12 @@ safe_mode_t port_init(void) {
     args.name = "CircuitPython Sleep";
     esp_timer_create(&args, &_sleep_timer);
 
+    args.callback = &tick_timer_cb;
+    args.arg = NULL;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "CircuitPython Deadline";
+    esp_timer_create(&args, &_deadline_timer);
+
     circuitpython_task = xTaskGetCurrentTaskHandle();
 
     #if !defined(DEBUG)
@@ -299,6 +323,19 @@ void port_heap_init(void) {
     // The IDF sets up the heap, so we don't need to.
 }
 
+#ifdef CONFIG_SPIRAM
+// Internal RAM left for the IDF and drivers, such as WiFi, that can't use
+// SPIRAM.
+#define INTERNAL_RAM_RESERVE (48 * 1024)
+
+static void *internal_malloc(size_t size, size_t caps) {
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) < size + INTERNAL_RAM_RESERVE) {
+        return NULL;
+    }
+    return heap_caps_malloc(size, caps | MALLOC_CAP_INTERNAL);
+}
+#endif
+
 void *port_malloc(size_t size, bool dma_capable) {
     size_t caps = MALLOC_CAP_8BIT;
     if (dma_capable) {
@@ -306,9 +343,15 @@ void *port_malloc(size_t size, bool dma_capable) {
     }
 
     void *ptr = NULL;
-    // Try SPIRAM first when available.
+    // Small allocations try internal RAM first and large ones SPIRAM first,
+    // when available.
     #ifdef CONFIG_SPIRAM
-    ptr = heap_caps_malloc(size, caps | MALLOC_CAP_SPIRAM);
+    if (size < CIRCUITPY_SLOW_RAM_THRESHOLD) {
+        ptr = internal_malloc(size, caps);
+    }
+    if (ptr == NULL) {
+        ptr = heap_caps_malloc(size, caps | MALLOC_CAP_SPIRAM);
+    }
     #endif
     if (ptr == NULL) {
         ptr = heap_caps_malloc(size, caps);
@@ -316,6 +359,21 @@ void *port_malloc(size_t size, bool dma_capable) {
     return ptr;
 }
 
+void *port_malloc_fast(size_t size) {
+    void *ptr = NULL;
+    #ifdef CONFIG_SPIRAM
+    ptr = internal_malloc(size, MALLOC_CAP_8BIT);
+    #endif
+    if (ptr == NULL) {
+        ptr = port_malloc(size, false);
+    }
+    return ptr;
+}
+
+bool port_heap_is_slow(const void *ptr) {
+    return esp_ptr_external_ram(ptr);
+}
+
 void port_free(void *ptr) {
     heap_caps_free(ptr);
 }
@@ -443,6 +501,10 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return all_subticks / 32;
 }
 
+uint64_t port_get_raw_us(void) {
+    return esp_timer_get_time();
+}
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void) {
     esp_timer_start_periodic(_tick_timer, 1000000 / 1024);
@@ -453,6 +515,15 @@ void port_disable_tick(void) {
     esp_timer_stop(_tick_timer);
 }
 
+bool port_tick_after_ticks(uint32_t ticks) {
+    // Stopping a timer that isn't running is harmless.
+    esp_timer_stop(_deadline_timer);
+    if (ticks > 0) {
+        esp_timer_start_once(_deadline_timer, (uint64_t)ticks * 1000000 / 1024);
+    }
+    return true;
+}
+
 void port_wake_main_task() {
     xTaskNotifyGive(circuitpython_task);
 }
@@ -489,11 +560,51 @@ void port_idle_until_interrupt(void) {
     }
 }
 
+bool port_light_sleep_for_ticks(uint32_t ticks) {
+    // Light sleep keeps RAM and GPIO state but stops the radio, the LEDC and
+    // I2S clocks and the UART receivers, so anything using them stays awake.
+    #if CIRCUITPY_WIFI
+    if (common_hal_wifi_radio_get_enabled(&common_hal_wifi_radio_obj)) {
+        return false;
+    }
+    #endif
+    #if CIRCUITPY_BLEIO
+    if (common_hal_bleio_adapter_get_enabled(&common_hal_bleio_adapter_obj)) {
+        return false;
+    }
+    #endif
+    #if CIRCUITPY_PWMIO
+    if (pwmout_any_active()) {
+        return false;
+    }
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO_I2SOUT
+    if (port_i2s_any_allocated()) {
+        return false;
+    }
+    #endif
+    for (uart_port_t num = 0; num < UART_NUM_MAX; num++) {
+        if (uart_is_driver_installed(num)) {
+            return false;
+        }
+    }
+    esp_sleep_enable_timer_wakeup((uint64_t)ticks * 1000000 / 1024);
+    esp_light_sleep_start();
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    return true;
+}
+
 void port_post_boot_py(bool heap_valid) {
     if (!heap_valid && filesystem_present()) {
     }
 }
 
+// CCOUNT on Xtensa, mcycle on RISC-V. Counts at the CPU clock, which power
+// management may change.
+uint32_t port_get_cpu_cycles(void) {
+    return esp_cpu_get_cycle_count();
+}
+
 
 // Wrap main in app_main that the IDF expects.
 extern void main(void);
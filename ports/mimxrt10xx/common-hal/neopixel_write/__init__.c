@@ -45,8 +45,6 @@ void PLACE_IN_ITCM(common_hal_neopixel_write)(const digitalio_digitalinout_obj_t
 
     __disable_irq();
     // Use DWT in debug core. Usable when interrupts disabled, as opposed to Systick->VAL
-    DWT->CYCCNT = 0;
-
     for (;;) {
         cyc = (pix & mask) ? t1 : t0;
         start = DWT->CYCCNT;
@@ -25,10 +25,13 @@ CIRCUITPY_FREQUENCYIO = 0
 CIRCUITPY_I2CTARGET = 0
 CIRCUITPY_NVM = 0
 CIRCUITPY_PARALLELDISPLAYBUS = 0
+CIRCUITPY_PERF_COUNTERS ?= 1
 CIRCUITPY_PULSEIO = 0
 CIRCUITPY_ROTARYIO = 1
 CIRCUITPY_ROTARYIO_SOFTENCODER = 1
 CIRCUITPY_USB_MIDI = 1
 LONGINT_IMPL = MPZ
+# The Cortex-M7 multiplies 32 x 32 -> 64 bits in one instruction.
+MPZ_DIG_SIZE ?= 32
 
 CIRCUITPY_BUILD_EXTENSIONS ?= hex,uf2
@@ -331,7 +331,8 @@ safe_mode_t port_init(void) {
 
     clocks_init();
 
-    // Turn on the DWT so that neopixel_write can use CYCCNT for timing.
+    // Turn on the DWT so that neopixel_write and the perf counters can use
+    // CYCCNT.
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
     DWT->CTRL = 0x2 << DWT_CTRL_SYNCTAP_Pos | DWT_CTRL_CYCCNTENA_Msk;
 
@@ -490,6 +491,12 @@ uint32_t port_get_saved_word(void) {
     return SNVS->LPGPR[1];
 }
 
+#if CIRCUITPY_PERF_COUNTERS
+uint32_t port_get_cpu_cycles(void) {
+    return DWT->CYCCNT;
+}
+#endif
+
 uint64_t port_get_raw_ticks(uint8_t *subticks) {
     uint64_t ticks = 0;
     uint64_t next_ticks = 1;
@@ -0,0 +1,101 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// aesio's AES engine on nRF52, the ECB peripheral. It only encrypts single
+// blocks with 128 bit keys, which covers ECB and CBC encryption and CTR mode.
+// Everything else is done in software.
+
+#include <string.h>
+
+#include "shared-module/aesio/__init__.h"
+
+#include "nrf.h"
+
+#ifdef BLUETOOTH_SD
+#include "nrf_sdm.h"
+#include "nrf_soc.h"
+#endif
+
+#if CIRCUITPY_AESIO_HW
+
+// Laid out as the peripheral reads and writes it, with EasyDMA.
+typedef struct {
+    uint8_t key[AES_KEYLEN128];
+    uint8_t cleartext[AES_BLOCKLEN];
+    uint8_t ciphertext[AES_BLOCKLEN];
+} ecb_data_t;
+
+static void ecb_encrypt(ecb_data_t *data) {
+    #ifdef BLUETOOTH_SD
+    // The SoftDevice owns the peripheral while it is enabled.
+    uint8_t sd_en = 0;
+    (void)sd_softdevice_is_enabled(&sd_en);
+    if (sd_en) {
+        (void)sd_ecb_block_encrypt((nrf_ecb_hal_data_t *)data);
+        return;
+    }
+    #endif
+    NRF_ECB->ECBDATAPTR = (uint32_t)data;
+    while (true) {
+        NRF_ECB->EVENTS_ENDECB = 0;
+        NRF_ECB->EVENTS_ERRORECB = 0;
+        NRF_ECB->TASKS_STARTECB = 1;
+        while (NRF_ECB->EVENTS_ENDECB == 0 && NRF_ECB->EVENTS_ERRORECB == 0) {
+        }
+        // An error means the radio's CCM or AAR took the engine; try again.
+        if (NRF_ECB->EVENTS_ENDECB != 0) {
+            NRF_ECB->EVENTS_ENDECB = 0;
+            return;
+        }
+    }
+}
+
+static void increment_counter(uint8_t counter[AES_BLOCKLEN]) {
+    for (int i = AES_BLOCKLEN - 1; i >= 0; i--) {
+        if (++counter[i] != 0) {
+            break;
+        }
+    }
+}
+
+bool aesio_hw_crypt(const uint8_t *key, size_t key_length, enum AES_MODE mode, bool encrypt,
+    uint8_t iv[AES_BLOCKLEN], const uint8_t *src, uint8_t *dest, size_t len) {
+    if (key_length != AES_KEYLEN128 || (!encrypt && mode != AES_MODE_CTR)) {
+        return false;
+    }
+    ecb_data_t data;
+    memcpy(data.key, key, AES_KEYLEN128);
+    for (size_t i = 0; i < len; i += AES_BLOCKLEN) {
+        switch (mode) {
+            case AES_MODE_ECB:
+                memcpy(data.cleartext, src + i, AES_BLOCKLEN);
+                ecb_encrypt(&data);
+                memcpy(dest + i, data.ciphertext, AES_BLOCKLEN);
+                break;
+            case AES_MODE_CBC:
+                for (size_t j = 0; j < AES_BLOCKLEN; j++) {
+                    data.cleartext[j] = src[i + j] ^ iv[j];
+                }
+                ecb_encrypt(&data);
+                memcpy(iv, data.ciphertext, AES_BLOCKLEN);
+                memcpy(dest + i, data.ciphertext, AES_BLOCKLEN);
+                break;
+            default:
+                memcpy(data.cleartext, iv, AES_BLOCKLEN);
+                ecb_encrypt(&data);
+                increment_counter(iv);
+                for (size_t j = 0; j < AES_BLOCKLEN; j++) {
+                    dest[i + j] = src[i + j] ^ data.ciphertext[j];
+                }
+                break;
+        }
+    }
+    // Don't leave the key on the stack.
+    memset(&data, 0, sizeof(data));
+    return true;
+}
+
+#endif
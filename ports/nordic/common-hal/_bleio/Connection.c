@@ -87,6 +87,10 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
         }
 
         case BLE_GAP_EVT_PHY_UPDATE: { // 0x22
+            ble_gap_evt_phy_update_t *phy_update = &ble_evt->evt.gap_evt.params.phy_update;
+            if (phy_update->status == BLE_HCI_STATUS_CODE_SUCCESS) {
+                self->phy = phy_update->tx_phy;
+            }
             break;
         }
 
@@ -382,6 +386,33 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     check_nrf_error(status);
 }
 
+mp_int_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self) {
+    return self->phy == BLE_GAP_PHY_2MBPS ? 2 : 1;
+}
+
+void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, mp_int_t phy) {
+    uint8_t phys = phy == 2 ? BLE_GAP_PHY_2MBPS : BLE_GAP_PHY_1MBPS;
+    ble_gap_phys_t const phys_request = {
+        .rx_phys = phys,
+        .tx_phys = phys,
+    };
+    check_nrf_error(sd_ble_gap_phy_update(self->conn_handle, &phys_request));
+}
+
+void common_hal_bleio_connection_request_larger_packets(bleio_connection_internal_t *self) {
+    // Only one MTU exchange is allowed per connection, and the central may have done it already.
+    if (self->mtu == 0) {
+        // Must match the value passed in the BLE_GATTS_EVT_EXCHANGE_MTU_REQUEST handler.
+        check_nrf_error(sd_ble_gattc_exchange_mtu_request(self->conn_handle, BLE_GATTS_VAR_ATTR_LEN_MAX));
+    }
+    uint32_t status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = sd_ble_gap_data_length_update(self->conn_handle, NULL, NULL);
+        RUN_BACKGROUND_TASKS;
+    }
+    check_nrf_error(status);
+}
+
 // service_uuid may be NULL, to discover all services.
 static bool discover_next_services(bleio_connection_internal_t *connection, uint16_t start_handle, ble_uuid_t *service_uuid) {
     m_discovery_successful = false;
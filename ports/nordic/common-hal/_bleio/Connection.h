@@ -46,6 +46,8 @@ typedef struct {
     ble_gap_conn_params_t conn_params;
     volatile bool conn_params_updating;
     uint16_t mtu;
+    // Current transmit PHY, BLE_GAP_PHY_1MBPS or BLE_GAP_PHY_2MBPS.
+    uint8_t phy;
     // Request that CCCD values for this connection be saved, using sys_attr values.
     volatile bool do_bond_cccds;
     // Request that security key info for this connection be saved.
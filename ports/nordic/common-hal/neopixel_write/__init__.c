@@ -82,14 +82,46 @@ static NRF_PWM_Type *find_free_pwm(void) {
 }
 
 static size_t pixels_pattern_heap_size = 0;
+uint64_t next_start_raw_ticks = 0;
+
+// A PWM still sending the heap pattern. Writes from the heap return as soon as
+// the sequence starts so that a long strip doesn't hold up the caller.
+static NRF_PWM_Type *active_pwm = NULL;
+
+static void finish_write(NRF_PWM_Type *pwm) {
+    while (!nrf_pwm_event_check(pwm, NRF_PWM_EVENT_SEQEND0)) {
+        RUN_BACKGROUND_TASKS;
+    }
+
+    // Before leave we clear the flag for the event.
+    nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
+
+    // We need to disable the device and disconnect
+    // all the outputs before leave or the device will not
+    // be selected on the next call.
+    // TODO: Check if disabling the device causes performance issues.
+    nrf_pwm_disable(pwm);
+    nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL});
+
+    // Update the next start.
+    next_start_raw_ticks = port_get_raw_ticks(NULL) + 4;
+}
+
+static void finish_active_write(void) {
+    if (active_pwm != NULL) {
+        NRF_PWM_Type *pwm = active_pwm;
+        active_pwm = NULL;
+        finish_write(pwm);
+    }
+}
+
 // Called during reset_port() to free the pattern buffer
 void neopixel_write_reset(void) {
+    finish_active_write();
     MP_STATE_VM(pixels_pattern_heap) = NULL;
     pixels_pattern_heap_size = 0;
 }
 
-uint64_t next_start_raw_ticks = 0;
-
 void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t numBytes) {
     // To support both the SoftDevice + Neopixels we use the EasyDMA
     // feature from the NRF52. However this technique implies to
@@ -117,6 +149,9 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
     // PATTERN_SIZE is a multiple of 4, so we don't need round up to make sure one_pixel is large enough.
     uint32_t stack_pixels[PATTERN_SIZE(3 * STACK_PIXELS) / sizeof(uint32_t)];
 
+    // The previous write may still be using the heap pattern and its PWM.
+    finish_active_write();
+
     NRF_PWM_Type *pwm = find_free_pwm();
 
     // only malloc if there is PWM device available
@@ -204,12 +239,10 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         nrf_pwm_seq_refresh_set(pwm, 0, 0);
         nrf_pwm_seq_end_delay_set(pwm, 0, 0);
 
-        // The Neopixel implementation is a blocking algorithm. DMA
-        // allows for non-blocking operation. To "simulate" a blocking
-        // operation we enable the interruption for the end of sequence
-        // and block the execution thread until the event flag is set by
-        // the peripheral.
-        //    pwm->INTEN |= (PWM_INTEN_SEQEND0_Enabled<<PWM_INTEN_SEQEND0_Pos);
+        // DMA allows for non-blocking operation. A pattern on the heap
+        // outlives this call and pixels has already been copied into it, so
+        // leave the sequence running and finish it before the next write. A
+        // pattern on the stack must be sent before returning.
 
         // PSEL must be configured before enabling PWM
         nrf_pwm_pins_set(pwm, (uint32_t[]) {digitalinout->pin->number, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL});
@@ -222,21 +255,12 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
         nrf_pwm_task_trigger(pwm, NRF_PWM_TASK_SEQSTART0);
 
-        // But we have to wait for the flag to be set.
-        while (!nrf_pwm_event_check(pwm, NRF_PWM_EVENT_SEQEND0)) {
-            RUN_BACKGROUND_TASKS;
+        if (pixels_pattern == MP_STATE_VM(pixels_pattern_heap)) {
+            active_pwm = pwm;
+        } else {
+            finish_write(pwm);
         }
-
-        // Before leave we clear the flag for the event.
-        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
-
-        // We need to disable the device and disconnect
-        // all the outputs before leave or the device will not
-        // be selected on the next call.
-        // TODO: Check if disabling the device causes performance issues.
-        nrf_pwm_disable(pwm);
-        nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL});
-
+        return;
     } // End of DMA implementation
     // ---------------------------------------------------------------------
     else {
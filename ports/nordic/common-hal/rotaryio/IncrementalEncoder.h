@@ -18,6 +18,13 @@ typedef struct {
     int8_t sub_count; // count intermediate transitions between detents
     int8_t divisor; // Number of quadrature edges required per count
     mp_int_t position;
+    // Velocity estimate, see shared-module/rotaryio/IncrementalEncoder.c
+    uint64_t window_start_ns;
+    uint64_t last_edge_ns;
+    uint32_t velocity_window_ns;
+    uint32_t velocity_duration_ns;
+    int32_t window_edges;
+    int32_t velocity_edges;
 } rotaryio_incrementalencoder_obj_t;
 
 
@@ -11,6 +11,8 @@ USB_NUM_ENDPOINT_PAIRS = 8
 
 # All nRF ports have longints.
 LONGINT_IMPL = MPZ
+# The Cortex-M4 multiplies 32 x 32 -> 64 bits in one instruction.
+MPZ_DIG_SIZE ?= 32
 
 # The ?='s allow overriding in mpconfigboard.mk.
 
@@ -48,6 +50,9 @@ CIRCUITPY_SERIAL_BLE ?= 1
 
 CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE ?= 1
 
+# DWT cycle counter
+CIRCUITPY_PERF_COUNTERS ?= 1
+
 
 # nRF52840-specific
 
@@ -58,6 +63,7 @@ MCU_SUB_VARIANT = nrf52840
 
 # Fits on nrf52840 but space is tight on nrf52833.
 CIRCUITPY_AESIO ?= 1
+CIRCUITPY_AESIO_HW ?= $(CIRCUITPY_AESIO)
 CIRCUITPY_MEMORYMAP ?= 1
 
 CIRCUITPY_RGBMATRIX ?= 1
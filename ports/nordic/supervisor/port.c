@@ -90,6 +90,10 @@ static void rtc_handler(nrfx_rtc_int_type_t int_type) {
         sleepmem_wakeup_event = SLEEPMEM_WAKEUP_BY_TIMER;
         #endif
         nrfx_rtc_cc_set(&rtc_instance, 1, 0, false);
+    } else if (int_type == NRFX_RTC_INT_COMPARE2) {
+        // A single tick for the supervisor's next deadline.
+        nrfx_rtc_cc_disable(&rtc_instance, 2);
+        supervisor_tick();
     }
 }
 
@@ -148,6 +152,11 @@ safe_mode_t port_init(void) {
 
     nrf_peripherals_enable_cache();
 
+    #if CIRCUITPY_PERF_COUNTERS
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
     // Configure millisecond timer initialization.
     tick_init();
 
@@ -273,6 +282,12 @@ uint32_t port_get_saved_word(void) {
     return *SAVED_WORD;
 }
 
+#if CIRCUITPY_PERF_COUNTERS
+uint32_t port_get_cpu_cycles(void) {
+    return DWT->CYCCNT;
+}
+#endif
+
 uint64_t port_get_raw_ticks(uint8_t *subticks) {
     common_hal_mcu_disable_interrupts();
     uint32_t rtc = nrfx_rtc_counter_get(&rtc_instance);
@@ -295,6 +310,17 @@ void port_disable_tick(void) {
     nrfx_rtc_tick_disable(&rtc_instance);
 }
 
+bool port_tick_after_ticks(uint32_t ticks) {
+    if (ticks == 0) {
+        nrfx_rtc_cc_disable(&rtc_instance, 2);
+        return true;
+    }
+    uint32_t current_ticks = nrfx_rtc_counter_get(&rtc_instance);
+    uint32_t diff = MIN(ticks, 0xffffff / 32) * 32;
+    nrfx_rtc_cc_set(&rtc_instance, 2, current_ticks + diff, true);
+    return true;
+}
+
 void port_interrupt_after_ticks_ch(uint32_t channel, uint32_t ticks) {
     uint32_t current_ticks = nrfx_rtc_counter_get(&rtc_instance);
     uint32_t diff = 3;
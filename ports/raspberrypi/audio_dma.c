@@ -9,8 +9,10 @@
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-module/audiocore/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "supervisor/background_callback.h"
+#include "supervisor/shared/trace.h"
 
 #include "py/mpstate.h"
 #include "py/runtime.h"
@@ -33,19 +35,17 @@ void audio_dma_reset(void) {
 
 
 static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32_t input_length, uint8_t *output, uint32_t output_length) {
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wcast-align"
-
     uint32_t output_length_used = input_length / dma->sample_spacing;
 
     if (output_length_used > output_length) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Internal audio buffer too small"));
     }
 
-    uint32_t out_i = 0;
+    bool flip_sign = dma->signed_to_unsigned || dma->unsigned_to_signed;
+    uint32_t out_samples;
     if (dma->sample_resolution <= 8 && dma->output_resolution > 8) {
         // reading bytes, writing 16-bit words, so output buffer will be bigger.
-
+        out_samples = output_length_used;
         output_length_used *= 2;
         if (output_length_used > output_length) {
             mp_raise_RuntimeError(MP_ERROR_TEXT("Internal audio buffer too small"));
@@ -59,60 +59,23 @@ static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
         uint16_t mul = ((1 << dma->output_resolution) - 1) / ((1 << dma->sample_resolution) - 1);
         uint16_t offset = (1 << dma->output_resolution) / 2;
 
-        for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint16_t *)output)[out_i] = (uint16_t)((((int8_t *)input)[i] + 0x80) * mul);
-            } else if (dma->unsigned_to_signed) {
-                ((int16_t *)output)[out_i] = (int16_t)(((uint8_t *)input)[i] * mul - offset);
-            } else {
-                ((uint16_t *)output)[out_i] = (uint16_t)(((uint8_t *)input)[i] * mul);
-            }
-            out_i += 1;
-        }
+        audiosample_convert_8_16((uint16_t *)(void *)output, input, out_samples, dma->sample_spacing,
+            dma->signed_to_unsigned ? 0x80 : 0, mul, dma->unsigned_to_signed ? -offset : 0);
     } else if (dma->sample_resolution <= 8 && dma->output_resolution <= 8) {
-        for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint8_t *)output)[out_i] = ((int8_t *)input)[i] + 0x80;
-            } else if (dma->unsigned_to_signed) {
-                ((int8_t *)output)[out_i] = ((uint8_t *)input)[i] - 0x80;
-            } else {
-                ((uint8_t *)output)[out_i] = ((uint8_t *)input)[i];
-            }
-            out_i += 1;
-        }
+        out_samples = output_length_used;
+        audiosample_convert_8_8(output, input, out_samples, dma->sample_spacing, flip_sign ? 0x80 : 0);
     } else if (dma->sample_resolution > 8 && dma->output_resolution > 8) {
-        size_t shift = 16 - dma->output_resolution;
-        for (uint32_t i = 0; i < input_length / 2; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint16_t *)output)[out_i] = ((int16_t *)input)[i] + 0x8000;
-            } else if (dma->unsigned_to_signed) {
-                ((int16_t *)output)[out_i] = ((uint16_t *)input)[i] - 0x8000;
-            } else {
-                ((uint16_t *)output)[out_i] = ((uint16_t *)input)[i];
-            }
-            if (dma->output_resolution < 16) {
-                if (dma->output_signed) {
-                    ((int16_t *)output)[out_i] = ((int16_t *)output)[out_i] >> shift;
-                } else {
-                    ((uint16_t *)output)[out_i] = ((uint16_t *)output)[out_i] >> shift;
-                }
-            }
-            out_i += 1;
-        }
+        out_samples = output_length_used / 2;
+        audiosample_convert_16_16((uint16_t *)(void *)output, (const uint16_t *)(void *)input, out_samples,
+            dma->sample_spacing, flip_sign ? 0x8000 : 0, 16 - dma->output_resolution, dma->output_signed);
     } else {
         // (dma->sample_resolution > 8 && dma->output_resolution <= 8)
         // Not currently used, but might be in the future.
         mp_raise_RuntimeError(MP_ERROR_TEXT("Audio conversion not implemented"));
     }
     if (dma->swap_channel) {
-        // Loop for swapping left and right channels
-        for (uint32_t i = 0; i < out_i; i += 2) {
-            uint16_t temp = ((uint16_t *)output)[i];
-            ((uint16_t *)output)[i] = ((uint16_t *)output)[i + 1];
-            ((uint16_t *)output)[i + 1] = temp;
-        }
+        audiosample_swap_channels_16((uint16_t *)(void *)output, out_samples / 2);
     }
-    #pragma GCC diagnostic pop
     return output_length_used;
 }
 
@@ -135,11 +98,18 @@ static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
     // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
     // The output buffer is one of the DMA buffers (passed in).
 
-    size_t output_length_used = audio_dma_convert_samples(
-        dma, sample_buffer, sample_buffer_length,
-        dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    // When the sample is already in the output format, the DMA reads it in place.
+    uint8_t *output = sample_buffer;
+    size_t output_length_used = sample_buffer_length;
+    if (!dma->output_direct || ((uintptr_t)sample_buffer & (dma->output_size - 1)) != 0) {
+        output = dma->buffer[buffer_idx];
+        output_length_used = audio_dma_convert_samples(
+            dma, sample_buffer, sample_buffer_length,
+            dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    }
+    dma->output_buffer[buffer_idx] = output;
 
-    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
+    dma_channel_set_read_addr(dma_channel, output, false /* trigger */);
     dma_channel_set_trans_count(dma_channel, output_length_used / dma->output_size, false /* trigger */);
 
     if (get_buffer_result == GET_BUFFER_DONE) {
@@ -241,6 +211,11 @@ audio_dma_result audio_dma_setup_playback(
 
     dma->signed_to_unsigned = !output_signed && samples_signed;
     dma->unsigned_to_signed = output_signed && !samples_signed;
+    dma->output_direct = dma->sample_spacing == 1 &&
+        output_signed == samples_signed &&
+        !swap_channel &&
+        ((dma->sample_resolution <= 8 && output_resolution <= 8) ||
+            (dma->sample_resolution > 8 && output_resolution == 16));
 
     if (output_resolution > 8) {
         dma->output_size = 2;
@@ -297,7 +272,7 @@ audio_dma_result audio_dma_setup_playback(
         channel_config_set_chain_to(&c, dma->channel[1]); // Chain to ourselves so we stop.
         dma_channel_configure(dma->channel[1], &c,
             &dma_hw->ch[dma->channel[0]].al3_read_addr_trig, // write address
-            &dma->buffer[0], // read address
+            &dma->output_buffer[0], // read address
             1, // transaction count
             false); // trigger
     } else {
@@ -410,9 +385,14 @@ void audio_dma_unpause_mask(uint32_t channel_mask) {
 void audio_dma_init(audio_dma_t *dma) {
     dma->buffer[0] = NULL;
     dma->buffer[1] = NULL;
+    dma->output_buffer[0] = NULL;
+    dma->output_buffer[1] = NULL;
 
     dma->channel[0] = NUM_DMA_CHANNELS;
     dma->channel[1] = NUM_DMA_CHANNELS;
+
+    // Refilling the DMA buffers must not wait behind display refreshes.
+    dma->callback.priority = BACKGROUND_CALLBACK_PRIORITY_REALTIME;
 }
 
 void audio_dma_deinit(audio_dma_t *dma) {
@@ -472,6 +452,7 @@ void __not_in_flash_func(isr_dma_0)(void) {
         // completed by the time callback_add() / dma_complete() returned. This
         // affected PIO continuous write more than audio.
         dma_hw->ints0 = mask;
+        trace_event(TRACE_EVENT_DMA_ISR, i);
         if (MP_STATE_PORT(playing_audio)[i] != NULL) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
             // Record all channels whose DMA has completed; they need loading.
@@ -496,6 +477,7 @@ void __not_in_flash_func(isr_dma_1)(void) {
         // completed by the time callback_add() / dma_complete() returned. This
         // affected PIO continuous write more than audio.
         dma_hw->ints1 = mask;
+        trace_event(TRACE_EVENT_DMA_ISR, i);
         if (MP_STATE_PORT(background_pio)[i] != NULL) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio)[i];
             rp2pio_statemachine_dma_complete_read(pio, i);
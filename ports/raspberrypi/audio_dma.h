@@ -15,6 +15,9 @@ typedef struct {
     mp_obj_t sample;
     uint8_t *buffer[2];
     size_t buffer_length[2];
+    // What each DMA channel reads from: buffer[i], or the sample's own
+    // buffer when output_direct is set and no conversion is needed.
+    uint8_t *output_buffer[2];
     uint32_t channels_to_load_mask;
     uint32_t output_register_address;
     background_callback_t callback;
@@ -31,6 +34,7 @@ typedef struct {
     bool output_signed;
     bool playing_in_progress;
     bool swap_channel;
+    bool output_direct;
 } audio_dma_t;
 
 typedef enum {
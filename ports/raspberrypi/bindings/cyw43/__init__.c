@@ -16,7 +16,14 @@
 
 #include "lib/cyw43-driver/src/cyw43.h"
 
+#include "supervisor/shared/tick.h"
+
 static int power_management_value = PM_DISABLED;
+// Set by wifi.Radio.stay_awake() to hold power saving off for a while.
+static bool stay_awake;
+// Milliseconds with power saving off. awake_since is 0 while it is on.
+static uint64_t awake_since;
+static uint64_t awake_total;
 
 void cyw43_enter_deep_sleep(void) {
 #define WL_REG_ON 23
@@ -25,7 +32,47 @@ void cyw43_enter_deep_sleep(void) {
 }
 
 void bindings_cyw43_wifi_enforce_pm(void) {
-    cyw43_wifi_pm(&cyw43_state, power_management_value);
+    int value = stay_awake ? PM_DISABLED : power_management_value;
+    cyw43_wifi_pm(&cyw43_state, value);
+
+    uint64_t now = supervisor_ticks_ms64();
+    if ((value & 0xf) == CYW43_NO_POWERSAVE_MODE) {
+        if (awake_since == 0) {
+            awake_since = now;
+        }
+    } else if (awake_since != 0) {
+        awake_total += now - awake_since;
+        awake_since = 0;
+    }
+}
+
+int bindings_cyw43_get_power_management(void) {
+    return power_management_value;
+}
+
+void bindings_cyw43_set_power_management(int value) {
+    power_management_value = value;
+    bindings_cyw43_wifi_enforce_pm();
+}
+
+void bindings_cyw43_wifi_set_stay_awake(bool value) {
+    stay_awake = value;
+    bindings_cyw43_wifi_enforce_pm();
+}
+
+uint64_t bindings_cyw43_get_awake_time_ms(void) {
+    uint64_t total = awake_total;
+    if (awake_since != 0) {
+        total += supervisor_ticks_ms64() - awake_since;
+    }
+    return total;
+}
+
+void bindings_cyw43_reset_power_management(void) {
+    power_management_value = PM_DISABLED;
+    stay_awake = false;
+    awake_since = 0;
+    awake_total = 0;
 }
 
 //| class CywPin:
@@ -82,8 +129,7 @@ MP_DEFINE_CONST_OBJ_TYPE(
 //|
 static mp_obj_t cyw43_set_power_management(const mp_obj_t value_in) {
     mp_int_t value = mp_obj_get_int(value_in);
-    power_management_value = value;
-    bindings_cyw43_wifi_enforce_pm();
+    bindings_cyw43_set_power_management(value);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(cyw43_set_power_management_obj, cyw43_set_power_management);
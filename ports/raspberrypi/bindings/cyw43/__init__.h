@@ -33,4 +33,9 @@ const mcu_pin_obj_t *validate_obj_is_pin_including_cyw43(mp_obj_t obj, qstr arg_
 #define PM_DISABLED CONSTANT_CYW43_PM_VALUE(CYW43_NO_POWERSAVE_MODE, 200, 1, 1, 10)
 
 extern void bindings_cyw43_wifi_enforce_pm(void);
+int bindings_cyw43_get_power_management(void);
+void bindings_cyw43_set_power_management(int value);
+void bindings_cyw43_wifi_set_stay_awake(bool value);
+uint64_t bindings_cyw43_get_awake_time_ms(void);
+void bindings_cyw43_reset_power_management(void);
 void cyw43_enter_deep_sleep(void);
@@ -67,7 +67,8 @@
 //|         framebuffers (color_depth=1 or 2) must be full resolution. 4-bit
 //|         color must also be full resolution. 8-bit color can be half or full
 //|         resolution. 16-bit color must be half resolution due to RAM
-//|         limitations.
+//|         limitations. Color depths up to 8 may also be 640x240, where each row
+//|         is shown twice, to use half the RAM of full resolution.
 //|
 //|         A Framebuffer is often used in conjunction with a
 //|         `framebufferio.FramebufferDisplay`.
@@ -1084,6 +1084,38 @@ MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_last_read_obj, rp2pio_statemac
 MP_PROPERTY_GETTER(rp2pio_statemachine_last_read_obj,
     (mp_obj_t)&rp2pio_statemachine_get_last_read_obj);
 
+//|     last_read_time: int
+//|     """The `time.monotonic_ns()` value when the most recent background read buffer was
+//|     filled. Read it together with `last_read` to know when that data finished arriving.
+//|     """
+static mp_obj_t rp2pio_statemachine_obj_get_last_read_time(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_ull(common_hal_rp2pio_statemachine_get_last_read_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_last_read_time_obj, rp2pio_statemachine_obj_get_last_read_time);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_last_read_time_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_last_read_time_obj);
+
+//|     read_overruns: int
+//|     """How many background read buffers were filled again before `last_read` returned
+//|     them, so their earlier contents were never seen. Starting a new background read
+//|     sets this back to zero.
+//|
+//|     This counts buffers missed by the program. `rxstall` reports data the state machine
+//|     could not push because the DMA fell behind.
+//|     """
+static mp_obj_t rp2pio_statemachine_obj_get_read_overruns(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_rp2pio_statemachine_get_read_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_read_overruns_obj, rp2pio_statemachine_obj_get_read_overruns);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_read_overruns_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_read_overruns_obj);
+
 
 //|     last_write: array.array
 //|     """Returns the buffer most recently emptied by background writes.
@@ -1140,6 +1172,8 @@ static const mp_rom_map_elem_t rp2pio_statemachine_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_rxfifo), MP_ROM_PTR(&rp2pio_statemachine_rxfifo_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_last_read), MP_ROM_PTR(&rp2pio_statemachine_last_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_read_time), MP_ROM_PTR(&rp2pio_statemachine_last_read_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_overruns), MP_ROM_PTR(&rp2pio_statemachine_read_overruns_obj) },
     { MP_ROM_QSTR(MP_QSTR_last_write), MP_ROM_PTR(&rp2pio_statemachine_last_write_obj) },
 
 };
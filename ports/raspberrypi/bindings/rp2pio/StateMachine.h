@@ -91,4 +91,6 @@ void common_hal_rp2pio_statemachine_set_interrupt_handler(rp2pio_statemachine_ob
 mp_obj_t common_hal_rp2pio_statemachine_get_rxfifo(rp2pio_statemachine_obj_t *self);
 
 mp_obj_t common_hal_rp2pio_statemachine_get_last_read(rp2pio_statemachine_obj_t *self);
+uint64_t common_hal_rp2pio_statemachine_get_last_read_time(rp2pio_statemachine_obj_t *self);
+uint32_t common_hal_rp2pio_statemachine_get_read_overruns(rp2pio_statemachine_obj_t *self);
 mp_obj_t common_hal_rp2pio_statemachine_get_last_write(rp2pio_statemachine_obj_t *self);
@@ -8,7 +8,10 @@
 
 #include "py/obj.h"
 
+// Boards with RAM to spare may set a larger size.
+#ifndef SLEEP_MEMORY_LENGTH
 #define SLEEP_MEMORY_LENGTH (256)
+#endif
 
 typedef struct {
     mp_obj_base_t base;
@@ -32,6 +32,7 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
 
     // Set pin and channel
     self->pin = pin;
+    self->loop_buffer = NULL;
     claim_pin(pin);
 
     // TODO: find a way to accept ADC4 for temperature
@@ -103,9 +104,11 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
-    // stop DMA
+    // stop conversions and DMA
+    adc_run(false);
     dma_channel_abort(self->dma_chan[0]);
     dma_channel_abort(self->dma_chan[1]);
+    self->loop_buffer = NULL;
 
     // Release ADC Pin
     reset_pin_number(self->pin->number);
@@ -116,8 +119,6 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
     dma_channel_unclaim(self->dma_chan[1]);
 }
 
-uint8_t *active_buffer;
-
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample, bool loop) {
     // RP2040 Implementation Detail
     // Fills the supplied buffer with ADC values using DMA transfer.
@@ -127,6 +128,7 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     // samples at the first sample with the error bit set.
     // Number of transfers is always the number of samples which is the array
     // byte length divided by the bytes_per_sample.
+    self->loop_buffer = NULL;
     uint dma_size = DMA_SIZE_8;
     bool show_error_bit = false;
     if (bytes_per_sample == 2) {
@@ -194,14 +196,16 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     } else { // Set DMA to repeat transfers indefinitely
         dma_channel_configure(self->dma_chan[1], &(self->cfg[1]),
             &dma_hw->ch[self->dma_chan[0]].al2_write_addr_trig,      // write address
-            &active_buffer,                                          // read address
+            &self->loop_buffer,                                      // read address
             1,                                                       // transfer count
             false                                                    // don't start yet
             );
 
-        // put the buffer start address into a global so that it can be read by DMA
+        // put the buffer start address where it can be read by DMA
         // and written into channel 0's write address
-        active_buffer = buffer;
+        self->loop_buffer = buffer;
+        self->loop_sample_count = sample_count;
+        self->loop_bytes_per_sample = bytes_per_sample;
 
         channel_config_set_chain_to(&(self->cfg[0]), self->dma_chan[1]);
         dma_channel_configure(self->dma_chan[0], &(self->cfg[0]),
@@ -218,3 +222,14 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
 
     }
 }
+
+uint32_t common_hal_analogbufio_bufferedin_get_loop_position(analogbufio_bufferedin_obj_t *self) {
+    if (self->loop_buffer == NULL) {
+        return 0;
+    }
+    // Just after the last sample, the write address points past the end
+    // until channel 1 reloads it, so wrap that back to the start.
+    uint8_t *write_addr = (uint8_t *)dma_channel_hw_addr(self->dma_chan[0])->write_addr;
+    uint32_t position = (write_addr - self->loop_buffer) / self->loop_bytes_per_sample;
+    return position < self->loop_sample_count ? position : 0;
+}
@@ -19,4 +19,8 @@ typedef struct {
     uint8_t chan;
     uint dma_chan[2];
     dma_channel_config cfg[2];
+    // While looping, channel 1 reloads channel 0's write address from here.
+    uint8_t *loop_buffer;
+    uint32_t loop_sample_count;
+    uint8_t loop_bytes_per_sample;
 } analogbufio_bufferedin_obj_t;
@@ -8,6 +8,7 @@
 
 #include "shared/runtime/interrupt_char.h"
 #include "py/mperrno.h"
+#include "py/mpstate.h"
 #include "py/runtime.h"
 
 #include "supervisor/board.h"
@@ -19,11 +20,58 @@
 
 #define NO_INSTANCE 0xff
 
+// Use DMA for transfers at least this long, if channels are available.
+#define DMA_MIN_SIZE_THRESHOLD (32)
+
 static bool never_reset_spi[2];
 static spi_inst_t *spi[2] = {spi0, spi1};
 
+// DMA channels of the background transfer running on each peripheral, or -1.
+static int async_chan_tx[2] = {-1, -1};
+static int async_chan_rx[2] = {-1, -1};
+// write_value source, or sink for unwanted read data, of each background transfer.
+static uint32_t async_dummy[2];
+
+static void _release_async(size_t index) {
+    dma_channel_unclaim(async_chan_tx[index]);
+    dma_channel_unclaim(async_chan_rx[index]);
+    async_chan_tx[index] = -1;
+    async_chan_rx[index] = -1;
+    MP_STATE_PORT(busio_spi_async_buffer)[index] = MP_OBJ_NULL;
+}
+
+static void _abort_async(size_t index) {
+    if (async_chan_rx[index] < 0) {
+        return;
+    }
+    dma_channel_abort(async_chan_tx[index]);
+    dma_channel_abort(async_chan_rx[index]);
+    _release_async(index);
+}
+
+// True while a background transfer runs. Frees its channels once it is done.
+static bool _async_busy(size_t index) {
+    if (async_chan_rx[index] < 0) {
+        return false;
+    }
+    if (dma_channel_is_busy(async_chan_rx[index]) || dma_channel_is_busy(async_chan_tx[index])) {
+        return true;
+    }
+    _release_async(index);
+    return false;
+}
+
+static void _wait_for_async(busio_spi_obj_t *self) {
+    size_t index = spi_get_index(self->peripheral);
+    while (_async_busy(index)) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
 void reset_spi(void) {
     for (size_t i = 0; i < 2; i++) {
+        // The buffer belongs to the VM that is going away, even if the bus stays.
+        _abort_async(i);
         if (never_reset_spi[i]) {
             continue;
         }
@@ -112,6 +160,7 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
         return;
     }
     never_reset_spi[spi_get_index(self->peripheral)] = false;
+    _abort_async(spi_get_index(self->peripheral));
     spi_deinit(self->peripheral);
 
     common_hal_reset_pin(self->clock);
@@ -129,6 +178,7 @@ bool common_hal_busio_spi_configure(busio_spi_obj_t *self,
         return true;
     }
 
+    _wait_for_async(self);
     spi_set_format(self->peripheral, bits, polarity, phase, SPI_MSB_FIRST);
 
     // Workaround to start with clock line high if polarity=1. The hw SPI peripheral does not do this
@@ -169,44 +219,52 @@ void common_hal_busio_spi_unlock(busio_spi_obj_t *self) {
     self->has_lock = false;
 }
 
+static void _start_dma(spi_inst_t *peripheral, int chan_tx, int chan_rx,
+    const uint8_t *data_out, size_t out_len,
+    uint8_t *data_in, size_t in_len) {
+    size_t len = MAX(out_len, in_len);
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+    channel_config_set_read_increment(&c, out_len == len);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(chan_tx, &c,
+        &spi_get_hw(peripheral)->dr,
+        data_out,
+        len,
+        false);
+
+    c = dma_channel_get_default_config(chan_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, in_len == len);
+    dma_channel_configure(chan_rx, &c,
+        data_in,
+        &spi_get_hw(peripheral)->dr,
+        len,
+        false);
+
+    dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+}
+
 static bool _transfer(busio_spi_obj_t *self,
     const uint8_t *data_out, size_t out_len,
     uint8_t *data_in, size_t in_len) {
+    _wait_for_async(self);
+
     // Use DMA for large transfers if channels are available
-    const size_t dma_min_size_threshold = 32;
     int chan_tx = -1;
     int chan_rx = -1;
     size_t len = MAX(out_len, in_len);
-    if (len >= dma_min_size_threshold) {
+    if (len >= DMA_MIN_SIZE_THRESHOLD) {
         // Use two DMA channels to service the two FIFOs
         chan_tx = dma_claim_unused_channel(false);
         chan_rx = dma_claim_unused_channel(false);
     }
     bool use_dma = chan_rx >= 0 && chan_tx >= 0;
     if (use_dma) {
-        dma_channel_config c = dma_channel_get_default_config(chan_tx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
-        channel_config_set_read_increment(&c, out_len == len);
-        channel_config_set_write_increment(&c, false);
-        dma_channel_configure(chan_tx, &c,
-            &spi_get_hw(self->peripheral)->dr,
-            data_out,
-            len,
-            false);
-
-        c = dma_channel_get_default_config(chan_rx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
-        channel_config_set_read_increment(&c, false);
-        channel_config_set_write_increment(&c, in_len == len);
-        dma_channel_configure(chan_rx, &c,
-            data_in,
-            &spi_get_hw(self->peripheral)->dr,
-            len,
-            false);
-
-        dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+        _start_dma(self->peripheral, chan_tx, chan_rx, data_out, out_len, data_in, in_len);
         while (dma_channel_is_busy(chan_rx) || dma_channel_is_busy(chan_tx)) {
             // TODO: We should idle here until we get a DMA interrupt or something else.
             RUN_BACKGROUND_TASKS;
@@ -269,6 +327,55 @@ bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, const uint8_t *data_ou
     return _transfer(self, data_out, len, data_in, len);
 }
 
+// Starts a DMA transfer and returns without waiting for it. Short transfers, and ones that
+// can't get two DMA channels, are done before returning.
+static bool _start_transfer(busio_spi_obj_t *self, mp_obj_t buffer_obj,
+    const uint8_t *data_out, size_t out_len,
+    uint8_t *data_in, size_t in_len) {
+    size_t index = spi_get_index(self->peripheral);
+    int chan_tx = -1;
+    int chan_rx = -1;
+    size_t len = MAX(out_len, in_len);
+    if (len >= DMA_MIN_SIZE_THRESHOLD) {
+        chan_tx = dma_claim_unused_channel(false);
+        chan_rx = dma_claim_unused_channel(false);
+    }
+    if (chan_rx < 0 || chan_tx < 0) {
+        if (chan_rx >= 0) {
+            dma_channel_unclaim(chan_rx);
+        }
+        if (chan_tx >= 0) {
+            dma_channel_unclaim(chan_tx);
+        }
+        return _transfer(self, data_out, out_len, data_in, in_len);
+    }
+    async_chan_tx[index] = chan_tx;
+    async_chan_rx[index] = chan_rx;
+    MP_STATE_PORT(busio_spi_async_buffer)[index] = buffer_obj;
+    _start_dma(self->peripheral, chan_tx, chan_rx, data_out, out_len, data_in, in_len);
+    return true;
+}
+
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, mp_obj_t buffer_obj,
+    const uint8_t *data, size_t len) {
+    _wait_for_async(self);
+    uint8_t *sink = (uint8_t *)&async_dummy[spi_get_index(self->peripheral)];
+    return _start_transfer(self, buffer_obj, data, len, sink, MIN(len, 4));
+}
+
+bool common_hal_busio_spi_start_read(busio_spi_obj_t *self, mp_obj_t buffer_obj,
+    uint8_t *data, size_t len, uint8_t write_value) {
+    // The previous transfer may still be using the dummy word.
+    _wait_for_async(self);
+    uint32_t *data_out = &async_dummy[spi_get_index(self->peripheral)];
+    *data_out = write_value << 24 | write_value << 16 | write_value << 8 | write_value;
+    return _start_transfer(self, buffer_obj, (const uint8_t *)data_out, MIN(4, len), data, len);
+}
+
+bool common_hal_busio_spi_get_busy(busio_spi_obj_t *self) {
+    return _async_busy(spi_get_index(self->peripheral));
+}
+
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t *self) {
     return self->real_frequency;
 }
@@ -280,3 +387,5 @@ uint8_t common_hal_busio_spi_get_phase(busio_spi_obj_t *self) {
 uint8_t common_hal_busio_spi_get_polarity(busio_spi_obj_t *self) {
     return self->polarity;
 }
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t busio_spi_async_buffer[2]);
@@ -6,6 +6,8 @@
 
 #include "shared-bindings/busio/UART.h"
 
+#include <string.h>
+
 #include "py/stream.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
@@ -14,10 +16,24 @@
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 #include "src/rp2_common/hardware_irq/include/hardware/irq.h"
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
 
 #define NO_PIN 0xff
+#define NO_DMA_CHANNEL (-1)
+
+// Received bytes go through a DMA ring when possible. It keeps filling while interrupts are
+// off, such as during flash writes, where the 32 byte FIFO would overrun at high baud rates.
+#define RX_DMA_MIN_SIZE (256)
+// channel_config_set_ring() can wrap at up to 32kB.
+#define RX_DMA_MAX_RING_BITS (15)
+#ifdef PICO_RP2350
+// The top four bits of the count select the transfer mode on RP2350.
+#define RX_DMA_TRANSFER_COUNT (0x0fffffff)
+#else
+#define RX_DMA_TRANSFER_COUNT (0xffffffff)
+#endif
 
 #define UART_INST(uart) (((uart) ? uart1 : uart0))
 
@@ -28,11 +44,22 @@ typedef enum {
 } uart_status_t;
 
 static uart_status_t uart_status[NUM_UARTS];
+static int rx_dma_channel[NUM_UARTS] = {NO_DMA_CHANNEL, NO_DMA_CHANNEL};
+
+static void _rx_dma_stop(uint8_t num) {
+    if (rx_dma_channel[num] == NO_DMA_CHANNEL) {
+        return;
+    }
+    dma_channel_abort(rx_dma_channel[num]);
+    dma_channel_unclaim(rx_dma_channel[num]);
+    rx_dma_channel[num] = NO_DMA_CHANNEL;
+}
 
 void reset_uart(void) {
     for (uint8_t num = 0; num < NUM_UARTS; num++) {
         if (uart_status[num] == STATUS_BUSY) {
             uart_status[num] = STATUS_FREE;
+            _rx_dma_stop(num);
             uart_deinit(UART_INST(num));
         }
     }
@@ -93,6 +120,75 @@ static void shared_callback(busio_uart_obj_t *self) {
     uart_get_hw(self->uart)->icr = UART_UARTICR_RXIC_BITS | UART_UARTICR_RTIC_BITS;
 }
 
+static bool _rx_dma_start(busio_uart_obj_t *self, uint16_t receiver_buffer_size) {
+    uint32_t ring_bits = 32 - __builtin_clz(MAX(receiver_buffer_size, RX_DMA_MIN_SIZE) - 1);
+    if (ring_bits > RX_DMA_MAX_RING_BITS) {
+        return false;
+    }
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        return false;
+    }
+    // The DMA ring must be aligned to its size, so allocate twice that and align within it.
+    size_t size = 1 << ring_bits;
+    self->rx_dma_alloc = m_malloc_maybe(2 * size);
+    if (self->rx_dma_alloc == NULL) {
+        dma_channel_unclaim(channel);
+        return false;
+    }
+    self->rx_dma_buffer = (uint8_t *)(((uintptr_t)self->rx_dma_alloc + size - 1) & ~(size - 1));
+    self->rx_dma_size = size;
+    self->rx_dma_started = 0;
+    self->rx_dma_read = 0;
+    rx_dma_channel[self->uart_id] = channel;
+
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_bits);
+    channel_config_set_dreq(&c, uart_get_dreq(self->uart, false));
+    dma_channel_configure(channel, &c,
+        self->rx_dma_buffer,
+        &uart_get_hw(self->uart)->dr,
+        RX_DMA_TRANSFER_COUNT,
+        true);
+    return true;
+}
+
+// Returns how many received bytes are waiting in the DMA ring.
+static uint32_t _rx_dma_available(busio_uart_obj_t *self) {
+    int channel = rx_dma_channel[self->uart_id];
+    uint32_t remaining = dma_channel_hw_addr(channel)->transfer_count;
+    uint32_t received = self->rx_dma_started + (RX_DMA_TRANSFER_COUNT - remaining);
+    if (remaining == 0) {
+        // The count ran out. Carry on from the same place in the ring; the FIFO holds
+        // anything that arrived meanwhile.
+        self->rx_dma_started += RX_DMA_TRANSFER_COUNT;
+        dma_channel_set_trans_count(channel, RX_DMA_TRANSFER_COUNT, true);
+    }
+    uint32_t available = received - self->rx_dma_read;
+    if (available > self->rx_dma_size) {
+        // The oldest bytes have been overwritten.
+        self->rx_dma_read = received - self->rx_dma_size;
+        available = self->rx_dma_size;
+    }
+    return available;
+}
+
+static size_t _rx_dma_get(busio_uart_obj_t *self, uint8_t *data, size_t len) {
+    size_t count = MIN(len, _rx_dma_available(self));
+    size_t copied = 0;
+    while (copied < count) {
+        size_t index = (self->rx_dma_read + copied) & (self->rx_dma_size - 1);
+        size_t chunk = MIN(count - copied, self->rx_dma_size - index);
+        memcpy(data + copied, self->rx_dma_buffer + index, chunk);
+        copied += chunk;
+    }
+    self->rx_dma_read += count;
+    return count;
+}
+
 static void uart0_callback(void) {
     shared_callback(active_uarts[0]);
 }
@@ -163,10 +259,13 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     uart_set_format(self->uart, bits, stop, parity);
     uart_set_hw_flow(self->uart, (cts != NULL), (rts != NULL));
 
+    bool rx_dma = false;
     if (rx != NULL) {
         // Use the provided buffer when given.
         if (receiver_buffer != NULL) {
             ringbuf_init(&self->ringbuf, receiver_buffer, receiver_buffer_size);
+        } else if (_rx_dma_start(self, receiver_buffer_size)) {
+            rx_dma = true;
         } else {
             if (!ringbuf_alloc(&self->ringbuf, receiver_buffer_size)) {
                 uart_deinit(self->uart);
@@ -184,7 +283,7 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
         irq_set_exclusive_handler(self->uart_irq_id, uart0_callback);
     }
     irq_set_enabled(self->uart_irq_id, true);
-    uart_set_irq_enables(self->uart, true /* rx has data */, false /* tx needs data */);
+    uart_set_irq_enables(self->uart, !rx_dma /* rx has data */, false /* tx needs data */);
 }
 
 bool common_hal_busio_uart_deinited(busio_uart_obj_t *self) {
@@ -195,8 +294,11 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
     if (common_hal_busio_uart_deinited(self)) {
         return;
     }
+    _rx_dma_stop(self->uart_id);
     uart_deinit(self->uart);
     ringbuf_deinit(&self->ringbuf);
+    self->rx_dma_alloc = NULL;
+    self->rx_dma_buffer = NULL;
     active_uarts[self->uart_id] = NULL;
     uart_status[self->uart_id] = STATUS_FREE;
     reset_pin_number(self->tx_pin);
@@ -250,6 +352,29 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
         return 0;
     }
 
+    if (rx_dma_channel[self->uart_id] != NO_DMA_CHANNEL) {
+        size_t total_read = _rx_dma_get(self, data, len);
+        uint64_t start_ticks = supervisor_ticks_ms64();
+        // Wait until timeout passes with the line idle, or until we've read enough chars.
+        while (total_read < len && (supervisor_ticks_ms64() - start_ticks < self->timeout_ms)) {
+            size_t count = _rx_dma_get(self, data + total_read, len - total_read);
+            if (count > 0) {
+                total_read += count;
+                start_ticks = supervisor_ticks_ms64();
+            }
+            RUN_BACKGROUND_TASKS;
+            // Allow user to break out of a timeout with a KeyboardInterrupt.
+            if (mp_hal_is_interrupted()) {
+                break;
+            }
+        }
+        if (total_read == 0) {
+            *errcode = EAGAIN;
+            return MP_STREAM_ERROR;
+        }
+        return total_read;
+    }
+
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
 
@@ -315,6 +440,9 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 }
 
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
+    if (rx_dma_channel[self->uart_id] != NO_DMA_CHANNEL) {
+        return _rx_dma_available(self);
+    }
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
     // The UART only interrupts after a threshold so make sure to copy anything
@@ -325,6 +453,10 @@ uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
 }
 
 void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
+    if (rx_dma_channel[self->uart_id] != NO_DMA_CHANNEL) {
+        self->rx_dma_read += _rx_dma_available(self);
+        return;
+    }
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
     ringbuf_clear(&self->ringbuf);
@@ -25,6 +25,14 @@ typedef struct {
     uint32_t timeout_ms;
     uart_inst_t *uart;
     ringbuf_t ringbuf;
+    // Receive ring written by DMA, used instead of ringbuf when a channel is free. The ring
+    // is aligned within rx_dma_alloc, which is kept so the heap block stays alive.
+    void *rx_dma_alloc;
+    uint8_t *rx_dma_buffer;
+    uint32_t rx_dma_size;
+    // Byte counts that wrap at 2**32: received before the current DMA run, and read so far.
+    uint32_t rx_dma_started;
+    uint32_t rx_dma_read;
 } busio_uart_obj_t;
 
 extern void reset_uart(void);
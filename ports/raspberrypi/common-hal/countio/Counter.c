@@ -11,6 +11,7 @@
 
 #include "shared-bindings/countio/Edge.h"
 #include "shared-bindings/digitalio/Pull.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "common-hal/pwmio/PWMOut.h"
 
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
@@ -90,9 +91,13 @@ void common_hal_countio_counter_deinit(countio_counter_obj_t *self) {
 }
 
 mp_int_t common_hal_countio_counter_get_count(countio_counter_obj_t *self) {
+    // countio.CountRecorder reads the count from an interrupt too.
+    common_hal_mcu_disable_interrupts();
     self->count += pwm_get_counter(self->slice_num);
     pwm_set_counter(self->slice_num, 0);
-    return self->count;
+    mp_int_t count = self->count;
+    common_hal_mcu_enable_interrupts();
+    return count;
 }
 
 void common_hal_countio_counter_set_count(countio_counter_obj_t *self,
@@ -0,0 +1,165 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/i2ctarget/I2CRegisterTarget.h"
+
+#include "py/runtime.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Pin.h"
+
+#include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
+
+static i2c_inst_t *i2c[2] = {i2c0, i2c1};
+static i2ctarget_i2c_register_target_obj_t *active_targets[2];
+
+#define NO_PIN 0xff
+
+#define INTR_MASK (I2C_IC_INTR_MASK_M_RX_FULL_BITS | I2C_IC_INTR_MASK_M_RD_REQ_BITS | \
+    I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS | \
+    I2C_IC_INTR_MASK_M_START_DET_BITS)
+
+static void __not_in_flash_func(handle_irq)(i2ctarget_i2c_register_target_obj_t *self) {
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    uint32_t status = hw->intr_stat;
+
+    // A new transfer always starts with the register index when it writes.
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        hw->clr_tx_abrt;
+        self->index_written = false;
+    }
+    if (status & I2C_IC_INTR_STAT_R_START_DET_BITS) {
+        hw->clr_start_det;
+        self->index_written = false;
+    }
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        hw->clr_stop_det;
+        self->index_written = false;
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_RX_FULL_BITS) {
+        while (hw->status & I2C_IC_STATUS_RFNE_BITS) {
+            uint8_t data = (uint8_t)hw->data_cmd;
+            if (!self->index_written) {
+                self->index = data % self->len;
+                self->index_written = true;
+                continue;
+            }
+            size_t index = self->index;
+            self->registers[index] = data;
+            if (self->changed_start == self->changed_end) {
+                self->changed_start = index;
+                self->changed_end = index + 1;
+            } else {
+                self->changed_start = MIN(self->changed_start, index);
+                self->changed_end = MAX(self->changed_end, index + 1);
+            }
+            self->index = (index + 1) % self->len;
+        }
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_RD_REQ_BITS) {
+        hw->clr_rd_req;
+        size_t index = self->index;
+        hw->data_cmd = self->registers[index];
+        self->index = (index + 1) % self->len;
+    }
+}
+
+static void __not_in_flash_func(i2c0_irq_handler)(void) {
+    handle_irq(active_targets[0]);
+}
+
+static void __not_in_flash_func(i2c1_irq_handler)(void) {
+    handle_irq(active_targets[1]);
+}
+
+void common_hal_i2ctarget_i2c_register_target_construct(i2ctarget_i2c_register_target_obj_t *self,
+    const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda, uint8_t address,
+    mp_obj_t registers_obj, uint8_t *registers, size_t len) {
+    self->peripheral = NULL;
+
+    // I2C pins have a regular pattern. SCL is always odd and SDA is even. They match up in pairs
+    // so we can divide by two to get the instance. This pattern repeats.
+    size_t scl_instance = (scl->number / 2) % 2;
+    size_t sda_instance = (sda->number / 2) % 2;
+    if (scl->number % 2 == 1 && sda->number % 2 == 0 && scl_instance == sda_instance) {
+        self->peripheral = i2c[sda_instance];
+    }
+
+    if (self->peripheral == NULL) {
+        raise_ValueError_invalid_pins();
+    }
+
+    if ((i2c_get_hw(self->peripheral)->enable & I2C_IC_ENABLE_ENABLE_BITS) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("I2C peripheral in use"));
+    }
+
+    self->registers_obj = registers_obj;
+    self->registers = registers;
+    self->len = len;
+    self->index = 0;
+    self->changed_start = 0;
+    self->changed_end = 0;
+    self->index_written = false;
+    self->scl_pin = scl->number;
+    self->sda_pin = sda->number;
+
+    // Have to specify a baudrate even if the i2c target does not use it
+    const uint32_t frequency = 400000;
+    i2c_init(self->peripheral, frequency);
+
+    gpio_set_function(sda->number, GPIO_FUNC_I2C);
+    gpio_set_function(scl->number, GPIO_FUNC_I2C);
+
+    gpio_set_pulls(sda->number, true, false);
+    gpio_set_pulls(scl->number, true, false);
+
+    i2c_set_slave_mode(self->peripheral, true, address);
+
+    size_t instance = i2c_hw_index(self->peripheral);
+    active_targets[instance] = self;
+    i2c_get_hw(self->peripheral)->intr_mask = INTR_MASK;
+    uint irq = I2C0_IRQ + instance;
+    irq_set_exclusive_handler(irq, instance == 0 ? i2c0_irq_handler : i2c1_irq_handler);
+    irq_set_enabled(irq, true);
+}
+
+bool common_hal_i2ctarget_i2c_register_target_deinited(i2ctarget_i2c_register_target_obj_t *self) {
+    return self->sda_pin == NO_PIN;
+}
+
+void common_hal_i2ctarget_i2c_register_target_deinit(i2ctarget_i2c_register_target_obj_t *self) {
+    if (common_hal_i2ctarget_i2c_register_target_deinited(self)) {
+        return;
+    }
+
+    size_t instance = i2c_hw_index(self->peripheral);
+    uint irq = I2C0_IRQ + instance;
+    irq_set_enabled(irq, false);
+    i2c_get_hw(self->peripheral)->intr_mask = 0;
+    irq_remove_handler(irq, instance == 0 ? i2c0_irq_handler : i2c1_irq_handler);
+    active_targets[instance] = NULL;
+
+    i2c_deinit(self->peripheral);
+
+    reset_pin_number(self->sda_pin);
+    reset_pin_number(self->scl_pin);
+    self->sda_pin = NO_PIN;
+    self->scl_pin = NO_PIN;
+    self->registers_obj = MP_OBJ_NULL;
+    self->registers = NULL;
+}
+
+bool common_hal_i2ctarget_i2c_register_target_get_changes(i2ctarget_i2c_register_target_obj_t *self, size_t *start, size_t *end) {
+    common_hal_mcu_disable_interrupts();
+    *start = self->changed_start;
+    *end = self->changed_end;
+    self->changed_start = 0;
+    self->changed_end = 0;
+    common_hal_mcu_enable_interrupts();
+    return *start != *end;
+}
@@ -0,0 +1,31 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "common-hal/microcontroller/Pin.h"
+#include "src/rp2_common/hardware_i2c/include/hardware/i2c.h"
+
+typedef struct {
+    mp_obj_base_t base;
+
+    mp_obj_t registers_obj;
+    uint8_t *registers;
+    size_t len;
+
+    i2c_inst_t *peripheral;
+
+    // Updated from the I2C interrupt.
+    volatile size_t index;
+    volatile size_t changed_start;
+    volatile size_t changed_end;
+    // Whether the current write has set the register index yet.
+    bool index_written;
+
+    uint8_t scl_pin;
+    uint8_t sda_pin;
+} i2ctarget_i2c_register_target_obj_t;
@@ -17,6 +17,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/shared/trace.h"
 
 #include "src/rp2_common/hardware_pio/include/hardware/pio.h"
 #include "src/rp2_common/hardware_pio/include/hardware/pio_instructions.h"
@@ -135,4 +136,5 @@ void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecaptur
     common_hal_rp2pio_statemachine_readinto(&self->state_machine, bufinfo.buf, bufinfo.len, 4, false);
 
     pio_sm_set_enabled(pio, sm, false);
+    trace_event(TRACE_EVENT_FRAME, 0);
 }
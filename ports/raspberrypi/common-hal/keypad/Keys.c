@@ -0,0 +1,91 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// Edge interrupts that let an idle keypad.Keys stop scanning until a key is pressed.
+
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-module/keypad/Keys.h"
+
+#include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
+
+#define ALL_EDGES (GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL)
+
+static keypad_keys_obj_t *waiting_keys[32];
+static uint32_t waiting_pins;
+
+static void keys_edge_irq(void) {
+    for (size_t pin_number = 0; pin_number < 32; pin_number++) {
+        if ((waiting_pins & (1u << pin_number)) == 0) {
+            continue;
+        }
+        uint32_t events = gpio_get_irq_event_mask(pin_number);
+        if (events == 0) {
+            continue;
+        }
+        gpio_acknowledge_irq(pin_number, events);
+        // Bounces shouldn't queue more wakeups. keypad_keys_port_stop_waiting() tidies up.
+        gpio_set_irq_enabled(pin_number, ALL_EDGES, false);
+        keypad_wake_scanner((keypad_scanner_obj_t *)waiting_keys[pin_number]);
+    }
+}
+
+static void set_waiting_pins(uint32_t pins) {
+    if (waiting_pins != 0) {
+        gpio_remove_raw_irq_handler_masked(waiting_pins, keys_edge_irq);
+    }
+    waiting_pins = pins;
+    if (waiting_pins != 0) {
+        gpio_add_raw_irq_handler_masked(waiting_pins, keys_edge_irq);
+        irq_set_enabled(IO_IRQ_BANK0, true);
+    }
+}
+
+static uint8_t key_pin_number(keypad_keys_obj_t *self, size_t key_number) {
+    digitalio_digitalinout_obj_t *dio = self->digitalinouts->items[key_number];
+    return dio->pin->number;
+}
+
+bool keypad_keys_port_wait_for_press(keypad_keys_obj_t *self) {
+    size_t key_count = self->digitalinouts->len;
+    uint32_t pins = 0;
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        uint8_t pin_number = key_pin_number(self, key_number);
+        if (pin_number >= 32 || (waiting_pins & (1u << pin_number)) != 0) {
+            return false;
+        }
+        pins |= 1u << pin_number;
+    }
+
+    uint32_t edge = self->value_when_pressed ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    common_hal_mcu_disable_interrupts();
+    set_waiting_pins(waiting_pins | pins);
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        uint8_t pin_number = key_pin_number(self, key_number);
+        waiting_keys[pin_number] = self;
+        gpio_acknowledge_irq(pin_number, ALL_EDGES);
+        gpio_set_irq_enabled(pin_number, edge, true);
+    }
+    common_hal_mcu_enable_interrupts();
+    return true;
+}
+
+void keypad_keys_port_stop_waiting(keypad_keys_obj_t *self) {
+    size_t key_count = self->digitalinouts->len;
+    uint32_t pins = 0;
+    common_hal_mcu_disable_interrupts();
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        uint8_t pin_number = key_pin_number(self, key_number);
+        if (pin_number < 32 && waiting_keys[pin_number] == self) {
+            gpio_set_irq_enabled(pin_number, ALL_EDGES, false);
+            waiting_keys[pin_number] = NULL;
+            pins |= 1u << pin_number;
+        }
+    }
+    set_waiting_pins(waiting_pins & ~pins);
+    common_hal_mcu_enable_interrupts();
+}
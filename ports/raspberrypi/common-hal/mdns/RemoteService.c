@@ -28,6 +28,10 @@ mp_int_t common_hal_mdns_remoteservice_get_port(mdns_remoteservice_obj_t *self)
     return self->port;
 }
 
+uint32_t mdns_remoteservice_get_ttl(mdns_remoteservice_obj_t *self) {
+    return self->ttl;
+}
+
 uint32_t mdns_remoteservice_get_ipv4_address(mdns_remoteservice_obj_t *self) {
     return self->ipv4_address;
 }
@@ -11,6 +11,8 @@
 typedef struct {
     mp_obj_base_t base;
     uint32_t ipv4_address;
+    // Seconds until the first of the records that made up this service expires.
+    uint32_t ttl;
     uint16_t port;
     char protocol[5]; // RFC 6763 Section 7.2 - 4 bytes + 1 for NUL
     char service_name[17]; // RFC 6763 Section 7.2 - 16 bytes + 1 for NUL
@@ -73,6 +73,7 @@ void common_hal_mdns_server_deinit(mdns_server_obj_t *self) {
     }
     self->inited = false;
     object_inited = false;
+    mdns_server_browse_reset();
     mdns_resp_remove_netif(NETIF_STA);
 }
 
@@ -109,7 +110,12 @@ typedef struct {
     size_t out_len;
 } nonalloc_search_state_t;
 
-static void copy_data_into_remote_service(struct mdns_answer *answer, const char *varpart, int varlen, mdns_remoteservice_obj_t *out) {
+static void copy_data_into_remote_service(struct mdns_answer *answer, const char *varpart, int varlen, int flags, mdns_remoteservice_obj_t *out) {
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
+        out->ttl = answer->ttl;
+    } else {
+        out->ttl = MIN(out->ttl, answer->ttl);
+    }
     if (varlen > 0) {
         if (answer->info.type == DNS_RRTYPE_A) {
             char *hostname = out->hostname;
@@ -152,7 +158,7 @@ static void search_result_cb(struct mdns_answer *answer, const char *varpart, in
     nonalloc_search_state_t *state = arg;
     state->out[state->i].base.type = &mdns_remoteservice_type;
 
-    copy_data_into_remote_service(answer, varpart, varlen, &state->out[state->i]);
+    copy_data_into_remote_service(answer, varpart, varlen, flags, &state->out[state->i]);
 
     if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
         state->i += 1;
@@ -227,7 +233,25 @@ static void alloc_search_result_cb(struct mdns_answer *answer, const char *varpa
         state->head = service;
     }
 
-    copy_data_into_remote_service(answer, varpart, varlen, state->head);
+    copy_data_into_remote_service(answer, varpart, varlen, flags, state->head);
+}
+
+// Builds a tuple from a list of services linked through next, and unlinks them.
+static mp_obj_t remote_services_tuple(mdns_remoteservice_obj_t *head, size_t count) {
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
+    mdns_remoteservice_obj_t *next = head;
+    uint8_t added = 0;
+    while (next != NULL) {
+        mdns_remoteservice_obj_t *cur = next;
+        tuple->items[added] = MP_OBJ_FROM_PTR(cur);
+        next = cur->next;
+        // Set next back to NULL so that each service object is independently
+        // tracked for GC.
+        cur->next = NULL;
+        added++;
+    }
+
+    return MP_OBJ_FROM_PTR(tuple);
 }
 
 mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
@@ -260,22 +284,100 @@ mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *servic
         state.request_id = MDNS_MAX_REQUESTS;
     }
 
-    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(state.count, NULL));
-    mdns_remoteservice_obj_t *next = state.head;
-    uint8_t added = 0;
-    while (next != NULL) {
-        mdns_remoteservice_obj_t *cur = next;
-        tuple->items[added] = MP_OBJ_FROM_PTR(cur);
-        next = cur->next;
-        // Set next back to NULL so that each service object is independently
-        // tracked for GC.
-        cur->next = NULL;
-        added++;
+    return remote_services_tuple(state.head, state.count);
+}
+
+// A browse runs until its timeout passes. Its results are kept, newest first,
+// in mdns_browse_results until browse_results() takes them.
+static uint8_t browse_request_id = MDNS_MAX_REQUESTS;
+static uint64_t browse_end_ms;
+static size_t browse_count;
+// Set when there was no room for the latest result, so its other records are
+// skipped.
+static bool browse_dropping;
+
+static void stop_browse(void) {
+    if (browse_request_id < MDNS_MAX_REQUESTS) {
+        mdns_search_stop(browse_request_id);
+        browse_request_id = MDNS_MAX_REQUESTS;
     }
+}
 
-    return MP_OBJ_FROM_PTR(tuple);
+static void check_browse_timeout(void) {
+    if (supervisor_ticks_ms64() >= browse_end_ms) {
+        stop_browse();
+    }
 }
 
+static void browse_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
+    check_browse_timeout();
+    if (browse_request_id == MDNS_MAX_REQUESTS) {
+        return;
+    }
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
+        // This runs in the background, so drop the result instead of raising
+        // when the heap is full.
+        mdns_remoteservice_obj_t *service = m_malloc_maybe(sizeof(mdns_remoteservice_obj_t));
+        browse_dropping = service == NULL;
+        if (browse_dropping) {
+            return;
+        }
+        memset(service, 0, sizeof(mdns_remoteservice_obj_t));
+        service->base.type = &mdns_remoteservice_type;
+        service->next = MP_STATE_VM(mdns_browse_results);
+        MP_STATE_VM(mdns_browse_results) = MP_OBJ_FROM_PTR(service);
+        browse_count++;
+    }
+    if (browse_dropping || MP_STATE_VM(mdns_browse_results) == MP_OBJ_NULL) {
+        return;
+    }
+    copy_data_into_remote_service(answer, varpart, varlen, flags, MP_OBJ_TO_PTR(MP_STATE_VM(mdns_browse_results)));
+}
+
+void common_hal_mdns_server_browse(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
+    stop_browse();
+
+    enum mdns_sd_proto proto = DNSSD_PROTO_UDP;
+    if (strcmp(protocol, "_tcp") == 0) {
+        proto = DNSSD_PROTO_TCP;
+    }
+
+    browse_end_ms = supervisor_ticks_ms64() + (uint64_t)(timeout * 1000);
+    browse_dropping = false;
+    err_t err = mdns_search_service(NULL, service_type, proto,
+        NETIF_STA, &browse_result_cb, NULL,
+        &browse_request_id);
+    if (err != ERR_OK) {
+        browse_request_id = MDNS_MAX_REQUESTS;
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+    }
+}
+
+mp_obj_t common_hal_mdns_server_get_browse_results(mdns_server_obj_t *self) {
+    check_browse_timeout();
+    mdns_remoteservice_obj_t *head = MP_OBJ_TO_PTR(MP_STATE_VM(mdns_browse_results));
+    if (head == NULL) {
+        return mp_const_empty_tuple;
+    }
+    size_t count = browse_count;
+    MP_STATE_VM(mdns_browse_results) = MP_OBJ_NULL;
+    browse_count = 0;
+    return remote_services_tuple(head, count);
+}
+
+bool common_hal_mdns_server_get_browsing(mdns_server_obj_t *self) {
+    check_browse_timeout();
+    return browse_request_id < MDNS_MAX_REQUESTS;
+}
+
+void mdns_server_browse_reset(void) {
+    stop_browse();
+    MP_STATE_VM(mdns_browse_results) = MP_OBJ_NULL;
+    browse_count = 0;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t mdns_browse_results);
+
 static void srv_txt_cb(struct mdns_service *service, void *ptr) {
     mdns_server_obj_t *self = ptr;
     err_t res;
@@ -15,6 +15,9 @@
 #include "lib/crypto-algorithms/sha256.h"
 
 #include "hardware/structs/rosc.h"
+#ifdef PICO_RP2350
+#include "hardware/structs/trng.h"
+#endif
 
 #include <string.h>
 
@@ -61,6 +64,30 @@ mp_obj_t common_hal_os_uname(void) {
 #define RANDOM_SAFETY_MARGIN (4)
 
 static BYTE random_state[SHA256_BLOCK_SIZE];
+#ifdef PICO_RP2350
+// The RP2350 TRNG collects 192 bits at a time, much faster than reading
+// `rosc_hw->randombit` one bit at a time, so seed from it instead.
+static void seed_random_bits(BYTE out[SHA256_BLOCK_SIZE]) {
+    CRYAL_SHA256_CTX context;
+    sha256_init(&context);
+    trng_hw->rng_icr = 0xffffffff;
+    trng_hw->rnd_source_enable = TRNG_RND_SOURCE_ENABLE_BITS;
+    size_t remaining = 2 * RANDOM_SAFETY_MARGIN * SHA256_BLOCK_SIZE;
+    while (remaining > 0) {
+        while (!(trng_hw->trng_valid & TRNG_TRNG_VALID_BITS)) {
+        }
+        uint32_t ehr[MP_ARRAY_SIZE(trng_hw->ehr_data)];
+        for (size_t i = 0; i < MP_ARRAY_SIZE(ehr); i++) {
+            ehr[i] = trng_hw->ehr_data[i];
+        }
+        size_t n = MIN(remaining, sizeof(ehr));
+        sha256_update(&context, (BYTE *)ehr, n);
+        remaining -= n;
+    }
+    trng_hw->rnd_source_enable = 0;
+    sha256_final(&context, out);
+}
+#else
 static void seed_random_bits(BYTE out[SHA256_BLOCK_SIZE]) {
     CRYAL_SHA256_CTX context;
     sha256_init(&context);
@@ -75,6 +102,7 @@ static void seed_random_bits(BYTE out[SHA256_BLOCK_SIZE]) {
     }
     sha256_final(&context, out);
 }
+#endif
 
 static void get_random_bits(BYTE out[SHA256_BLOCK_SIZE]) {
     if (!random_state[0]++) {
@@ -140,11 +140,14 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
         mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("%q in use"), MP_QSTR_picodvi);
     }
 
-    if (!(width == 640 && height == 480) && !(width == 320 && height == 240 && (color_depth == 16 || color_depth == 8))) {
+    if (!(width == 640 && height == 480) && !(width == 640 && height == 240 && color_depth <= 8) && !(width == 320 && height == 240 && (color_depth == 16 || color_depth == 8))) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q and %q"), MP_QSTR_width, MP_QSTR_height);
     }
 
     bool pixel_doubled = width == 320 && height == 240;
+    // A half height framebuffer shows each row on two lines. Only the DMA
+    // commands differ, so it costs nothing at runtime and halves the RAM.
+    bool line_doubled = height == 240;
 
     size_t all_allocated = 0;
     int8_t pins[8] = {
@@ -285,11 +288,13 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
             self->dma_commands[command_word++] = count_of(vactive_line);
             self->dma_commands[command_word++] = (uintptr_t)vactive_line;
             size_t row = v_scanline - active_start;
+            if (line_doubled) {
+                row /= 2;
+            }
             size_t transfer_count = words_per_line;
             if (pixel_doubled) {
                 self->dma_commands[command_word++] = dma_pixel_ctrl;
                 self->dma_commands[command_word++] = dma_write_addr;
-                row /= 2;
                 // When pixel doubling, we do one transfer per pixel and it gets
                 // mirrored into the rest of the word.
                 transfer_count = self->width;
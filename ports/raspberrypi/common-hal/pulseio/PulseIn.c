@@ -14,6 +14,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/pulseio/PulseIn.h"
+#include "supervisor/shared/trace.h"
 
 #define NO_PIN 0xff
 #define MAX_PULSE 65535
@@ -88,39 +89,50 @@ void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self) {
     self->level_count = 0;
     self->paused = true;
 }
+static void _store_pulse(pulseio_pulsein_obj_t *self, uint32_t result) {
+    // Pulses that are longer than MAX_PULSE will return MAX_PULSE
+    if (result > MAX_PULSE) {
+        result = MAX_PULSE;
+    }
+    // return  pulses that are not too short
+    if (result > MIN_PULSE) {
+        size_t buf_index = (self->start + self->len) % self->maxlen;
+        self->buffer[buf_index] = (uint16_t)result;
+        trace_event(TRACE_EVENT_PULSE, result);
+        if (self->len < self->maxlen) {
+            self->len++;
+        } else {
+            self->start = (self->start + 1) % self->maxlen;
+        }
+    }
+}
+
 void common_hal_pulseio_pulsein_interrupt(void *self_in) {
     pulseio_pulsein_obj_t *self = self_in;
-
-    uint32_t rxfifo = 0;
-
-    rxfifo = pio_sm_get_blocking(self->state_machine.pio, self->state_machine.state_machine);
-    // translate from fifo to buffer
-    if ((rxfifo == 0 && self->last_level == false) || (rxfifo == 0xffffffff && self->last_level == true)) {
-        self->level_count = self->level_count + 32;
-    } else {
-        for (uint i = 0; i < 32; i++) {
-            bool level = (rxfifo & (1 << i)) >> i;
-            if (level == self->last_level) {
-                self->level_count++;
-            } else {
-                uint32_t result = self->level_count;
-                self->last_level = level;
-                self->level_count = 1;
-                // Pulses that are longer than MAX_PULSE will return MAX_PULSE
-                if (result > MAX_PULSE) {
-                    result = MAX_PULSE;
-                }
-                // return  pulses that are not too short
-                if (result > MIN_PULSE) {
-                    size_t buf_index = (self->start + self->len) % self->maxlen;
-                    self->buffer[buf_index] = (uint16_t)result;
-                    if (self->len < self->maxlen) {
-                        self->len++;
-                    } else {
-                        self->start = (self->start + 1) % self->maxlen;
-                    }
-                }
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+
+    // Empty the whole FIFO, so a slow interrupt doesn't leave the state machine stalled.
+    while (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+        // One sample per microsecond, oldest in bit 0. Walk the word a run of equal
+        // samples at a time rather than bit by bit.
+        uint32_t samples = pio_sm_get(pio, sm);
+        uint32_t remaining = 32;
+        while (remaining > 0) {
+            uint32_t changes = self->last_level ? ~samples : samples;
+            if (remaining < 32) {
+                changes &= (1u << remaining) - 1;
+            }
+            if (changes == 0) {
+                self->level_count += remaining;
+                break;
             }
+            uint32_t run = __builtin_ctz(changes);
+            _store_pulse(self, self->level_count + run);
+            self->last_level = !self->last_level;
+            self->level_count = 0;
+            samples >>= run;
+            remaining -= run;
         }
     }
 }
@@ -0,0 +1,301 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "common-hal/pwmio/PWMGroup.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/microcontroller/Processor.h"
+#include "shared-bindings/pwmio/PWMGroup.h"
+#include "shared-bindings/pwmio/PWMOut.h"
+
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+#include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_pwm/include/hardware/pwm.h"
+
+// Shared with PWMOut so that other users see the group's slices as busy.
+extern uint32_t target_slice_frequencies[NUM_PWM_SLICES];
+
+// As in PWMOut, a CC value of TOP + 1 is 100% duty cycle.
+#define MAX_TOP 65534
+
+static void pwmgroup_free_channels(const mcu_pin_obj_t **pins, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        pwmout_free(pwm_gpio_to_slice_num(pins[i]->number), pwm_gpio_to_channel(pins[i]->number));
+    }
+}
+
+// Converts a 16 bit duty cycle to a compare level and adds it to its slice's
+// CC word. A complementary pair's inverted B output turns on dead_counts
+// after A turns off, and off dead_counts before A turns on again.
+static void pwmgroup_add_level(pwmio_pwmgroup_obj_t *self, const pwmio_pwmgroup_channel_t *channel, uint16_t duty, uint32_t *cc) {
+    uint32_t full = (uint32_t)self->top + 1;
+    uint32_t level;
+    if (duty == 0xffff) {
+        level = full;
+    } else {
+        level = ((uint32_t)duty * full + 0x8000) >> 16;
+    }
+    if (channel->complement != NULL) {
+        uint32_t low_side = MIN(level + self->dead_counts, full);
+        cc[channel->slice] = level | (low_side << 16);
+    } else {
+        cc[channel->slice] |= level << (channel->ab_channel * 16);
+    }
+}
+
+void common_hal_pwmio_pwmgroup_construct(pwmio_pwmgroup_obj_t *self,
+    const mcu_pin_obj_t **pins, size_t num_pins, uint32_t frequency,
+    const uint16_t *phases, bool phase_correct, uint32_t dead_time_ns) {
+    bool complementary = dead_time_ns > 0;
+    size_t channel_count = complementary ? num_pins / 2 : num_pins;
+
+    // Check the pin layout before claiming anything.
+    uint16_t slice_phases[NUM_PWM_SLICES];
+    uint32_t slice_mask = 0;
+    for (size_t i = 0; i < channel_count; i++) {
+        const mcu_pin_obj_t *pin = pins[complementary ? 2 * i : i];
+        uint8_t slice = pwm_gpio_to_slice_num(pin->number);
+        uint8_t ab_channel = pwm_gpio_to_channel(pin->number);
+        const mcu_pin_obj_t *complement = NULL;
+        if (complementary) {
+            complement = pins[2 * i + 1];
+            if (ab_channel != 0 ||
+                pwm_gpio_to_slice_num(complement->number) != slice ||
+                pwm_gpio_to_channel(complement->number) != 1) {
+                mp_raise_ValueError(MP_ERROR_TEXT("Pins must share PWM slice"));
+            }
+        }
+        uint16_t phase = phases != NULL ? phases[i] : 0;
+        if (slice_mask & (1 << slice)) {
+            // The A and B outputs of a slice share its counter.
+            if (slice_phases[slice] != phase) {
+                mp_arg_error_invalid(MP_QSTR_phases);
+            }
+        } else {
+            slice_phases[slice] = phase;
+            slice_mask |= 1 << slice;
+        }
+        self->channels[i] = (pwmio_pwmgroup_channel_t) {
+            .pin = pin,
+            .complement = complement,
+            .slice = slice,
+            .ab_channel = ab_channel,
+            .duty_cycle = 0,
+        };
+    }
+
+    // All slices run from one divider and TOP so that they stay in step. A
+    // phase-correct counter counts up and back down, so it takes twice as
+    // many steps per period.
+    uint32_t system_clock = common_hal_mcu_processor_get_frequency();
+    uint32_t steps_per_count = phase_correct ? 2 : 1;
+    if (frequency == 0 || frequency > system_clock / (2 * steps_per_count)) {
+        mp_arg_error_invalid(MP_QSTR_frequency);
+    }
+    // Counts per period, in sixteenths to match the 8.4 fixed point divider.
+    uint64_t counts16 = (uint64_t)system_clock * 16 / ((uint64_t)frequency * steps_per_count);
+    uint32_t div16 = 16;
+    if (counts16 > (uint64_t)(MAX_TOP + 1) * 16) {
+        div16 = MIN((counts16 + MAX_TOP) / (MAX_TOP + 1), (1 << 12) - 1);
+    }
+    uint32_t top = MIN(counts16 / div16 - 1, MAX_TOP);
+    uint64_t count_rate16 = (uint64_t)system_clock * 16;
+    self->top = top;
+    self->actual_frequency = count_rate16 / ((uint64_t)div16 * (top + 1) * steps_per_count);
+    self->dead_counts = MIN((count_rate16 * dead_time_ns / div16 + 999999999) / 1000000000, top + 1);
+    self->phase_correct = phase_correct;
+    self->slice_mask = slice_mask;
+    self->dma_buffer = NULL;
+    self->dma_frames = 0;
+    for (size_t s = 0; s < NUM_PWM_SLICES; s++) {
+        self->dma_channels[s] = -1;
+    }
+
+    // Claiming a channel as variable frequency keeps PWMOut off its slice.
+    for (size_t i = 0; i < num_pins; i++) {
+        pwmout_result_t result = pwmout_allocate(pwm_gpio_to_slice_num(pins[i]->number),
+            pwm_gpio_to_channel(pins[i]->number), true, self->actual_frequency);
+        if (result != PWMOUT_OK) {
+            pwmgroup_free_channels(pins, i);
+            common_hal_pwmio_pwmout_raise_error(PWMOUT_INTERNAL_RESOURCES_IN_USE);
+        }
+    }
+    for (size_t i = 0; i < num_pins; i++) {
+        claim_pin(pins[i]);
+    }
+    self->channel_count = channel_count;
+
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if ((slice_mask & (1 << slice)) == 0) {
+            continue;
+        }
+        pwm_set_enabled(slice, false);
+        uint32_t csr = phase_correct ? PWM_CH0_CSR_PH_CORRECT_BITS : 0;
+        if (complementary) {
+            csr |= PWM_CH0_CSR_B_INV_BITS;
+        }
+        pwm_hw->slice[slice].csr = csr;
+        pwm_set_clkdiv_int_frac(slice, div16 / 16, div16 % 16);
+        pwm_set_wrap(slice, top);
+        pwm_hw->slice[slice].ctr = ((uint32_t)slice_phases[slice] * (top + 1)) >> 16;
+        target_slice_frequencies[slice] = self->actual_frequency;
+    }
+
+    uint16_t duty_cycles[PWMIO_PWMGROUP_MAX_CHANNELS] = { 0 };
+    common_hal_pwmio_pwmgroup_set_duty_cycles(self, duty_cycles);
+
+    // Connect to the pads last to avoid any glitches from changing settings.
+    for (size_t i = 0; i < num_pins; i++) {
+        gpio_set_function(pins[i]->number, GPIO_FUNC_PWM);
+    }
+    // Start every slice on the same cycle so that the phases hold.
+    hw_set_bits(&pwm_hw->en, slice_mask);
+}
+
+bool common_hal_pwmio_pwmgroup_deinited(pwmio_pwmgroup_obj_t *self) {
+    return self->channel_count == 0;
+}
+
+void common_hal_pwmio_pwmgroup_deinit(pwmio_pwmgroup_obj_t *self) {
+    if (common_hal_pwmio_pwmgroup_deinited(self)) {
+        return;
+    }
+    common_hal_pwmio_pwmgroup_stop(self);
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if (self->slice_mask & (1 << slice)) {
+            // PWMOut doesn't set these, so leave the slice as it found it.
+            pwm_hw->slice[slice].csr = 0;
+        }
+    }
+    for (size_t i = 0; i < self->channel_count; i++) {
+        pwmio_pwmgroup_channel_t *channel = &self->channels[i];
+        pwmout_free(channel->slice, channel->ab_channel);
+        reset_pin_number(channel->pin->number);
+        if (channel->complement != NULL) {
+            pwmout_free(channel->slice, 1);
+            reset_pin_number(channel->complement->number);
+        }
+    }
+    self->channel_count = 0;
+}
+
+size_t common_hal_pwmio_pwmgroup_get_channel_count(pwmio_pwmgroup_obj_t *self) {
+    return self->channel_count;
+}
+
+uint32_t common_hal_pwmio_pwmgroup_get_frequency(pwmio_pwmgroup_obj_t *self) {
+    return self->actual_frequency;
+}
+
+uint16_t common_hal_pwmio_pwmgroup_get_duty_cycle(pwmio_pwmgroup_obj_t *self, size_t channel) {
+    return self->channels[channel].duty_cycle;
+}
+
+void common_hal_pwmio_pwmgroup_set_duty_cycles(pwmio_pwmgroup_obj_t *self, const uint16_t *duty_cycles) {
+    common_hal_pwmio_pwmgroup_stop(self);
+    uint32_t cc[NUM_PWM_SLICES] = { 0 };
+    for (size_t i = 0; i < self->channel_count; i++) {
+        self->channels[i].duty_cycle = duty_cycles[i];
+        pwmgroup_add_level(self, &self->channels[i], duty_cycles[i], cc);
+    }
+    // CC is double buffered, so the new levels all start at the next wrap.
+    common_hal_mcu_disable_interrupts();
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if (self->slice_mask & (1 << slice)) {
+            pwm_hw->slice[slice].cc = cc[slice];
+        }
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+void common_hal_pwmio_pwmgroup_play(pwmio_pwmgroup_obj_t *self, const uint16_t *frames, size_t frame_count) {
+    common_hal_pwmio_pwmgroup_stop(self);
+
+    size_t slice_count = __builtin_popcount(self->slice_mask);
+    uint32_t *buffer = m_malloc(frame_count * slice_count * sizeof(uint32_t));
+    memset(buffer, 0, frame_count * slice_count * sizeof(uint32_t));
+
+    // One run of CC words per slice, so that each slice's DMA channel reads
+    // its own levels in order.
+    uint32_t *slice_words[NUM_PWM_SLICES];
+    uint32_t dma_mask = 0;
+    size_t k = 0;
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if ((self->slice_mask & (1 << slice)) == 0) {
+            continue;
+        }
+        slice_words[slice] = buffer + k * frame_count;
+        k++;
+        int channel = dma_claim_unused_channel(false);
+        if (channel < 0) {
+            common_hal_pwmio_pwmgroup_stop(self);
+            common_hal_pwmio_pwmout_raise_error(PWMOUT_INTERNAL_RESOURCES_IN_USE);
+        }
+        self->dma_channels[slice] = channel;
+        dma_mask |= 1 << channel;
+    }
+
+    uint32_t cc[NUM_PWM_SLICES];
+    for (size_t f = 0; f < frame_count; f++) {
+        memset(cc, 0, sizeof(cc));
+        for (size_t i = 0; i < self->channel_count; i++) {
+            pwmgroup_add_level(self, &self->channels[i], frames[f * self->channel_count + i], cc);
+        }
+        for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+            if (self->slice_mask & (1 << slice)) {
+                slice_words[slice][f] = cc[slice];
+            }
+        }
+    }
+    // The outputs are left at the last frame.
+    for (size_t i = 0; i < self->channel_count; i++) {
+        self->channels[i].duty_cycle = frames[(frame_count - 1) * self->channel_count + i];
+    }
+
+    self->dma_buffer = buffer;
+    self->dma_frames = frame_count;
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if ((self->slice_mask & (1 << slice)) == 0) {
+            continue;
+        }
+        int channel = self->dma_channels[slice];
+        dma_channel_config c = dma_channel_get_default_config(channel);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        // Each slice asks for its next word when its counter wraps.
+        channel_config_set_dreq(&c, pwm_get_dreq(slice));
+        dma_channel_configure(channel, &c, &pwm_hw->slice[slice].cc, slice_words[slice], frame_count, false);
+    }
+    dma_start_channel_mask(dma_mask);
+}
+
+bool common_hal_pwmio_pwmgroup_get_playing(pwmio_pwmgroup_obj_t *self) {
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if (self->dma_channels[slice] >= 0 && dma_channel_is_busy(self->dma_channels[slice])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void common_hal_pwmio_pwmgroup_stop(pwmio_pwmgroup_obj_t *self) {
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        int channel = self->dma_channels[slice];
+        if (channel < 0) {
+            continue;
+        }
+        dma_channel_abort(channel);
+        dma_channel_unclaim(channel);
+        self->dma_channels[slice] = -1;
+    }
+    self->dma_buffer = NULL;
+    self->dma_frames = 0;
+}
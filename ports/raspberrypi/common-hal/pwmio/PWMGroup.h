@@ -0,0 +1,40 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/microcontroller/Pin.h"
+
+#include "py/obj.h"
+
+#include "src/rp2040/hardware_regs/include/hardware/platform_defs.h"
+
+#define PWMIO_PWMGROUP_MAX_CHANNELS (NUM_PWM_SLICES * 2)
+
+typedef struct {
+    const mcu_pin_obj_t *pin;
+    // The low side of a complementary pair, on the B output of the same slice.
+    const mcu_pin_obj_t *complement;
+    uint8_t slice;
+    uint8_t ab_channel;
+    uint16_t duty_cycle;
+} pwmio_pwmgroup_channel_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    pwmio_pwmgroup_channel_t channels[PWMIO_PWMGROUP_MAX_CHANNELS];
+    // Words to DMA into each used slice's CC register, one per period.
+    uint32_t *dma_buffer;
+    size_t dma_frames;
+    uint32_t slice_mask;
+    uint32_t actual_frequency;
+    uint16_t top;
+    // Gap between a complementary pair's edges, in counter steps.
+    uint16_t dead_counts;
+    uint8_t channel_count;
+    bool phase_correct;
+    int8_t dma_channels[NUM_PWM_SLICES];
+} pwmio_pwmgroup_obj_t;
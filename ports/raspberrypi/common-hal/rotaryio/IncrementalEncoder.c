@@ -13,6 +13,8 @@
 #include "bindings/rp2pio/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
 
+#include "src/rp2_common/hardware_timer/include/hardware/timer.h"
+
 static const uint16_t encoder[] = {
     //  again:
     //      in pins, 2
@@ -39,6 +41,11 @@ static const uint16_t encoder_init[] = {
 
 static void incrementalencoder_interrupt_handler(void *self_in);
 
+// Timestamp edges with the microsecond timer rather than the 1/1024s tick.
+uint64_t shared_module_softencoder_timestamp_ns(void) {
+    return time_us_64() * 1000;
+}
+
 void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencoder_obj_t *self,
     const mcu_pin_obj_t *pin_a, const mcu_pin_obj_t *pin_b) {
     const mcu_pin_obj_t *pins[] = { pin_a, pin_b };
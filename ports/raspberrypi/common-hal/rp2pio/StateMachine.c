@@ -13,6 +13,7 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/memorymap/AddressRange.h"
+#include "shared-bindings/time/__init__.h"
 
 #include "src/rp2040/hardware_regs/include/hardware/platform_defs.h"
 #include "src/rp2_common/hardware_clocks/include/hardware/clocks.h"
@@ -33,6 +34,10 @@ static uint8_t _pin_reference_count[NUM_BANK0_GPIOS];
 static uint32_t _current_program_id[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 static uint8_t _current_program_offset[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 static uint8_t _current_program_len[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+// Unrelocated copy of each loaded program, at its offset. Instruction memory is write only, so
+// this is how a new StateMachine finds that its program is already loaded.
+static uint16_t _loaded_instructions[NUM_PIOS][32];
+static uint32_t _next_program_id;
 static bool _never_reset[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 
 static uint32_t _current_pins[NUM_PIOS];
@@ -244,6 +249,10 @@ static int compute_fifo_depth(enum pio_fifo_join join) {
     return 4;
 }
 
+static bool program_is_loaded(size_t pio_index, uint8_t offset, const uint16_t *program, size_t program_len) {
+    return memcmp(&_loaded_instructions[pio_index][offset], program, program_len * sizeof(uint16_t)) == 0;
+}
+
 bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     const uint16_t *program, size_t program_len,
     size_t frequency,
@@ -267,8 +276,9 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     int fifo_type,
     int mov_status_type, int mov_status_n
     ) {
-    // Create a program id that isn't the pointer so we can store it without storing the original object.
-    uint32_t program_id = ~((uint32_t)program);
+    // State machines running the same loaded program share its id. Programs are matched by
+    // contents, so separate but identical program buffers share instruction memory too.
+    uint32_t program_id = 0;
 
     // Next, find a PIO and state machine to use.
     size_t pio_index = NUM_PIOS;
@@ -282,10 +292,12 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
         PIO pio = pio_instances[i];
         uint8_t free_count = 0;
         for (size_t j = 0; j < NUM_PIO_STATE_MACHINES; j++) {
-            if (_current_program_id[i][j] == program_id &&
+            if (_current_program_id[i][j] != 0 &&
                 _current_program_len[i][j] == program_len &&
-                (offset == -1 || offset == _current_program_offset[i][j])) {
+                (offset == -1 || offset == _current_program_offset[i][j]) &&
+                program_is_loaded(i, _current_program_offset[i][j], program, program_len)) {
                 program_offset = _current_program_offset[i][j];
+                program_id = _current_program_id[i][j];
             }
             if (!pio_sm_is_claimed(pio, j)) {
                 free_count++;
@@ -300,6 +312,7 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
         // Reset program offset if we weren't able to find a free state machine
         // on that PIO. (We would have broken the loop otherwise.)
         program_offset = 32;
+        program_id = 0;
     }
 
     size_t state_machine = NUM_PIO_STATE_MACHINES;
@@ -324,6 +337,11 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     self->state_machine = state_machine;
     if (program_offset == 32) {
         program_offset = add_program(self->pio, &program_struct, offset);
+        memcpy(&_loaded_instructions[pio_index][program_offset], program, program_len * sizeof(uint16_t));
+        do {
+            _next_program_id++;
+        } while (_next_program_id == 0);
+        program_id = _next_program_id;
     }
     self->offset = program_offset;
     _current_program_id[pio_index][state_machine] = program_id;
@@ -1319,6 +1337,7 @@ bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *s
 
     self->pending_buffers_read = pending_buffers_read;
     self->dma_completed_read = false;
+    self->read_overruns = 0;
 
     self->background_stride_in_bytes = stride_in_bytes;
     self->byteswap = swap;
@@ -1348,6 +1367,11 @@ bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *s
 }
 
 void rp2pio_statemachine_dma_complete_read(rp2pio_statemachine_obj_t *self, int channel_read) {
+    self->last_read_time = common_hal_time_monotonic_ns();
+    if (self->switched_read_buffers) {
+        // Nobody fetched the previous buffer before this one was filled.
+        self->read_overruns++;
+    }
 
     self->current_read_buf = self->next_read_buf_1;
     self->next_read_buf_1 = self->next_read_buf_2;
@@ -1419,6 +1443,14 @@ mp_obj_t common_hal_rp2pio_statemachine_get_last_read(rp2pio_statemachine_obj_t
     return mp_const_empty_bytes;
 }
 
+uint64_t common_hal_rp2pio_statemachine_get_last_read_time(rp2pio_statemachine_obj_t *self) {
+    return self->last_read_time;
+}
+
+uint32_t common_hal_rp2pio_statemachine_get_read_overruns(rp2pio_statemachine_obj_t *self) {
+    return self->read_overruns;
+}
+
 mp_obj_t common_hal_rp2pio_statemachine_get_last_write(rp2pio_statemachine_obj_t *self) {
     if (self->switched_write_buffers) {
         self->switched_write_buffers = false;
@@ -65,6 +65,10 @@ typedef struct {
     int background_stride_in_bytes;
     bool dma_completed_write, byteswap;
     bool dma_completed_read;
+    // time.monotonic_ns() when the most recent background read buffer was filled.
+    uint64_t last_read_time;
+    // Background read buffers that were filled again before last_read fetched them.
+    uint32_t read_overruns;
     #if PICO_PIO_VERSION > 0
     memorymap_addressrange_obj_t rxfifo_obj;
     #endif
@@ -13,6 +13,7 @@
 #include "py/gc.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
+#include "py/objarray.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 #include "shared-bindings/socketpool/SocketPool.h"
@@ -410,9 +411,8 @@ static mp_uint_t lwip_raw_udp_send(socketpool_socket_obj_t *socket, const byte *
     return len;
 }
 
-// Helper function for recv/recvfrom to handle raw/UDP packets
-static mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf, mp_uint_t len, mp_obj_t *peer_out, int *_errno) {
-
+// Waits for a raw/UDP packet. Returns 1 when one is waiting and -1 on error.
+static int lwip_raw_udp_wait_for_data(socketpool_socket_obj_t *socket, int *_errno) {
     if (socket->incoming.pbuf == NULL) {
         if (socket->timeout == 0) {
             // Non-blocking socket.
@@ -430,6 +430,14 @@ static mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
             poll_sockets();
         }
     }
+    return 1;
+}
+
+// Helper function for recv/recvfrom to handle raw/UDP packets
+static mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf, mp_uint_t len, mp_obj_t *peer_out, int *_errno) {
+    if (lwip_raw_udp_wait_for_data(socket, _errno) < 0) {
+        return -1;
+    }
 
     if (peer_out != NULL) {
         *peer_out = socketpool_ip_addr_and_port_to_tuple(&socket->peer, socket->peer_port);
@@ -546,10 +554,15 @@ static mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
     return write_len;
 }
 
-// Helper function for recv/recvfrom to handle TCP packets
-static mp_uint_t lwip_tcp_receive(socketpool_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
+// Waits for TCP data. Returns 1 when data is waiting, 0 at the end of the
+// stream and -1 on error.
+static int lwip_tcp_wait_for_data(socketpool_socket_obj_t *socket, int *_errno) {
     // Check for any pending errors
-    STREAM_ERROR_CHECK(socket);
+    if (socket->state < 0) {
+        *_errno = error_lookup_table[-socket->state];
+        return -1;
+    }
+    assert(socket->pcb.tcp);
 
     if (socket->incoming.pbuf == NULL) {
 
@@ -585,6 +598,15 @@ static mp_uint_t lwip_tcp_receive(socketpool_socket_obj_t *socket, byte *buf, mp
             return -1;
         }
     }
+    return 1;
+}
+
+// Helper function for recv/recvfrom to handle TCP packets
+static mp_uint_t lwip_tcp_receive(socketpool_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
+    int ready = lwip_tcp_wait_for_data(socket, _errno);
+    if (ready <= 0) {
+        return ready < 0 ? MP_STREAM_ERROR : 0;
+    }
 
     MICROPY_PY_LWIP_ENTER
 
@@ -686,6 +708,8 @@ bool socketpool_socket(socketpool_socketpool_obj_t *self,
 
     socket->timeout = -1;
     socket->recv_offset = 0;
+    socket->held_pbuf = NULL;
+    socket->held_view = MP_OBJ_NULL;
     socket->domain = SOCKETPOOL_AF_INET;
     socket->type = type;
     socket->callback = MP_OBJ_NULL;
@@ -827,6 +851,8 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, mp_obj_t *peer_out,
     accepted->timeout = self->timeout;
     accepted->state = STATE_CONNECTED;
     accepted->recv_offset = 0;
+    accepted->held_pbuf = NULL;
+    accepted->held_view = MP_OBJ_NULL;
     accepted->callback = MP_OBJ_NULL;
     tcp_arg(accepted->pcb.tcp, (void *)accepted);
     tcp_err(accepted->pcb.tcp, _lwip_tcp_error);
@@ -914,8 +940,29 @@ static err_t _lwip_tcp_close_poll(void *arg, struct tcp_pcb *pcb) {
     return ERR_OK;
 }
 
+// A memoryview lent by recv_buffer(). It keeps the socket, and so the pbuf it
+// holds, alive for as long as the view is reachable.
+typedef struct {
+    mp_obj_array_t view;
+    socketpool_socket_obj_t *socket;
+} socketpool_held_view_t;
+
+// Frees the pbuf lent by recv_buffer() without touching its view.
+static void drop_held_buffer(socketpool_socket_obj_t *socket) {
+    MICROPY_PY_LWIP_ENTER
+    if (socket->held_pbuf != NULL) {
+        pbuf_free(socket->held_pbuf);
+        socket->held_pbuf = NULL;
+    }
+    MICROPY_PY_LWIP_EXIT
+    socket->held_view = MP_OBJ_NULL;
+}
+
 void socketpool_socket_close(socketpool_socket_obj_t *socket) {
     unregister_open_socket(socket);
+    // This is also the finaliser, which only runs once the view is garbage
+    // too, so the view is left alone.
+    drop_held_buffer(socket);
     MICROPY_PY_LWIP_ENTER
     if (socket->pcb.tcp == NULL) { // already closed
         MICROPY_PY_LWIP_EXIT
@@ -1143,6 +1190,72 @@ mp_uint_t common_hal_socketpool_socket_recv_into(socketpool_socket_obj_t *self,
     return received;
 }
 
+mp_obj_t common_hal_socketpool_socket_recv_buffer(socketpool_socket_obj_t *self) {
+    common_hal_socketpool_socket_release_buffer(self);
+
+    int _errno = 0;
+    int ready;
+    if (self->type == SOCKETPOOL_SOCK_STREAM) {
+        ready = lwip_tcp_wait_for_data(self, &_errno);
+    } else {
+        ready = lwip_raw_udp_wait_for_data(self, &_errno);
+    }
+    if (ready < 0) {
+        mp_raise_OSError(_errno);
+    }
+    if (ready == 0) {
+        return mp_obj_new_memoryview('B', 0, NULL);
+    }
+    // Allocated before the pbuf is taken, so running out of memory loses no data.
+    socketpool_held_view_t *view = m_new_obj(socketpool_held_view_t);
+
+    MICROPY_PY_LWIP_ENTER
+
+    struct pbuf *p = self->incoming.pbuf;
+    mp_uint_t offset = 0;
+    if (self->type == SOCKETPOOL_SOCK_STREAM) {
+        // Take the first pbuf and leave the rest of the chain queued.
+        struct pbuf *next = p->next;
+        if (next != NULL) {
+            // pbuf_dechain() drops the reference p held on next.
+            pbuf_ref(next);
+            pbuf_dechain(p);
+        }
+        self->incoming.pbuf = next;
+        offset = self->recv_offset;
+        self->recv_offset = 0;
+        tcp_recved(self->pcb.tcp, p->len - offset);
+    } else {
+        self->incoming.pbuf = NULL;
+        if (p->next != NULL) {
+            // A datagram split across pbufs has to be copied to be contiguous.
+            // On failure the chain is returned unchanged.
+            p = pbuf_coalesce(p, PBUF_RAW);
+        }
+    }
+    self->held_pbuf = p;
+
+    MICROPY_PY_LWIP_EXIT
+
+    if (p->next != NULL) {
+        common_hal_socketpool_socket_release_buffer(self);
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    mp_obj_memoryview_init(&view->view, 'B', 0, p->len - offset, (uint8_t *)p->payload + offset);
+    view->socket = self;
+    self->held_view = MP_OBJ_FROM_PTR(view);
+    return self->held_view;
+}
+
+void common_hal_socketpool_socket_release_buffer(socketpool_socket_obj_t *self) {
+    if (self->held_view != MP_OBJ_NULL) {
+        // Empty the view so that it can't read the pbuf once it is freed.
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(self->held_view);
+        view->len = 0;
+    }
+    drop_held_buffer(self);
+}
+
 int socketpool_socket_send(socketpool_socket_obj_t *socket, const uint8_t *buf, uint32_t len) {
     mp_uint_t ret = 0;
     int _errno = 0;
@@ -1199,6 +1312,25 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *socket,
     return ret;
 }
 
+size_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *socket,
+    const char *host, size_t hostlen, uint32_t port, const mp_obj_t *buffers, size_t count) {
+    if (socket->type == SOCKETPOOL_SOCK_STREAM) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+    int _errno;
+    ip_addr_t ip;
+    socketpool_resolve_host_raise(host, &ip);
+
+    for (size_t i = 0; i < count; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_READ);
+        if (lwip_raw_udp_send(socket, bufinfo.buf, bufinfo.len, &ip, port, &_errno) == (unsigned)-1) {
+            mp_raise_OSError(_errno);
+        }
+    }
+    return count;
+}
+
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms) {
     self->timeout = timeout_ms;
 }
@@ -1285,6 +1417,8 @@ bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
 }
 
 void socketpool_socket_move(socketpool_socket_obj_t *self, socketpool_socket_obj_t *sock) {
+    // The view would still keep the old socket object alive, not the new one.
+    common_hal_socketpool_socket_release_buffer(self);
     *sock = *self;
     self->state = _ERR_BADF;
 
@@ -1310,5 +1444,7 @@ void socketpool_socket_reset(socketpool_socket_obj_t *self) {
     }
     self->base.type = &socketpool_socket_type;
     self->pcb.tcp = NULL;
+    self->held_pbuf = NULL;
+    self->held_view = MP_OBJ_NULL;
     self->state = _ERR_BADF;
 }
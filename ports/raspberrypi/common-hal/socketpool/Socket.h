@@ -39,6 +39,10 @@ typedef struct _lwip_socket_obj_t {
     mp_uint_t peer_port;
     mp_uint_t timeout;
     uint16_t recv_offset;
+    // Received data lent to Python by recv_buffer(), until it is released,
+    // and the memoryview it was lent through.
+    struct pbuf *held_pbuf;
+    mp_obj_t held_view;
 
     uint8_t domain;
     uint8_t type;
@@ -107,6 +107,105 @@ void common_hal_wifi_radio_set_tx_power(wifi_radio_obj_t *self, const mp_float_t
     cyw43_ioctl(&cyw43_state, CYW43_IOCTL_SET_VAR, 9 + 4, buf, CYW43_ITF_AP);
 }
 
+// Fields of the cyw43 power management value, see cyw43.set_power_management().
+#define PM_MODE(value) ((value) & 0xf)
+#define PM_SLEEP_RET(value) (((value) >> 4) & 0xff)
+#define PM_DTIM(value) (((value) >> 16) & 0xf)
+#define PM_ASSOC(value) (((value) >> 20) & 0xf)
+
+mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self) {
+    int value = bindings_cyw43_get_power_management();
+    if (PM_MODE(value) == CYW43_NO_POWERSAVE_MODE) {
+        return 0;
+    }
+    return PM_DTIM(value);
+}
+
+void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, const mp_int_t listen_interval) {
+    // Match the Espressif port: 0 turns power saving off, 1 is MIN and more is MAX.
+    if (listen_interval <= 0) {
+        bindings_cyw43_set_power_management(PM_DISABLED);
+        return;
+    }
+    int value = listen_interval == 1 ? PM_STANDARD : PM_AGGRESSIVE;
+    int dtim = MIN(listen_interval, 15);
+    // The access point must buffer frames for at least as long as we sleep.
+    // The new interval is sent to it at the next association.
+    int assoc = MAX(PM_ASSOC(value), dtim);
+    value = (value & ~0xff0000) | assoc << 20 | dtim << 16;
+    bindings_cyw43_set_power_management(value);
+}
+
+wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self) {
+    int value = bindings_cyw43_get_power_management();
+    switch (PM_MODE(value)) {
+        case CYW43_NO_POWERSAVE_MODE:
+            return POWER_MANAGEMENT_NONE;
+        case CYW43_PM1_POWERSAVE_MODE:
+            return POWER_MANAGEMENT_MAX;
+        case CYW43_PM2_POWERSAVE_MODE:
+            return PM_SLEEP_RET(value) >= PM_SLEEP_RET(PM_AGGRESSIVE) ? POWER_MANAGEMENT_MAX : POWER_MANAGEMENT_MIN;
+        default:
+            return POWER_MANAGEMENT_UNKNOWN;
+    }
+}
+
+void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management) {
+    switch (power_management) {
+        case POWER_MANAGEMENT_MIN:
+            bindings_cyw43_set_power_management(PM_STANDARD);
+            break;
+        case POWER_MANAGEMENT_MAX:
+            bindings_cyw43_set_power_management(PM_AGGRESSIVE);
+            break;
+        default:
+            bindings_cyw43_set_power_management(PM_DISABLED);
+            break;
+    }
+}
+
+static void stay_awake_done(void *arg) {
+    wifi_radio_obj_t *self = arg;
+    self->stay_awake_alarm = 0;
+    bindings_cyw43_wifi_set_stay_awake(false);
+}
+
+static int64_t stay_awake_alarm(alarm_id_t id, void *arg) {
+    wifi_radio_obj_t *self = arg;
+    background_callback_add(&self->stay_awake_callback, stay_awake_done, self);
+    return 0;
+}
+
+void common_hal_wifi_radio_stay_awake(wifi_radio_obj_t *self, uint32_t duration_ms) {
+    if (self->stay_awake_alarm > 0) {
+        cancel_alarm(self->stay_awake_alarm);
+        self->stay_awake_alarm = 0;
+    }
+    if (duration_ms == 0) {
+        bindings_cyw43_wifi_set_stay_awake(false);
+        return;
+    }
+    bindings_cyw43_wifi_set_stay_awake(true);
+    self->stay_awake_alarm = add_alarm_in_ms(duration_ms, stay_awake_alarm, self, true);
+}
+
+uint64_t common_hal_wifi_radio_get_awake_time_ms(wifi_radio_obj_t *self) {
+    return bindings_cyw43_get_awake_time_ms();
+}
+
+uint32_t common_hal_wifi_radio_get_beacon_timeouts(wifi_radio_obj_t *self) {
+    // The CYW43 driver doesn't report beacon loss.
+    return 0;
+}
+
+void wifi_radio_reset_power_management(wifi_radio_obj_t *self) {
+    if (self->stay_awake_alarm > 0) {
+        cancel_alarm(self->stay_awake_alarm);
+        self->stay_awake_alarm = 0;
+    }
+    bindings_cyw43_reset_power_management();
+}
+
 mp_obj_t common_hal_wifi_radio_get_mac_address_ap(wifi_radio_obj_t *self) {
     return common_hal_wifi_radio_get_mac_address(self);
 }
@@ -10,6 +10,9 @@
 
 #include "shared-bindings/wifi/ScannedNetworks.h"
 #include "shared-bindings/wifi/Network.h"
+#include "supervisor/background_callback.h"
+
+#include "pico/time.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -18,6 +21,12 @@ typedef struct {
     uint8_t connected_ssid[32];
     uint8_t connected_ssid_len;
     bool enabled;
+    // Ends a stay_awake() period. The alarm fires in an interrupt, so it
+    // queues the callback to talk to the radio.
+    alarm_id_t stay_awake_alarm;
+    background_callback_t stay_awake_callback;
 } wifi_radio_obj_t;
 
+void wifi_radio_reset_power_management(wifi_radio_obj_t *self);
+
 extern void common_hal_wifi_radio_gc_collect(wifi_radio_obj_t *self);
@@ -64,6 +64,7 @@ void wifi_reset(void) {
     common_hal_wifi_monitor_deinit(MP_STATE_VM(wifi_monitor_singleton));
     common_hal_wifi_radio_obj.current_scan = NULL;
     common_hal_wifi_radio_set_enabled(&common_hal_wifi_radio_obj, false);
+    wifi_radio_reset_power_management(&common_hal_wifi_radio_obj);
     supervisor_workflow_request_background();
 }
 
@@ -33,6 +33,12 @@
 
 #define CIRCUITPY_PROCESSOR_COUNT           (2)
 
+// Whole rows of a 320 pixel wide, 16 bit display per bus write.
+#define CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE (4 * 320 * 2)
+
+// binascii.crc32 and crc_hqx use the DMA sniffer, see mphalport.c
+#define MICROPY_PY_BINASCII_CRC_HW          (1)
+
 #if CIRCUITPY_USB_HOST
 #define CIRCUITPY_USB_HOST_INSTANCE 1
 #endif
@@ -40,6 +46,12 @@
 // This also includes mpconfigboard.h.
 #include "py/circuitpy_mpconfig.h"
 
+// Bytes at the end of flash that are left out of CIRCUITPY and exposed as
+// storage.Partition instead. Boards set this in mpconfigboard.h.
+#ifndef CIRCUITPY_STORAGE_PARTITION_SIZE
+#define CIRCUITPY_STORAGE_PARTITION_SIZE (0)
+#endif
+
 #if CIRCUITPY_CYW43
 #define MICROPY_PY_LWIP_ENTER   cyw43_arch_lwip_begin();
 #define MICROPY_PY_LWIP_REENTER MICROPY_PY_LWIP_ENTER
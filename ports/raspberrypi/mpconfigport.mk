@@ -4,12 +4,14 @@ LONGINT_IMPL = MPZ
 CIRCUITPY_OPTIMIZE_PROPERTY_FLASH_SIZE ?= 1
 # CYW43 support does not provide settable MAC addresses for station or AP.
 CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS = 0
+CIRCUITPY_WIFI_RADIO_SETTABLE_LISTEN_INTERVAL = 1
 
 CIRCUITPY_RP2PIO ?= 1
 CIRCUITPY_NEOPIXEL_WRITE ?= $(CIRCUITPY_RP2PIO)
 CIRCUITPY_FLOPPYIO ?= 1
 CIRCUITPY_FRAMEBUFFERIO ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_FULL_BUILD ?= 1
+CIRCUITPY_GNSSIO ?= 1
 CIRCUITPY_AUDIOMP3 ?= 1
 CIRCUITPY_BITOPS ?= 1
 CIRCUITPY_HASHLIB ?= 1
@@ -18,9 +20,11 @@ CIRCUITPY_IMAGECAPTURE ?= 1
 CIRCUITPY_MAX3421E ?= 0
 CIRCUITPY_MEMORYMAP ?= 1
 CIRCUITPY_PWMIO ?= 1
+CIRCUITPY_PWMIO_PWMGROUP ?= $(CIRCUITPY_PWMIO)
 CIRCUITPY_RGBMATRIX ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_ROTARYIO ?= 1
 CIRCUITPY_ROTARYIO_SOFTENCODER = 1
+CIRCUITPY_STORAGE_PARTITION ?= 1
 CIRCUITPY_SYNTHIO_MAX_CHANNELS = 24
 CIRCUITPY_USB_HOST ?= 1
 CIRCUITPY_USB_VIDEO ?= 1
@@ -30,6 +34,7 @@ CIRCUITPY_FREQUENCYIO = 0
 
 # Use PWM internally
 CIRCUITPY_I2CTARGET = 1
+CIRCUITPY_I2CTARGET_REGISTERS ?= $(CIRCUITPY_I2CTARGET)
 CIRCUITPY_NVM = 1
 # Use PIO internally
 CIRCUITPY_PULSEIO ?= 1
@@ -67,6 +72,16 @@ CIRCUITPY_TOUCHIO = 0
 
 # Audio effects
 CIRCUITPY_AUDIOEFFECTS ?= 1
+
+# hashlib's sha256 uses the SHA-256 engine
+CIRCUITPY_HASHLIB_SHA256_HW ?= $(CIRCUITPY_HASHLIB_MBEDTLS)
+
+# The Cortex-M33 has the DWT cycle counter. The RP2040's Cortex-M0+ doesn't.
+CIRCUITPY_PERF_COUNTERS ?= 1
+
+# Both the Cortex-M33 and Hazard3 multiply 32 x 32 -> 64 bits quickly, which
+# the RP2040's Cortex-M0+ can't.
+MPZ_DIG_SIZE ?= 32
 endif
 
 INTERNAL_LIBM = 1
@@ -20,6 +20,7 @@
 #include "supervisor/shared/tick.h"
 
 #include "src/rp2_common/hardware_timer/include/hardware/timer.h"
+#include "hardware/dma.h"
 
 extern uint32_t common_hal_mcu_processor_get_frequency(void);
 
@@ -34,3 +35,58 @@ void mp_hal_disable_all_interrupts(void) {
 void mp_hal_enable_all_interrupts(void) {
     common_hal_mcu_enable_interrupts();
 }
+
+#if MICROPY_PY_BINASCII_CRC_HW
+// binascii CRCs are computed by the DMA sniffer while a channel copies the
+// data into a byte that is never read.
+static uint8_t crc_dma_sink;
+
+static bool crc_dma(uint mode, uint32_t *accumulator, const void *data, size_t len) {
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        return false;
+    }
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_sniff_enable(&c, true);
+    dma_sniffer_set_data_accumulator(*accumulator);
+    dma_sniffer_enable(channel, mode, true);
+    dma_channel_configure(channel, &c, &crc_dma_sink, data, len, true);
+    dma_channel_wait_for_finish_blocking(channel);
+    *accumulator = dma_sniffer_get_data_accumulator();
+    dma_sniffer_disable();
+    dma_channel_unclaim(channel);
+    return true;
+}
+
+static uint32_t bit_reverse(uint32_t x) {
+    uint32_t result = 0;
+    for (size_t i = 0; i < 32; i++) {
+        result = (result << 1) | (x & 1);
+        x >>= 1;
+    }
+    return result;
+}
+
+bool mp_hal_crc32(uint32_t *crc, const void *data, size_t len) {
+    // The sniffer keeps the CRC unreflected, and reflects the data when it
+    // is in the CRC32R mode. binascii.crc32 values are reflected and inverted.
+    uint32_t accumulator = bit_reverse(~*crc);
+    if (!crc_dma(DMA_SNIFF_CTRL_CALC_VALUE_CRC32R, &accumulator, data, len)) {
+        return false;
+    }
+    *crc = ~bit_reverse(accumulator);
+    return true;
+}
+
+bool mp_hal_crc_hqx(uint16_t *crc, const void *data, size_t len) {
+    uint32_t accumulator = *crc;
+    if (!crc_dma(DMA_SNIFF_CTRL_CALC_VALUE_CRC16, &accumulator, data, len)) {
+        return false;
+    }
+    *crc = accumulator & 0xffff;
+    return true;
+}
+#endif
@@ -0,0 +1,81 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// hashlib's SHA-256 engine on RP2350.
+
+#include <string.h>
+
+#include "shared-module/hashlib/__init__.h"
+
+#include "hardware/dma.h"
+#include "hardware/resets.h"
+#include "hardware/sha256.h"
+
+#if CIRCUITPY_HASHLIB_SHA256_HW
+
+// Below this, setting up a DMA channel costs more than writing the words.
+#define SHA256_HW_DMA_MIN_LEN (256)
+
+const char hashlib_sha256_hw_name[] = "rp2350";
+
+static bool sha256_hw_in_use;
+
+bool hashlib_sha256_hw_start(void) {
+    if (sha256_hw_in_use) {
+        return false;
+    }
+    sha256_hw_in_use = true;
+    unreset_block_wait(RESETS_RESET_SHA256_BITS);
+    // Feed the message in memory order, a word at a time.
+    sha256_set_bswap(true);
+    sha256_set_dma_size(4);
+    sha256_start();
+    return true;
+}
+
+static void sha256_hw_update_cpu(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i += 64) {
+        sha256_wait_ready_blocking();
+        for (size_t j = 0; j < 64; j += 4) {
+            uint32_t word;
+            memcpy(&word, data + i + j, sizeof(word));
+            sha256_put_word(word);
+        }
+    }
+}
+
+void hashlib_sha256_hw_update(const uint8_t *data, size_t len) {
+    int channel = -1;
+    if (len >= SHA256_HW_DMA_MIN_LEN && ((uintptr_t)data & 3) == 0) {
+        channel = dma_claim_unused_channel(false);
+    }
+    if (channel < 0) {
+        sha256_hw_update_cpu(data, len);
+        return;
+    }
+    // The engine paces the DMA, so the whole buffer goes in one transfer.
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, DREQ_SHA256);
+    sha256_wait_ready_blocking();
+    dma_channel_configure(channel, &c, sha256_get_write_addr(), data, len / 4, true);
+    dma_channel_wait_for_finish_blocking(channel);
+    dma_channel_unclaim(channel);
+}
+
+void hashlib_sha256_hw_stop(uint32_t state[8]) {
+    if (state != NULL) {
+        sha256_wait_valid_blocking();
+        for (size_t i = 0; i < 8; i++) {
+            state[i] = sha256_hw->sum[i];
+        }
+    }
+    sha256_hw_in_use = false;
+}
+
+#endif
@@ -110,30 +110,44 @@ uint32_t supervisor_flash_get_block_size(void) {
 }
 
 uint32_t supervisor_flash_get_block_count(void) {
-    return (_flash_size - CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR) / FILESYSTEM_BLOCK_SIZE;
+    return (_flash_size - CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR - CIRCUITPY_STORAGE_PARTITION_SIZE) / FILESYSTEM_BLOCK_SIZE;
 }
 
-void port_internal_flash_flush(void) {
-    if (_cache_lba == NO_CACHE) {
-        return;
-    }
+// Flash can't be read while it is being written, so nothing else may run
+// from it or access it in the meantime.
+static uint32_t begin_flash_write(void) {
     // Make sure we don't have an interrupt while we do flash operations.
     common_hal_mcu_disable_interrupts();
     // and audio DMA must be paused as well
+    uint32_t channel_mask = 0;
     #if CIRCUITPY_AUDIOCORE
-    uint32_t channel_mask = audio_dma_pause_all();
+    channel_mask = audio_dma_pause_all();
     #endif
     supervisor_flash_pre_write();
-    flash_range_erase(CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + _cache_lba, SECTOR_SIZE);
-    flash_range_program(CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + _cache_lba, _cache, SECTOR_SIZE);
+    return channel_mask;
+}
+
+static void end_flash_write(uint32_t channel_mask) {
     supervisor_flash_post_write();
-    _cache_lba = NO_CACHE;
     #if CIRCUITPY_AUDIOCORE
     audio_dma_unpause_mask(channel_mask);
+    #else
+    (void)channel_mask;
     #endif
     common_hal_mcu_enable_interrupts();
 }
 
+void port_internal_flash_flush(void) {
+    if (_cache_lba == NO_CACHE) {
+        return;
+    }
+    uint32_t channel_mask = begin_flash_write();
+    flash_range_erase(CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + _cache_lba, SECTOR_SIZE);
+    flash_range_program(CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + _cache_lba, _cache, SECTOR_SIZE);
+    _cache_lba = NO_CACHE;
+    end_flash_write(channel_mask);
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     port_internal_flash_flush(); // we never read out of the cache, so we have to write it if dirty
     memcpy(dest,
@@ -174,3 +188,66 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32
 
 void supervisor_flash_release_cache(void) {
 }
+
+#if CIRCUITPY_STORAGE_PARTITION
+// The partition is the last CIRCUITPY_STORAGE_PARTITION_SIZE bytes of flash.
+#if CIRCUITPY_STORAGE_PARTITION_SIZE % SECTOR_SIZE != 0
+#error "CIRCUITPY_STORAGE_PARTITION_SIZE must be a multiple of 4096"
+#endif
+
+static uint32_t partition_start(void) {
+    return _flash_size - CIRCUITPY_STORAGE_PARTITION_SIZE;
+}
+
+static bool partition_range_ok(uint32_t address, uint32_t len) {
+    return address <= CIRCUITPY_STORAGE_PARTITION_SIZE && len <= CIRCUITPY_STORAGE_PARTITION_SIZE - address;
+}
+
+uint32_t supervisor_flash_partition_get_size(void) {
+    return CIRCUITPY_STORAGE_PARTITION_SIZE;
+}
+
+const uint8_t *supervisor_flash_partition_get_mapped(void) {
+    return (const uint8_t *)(XIP_BASE + partition_start());
+}
+
+bool supervisor_flash_partition_read(uint32_t address, uint8_t *dest, uint32_t len) {
+    if (!partition_range_ok(address, len)) {
+        return false;
+    }
+    memcpy(dest, supervisor_flash_partition_get_mapped() + address, len);
+    return true;
+}
+
+bool supervisor_flash_partition_prog(uint32_t address, const uint8_t *src, uint32_t len) {
+    if (!partition_range_ok(address, len)) {
+        return false;
+    }
+    // Programs must cover whole pages. Padding with 0xff leaves the rest of a
+    // page unchanged. Each page is staged in RAM because src may be in flash.
+    uint8_t page[FLASH_PAGE_SIZE];
+    while (len > 0) {
+        uint32_t page_offset = address % FLASH_PAGE_SIZE;
+        uint32_t chunk = MIN(len, FLASH_PAGE_SIZE - page_offset);
+        memset(page, 0xff, FLASH_PAGE_SIZE);
+        memcpy(page + page_offset, src, chunk);
+        uint32_t channel_mask = begin_flash_write();
+        flash_range_program(partition_start() + address - page_offset, page, FLASH_PAGE_SIZE);
+        end_flash_write(channel_mask);
+        address += chunk;
+        src += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
+bool supervisor_flash_partition_erase(uint32_t address) {
+    if (address % SECTOR_SIZE != 0 || !partition_range_ok(address, SECTOR_SIZE)) {
+        return false;
+    }
+    uint32_t channel_mask = begin_flash_write();
+    flash_range_erase(partition_start() + address, SECTOR_SIZE);
+    end_flash_write(channel_mask);
+    return true;
+}
+#endif
@@ -57,6 +57,10 @@
 #include "tusb.h"
 #include <cmsis_compiler.h>
 
+#if CIRCUITPY_PERF_COUNTERS
+#include "src/rp2_common/cmsis/stub/CMSIS/Device/RP2350/Include/RP2350.h"
+#endif
+
 critical_section_t background_queue_lock;
 
 extern volatile bool mp_msc_enabled;
@@ -92,9 +96,12 @@ extern uint32_t _ld_itcm_flash_copy;
 #include "src/rp2350/hardware_structs/include/hardware/structs/qmi.h"
 #include "src/rp2350/hardware_structs/include/hardware/structs/xip_ctrl.h"
 
+#define PSRAM_START ((uint8_t *)0x11000000)
+
+// Internal RAM and PSRAM are separate heaps so that each allocation can say
+// which it prefers.
 static tlsf_t _heap = NULL;
-static pool_t _ram_pool = NULL;
-static pool_t _psram_pool = NULL;
+static tlsf_t _psram_heap = NULL;
 static size_t _psram_size = 0;
 
 static void __no_inline_not_in_flash_func(setup_psram)(void) {
@@ -241,24 +248,60 @@ void port_heap_init(void) {
     uint32_t *heap_bottom = port_heap_get_bottom();
     uint32_t *heap_top = port_heap_get_top();
     size_t size = (heap_top - heap_bottom) * sizeof(uint32_t);
-    _heap = tlsf_create_with_pool(heap_bottom, size, 64 * 1024 * 1024);
-    _ram_pool = tlsf_get_pool(_heap);
+    _heap = tlsf_create_with_pool(heap_bottom, size, size);
     if (_psram_size > 0) {
-        _psram_pool = tlsf_add_pool(_heap, (void *)0x11000000, _psram_size);
+        _psram_heap = tlsf_create_with_pool(PSRAM_START, _psram_size, _psram_size);
     }
 }
 
-void *port_malloc(size_t size, bool dma_capable) {
-    void *block = tlsf_malloc(_heap, size);
+bool port_heap_is_slow(const void *ptr) {
+    return (const uint8_t *)ptr >= PSRAM_START && (const uint8_t *)ptr < PSRAM_START + _psram_size;
+}
+
+static void *heap_malloc(size_t size, bool slow_first) {
+    tlsf_t first = _heap;
+    tlsf_t second = _psram_heap;
+    if (slow_first && _psram_heap != NULL) {
+        first = _psram_heap;
+        second = _heap;
+    }
+    void *block = tlsf_malloc(first, size);
+    if (block == NULL && second != NULL) {
+        block = tlsf_malloc(second, size);
+    }
     return block;
 }
 
+void *port_malloc(size_t size, bool dma_capable) {
+    // Small allocations try internal RAM first and large ones PSRAM first.
+    // DMA is faster from internal RAM.
+    return heap_malloc(size, !dma_capable && size >= CIRCUITPY_SLOW_RAM_THRESHOLD);
+}
+
+void *port_malloc_fast(size_t size) {
+    return heap_malloc(size, false);
+}
+
 void port_free(void *ptr) {
-    tlsf_free(_heap, ptr);
+    tlsf_free(port_heap_is_slow(ptr) ? _psram_heap : _heap, ptr);
 }
 
 void *port_realloc(void *ptr, size_t size) {
-    return tlsf_realloc(_heap, ptr, size);
+    if (ptr == NULL) {
+        return port_malloc(size, false);
+    }
+    tlsf_t heap = port_heap_is_slow(ptr) ? _psram_heap : _heap;
+    void *block = tlsf_realloc(heap, ptr, size);
+    if (block == NULL && size > 0) {
+        // Move to the other heap.
+        block = heap_malloc(size, heap == _heap);
+        if (block != NULL) {
+            size_t old_size = tlsf_block_size(ptr);
+            memcpy(block, ptr, old_size < size ? old_size : size);
+            tlsf_free(heap, ptr);
+        }
+    }
+    return block;
 }
 
 static bool max_size_walker(void *ptr, size_t size, int used, void *user) {
@@ -271,9 +314,9 @@ static bool max_size_walker(void *ptr, size_t size, int used, void *user) {
 
 size_t port_heap_get_largest_free_size(void) {
     size_t max_size = 0;
-    tlsf_walk_pool(_ram_pool, max_size_walker, &max_size);
-    if (_psram_pool != NULL) {
-        tlsf_walk_pool(_psram_pool, max_size_walker, &max_size);
+    tlsf_walk_pool(tlsf_get_pool(_heap), max_size_walker, &max_size);
+    if (_psram_heap != NULL) {
+        tlsf_walk_pool(tlsf_get_pool(_psram_heap), max_size_walker, &max_size);
     }
     // IDF does this. Not sure why.
     return tlsf_fit_size(_heap, max_size);
@@ -339,6 +382,11 @@ safe_mode_t port_init(void) {
     hardware_alarm_claim(0);
     hardware_alarm_set_callback(0, _tick_callback);
 
+    #if CIRCUITPY_PERF_COUNTERS
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
     // Check brownout.
 
     #if CIRCUITPY_CYW43
@@ -448,6 +496,12 @@ uint32_t port_get_saved_word(void) {
     return saved_word;
 }
 
+#if CIRCUITPY_PERF_COUNTERS
+uint32_t port_get_cpu_cycles(void) {
+    return DWT->CYCCNT;
+}
+#endif
+
 static volatile bool ticks_enabled;
 static volatile bool _woken_up;
 
@@ -459,6 +513,10 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return 1024 * (microseconds / 1000000) + (microseconds % 1000000) / 977;
 }
 
+uint64_t port_get_raw_us(void) {
+    return time_us_64();
+}
+
 static void _tick_callback(uint alarm_num) {
     if (ticks_enabled) {
         supervisor_tick();
@@ -1,4 +1,6 @@
 LONGINT_IMPL ?= MPZ
+# The Cortex-M33 multiplies 32 x 32 -> 64 bits in one instruction.
+MPZ_DIG_SIZE ?= 32
 INTERNAL_LIBM ?= 1
 USB_NUM_ENDPOINT_PAIRS = 0
 
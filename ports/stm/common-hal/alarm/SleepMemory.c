@@ -60,3 +60,8 @@ void common_hal_alarm_sleep_memory_get_bytes(alarm_sleep_memory_obj_t *self, uin
     memcpy(values, (uint8_t *)(STM_BKPSRAM_START + start_index), len);
     return;
 }
+
+uint8_t *common_hal_alarm_sleep_memory_get_buffer(alarm_sleep_memory_obj_t *self) {
+    lazy_init();
+    return (uint8_t *)STM_BKPSRAM_START;
+}
@@ -16,6 +16,7 @@
 #include "common-hal/canio/Listener.h"
 #include "shared-bindings/canio/Listener.h"
 #include "shared-bindings/util.h"
+#include "supervisor/shared/object_pool.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/shared/safe_mode.h"
 
@@ -246,17 +247,20 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return *(self->rfr) & CAN_RF0R_FMP0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
     if (!common_hal_canio_listener_in_waiting(self)) {
+        if (!wait) {
+            return false;
+        }
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
@@ -265,8 +269,7 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     uint32_t rdtr = self->mailbox->RDTR;
 
     bool rtr = rir & CAN_RI0R_RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = rir & CAN_RI0R_IDE;
     if (message->extended) {
         message->id = rir >> 3;
@@ -281,7 +284,20 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     }
     // Release the mailbox
     SET_BIT(*self->rfr, CAN_RF0R_RFOM0);
-    return message;
+    return true;
+}
+
+// Received messages come from a pool, since busy buses create many.
+static OBJECT_POOL(message_pool, canio_message_obj_t);
+
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    canio_message_obj_t message;
+    if (!common_hal_canio_listener_receive_into(self, &message, true)) {
+        return NULL;
+    }
+    canio_message_obj_t *result = object_pool_obj_malloc(&message_pool, canio_message_obj_t, message.base.type);
+    *result = message;
+    return result;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -1,4 +1,6 @@
 LONGINT_IMPL ?= MPZ
+# The Cortex-M4 and M7 multiply 32 x 32 -> 64 bits in one instruction.
+MPZ_DIG_SIZE ?= 32
 INTERNAL_LIBM ?= 1
 
 ifeq ($(MCU_VARIANT),$(filter $(MCU_VARIANT),STM32F405xx STM32F407xx))
@@ -88,4 +90,5 @@ ifeq ($(MCU_SERIES),L4)
 endif
 
 CIRCUITPY_PARALLELDISPLAYBUS := 0
+CIRCUITPY_PERF_COUNTERS ?= 1
 CIRCUITPY_BUILD_EXTENSIONS ?= bin
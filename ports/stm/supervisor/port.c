@@ -180,6 +180,11 @@ safe_mode_t port_init(void) {
     // Turn off SysTick
     SysTick->CTRL = 0;
 
+    #if CIRCUITPY_PERF_COUNTERS
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
     return SAFE_MODE_NONE;
 }
 
@@ -311,6 +316,12 @@ uint32_t port_get_saved_word(void) {
     return _ebss;
 }
 
+#if CIRCUITPY_PERF_COUNTERS
+uint32_t port_get_cpu_cycles(void) {
+    return DWT->CYCCNT;
+}
+#endif
+
 __attribute__((used)) void MemManage_Handler(void) {
     reset_into_safe_mode(SAFE_MODE_HARD_FAULT);
     while (true) {
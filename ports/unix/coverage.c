@@ -17,6 +17,8 @@
 #include "py/stream.h"
 #include "py/binary.h"
 #include "py/bc.h"
+// CIRCUITPY-CHANGE
+#include "py/persistentcode.h"
 
 // expected output of this file is found in extra_coverage.py.exp
 
@@ -729,6 +731,43 @@ static mp_obj_t extra_coverage(void) {
         mp_printf(&mp_plat_print, "%d %d\n", mp_obj_is_int(MP_OBJ_NEW_SMALL_INT(1)), mp_obj_is_int(mp_obj_new_int_from_ll(1)));
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    // executing a .mpy in place from ROM
+    {
+        mp_printf(&mp_plat_print, "# persistent code xip\n");
+
+        // mpy-cross output for:
+        //   def xip_add(x):
+        //       return x + 1
+        //   print("xip", xip_add(41))
+        static const byte xip_mpy[] = {
+            0x43, 0x06, 0x00, 0x1f, 0x06, 0x00, 0x14, 0x78, 0x69, 0x70, 0x5f, 0x6d,
+            0x6f, 0x64, 0x2e, 0x70, 0x79, 0x00, 0x0f, 0x06, 0x78, 0x69, 0x70, 0x00,
+            0x0e, 0x78, 0x69, 0x70, 0x5f, 0x61, 0x64, 0x64, 0x00, 0x81, 0x77, 0x02,
+            0x78, 0x00, 0x81, 0x34, 0x18, 0x04, 0x01, 0x44, 0x32, 0x00, 0x16, 0x03,
+            0x11, 0x04, 0x10, 0x02, 0x11, 0x03, 0xa9, 0x34, 0x01, 0x34, 0x02, 0x59,
+            0x51, 0x63, 0x01, 0x48, 0x11, 0x06, 0x03, 0x05, 0x20, 0xb0, 0x81, 0xf2,
+            0x63,
+        };
+        #define IN_XIP_MPY(p) ((const byte *)(p) >= xip_mpy && (const byte *)(p) < xip_mpy + sizeof(xip_mpy))
+
+        mp_reader_t reader;
+        mp_reader_new_mem(&reader, xip_mpy, sizeof(xip_mpy), MP_READER_IS_ROM);
+        mp_compiled_module_t cm;
+        cm.context = m_new_obj(mp_module_context_t);
+        cm.context->module.globals = mp_globals_get();
+        mp_raw_code_load(&reader, &cm);
+
+        // the bytecode and the new qstrs should be referenced, not copied
+        mp_printf(&mp_plat_print, "%d\n", IN_XIP_MPY(cm.rc->fun_data));
+        mp_printf(&mp_plat_print, "%d\n", IN_XIP_MPY(qstr_str(qstr_from_str("xip_add"))));
+
+        mp_call_function_0(mp_make_function_from_proto_fun(cm.rc, cm.context, NULL));
+        #undef IN_XIP_MPY
+    }
+    #endif
+
     mp_printf(&mp_plat_print, "# end coverage.c\n");
 
     mp_obj_streamtest_t *s = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_fileio);
@@ -31,6 +31,11 @@
 
 #include "shared/runtime/gchelper.h"
 
+// CIRCUITPY-CHANGE
+#if CIRCUITPY_DISPLAYIO
+#include "shared-module/displayio/__init__.h"
+#endif
+
 #if MICROPY_ENABLE_GC
 
 void gc_collect(void) {
@@ -42,6 +47,10 @@ void gc_collect(void) {
     #if MICROPY_EMIT_NATIVE
     mp_unix_mark_exec();
     #endif
+    // CIRCUITPY-CHANGE: displays live outside the heap.
+    #if CIRCUITPY_DISPLAYIO
+    displayio_gc_collect();
+    #endif
     gc_collect_end();
 }
 
@@ -1 +1,12 @@
-print("frzstr1")
+from micropython import const
+
+# Private constants are only known to the parser, so this checks that they
+# are kept between statements when a module is compiled incrementally.
+_ONE = const(1)
+
+
+def frzstr1_name():
+    return "frzstr" + str(_ONE)
+
+
+print(frzstr1_name())
@@ -36,6 +36,32 @@
 // Enable testing of split heap.
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
+// CIRCUITPY-CHANGE: test incremental sweeping across the split heap.
+#define MICROPY_GC_INCREMENTAL         (1)
+#define MICROPY_GC_FREE_LISTS          (1)
+#define MICROPY_GC_NOSCAN              (1)
+#define MICROPY_GC_MOVABLE             (1)
+#define MICROPY_GC_STATS               (1)
+#define MICROPY_GC_RESERVE             (1)
+#define MICROPY_TRACK_CODE_STATE       (1)
+// The attribute cache isn't safe with threads that don't hold a GIL.
+#define MICROPY_OPT_ATTR_CACHE         (!MICROPY_PY_THREAD || MICROPY_PY_THREAD_GIL)
+#define MICROPY_OPT_SUPERINSTRUCTIONS  (1)
+#define MICROPY_OPT_VM_BINARY_OP_FAST_PATH (1)
+#define MICROPY_OPT_MAP_COMPACT        (1)
+#define MICROPY_QSTR_POOL_INDEX        (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (1)
+#define MICROPY_MODULE_COMPILE_CACHE   (1)
+#define MICROPY_MODULE_PATH_CACHE      (1024)
+#define MICROPY_MODULE_RETAIN          (65536)
+#define MICROPY_MODULE_RETAIN_PREFIX   ""
+#define MICROPY_COMP_INCREMENTAL       (1)
+#define MICROPY_COMP_JUMP_THREADING    (1)
+#define MICROPY_MODULE_BUILTIN_LAZY_INIT (1)
+#define MICROPY_STOP_ITERATION_NO_TRACEBACK (1)
+#define MICROPY_PY_RE_CACHE_SIZE       (4)
+#define MICROPY_PY_RE_PIKEVM           (1)
+#define MICROPY_PY_ARRAY_OPS           (1)
 
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
@@ -47,3 +73,9 @@
 #define MICROPY_PY_CRYPTOLIB_CTR      (0)
 // CircuitPython uses shared-bindings struct
 #define MICROPY_PY_STRUCT              (0)
+// and shared-bindings zlib
+#define MICROPY_PY_ZLIB                (0)
+
+// As in py/circuitpy_mpconfig.h, which the unix port doesn't use.
+#define CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE (64)
+#define CIRCUITPY_MESSAGE_DECOMPRESS_CACHE (4)
@@ -48,21 +48,31 @@ SRC_BITMAP := \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/dsp/__init__.c \
+	shared-bindings/dsp/FIR.c \
 	shared-bindings/floppyio/__init__.c \
+	shared-bindings/gnssio/__init__.c \
+	shared-bindings/gnssio/Fix.c \
+	shared-bindings/gnssio/Receiver.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
+	shared-bindings/msgpack/__init__.c \
+	shared-bindings/msgpack/ExtType.c \
 	shared-bindings/locale/__init__.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
 	shared-bindings/synthio/__init__.c \
 	shared-bindings/synthio/Math.c \
 	shared-bindings/synthio/MidiTrack.c \
 	shared-bindings/synthio/LFO.c \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/BiquadCascade.c \
 	shared-bindings/synthio/BlockBiquad.c \
 	shared-bindings/synthio/Synthesizer.c \
 	shared-bindings/traceback/__init__.c \
+	shared-bindings/uheap/__init__.c \
 	shared-bindings/util.c \
 	shared-bindings/vectorio/Circle.c \
 	shared-bindings/vectorio/__init__.c \
@@ -70,6 +80,8 @@ SRC_BITMAP := \
 	shared-bindings/vectorio/Rectangle.c \
 	shared-bindings/vectorio/VectorShape.c \
 	shared-bindings/zlib/__init__.c \
+	shared-bindings/zlib/Compress.c \
+	shared-bindings/zlib/Decompress.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
@@ -89,9 +101,15 @@ SRC_BITMAP := \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
 	shared-module/displayio/Palette.c \
+	shared-module/dsp/__init__.c \
+	shared-module/dsp/FIR.c \
 	shared-module/floppyio/__init__.c \
+	shared-module/gnssio/__init__.c \
+	shared-module/gnssio/Fix.c \
+	shared-module/gnssio/Receiver.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
+	shared-module/msgpack/__init__.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
@@ -101,6 +119,7 @@ SRC_BITMAP := \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
+	shared-module/synthio/BiquadCascade.c \
 	shared-module/synthio/BlockBiquad.c \
 	shared-module/synthio/Synthesizer.c \
 	shared-bindings/vectorio/Circle.c \
@@ -110,10 +129,23 @@ SRC_BITMAP := \
 	shared-module/vectorio/Rectangle.c \
 	shared-module/vectorio/VectorShape.c \
 	shared-module/traceback/__init__.c \
+	shared-module/uheap/__init__.c \
 	shared-module/zlib/__init__.c \
+	shared-module/zlib/Compress.c \
+	shared-module/zlib/Decompress.c \
 
 SRC_C += $(SRC_BITMAP)
 
+# extmod/modzlib.c, which would otherwise compile these, is turned off.
+SRC_C += $(addprefix lib/uzlib/, \
+	tinflate.c \
+	tinfzlib.c \
+	tinfgzip.c \
+	adler32.c \
+	crc32.c \
+)
+$(BUILD)/lib/uzlib/tinflate.o: CFLAGS += -Wno-missing-braces -Wno-missing-prototypes
+
 SRC_C += $(addprefix lib/mp3/src/, \
         bitstream.c \
         buffers.c \
@@ -147,17 +179,22 @@ CFLAGS += \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
 	-DCIRCUITPY_CODEOP=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
+	-DCIRCUITPY_DSP=1 \
 	-DCIRCUITPY_FLOPPYIO=1 \
 	-DCIRCUITPY_FUTURE=1 \
 	-DCIRCUITPY_GIFIO=1 \
+	-DCIRCUITPY_GNSSIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_MSGPACK=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
+	-DCIRCUITPY_OS_GETENV_CACHE=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
 	-DCIRCUITPY_TRACEBACK=1 \
+	-DCIRCUITPY_UHEAP=1 \
 	-DCIRCUITPY_VECTORIO=1 \
 	-DCIRCUITPY_ZLIB=1
 
@@ -165,3 +202,4 @@ CFLAGS += \
 SRC_C += coverage.c native_base_class.c
 SRC_CXX += coveragecpp.cpp
 CIRCUITPY_MESSAGE_COMPRESSION_LEVEL = 1
+CIRCUITPY_MESSAGE_DECOMPRESS_TABLE_BITS = 8
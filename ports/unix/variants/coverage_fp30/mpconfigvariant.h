@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// The coverage build with the object model that CircuitPython uses on its
+// 32-bit ports: REPR_C, where floats are 30-bit immediate objects instead of
+// heap-allocated boxes. This checks that the shared-bindings work with it when
+// running the tests on the host.
+
+#define MICROPY_OBJ_REPR (MICROPY_OBJ_REPR_C)
+#define MICROPY_FLOAT_IMPL (MICROPY_FLOAT_IMPL_FLOAT)
+
+// mpconfigport.h leaves these to the variant when it selects the object model.
+#ifdef __LP64__
+typedef long mp_int_t;
+typedef unsigned long mp_uint_t;
+#else
+typedef int mp_int_t;
+typedef unsigned int mp_uint_t;
+#endif
+
+#include "../coverage/mpconfigvariant.h"
@@ -0,0 +1,8 @@
+# The coverage build with 30-bit immediate floats (object repr C), as used by
+# CircuitPython on 32-bit ports.
+
+FROZEN_MANIFEST ?= $(VARIANT_DIR)/../coverage/manifest.py
+include $(VARIANT_DIR)/../coverage/mpconfigvariant.mk
+
+# Match the CircuitPython ports, where float constants are single precision.
+CFLAGS += -fsingle-precision-constant
@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// The simulated hardware has no pins, but display and audio headers refer to
+// the type.
+typedef struct {
+    mp_obj_base_t base;
+} mcu_pin_obj_t;
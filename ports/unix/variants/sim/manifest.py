@@ -0,0 +1,3 @@
+include("$(PORT_DIR)/variants/manifest.py")
+
+# CIRCUITPY-CHANGE: Do not include extmod/aysncio
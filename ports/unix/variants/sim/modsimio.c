@@ -0,0 +1,337 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/util.h"
+#include "shared-module/audiocore/__init__.h"
+#include "shared-module/framebufferio/FramebufferDisplay.h"
+
+//| """Simulated hardware for profiling displayio and audio code on a workstation"""
+//|
+
+//| class Framebuffer:
+//|     """An RGB565 framebuffer in memory, for use with
+//|     `framebufferio.FramebufferDisplay`. It supports the ``ReadableBuffer``
+//|     protocol and can be accessed as an array of ``H`` (unsigned 16-bit
+//|     values)."""
+//|
+//|     def __init__(self, width: int, height: int) -> None:
+//|         """Create a framebuffer of the given size in pixels"""
+//|         ...
+//|
+typedef struct {
+    mp_obj_base_t base;
+    uint16_t *pixels;
+    uint16_t width;
+    uint16_t height;
+    uint32_t frames;
+} simio_framebuffer_obj_t;
+
+static mp_obj_t simio_framebuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 2, 2, false);
+    mp_int_t width = mp_arg_validate_int_range(mp_obj_get_int(args[0]), 1, 32767, MP_QSTR_width);
+    mp_int_t height = mp_arg_validate_int_range(mp_obj_get_int(args[1]), 1, 32767, MP_QSTR_height);
+    simio_framebuffer_obj_t *self = mp_obj_malloc(simio_framebuffer_obj_t, type);
+    self->pixels = m_new0(uint16_t, width * height);
+    self->width = width;
+    self->height = height;
+    self->frames = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     frames: int
+//|     """The number of refreshes the display has sent to the framebuffer"""
+//|
+static mp_obj_t simio_framebuffer_get_frames(mp_obj_t self_in) {
+    simio_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->frames);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(simio_framebuffer_get_frames_obj, simio_framebuffer_get_frames);
+
+MP_PROPERTY_GETTER(simio_framebuffer_frames_obj,
+    (mp_obj_t)&simio_framebuffer_get_frames_obj);
+
+static const mp_rom_map_elem_t simio_framebuffer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_frames), MP_ROM_PTR(&simio_framebuffer_frames_obj) },
+};
+static MP_DEFINE_CONST_DICT(simio_framebuffer_locals_dict, simio_framebuffer_locals_dict_table);
+
+static void simio_framebuffer_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *bufinfo) {
+    simio_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bufinfo->buf = self->pixels;
+    bufinfo->len = self->width * self->height * sizeof(uint16_t);
+    bufinfo->typecode = 'H';
+}
+
+static void simio_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmask) {
+    simio_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    self->frames++;
+}
+
+static void simio_framebuffer_deinit(mp_obj_t self_in) {
+}
+
+static int simio_framebuffer_get_width(mp_obj_t self_in) {
+    simio_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->width;
+}
+
+static int simio_framebuffer_get_height(mp_obj_t self_in) {
+    simio_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->height;
+}
+
+static const framebuffer_p_t simio_framebuffer_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_framebuffer)
+    .get_bufinfo = simio_framebuffer_get_bufinfo,
+    .swapbuffers = simio_framebuffer_swapbuffers,
+    .deinit = simio_framebuffer_deinit,
+    .get_width = simio_framebuffer_get_width,
+    .get_height = simio_framebuffer_get_height,
+};
+
+static mp_int_t simio_framebuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    simio_framebuffer_get_bufinfo(self_in, bufinfo);
+    return 0;
+}
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    simio_framebuffer_type,
+    MP_QSTR_Framebuffer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, simio_framebuffer_make_new,
+    locals_dict, &simio_framebuffer_locals_dict,
+    buffer, simio_framebuffer_get_buffer,
+    protocol, &simio_framebuffer_proto
+    );
+
+//| class AudioOut:
+//|     """Writes audio samples to a WAV file as fast as they can be generated,
+//|     instead of playing them"""
+//|
+//|     def __init__(self, path: str) -> None:
+//|         """Create the WAV file at ``path``. It is complete once the
+//|         AudioOut is deinitialized."""
+//|         ...
+//|
+typedef struct {
+    mp_obj_base_t base;
+    FILE *file;
+    uint32_t sample_rate;
+    uint32_t data_bytes;
+    uint8_t bits_per_sample;
+    uint8_t channel_count;
+} simio_audioout_obj_t;
+
+static void write_u16(FILE *file, uint16_t value) {
+    uint8_t bytes[2] = { value, value >> 8 };
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+static void write_u32(FILE *file, uint32_t value) {
+    write_u16(file, value);
+    write_u16(file, value >> 16);
+}
+
+static void write_header(simio_audioout_obj_t *self) {
+    uint16_t block_align = self->channel_count * self->bits_per_sample / 8;
+    fseek(self->file, 0, SEEK_SET);
+    fwrite("RIFF", 1, 4, self->file);
+    write_u32(self->file, 36 + self->data_bytes);
+    fwrite("WAVEfmt ", 1, 8, self->file);
+    write_u32(self->file, 16);
+    write_u16(self->file, 1); // PCM
+    write_u16(self->file, self->channel_count);
+    write_u32(self->file, self->sample_rate);
+    write_u32(self->file, self->sample_rate * block_align);
+    write_u16(self->file, block_align);
+    write_u16(self->file, self->bits_per_sample);
+    fwrite("data", 1, 4, self->file);
+    write_u32(self->file, self->data_bytes);
+    fseek(self->file, 0, SEEK_END);
+}
+
+static mp_obj_t simio_audioout_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    const char *path = mp_obj_str_get_str(args[0]);
+    simio_audioout_obj_t *self = mp_obj_malloc_with_finaliser(simio_audioout_obj_t, type);
+    self->file = fopen(path, "wb");
+    if (self->file == NULL) {
+        mp_raise_OSError_with_filename(errno, path);
+    }
+    self->sample_rate = 0;
+    self->data_bytes = 0;
+    self->bits_per_sample = 16;
+    self->channel_count = 1;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static simio_audioout_obj_t *native_audioout(mp_obj_t self_in) {
+    simio_audioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->file == NULL) {
+        raise_deinited_error();
+    }
+    return self;
+}
+
+//|     def deinit(self) -> None:
+//|         """Finish and close the WAV file"""
+//|         ...
+//|
+static mp_obj_t simio_audioout_deinit(mp_obj_t self_in) {
+    simio_audioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->file != NULL) {
+        if (self->sample_rate != 0) {
+            write_header(self);
+        }
+        fclose(self->file);
+        self->file = NULL;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(simio_audioout_deinit_obj, simio_audioout_deinit);
+
+//|     def __enter__(self) -> AudioOut:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t simio_audioout_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return simio_audioout_deinit(args[0]);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(simio_audioout___exit___obj, 4, 4, simio_audioout_obj___exit__);
+
+//|     def play(self, sample: circuitpython_typing.AudioSample, *, seconds: Optional[float] = None) -> int:
+//|         """Generate ``sample`` and append it to the file, until the sample
+//|         ends or ``seconds`` of audio have been written. Mixers and
+//|         synthesizers never end, so give ``seconds`` for them. Every sample
+//|         played must have the same format. Returns the number of frames
+//|         written."""
+//|         ...
+//|
+static mp_obj_t simio_audioout_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_seconds };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_seconds, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    simio_audioout_obj_t *self = native_audioout(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t sample = args[ARG_sample].u_obj;
+
+    uint32_t sample_rate = audiosample_sample_rate(sample);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    uint8_t channel_count = audiosample_channel_count(sample);
+    if (self->sample_rate == 0) {
+        self->sample_rate = sample_rate;
+        self->bits_per_sample = bits_per_sample;
+        self->channel_count = channel_count;
+        write_header(self);
+    } else if (sample_rate != self->sample_rate) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_sample_rate);
+    } else if (bits_per_sample != self->bits_per_sample) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_bits_per_sample);
+    } else if (channel_count != self->channel_count) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_channel_count);
+    }
+
+    bool single_buffer, samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
+    // WAV files hold unsigned 8-bit and signed 16-bit samples.
+    bool flip = (bits_per_sample == 8) == samples_signed;
+
+    uint32_t frame_size = channel_count * bits_per_sample / 8;
+    uint64_t max_frames = UINT64_MAX;
+    if (args[ARG_seconds].u_obj != mp_const_none) {
+        max_frames = (uint64_t)(mp_obj_get_float(args[ARG_seconds].u_obj) * sample_rate);
+    }
+    uint64_t frames = 0;
+    audiosample_reset_buffer(sample, false, 0);
+    while (frames < max_frames) {
+        uint8_t *buffer = NULL;
+        uint32_t buffer_length = 0;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, &buffer, &buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Error in get_buffer"));
+        }
+        uint32_t n_frames = buffer_length / frame_size;
+        if (n_frames > max_frames - frames) {
+            n_frames = max_frames - frames;
+        }
+        if (flip) {
+            // Flip the sign bits in place, and back once they're written.
+            size_t step = bits_per_sample / 8;
+            for (size_t i = step - 1; i < n_frames * frame_size; i += step) {
+                buffer[i] ^= 0x80;
+            }
+            fwrite(buffer, frame_size, n_frames, self->file);
+            for (size_t i = step - 1; i < n_frames * frame_size; i += step) {
+                buffer[i] ^= 0x80;
+            }
+        } else {
+            fwrite(buffer, frame_size, n_frames, self->file);
+        }
+        frames += n_frames;
+        self->data_bytes += n_frames * frame_size;
+        if (result == GET_BUFFER_DONE) {
+            break;
+        }
+        mp_handle_pending(true);
+    }
+    return mp_obj_new_int_from_ull(frames);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(simio_audioout_play_obj, 1, simio_audioout_play);
+
+static const mp_rom_map_elem_t simio_audioout_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&simio_audioout_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&simio_audioout_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&simio_audioout___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&simio_audioout_play_obj) },
+};
+static MP_DEFINE_CONST_DICT(simio_audioout_locals_dict, simio_audioout_locals_dict_table);
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    simio_audioout_type,
+    MP_QSTR_AudioOut,
+    MP_TYPE_FLAG_NONE,
+    make_new, simio_audioout_make_new,
+    locals_dict, &simio_audioout_locals_dict
+    );
+
+static const mp_rom_map_elem_t simio_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_simio) },
+    { MP_ROM_QSTR(MP_QSTR_AudioOut), MP_ROM_PTR(&simio_audioout_type) },
+    { MP_ROM_QSTR(MP_QSTR_Framebuffer), MP_ROM_PTR(&simio_framebuffer_type) },
+};
+static MP_DEFINE_CONST_DICT(simio_module_globals, simio_module_globals_table);
+
+const mp_obj_module_t simio_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&simio_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_simio, simio_module);
@@ -0,0 +1,23 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// A build of the unix port with CircuitPython's displayio, audio and
+// serialization modules running on host-side simulated hardware, so that
+// their hot paths can be profiled with perf or valgrind.
+
+// Set base feature level.
+#define MICROPY_CONFIG_ROM_LEVEL (MICROPY_CONFIG_ROM_LEVEL_EXTRA_FEATURES)
+
+// Enable extra Unix features.
+#include "../mpconfigvariant_common.h"
+
+// CircuitPython uses shared-bindings struct
+#define MICROPY_PY_STRUCT              (0)
+
+// As in py/circuitpy_mpconfig.h, which the unix port doesn't use.
+#define CIRCUITPY_DISPLAY_LIMIT        (1)
+#define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
+#define CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE (64)
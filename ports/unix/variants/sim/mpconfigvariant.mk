@@ -0,0 +1,102 @@
+# Simulated hardware for profiling shared-module code on a workstation.
+
+# Optimise for speed, and keep symbols and frame pointers for perf and
+# valgrind.
+COPT ?= -O2 -DNDEBUG
+STRIP =
+CFLAGS += -fno-omit-frame-pointer
+
+FROZEN_MANIFEST ?= $(VARIANT_DIR)/manifest.py
+
+SRC_SIM := \
+	shared/runtime/context_manager_helpers.c \
+	shared-bindings/adafruit_pixelbuf/__init__.c \
+	shared-bindings/adafruit_pixelbuf/PixelBuf.c \
+	shared-bindings/audiocore/__init__.c \
+	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/WaveFile.c \
+	shared-bindings/audiomixer/__init__.c \
+	shared-bindings/audiomixer/Mixer.c \
+	shared-bindings/audiomixer/MixerVoice.c \
+	shared-bindings/bitmaptools/__init__.c \
+	shared-bindings/displayio/__init__.c \
+	shared-bindings/displayio/Bitmap.c \
+	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Colorspace.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
+	shared-bindings/framebufferio/__init__.c \
+	shared-bindings/framebufferio/FramebufferDisplay.c \
+	shared-bindings/msgpack/__init__.c \
+	shared-bindings/msgpack/ExtType.c \
+	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
+	shared-bindings/synthio/__init__.c \
+	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/BiquadCascade.c \
+	shared-bindings/synthio/BlockBiquad.c \
+	shared-bindings/synthio/LFO.c \
+	shared-bindings/synthio/Math.c \
+	shared-bindings/synthio/MidiTrack.c \
+	shared-bindings/synthio/Note.c \
+	shared-bindings/synthio/Synthesizer.c \
+	shared-bindings/util.c \
+	shared-bindings/vectorio/__init__.c \
+	shared-bindings/vectorio/Circle.c \
+	shared-bindings/vectorio/Polygon.c \
+	shared-bindings/vectorio/Rectangle.c \
+	shared-bindings/vectorio/VectorShape.c \
+	shared-module/adafruit_pixelbuf/__init__.c \
+	shared-module/adafruit_pixelbuf/PixelBuf.c \
+	shared-module/audiocore/__init__.c \
+	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/WaveFile.c \
+	shared-module/audiomixer/__init__.c \
+	shared-module/audiomixer/Mixer.c \
+	shared-module/audiomixer/MixerVoice.c \
+	shared-module/bitmaptools/__init__.c \
+	shared-module/displayio/area.c \
+	shared-module/displayio/Bitmap.c \
+	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/display_core.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
+	shared-module/framebufferio/__init__.c \
+	shared-module/framebufferio/FramebufferDisplay.c \
+	shared-module/msgpack/__init__.c \
+	shared-module/os/getenv.c \
+	shared-module/struct/__init__.c \
+	shared-module/synthio/__init__.c \
+	shared-module/synthio/Biquad.c \
+	shared-module/synthio/BiquadCascade.c \
+	shared-module/synthio/BlockBiquad.c \
+	shared-module/synthio/LFO.c \
+	shared-module/synthio/Math.c \
+	shared-module/synthio/MidiTrack.c \
+	shared-module/synthio/Note.c \
+	shared-module/synthio/Synthesizer.c \
+	shared-module/vectorio/__init__.c \
+	shared-module/vectorio/Circle.c \
+	shared-module/vectorio/Polygon.c \
+	shared-module/vectorio/Rectangle.c \
+	shared-module/vectorio/VectorShape.c \
+
+SRC_C += $(SRC_SIM)
+
+CFLAGS += \
+	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
+	-DCIRCUITPY_AUDIOMIXER=1 \
+	-DCIRCUITPY_BITMAPTOOLS=1 \
+	-DCIRCUITPY_DISPLAYIO=1 \
+	-DCIRCUITPY_FRAMEBUFFERIO=1 \
+	-DCIRCUITPY_MSGPACK=1 \
+	-DCIRCUITPY_OS_GETENV=1 \
+	-DCIRCUITPY_OS_GETENV_CACHE=1 \
+	-DCIRCUITPY_PIXELBUF=1 \
+	-DCIRCUITPY_STRUCT=1 \
+	-DCIRCUITPY_SYNTHIO=1 \
+	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
+	-DCIRCUITPY_VECTORIO=1
@@ -0,0 +1,110 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// The parts of the supervisor and of shared-module/displayio/__init__.c that
+// displays need. There is no background task loop, so displays only refresh
+// when refresh() is called.
+
+#include <string.h>
+
+#include "py/mphal.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/OnDiskBitmap.h"
+#include "shared-bindings/framebufferio/FramebufferDisplay.h"
+#include "shared-module/displayio/__init__.h"
+#include "supervisor/shared/display.h"
+#include "supervisor/shared/tick.h"
+
+primary_display_t displays[CIRCUITPY_DISPLAY_LIMIT];
+
+displayio_buffer_transform_t null_transform = {
+    .x = 0,
+    .y = 0,
+    .dx = 1,
+    .dy = 1,
+    .scale = 1,
+    .width = 0,
+    .height = 0,
+    .mirror_x = false,
+    .mirror_y = false,
+    .transpose_xy = false
+};
+
+static mp_obj_list_t splash_children = {
+    .base = {.type = &mp_type_list },
+    .alloc = 0,
+    .len = 0,
+    .items = NULL,
+};
+
+displayio_group_t circuitpython_splash = {
+    .base = {.type = &displayio_group_type },
+    .scale = 1,
+    .members = &splash_children,
+    .readonly = true,
+};
+
+// OnDiskBitmap reads FAT file objects, which the unix port's files aren't, so
+// it can't be constructed here.
+MP_DEFINE_CONST_OBJ_TYPE(
+    displayio_ondiskbitmap_type,
+    MP_QSTR_OnDiskBitmap,
+    MP_TYPE_FLAG_NONE
+    );
+
+uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self, int16_t x, int16_t y) {
+    return 0;
+}
+
+uint64_t supervisor_ticks_ms64(void) {
+    return mp_hal_ticks_ms();
+}
+
+void supervisor_deadline_set(supervisor_deadline_t *deadline, uint64_t ticks) {
+}
+
+void supervisor_deadline_set_after_ms(supervisor_deadline_t *deadline, uint32_t ms) {
+}
+
+void supervisor_deadline_cancel(supervisor_deadline_t *deadline) {
+}
+
+void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
+}
+
+void supervisor_stop_terminal(void) {
+}
+
+void common_hal_displayio_release_displays(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].display_base.type == &framebufferio_framebufferdisplay_type) {
+            release_framebufferdisplay(&displays[i].framebuffer_display);
+        }
+        displays[i].display_base.type = &mp_type_NoneType;
+    }
+}
+
+void displayio_gc_collect(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].display_base.type == &framebufferio_framebufferdisplay_type) {
+            framebufferio_framebufferdisplay_collect_ptrs(&displays[i].framebuffer_display);
+        }
+    }
+}
+
+primary_display_t *allocate_display_or_raise(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        mp_const_obj_t display_type = displays[i].display_base.type;
+        if (display_type == NULL || display_type == &mp_type_NoneType) {
+            memset(&displays[i], 0, sizeof(displays[i]));
+            displays[i].display_base.type = &mp_type_NoneType;
+            return &displays[i];
+        }
+    }
+    mp_raise_RuntimeError(MP_ERROR_TEXT("Too many displays"));
+}
@@ -86,6 +86,33 @@ inline void mp_arg_check_num_kw_array(size_t n_args, size_t n_kw, size_t n_args_
 
 void mp_arg_parse_all(size_t n_pos, const mp_obj_t *pos, mp_map_t *kws, size_t n_allowed, const mp_arg_t *allowed, mp_arg_val_t *out_vals) {
     size_t pos_found = 0, kws_found = 0;
+    // CIRCUITPY-CHANGE: match the given keywords to the allowed arguments in
+    // one pass over them, parking their values in out_vals, rather than
+    // looking up every allowed argument in kws. Without keywords there's
+    // nothing to look up.
+    bool have_kws = kws != NULL && kws->used > 0;
+    if (have_kws) {
+        for (size_t i = n_pos; i < n_allowed; i++) {
+            out_vals[i].u_obj = MP_OBJ_NULL;
+        }
+        for (size_t j = 0; j < kws->alloc; j++) {
+            if (!mp_map_slot_is_filled(kws, j)) {
+                continue;
+            }
+            mp_obj_t key = kws->table[j].key;
+            for (size_t i = n_pos; i < n_allowed; i++) {
+                mp_obj_t name = MP_OBJ_NEW_QSTR(allowed[i].qst);
+                if (key == name || (!kws->all_keys_are_qstrs && mp_obj_equal(key, name))) {
+                    // A repeated keyword is left over, and reported below.
+                    if (out_vals[i].u_obj == MP_OBJ_NULL) {
+                        out_vals[i].u_obj = kws->table[j].value;
+                        kws_found++;
+                    }
+                    break;
+                }
+            }
+        }
+    }
     for (size_t i = 0; i < n_allowed; i++) {
         mp_obj_t given_arg;
         if (i < n_pos) {
@@ -95,11 +122,8 @@ void mp_arg_parse_all(size_t n_pos, const mp_obj_t *pos, mp_map_t *kws, size_t n
             pos_found++;
             given_arg = pos[i];
         } else {
-            mp_map_elem_t *kw = NULL;
-            if (kws != NULL) {
-                kw = mp_map_lookup(kws, MP_OBJ_NEW_QSTR(allowed[i].qst), MP_MAP_LOOKUP);
-            }
-            if (kw == NULL) {
+            given_arg = have_kws ? out_vals[i].u_obj : MP_OBJ_NULL;
+            if (given_arg == MP_OBJ_NULL) {
                 if (allowed[i].flags & MP_ARG_REQUIRED) {
                     #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
                     mp_arg_error_terse_mismatch();
@@ -109,9 +133,6 @@ void mp_arg_parse_all(size_t n_pos, const mp_obj_t *pos, mp_map_t *kws, size_t n
                 }
                 out_vals[i] = allowed[i].defval;
                 continue;
-            } else {
-                kws_found++;
-                given_arg = kw->value;
             }
         }
         if ((allowed[i].flags & MP_ARG_KIND_MASK) == MP_ARG_BOOL) {
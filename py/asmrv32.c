@@ -0,0 +1,304 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <assert.h>
+
+#include "py/mpconfig.h"
+
+// wrapper around everything in this file
+#if MICROPY_EMIT_RV32
+
+#include "py/asmrv32.h"
+
+#define WORD_SIZE (4)
+#define SIGNED_FIT6(x) ((((x) & 0xffffffe0) == 0) || (((x) & 0xffffffe0) == 0xffffffe0))
+#define SIGNED_FIT12(x) ((((x) & 0xfffff800) == 0) || (((x) & 0xfffff800) == 0xfffff800))
+#define SIGNED_FIT13(x) ((((x) & 0xfffff000) == 0) || (((x) & 0xfffff000) == 0xfffff000))
+#define SIGNED_FIT21(x) ((((x) & 0xfff00000) == 0) || (((x) & 0xfff00000) == 0xfff00000))
+
+// registers x8-x15 can be encoded in the 3-bit fields of compressed instructions
+#define IS_RVC_REG(r) ((r) >= ASM_RV32_REG_S0 && (r) <= ASM_RV32_REG_A5)
+#define RVC_REG(r) ((r) - ASM_RV32_REG_S0)
+
+// sign-extended low 12 bits, for splitting a 32-bit value over lui/auipc + addi
+#define LO12(x) ((int32_t)((uint32_t)(x) << 20) >> 20)
+
+void asm_rv32_op16(asm_rv32_t *as, uint16_t op) {
+    uint8_t *c = mp_asm_base_get_cur_to_write_bytes(&as->base, 2);
+    if (c != NULL) {
+        // code may only be 16-bit aligned, so write it a byte at a time
+        c[0] = op;
+        c[1] = op >> 8;
+    }
+}
+
+void asm_rv32_op32(asm_rv32_t *as, uint32_t op) {
+    uint8_t *c = mp_asm_base_get_cur_to_write_bytes(&as->base, 4);
+    if (c != NULL) {
+        c[0] = op;
+        c[1] = op >> 8;
+        c[2] = op >> 16;
+        c[3] = op >> 24;
+    }
+}
+
+static void asm_rv32_op_c_addi(asm_rv32_t *as, uint rd, int imm) {
+    // c.addi rd, imm
+    asm_rv32_op16(as, 0x0001 | ((imm & 0x20) << 7) | (rd << 7) | ((imm & 0x1f) << 2));
+}
+
+static void asm_rv32_op_c_li(asm_rv32_t *as, uint rd, int imm) {
+    // c.li rd, imm
+    asm_rv32_op16(as, 0x4001 | ((imm & 0x20) << 7) | (rd << 7) | ((imm & 0x1f) << 2));
+}
+
+static void asm_rv32_op_c_lwsp(asm_rv32_t *as, uint rd, uint offset) {
+    // c.lwsp rd, offset(sp)
+    asm_rv32_op16(as, 0x4002 | ((offset & 0x20) << 7) | (rd << 7) | ((offset & 0x1c) << 2) | ((offset & 0xc0) >> 4));
+}
+
+static void asm_rv32_op_c_swsp(asm_rv32_t *as, uint rs, uint offset) {
+    // c.swsp rs, offset(sp)
+    asm_rv32_op16(as, 0xc002 | ((offset & 0x3c) << 7) | ((offset & 0xc0) << 1) | (rs << 2));
+}
+
+static void asm_rv32_op_c_lw_sw(asm_rv32_t *as, uint op, uint rd, uint rs, uint offset) {
+    // c.lw rd', offset(rs') if op is 0x4000, c.sw rd', offset(rs') if op is 0xc000
+    asm_rv32_op16(as, op | ((offset & 0x38) << 7) | (RVC_REG(rs) << 7) | ((offset & 0x4) << 4) | ((offset & 0x40) >> 1) | (RVC_REG(rd) << 2));
+}
+
+static void asm_rv32_add_sp(asm_rv32_t *as, int imm) {
+    if (imm != 0 && (imm & 0xf) == 0 && imm >= -512 && imm < 512) {
+        // c.addi16sp imm
+        asm_rv32_op16(as, 0x6101 | ((imm & 0x200) << 3) | ((imm & 0x10) << 2) | ((imm & 0x40) >> 1) | ((imm & 0x180) >> 4) | ((imm & 0x20) >> 3));
+    } else if (SIGNED_FIT12(imm)) {
+        asm_rv32_op_addi(as, ASM_RV32_REG_SP, ASM_RV32_REG_SP, imm);
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, ASM_RV32_REG_TEMP, imm);
+        asm_rv32_add_reg_reg(as, ASM_RV32_REG_SP, ASM_RV32_REG_TEMP);
+    }
+}
+
+// locals:
+//  - stored on the stack in ascending order
+//  - numbered 0 through num_locals-1
+//  - SP points to the saved registers, locals come straight after them
+//
+//  | SP
+//  v
+//  ra  s1  s2  s3  s4  l0  l1  ...  l(n-1)
+//  ^                                ^
+//  | low address                    | high address in RAM
+
+void asm_rv32_entry(asm_rv32_t *as, int num_locals) {
+    assert(num_locals >= 0);
+
+    // stack must stay 16-byte aligned
+    as->stack_adjust = ((ASM_RV32_NUM_REGS_SAVED + num_locals) * WORD_SIZE + 15) & ~15;
+
+    asm_rv32_add_sp(as, -(int)as->stack_adjust);
+    asm_rv32_op_c_swsp(as, ASM_RV32_REG_RA, 0 * WORD_SIZE);
+    asm_rv32_op_c_swsp(as, ASM_RV32_REG_S1, 1 * WORD_SIZE);
+    asm_rv32_op_c_swsp(as, ASM_RV32_REG_S2, 2 * WORD_SIZE);
+    asm_rv32_op_c_swsp(as, ASM_RV32_REG_S3, 3 * WORD_SIZE);
+    asm_rv32_op_c_swsp(as, ASM_RV32_REG_S4, 4 * WORD_SIZE);
+}
+
+void asm_rv32_exit(asm_rv32_t *as) {
+    asm_rv32_op_c_lwsp(as, ASM_RV32_REG_RA, 0 * WORD_SIZE);
+    asm_rv32_op_c_lwsp(as, ASM_RV32_REG_S1, 1 * WORD_SIZE);
+    asm_rv32_op_c_lwsp(as, ASM_RV32_REG_S2, 2 * WORD_SIZE);
+    asm_rv32_op_c_lwsp(as, ASM_RV32_REG_S3, 3 * WORD_SIZE);
+    asm_rv32_op_c_lwsp(as, ASM_RV32_REG_S4, 4 * WORD_SIZE);
+    asm_rv32_add_sp(as, as->stack_adjust);
+    asm_rv32_jr_reg(as, ASM_RV32_REG_RA);
+}
+
+void asm_rv32_add_reg_reg(asm_rv32_t *as, uint rd, uint rs) {
+    // c.add rd, rs
+    asm_rv32_op16(as, 0x9002 | (rd << 7) | (rs << 2));
+}
+
+void asm_rv32_alu_reg_reg(asm_rv32_t *as, uint f3, uint rd, uint rs) {
+    if (IS_RVC_REG(rd) && IS_RVC_REG(rs)) {
+        // c.sub, c.xor, c.or or c.and rd', rs'
+        static const uint8_t c_funct2[8] = { 0, 0, 0, 0, 1, 0, 2, 3 };
+        asm_rv32_op16(as, 0x8c01 | (RVC_REG(rd) << 7) | (c_funct2[f3] << 5) | (RVC_REG(rs) << 2));
+    } else {
+        asm_rv32_op_r(as, f3, f3 == 0 ? 0x20 : 0, rd, rd, rs);
+    }
+}
+
+void asm_rv32_mov_reg_reg(asm_rv32_t *as, uint rd, uint rs) {
+    if (rs == ASM_RV32_REG_ZERO) {
+        asm_rv32_op_c_li(as, rd, 0);
+    } else {
+        // c.mv rd, rs
+        asm_rv32_op16(as, 0x8002 | (rd << 7) | (rs << 2));
+    }
+}
+
+void asm_rv32_jr_reg(asm_rv32_t *as, uint rs) {
+    // c.jr rs
+    asm_rv32_op16(as, 0x8002 | (rs << 7));
+}
+
+void asm_rv32_mov_reg_i32_optimised(asm_rv32_t *as, uint rd, uint32_t i32) {
+    if (SIGNED_FIT6(i32)) {
+        asm_rv32_op_c_li(as, rd, i32);
+    } else if (SIGNED_FIT12(i32)) {
+        asm_rv32_op_addi(as, rd, ASM_RV32_REG_ZERO, i32);
+    } else {
+        int32_t lo = LO12(i32);
+        // lui rd, hi20
+        asm_rv32_op32(as, ASM_RV32_ENCODE_U(ASM_RV32_OPCODE_LUI, rd, i32 - lo));
+        if (lo == 0) {
+            // nothing more to do
+        } else if (SIGNED_FIT6(lo)) {
+            asm_rv32_op_c_addi(as, rd, lo);
+        } else {
+            asm_rv32_op_addi(as, rd, rd, lo);
+        }
+    }
+}
+
+void asm_rv32_load_reg_reg_offset(asm_rv32_t *as, uint width, uint rd, uint rs, int offset) {
+    if (width == 2 && IS_RVC_REG(rd) && IS_RVC_REG(rs) && (offset & ~0x7c) == 0) {
+        asm_rv32_op_c_lw_sw(as, 0x4000, rd, rs, offset);
+    } else if (width == 2 && rs == ASM_RV32_REG_SP && (offset & ~0xfc) == 0) {
+        asm_rv32_op_c_lwsp(as, rd, offset);
+    } else if (SIGNED_FIT12(offset)) {
+        asm_rv32_op32(as, ASM_RV32_ENCODE_I(ASM_RV32_OPCODE_LOAD, width, rd, rs, offset));
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, ASM_RV32_REG_TEMP, offset);
+        asm_rv32_add_reg_reg(as, ASM_RV32_REG_TEMP, rs);
+        asm_rv32_op32(as, ASM_RV32_ENCODE_I(ASM_RV32_OPCODE_LOAD, width, rd, ASM_RV32_REG_TEMP, 0));
+    }
+}
+
+void asm_rv32_store_reg_reg_offset(asm_rv32_t *as, uint width, uint rs_val, uint rs_base, int offset) {
+    if (width == 2 && IS_RVC_REG(rs_val) && IS_RVC_REG(rs_base) && (offset & ~0x7c) == 0) {
+        asm_rv32_op_c_lw_sw(as, 0xc000, rs_val, rs_base, offset);
+    } else if (width == 2 && rs_base == ASM_RV32_REG_SP && (offset & ~0xfc) == 0) {
+        asm_rv32_op_c_swsp(as, rs_val, offset);
+    } else if (SIGNED_FIT12(offset)) {
+        asm_rv32_op32(as, ASM_RV32_ENCODE_S(ASM_RV32_OPCODE_STORE, width, rs_base, rs_val, offset));
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, ASM_RV32_REG_TEMP, offset);
+        asm_rv32_add_reg_reg(as, ASM_RV32_REG_TEMP, rs_base);
+        asm_rv32_op32(as, ASM_RV32_ENCODE_S(ASM_RV32_OPCODE_STORE, width, ASM_RV32_REG_TEMP, rs_val, 0));
+    }
+}
+
+void asm_rv32_mov_local_reg(asm_rv32_t *as, int local_num, uint rs) {
+    asm_rv32_store_reg_reg_offset(as, 2, rs, ASM_RV32_REG_SP, (ASM_RV32_NUM_REGS_SAVED + local_num) * WORD_SIZE);
+}
+
+void asm_rv32_mov_reg_local(asm_rv32_t *as, uint rd, int local_num) {
+    asm_rv32_load_reg_reg_offset(as, 2, rd, ASM_RV32_REG_SP, (ASM_RV32_NUM_REGS_SAVED + local_num) * WORD_SIZE);
+}
+
+void asm_rv32_mov_reg_local_addr(asm_rv32_t *as, uint rd, int local_num) {
+    uint offset = (ASM_RV32_NUM_REGS_SAVED + local_num) * WORD_SIZE;
+    if (IS_RVC_REG(rd) && offset < 1024) {
+        // c.addi4spn rd', sp, offset
+        asm_rv32_op16(as, 0x0000 | ((offset & 0x30) << 7) | ((offset & 0x3c0) << 1) | ((offset & 0x4) << 4) | ((offset & 0x8) << 2) | (RVC_REG(rd) << 2));
+    } else if (SIGNED_FIT12(offset)) {
+        asm_rv32_op_addi(as, rd, ASM_RV32_REG_SP, offset);
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, rd, offset);
+        asm_rv32_add_reg_reg(as, rd, ASM_RV32_REG_SP);
+    }
+}
+
+void asm_rv32_mov_reg_pcrel(asm_rv32_t *as, uint rd, uint label) {
+    assert(label < as->base.max_num_labels);
+    mp_uint_t dest = as->base.label_offsets[label];
+    int32_t rel = dest - as->base.code_offset;
+    int32_t lo = LO12(rel);
+    // auipc rd, hi20; addi rd, rd, lo12
+    // Always a fixed size because the label may still be unknown in the compute pass.
+    asm_rv32_op32(as, ASM_RV32_ENCODE_U(ASM_RV32_OPCODE_AUIPC, rd, rel - lo));
+    asm_rv32_op_addi(as, rd, rd, lo);
+}
+
+void asm_rv32_setcc_reg_reg_reg(asm_rv32_t *as, uint cond, uint rd, uint rs1, uint rs2) {
+    // rd must be different from rs1 and rs2
+    switch (cond) {
+        case ASM_RV32_CC_EQ:
+            asm_rv32_op_sub(as, rd, rs1, rs2);
+            asm_rv32_op_sltiu(as, rd, rd, 1); // seqz rd, rd
+            break;
+        case ASM_RV32_CC_NE:
+            asm_rv32_op_sub(as, rd, rs1, rs2);
+            asm_rv32_op_sltu(as, rd, ASM_RV32_REG_ZERO, rd); // snez rd, rd
+            break;
+        case ASM_RV32_CC_LT:
+        case ASM_RV32_CC_GE:
+            asm_rv32_op_slt(as, rd, rs1, rs2);
+            break;
+        default:
+            asm_rv32_op_sltu(as, rd, rs1, rs2);
+            break;
+    }
+    if (cond == ASM_RV32_CC_GE || cond == ASM_RV32_CC_GEU) {
+        asm_rv32_op_xori(as, rd, rd, 1);
+    }
+}
+
+// A label is only known in the compute pass if it is a backwards jump, and the
+// same test gives the same answer in the emit pass, so the code size is stable.
+static bool asm_rv32_is_backwards_label(asm_rv32_t *as, uint label, int32_t *rel) {
+    assert(label < as->base.max_num_labels);
+    mp_uint_t dest = as->base.label_offsets[label];
+    *rel = dest - as->base.code_offset;
+    return dest != (mp_uint_t)-1 && *rel <= 0;
+}
+
+static void asm_rv32_op_jal_zero(asm_rv32_t *as, int32_t rel) {
+    if (as->base.pass == MP_ASM_PASS_EMIT && !SIGNED_FIT21(rel)) {
+        printf("ERROR: rv32 jump out of range\n");
+    }
+    asm_rv32_op32(as, ASM_RV32_ENCODE_J(ASM_RV32_REG_ZERO, rel));
+}
+
+void asm_rv32_j_label(asm_rv32_t *as, uint label) {
+    int32_t rel;
+    if (asm_rv32_is_backwards_label(as, label, &rel) && SIGNED_FIT12(rel)) {
+        // c.j rel
+        asm_rv32_op16(as, 0xa001 | ((rel & 0x800) << 1) | ((rel & 0x10) << 7) | ((rel & 0x300) << 1)
+            | ((rel & 0x400) >> 2) | ((rel & 0x40) << 1) | ((rel & 0x80) >> 1) | ((rel & 0xe) << 2) | ((rel & 0x20) >> 3));
+    } else {
+        asm_rv32_op_jal_zero(as, rel);
+    }
+}
+
+void asm_rv32_bcc_reg_reg_label(asm_rv32_t *as, uint cond, uint rs1, uint rs2, uint label) {
+    int32_t rel;
+    if (asm_rv32_is_backwards_label(as, label, &rel) && SIGNED_FIT13(rel)) {
+        asm_rv32_op32(as, ASM_RV32_ENCODE_B(cond, rs1, rs2, rel));
+        return;
+    }
+    // Branch over a jal using the inverted condition, for the +/-1MiB range of jal.
+    if (rs2 == ASM_RV32_REG_ZERO && IS_RVC_REG(rs1) && (cond == ASM_RV32_CC_EQ || cond == ASM_RV32_CC_NE)) {
+        // c.bnez rs1', 6 or c.beqz rs1', 6
+        asm_rv32_op16(as, (cond == ASM_RV32_CC_EQ ? 0xe019 : 0xc019) | (RVC_REG(rs1) << 7));
+        rel -= 2;
+    } else {
+        asm_rv32_op32(as, ASM_RV32_ENCODE_B(cond ^ 1, rs1, rs2, 8));
+        rel -= 4;
+    }
+    asm_rv32_op_jal_zero(as, rel);
+}
+
+void asm_rv32_call_ind(asm_rv32_t *as, uint idx) {
+    asm_rv32_load_reg_reg_offset(as, 2, ASM_RV32_REG_TEMP, ASM_RV32_REG_FUN_TABLE, idx * WORD_SIZE);
+    // c.jalr t0
+    asm_rv32_op16(as, 0x9002 | (ASM_RV32_REG_TEMP << 7));
+}
+
+#endif // MICROPY_EMIT_RV32
@@ -0,0 +1,261 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef MICROPY_INCLUDED_PY_ASMRV32_H
+#define MICROPY_INCLUDED_PY_ASMRV32_H
+
+#include "py/misc.h"
+#include "py/asmbase.h"
+
+// calling conventions (RV32 ILP32):
+// up to 8 args in a0-a7
+// return value in a0
+// return address in ra
+// stack pointer is sp, stack full descending, is aligned to 16 bytes
+// callee save: sp, s0-s11
+// caller save: everything else
+//
+// Code is generated for RV32IMC: the M extension provides mul, and 16-bit
+// compressed instructions are used wherever the operands allow it.
+
+#define ASM_RV32_REG_ZERO (0)
+#define ASM_RV32_REG_RA   (1)
+#define ASM_RV32_REG_SP   (2)
+#define ASM_RV32_REG_GP   (3)
+#define ASM_RV32_REG_TP   (4)
+#define ASM_RV32_REG_T0   (5)
+#define ASM_RV32_REG_T1   (6)
+#define ASM_RV32_REG_T2   (7)
+#define ASM_RV32_REG_S0   (8)
+#define ASM_RV32_REG_S1   (9)
+#define ASM_RV32_REG_A0   (10)
+#define ASM_RV32_REG_A1   (11)
+#define ASM_RV32_REG_A2   (12)
+#define ASM_RV32_REG_A3   (13)
+#define ASM_RV32_REG_A4   (14)
+#define ASM_RV32_REG_A5   (15)
+#define ASM_RV32_REG_A6   (16)
+#define ASM_RV32_REG_A7   (17)
+#define ASM_RV32_REG_S2   (18)
+#define ASM_RV32_REG_S3   (19)
+#define ASM_RV32_REG_S4   (20)
+#define ASM_RV32_REG_S5   (21)
+#define ASM_RV32_REG_S6   (22)
+#define ASM_RV32_REG_S7   (23)
+#define ASM_RV32_REG_S8   (24)
+#define ASM_RV32_REG_S9   (25)
+#define ASM_RV32_REG_S10  (26)
+#define ASM_RV32_REG_S11  (27)
+#define ASM_RV32_REG_T3   (28)
+#define ASM_RV32_REG_T4   (29)
+#define ASM_RV32_REG_T5   (30)
+#define ASM_RV32_REG_T6   (31)
+
+// Scratch register used internally by the assembler, never allocated by the emitter
+#define ASM_RV32_REG_TEMP ASM_RV32_REG_T0
+
+// for bcc and setcc (funct3 of the branch instruction)
+#define ASM_RV32_CC_EQ  (0)
+#define ASM_RV32_CC_NE  (1)
+#define ASM_RV32_CC_LT  (4)
+#define ASM_RV32_CC_GE  (5)
+#define ASM_RV32_CC_LTU (6)
+#define ASM_RV32_CC_GEU (7)
+
+// major opcodes
+#define ASM_RV32_OPCODE_LOAD   (0x03)
+#define ASM_RV32_OPCODE_OPIMM  (0x13)
+#define ASM_RV32_OPCODE_AUIPC  (0x17)
+#define ASM_RV32_OPCODE_STORE  (0x23)
+#define ASM_RV32_OPCODE_OP     (0x33)
+#define ASM_RV32_OPCODE_LUI    (0x37)
+#define ASM_RV32_OPCODE_BRANCH (0x63)
+#define ASM_RV32_OPCODE_JALR   (0x67)
+#define ASM_RV32_OPCODE_JAL    (0x6f)
+
+// macros for encoding instructions
+#define ASM_RV32_ENCODE_R(op, f3, f7, rd, rs1, rs2) \
+    (((uint32_t)(f7) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((f3) << 12) | ((rd) << 7) | (op))
+#define ASM_RV32_ENCODE_I(op, f3, rd, rs1, imm) \
+    ((((uint32_t)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((f3) << 12) | ((rd) << 7) | (op))
+#define ASM_RV32_ENCODE_S(op, f3, rs1, rs2, imm) \
+    ((((uint32_t)(imm) & 0xfe0) << 20) | ((rs2) << 20) | ((rs1) << 15) | ((f3) << 12) | (((imm) & 0x1f) << 7) | (op))
+#define ASM_RV32_ENCODE_B(f3, rs1, rs2, imm) \
+    ((((uint32_t)(imm) & 0x1000) << 19) | (((uint32_t)(imm) & 0x7e0) << 20) | ((rs2) << 20) | ((rs1) << 15) \
+    | ((f3) << 12) | (((imm) & 0x1e) << 7) | (((imm) & 0x800) >> 4) | ASM_RV32_OPCODE_BRANCH)
+#define ASM_RV32_ENCODE_U(op, rd, imm) \
+    (((uint32_t)(imm) & 0xfffff000) | ((rd) << 7) | (op))
+#define ASM_RV32_ENCODE_J(rd, imm) \
+    ((((uint32_t)(imm) & 0x100000) << 11) | (((uint32_t)(imm) & 0x7fe) << 20) | (((uint32_t)(imm) & 0x800) << 9) \
+    | ((uint32_t)(imm) & 0xff000) | ((rd) << 7) | ASM_RV32_OPCODE_JAL)
+
+// Number of registers saved on the stack upon entry to function (ra, s1-s4)
+#define ASM_RV32_NUM_REGS_SAVED (5)
+
+typedef struct _asm_rv32_t {
+    mp_asm_base_t base;
+    uint32_t stack_adjust;
+} asm_rv32_t;
+
+static inline void asm_rv32_end_pass(asm_rv32_t *as) {
+    (void)as;
+}
+
+void asm_rv32_entry(asm_rv32_t *as, int num_locals);
+void asm_rv32_exit(asm_rv32_t *as);
+
+void asm_rv32_op16(asm_rv32_t *as, uint16_t op);
+void asm_rv32_op32(asm_rv32_t *as, uint32_t op);
+
+static inline void asm_rv32_op_r(asm_rv32_t *as, uint f3, uint f7, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op32(as, ASM_RV32_ENCODE_R(ASM_RV32_OPCODE_OP, f3, f7, rd, rs1, rs2));
+}
+
+static inline void asm_rv32_op_addi(asm_rv32_t *as, uint rd, uint rs1, int imm) {
+    asm_rv32_op32(as, ASM_RV32_ENCODE_I(ASM_RV32_OPCODE_OPIMM, 0, rd, rs1, imm));
+}
+
+static inline void asm_rv32_op_xori(asm_rv32_t *as, uint rd, uint rs1, int imm) {
+    asm_rv32_op32(as, ASM_RV32_ENCODE_I(ASM_RV32_OPCODE_OPIMM, 4, rd, rs1, imm));
+}
+
+static inline void asm_rv32_op_sltiu(asm_rv32_t *as, uint rd, uint rs1, int imm) {
+    asm_rv32_op32(as, ASM_RV32_ENCODE_I(ASM_RV32_OPCODE_OPIMM, 3, rd, rs1, imm));
+}
+
+static inline void asm_rv32_op_sub(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 0, 0x20, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_sll(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 1, 0, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_slt(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 2, 0, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_sltu(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 3, 0, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_srl(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 5, 0, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_sra(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 5, 0x20, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_mul(asm_rv32_t *as, uint rd, uint rs1, uint rs2) {
+    asm_rv32_op_r(as, 0, 1, rd, rs1, rs2);
+}
+
+static inline void asm_rv32_op_jalr(asm_rv32_t *as, uint rd, uint rs1, int imm) {
+    asm_rv32_op32(as, ASM_RV32_ENCODE_I(ASM_RV32_OPCODE_JALR, 0, rd, rs1, imm));
+}
+
+// these pick the compressed form of the instruction when the operands allow it;
+// for alu_reg_reg, f3 selects sub (0), xor (4), or (6) or and (7)
+void asm_rv32_add_reg_reg(asm_rv32_t *as, uint rd, uint rs);
+void asm_rv32_alu_reg_reg(asm_rv32_t *as, uint f3, uint rd, uint rs);
+void asm_rv32_mov_reg_reg(asm_rv32_t *as, uint rd, uint rs);
+void asm_rv32_jr_reg(asm_rv32_t *as, uint rs);
+
+void asm_rv32_mov_reg_i32_optimised(asm_rv32_t *as, uint rd, uint32_t i32);
+void asm_rv32_mov_local_reg(asm_rv32_t *as, int local_num, uint rs);
+void asm_rv32_mov_reg_local(asm_rv32_t *as, uint rd, int local_num);
+void asm_rv32_mov_reg_local_addr(asm_rv32_t *as, uint rd, int local_num);
+void asm_rv32_mov_reg_pcrel(asm_rv32_t *as, uint rd, uint label);
+void asm_rv32_setcc_reg_reg_reg(asm_rv32_t *as, uint cond, uint rd, uint rs1, uint rs2);
+
+// width is the funct3 of the load/store: 0=byte, 1=half, 2=word, 4/5=unsigned byte/half (loads only)
+void asm_rv32_load_reg_reg_offset(asm_rv32_t *as, uint width, uint rd, uint rs, int offset);
+void asm_rv32_store_reg_reg_offset(asm_rv32_t *as, uint width, uint rs_val, uint rs_base, int offset);
+
+void asm_rv32_j_label(asm_rv32_t *as, uint label);
+void asm_rv32_bcc_reg_reg_label(asm_rv32_t *as, uint cond, uint rs1, uint rs2, uint label);
+void asm_rv32_call_ind(asm_rv32_t *as, uint idx);
+
+// Holds a pointer to mp_fun_table
+#define ASM_RV32_REG_FUN_TABLE ASM_RV32_REG_S1
+
+#if defined(GENERIC_ASM_API) && GENERIC_ASM_API
+
+// The following macros provide a (mostly) arch-independent API to
+// generate native code, and are used by the native emitter.
+
+#define ASM_WORD_SIZE (4)
+
+#define REG_RET ASM_RV32_REG_A0
+#define REG_ARG_1 ASM_RV32_REG_A0
+#define REG_ARG_2 ASM_RV32_REG_A1
+#define REG_ARG_3 ASM_RV32_REG_A2
+#define REG_ARG_4 ASM_RV32_REG_A3
+#define REG_ARG_5 ASM_RV32_REG_A4
+
+#define REG_TEMP0 ASM_RV32_REG_A0
+#define REG_TEMP1 ASM_RV32_REG_A1
+#define REG_TEMP2 ASM_RV32_REG_A2
+
+#define REG_LOCAL_1 ASM_RV32_REG_S2
+#define REG_LOCAL_2 ASM_RV32_REG_S3
+#define REG_LOCAL_3 ASM_RV32_REG_S4
+#define REG_LOCAL_NUM (3)
+
+// Holds a pointer to mp_fun_table
+#define REG_FUN_TABLE ASM_RV32_REG_FUN_TABLE
+
+#define ASM_T               asm_rv32_t
+#define ASM_END_PASS        asm_rv32_end_pass
+#define ASM_ENTRY           asm_rv32_entry
+#define ASM_EXIT            asm_rv32_exit
+
+#define ASM_JUMP            asm_rv32_j_label
+#define ASM_JUMP_IF_REG_ZERO(as, reg, label, bool_test) \
+    asm_rv32_bcc_reg_reg_label(as, ASM_RV32_CC_EQ, reg, ASM_RV32_REG_ZERO, label)
+#define ASM_JUMP_IF_REG_NONZERO(as, reg, label, bool_test) \
+    asm_rv32_bcc_reg_reg_label(as, ASM_RV32_CC_NE, reg, ASM_RV32_REG_ZERO, label)
+#define ASM_JUMP_IF_REG_EQ(as, reg1, reg2, label) \
+    asm_rv32_bcc_reg_reg_label(as, ASM_RV32_CC_EQ, reg1, reg2, label)
+#define ASM_JUMP_REG(as, reg) asm_rv32_jr_reg((as), (reg))
+#define ASM_CALL_IND(as, idx) asm_rv32_call_ind((as), (idx))
+
+#define ASM_MOV_LOCAL_REG(as, local_num, reg_src) asm_rv32_mov_local_reg((as), (local_num), (reg_src))
+#define ASM_MOV_REG_IMM(as, reg_dest, imm) asm_rv32_mov_reg_i32_optimised((as), (reg_dest), (imm))
+#define ASM_MOV_REG_LOCAL(as, reg_dest, local_num) asm_rv32_mov_reg_local((as), (reg_dest), (local_num))
+#define ASM_MOV_REG_REG(as, reg_dest, reg_src) asm_rv32_mov_reg_reg((as), (reg_dest), (reg_src))
+#define ASM_MOV_REG_LOCAL_ADDR(as, reg_dest, local_num) asm_rv32_mov_reg_local_addr((as), (reg_dest), (local_num))
+#define ASM_MOV_REG_PCREL(as, reg_dest, label) asm_rv32_mov_reg_pcrel((as), (reg_dest), (label))
+
+#define ASM_NOT_REG(as, reg_dest) asm_rv32_op_xori((as), (reg_dest), (reg_dest), -1)
+#define ASM_NEG_REG(as, reg_dest) asm_rv32_op_sub((as), (reg_dest), ASM_RV32_REG_ZERO, (reg_dest))
+#define ASM_LSL_REG_REG(as, reg_dest, reg_shift) asm_rv32_op_sll((as), (reg_dest), (reg_dest), (reg_shift))
+#define ASM_LSR_REG_REG(as, reg_dest, reg_shift) asm_rv32_op_srl((as), (reg_dest), (reg_dest), (reg_shift))
+#define ASM_ASR_REG_REG(as, reg_dest, reg_shift) asm_rv32_op_sra((as), (reg_dest), (reg_dest), (reg_shift))
+#define ASM_OR_REG_REG(as, reg_dest, reg_src) asm_rv32_alu_reg_reg((as), 6, (reg_dest), (reg_src))
+#define ASM_XOR_REG_REG(as, reg_dest, reg_src) asm_rv32_alu_reg_reg((as), 4, (reg_dest), (reg_src))
+#define ASM_AND_REG_REG(as, reg_dest, reg_src) asm_rv32_alu_reg_reg((as), 7, (reg_dest), (reg_src))
+#define ASM_ADD_REG_REG(as, reg_dest, reg_src) asm_rv32_add_reg_reg((as), (reg_dest), (reg_src))
+#define ASM_SUB_REG_REG(as, reg_dest, reg_src) asm_rv32_alu_reg_reg((as), 0, (reg_dest), (reg_src))
+#define ASM_MUL_REG_REG(as, reg_dest, reg_src) asm_rv32_op_mul((as), (reg_dest), (reg_dest), (reg_src))
+
+#define ASM_LOAD_REG_REG(as, reg_dest, reg_base) asm_rv32_load_reg_reg_offset((as), 2, (reg_dest), (reg_base), 0)
+#define ASM_LOAD_REG_REG_OFFSET(as, reg_dest, reg_base, word_offset) asm_rv32_load_reg_reg_offset((as), 2, (reg_dest), (reg_base), 4 * (word_offset))
+#define ASM_LOAD8_REG_REG(as, reg_dest, reg_base) asm_rv32_load_reg_reg_offset((as), 4, (reg_dest), (reg_base), 0)
+#define ASM_LOAD16_REG_REG(as, reg_dest, reg_base) asm_rv32_load_reg_reg_offset((as), 5, (reg_dest), (reg_base), 0)
+#define ASM_LOAD16_REG_REG_OFFSET(as, reg_dest, reg_base, uint16_offset) asm_rv32_load_reg_reg_offset((as), 5, (reg_dest), (reg_base), 2 * (uint16_offset))
+#define ASM_LOAD32_REG_REG(as, reg_dest, reg_base) asm_rv32_load_reg_reg_offset((as), 2, (reg_dest), (reg_base), 0)
+
+#define ASM_STORE_REG_REG(as, reg_value, reg_base) asm_rv32_store_reg_reg_offset((as), 2, (reg_value), (reg_base), 0)
+#define ASM_STORE_REG_REG_OFFSET(as, reg_value, reg_base, word_offset) asm_rv32_store_reg_reg_offset((as), 2, (reg_value), (reg_base), 4 * (word_offset))
+#define ASM_STORE8_REG_REG(as, reg_value, reg_base) asm_rv32_store_reg_reg_offset((as), 0, (reg_value), (reg_base), 0)
+#define ASM_STORE16_REG_REG(as, reg_value, reg_base) asm_rv32_store_reg_reg_offset((as), 1, (reg_value), (reg_base), 0)
+#define ASM_STORE32_REG_REG(as, reg_value, reg_base) asm_rv32_store_reg_reg_offset((as), 2, (reg_value), (reg_base), 0)
+
+#endif // GENERIC_ASM_API
+
+#endif // MICROPY_INCLUDED_PY_ASMRV32_H
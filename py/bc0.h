@@ -159,4 +159,17 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// CIRCUITPY-CHANGE: superinstructions, see MICROPY_OPT_SUPERINSTRUCTIONS.
+// These are only ever generated by the runtime compiler, never stored in .mpy files.
+#define MP_BC_LOAD_FAST_0_ATTR              (MP_BC_BASE_QSTR_O + 0x0d) // qstr; LOAD_FAST 0, LOAD_ATTR
+#define MP_BC_LOAD_FAST_0_METHOD            (MP_BC_BASE_QSTR_O + 0x0e) // qstr; LOAD_FAST 0, LOAD_METHOD
+#define MP_BC_BINARY_OP_SMALL_INT_MULTI     (MP_BC_BASE_VINT_O + 0x08) // signed var-int; LOAD_CONST_SMALL_INT, BINARY_OP
+#define MP_BC_BINARY_OP_SMALL_INT_MULTI_NUM (6)
+
+// The binary operations that have a MP_BC_BINARY_OP_SMALL_INT_MULTI form, in order.
+#define MP_BC_BINARY_OP_SMALL_INT_OPS { \
+        MP_BINARY_OP_ADD, MP_BINARY_OP_SUBTRACT, MP_BINARY_OP_INPLACE_ADD, \
+        MP_BINARY_OP_LESS, MP_BINARY_OP_MORE, MP_BINARY_OP_EQUAL, \
+}
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -69,6 +69,17 @@ MP_DECLARE_CONST_FUN_OBJ_KW(mp_builtin_open_obj);
 #define mp_builtin___import__ mp_builtin___import___default
 #endif
 mp_obj_t mp_builtin___import__(size_t n_args, const mp_obj_t *args);
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_PATH_CACHE
+// Forget where modules were found, because a filesystem changed.
+void mp_module_path_cache_invalidate(void);
+#endif
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_RETAIN
+// Free retained modules that are out of date or weren't imported since the
+// last call. Call once the VM heap is gone.
+void mp_module_retain_collect(void);
+#endif
 mp_obj_t mp_builtin___import___default(size_t n_args, const mp_obj_t *args);
 
 mp_obj_t mp_micropython_mem_info(size_t n_args, const mp_obj_t *args);
@@ -38,6 +38,15 @@
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/frozenmod.h"
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#include "genhdr/mpversion.h"
+#endif
+#if MICROPY_MODULE_RETAIN
+#include <stdlib.h>
+#endif
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -113,6 +122,109 @@ static mp_import_stat_t stat_module(vstr_t *path) {
     return stat_file_py_or_mpy(path);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_PATH_CACHE
+// Where modules were found is remembered across soft reloads, so that imports
+// after the first run don't stat each sys.path entry again. Each record is the
+// length of its key, its kind, a sys.path index and the stat result with the
+// extension found, followed by the key: the name of a top-level module, or the
+// path given to stat_module() or stat_file_py_or_mpy(). Any write to or mount
+// of a filesystem, a change of directory, or a change to sys.path clears it.
+enum {
+    PATH_CACHE_TOP_LEVEL,
+    PATH_CACHE_MODULE,
+    PATH_CACHE_FILE,
+};
+#define PATH_CACHE_RECORD_HEADER (4)
+#define PATH_CACHE_STAT_MASK (0x03)
+#define PATH_CACHE_MPY (0x04)
+
+static struct {
+    uint32_t sys_path_hash;
+    // Bumped by each invalidation, so that a result found by a stat that
+    // raced with a change isn't stored.
+    volatile uint32_t generation;
+    volatile size_t used;
+    byte data[MICROPY_MODULE_PATH_CACHE];
+} path_cache;
+
+void mp_module_path_cache_invalidate(void) {
+    path_cache.used = 0;
+    path_cache.generation++;
+}
+
+static bool path_cache_lookup(byte kind, const char *key, size_t len, byte *index, byte *result) {
+    size_t used = path_cache.used;
+    for (size_t pos = 0; pos < used; pos += PATH_CACHE_RECORD_HEADER + path_cache.data[pos]) {
+        const byte *record = &path_cache.data[pos];
+        if (record[0] == len && record[1] == kind && memcmp(record + PATH_CACHE_RECORD_HEADER, key, len) == 0) {
+            *index = record[2];
+            *result = record[3];
+            return true;
+        }
+    }
+    return false;
+}
+
+static void path_cache_store(uint32_t generation, byte kind, const char *key, size_t len, byte index, mp_import_stat_t stat, vstr_t *path) {
+    size_t used = path_cache.used;
+    if (len > 255 || used + PATH_CACHE_RECORD_HEADER + len > sizeof(path_cache.data)) {
+        return;
+    }
+    byte *record = &path_cache.data[used];
+    record[0] = len;
+    record[1] = kind;
+    record[2] = index;
+    record[3] = stat;
+    if (stat == MP_IMPORT_STAT_FILE && vstr_len(path) >= 4
+        && memcmp(vstr_str(path) + vstr_len(path) - 4, ".mpy", 4) == 0) {
+        record[3] |= PATH_CACHE_MPY;
+    }
+    memcpy(record + PATH_CACHE_RECORD_HEADER, key, len);
+    if (generation == path_cache.generation) {
+        path_cache.used = used + PATH_CACHE_RECORD_HEADER + len;
+    }
+}
+
+// Like stat_module(), but remembers the result.
+static mp_import_stat_t stat_module_cached(vstr_t *path) {
+    byte index;
+    byte result;
+    if (path_cache_lookup(PATH_CACHE_MODULE, vstr_str(path), vstr_len(path), &index, &result)) {
+        if ((result & PATH_CACHE_STAT_MASK) == MP_IMPORT_STAT_FILE) {
+            vstr_add_str(path, result & PATH_CACHE_MPY ? ".mpy" : ".py");
+        }
+        return result & PATH_CACHE_STAT_MASK;
+    }
+    uint32_t generation = path_cache.generation;
+    size_t len = vstr_len(path);
+    mp_import_stat_t stat = stat_module(path);
+    path_cache_store(generation, PATH_CACHE_MODULE, vstr_str(path), len, 0, stat, path);
+    return stat;
+}
+
+// Like stat_file_py_or_mpy(), but remembers the result.
+static mp_import_stat_t stat_file_py_or_mpy_cached(vstr_t *path) {
+    // The key leaves out the ".py", so that it is also a prefix of the .mpy path.
+    size_t len = vstr_len(path) - 3;
+    byte index;
+    byte result;
+    if (path_cache_lookup(PATH_CACHE_FILE, vstr_str(path), len, &index, &result)) {
+        if (result & PATH_CACHE_MPY) {
+            vstr_ins_byte(path, path->len - 2, 'm');
+        }
+        return result & PATH_CACHE_STAT_MASK;
+    }
+    uint32_t generation = path_cache.generation;
+    mp_import_stat_t stat = stat_file_py_or_mpy(path);
+    path_cache_store(generation, PATH_CACHE_FILE, vstr_str(path), len, 0, stat, path);
+    return stat;
+}
+#else
+#define stat_module_cached stat_module
+#define stat_file_py_or_mpy_cached stat_file_py_or_mpy
+#endif
+
 // Given a top-level module name, try and find it in each of the sys.path
 // entries. Note: On success, the dest argument will be updated to the matching
 // path (i.e. "<entry>/mod_name(.py)").
@@ -123,6 +235,43 @@ static mp_import_stat_t stat_top_level(qstr mod_name, vstr_t *dest) {
     mp_obj_t *path_items;
     mp_obj_get_array(mp_sys_path, &path_num, &path_items);
 
+    // CIRCUITPY-CHANGE: look up where the module was found before, if sys.path
+    // is the same.
+    #if MICROPY_MODULE_PATH_CACHE
+    size_t name_len;
+    const char *name = (const char *)qstr_data(mod_name, &name_len);
+    uint32_t sys_path_hash = path_num;
+    for (size_t i = 0; i < path_num; i++) {
+        size_t p_len;
+        const byte *p = (const byte *)mp_obj_str_get_data(path_items[i], &p_len);
+        sys_path_hash = sys_path_hash * 33 + qstr_compute_hash(p, p_len);
+    }
+    if (sys_path_hash != path_cache.sys_path_hash) {
+        mp_module_path_cache_invalidate();
+        path_cache.sys_path_hash = sys_path_hash;
+    }
+    uint32_t generation = path_cache.generation;
+    byte index;
+    byte result;
+    if (path_cache_lookup(PATH_CACHE_TOP_LEVEL, name, name_len, &index, &result)) {
+        mp_import_stat_t stat = result & PATH_CACHE_STAT_MASK;
+        if (stat != MP_IMPORT_STAT_NO_EXIST) {
+            vstr_reset(dest);
+            size_t p_len;
+            const char *p = mp_obj_str_get_data(path_items[index], &p_len);
+            if (p_len > 0) {
+                vstr_add_strn(dest, p, p_len);
+                vstr_add_char(dest, PATH_SEP_CHAR[0]);
+            }
+            vstr_add_strn(dest, name, name_len);
+            if (stat == MP_IMPORT_STAT_FILE) {
+                vstr_add_str(dest, result & PATH_CACHE_MPY ? ".mpy" : ".py");
+            }
+        }
+        return stat;
+    }
+    #endif
+
     // go through each sys.path entry, trying to import "<entry>/<mod_name>".
     for (size_t i = 0; i < path_num; i++) {
         vstr_reset(dest);
@@ -136,10 +285,21 @@ static mp_import_stat_t stat_top_level(qstr mod_name, vstr_t *dest) {
         vstr_add_str(dest, qstr_str(mod_name));
         mp_import_stat_t stat = stat_module(dest);
         if (stat != MP_IMPORT_STAT_NO_EXIST) {
+            // CIRCUITPY-CHANGE
+            #if MICROPY_MODULE_PATH_CACHE
+            if (i < 256) {
+                path_cache_store(generation, PATH_CACHE_TOP_LEVEL, name, name_len, i, stat, dest);
+            }
+            #endif
             return stat;
         }
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MODULE_PATH_CACHE
+    path_cache_store(generation, PATH_CACHE_TOP_LEVEL, name, name_len, 0, MP_IMPORT_STAT_NO_EXIST, dest);
+    #endif
+
     // sys.path was empty or no matches, do not search the filesystem or
     // frozen code.
     return MP_IMPORT_STAT_NO_EXIST;
@@ -162,7 +322,12 @@ static void do_load_from_lexer(mp_module_context_t *context, mp_lexer_t *lex) {
 
     // parse, compile and execute the module in its context
     mp_obj_dict_t *mod_globals = context->module.globals;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_INCREMENTAL
+    mp_parse_compile_execute_incremental(lex, mod_globals);
+    #else
     mp_parse_compile_execute(lex, MP_PARSE_FILE_INPUT, mod_globals, mod_globals);
+    #endif
 }
 #endif
 
@@ -198,6 +363,258 @@ static void do_execute_proto_fun(const mp_module_context_t *context, mp_proto_fu
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+// A compiled "<dir>/<name>.py" is cached in "<dir>/__pycache__/<name>.mpy". The
+// .mpy data follows a header of the magic string below (which names the firmware
+// build, because the bytecode may use opcodes private to it) and the size and
+// mtime of the source, each as 4 little-endian bytes. The cache is stale if any
+// of them differ.
+#define COMPILE_CACHE_DIR "__pycache__"
+#define COMPILE_CACHE_KEY_LEN (8)
+#if MICROPY_OPT_SUPERINSTRUCTIONS
+#define COMPILE_CACHE_FEATURES " superinstructions"
+#else
+#define COMPILE_CACHE_FEATURES ""
+#endif
+static const char compile_cache_magic[] = "CPYC " MICROPY_GIT_TAG " " MICROPY_GIT_HASH " " MICROPY_BUILD_DATE COMPILE_CACHE_FEATURES;
+
+static void compile_cache_path(vstr_t *cache_path, const char *file_str, size_t file_len) {
+    const char *base = strrchr(file_str, PATH_SEP_CHAR[0]);
+    base = base == NULL ? file_str : base + 1;
+    vstr_init(cache_path, file_len + sizeof(COMPILE_CACHE_DIR) + 2);
+    vstr_add_strn(cache_path, file_str, base - file_str);
+    vstr_add_str(cache_path, COMPILE_CACHE_DIR);
+    vstr_add_char(cache_path, PATH_SEP_CHAR[0]);
+    // "<name>.py" becomes "<name>.mpy"
+    vstr_add_strn(cache_path, base, file_str + file_len - base - 2);
+    vstr_add_str(cache_path, "mpy");
+}
+
+static bool compile_cache_get_key(qstr file_qstr, byte *key) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(mp_vfs_stat(MP_OBJ_NEW_QSTR(file_qstr)), 10, &items);
+        uint32_t size = mp_obj_get_int_truncated(items[6]);
+        uint32_t mtime = mp_obj_get_int_truncated(items[8]);
+        nlr_pop();
+        for (size_t i = 0; i < 4; ++i) {
+            key[i] = size >> (8 * i);
+            key[4 + i] = mtime >> (8 * i);
+        }
+        return true;
+    }
+    return false;
+}
+
+static bool compile_cache_load(const char *cache_path, const byte *key, mp_compiled_module_t *cm) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, qstr_from_str(cache_path));
+        // Close the reader if reading the header raises.
+        MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader.close, reader.data);
+        nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+        bool match = true;
+        for (size_t i = 0; i < sizeof(compile_cache_magic) + COMPILE_CACHE_KEY_LEN; ++i) {
+            byte expected = i < sizeof(compile_cache_magic) ? compile_cache_magic[i] : key[i - sizeof(compile_cache_magic)];
+            if (reader.readbyte(reader.data) != expected) {
+                match = false;
+                break;
+            }
+        }
+        if (!match) {
+            nlr_pop_jump_callback(true);
+            nlr_pop();
+            return false;
+        }
+        // mp_raw_code_load() closes the reader, whether or not it raises.
+        nlr_pop_jump_callback(false);
+        mp_raw_code_load(&reader, cm);
+        nlr_pop();
+        return true;
+    }
+    // The cache doesn't exist or can't be read.
+    return false;
+}
+
+static void compile_cache_close(void *file) {
+    mp_stream_close(MP_OBJ_FROM_PTR(file));
+}
+
+// Errors, eg because the filesystem is read-only or full, are ignored so the
+// module runs without a cache.
+static void compile_cache_save(vstr_t *cache_path, const byte *key, mp_compiled_module_t *cm) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // Create the cache directory if needed.
+        char *sep = strrchr(vstr_null_terminated_str(cache_path), PATH_SEP_CHAR[0]);
+        mp_obj_t dir = mp_obj_new_str(cache_path->buf, sep - cache_path->buf);
+        if (mp_import_stat(mp_obj_str_get_str(dir)) != MP_IMPORT_STAT_DIR) {
+            mp_vfs_mkdir(dir);
+        }
+
+        mp_obj_t args[2] = {
+            mp_obj_new_str(cache_path->buf, cache_path->len),
+            MP_OBJ_NEW_QSTR(MP_QSTR_wb),
+        };
+        mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+        // Close the file if writing it raises, as well as when it's done.
+        MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, compile_cache_close, MP_OBJ_TO_PTR(file));
+        nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+
+        // Write a blank magic until the data is complete, so a partly written
+        // cache is never used.
+        static const byte blank[sizeof(compile_cache_magic)] = {0};
+        mp_stream_write(file, blank, sizeof(blank), MP_STREAM_RW_WRITE);
+        mp_stream_write(file, key, COMPILE_CACHE_KEY_LEN, MP_STREAM_RW_WRITE);
+        mp_raw_code_save(cm, &print);
+        int errcode;
+        if (mp_stream_seek(file, 0, MP_SEEK_SET, &errcode) != (mp_off_t)-1) {
+            mp_stream_write(file, compile_cache_magic, sizeof(compile_cache_magic), MP_STREAM_RW_WRITE);
+        }
+        nlr_pop_jump_callback(true);
+        nlr_pop();
+    }
+}
+
+void mp_compile_cache_load_or_compile(qstr file_qstr, mp_compiled_module_t *cm) {
+    const char *file_str = qstr_str(file_qstr);
+    byte key[COMPILE_CACHE_KEY_LEN];
+    bool have_key = compile_cache_get_key(file_qstr, key);
+    vstr_t cache_path;
+    compile_cache_path(&cache_path, file_str, strlen(file_str));
+
+    if (!have_key || !compile_cache_load(vstr_null_terminated_str(&cache_path), key, cm)) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, file_qstr, false, cm);
+        // Native code is linked to this heap, so can't be saved.
+        if (have_key && !cm->has_native) {
+            compile_cache_save(&cache_path, key, cm);
+        }
+    }
+    vstr_clear(&cache_path);
+}
+
+static void do_load_with_compile_cache(mp_module_context_t *context, qstr file_qstr) {
+    mp_compiled_module_t cm;
+    cm.context = context;
+    mp_compile_cache_load_or_compile(file_qstr, &cm);
+    do_execute_proto_fun(context, cm.rc, file_qstr);
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_RETAIN
+// The compiled code of library modules is kept as .mpy data outside the VM
+// heap, so that imports after a soft reload neither read the filesystem nor
+// compile. Each module is validated by the size and mtime of its file, like the
+// compile cache. The bytecode and qstr data are used in place, so a module is
+// only freed once the VM that may be running it has ended.
+typedef struct _retained_module_t {
+    struct _retained_module_t *next;
+    size_t len;
+    byte key[COMPILE_CACHE_KEY_LEN];
+    // Imported since the last collection.
+    bool used;
+    // Replaced by a newer version of the file.
+    bool stale;
+    // The .mpy data follows the null terminated path.
+    char path[];
+} retained_module_t;
+
+static retained_module_t *retained_modules;
+static size_t retained_size;
+
+static byte *retained_module_data(retained_module_t *m) {
+    return (byte *)m->path + strlen(m->path) + 1;
+}
+
+static void retain_module(const char *file_str, const byte *key, mp_compiled_module_t *cm) {
+    // Native code is linked to this heap, so can't be kept.
+    if (cm->has_native) {
+        return;
+    }
+    vstr_t vstr;
+    mp_print_t print;
+    vstr_init_print(&vstr, 256, &print);
+    mp_raw_code_save(cm, &print);
+    size_t path_len = strlen(file_str) + 1;
+    size_t size = sizeof(retained_module_t) + path_len + vstr.len;
+    retained_module_t *m = NULL;
+    if (retained_size + size <= MICROPY_MODULE_RETAIN) {
+        m = MICROPY_MODULE_RETAIN_ALLOC(size);
+    }
+    if (m != NULL) {
+        m->len = vstr.len;
+        memcpy(m->key, key, COMPILE_CACHE_KEY_LEN);
+        m->used = true;
+        m->stale = false;
+        memcpy(m->path, file_str, path_len);
+        memcpy(retained_module_data(m), vstr.buf, vstr.len);
+        m->next = retained_modules;
+        retained_modules = m;
+        retained_size += size;
+    }
+    vstr_clear(&vstr);
+}
+
+// Loads and executes a module from a file under MICROPY_MODULE_RETAIN_PREFIX,
+// from its retained code if that is up to date. Returns false for other files.
+static bool do_load_retained(mp_module_context_t *context, const char *file_str, qstr file_qstr) {
+    if (strncmp(file_str, MICROPY_MODULE_RETAIN_PREFIX, strlen(MICROPY_MODULE_RETAIN_PREFIX)) != 0) {
+        return false;
+    }
+    byte key[COMPILE_CACHE_KEY_LEN];
+    if (!compile_cache_get_key(file_qstr, key)) {
+        return false;
+    }
+    mp_compiled_module_t cm;
+    cm.context = context;
+    for (retained_module_t *m = retained_modules; m != NULL; m = m->next) {
+        if (m->stale || strcmp(m->path, file_str) != 0) {
+            continue;
+        }
+        if (memcmp(m->key, key, COMPILE_CACHE_KEY_LEN) == 0) {
+            m->used = true;
+            mp_reader_t reader;
+            mp_reader_new_mem(&reader, retained_module_data(m), m->len, MP_READER_IS_ROM);
+            mp_raw_code_load(&reader, &cm);
+            do_execute_proto_fun(context, cm.rc, file_qstr);
+            return true;
+        }
+        m->stale = true;
+    }
+
+    if (file_str[strlen(file_str) - 3] == 'm') {
+        mp_raw_code_load_file(file_qstr, &cm);
+    } else {
+        mp_compile_cache_load_or_compile(file_qstr, &cm);
+    }
+    retain_module(file_str, key, &cm);
+    do_execute_proto_fun(context, cm.rc, file_qstr);
+    return true;
+}
+
+void mp_module_retain_collect(void) {
+    retained_module_t **mp = &retained_modules;
+    while (*mp != NULL) {
+        retained_module_t *m = *mp;
+        if (m->stale || !m->used) {
+            *mp = m->next;
+            retained_size -= sizeof(retained_module_t) + strlen(m->path) + 1 + m->len;
+            MICROPY_MODULE_RETAIN_FREE(m);
+        } else {
+            m->used = false;
+            mp = &m->next;
+        }
+    }
+}
+#endif
+
 static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -242,6 +659,13 @@ static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
 
     qstr file_qstr = qstr_from_str(file_str);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MODULE_RETAIN
+    if (do_load_retained(module_obj, file_str, file_qstr)) {
+        return;
+    }
+    #endif
+
     // If we support loading .mpy files then check if the file extension is of
     // the correct format and, if so, load and execute the file.
     #if MICROPY_HAS_FILE_READER && MICROPY_PERSISTENT_CODE_LOAD
@@ -257,6 +681,13 @@ static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MODULE_COMPILE_CACHE
+        if (strncmp(file_str, MP_FROZEN_PATH_PREFIX, strlen(MP_FROZEN_PATH_PREFIX)) != 0) {
+            do_load_with_compile_cache(module_obj, file_qstr);
+            return;
+        }
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -443,7 +874,8 @@ static mp_obj_t process_import_at_level(qstr full_mod_name, qstr level_mod_name,
             vstr_add_char(&path, PATH_SEP_CHAR[0]);
             vstr_add_str(&path, qstr_str(level_mod_name));
 
-            stat = stat_module(&path);
+            // CIRCUITPY-CHANGE
+            stat = stat_module_cached(&path);
         }
     }
 
@@ -503,7 +935,8 @@ static mp_obj_t process_import_at_level(qstr full_mod_name, qstr level_mod_name,
         vstr_add_str(&path, PATH_SEP_CHAR "__init__.py");
 
         // execute "path/__init__.py" (if available).
-        if (stat_file_py_or_mpy(&path) == MP_IMPORT_STAT_FILE) {
+        // CIRCUITPY-CHANGE
+        if (stat_file_py_or_mpy_cached(&path) == MP_IMPORT_STAT_FILE) {
             do_load(MP_OBJ_TO_PTR(module_obj), &path);
         } else {
             // No-op. Nothing to load.
@@ -198,6 +198,9 @@ endif
 ifeq ($(CIRCUITPY_DISPLAYIO),1)
 SRC_PATTERNS += displayio/%
 endif
+ifeq ($(CIRCUITPY_DSP),1)
+SRC_PATTERNS += dsp/%
+endif
 ifeq ($(CIRCUITPY__EVE),1)
 SRC_PATTERNS += _eve/%
 endif
@@ -240,6 +243,9 @@ endif
 ifeq ($(CIRCUITPY_GNSS),1)
 SRC_PATTERNS += gnss/%
 endif
+ifeq ($(CIRCUITPY_GNSSIO),1)
+SRC_PATTERNS += gnssio/%
+endif
 ifeq ($(CIRCUITPY_HASHLIB),1)
 SRC_PATTERNS += hashlib/%
 endif
@@ -423,7 +429,7 @@ endif
 ifeq ($(CIRCUITPY_USB_MIDI),1)
 SRC_PATTERNS += usb_midi/%
 endif
-ifeq ($(CIRCUITPY_USB_VENDOR),1)
+ifeq ($(CIRCUITPY_USB_VENDOR_BULK),1)
 SRC_PATTERNS += usb_vendor/%
 endif
 ifeq ($(CIRCUITPY_USTACK),1)
@@ -594,6 +600,7 @@ $(filter $(SRC_PATTERNS), \
 	supervisor/StatusBar.c \
 	wifi/AuthMode.c \
 	wifi/Packet.c \
+	wifi/PowerManagement.c \
 )
 
 ifeq ($(CIRCUITPY_SAFEMODE_PY),1)
@@ -660,6 +667,8 @@ SRC_SHARED_MODULE_ALL = \
 	displayio/area.c \
 	displayio/__init__.c \
 	dotclockframebuffer/__init__.c \
+	dsp/__init__.c \
+	dsp/FIR.c \
 	epaperdisplay/__init__.c \
 	epaperdisplay/EPaperDisplay.c \
 	floppyio/__init__.c \
@@ -673,6 +682,9 @@ SRC_SHARED_MODULE_ALL = \
 	gifio/__init__.c \
 	gifio/GifWriter.c \
 	gifio/OnDiskGif.c \
+	gnssio/__init__.c \
+	gnssio/Fix.c \
+	gnssio/Receiver.c \
 	i2cdisplaybus/__init__.c \
 	i2cdisplaybus/I2CDisplayBus.c \
 	imagecapture/ParallelImageCapture.c \
@@ -694,6 +706,7 @@ SRC_SHARED_MODULE_ALL = \
 	memorymonitor/__init__.c \
 	memorymonitor/AllocationAlarm.c \
 	memorymonitor/AllocationSize.c \
+	mdns/__init__.c \
 	network/__init__.c \
 	msgpack/__init__.c \
 	onewireio/__init__.c \
@@ -717,6 +730,7 @@ SRC_SHARED_MODULE_ALL = \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
 	synthio/Biquad.c \
+	synthio/BiquadCascade.c \
 	synthio/BlockBiquad.c \
 	synthio/LFO.c \
 	synthio/Math.c \
@@ -732,6 +746,7 @@ SRC_SHARED_MODULE_ALL = \
 	usb/__init__.c \
 	usb/core/__init__.c \
 	usb/core/Device.c \
+	usb/core/Transfer.c \
 	ustack/__init__.c \
 	vectorio/Circle.c \
 	vectorio/Polygon.c \
@@ -741,6 +756,8 @@ SRC_SHARED_MODULE_ALL = \
 	warnings/__init__.c \
 	watchdog/__init__.c \
 	zlib/__init__.c \
+	zlib/Compress.c \
+	zlib/Decompress.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE = $(filter $(SRC_PATTERNS), $(SRC_SHARED_MODULE_ALL))
@@ -776,6 +793,41 @@ SRC_SHARED_MODULE_ALL += \
 	keypad_demux/DemuxKeyMatrix.c
 endif
 
+ifeq ($(CIRCUITPY_DIGITALIO_PINGROUP),1)
+SRC_SHARED_MODULE_ALL += \
+	digitalio/PinGroup.c
+endif
+
+ifeq ($(CIRCUITPY_COUNTIO_RECORDER),1)
+SRC_SHARED_MODULE_ALL += \
+	countio/CountRecorder.c
+endif
+
+ifeq ($(CIRCUITPY_PWMIO_PWMGROUP),1)
+SRC_COMMON_HAL_ALL += \
+	pwmio/PWMGroup.c
+endif
+
+ifeq ($(CIRCUITPY_I2CTARGET_REGISTERS),1)
+SRC_COMMON_HAL_ALL += \
+	i2ctarget/I2CRegisterTarget.c
+endif
+
+ifeq ($(CIRCUITPY_STORAGE_LOGFILE),1)
+SRC_SHARED_MODULE_ALL += \
+	storage/LogFile.c
+endif
+
+ifeq ($(CIRCUITPY_STORAGE_KEYVALUESTORE),1)
+SRC_SHARED_MODULE_ALL += \
+	storage/KeyValueStore.c
+endif
+
+ifeq ($(CIRCUITPY_STORAGE_PARTITION),1)
+SRC_SHARED_MODULE_ALL += \
+	storage/Partition.c
+endif
+
 # If supporting _bleio via HCI, make devices/ble_hci/common-hal/_bleio be includable,
 # and use C source files in devices/ble_hci/common-hal.
 ifeq ($(CIRCUITPY_BLEIO_HCI),1)
@@ -49,7 +49,10 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_OS_DUPTERM            (0)
 #define MICROPY_ROM_TEXT_COMPRESSION     (0)
 #define MICROPY_VFS_LFS1                 (0)
+// CIRCUITPY_LITTLEFS enables LFS2 via extmod.mk.
+#ifndef MICROPY_VFS_LFS2
 #define MICROPY_VFS_LFS2                 (0)
+#endif
 
 // Sorted alphabetically for easy finding.
 //
@@ -60,6 +63,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_CAN_OVERRIDE_BUILTINS    (1)
 #define MICROPY_COMP_CONST               (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
+#define MICROPY_COMP_JUMP_THREADING      (CIRCUITPY_FULL_BUILD)
 #define MICROPY_COMP_MODULE_CONST        (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
 #define MICROPY_DEBUG_PRINTERS           (0)
@@ -74,13 +78,27 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ENABLE_SOURCE_LINE       (1)
 #define MICROPY_EPOCH_IS_1970            (1)
 #define MICROPY_ERROR_REPORTING          (CIRCUITPY_FULL_BUILD ? MICROPY_ERROR_REPORTING_NORMAL : MICROPY_ERROR_REPORTING_TERSE)
+#define MICROPY_FLOAT_FAST_CONVERSION    (CIRCUITPY_FULL_BUILD)
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
+// gc.step() needs a microsecond clock for its time budget.
+#define MICROPY_GC_INCREMENTAL           (CIRCUITPY_FULL_BUILD && CIRCUITPY_TIME)
+#define MICROPY_GC_INCREMENTAL_TICKS_US() ((mp_uint_t)(common_hal_time_monotonic_ns() / 1000))
+#define MICROPY_GC_STATS                 (MICROPY_GC_INCREMENTAL)
+#define MICROPY_GC_RESERVE               (CIRCUITPY_FULL_BUILD)
+#define MICROPY_GC_NOSCAN                (CIRCUITPY_FULL_BUILD)
+// The uheap and supervisor profilers attribute work to the running bytecode.
+#define MICROPY_TRACK_CODE_STATE         (CIRCUITPY_UHEAP || CIRCUITPY_SUPERVISOR_PROFILE)
 #define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
 #define MP_PLAT_FREE_HEAP(ptr) port_free(ptr)
+// Keep small, often used objects out of PSRAM on ports that have it.
+#define MICROPY_GC_TIERED                (1)
+#define MICROPY_GC_SLOW_AREA_THRESHOLD   (CIRCUITPY_SLOW_RAM_THRESHOLD)
+#define MP_PLAT_ALLOC_HEAP_FAST(size) port_malloc_fast(size)
+#define MP_PLAT_HEAP_IS_SLOW(ptr) port_heap_is_slow(ptr)
 #include "supervisor/port_heap.h"
 #define MICROPY_HELPER_LEXER_UNIX        (0)
 #define MICROPY_HELPER_REPL              (1)
@@ -93,13 +111,29 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_MAP_COMPACT          (CIRCUITPY_OPT_MAP_COMPACT)
+#define MICROPY_OPT_ATTR_CACHE           (CIRCUITPY_OPT_ATTR_CACHE)
+#define MICROPY_OPT_SUPERINSTRUCTIONS    (CIRCUITPY_OPT_SUPERINSTRUCTIONS)
+#define MICROPY_OPT_VM_BINARY_OP_FAST_PATH (CIRCUITPY_OPT_VM_BINARY_OP_FAST_PATH)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
+#define MICROPY_OPT_MPZ_FAST_MUL         (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_MODULE_COMPILE_CACHE     (CIRCUITPY_MODULE_COMPILE_CACHE)
+#define MICROPY_MODULE_PATH_CACHE        (CIRCUITPY_MODULE_PATH_CACHE)
+#define MICROPY_MODULE_RETAIN            (CIRCUITPY_MODULE_RETAIN)
+#define MICROPY_MODULE_RETAIN_ALLOC(size) port_malloc(size, false)
+#define MICROPY_MODULE_RETAIN_FREE(ptr) port_free(ptr)
+#define MICROPY_COMP_INCREMENTAL         (CIRCUITPY_COMP_INCREMENTAL)
+#define MICROPY_STOP_ITERATION_NO_TRACEBACK (CIRCUITPY_STOP_ITERATION_NO_TRACEBACK)
+#define MICROPY_MODULE_BUILTIN_LAZY_INIT (CIRCUITPY_MODULE_BUILTIN_LAZY_INIT)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
+#define MICROPY_PY_ARRAY_OPS             (CIRCUITPY_ARRAY_OPS)
+#define MICROPY_PY_LIST_SORT_STABLE      (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_ATTRTUPLE             (1)
 #define MICROPY_PY_BUILTINS_BYTEARRAY    (1)
+#define MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_BYTES_HEX    (1)
 #define MICROPY_PY_BUILTINS_ENUMERATE    (1)
 #define MICROPY_PY_BUILTINS_FILTER       (1)
@@ -119,6 +153,8 @@ extern void common_hal_mcu_enable_interrupts(void);
 
 #define MICROPY_PY_BINASCII             (CIRCUITPY_BINASCII)
 #define MICROPY_PY_BINASCII_CRC32       (CIRCUITPY_BINASCII && CIRCUITPY_ZLIB)
+#define MICROPY_PY_BINASCII_CRC_HQX     (CIRCUITPY_BINASCII)
+#define MICROPY_PY_BISECT               (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_CMATH                 (0)
 #define MICROPY_PY_COLLECTIONS           (CIRCUITPY_COLLECTIONS)
 #define MICROPY_PY_DESCRIPTORS           (1)
@@ -127,11 +163,18 @@ extern void common_hal_mcu_enable_interrupts(void);
 // Uses about 80 bytes.
 #define MICROPY_PY_ERRNO_ERRORCODE      (CIRCUITPY_ERRNO)
 #define MICROPY_PY_GC                    (1)
+#define MICROPY_PY_GENERATOR_FRAME_POOL  (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_HEAPQ                 (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_HEAPQ_PRIORITYQUEUE   (CIRCUITPY_FULL_BUILD)
 // Supplanted by shared-bindings/math
 #define MICROPY_PY_IO                    (CIRCUITPY_IO)
 #define MICROPY_PY_IO_IOBASE             (CIRCUITPY_IO_IOBASE)
+#define MICROPY_PY_IO_BUFFEREDREADER     (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_IO_BUFFEREDWRITER     (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_IO_BYTESIO_GETBUFFER  (CIRCUITPY_FULL_BUILD)
 // In extmod
 #define MICROPY_PY_JSON                 (CIRCUITPY_JSON)
+#define MICROPY_PY_JSON_OBJECT_HOOK     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_MATH                  (0)
 #define MICROPY_PY_MICROPYTHON_MEM_INFO  (0)
 // Supplanted by shared-bindings/random
@@ -147,10 +190,12 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY___FILE__              (1)
 
 #define MICROPY_QSTR_BYTES_IN_HASH       (1)
+#define MICROPY_QSTR_POOL_INDEX          (CIRCUITPY_QSTR_POOL_INDEX)
 #define MICROPY_REPL_AUTO_INDENT         (1)
 #define MICROPY_REPL_EVENT_DRIVEN        (0)
 #define MICROPY_STACK_CHECK              (1)
 #define MICROPY_STREAMS_NON_BLOCK        (1)
+#define MICROPY_STREAMS_READLINE_CHUNK_SIZE (64)
 #ifndef MICROPY_USE_INTERNAL_PRINTF
 #define MICROPY_USE_INTERNAL_PRINTF      (1)
 #endif
@@ -237,6 +282,7 @@ typedef long mp_off_t;
 #ifndef MICROPY_PY_BUILTINS_COMPLEX
 #define MICROPY_PY_BUILTINS_COMPLEX           (CIRCUITPY_FULL_BUILD)
 #endif
+#define MICROPY_PY_BUILTINS_BYTES_BUFFER_ARGS (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_FROZENSET         (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_CENTER        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_PARTITION     (CIRCUITPY_FULL_BUILD)
@@ -248,10 +294,13 @@ typedef long mp_off_t;
 #define MICROPY_PY_COLLECTIONS_DEQUE          (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_COLLECTIONS_DEQUE_ITER     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_COLLECTIONS_DEQUE_SUBSCR   (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_COLLECTIONS_DEQUE_TYPED    (CIRCUITPY_FULL_BUILD)
 #endif
 #define MICROPY_PY_RE_MATCH_GROUPS           (CIRCUITPY_RE)
 #define MICROPY_PY_RE_MATCH_SPAN_START_END   (CIRCUITPY_RE)
 #define MICROPY_PY_RE_SUB                    (CIRCUITPY_RE)
+#define MICROPY_PY_RE_CACHE_SIZE             (4)
+#define MICROPY_PY_RE_PIKEVM                 (CIRCUITPY_RE_PIKEVM)
 
 #define CIRCUITPY_MICROPYTHON_ADVANCED        (0)
 
@@ -287,6 +336,10 @@ typedef long mp_off_t;
 #error No *_FLASH_FILESYSTEM set!
 #endif
 
+#if CIRCUITPY_LITTLEFS && INTERNAL_FLASH_FILESYSTEM
+#error CIRCUITPY_LITTLEFS requires QSPI_FLASH_FILESYSTEM or SPI_FLASH_FILESYSTEM
+#endif
+
 // Default board buses.
 
 #ifndef CIRCUITPY_BOARD_I2C
@@ -346,11 +399,40 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// Stack buffer in bytes that BusDisplay renders into and sends to the bus in one
+// write. Larger buffers take fewer, longer bus writes per refresh, which cuts
+// the per-write cost of setting the region and toggling chip select.
+#ifndef CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE
+#define CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE (512)
+#endif
+
+// Number of recently converted colors each ColorConverter remembers, so that
+// images with many colors don't convert every pixel. A power of two.
+#ifndef CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE
+#define CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE (64)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
 #endif
 
+// Number of recently decompressed messages to keep.
+#ifndef CIRCUITPY_MESSAGE_DECOMPRESS_CACHE
+#define CIRCUITPY_MESSAGE_DECOMPRESS_CACHE (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#endif
+
+// Bytes of RAM that remember where imported modules were found, across reloads.
+#ifndef CIRCUITPY_MODULE_PATH_CACHE
+#define CIRCUITPY_MODULE_PATH_CACHE (CIRCUITPY_FULL_BUILD ? 1024 : 0)
+#endif
+
+// Bytes of RAM outside the VM heap that keep compiled /lib modules across
+// reloads.
+#ifndef CIRCUITPY_MODULE_RETAIN
+#define CIRCUITPY_MODULE_RETAIN (CIRCUITPY_MODULE_COMPILE_CACHE ? 32768 : 0)
+#endif
+
 // This is not a top-level module; it's microcontroller.nvm.
 #if CIRCUITPY_NVM
 extern const struct _mp_obj_module_t nvm_module;
@@ -415,6 +497,17 @@ void background_callback_run_all(void);
 #define MICROPY_VM_HOOK_LOOP RUN_BACKGROUND_TASKS;
 #define MICROPY_VM_HOOK_RETURN RUN_BACKGROUND_TASKS;
 
+// mp_event_wait_ms() and mp_event_wait_indefinite(), used by select.poll() and
+// so by asyncio, idle the CPU until an interrupt or a background callback. They
+// wake after at most this long to poll objects whose readiness doesn't cause
+// an interrupt, such as user sockets.
+#ifndef CIRCUITPY_EVENT_WAIT_MAX_MS
+#define CIRCUITPY_EVENT_WAIT_MAX_MS (1)
+#endif
+
+void supervisor_event_wait_ms(mp_int_t timeout_ms);
+#define MICROPY_INTERNAL_WFE(TIMEOUT_MS) supervisor_event_wait_ms(TIMEOUT_MS)
+
 // CIRCUITPY_AUTORELOAD_DELAY_MS = 0 will completely disable autoreload.
 #ifndef CIRCUITPY_AUTORELOAD_DELAY_MS
 #define CIRCUITPY_AUTORELOAD_DELAY_MS 750
@@ -424,6 +517,16 @@ void background_callback_run_all(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Number of 512-byte blocks in the write-back cache shared by user block
+// devices, such as SD cards. 0 disables the cache.
+#ifndef CIRCUITPY_BLOCKDEV_CACHE_SECTORS
+#if CIRCUITPY_FULL_BUILD
+#define CIRCUITPY_BLOCKDEV_CACHE_SECTORS (8)
+#else
+#define CIRCUITPY_BLOCKDEV_CACHE_SECTORS (0)
+#endif
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
@@ -431,6 +534,12 @@ void background_callback_run_all(void);
 // The VM heap starts at this size and doubles in size as needed until it runs
 // out of memory in the outer heap. Once it can't double, it'll then grow into
 // the largest contiguous free area.
+// Allocations of at least this many bytes go to slower RAM, such as PSRAM,
+// first. Smaller ones go to internal RAM first.
+#ifndef CIRCUITPY_SLOW_RAM_THRESHOLD
+#define CIRCUITPY_SLOW_RAM_THRESHOLD (1024)
+#endif
+
 #ifndef CIRCUITPY_HEAP_START_SIZE
 #define CIRCUITPY_HEAP_START_SIZE (8 * 1024)
 #endif
@@ -445,6 +554,55 @@ void background_callback_run_all(void);
 #define CIRCUITPY_WORKFLOW_CONNECTION_SLEEP_DELAY 5
 #endif
 
+// Time in microseconds that bulk background callbacks may use in one run, after
+// the first one. 0 means no limit.
+#ifndef CIRCUITPY_BACKGROUND_BULK_BUDGET_US
+#define CIRCUITPY_BACKGROUND_BULK_BUDGET_US (0)
+#endif
+
+// Shortest time between status bar updates caused by background changes, such as
+// the network or BLE connecting. 0 sends each change as it happens.
+#ifndef CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS
+#define CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS (500)
+#endif
+
+// Bytes of console output that may wait to be drawn on the display terminal.
+// More than this are dropped until drawing catches up. 0 draws text as it is
+// written, which makes print() wait for the display.
+#ifndef CIRCUITPY_SERIAL_DISPLAY_BUFFER_SIZE
+#define CIRCUITPY_SERIAL_DISPLAY_BUFFER_SIZE (512)
+#endif
+
+// Most bytes drawn on the display terminal in one background run.
+#ifndef CIRCUITPY_SERIAL_DISPLAY_DRAW_CHUNK
+#define CIRCUITPY_SERIAL_DISPLAY_DRAW_CHUNK (64)
+#endif
+
+// Bytes of _eve commands collected before they are passed to the registered
+// write(). A whole frame's display list usually fits, so each frame is sent in
+// one transfer.
+#ifndef CIRCUITPY__EVE_BUFFER_SIZE
+#define CIRCUITPY__EVE_BUFFER_SIZE (4096)
+#endif
+
+// How often gnssio reads the UARTs of its receivers, in milliseconds. At 9600
+// baud, 64 bytes of receive buffer last about 66 ms.
+#ifndef CIRCUITPY_GNSSIO_POLL_MS
+#define CIRCUITPY_GNSSIO_POLL_MS (20)
+#endif
+
+// Shortest time.sleep(), in milliseconds, that may put the chip into light sleep
+// through port_light_sleep_for_ticks(). 0 disables automatic light sleep.
+#ifndef CIRCUITPY_AUTO_LIGHT_SLEEP_MS
+#define CIRCUITPY_AUTO_LIGHT_SLEEP_MS (0)
+#endif
+
+// Number of events the runtime trace keeps, at 8 bytes each. Must be a power
+// of two.
+#ifndef CIRCUITPY_TRACE_RECORDS
+#define CIRCUITPY_TRACE_RECORDS (512)
+#endif
+
 #ifndef CIRCUITPY_PROCESSOR_COUNT
 #define CIRCUITPY_PROCESSOR_COUNT (1)
 #endif
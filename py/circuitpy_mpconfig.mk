@@ -62,6 +62,14 @@ CFLAGS += -DCIRCUITPY_FULL_BUILD=$(CIRCUITPY_FULL_BUILD)
 # increased build time
 CIRCUITPY_MESSAGE_COMPRESSION_LEVEL ?= 9
 
+# Decode messages up to this many bits at a time with a table of 2**bits
+# 16-bit entries, instead of a bit at a time.
+ifeq ($(CIRCUITPY_FULL_BUILD),1)
+CIRCUITPY_MESSAGE_DECOMPRESS_TABLE_BITS ?= 8
+else
+CIRCUITPY_MESSAGE_DECOMPRESS_TABLE_BITS ?= 0
+endif
+
 # Reduce the size of in-flash properties. Requires support in the .ld linker
 # file, so not enabled by default.
 CIRCUITPY_OPTIMIZE_PROPERTY_FLASH_SIZE ?= 0
@@ -90,6 +98,10 @@ CFLAGS += -DMICROPY_PY_SELECT_SELECT=$(MICROPY_PY_SELECT_SELECT)
 CIRCUITPY_AESIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_AESIO=$(CIRCUITPY_AESIO)
 
+# The port has an AES engine for aesio, see shared-module/aesio/__init__.h
+CIRCUITPY_AESIO_HW ?= 0
+CFLAGS += -DCIRCUITPY_AESIO_HW=$(CIRCUITPY_AESIO_HW)
+
 # TODO: CIRCUITPY_ALARM will gradually be added to as many ports as possible
 # so make this 1 or CIRCUITPY_FULL_BUILD eventually
 CIRCUITPY_ALARM ?= 0
@@ -107,6 +119,10 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+# Arithmetic over whole arrays: array.add(), array.dot() and so on
+CIRCUITPY_ARRAY_OPS ?= $(CIRCUITPY_ARRAY)
+CFLAGS += -DCIRCUITPY_ARRAY_OPS=$(CIRCUITPY_ARRAY_OPS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -218,12 +234,18 @@ CFLAGS += -DCIRCUITPY_CYW43=$(CIRCUITPY_CYW43)
 CIRCUITPY_DIGITALIO ?= 1
 CFLAGS += -DCIRCUITPY_DIGITALIO=$(CIRCUITPY_DIGITALIO)
 
+CIRCUITPY_DIGITALIO_PINGROUP ?= $(call enable-if-all,$(CIRCUITPY_DIGITALIO) $(CIRCUITPY_FULL_BUILD))
+CFLAGS += -DCIRCUITPY_DIGITALIO_PINGROUP=$(CIRCUITPY_DIGITALIO_PINGROUP)
+
 CIRCUITPY_COPROC ?= 0
 CFLAGS += -DCIRCUITPY_COPROC=$(CIRCUITPY_COPROC)
 
 CIRCUITPY_COUNTIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_COUNTIO=$(CIRCUITPY_COUNTIO)
 
+CIRCUITPY_COUNTIO_RECORDER ?= $(call enable-if-all,$(CIRCUITPY_COUNTIO) $(CIRCUITPY_FULL_BUILD))
+CFLAGS += -DCIRCUITPY_COUNTIO_RECORDER=$(CIRCUITPY_COUNTIO_RECORDER)
+
 CIRCUITPY_DISPLAYIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_DISPLAYIO=$(CIRCUITPY_DISPLAYIO)
 
@@ -259,6 +281,9 @@ CFLAGS += -DCIRCUITPY_BITMAPTOOLS=$(CIRCUITPY_BITMAPTOOLS)
 CFLAGS += -DCIRCUITPY_FRAMEBUFFERIO=$(CIRCUITPY_FRAMEBUFFERIO)
 CFLAGS += -DCIRCUITPY_VECTORIO=$(CIRCUITPY_VECTORIO)
 
+CIRCUITPY_DSP ?= 0
+CFLAGS += -DCIRCUITPY_DSP=$(CIRCUITPY_DSP)
+
 CIRCUITPY_DUALBANK ?= 0
 CFLAGS += -DCIRCUITPY_DUALBANK=$(CIRCUITPY_DUALBANK)
 
@@ -269,6 +294,10 @@ CFLAGS += -DCIRCUITPY_ENABLE_MPY_NATIVE=$(CIRCUITPY_ENABLE_MPY_NATIVE)
 CIRCUITPY_OS_GETENV ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OS_GETENV=$(CIRCUITPY_OS_GETENV)
 
+# Keep settings.toml and an index of its keys in RAM after the first os.getenv().
+CIRCUITPY_OS_GETENV_CACHE ?= $(CIRCUITPY_OS_GETENV)
+CFLAGS += -DCIRCUITPY_OS_GETENV_CACHE=$(CIRCUITPY_OS_GETENV_CACHE)
+
 CIRCUITPY_ERRNO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ERRNO=$(CIRCUITPY_ERRNO)
 
@@ -310,6 +339,10 @@ CFLAGS += -DCIRCUITPY_GIFIO=$(CIRCUITPY_GIFIO)
 CIRCUITPY_GNSS ?= 0
 CFLAGS += -DCIRCUITPY_GNSS=$(CIRCUITPY_GNSS)
 
+# NMEA and UBX parsing for GNSS receivers on any port.
+CIRCUITPY_GNSSIO ?= 0
+CFLAGS += -DCIRCUITPY_GNSSIO=$(CIRCUITPY_GNSSIO)
+
 CIRCUITPY_HASHLIB ?= $(CIRCUITPY_WEB_WORKFLOW)
 CFLAGS += -DCIRCUITPY_HASHLIB=$(CIRCUITPY_HASHLIB)
 
@@ -320,9 +353,17 @@ CFLAGS += -DCIRCUITPY_HASHLIB_MBEDTLS=$(CIRCUITPY_HASHLIB_MBEDTLS)
 CIRCUITPY_HASHLIB_MBEDTLS_ONLY ?= $(call enable-if-all,$(CIRCUITPY_HASHLIB_MBEDTLS) $(call enable-if-not,$(CIRCUITPY_SSL)))
 CFLAGS += -DCIRCUITPY_HASHLIB_MBEDTLS_ONLY=$(CIRCUITPY_HASHLIB_MBEDTLS_ONLY)
 
+# The port has a SHA-256 engine for hashlib, see shared-module/hashlib/__init__.h
+CIRCUITPY_HASHLIB_SHA256_HW ?= 0
+CFLAGS += -DCIRCUITPY_HASHLIB_SHA256_HW=$(CIRCUITPY_HASHLIB_SHA256_HW)
+
 CIRCUITPY_I2CTARGET ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_I2CTARGET=$(CIRCUITPY_I2CTARGET)
 
+# Only ports that implement common-hal/i2ctarget/I2CRegisterTarget.c turn this on.
+CIRCUITPY_I2CTARGET_REGISTERS ?= 0
+CFLAGS += -DCIRCUITPY_I2CTARGET_REGISTERS=$(CIRCUITPY_I2CTARGET_REGISTERS)
+
 CIRCUITPY_IMAGECAPTURE ?= 0
 CFLAGS += -DCIRCUITPY_IMAGECAPTURE=$(CIRCUITPY_IMAGECAPTURE)
 
@@ -361,6 +402,12 @@ CFLAGS += -DCIRCUITPY_KEYPAD_SHIFTREGISTERKEYS=$(CIRCUITPY_KEYPAD_SHIFTREGISTERK
 CIRCUITPY_KEYPAD_DEMUX ?= $(CIRCUITPY_KEYPAD)
 CFLAGS += -DCIRCUITPY_KEYPAD_DEMUX=$(CIRCUITPY_KEYPAD_DEMUX)
 
+# Format and mount the internal filesystem as LittleFS instead of FAT. Only
+# supported on boards whose CIRCUITPY lives on external SPI/QSPI flash.
+CIRCUITPY_LITTLEFS ?= 0
+CFLAGS += -DCIRCUITPY_LITTLEFS=$(CIRCUITPY_LITTLEFS)
+MICROPY_VFS_LFS2 = $(CIRCUITPY_LITTLEFS)
+
 CIRCUITPY_LOCALE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_LOCALE=$(CIRCUITPY_LOCALE)
 
@@ -400,6 +447,46 @@ CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PAT
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_ATTR_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_ATTR_CACHE=$(CIRCUITPY_OPT_ATTR_CACHE)
+
+# Compact hash maps with cached hashes; costs a word of RAM per entry.
+CIRCUITPY_OPT_MAP_COMPACT ?= 0
+CFLAGS += -DCIRCUITPY_OPT_MAP_COMPACT=$(CIRCUITPY_OPT_MAP_COMPACT)
+
+# Compile imported modules a statement at a time to bound the parse tree's RAM.
+CIRCUITPY_COMP_INCREMENTAL ?= 0
+CFLAGS += -DCIRCUITPY_COMP_INCREMENTAL=$(CIRCUITPY_COMP_INCREMENTAL)
+
+# Don't record tracebacks in StopIteration exceptions, to save allocating them
+# as generators and coroutines finish.
+CIRCUITPY_STOP_ITERATION_NO_TRACEBACK ?= 0
+CFLAGS += -DCIRCUITPY_STOP_ITERATION_NO_TRACEBACK=$(CIRCUITPY_STOP_ITERATION_NO_TRACEBACK)
+
+# Defer the setup of modules such as wifi and _bleio until they are first used.
+CIRCUITPY_MODULE_BUILTIN_LAZY_INIT ?= 0
+CFLAGS += -DCIRCUITPY_MODULE_BUILTIN_LAZY_INIT=$(CIRCUITPY_MODULE_BUILTIN_LAZY_INIT)
+
+# Cache compiled imports as .mpy files in __pycache__; writes to the filesystem.
+CIRCUITPY_MODULE_COMPILE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_MODULE_COMPILE_CACHE=$(CIRCUITPY_MODULE_COMPILE_CACHE)
+
+# Match regular expressions with a Pike VM rather than by backtracking. Time is
+# linear in the subject length, at the cost of a heap allocation per match.
+CIRCUITPY_RE_PIKEVM ?= 0
+CFLAGS += -DCIRCUITPY_RE_PIKEVM=$(CIRCUITPY_RE_PIKEVM)
+
+# Hash indexes for the qstr pools; costs about 2-3 bytes of flash per qstr.
+CIRCUITPY_QSTR_POOL_INDEX ?= 0
+CFLAGS += -DCIRCUITPY_QSTR_POOL_INDEX=$(CIRCUITPY_QSTR_POOL_INDEX)
+
+# Fuse common bytecode sequences; costs some code size.
+CIRCUITPY_OPT_SUPERINSTRUCTIONS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_SUPERINSTRUCTIONS=$(CIRCUITPY_OPT_SUPERINSTRUCTIONS)
+
+CIRCUITPY_OPT_VM_BINARY_OP_FAST_PATH ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_VM_BINARY_OP_FAST_PATH=$(CIRCUITPY_OPT_VM_BINARY_OP_FAST_PATH)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
@@ -433,6 +520,10 @@ CFLAGS += -DCIRCUITPY_PULSEIO_PULSEOUT=$(CIRCUITPY_PULSEIO_PULSEOUT)
 CIRCUITPY_PWMIO ?= 1
 CFLAGS += -DCIRCUITPY_PWMIO=$(CIRCUITPY_PWMIO)
 
+# Only ports that implement common-hal/pwmio/PWMGroup.c turn this on.
+CIRCUITPY_PWMIO_PWMGROUP ?= 0
+CFLAGS += -DCIRCUITPY_PWMIO_PWMGROUP=$(CIRCUITPY_PWMIO_PWMGROUP)
+
 CIRCUITPY_QRIO ?= $(CIRCUITPY_IMAGECAPTURE)
 CFLAGS += -DCIRCUITPY_QRIO=$(CIRCUITPY_QRIO)
 
@@ -514,6 +605,14 @@ CFLAGS += -DCIRCUITPY_SSL=$(CIRCUITPY_SSL)
 CIRCUITPY_SSL_MBEDTLS ?= 0
 CFLAGS += -DCIRCUITPY_SSL_MBEDTLS=$(CIRCUITPY_SSL_MBEDTLS)
 
+# TLS record buffer sizes, for ports built with lib/mbedtls_config. Lowering the
+# receive size saves RAM but needs servers that honor max fragment length.
+CIRCUITPY_SSL_IN_CONTENT_LEN ?= 16384
+CFLAGS += -DCIRCUITPY_SSL_IN_CONTENT_LEN=$(CIRCUITPY_SSL_IN_CONTENT_LEN)
+
+CIRCUITPY_SSL_OUT_CONTENT_LEN ?= 4096
+CFLAGS += -DCIRCUITPY_SSL_OUT_CONTENT_LEN=$(CIRCUITPY_SSL_OUT_CONTENT_LEN)
+
 # Currently always off.
 CIRCUITPY_STAGE ?= 0
 CFLAGS += -DCIRCUITPY_STAGE=$(CIRCUITPY_STAGE)
@@ -527,12 +626,26 @@ CFLAGS += -DCIRCUITPY_STORAGE=$(CIRCUITPY_STORAGE)
 CIRCUITPY_STORAGE_EXTEND ?= $(CIRCUITPY_DUALBANK)
 CFLAGS += -DCIRCUITPY_STORAGE_EXTEND=$(CIRCUITPY_STORAGE_EXTEND)
 
+CIRCUITPY_STORAGE_LOGFILE ?= $(call enable-if-all,$(CIRCUITPY_STORAGE) $(CIRCUITPY_FULL_BUILD))
+CFLAGS += -DCIRCUITPY_STORAGE_LOGFILE=$(CIRCUITPY_STORAGE_LOGFILE)
+
+# Enabled by ports that implement supervisor_flash_partition_*().
+CIRCUITPY_STORAGE_PARTITION ?= 0
+CFLAGS += -DCIRCUITPY_STORAGE_PARTITION=$(CIRCUITPY_STORAGE_PARTITION)
+
+CIRCUITPY_STORAGE_KEYVALUESTORE ?= $(call enable-if-all,$(CIRCUITPY_STORAGE_PARTITION) $(CIRCUITPY_FULL_BUILD))
+CFLAGS += -DCIRCUITPY_STORAGE_KEYVALUESTORE=$(CIRCUITPY_STORAGE_KEYVALUESTORE)
+
 CIRCUITPY_STRUCT ?= 1
 CFLAGS += -DCIRCUITPY_STRUCT=$(CIRCUITPY_STRUCT)
 
 CIRCUITPY_SUPERVISOR ?= 1
 CFLAGS += -DCIRCUITPY_SUPERVISOR=$(CIRCUITPY_SUPERVISOR)
 
+# Statistical profiler driven by the supervisor tick: supervisor.profile_start() etc.
+CIRCUITPY_SUPERVISOR_PROFILE ?= 0
+CFLAGS += -DCIRCUITPY_SUPERVISOR_PROFILE=$(CIRCUITPY_SUPERVISOR_PROFILE)
+
 CIRCUITPY_SYNTHIO ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_SYNTHIO=$(CIRCUITPY_SYNTHIO)
 
@@ -626,8 +739,21 @@ CFLAGS += -DCIRCUITPY_USB_MSC_ENABLED_DEFAULT=$(CIRCUITPY_USB_MSC_ENABLED_DEFAUL
 # setting in their mpconfigport.mk and/or mpconfigboard.mk files yet.
 CIRCUITPY_USB_VENDOR ?= 0
 CFLAGS += -DCIRCUITPY_USB_VENDOR=$(CIRCUITPY_USB_VENDOR)
+
+# usb_vendor: a raw bulk IN/OUT interface for libusb style host software.
+CIRCUITPY_USB_VENDOR_BULK ?= 0
+CFLAGS += -DCIRCUITPY_USB_VENDOR_BULK=$(CIRCUITPY_USB_VENDOR_BULK)
 endif
 
+# A FAT filesystem in the storage partition that Python writes while the host
+# reads it as a second USB drive.
+CIRCUITPY_STORAGE_DATA_DRIVE ?= $(call enable-if-all,$(CIRCUITPY_STORAGE_PARTITION) $(CIRCUITPY_USB_DEVICE) $(CIRCUITPY_USB_MSC))
+CFLAGS += -DCIRCUITPY_STORAGE_DATA_DRIVE=$(CIRCUITPY_STORAGE_DATA_DRIVE)
+
+# Only autoreload for USB writes that touch files or directories code.py used.
+CIRCUITPY_AUTORELOAD_FILTER ?= $(call enable-if-all,$(CIRCUITPY_USB_DEVICE) $(CIRCUITPY_USB_MSC) $(CIRCUITPY_FULL_BUILD))
+CFLAGS += -DCIRCUITPY_AUTORELOAD_FILTER=$(CIRCUITPY_AUTORELOAD_FILTER)
+
 
 CIRCUITPY_PYUSB ?= $(call enable-if-any,$(CIRCUITPY_USB_HOST) $(CIRCUITPY_MAX3421E))
 CFLAGS += -DCIRCUITPY_PYUSB=$(CIRCUITPY_PYUSB)
@@ -650,6 +776,22 @@ CFLAGS += -DCIRCUITPY_USB_KEYBOARD_WORKFLOW=$(CIRCUITPY_USB_KEYBOARD_WORKFLOW)
 CIRCUITPY_USTACK ?= 0
 CFLAGS += -DCIRCUITPY_USTACK=$(CIRCUITPY_USTACK)
 
+# Fixed size, garbage collected slots in the port heap for native objects that
+# are created very often, such as keypad.Event.
+CIRCUITPY_OBJECT_POOL ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OBJECT_POOL=$(CIRCUITPY_OBJECT_POOL)
+
+# microcontroller.cycles() and CPU cycle counters for runtime subsystems. Ports
+# with a CPU cycle counter enable this and provide port_get_cpu_cycles().
+CIRCUITPY_PERF_COUNTERS ?= 0
+CFLAGS += -DCIRCUITPY_PERF_COUNTERS=$(CIRCUITPY_PERF_COUNTERS)
+
+# supervisor.trace_start(): a ring buffer of timestamped runtime events, such
+# as GC runs and background tasks, for finding latency spikes. On by default
+# where there is a cycle counter for fine timestamps.
+CIRCUITPY_TRACE ?= $(CIRCUITPY_PERF_COUNTERS)
+CFLAGS += -DCIRCUITPY_TRACE=$(CIRCUITPY_TRACE)
+
 # for decompressing utilities
 CIRCUITPY_ZLIB ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ZLIB=$(CIRCUITPY_ZLIB)
@@ -707,13 +849,18 @@ CFLAGS += -DCIRCUITPY_MIN_GCC_VERSION=$(CIRCUITPY_MIN_GCC_VERSION)
 #
 # Also propagate longint choice from .mk to C. There's no easy string comparison
 # in cpp conditionals, so we #define separate names for each.
+#
+# MPZ_DIG_SIZE is the number of bits in each mpz digit. 32 bit digits need a
+# quarter of the multiplies of 16 bit ones, but only pay off on CPUs with a
+# 32 x 32 -> 64 bit multiply instruction. mpy-tool needs it to freeze long ints.
+MPZ_DIG_SIZE ?= 16
 
 ifeq ($(LONGINT_IMPL),NONE)
 MPY_TOOL_LONGINT_IMPL = -mlongint-impl=none
 CFLAGS += -DLONGINT_IMPL_NONE
 else ifeq ($(LONGINT_IMPL),MPZ)
-MPY_TOOL_LONGINT_IMPL = -mlongint-impl=mpz
-CFLAGS += -DLONGINT_IMPL_MPZ
+MPY_TOOL_LONGINT_IMPL = -mlongint-impl=mpz -mmpz-dig-size=$(MPZ_DIG_SIZE)
+CFLAGS += -DLONGINT_IMPL_MPZ -DMPZ_DIG_SIZE=$(MPZ_DIG_SIZE)
 else ifeq ($(LONGINT_IMPL),LONGLONG)
 MPY_TOOL_LONGINT_IMPL = -mlongint-impl=longlong
 CFLAGS += -DLONGINT_IMPL_LONGLONG
@@ -102,6 +102,8 @@ static const emit_method_table_t *emit_native_table[] = {
     &emit_native_thumb_method_table,
     &emit_native_xtensa_method_table,
     &emit_native_xtensawin_method_table,
+    // CIRCUITPY-CHANGE
+    &emit_native_rv32_method_table,
 };
 
 #elif MICROPY_EMIT_NATIVE
@@ -118,6 +120,9 @@ static const emit_method_table_t *emit_native_table[] = {
 #define NATIVE_EMITTER(f) emit_native_xtensa_##f
 #elif MICROPY_EMIT_XTENSAWIN
 #define NATIVE_EMITTER(f) emit_native_xtensawin_##f
+// CIRCUITPY-CHANGE
+#elif MICROPY_EMIT_RV32
+#define NATIVE_EMITTER(f) emit_native_rv32_##f
 #else
 #error "unknown native emitter"
 #endif
@@ -141,6 +146,8 @@ static const emit_inline_asm_method_table_t *emit_asm_table[] = {
     &emit_inline_thumb_method_table,
     &emit_inline_xtensa_method_table,
     NULL,
+    // CIRCUITPY-CHANGE: no inline assembler for RV32
+    NULL,
 };
 
 #elif MICROPY_EMIT_INLINE_ASM
@@ -45,7 +45,20 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
 void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+// Load the compiled code of a .py file from its cache, or compile it and update
+// the cache. This is implemented in builtinimport.c
+void mp_compile_cache_load_or_compile(qstr file_qstr, mp_compiled_module_t *cm);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_INCREMENTAL
+// Like mp_parse_compile_execute for file input, but one top-level statement
+// at a time, so only the current statement's parse tree is in memory.
+void mp_parse_compile_execute_incremental(mp_lexer_t *lex, mp_obj_dict_t *globals);
+#endif
 
 #endif // MICROPY_INCLUDED_PY_COMPILE_H
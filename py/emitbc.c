@@ -64,6 +64,20 @@ struct _emit_t {
     size_t max_num_labels;
     size_t *label_offsets;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_JUMP_THREADING
+    // For each label, the label that an unconditional jump right after it goes
+    // to, or the label itself. Found in MP_PASS_STACK_SIZE and used after.
+    size_t *label_jump_targets;
+    // For each label, LABEL_REFERENCED if a jump to it was emitted in this
+    // pass and LABEL_REFERENCED_BEFORE if one was in the previous pass.
+    byte *label_flags;
+    // Labels assigned at fresh_labels_offset, with no opcode emitted since.
+    size_t fresh_labels_offset;
+    size_t num_fresh_labels;
+    size_t fresh_labels[4];
+    #endif
+
     size_t code_info_offset;
     size_t code_info_size;
     size_t bytecode_offset;
@@ -73,21 +87,52 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    // The last opcode emitted, if it may start a superinstruction, and where it
+    // starts and ends. When it is followed directly by an opcode it fuses with,
+    // the two are replaced by the fused opcode.
+    byte fuse_opcode;
+    size_t fuse_start;
+    size_t fuse_end;
+    mp_int_t fuse_small_int;
+    #endif
 };
 
+#if MICROPY_OPT_SUPERINSTRUCTIONS
+static const byte binary_op_small_int_ops[MP_BC_BINARY_OP_SMALL_INT_MULTI_NUM] = MP_BC_BINARY_OP_SMALL_INT_OPS;
+#endif
+
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
     emit_t *emit = m_new0(emit_t, 1);
     emit->emit_common = emit_common;
     return emit;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_JUMP_THREADING
+#define LABEL_REFERENCED (1)
+#define LABEL_REFERENCED_BEFORE (2)
+#endif
+
 void emit_bc_set_max_num_labels(emit_t *emit, mp_uint_t max_num_labels) {
     emit->max_num_labels = max_num_labels;
     emit->label_offsets = m_new(size_t, emit->max_num_labels);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_JUMP_THREADING
+    emit->label_jump_targets = m_new(size_t, emit->max_num_labels);
+    emit->label_flags = m_new(byte, emit->max_num_labels);
+    #endif
 }
 
 void emit_bc_free(emit_t *emit) {
     m_del(size_t, emit->label_offsets, emit->max_num_labels);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_JUMP_THREADING
+    m_del(size_t, emit->label_jump_targets, emit->max_num_labels);
+    m_del(byte, emit->label_flags, emit->max_num_labels);
+    #endif
     m_del_obj(emit_t, emit);
 }
 
@@ -159,6 +204,27 @@ static uint8_t *emit_get_cur_to_write_bytecode(void *emit_in, size_t num_bytes_t
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_SUPERINSTRUCTIONS
+// Note that the opcode just emitted may be the first of a superinstruction.
+static void emit_bc_fuse_candidate(emit_t *emit, byte opcode, size_t start) {
+    emit->fuse_opcode = opcode;
+    emit->fuse_start = start;
+    emit->fuse_end = emit->bytecode_offset;
+}
+
+// If the last opcode emitted was opcode, and nothing (including a label) has
+// happened since, then remove it so that a fused opcode can be emitted instead.
+static bool emit_bc_fuse(emit_t *emit, byte opcode) {
+    if (emit->suppress || emit->fuse_opcode != opcode || emit->fuse_end != emit->bytecode_offset) {
+        return false;
+    }
+    emit->bytecode_offset = emit->fuse_start;
+    emit->fuse_opcode = MP_BC_BASE_RESERVED;
+    return true;
+}
+#endif
+
 static void emit_write_bytecode_raw_byte(emit_t *emit, byte b1) {
     byte *c = emit_get_cur_to_write_bytecode(emit, 1);
     c[0] = b1;
@@ -234,6 +300,21 @@ static void emit_write_bytecode_byte_label(emit_t *emit, int stack_adj, byte b1,
         return;
     }
 
+    // CIRCUITPY-CHANGE: go straight to where a chain of jumps ends up. Only
+    // jumps with signed offsets are threaded, since the destination may be
+    // behind this jump.
+    #if MICROPY_COMP_JUMP_THREADING
+    if (emit->pass >= MP_PASS_CODE_SIZE) {
+        if (b1 <= MP_BC_POP_JUMP_IF_FALSE && b1 != MP_BC_UNWIND_JUMP) {
+            // Limit the chain, since a jump can go to itself.
+            for (int i = 0; i < 8 && emit->label_jump_targets[label] != label; i++) {
+                label = emit->label_jump_targets[label];
+            }
+        }
+        emit->label_flags[label] |= LABEL_REFERENCED;
+    }
+    #endif
+
     // Determine if the jump offset is signed or unsigned, based on the opcode.
     const bool is_signed = b1 <= MP_BC_POP_JUMP_IF_FALSE;
 
@@ -290,6 +371,23 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    emit->fuse_opcode = MP_BC_BASE_RESERVED;
+    #endif
+    #if MICROPY_COMP_JUMP_THREADING
+    if (pass == MP_PASS_STACK_SIZE) {
+        for (size_t i = 0; i < emit->max_num_labels; i++) {
+            emit->label_jump_targets[i] = i;
+            emit->label_flags[i] = 0;
+        }
+    } else if (pass > MP_PASS_STACK_SIZE) {
+        for (size_t i = 0; i < emit->max_num_labels; i++) {
+            emit->label_flags[i] = (emit->label_flags[i] & LABEL_REFERENCED) ? LABEL_REFERENCED_BEFORE : 0;
+        }
+    }
+    emit->num_fresh_labels = 0;
+    #endif
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -436,6 +534,10 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        // CIRCUITPY-CHANGE: don't fuse opcodes across a line boundary
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        emit->fuse_opcode = MP_BC_BASE_RESERVED;
+        #endif
     }
     #else
     (void)emit;
@@ -444,10 +546,25 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
 }
 
 void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
+    // CIRCUITPY-CHANGE: a label that can only be reached by jumps, and that no
+    // jump went to in the previous pass, doesn't end dead code. Jumps only go
+    // away in later passes, so code still only shrinks.
+    #if MICROPY_COMP_JUMP_THREADING
+    if (emit->suppress && emit->pass > MP_PASS_CODE_SIZE && !(emit->label_flags[l] & LABEL_REFERENCED_BEFORE)) {
+        emit->label_offsets[l] = emit->bytecode_offset;
+        return;
+    }
+    #endif
+
     // Assigning a label ends any dead-code region, and all following opcodes
     // should be emitted (until another unconditional flow control).
     emit->suppress = false;
 
+    // CIRCUITPY-CHANGE: a jump may land between two opcodes, so they can't be fused
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    emit->fuse_opcode = MP_BC_BASE_RESERVED;
+    #endif
+
     if (emit->pass == MP_PASS_SCOPE) {
         return;
     }
@@ -461,6 +578,17 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
 
     // Assign label offset.
     emit->label_offsets[l] = emit->bytecode_offset;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_JUMP_THREADING
+    if (emit->num_fresh_labels == 0 || emit->fresh_labels_offset != emit->bytecode_offset) {
+        emit->fresh_labels_offset = emit->bytecode_offset;
+        emit->num_fresh_labels = 0;
+    }
+    if (emit->num_fresh_labels < MP_ARRAY_SIZE(emit->fresh_labels)) {
+        emit->fresh_labels[emit->num_fresh_labels++] = l;
+    }
+    #endif
 }
 
 void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
@@ -486,6 +614,10 @@ void mp_emit_bc_load_const_tok(emit_t *emit, mp_token_kind_t tok) {
 
 void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     assert(MP_SMALL_INT_FITS(arg));
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    size_t start = emit->bytecode_offset;
+    #endif
     if (-MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS <= arg
         && arg < MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS) {
         emit_write_bytecode_byte(emit, 1,
@@ -493,6 +625,10 @@ void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     } else {
         emit_write_bytecode_byte_int(emit, 1, MP_BC_LOAD_CONST_SMALL_INT, arg);
     }
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    emit_bc_fuse_candidate(emit, MP_BC_LOAD_CONST_SMALL_INT, start);
+    emit->fuse_small_int = arg;
+    #endif
 }
 
 void mp_emit_bc_load_const_str(emit_t *emit, qstr qst) {
@@ -512,7 +648,16 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        size_t start = emit->bytecode_offset;
         emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
+        if (local_num == 0) {
+            emit_bc_fuse_candidate(emit, MP_BC_LOAD_FAST_MULTI, start);
+        }
+        #else
+        emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
+        #endif
     } else {
         emit_write_bytecode_byte_uint(emit, 1, MP_BC_LOAD_FAST_N + kind, local_num);
     }
@@ -526,6 +671,13 @@ void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
 }
 
 void mp_emit_bc_load_method(emit_t *emit, qstr qst, bool is_super) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    if (!is_super && emit_bc_fuse(emit, MP_BC_LOAD_FAST_MULTI)) {
+        emit_write_bytecode_byte_qstr(emit, 1, MP_BC_LOAD_FAST_0_METHOD, qst);
+        return;
+    }
+    #endif
     int stack_adj = 1 - 2 * is_super;
     emit_write_bytecode_byte_qstr(emit, stack_adj, is_super ? MP_BC_LOAD_SUPER_METHOD : MP_BC_LOAD_METHOD, qst);
 }
@@ -548,6 +700,13 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
     if (kind == MP_EMIT_ATTR_LOAD) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        if (emit_bc_fuse(emit, MP_BC_LOAD_FAST_MULTI)) {
+            emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_FAST_0_ATTR, qst);
+            return;
+        }
+        #endif
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
         if (kind == MP_EMIT_ATTR_DELETE) {
@@ -608,7 +767,24 @@ void mp_emit_bc_rot_three(emit_t *emit) {
     emit_write_bytecode_byte(emit, 0, MP_BC_ROT_THREE);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_JUMP_THREADING
+// Note that jumps to the labels right before this jump can go to label instead.
+static void emit_bc_thread_fresh_labels(emit_t *emit, mp_uint_t label) {
+    if (emit->pass == MP_PASS_STACK_SIZE && !emit->suppress && emit->num_fresh_labels > 0
+        && emit->fresh_labels_offset == emit->bytecode_offset) {
+        for (size_t i = 0; i < emit->num_fresh_labels; i++) {
+            emit->label_jump_targets[emit->fresh_labels[i]] = label;
+        }
+    }
+}
+#endif
+
 void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_JUMP_THREADING
+    emit_bc_thread_fresh_labels(emit, label);
+    #endif
     emit_write_bytecode_byte_label(emit, 0, MP_BC_JUMP, label);
     emit->suppress = true;
 }
@@ -639,6 +815,10 @@ void mp_emit_bc_unwind_jump(emit_t *emit, mp_uint_t label, mp_uint_t except_dept
                 emit_write_bytecode_raw_byte(emit, MP_BC_POP_TOP);
             }
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_COMP_JUMP_THREADING
+        emit_bc_thread_fresh_labels(emit, label & ~MP_EMIT_BREAK_FROM_FOR);
+        #endif
         emit_write_bytecode_byte_label(emit, 0, MP_BC_JUMP, label & ~MP_EMIT_BREAK_FROM_FOR);
     } else {
         emit_write_bytecode_byte_label(emit, 0, MP_BC_UNWIND_JUMP, label & ~MP_EMIT_BREAK_FROM_FOR);
@@ -702,6 +882,18 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    for (size_t i = 0; i < MP_BC_BINARY_OP_SMALL_INT_MULTI_NUM; i++) {
+        if (binary_op_small_int_ops[i] == op) {
+            if (emit_bc_fuse(emit, MP_BC_LOAD_CONST_SMALL_INT)) {
+                emit_write_bytecode_byte_int(emit, -1, MP_BC_BINARY_OP_SMALL_INT_MULTI + i, emit->fuse_small_int);
+                return;
+            }
+            break;
+        }
+    }
+    #endif
     emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
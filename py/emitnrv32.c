@@ -0,0 +1,22 @@
+// RV32 specific stuff
+
+#include "py/mpconfig.h"
+
+#if MICROPY_EMIT_RV32
+
+// This is defined so that the assembler exports generic assembler API macros
+#define GENERIC_ASM_API (1)
+#include "py/asmrv32.h"
+
+// Word indices of REG_LOCAL_x in nlr_buf_t
+#define NLR_BUF_IDX_LOCAL_1 (5) // s2
+
+// setjmp() is always called after nlr_push(), so the code runs with either nlr
+// implementation. py/nlrrv32.c saves registers in the same places as newlib's
+// setjmp(), so its nlr_jump() returns from the setjmp() call.
+#define N_NLR_SETJMP (1)
+#define N_RV32 (1)
+#define EXPORT_FUN(name) emit_native_rv32_##name
+#include "py/emitnative.c"
+
+#endif
@@ -100,6 +100,803 @@ static inline int fp_expval(FPTYPE x) {
     return (int)((fb.i >> MP_FLOAT_FRAC_BITS) & (~(0xFFFFFFFF << MP_FLOAT_EXP_BITS))) - MP_FLOAT_EXP_OFFSET;
 }
 
+// CIRCUITPY-CHANGE: conversion to decimal with integer arithmetic, as in Ulf Adams' Ryu
+// (PLDI 2018). The float is scaled by a power of ten using 125 bit
+// approximations of powers of five, which are exact enough for the integer
+// part of the result to be right. That gives either the shortest digits that
+// read back as the same float, or the leading 9 (float) or 17 (double) digits
+// of its exact value, to be rounded to the requested precision. The same
+// powers of five take a decimal of up to 19 digits to the nearest float.
+#if MICROPY_FLOAT_FAST_CONVERSION
+
+#include <string.h>
+
+#define POW5_BITS (125)
+#define POW5_STRIDE (26)
+
+// 5^0 to 5^25.
+static const uint64_t pow5_small[POW5_STRIDE] = {
+    1u, 5u, 25u, 125u,
+    625u, 3125u, 15625u, 78125u,
+    390625u, 1953125u, 9765625u, 48828125u,
+    244140625u, 1220703125u, 6103515625u, 30517578125u,
+    152587890625u, 762939453125u, 3814697265625u, 19073486328125u,
+    95367431640625u, 476837158203125u, 2384185791015625u, 11920928955078125u,
+    59604644775390625u, 298023223876953125u,
+};
+
+// pow5_split(i) is 5^i shifted to have POW5_BITS bits, rounded down, and
+// pow5_inv_split(i) is 2^(bits(5^i) - 1 + POW5_BITS) / 5^i, rounded down, plus
+// one. Only every POW5_STRIDE'th one is stored, as 32 bit words, least
+// significant first. The others are made from those and pow5_small, and
+// corrected by the 2 bit offsets in the second pair of tables.
+static const uint32_t pow5_split_base[][4] = {
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000 },
+    { 0x00000000, 0x00000000, 0x320334b9, 0x14adf4b7 },
+    { 0xb31adb10, 0x0e549208, 0x957d300d, 0x1aba4714 },
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    { 0x4d8f0866, 0x6dc6ad26, 0x85bf98f5, 0x1145b7e2 },
+    { 0x3d8596ca, 0xeb1dbd92, 0x6018a1fc, 0x1652efdc },
+    { 0x22ae923c, 0xb4c1b80b, 0x5b2d9d83, 0x1cda6205 },
+    { 0x8f7e4c30, 0x5bb28b4e, 0x9f52f416, 0x12a5568b },
+    { 0x7682d4fb, 0xf08aed43, 0x31f9e78f, 0x18196515 },
+    { 0xd99bf150, 0xb4ee134a, 0xa6f04c28, 0x1f25c186 },
+    { 0x70c25f03, 0x16499ecb, 0x9c8842e6, 0x1420eb44 },
+    { 0x360865b0, 0x85a56ead, 0x14caf085, 0x1a03fde2 },
+    { 0x7999890b, 0x093db1d5, 0x3a97dad8, 0x10cfeb35 },
+    { 0x5e3f36ac, 0xcf38bb73, 0xfa52673e, 0x15baaf44 },
+    { 0x146770c0, 0xf27d6370, 0x0eb5e8b4, 0x1c1599f5 },
+    #endif
+};
+
+static const uint32_t pow5_inv_split_base[][4] = {
+    { 0x00000001, 0x00000000, 0x00000000, 0x20000000 },
+    { 0xc0655034, 0x52a6c95f, 0xaecb13bb, 0x18c240c4 },
+    { 0x71dfc806, 0x7ca8d500, 0xda0f6ff5, 0x1327fc58 },
+    { 0x3556476e, 0x6520247d, 0x68e7c702, 0x1da48ce4 },
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    { 0x6802e6e9, 0x6139cdd7, 0xc2fc7779, 0x16ef5b40 },
+    { 0x43de8c79, 0xf951a7ff, 0x78b2f391, 0x11bebdf5 },
+    { 0xd6e957e8, 0x7be8bee8, 0x8fac54b0, 0x1b758d84 },
+    { 0x99a423ea, 0x8bd3f9e9, 0x4071a3b7, 0x153eda61 },
+    { 0xcb3ee3ce, 0x0848f973, 0x27b4978c, 0x10701bd5 },
+    { 0xb9efbfa2, 0x153285eb, 0xb44db44d, 0x196fbb9b },
+    { 0x6c07b696, 0xadeee7f8, 0xf5b4d936, 0x13ae3591 },
+    { 0xaf182222, 0x4d686a4e, 0x3daada91, 0x1e74404f },
+    { 0xe09ebd9f, 0x98c0a106, 0xfda7c257, 0x17900ea4 },
+    { 0x71497d0e, 0x8f20e373, 0x76d820b2, 0x123b1405 },
+    { 0x34743d85, 0xb0431381, 0x5f7a29ad, 0x1c35f427 },
+    #endif
+};
+
+// What to add to pow5_split(i).
+static const uint32_t pow5_split_offset[] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    0x40000000, 0x59695995,
+    0x55545555, 0x56555515, 0x41150504, 0x40555410, 0x44555145, 0x44504540,
+    0x45555550, 0x40004000, 0x96440440, 0x55565565, 0x54454045, 0x40154151,
+    0x55559155, 0x51405555, 0x54414105, 0x00000401,
+    #endif
+};
+
+// What to add to pow5_inv_split(i), plus one.
+static const uint32_t pow5_inv_split_offset[] = {
+    0xaaaa9aa9, 0x5556aa5a, 0x25555555, 0x55955959,
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    0x9a666559, 0x9a6aaaaa,
+    0x554559a6, 0x515a5554, 0x55555554, 0x69555a96, 0x555a99a9, 0xaa655699,
+    0xa66965a9, 0x96959555, 0x56555566, 0x55965a55, 0xaaa6a955, 0x5aaaaaaa,
+    0xa9956956, 0x95595555, 0x56595565, 0x00001655,
+    #endif
+};
+
+static const uint64_t pow10_u64[] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u,
+    1000000000u, 10000000000u, 100000000000u, 1000000000000u, 10000000000000u,
+    100000000000000u, 1000000000000000u, 10000000000000000u,
+    100000000000000000u, 1000000000000000000u, 10000000000000000000u,
+};
+
+// bits(5^e), for 0 <= e <= 3528.
+static inline int pow5_bits(int e) {
+    return (int)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e)), for 0 <= e <= 1650.
+static inline int log10_pow2(int e) {
+    return (int)(((uint32_t)e * 78913) >> 18);
+}
+
+// floor(log10(5^e)), for 0 <= e <= 2620.
+static inline int log10_pow5(int e) {
+    return (int)(((uint32_t)e * 732923) >> 20);
+}
+
+// out = a * b.
+static void mul_128_64(uint32_t out[6], const uint32_t a[4], uint64_t b) {
+    uint32_t b_lo = (uint32_t)b;
+    uint32_t b_hi = (uint32_t)(b >> 32);
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++) {
+        carry += (uint64_t)a[i] * b_lo;
+        out[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    out[4] = (uint32_t)carry;
+    carry = 0;
+    for (int i = 0; i < 4; i++) {
+        carry += (uint64_t)a[i] * b_hi + out[i + 1];
+        out[i + 1] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    out[5] = (uint32_t)carry;
+}
+
+// The low n words of in >> shift.
+static void shift_right_192(uint32_t *out, size_t n, const uint32_t in[6], int shift) {
+    int w = shift / 32;
+    int b = shift % 32;
+    for (size_t i = 0; i < n; i++, w++) {
+        uint32_t lo = w < 6 ? in[w] : 0;
+        uint32_t hi = w + 1 < 6 ? in[w + 1] : 0;
+        out[i] = b == 0 ? lo : (lo >> b) | (hi << (32 - b));
+    }
+}
+
+// a += delta, where delta is small.
+static void add_small_128(uint32_t a[4], int delta) {
+    int64_t carry = delta;
+    for (int i = 0; i < 4 && carry != 0; i++) {
+        carry += a[i];
+        a[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+}
+
+static inline int pow5_offset(const uint32_t *table, int i) {
+    return (table[i / 16] >> (2 * (i % 16))) & 3;
+}
+
+static void pow5_split(int i, uint32_t out[4]) {
+    int base = i / POW5_STRIDE;
+    int rem = i % POW5_STRIDE;
+    if (rem == 0) {
+        memcpy(out, pow5_split_base[base], 4 * sizeof(uint32_t));
+        return;
+    }
+    uint32_t prod[6];
+    mul_128_64(prod, pow5_split_base[base], pow5_small[rem]);
+    shift_right_192(out, 4, prod, pow5_bits(i) - pow5_bits(base * POW5_STRIDE));
+    add_small_128(out, pow5_offset(pow5_split_offset, i));
+}
+
+static void pow5_inv_split(int i, uint32_t out[4]) {
+    int base = (i + POW5_STRIDE - 1) / POW5_STRIDE;
+    int rem = base * POW5_STRIDE - i;
+    if (rem == 0) {
+        memcpy(out, pow5_inv_split_base[base], 4 * sizeof(uint32_t));
+        return;
+    }
+    uint32_t prod[6];
+    mul_128_64(prod, pow5_inv_split_base[base], pow5_small[rem]);
+    shift_right_192(out, 4, prod, pow5_bits(base * POW5_STRIDE) - pow5_bits(i));
+    add_small_128(out, pow5_offset(pow5_inv_split_offset, i) - 1);
+}
+
+// floor(m * mul / 2^shift), which must fit in 64 bits.
+static uint64_t mul_shift(uint64_t m, const uint32_t mul[4], int shift) {
+    uint32_t prod[6];
+    uint32_t res[2];
+    mul_128_64(prod, mul, m);
+    shift_right_192(res, 2, prod, shift);
+    return ((uint64_t)res[1] << 32) | res[0];
+}
+
+static bool multiple_of_pow5(uint64_t value, int p) {
+    for (; p > 0; p--) {
+        if (value % 5 != 0) {
+            return false;
+        }
+        value /= 5;
+    }
+    return true;
+}
+
+static int decimal_length(uint64_t v) {
+    int n = 1;
+    while (n < 20 && v >= pow10_u64[n]) {
+        n++;
+    }
+    return n;
+}
+
+// Convert a finite, positive f to digits * 10^exp. With shortest, digits are
+// the fewest that read back as f, closest to it. Otherwise they are the start
+// of the exact value of f, and the return value says whether that is all of it.
+static bool fp_to_decimal(FPTYPE f, bool shortest, uint64_t *digits, int *exp) {
+    mp_float_union_t fb = {f};
+    mp_float_uint_t frac = fb.i & (((mp_float_uint_t)1 << MP_FLOAT_FRAC_BITS) - 1);
+    int ieee_exp = (int)((fb.i >> MP_FLOAT_FRAC_BITS) & ((1 << MP_FLOAT_EXP_BITS) - 1));
+    uint64_t m2;
+    int e2;
+    if (ieee_exp == 0) {
+        m2 = frac;
+        e2 = 1 - MP_FLOAT_EXP_BIAS - MP_FLOAT_FRAC_BITS - 2;
+        if (!shortest) {
+            // Normalise, to have as many digits as for other floats.
+            while (!(m2 >> MP_FLOAT_FRAC_BITS)) {
+                m2 <<= 1;
+                e2--;
+            }
+        }
+    } else {
+        m2 = ((uint64_t)1 << MP_FLOAT_FRAC_BITS) | frac;
+        e2 = ieee_exp - MP_FLOAT_EXP_BIAS - MP_FLOAT_FRAC_BITS - 2;
+    }
+    // The values halfway to the neighbouring floats are mp and mm, in units
+    // of 2^e2. A decimal on either of them reads back as f if m2 is even.
+    bool even = (m2 & 1) == 0;
+    uint64_t mv = 4 * m2;
+    uint64_t mp = mv + 2;
+    uint64_t mm = mv - 1 - (frac != 0 || ieee_exp <= 1);
+
+    // vr, vp and vm are mv, mp and mm scaled by 10^-e10 and rounded down, and
+    // the flags are whether nothing was lost in doing so.
+    uint64_t vr, vp = 0, vm = 0;
+    int e10;
+    bool vr_exact;
+    bool vm_exact = false;
+    uint32_t pow[4];
+    if (e2 >= 0) {
+        int q = log10_pow2(e2) - (e2 > 3);
+        e10 = q;
+        pow5_inv_split(q, pow);
+        int shift = -e2 + q + POW5_BITS + pow5_bits(q) - 1;
+        vr = mul_shift(mv, pow, shift);
+        vr_exact = multiple_of_pow5(mv, q);
+        if (shortest) {
+            vp = mul_shift(mp, pow, shift);
+            vm = mul_shift(mm, pow, shift);
+            // At most one of mv, mp and mm is a multiple of 5.
+            if (mv % 5 != 0) {
+                if (even) {
+                    vm_exact = multiple_of_pow5(mm, q);
+                } else {
+                    vp -= multiple_of_pow5(mp, q);
+                }
+            }
+        }
+    } else {
+        int q = log10_pow5(-e2) - (-e2 > 1);
+        e10 = q + e2;
+        int i = -e2 - q;
+        pow5_split(i, pow);
+        int shift = q - (pow5_bits(i) - POW5_BITS);
+        vr = mul_shift(mv, pow, shift);
+        if (shortest) {
+            vp = mul_shift(mp, pow, shift);
+            vm = mul_shift(mm, pow, shift);
+        }
+        if (q <= 1) {
+            // mv, mp and mm have at least one trailing zero bit.
+            vr_exact = true;
+            if (even) {
+                vm_exact = mv - mm == 2;
+            } else {
+                vp--;
+            }
+        } else {
+            // For q > 1, mp and mm aren't multiples of 4.
+            vr_exact = q < 64 && (mv & (((uint64_t)1 << q) - 1)) == 0;
+        }
+    }
+
+    if (!shortest) {
+        *digits = vr;
+        *exp = e10;
+        return vr_exact;
+    }
+
+    // Remove digits while vp and vm still differ.
+    int removed = 0;
+    int last_removed = 0;
+    while (vp / 10 > vm / 10) {
+        vm_exact &= vm % 10 == 0;
+        vr_exact &= last_removed == 0;
+        last_removed = vr % 10;
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        removed++;
+    }
+    if (vm_exact && even) {
+        // vm is allowed, and may have trailing zeros to remove too.
+        while (vm % 10 == 0) {
+            vr_exact &= last_removed == 0;
+            last_removed = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+    }
+    if (vr_exact && last_removed == 5 && vr % 2 == 0) {
+        // Exactly halfway, so round to even.
+        last_removed = 4;
+    }
+    *digits = vr + ((vr == vm && !(even && vm_exact)) || last_removed >= 5);
+    *exp = e10 + removed;
+    return false;
+}
+
+// Whether bits from to to - 1 of a are all set, or all clear.
+static bool bits_are(const uint32_t a[6], int from, int to, bool set) {
+    for (int i = from / 32; i * 32 < to; i++) {
+        uint32_t mask = 0xffffffff;
+        if (i * 32 < from) {
+            mask &= 0xffffffff << (from - i * 32);
+        }
+        if ((i + 1) * 32 > to) {
+            mask &= 0xffffffff >> ((i + 1) * 32 - to);
+        }
+        if ((a[i] & mask) != (set ? mask : 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool mp_float_from_decimal(uint64_t digits, int exp, mp_float_t *out) {
+    // Nothing else is needed for more digits than this.
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+    const int max_dec_exp = 39;
+    const int min_dec_exp = -46;
+    #else
+    const int max_dec_exp = 309;
+    const int min_dec_exp = -324;
+    #endif
+    if (digits == 0 || digits >= pow10_u64[19]) {
+        return false;
+    }
+    int len = decimal_length(digits);
+    mp_float_union_t fb;
+    if (exp + len <= min_dec_exp) {
+        fb.i = 0;
+        goto done;
+    }
+    if (exp + len - 1 >= max_dec_exp) {
+        goto inf;
+    }
+
+    // The value is in [a, a + digits) * 2^shift, or exactly a * 2^shift.
+    uint32_t pow[4];
+    uint32_t a[6];
+    int shift;
+    bool exact;
+    if (exp >= 0) {
+        pow5_split(exp, pow);
+        shift = exp + pow5_bits(exp) - POW5_BITS;
+        exact = pow5_bits(exp) <= POW5_BITS;
+    } else {
+        // If digits is a multiple of 5^-exp, as for a tie, the value is exact.
+        uint64_t d = digits;
+        int i = -exp;
+        for (; i > 0 && d % 5 == 0; i--) {
+            d /= 5;
+        }
+        if (i == 0) {
+            digits = d;
+            pow5_split(0, pow);
+            shift = exp - (POW5_BITS - 1);
+            exact = true;
+        } else {
+            pow5_inv_split(-exp, pow);
+            add_small_128(pow, -1);
+            shift = exp - pow5_bits(-exp) + 1 - POW5_BITS;
+            exact = false;
+        }
+    }
+    mul_128_64(a, pow, digits);
+
+    int top = 5;
+    while (a[top] == 0) {
+        top--;
+    }
+    int bits = 32 * top + 32 - __builtin_clz(a[top]);
+    int lead = bits - 1 + shift;
+    if (lead > MP_FLOAT_EXP_BIAS) {
+        goto inf;
+    }
+    // Drop bits to leave MP_FLOAT_FRAC_BITS + 1, or fewer for a subnormal.
+    int drop = bits - MP_FLOAT_FRAC_BITS - 1;
+    if (lead < 1 - MP_FLOAT_EXP_BIAS) {
+        drop += 1 - MP_FLOAT_EXP_BIAS - lead;
+    }
+    if (drop > bits) {
+        // Less than half the smallest subnormal.
+        fb.i = 0;
+        goto done;
+    }
+    uint32_t m_words[2];
+    shift_right_192(m_words, 2, a, drop);
+    uint64_t m = ((uint64_t)m_words[1] << 32) | m_words[0];
+
+    // Round half to even. This needs the dropped bits compared with half.
+    bool round_up;
+    if (a[(drop - 1) / 32] & (1u << ((drop - 1) % 32))) {
+        // At least half.
+        round_up = !exact || !bits_are(a, 0, drop - 1, false) || (m & 1);
+    } else {
+        // Less than half, but if inexact, a + digits might not be.
+        uint64_t low = ((uint64_t)a[1] << 32) | a[0];
+        if (!exact && bits_are(a, 64, drop - 1, true) && low > (uint64_t)0 - digits) {
+            return false;
+        }
+        round_up = false;
+    }
+    m += round_up;
+
+    // A carry out of the mantissa goes into the exponent, as it should.
+    fb.i = ((mp_float_uint_t)(drop + shift + MP_FLOAT_FRAC_BITS + MP_FLOAT_EXP_BIAS - 1) << MP_FLOAT_FRAC_BITS) + (mp_float_uint_t)m;
+    goto done;
+inf:
+    fb.i = (mp_float_uint_t)((1 << MP_FLOAT_EXP_BITS) - 1) << MP_FLOAT_FRAC_BITS;
+done:
+    *out = fb.f;
+    return true;
+}
+
+// Formatting makes at most this many digits, which is more than any caller's
+// buffer has room for.
+#define FP_MAX_DIGITS (32)
+
+// Enough words for f * 10^FP_MAX_DIGITS scaled to an integer, for any f.
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+#define BIG_WORDS (8)
+#else
+#define BIG_WORDS (30)
+#endif
+
+// a = a * x, for an a of *n words.
+static void big_mul_small(uint32_t a[BIG_WORDS], int *n, uint32_t x) {
+    uint32_t carry = 0;
+    for (int i = 0; i < *n; i++) {
+        uint64_t p = (uint64_t)a[i] * x + carry;
+        a[i] = (uint32_t)p;
+        carry = p >> 32;
+    }
+    if (carry) {
+        a[(*n)++] = carry;
+    }
+}
+
+// a = a / d, returning the remainder.
+static uint32_t big_div_small(uint32_t a[BIG_WORDS], int *n, uint32_t d) {
+    uint64_t rem = 0;
+    for (int i = *n - 1; i >= 0; i--) {
+        uint64_t cur = (rem << 32) | a[i];
+        a[i] = (uint32_t)(cur / d);
+        rem = cur % d;
+    }
+    while (*n > 1 && a[*n - 1] == 0) {
+        (*n)--;
+    }
+    return (uint32_t)rem;
+}
+
+// Put the first num_digits digits of the exact value of a finite, positive f,
+// whose leading digit is at 10^e, in dig, rounded half to even. This is for
+// when more digits are wanted than fp_to_decimal() gives. Returns whether
+// rounding up carried into a new leading digit, leaving dig as 100...0.
+static bool fp_exact_digits(FPTYPE f, int e, char *dig, int num_digits) {
+    mp_float_union_t fb = {f};
+    mp_float_uint_t frac = fb.i & (((mp_float_uint_t)1 << MP_FLOAT_FRAC_BITS) - 1);
+    int ieee_exp = (int)((fb.i >> MP_FLOAT_FRAC_BITS) & ((1 << MP_FLOAT_EXP_BITS) - 1));
+    uint64_t m2 = frac;
+    int e2 = 1 - MP_FLOAT_EXP_BIAS - MP_FLOAT_FRAC_BITS;
+    if (ieee_exp != 0) {
+        m2 |= (uint64_t)1 << MP_FLOAT_FRAC_BITS;
+        e2 = ieee_exp - MP_FLOAT_EXP_BIAS - MP_FLOAT_FRAC_BITS;
+    }
+
+    // f * 10^s = m2 * 2^(e2 + s) * 5^s has the digits wanted and one more to
+    // round with, before the point. Multiply before dividing, so that nothing
+    // but the part after the point is lost.
+    int s = num_digits - e;
+    int exp2 = e2 + s;
+    int exp5 = s;
+    uint32_t big[BIG_WORDS] = {(uint32_t)m2, (uint32_t)(m2 >> 32)};
+    int n = 2;
+    bool rest = false;
+    while (exp5 > 0) {
+        int k = MIN(exp5, 13);
+        big_mul_small(big, &n, (uint32_t)pow5_small[k]);
+        exp5 -= k;
+    }
+    while (exp2 > 0) {
+        int k = MIN(exp2, 31);
+        big_mul_small(big, &n, (uint32_t)1 << k);
+        exp2 -= k;
+    }
+    while (exp5 < 0) {
+        int k = MIN(-exp5, 13);
+        rest |= big_div_small(big, &n, (uint32_t)pow5_small[k]) != 0;
+        exp5 += k;
+    }
+    while (exp2 < 0) {
+        int k = MIN(-exp2, 31);
+        rest |= big_div_small(big, &n, (uint32_t)1 << k) != 0;
+        exp2 += k;
+    }
+
+    uint32_t round = big_div_small(big, &n, 10);
+    for (int i = num_digits - 1; i >= 0; i--) {
+        dig[i] = '0' + big_div_small(big, &n, 10);
+    }
+    if (round > 5 || (round == 5 && (rest || (dig[num_digits - 1] & 1)))) {
+        int i = num_digits - 1;
+        while (i >= 0 && dig[i] == '9') {
+            dig[i--] = '0';
+        }
+        if (i < 0) {
+            dig[0] = '1';
+            return true;
+        }
+        dig[i]++;
+    }
+    return false;
+}
+
+int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, char sign) {
+
+    char *s = buf;
+
+    if (buf_size <= FPMIN_BUF_SIZE) {
+        // FPMIN_BUF_SIZE is the minimum size needed to store any FP number.
+        // If the buffer does not have enough room for this (plus null terminator)
+        // then don't try to format the float.
+
+        if (buf_size >= 2) {
+            *s++ = '?';
+        }
+        if (buf_size >= 1) {
+            *s = '\0';
+        }
+        return buf_size >= 2;
+    }
+    if (fp_signbit(f) && !fp_isnan(f)) {
+        *s++ = '-';
+        f = -f;
+    } else {
+        if (sign) {
+            *s++ = sign;
+        }
+    }
+
+    // buf_remaining contains bytes available for digits and exponent.
+    // It is buf_size minus room for the sign and null byte.
+    // Digits are made in dig[], so there's no room for more than that.
+    int buf_remaining = MIN((int)(buf_size - 1 - (s - buf)), FP_MAX_DIGITS);
+
+    {
+        char uc = fmt & 0x20;
+        if (fp_isinf(f)) {
+            *s++ = 'I' ^ uc;
+            *s++ = 'N' ^ uc;
+            *s++ = 'F' ^ uc;
+            goto ret;
+        } else if (fp_isnan(f)) {
+            *s++ = 'N' ^ uc;
+            *s++ = 'A' ^ uc;
+            *s++ = 'N' ^ uc;
+        ret:
+            *s = '\0';
+            return s - buf;
+        }
+    }
+
+    if (prec < 0) {
+        prec = 6;
+    }
+    char e_char = 'E' | (fmt & 0x20);   // e_char will match case of fmt
+    fmt |= 0x20; // Force fmt to be lowercase
+
+    // The value is digits * 10^(e - num_digits + 1), so e is the power of ten
+    // of the leading digit.
+    uint64_t digits = 0;
+    int num_digits = 1;
+    int e = 0;
+    bool exact = true;
+    if (!fp_iszero(f)) {
+        exact = fp_to_decimal(f, fmt == 'r', &digits, &e);
+        if (fmt == 'r') {
+            while (digits % 10 == 0) {
+                digits /= 10;
+                e++;
+            }
+        }
+        num_digits = decimal_length(digits);
+        e += num_digits - 1;
+    }
+
+    bool strip_zeros = false;
+    if (fmt == 'r') {
+        // All the digits, with an exponent for e < -4 or e >= prec, like 'g'.
+        if (e < -4 || e >= prec) {
+            fmt = 'e';
+            prec = num_digits - 1;
+        } else {
+            fmt = 'f';
+            prec = MAX(num_digits - 1 - e, 0);
+        }
+    } else if (fmt == 'g') {
+        if (prec == 0) {
+            prec = 1;
+        }
+        // Leave room for an exponent.
+        if (prec + (FPMIN_BUF_SIZE - 1) > buf_remaining) {
+            prec = buf_remaining - (FPMIN_BUF_SIZE - 1);
+        }
+        if (prec <= 0) {
+            fmt = 'e';
+            prec = 0;
+        } else {
+            strip_zeros = true;
+        }
+    }
+
+    // Cut the precision to fit the buffer.
+    if (fmt == 'f') {
+        int int_len = MAX(e, 0) + 1;
+        if (int_len > buf_remaining) {
+            fmt = 'e';
+        } else if (int_len + (prec > 0 ? prec + 1 : 0) > buf_remaining) {
+            prec = MAX(buf_remaining - int_len - 1, 0);
+        }
+    }
+    if (fmt == 'e') {
+        int e_len = (e <= -100 || e >= 100) ? 5 : 4;
+        if (1 + (prec > 0 ? prec + 1 : 0) + e_len > buf_remaining) {
+            prec = MAX(buf_remaining - e_len - 2, 0);
+        }
+    }
+
+    // Round half to even to the number of significant digits wanted.
+    int want = fmt == 'f' ? e + 1 + prec : fmt == 'e' ? prec + 1 : prec;
+    char dig[FP_MAX_DIGITS];
+    bool have_dig = false;
+    if (want >= num_digits && !exact) {
+        // The digits past these aren't all zeros, so they have to be worked out.
+        if (fp_exact_digits(f, e, dig, want)) {
+            e++;
+        }
+        num_digits = want;
+        have_dig = true;
+    } else if (want < num_digits) {
+        uint64_t rest = 0;
+        uint64_t half = 1;
+        if (want <= 0) {
+            // Only 'f' gets here. What's left is 0, or 1 in the last place.
+            if (want == 0) {
+                rest = digits;
+                half = 5 * pow10_u64[num_digits - 1];
+            }
+            digits = 0;
+            e = -prec;
+            num_digits = 1;
+        } else {
+            uint64_t div = pow10_u64[num_digits - want];
+            rest = digits % div;
+            half = div / 2;
+            digits /= div;
+            num_digits = want;
+        }
+        if (rest > half || (rest == half && (!exact || digits % 2 != 0))) {
+            digits++;
+            if (digits == pow10_u64[num_digits]) {
+                // Rounded up to the next power of ten.
+                e++;
+                if (fmt == 'f') {
+                    num_digits++;
+                } else {
+                    digits /= 10;
+                }
+            }
+        }
+    }
+
+    if (strip_zeros) {
+        // Now 'g' can choose, with prec significant digits.
+        if (e < -4 || e >= prec) {
+            fmt = 'e';
+            prec--;
+        } else {
+            fmt = 'f';
+            prec -= e + 1;
+        }
+    }
+
+    // Rounding up to a power of ten may have made it a character too long, so
+    // drop a trailing zero.
+    int len = fmt == 'f' ? MAX(e, 0) + 1 : ((e <= -100 || e >= 100) ? 6 : 5);
+    if (prec > 0) {
+        len += prec + 1;
+    }
+    if (len > buf_remaining) {
+        if (prec > 0) {
+            prec--;
+        } else {
+            fmt = 'e';
+        }
+    }
+
+    for (int i = num_digits - 1; i >= 0 && !have_dig; i--) {
+        #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+        // Shortest digits fit in 32 bits, but a fixed precision can ask for
+        // more, so only divide in 32 bits once the rest fits.
+        if (digits <= UINT32_MAX) {
+            dig[i] = '0' + (uint32_t)digits % 10;
+            digits = (uint32_t)digits / 10;
+            continue;
+        }
+        #endif
+        dig[i] = '0' + digits % 10;
+        digits /= 10;
+    }
+
+    if (fmt == 'f') {
+        // Count the places down from the leading one, or the units.
+        for (int place = MAX(e, 0); place >= -prec; place--) {
+            int i = e - place;
+            *s++ = i >= 0 && i < num_digits ? dig[i] : '0';
+            if (place == 0 && prec > 0) {
+                *s++ = '.';
+            }
+        }
+    } else {
+        *s++ = dig[0];
+        if (prec > 0) {
+            *s++ = '.';
+            for (int i = 1; i <= prec; i++) {
+                *s++ = i < num_digits ? dig[i] : '0';
+            }
+        }
+    }
+
+    if (strip_zeros && prec > 0) {
+        // Remove trailing zeros and a trailing decimal point
+        while (s[-1] == '0') {
+            s--;
+        }
+        if (s[-1] == '.') {
+            s--;
+        }
+    }
+    if (fmt == 'e') {
+        *s++ = e_char;
+        if (e < 0) {
+            *s++ = '-';
+            e = -e;
+        } else {
+            *s++ = '+';
+        }
+        if (e >= 100) {
+            *s++ = '0' + (e / 100);
+        }
+        *s++ = '0' + ((e / 10) % 10);
+        *s++ = '0' + (e % 10);
+    }
+    *s = '\0';
+
+    // verify that we did not overrun the input buffer
+    assert((size_t)(s + 1 - buf) <= buf_size);
+
+    return s - buf;
+}
+
+#else
+
 int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, char sign) {
 
     char *s = buf;
@@ -423,4 +1220,6 @@ int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, ch
     return s - buf;
 }
 
+#endif // MICROPY_FLOAT_FAST_CONVERSION
+
 #endif // MICROPY_FLOAT_IMPL != MICROPY_FLOAT_IMPL_NONE
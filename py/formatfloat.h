@@ -26,10 +26,30 @@
 #ifndef MICROPY_INCLUDED_PY_FORMATFLOAT_H
 #define MICROPY_INCLUDED_PY_FORMATFLOAT_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "py/mpconfig.h"
 
 #if MICROPY_PY_BUILTINS_FLOAT
 int mp_format_float(mp_float_t f, char *buf, size_t bufSize, char fmt, int prec, char sign);
+
+// CIRCUITPY-CHANGE: the format for repr(). With MICROPY_FLOAT_FAST_CONVERSION, 'r'
+// gives the shortest digits that read back as the same value, switching to an
+// exponent like 'g' at prec. That isn't possible for a 30 bit float, which is
+// a 32 bit one with its low bits dropped, so those keep 'g'.
+#if MICROPY_FLOAT_FAST_CONVERSION && MICROPY_OBJ_REPR != MICROPY_OBJ_REPR_C
+#define MP_FLOAT_REPR_FMT 'r'
+#else
+#define MP_FLOAT_REPR_FMT 'g'
+#endif
+
+#if MICROPY_FLOAT_FAST_CONVERSION
+// CIRCUITPY-CHANGE: *out = digits * 10^exp, correctly rounded. Returns false
+// if digits is 0 or more than 19 digits long, or rarely if it's too close to
+// call, when a slower way is needed.
+bool mp_float_from_decimal(uint64_t digits, int exp, mp_float_t *out);
+#endif
 #endif
 
 #endif // MICROPY_INCLUDED_PY_FORMATFLOAT_H
@@ -39,6 +39,13 @@
 // many string entries.
 extern const char mp_frozen_names[];
 
+// CIRCUITPY-CHANGE: the names of each kind of entry, sorted, as (offset in
+// mp_frozen_names, entry number) pairs.
+extern const uint16_t mp_frozen_str_index_len;
+extern const uint16_t mp_frozen_str_index[][2];
+extern const uint16_t mp_frozen_mpy_index_len;
+extern const uint16_t mp_frozen_mpy_index[][2];
+
 #if MICROPY_MODULE_FROZEN_STR
 
 #ifndef MICROPY_MODULE_FROZEN_LEXER
@@ -61,75 +68,97 @@ extern const mp_frozen_module_t *const mp_frozen_mpy_content[];
 
 #endif // MICROPY_MODULE_FROZEN_MPY
 
+// CIRCUITPY-CHANGE: compare a name with str followed by c.
+static int frozen_name_cmp(const char *name, const char *str, size_t len, char c) {
+    int cmp = strncmp(name, str, len);
+    if (cmp == 0) {
+        cmp = (unsigned char)name[len] - (unsigned char)c;
+    }
+    return cmp;
+}
+
+// Returns the first entry in the index that isn't before str followed by c.
+static size_t frozen_index_search(const uint16_t index[][2], size_t index_len, const char *str, size_t len, char c) {
+    size_t lo = 0;
+    size_t hi = index_len;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (frozen_name_cmp(mp_frozen_names + index[mid][0], str, len, c) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Look for str as a name, or as a directory that names are in. Sets *entry to
+// the entry number of a name.
+static mp_import_stat_t frozen_index_lookup(const uint16_t index[][2], size_t index_len, const char *str, size_t len, size_t *entry) {
+    size_t i = frozen_index_search(index, index_len, str, len, '\0');
+    if (i < index_len && frozen_name_cmp(mp_frozen_names + index[i][0], str, len, '\0') == 0) {
+        *entry = index[i][1];
+        return MP_IMPORT_STAT_FILE;
+    }
+    // Names in the directory sort together, after str + "/".
+    i = frozen_index_search(index, index_len, str, len, '/');
+    if (i < index_len && strncmp(mp_frozen_names + index[i][0], str, len) == 0
+        && mp_frozen_names[index[i][0] + len] == '/') {
+        return MP_IMPORT_STAT_DIR;
+    }
+    return MP_IMPORT_STAT_NO_EXIST;
+}
+
 // Search for "str" as a frozen entry, returning the stat result
 // (no-exist/file/dir), as well as the type (none/str/mpy) and data.
 // frozen_type can be NULL if its value isn't needed (and then data is assumed to be NULL).
 mp_import_stat_t mp_find_frozen_module(const char *str, int *frozen_type, void **data) {
     size_t len = strlen(str);
-    const char *name = mp_frozen_names;
 
     if (frozen_type != NULL) {
         *frozen_type = MP_FROZEN_NONE;
     }
 
-    // Count the number of str lengths we have to find how many str entries.
-    size_t num_str = 0;
-    #if MICROPY_MODULE_FROZEN_STR && MICROPY_MODULE_FROZEN_MPY
-    for (const uint32_t *s = mp_frozen_str_sizes; *s != 0; ++s) {
-        ++num_str;
-    }
-    #endif
-
-    for (size_t i = 0; *name != 0; i++) {
-        size_t entry_len = strlen(name);
-        if (entry_len >= len && memcmp(str, name, len) == 0) {
-            // Query is a prefix of the current entry.
-            if (entry_len == len) {
-                // Exact match --> file.
-
-                if (frozen_type != NULL) {
-                    #if MICROPY_MODULE_FROZEN_STR
-                    if (i < num_str) {
-                        *frozen_type = MP_FROZEN_STR;
-                        // Use the size table to figure out where this index starts.
-                        size_t offset = 0;
-                        for (size_t j = 0; j < i; ++j) {
-                            offset += mp_frozen_str_sizes[j] + 1;
-                        }
-                        size_t content_len = mp_frozen_str_sizes[i];
-                        const char *content = &mp_frozen_str_content[offset];
-
-                        // Note: str & len have been updated by find_frozen_entry to strip
-                        // the ".frozen/" prefix (to avoid this being a distinct qstr to
-                        // the original path QSTR in frozen_content.c).
-                        qstr source = qstr_from_strn(str, len);
-                        mp_lexer_t *lex = MICROPY_MODULE_FROZEN_LEXER(source, content, content_len, 0);
-                        *data = lex;
-                    }
-                    #endif
-
-                    #if MICROPY_MODULE_FROZEN_MPY
-                    if (i >= num_str) {
-                        *frozen_type = MP_FROZEN_MPY;
-                        // Load the corresponding index as a raw_code, taking
-                        // into account any string entries to offset by.
-                        *data = (void *)mp_frozen_mpy_content[i - num_str];
-                    }
-                    #endif
-                }
-
-                return MP_IMPORT_STAT_FILE;
-            } else if (name[len] == '/') {
-                // Matches up to directory separator, this is a valid
-                // directory path.
-                return MP_IMPORT_STAT_DIR;
+    // CIRCUITPY-CHANGE: binary search the names generated in sorted order,
+    // rather than scanning all of them. String entries come first.
+    size_t i;
+    mp_import_stat_t stat = frozen_index_lookup(mp_frozen_str_index, mp_frozen_str_index_len, str, len, &i);
+    if (stat == MP_IMPORT_STAT_FILE) {
+        #if MICROPY_MODULE_FROZEN_STR
+        if (frozen_type != NULL) {
+            *frozen_type = MP_FROZEN_STR;
+            // Use the size table to figure out where this index starts.
+            size_t offset = 0;
+            for (size_t j = 0; j < i; ++j) {
+                offset += mp_frozen_str_sizes[j] + 1;
             }
+            size_t content_len = mp_frozen_str_sizes[i];
+            const char *content = &mp_frozen_str_content[offset];
+
+            // Note: str & len have been updated by find_frozen_entry to strip
+            // the ".frozen/" prefix (to avoid this being a distinct qstr to
+            // the original path QSTR in frozen_content.c).
+            qstr source = qstr_from_strn(str, len);
+            mp_lexer_t *lex = MICROPY_MODULE_FROZEN_LEXER(source, content, content_len, 0);
+            *data = lex;
         }
-        // Skip null separator.
-        name += entry_len + 1;
+        #endif
+        return stat;
     }
 
-    return MP_IMPORT_STAT_NO_EXIST;
+    mp_import_stat_t mpy_stat = frozen_index_lookup(mp_frozen_mpy_index, mp_frozen_mpy_index_len, str, len, &i);
+    if (mpy_stat == MP_IMPORT_STAT_FILE) {
+        #if MICROPY_MODULE_FROZEN_MPY
+        if (frozen_type != NULL) {
+            *frozen_type = MP_FROZEN_MPY;
+            // Load the corresponding index as a raw_code.
+            *data = (void *)mp_frozen_mpy_content[i];
+        }
+        #endif
+        return mpy_stat;
+    }
+
+    return stat != MP_IMPORT_STAT_NO_EXIST ? stat : mpy_stat;
 }
 
 #endif // MICROPY_MODULE_FROZEN
@@ -43,6 +43,29 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if CIRCUITPY_UHEAP
+#include "shared-module/uheap/__init__.h"
+#endif
+
+#if MICROPY_GC_MOVABLE
+#include "py/objarray.h"
+#endif
+
+#if MICROPY_GC_STATS
+#include "py/mphal.h"
+#if CIRCUITPY_TIME
+#include "shared-bindings/time/__init__.h"
+#endif
+#endif
+
+#if CIRCUITPY_OBJECT_POOL
+#include "supervisor/shared/object_pool.h"
+// Pointers outside the VM heap may be to pooled objects.
+#define MARK_NON_HEAP_PTR(ptr) object_pool_mark(ptr)
+#else
+#define MARK_NON_HEAP_PTR(ptr)
+#endif
+
 #if MICROPY_ENABLE_GC
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -103,6 +126,15 @@
 #define ATB_HEAD_TO_MARK(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
 #define ATB_MARK_TO_HEAD(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
 
+// CIRCUITPY-CHANGE
+// True if the block is the head of an allocation.  While an incremental sweep
+// is pending, live heads that it hasn't reached yet are still marked.
+#if MICROPY_GC_INCREMENTAL
+#define ATB_IS_HEAD(area, block) (ATB_GET_KIND(area, block) == AT_HEAD || ATB_GET_KIND(area, block) == AT_MARK)
+#else
+#define ATB_IS_HEAD(area, block) (ATB_GET_KIND(area, block) == AT_HEAD)
+#endif
+
 #define BLOCK_FROM_PTR(area, ptr) (((byte *)(ptr) - area->gc_pool_start) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(area, block) (((block) * BYTES_PER_BLOCK + (uintptr_t)area->gc_pool_start))
 
@@ -123,6 +155,37 @@
 #define FTB_CLEAR(area, block) do { area->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_NOSCAN
+// NTB = no-scan table byte
+// if set, then the corresponding block holds no heap pointers and its
+// contents are not traced when it is marked
+
+#define BLOCKS_PER_NTB (8)
+
+#define NTB_GET(area, block) ((area->gc_noscan_table_start[(block) / BLOCKS_PER_NTB] >> ((block) & 7)) & 1)
+#define NTB_SET(area, block) do { area->gc_noscan_table_start[(block) / BLOCKS_PER_NTB] |= (1 << ((block) & 7)); } while (0)
+#define NTB_CLEAR(area, block) do { area->gc_noscan_table_start[(block) / BLOCKS_PER_NTB] &= (~(1 << ((block) & 7))); } while (0)
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// MTB = movable table byte
+// 2 bits per block: the low bit is set if the corresponding block may be
+// moved by gc_compact(), the high bit is set while gc_compact() has found a
+// reference to the block that it can't update (the block is pinned)
+
+#define BLOCKS_PER_MTB (4)
+
+#define MTB_MOVABLE (1)
+#define MTB_PINNED (2)
+#define MTB_PINNED_MASK (0xaa)
+
+#define MTB_GET(area, block) ((area->gc_movable_table_start[(block) / BLOCKS_PER_MTB] >> (((block) & 3) * 2)) & 3)
+#define MTB_SET(area, block, bits) do { area->gc_movable_table_start[(block) / BLOCKS_PER_MTB] |= ((bits) << (((block) & 3) * 2)); } while (0)
+#define MTB_CLEAR(area, block) do { area->gc_movable_table_start[(block) / BLOCKS_PER_MTB] &= (~(3 << (((block) & 3) * 2))); } while (0)
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_ENTER() mp_thread_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
 #define GC_EXIT() mp_thread_mutex_unlock(&MP_STATE_MEM(gc_mutex))
@@ -143,6 +206,137 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #pragma GCC pop_options
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FREE_LISTS
+// The free lists remember runs of free blocks found by the last sweep (or
+// freed since), segregated by size, so that small allocations can usually be
+// placed without a first-fit scan of the allocation table.  Because blocks
+// can be taken by the first-fit scan, or by gc_realloc growing in place,
+// without updating the lists, every entry is checked against the allocation
+// table before it is used.
+
+#if MICROPY_GC_SPLIT_HEAP
+#define FREE_RUN_AREA(run) ((run)->area)
+#else
+#define FREE_RUN_AREA(run) (&MP_STATE_MEM(area))
+#endif
+
+// Largest allocation, in blocks, served from the free lists.
+#define FREE_LIST_MAX_ALLOC (8)
+
+// The free list holding runs of n_blocks blocks.
+static inline size_t gc_free_run_class(size_t n_blocks) {
+    if (n_blocks >= 8) {
+        return 3;
+    } else if (n_blocks >= 4) {
+        return 2;
+    } else if (n_blocks >= 2) {
+        return 1;
+    }
+    return 0;
+}
+
+static void gc_free_lists_clear(void) {
+    memset(MP_STATE_MEM(gc_free_run_count), 0, sizeof(MP_STATE_MEM(gc_free_run_count)));
+}
+
+// Remember a run of free blocks if there's room in its list.  Returns false
+// if the list was already full.
+static bool gc_free_lists_push(mp_state_mem_area_t *area, size_t block, size_t n_blocks) {
+    size_t c = gc_free_run_class(n_blocks);
+    uint8_t count = MP_STATE_MEM(gc_free_run_count)[c];
+    if (count >= MICROPY_GC_FREE_LIST_LEN) {
+        return false;
+    }
+    mp_gc_free_run_t *run = &MP_STATE_MEM(gc_free_runs)[c][count];
+    #if MICROPY_GC_SPLIT_HEAP
+    run->area = area;
+    #else
+    (void)area;
+    #endif
+    run->block = block;
+    run->n_blocks = n_blocks;
+    MP_STATE_MEM(gc_free_run_count)[c] = count + 1;
+    return true;
+}
+
+// Refill the free lists from the allocation table.  The lists are used last
+// entry first, so each one is reversed at the end to hand out the runs at
+// the lowest addresses first, like the first-fit scan does.
+static void gc_free_lists_rebuild(void) {
+    gc_free_lists_clear();
+    size_t n_full = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL && n_full < MP_GC_FREE_LIST_CLASSES; area = NEXT_AREA(area)) {
+        size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        size_t run_start = 0;
+        size_t run_len = 0;
+        for (size_t block = 0; block <= max_block && n_full < MP_GC_FREE_LIST_CLASSES; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (block < max_block && ATB_GET_KIND(area, block) == AT_FREE) {
+                if (run_len++ == 0) {
+                    run_start = block;
+                }
+            } else if (run_len > 0) {
+                if (gc_free_lists_push(area, run_start, run_len)
+                    && MP_STATE_MEM(gc_free_run_count)[gc_free_run_class(run_len)] == MICROPY_GC_FREE_LIST_LEN) {
+                    n_full++;
+                }
+                run_len = 0;
+            }
+        }
+    }
+    for (size_t c = 0; c < MP_GC_FREE_LIST_CLASSES; c++) {
+        mp_gc_free_run_t *runs = MP_STATE_MEM(gc_free_runs)[c];
+        for (size_t lo = 0, hi = MP_STATE_MEM(gc_free_run_count)[c]; lo + 1 < hi; lo++, hi--) {
+            mp_gc_free_run_t tmp = runs[lo];
+            runs[lo] = runs[hi - 1];
+            runs[hi - 1] = tmp;
+        }
+    }
+}
+
+// Find n_blocks (at most FREE_LIST_MAX_ALLOC) free blocks using the free
+// lists, starting with the smallest size class that is guaranteed to fit.
+// Whatever is left of the run goes back on the lists.  With tiered areas only
+// runs in the wanted kind of area are taken; the others stay on the lists.
+static bool gc_free_lists_take(size_t n_blocks, bool want_slow, mp_state_mem_area_t **area_out, size_t *block_out) {
+    #if !MICROPY_GC_TIERED
+    (void)want_slow;
+    #endif
+    size_t c = n_blocks <= 2 ? n_blocks - 1 : n_blocks <= 4 ? 2 : 3;
+    for (; c < MP_GC_FREE_LIST_CLASSES; c++) {
+        mp_gc_free_run_t *runs = MP_STATE_MEM(gc_free_runs)[c];
+        for (size_t k = MP_STATE_MEM(gc_free_run_count)[c]; k-- > 0;) {
+            mp_gc_free_run_t run = runs[k];
+            mp_state_mem_area_t *area = FREE_RUN_AREA(&run);
+            #if MICROPY_GC_TIERED
+            if (area->slow != want_slow) {
+                continue;
+            }
+            #endif
+            // Remove the entry, keeping the order of the ones above it.
+            uint8_t count = --MP_STATE_MEM(gc_free_run_count)[c];
+            memmove(&runs[k], &runs[k + 1], (count - k) * sizeof(mp_gc_free_run_t));
+            size_t bl = 0;
+            while (bl < n_blocks && ATB_GET_KIND(area, run.block + bl) == AT_FREE) {
+                bl++;
+            }
+            if (bl < n_blocks) {
+                // Stale entry: the run has been used since it was recorded.
+                continue;
+            }
+            if (run.n_blocks > n_blocks) {
+                gc_free_lists_push(area, run.block + n_blocks, run.n_blocks - n_blocks);
+            }
+            *area_out = area;
+            *block_out = run.block;
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // calculate parameters for GC (T=total, A=alloc table, F=finaliser table, P=pool; all in bytes):
@@ -150,15 +344,31 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     //     F = A * BLOCKS_PER_ATB / BLOCKS_PER_FTB
     //     P = A * BLOCKS_PER_ATB * BYTES_PER_BLOCK
     // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
+    // CIRCUITPY-CHANGE: with MICROPY_GC_NOSCAN and MICROPY_GC_MOVABLE, the
+    // no-scan table (N) and movable table (M) follow F and are sized the same way:
+    //     N = A * BLOCKS_PER_ATB / BLOCKS_PER_NTB
+    //     M = A * BLOCKS_PER_ATB / BLOCKS_PER_MTB
     size_t total_byte_len = (byte *)end - (byte *)start;
-    #if MICROPY_ENABLE_FINALISER
+    #if MICROPY_ENABLE_FINALISER || MICROPY_GC_NOSCAN || MICROPY_GC_MOVABLE
     area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE)
         * MP_BITS_PER_BYTE
         / (
             MP_BITS_PER_BYTE
+            #if MICROPY_ENABLE_FINALISER
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB
+            #endif
+            #if MICROPY_GC_NOSCAN
+            + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_NTB
+            #endif
+            #if MICROPY_GC_MOVABLE
+            + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_MTB
+            #endif
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK
             );
+    #if MICROPY_GC_NOSCAN
+    // Leave room for rounding up the lengths of the F and N tables.
+    area->gc_alloc_table_byte_len -= 1;
+    #endif
     #else
     area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE) / (1 + MP_BITS_PER_BYTE / 2 * BYTES_PER_BLOCK);
     #endif
@@ -170,6 +380,24 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->gc_finaliser_table_start = area->gc_alloc_table_start + area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NOSCAN || MICROPY_GC_MOVABLE
+    byte *gc_table_end = area->gc_alloc_table_start + area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE;
+    #if MICROPY_ENABLE_FINALISER
+    gc_table_end += gc_finaliser_table_byte_len;
+    #endif
+    #endif
+    #if MICROPY_GC_NOSCAN
+    size_t gc_noscan_table_byte_len = (area->gc_alloc_table_byte_len * BLOCKS_PER_ATB + BLOCKS_PER_NTB - 1) / BLOCKS_PER_NTB;
+    area->gc_noscan_table_start = gc_table_end;
+    gc_table_end += gc_noscan_table_byte_len;
+    #endif
+    #if MICROPY_GC_MOVABLE
+    size_t gc_movable_table_byte_len = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB / BLOCKS_PER_MTB;
+    area->gc_movable_table_start = gc_table_end;
+    gc_table_end += gc_movable_table_byte_len;
+    #endif
+
     size_t gc_pool_block_len = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
     area->gc_pool_start = (byte *)end - gc_pool_block_len * BYTES_PER_BLOCK;
     area->gc_pool_end = end;
@@ -177,6 +405,10 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     #if MICROPY_ENABLE_FINALISER
     assert(area->gc_pool_start >= area->gc_finaliser_table_start + gc_finaliser_table_byte_len);
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NOSCAN || MICROPY_GC_MOVABLE
+    assert(area->gc_pool_start >= gc_table_end);
+    #endif
 
     #if MICROPY_ENABLE_FINALISER
     // clear ATB's and FTB's
@@ -185,6 +417,15 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // clear ATB's
     memset(area->gc_alloc_table_start, 0, area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE);
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NOSCAN
+    // clear NTB's
+    memset(area->gc_noscan_table_start, 0, gc_noscan_table_byte_len);
+    #endif
+    #if MICROPY_GC_MOVABLE
+    // clear MTB's
+    memset(area->gc_movable_table_start, 0, gc_movable_table_byte_len);
+    #endif
 
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
@@ -193,6 +434,11 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->next = NULL;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_TIERED
+    area->slow = MP_PLAT_HEAP_IS_SLOW(start);
+    #endif
+
     DEBUG_printf("GC layout:\n");
     DEBUG_printf("  alloc table at %p, length " UINT_FMT " bytes, "
         UINT_FMT " blocks\n",
@@ -227,6 +473,28 @@ void gc_init(void *start, void *end) {
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_sweep_area) = NULL;
+    MP_STATE_MEM(gc_sweep_deferred) = 0;
+    MP_STATE_MEM(gc_step_mark_us) = 0;
+    MP_STATE_MEM(gc_step_last_us) = 0;
+    MP_STATE_MEM(gc_step_max_us) = 0;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_RESERVE
+    MP_STATE_MEM(gc_reserve_ptr) = NULL;
+    MP_STATE_MEM(gc_reserve_bytes) = 0;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    gc_free_lists_clear();
+    MP_STATE_MEM(gc_free_list_hits) = 0;
+    MP_STATE_MEM(gc_free_list_misses) = 0;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
@@ -271,6 +539,13 @@ static bool gc_try_add_heap(size_t failed_alloc) {
     // overhead converges to 3/128, but there's some fixed overhead and some
     // rounding up of partial block sizes).
     size_t needed = failed_alloc + MAX(2048, failed_alloc * 13 / 512);
+    // CIRCUITPY-CHANGE: the optional per-block tables add to the overhead
+    #if MICROPY_GC_NOSCAN
+    needed += failed_alloc / 128;
+    #endif
+    #if MICROPY_GC_MOVABLE
+    needed += failed_alloc / 64;
+    #endif
 
     size_t avail = gc_get_max_new_split();
 
@@ -320,6 +595,13 @@ static bool gc_try_add_heap(size_t failed_alloc) {
         #if MICROPY_ENABLE_FINALISER
         + total_blocks / BLOCKS_PER_FTB
         #endif
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_NOSCAN
+        + total_blocks / BLOCKS_PER_NTB
+        #endif
+        #if MICROPY_GC_MOVABLE
+        + total_blocks / BLOCKS_PER_MTB
+        #endif
         + total_blocks * BYTES_PER_BLOCK
         + ALLOC_TABLE_GAP_BYTE
         + sizeof(mp_state_mem_area_t);
@@ -331,7 +613,19 @@ static bool gc_try_add_heap(size_t failed_alloc) {
 
     size_t to_alloc = MIN(avail, MAX(total_heap, needed));
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_TIERED
+    // A small allocation wants the new area in fast RAM, if there's room.
+    mp_state_mem_area_t *new_heap = NULL;
+    if (failed_alloc < MICROPY_GC_SLOW_AREA_THRESHOLD) {
+        new_heap = MP_PLAT_ALLOC_HEAP_FAST(to_alloc);
+    }
+    if (new_heap == NULL) {
+        new_heap = MP_PLAT_ALLOC_HEAP(to_alloc);
+    }
+    #else
     mp_state_mem_area_t *new_heap = MP_PLAT_ALLOC_HEAP(to_alloc);
+    #endif
 
     DEBUG_printf("MP_PLAT_ALLOC_HEAP " UINT_FMT " = %p\n",
         to_alloc, new_heap);
@@ -358,6 +652,9 @@ void gc_deinit(void) {
     // any additional heap areas (but not the first.)
     gc_sweep_all();
     memset(&MP_STATE_MEM(area), 0, sizeof(MP_STATE_MEM(area)));
+    #if MICROPY_GC_FREE_LISTS
+    gc_free_lists_clear();
+    #endif
 }
 
 void gc_lock(void) {
@@ -420,6 +717,33 @@ static inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// Called for every word traced while gc_compact() is marking the heap.  A
+// movable block can later be moved only if its one and only reference is a
+// pointer to its head stored in another heap block, so pin it if it is
+// referenced from a root, more than once, or by a pointer into its interior.
+static void MP_NO_INSTRUMENT gc_compact_note_ref(void *ptr, bool from_heap) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        if ((byte *)ptr < area->gc_pool_start || (byte *)ptr >= area->gc_pool_end) {
+            continue;
+        }
+        size_t block = BLOCK_FROM_PTR(area, ptr);
+        bool interior = (void *)PTR_FROM_BLOCK(area, block) != ptr;
+        while (ATB_GET_KIND(area, block) == AT_TAIL) {
+            block--;
+            interior = true;
+        }
+        if (ATB_GET_KIND(area, block) != AT_FREE
+            && (MTB_GET(area, block) & MTB_MOVABLE)
+            && (!from_heap || interior || ATB_GET_KIND(area, block) == AT_MARK)) {
+            MTB_SET(area, block, MTB_PINNED);
+        }
+        return;
+    }
+}
+#endif
+
 // Take the given block as the topmost block on the stack. Check all it's
 // children: mark the unmarked child blocks and put those newly marked
 // blocks on the stack. When all children have been checked, pop off the
@@ -431,6 +755,10 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(mp_state_mem_area_t
 static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 #endif
 {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_MOVABLE
+    bool pinning = MP_STATE_MEM(gc_compact_pinning);
+    #endif
     // Start with the block passed in the argument.
     size_t sp = 0;
     for (;;) {
@@ -449,19 +777,37 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 
         // check this block's children
         void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
-        for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
+        size_t n_ptrs = n_blocks * BYTES_PER_BLOCK / sizeof(void *);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_NOSCAN
+        if (NTB_GET(area, block)) {
+            // This block holds no heap pointers, so there's nothing to trace.
+            n_ptrs = 0;
+        }
+        #endif
+        for (size_t i = n_ptrs; i > 0; i--, ptrs++) {
             MICROPY_GC_HOOK_LOOP(i);
             void *ptr = *ptrs;
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_MOVABLE
+            if (pinning) {
+                gc_compact_note_ref(ptr, true);
+            }
+            #endif
             // If this is a heap pointer that hasn't been marked, mark it and push
             // it's children to the stack.
             #if MICROPY_GC_SPLIT_HEAP
             mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
             if (!ptr_area) {
                 // Not a heap-allocated pointer (might even be random data).
+                // CIRCUITPY-CHANGE
+                MARK_NON_HEAP_PTR(ptr);
                 continue;
             }
             #else
             if (!VERIFY_PTR(ptr)) {
+                // CIRCUITPY-CHANGE
+                MARK_NON_HEAP_PTR(ptr);
                 continue;
             }
             mp_state_mem_area_t *ptr_area = area;
@@ -520,6 +866,62 @@ static void gc_deal_with_stack_overflow(void) {
     }
 }
 
+// CIRCUITPY-CHANGE: the per-block work of gc_sweep is split out so that it can
+// also be used by the incremental sweep below.
+// Sweep a single block.  free_tail carries state between consecutive blocks:
+// it is set while the tail of an unmarked head is being freed.  Returns true
+// if the block is still in use after the sweep.
+static inline bool gc_sweep_one_block(mp_state_mem_area_t *area, size_t block, int *free_tail) {
+    switch (ATB_GET_KIND(area, block)) {
+        case AT_HEAD:
+            #if MICROPY_ENABLE_FINALISER
+            if (FTB_GET(area, block)) {
+                mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+                if (obj->type != NULL) {
+                    // if the object has a type then see if it has a __del__ method
+                    mp_obj_t dest[2];
+                    mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
+                    if (dest[0] != MP_OBJ_NULL) {
+                        // load_method returned a method, execute it in a protected environment
+                        #if MICROPY_ENABLE_SCHEDULER
+                        mp_sched_lock();
+                        #endif
+                        mp_call_function_1_protected(dest[0], dest[1]);
+                        #if MICROPY_ENABLE_SCHEDULER
+                        mp_sched_unlock();
+                        #endif
+                    }
+                }
+                // clear finaliser flag
+                FTB_CLEAR(area, block);
+            }
+            #endif
+            *free_tail = 1;
+            DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
+            #if MICROPY_PY_GC_COLLECT_RETVAL
+            MP_STATE_MEM(gc_collected)++;
+            #endif
+            // fall through to free the head
+            MP_FALLTHROUGH
+
+        case AT_TAIL:
+            if (*free_tail) {
+                ATB_ANY_TO_FREE(area, block);
+                #if CLEAR_ON_SWEEP
+                memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
+                #endif
+                return false;
+            }
+            return true;
+
+        case AT_MARK:
+            ATB_MARK_TO_HEAD(area, block);
+            *free_tail = 0;
+            return true;
+    }
+    return false;
+}
+
 static void gc_sweep(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
@@ -539,54 +941,8 @@ static void gc_sweep(void) {
 
         for (size_t block = 0; block < end_block; block++) {
             MICROPY_GC_HOOK_LOOP(block);
-            switch (ATB_GET_KIND(area, block)) {
-                case AT_HEAD:
-                    #if MICROPY_ENABLE_FINALISER
-                    if (FTB_GET(area, block)) {
-                        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        if (obj->type != NULL) {
-                            // if the object has a type then see if it has a __del__ method
-                            mp_obj_t dest[2];
-                            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
-                            if (dest[0] != MP_OBJ_NULL) {
-                                // load_method returned a method, execute it in a protected environment
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_lock();
-                                #endif
-                                mp_call_function_1_protected(dest[0], dest[1]);
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_unlock();
-                                #endif
-                            }
-                        }
-                        // clear finaliser flag
-                        FTB_CLEAR(area, block);
-                    }
-                    #endif
-                    free_tail = 1;
-                    DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
-                    #if MICROPY_PY_GC_COLLECT_RETVAL
-                    MP_STATE_MEM(gc_collected)++;
-                    #endif
-                    // fall through to free the head
-                    MP_FALLTHROUGH
-
-                case AT_TAIL:
-                    if (free_tail) {
-                        ATB_ANY_TO_FREE(area, block);
-                        #if CLEAR_ON_SWEEP
-                        memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
-                        #endif
-                    } else {
-                        last_used_block = block;
-                    }
-                    break;
-
-                case AT_MARK:
-                    ATB_MARK_TO_HEAD(area, block);
-                    free_tail = 0;
-                    last_used_block = block;
-                    break;
+            if (gc_sweep_one_block(area, block, &free_tail)) {
+                last_used_block = block;
             }
         }
 
@@ -603,16 +959,194 @@ static void gc_sweep(void) {
         prev_area = area;
         #endif
     }
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    gc_free_lists_rebuild();
+    #endif
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+// An incremental collection marks the whole heap in one go (the roots include
+// the C stack and registers, so marking can't be interleaved with the mutator
+// without a write barrier) and then leaves the sweep pending.  The sweep is
+// done in slices by gc_sweep_step.  While it is pending, blocks that the sweep
+// has not reached yet are still coloured: live heads are AT_MARK and garbage
+// heads are AT_HEAD.  New allocations in that part of the heap are therefore
+// created marked, and the sweep position is only ever left on a block that
+// isn't a tail, so that no object is split across two slices.
+
+bool gc_sweep_pending(void) {
+    return MP_STATE_MEM(gc_sweep_area) != NULL;
 }
 
+// Returns true if the given block hasn't been reached by the pending sweep.
+static bool gc_sweep_is_ahead(mp_state_mem_area_t *area, size_t block) {
+    mp_state_mem_area_t *sweep_area = MP_STATE_MEM(gc_sweep_area);
+    if (sweep_area == NULL) {
+        return false;
+    }
+    if (area == sweep_area) {
+        return block >= MP_STATE_MEM(gc_sweep_block);
+    }
+    for (mp_state_mem_area_t *a = NEXT_AREA(sweep_area); a != NULL; a = NEXT_AREA(a)) {
+        if (a == area) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Record that blocks up to end_block are in use, so that a pending sweep of
+// this area doesn't underestimate its last used block.
+static void gc_sweep_note_used(mp_state_mem_area_t *area, size_t end_block) {
+    if (area == MP_STATE_MEM(gc_sweep_area)) {
+        MP_STATE_MEM(gc_sweep_last_used_block) = MAX(MP_STATE_MEM(gc_sweep_last_used_block), end_block);
+    }
+}
+
+void gc_collect_incremental_start(void) {
+    MP_STATE_MEM(gc_sweep_deferred) = 1;
+    gc_collect();
+}
+
+bool gc_sweep_step(size_t n_blocks) {
+    GC_ENTER();
+    MP_STATE_THREAD(gc_lock_depth)++;
+
+    mp_state_mem_area_t *area = MP_STATE_MEM(gc_sweep_area);
+    while (area != NULL) {
+        size_t block = MP_STATE_MEM(gc_sweep_block);
+        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        if (area->gc_last_used_block < end_block) {
+            end_block = area->gc_last_used_block + 1;
+        }
+        size_t last_used_block = MP_STATE_MEM(gc_sweep_last_used_block);
+
+        // A slice never stops inside an object, so any tail found at the
+        // start of a slice belongs to a head that has already been swept and
+        // survived (or was allocated since).
+        int free_tail = 0;
+
+        // Blocks freed by this slice are before the next free-block search.
+        if (block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+            area->gc_last_free_atb_index = block / BLOCKS_PER_ATB;
+        }
+        #if MICROPY_GC_SPLIT_HEAP
+        if (MP_STATE_MEM(gc_last_free_area) != area) {
+            // See comment in gc_free.
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        }
+        #endif
+
+        for (; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (n_blocks == 0) {
+                if (ATB_GET_KIND(area, block) != AT_TAIL) {
+                    break;
+                }
+            } else {
+                n_blocks--;
+            }
+            if (gc_sweep_one_block(area, block, &free_tail)) {
+                last_used_block = block;
+            }
+        }
+
+        MP_STATE_MEM(gc_sweep_block) = block;
+        MP_STATE_MEM(gc_sweep_last_used_block) = last_used_block;
+        if (block < end_block) {
+            // Out of budget for this slice.
+            break;
+        }
+
+        // This area is done; move on to the next one.
+        area->gc_last_used_block = last_used_block;
+        mp_state_mem_area_t *next_area = NEXT_AREA(area);
+
+        #if MICROPY_GC_SPLIT_HEAP_AUTO
+        // Free any empty area, aside from the first one
+        if (last_used_block == 0 && area != &MP_STATE_MEM(area)) {
+            mp_state_mem_area_t *prev_area = &MP_STATE_MEM(area);
+            while (NEXT_AREA(prev_area) != area) {
+                prev_area = NEXT_AREA(prev_area);
+            }
+            DEBUG_printf("gc_sweep free empty area %p\n", area);
+            NEXT_AREA(prev_area) = next_area;
+            MP_PLAT_FREE_HEAP(area);
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+            #if MICROPY_GC_FREE_LISTS
+            // Don't leave entries pointing into the freed area.
+            gc_free_lists_clear();
+            #endif
+        }
+        #endif
+
+        area = next_area;
+        MP_STATE_MEM(gc_sweep_area) = area;
+        MP_STATE_MEM(gc_sweep_block) = 0;
+        MP_STATE_MEM(gc_sweep_last_used_block) = 0;
+    }
+
+    if (area == NULL) {
+        // The sweep is complete; the next search for free blocks starts from
+        // the beginning of the heap, as after a full collection.
+        #if MICROPY_GC_SPLIT_HEAP
+        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        #endif
+        for (mp_state_mem_area_t *a = &MP_STATE_MEM(area); a != NULL; a = NEXT_AREA(a)) {
+            a->gc_last_free_atb_index = 0;
+        }
+        #if MICROPY_GC_FREE_LISTS
+        gc_free_lists_rebuild();
+        #endif
+    }
+
+    MP_STATE_THREAD(gc_lock_depth)--;
+    GC_EXIT();
+    return area == NULL;
+}
+#endif
+
 void gc_collect_start(void) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    // Any pending sweep must be finished before the heap is marked again.
+    gc_sweep_step((size_t)-1);
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_allocs) = 0;
+    MP_STATE_MEM(gc_stats_collections)++;
+    MP_STATE_MEM(gc_stats_collect_start_us) = MICROPY_GC_INCREMENTAL_TICKS_US();
+    #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    // Pooled generator frames are unreachable, so this collection frees them.
+    memset(MP_STATE_VM(gen_frame_pool_len), 0, sizeof(MP_STATE_VM(gen_frame_pool_len)));
+    memset(MP_STATE_VM(gen_frame_pool), 0, sizeof(MP_STATE_VM(gen_frame_pool)));
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_MOVABLE
+    if (MP_STATE_MEM(gc_compact_pinning)) {
+        // Pins are recomputed by each compacting collection.
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            for (size_t i = 0; i < area->gc_alloc_table_byte_len; i++) {
+                area->gc_movable_table_start[i] &= ~MTB_PINNED_MASK;
+            }
+        }
+    }
+    #endif
+
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
     // dict_globals, then the root pointer section of mp_state_vm.
@@ -621,6 +1155,11 @@ void gc_collect_start(void) {
     size_t root_end = offsetof(mp_state_ctx_t, vm.qstr_last_chunk);
     gc_collect_root(ptrs + root_start / sizeof(void *), (root_end - root_start) / sizeof(void *));
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_RESERVE
+    gc_collect_root(&MP_STATE_MEM(gc_reserve_ptr), 1);
+    #endif
+
     #if MICROPY_ENABLE_PYSTACK
     // Trace root pointers from the Python stack.
     ptrs = (void **)(void *)MP_STATE_THREAD(pystack_start);
@@ -657,13 +1196,23 @@ void gc_collect_root(void **ptrs, size_t len) {
     for (size_t i = 0; i < len; i++) {
         MICROPY_GC_HOOK_LOOP(i);
         void *ptr = gc_get_ptr(ptrs, i);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_MOVABLE
+        if (MP_STATE_MEM(gc_compact_pinning)) {
+            gc_compact_note_ref(ptr, false);
+        }
+        #endif
         #if MICROPY_GC_SPLIT_HEAP
         mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
         if (!area) {
+            // CIRCUITPY-CHANGE
+            MARK_NON_HEAP_PTR(ptr);
             continue;
         }
         #else
         if (!VERIFY_PTR(ptr)) {
+            // CIRCUITPY-CHANGE
+            MARK_NON_HEAP_PTR(ptr);
             continue;
         }
         #endif
@@ -680,8 +1229,43 @@ void gc_collect_root(void **ptrs, size_t len) {
     }
 }
 
+// CIRCUITPY-CHANGE
+static inline void gc_stats_collect_done(void) {
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_collect_us) += (uint32_t)MICROPY_GC_INCREMENTAL_TICKS_US() - MP_STATE_MEM(gc_stats_collect_start_us);
+    #endif
+}
+
 void gc_collect_end(void) {
     gc_deal_with_stack_overflow();
+    // CIRCUITPY-CHANGE
+    #if CIRCUITPY_OBJECT_POOL
+    // Pooled objects are traced once everything else is marked, because
+    // tracing can't nest inside gc_mark_subtree. Marking is complete after
+    // this, so the pools can be swept straight away, even when the heap's
+    // sweep is deferred.
+    while (object_pool_trace()) {
+        gc_deal_with_stack_overflow();
+    }
+    object_pool_sweep();
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_sweep_deferred)) {
+        // Leave the sweep to gc_sweep_step.
+        MP_STATE_MEM(gc_sweep_deferred) = 0;
+        #if MICROPY_PY_GC_COLLECT_RETVAL
+        MP_STATE_MEM(gc_collected) = 0;
+        #endif
+        MP_STATE_MEM(gc_sweep_area) = &MP_STATE_MEM(area);
+        MP_STATE_MEM(gc_sweep_block) = 0;
+        MP_STATE_MEM(gc_sweep_last_used_block) = 0;
+        gc_stats_collect_done();
+        MP_STATE_THREAD(gc_lock_depth)--;
+        GC_EXIT();
+        return;
+    }
+    #endif
     gc_sweep();
     #if MICROPY_GC_SPLIT_HEAP
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
@@ -689,11 +1273,18 @@ void gc_collect_end(void) {
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         area->gc_last_free_atb_index = 0;
     }
+    gc_stats_collect_done();
     MP_STATE_THREAD(gc_lock_depth)--;
     GC_EXIT();
 }
 
 void gc_sweep_all(void) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    // Finish a pending sweep first so that no marked blocks survive.
+    gc_sweep_step((size_t)-1);
+    MP_STATE_MEM(gc_sweep_deferred) = 0;
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     MP_STATE_MEM(gc_stack_overflow) = 0;
@@ -715,6 +1306,13 @@ void gc_info(gc_info_t *info) {
         for (size_t block = 0, len = 0, len_free = 0; !finish;) {
             MICROPY_GC_HOOK_LOOP(block);
             size_t kind = ATB_GET_KIND(area, block);
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_INCREMENTAL
+            // Live heads stay marked until a pending sweep reaches them.
+            if (kind == AT_MARK) {
+                kind = AT_HEAD;
+            }
+            #endif
             switch (kind) {
                 case AT_FREE:
                     info->free += 1;
@@ -742,6 +1340,12 @@ void gc_info(gc_info_t *info) {
             // Get next block type if possible
             if (!finish) {
                 kind = ATB_GET_KIND(area, block);
+                // CIRCUITPY-CHANGE
+                #if MICROPY_GC_INCREMENTAL
+                if (kind == AT_MARK) {
+                    kind = AT_HEAD;
+                }
+                #endif
             }
 
             if (finish || kind == AT_FREE || kind == AT_HEAD) {
@@ -770,9 +1374,90 @@ void gc_info(gc_info_t *info) {
     info->max_new_split = gc_get_max_new_split();
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    info->free_list_hits = MP_STATE_MEM(gc_free_list_hits);
+    info->free_list_misses = MP_STATE_MEM(gc_free_list_misses);
+    #endif
+
+    GC_EXIT();
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+bool gc_area_stats(size_t index, gc_area_stats_t *stats) {
+    GC_ENTER();
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    for (size_t i = 0; i < index && area != NULL; i++) {
+        area = NEXT_AREA(area);
+    }
+    if (area == NULL) {
+        GC_EXIT();
+        return false;
+    }
+    memset(stats, 0, sizeof(*stats));
+    stats->total = area->gc_pool_end - area->gc_pool_start;
+    size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    size_t len_free = 0;
+    for (size_t block = 0; block <= end_block; block++) {
+        MICROPY_GC_HOOK_LOOP(block);
+        if (block < end_block && ATB_GET_KIND(area, block) == AT_FREE) {
+            len_free++;
+            continue;
+        }
+        if (len_free == 0) {
+            continue;
+        }
+        stats->free += len_free;
+        stats->max_free = MAX(stats->max_free, len_free);
+        size_t bucket = (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(len_free);
+        stats->free_runs[MIN(bucket, MICROPY_GC_STATS_FREE_RUN_BUCKETS - 1)]++;
+        len_free = 0;
+    }
     GC_EXIT();
+    stats->free *= BYTES_PER_BLOCK;
+    stats->max_free *= BYTES_PER_BLOCK;
+    return true;
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_RESERVE
+static bool gc_reserve_take(void) {
+    if (MP_STATE_MEM(gc_reserve_bytes) == 0 || MP_STATE_MEM(gc_reserve_ptr) != NULL) {
+        return true;
+    }
+    MP_STATE_MEM(gc_reserve_ptr) = gc_alloc(MP_STATE_MEM(gc_reserve_bytes), GC_ALLOC_FLAG_NO_SCAN);
+    return MP_STATE_MEM(gc_reserve_ptr) != NULL;
+}
+
+bool gc_reserve(size_t n_bytes) {
+    if (MP_STATE_MEM(gc_reserve_ptr) != NULL) {
+        gc_free(MP_STATE_MEM(gc_reserve_ptr));
+        MP_STATE_MEM(gc_reserve_ptr) = NULL;
+    }
+    MP_STATE_MEM(gc_reserve_bytes) = n_bytes;
+    if (!gc_reserve_take()) {
+        MP_STATE_MEM(gc_reserve_bytes) = 0;
+        return false;
+    }
+    return true;
+}
+
+size_t gc_reserve_available(void) {
+    return MP_STATE_MEM(gc_reserve_ptr) != NULL ? MP_STATE_MEM(gc_reserve_bytes) : 0;
 }
 
+void gc_reserve_restore(void) {
+    if (MP_STATE_MEM(gc_reserve_bytes) != 0 && MP_STATE_MEM(gc_reserve_ptr) == NULL) {
+        // Whatever used the reserve may now be garbage.
+        gc_collect();
+        // If there still isn't room, try again next time.
+        gc_reserve_take();
+    }
+}
+#endif
+
 // CIRCUITPY-CHANGE: C code may be used when the VM heap isn't active. This
 // allows that code to test if it is. It can use the outer pool if needed.
 bool gc_alloc_possible(void) {
@@ -805,6 +1490,16 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    bool from_free_list = false;
+    #endif
+    #if MICROPY_GC_TIERED
+    // Small objects are likely to be used often, so they look in fast areas
+    // first. Large buffers look in slow areas first, leaving fast RAM free.
+    bool want_slow = n_bytes >= MICROPY_GC_SLOW_AREA_THRESHOLD;
+    bool other_tier = false;
+    #endif
 
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
@@ -815,6 +1510,25 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     }
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    if (n_blocks <= FREE_LIST_MAX_ALLOC) {
+        #if MICROPY_GC_TIERED
+        bool free_list_slow = want_slow;
+        #else
+        bool free_list_slow = false;
+        #endif
+        if (gc_free_lists_take(n_blocks, free_list_slow, &area, &start_block)) {
+            MP_STATE_MEM(gc_free_list_hits)++;
+            from_free_list = true;
+            i = start_block + n_blocks - 1;
+            n_free = n_blocks;
+            goto found;
+        }
+        MP_STATE_MEM(gc_free_list_misses)++;
+    }
+    #endif
+
     for (;;) {
 
         #if MICROPY_GC_SPLIT_HEAP
@@ -830,6 +1544,12 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_TIERED
+            if (area->slow != (want_slow != other_tier)) {
+                continue;
+            }
+            #endif
             n_free = 0;
             for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
@@ -852,9 +1572,40 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             #endif
         }
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_TIERED
+        if (!other_tier) {
+            // Nothing in the preferred kind of area, so try the other kind
+            // before collecting.
+            other_tier = true;
+            continue;
+        }
+        other_tier = false;
+        #endif
+
         GC_EXIT();
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_INCREMENTAL
+        if (gc_sweep_pending()) {
+            // Finishing the pending sweep may free enough memory without
+            // needing another collection.
+            gc_sweep_step((size_t)-1);
+            GC_ENTER();
+            continue;
+        }
+        #endif
         // nothing found!
         if (collected) {
+            // CIRCUITPY-CHANGE: use the reserve before growing the heap, so
+            // that code running with collection disabled has a known budget.
+            #if MICROPY_GC_RESERVE
+            if (!MP_STATE_MEM(gc_auto_collect_enabled) && MP_STATE_MEM(gc_reserve_ptr) != NULL) {
+                gc_free(MP_STATE_MEM(gc_reserve_ptr));
+                MP_STATE_MEM(gc_reserve_ptr) = NULL;
+                GC_ENTER();
+                continue;
+            }
+            #endif
             #if MICROPY_GC_SPLIT_HEAP_AUTO
             if (!added && gc_try_add_heap(n_bytes)) {
                 added = true;
@@ -885,7 +1636,12 @@ found:
     // for a single free block, which guarantees that there are no free blocks
     // before this one.  Also, whenever we free or shink a block we must check
     // if this index needs adjusting (see gc_realloc and gc_free).
+    // CIRCUITPY-CHANGE: a block from the free lists gives no such guarantee.
+    #if MICROPY_GC_FREE_LISTS
+    if (n_free == 1 && !from_free_list) {
+    #else
     if (n_free == 1) {
+    #endif
         #if MICROPY_GC_SPLIT_HEAP
         MP_STATE_MEM(gc_last_free_area) = area;
         #endif
@@ -902,6 +1658,16 @@ found:
     // mark first block as used head
     ATB_FREE_TO_HEAD(area, start_block);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    if (gc_sweep_is_ahead(area, start_block)) {
+        // The pending sweep hasn't got here yet, so create the block marked.
+        ATB_HEAD_TO_MARK(area, start_block);
+    } else {
+        gc_sweep_note_used(area, end_block);
+    }
+    #endif
+
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
     for (size_t bl = start_block + 1; bl <= end_block; bl++) {
@@ -917,6 +1683,11 @@ found:
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_allocs)++;
+    #endif
+
     GC_EXIT();
 
     #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -944,6 +1715,26 @@ found:
     (void)has_finaliser;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NOSCAN
+    // The bit isn't cleared when blocks are freed, so always set it here.
+    GC_ENTER();
+    if (alloc_flags & GC_ALLOC_FLAG_NO_SCAN) {
+        NTB_SET(area, start_block);
+    } else {
+        NTB_CLEAR(area, start_block);
+    }
+    GC_EXIT();
+    #endif
+    #if MICROPY_GC_MOVABLE
+    GC_ENTER();
+    MTB_CLEAR(area, start_block);
+    if (alloc_flags & GC_ALLOC_FLAG_MOVABLE) {
+        MTB_SET(area, start_block, MTB_MOVABLE);
+    }
+    GC_EXIT();
+    #endif
+
     #if EXTENSIVE_HEAP_PROFILING
     gc_dump_alloc_table(&mp_plat_print);
     #endif
@@ -953,6 +1744,10 @@ found:
     memorymonitor_track_allocation(end_block - start_block + 1);
     #endif
 
+    #if CIRCUITPY_UHEAP
+    uheap_track_allocation(n_bytes);
+    #endif
+
     return ret_ptr;
 }
 
@@ -1002,7 +1797,8 @@ void gc_free(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    // CIRCUITPY-CHANGE
+    assert(ATB_IS_HEAD(area, block));
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1033,12 +1829,22 @@ void gc_free(void *ptr) {
     gc_log_change(start_block, 0);
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    size_t head_block = block;
+    #endif
+
     // free head and all of its tail blocks
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    gc_free_lists_push(area, head_block, block - head_block);
+    #endif
+
     GC_EXIT();
 
     #if EXTENSIVE_HEAP_PROFILING
@@ -1062,7 +1868,8 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        // CIRCUITPY-CHANGE
+        if (ATB_IS_HEAD(area, block)) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1137,7 +1944,8 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    // CIRCUITPY-CHANGE
+    assert(ATB_IS_HEAD(area, block));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1221,6 +2029,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         }
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_INCREMENTAL
+        gc_sweep_note_used(area, end_block);
+        #endif
 
         GC_EXIT();
 
@@ -1248,10 +2060,22 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         return ptr_in;
     }
 
+    // CIRCUITPY-CHANGE: keep the allocation flags when moving
+    unsigned int alloc_flags = 0;
     #if MICROPY_ENABLE_FINALISER
-    bool ftb_state = FTB_GET(area, block);
-    #else
-    bool ftb_state = false;
+    if (FTB_GET(area, block)) {
+        alloc_flags |= GC_ALLOC_FLAG_HAS_FINALISER;
+    }
+    #endif
+    #if MICROPY_GC_NOSCAN
+    if (NTB_GET(area, block)) {
+        alloc_flags |= GC_ALLOC_FLAG_NO_SCAN;
+    }
+    #endif
+    #if MICROPY_GC_MOVABLE
+    if (MTB_GET(area, block) & MTB_MOVABLE) {
+        alloc_flags |= GC_ALLOC_FLAG_MOVABLE;
+    }
     #endif
 
     GC_EXIT();
@@ -1262,7 +2086,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     }
 
     // can't resize inplace; try to find a new contiguous chain
-    void *ptr_out = gc_alloc(n_bytes, ftb_state);
+    void *ptr_out = gc_alloc(n_bytes, alloc_flags);
 
     // check that the alloc succeeded
     if (ptr_out == NULL) {
@@ -1276,6 +2100,129 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
 }
 #endif // Alternative gc_realloc impl
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// Move the given movable block into the first free run of its area that lies
+// entirely below it.  Returns the new address, or NULL if there is no room.
+static void *gc_compact_move(mp_state_mem_area_t *area, size_t block) {
+    size_t n_blocks = 1;
+    while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL) {
+        n_blocks += 1;
+    }
+
+    size_t n_free = 0;
+    size_t dest;
+    for (dest = area->gc_last_free_atb_index * BLOCKS_PER_ATB; dest < block; dest++) {
+        if (ATB_GET_KIND(area, dest) != AT_FREE) {
+            n_free = 0;
+        } else if (++n_free == n_blocks) {
+            break;
+        }
+    }
+    if (dest >= block) {
+        return NULL;
+    }
+    dest -= n_blocks - 1;
+
+    void *src_ptr = (void *)PTR_FROM_BLOCK(area, block);
+    void *dest_ptr = (void *)PTR_FROM_BLOCK(area, dest);
+    ATB_FREE_TO_HEAD(area, dest);
+    for (size_t i = 1; i < n_blocks; i++) {
+        ATB_FREE_TO_TAIL(area, dest + i);
+    }
+    memcpy(dest_ptr, src_ptr, n_blocks * BYTES_PER_BLOCK);
+    #if MICROPY_GC_NOSCAN
+    if (NTB_GET(area, block)) {
+        NTB_SET(area, dest);
+    } else {
+        NTB_CLEAR(area, dest);
+    }
+    #endif
+    MTB_CLEAR(area, dest);
+    MTB_SET(area, dest, MTB_MOVABLE);
+    for (size_t i = 0; i < n_blocks; i++) {
+        ATB_ANY_TO_FREE(area, block + i);
+    }
+    return dest_ptr;
+}
+
+size_t gc_compact(void) {
+    if (MP_STATE_THREAD(gc_lock_depth) != 0) {
+        return 0;
+    }
+
+    // A full collection frees the garbage and pins the movable blocks whose
+    // references can't all be updated.
+    MP_STATE_MEM(gc_compact_pinning) = 1;
+    gc_collect();
+    MP_STATE_MEM(gc_compact_pinning) = 0;
+
+    #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+    // Without a GIL, other threads may be using the storage right now.
+    return 0;
+    #endif
+
+    GC_ENTER();
+    size_t n_moved = 0;
+    // Every unpinned movable block has exactly one reference, held by a live
+    // heap block.  Find those references in address order, and slide each
+    // block they refer to down into the lowest hole that fits it.
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        for (size_t block = 0; block < max_block; block++) {
+            if (ATB_GET_KIND(area, block) != AT_HEAD) {
+                continue;
+            }
+            #if MICROPY_GC_NOSCAN
+            if (NTB_GET(area, block)) {
+                continue;
+            }
+            #endif
+            size_t n_blocks = 1;
+            while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL) {
+                n_blocks += 1;
+            }
+            void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
+            for (size_t i = 0; i < n_blocks * BYTES_PER_BLOCK / sizeof(void *); i++) {
+                void *ptr = ptrs[i];
+                #if MICROPY_GC_SPLIT_HEAP
+                mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
+                if (!ptr_area) {
+                    continue;
+                }
+                #else
+                if (!VERIFY_PTR(ptr)) {
+                    continue;
+                }
+                mp_state_mem_area_t *ptr_area = area;
+                #endif
+                size_t ptr_block = BLOCK_FROM_PTR(ptr_area, ptr);
+                if (ATB_GET_KIND(ptr_area, ptr_block) != AT_HEAD
+                    || MTB_GET(ptr_area, ptr_block) != MTB_MOVABLE) {
+                    continue;
+                }
+                // Only update a word known to be a real pointer, never data
+                // that happens to look like one.
+                if (!mp_obj_array_is_items_slot(ptrs, &ptrs[i])) {
+                    continue;
+                }
+                void *new_ptr = gc_compact_move(ptr_area, ptr_block);
+                if (new_ptr != NULL) {
+                    ptrs[i] = new_ptr;
+                    n_moved += 1;
+                }
+            }
+            block += n_blocks - 1;
+        }
+    }
+    #if MICROPY_GC_FREE_LISTS
+    gc_free_lists_rebuild();
+    #endif
+    GC_EXIT();
+    return n_moved;
+}
+#endif
+
 void gc_dump_info(const mp_print_t *print) {
     gc_info_t info;
     gc_info(&info);
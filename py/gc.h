@@ -64,6 +64,24 @@ void gc_collect_ptr(void *ptr);
 void gc_collect_root(void **ptrs, size_t len);
 void gc_collect_end(void);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+// Mark the heap like gc_collect, but leave the sweep pending so it can be done
+// in bounded slices with gc_sweep_step.
+void gc_collect_incremental_start(void);
+// Sweep about n_blocks blocks of a pending sweep. Returns true once the sweep
+// is complete (or if none was pending).
+bool gc_sweep_step(size_t n_blocks);
+bool gc_sweep_pending(void);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// Collect, then move movable blocks down the heap to merge free space.
+// Returns the number of blocks moved.
+size_t gc_compact(void);
+#endif
+
 // CIRCUITPY-CHANGE
 // Is the gc heap available?
 bool gc_alloc_possible(void);
@@ -73,6 +91,14 @@ void gc_sweep_all(void);
 
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
+    // CIRCUITPY-CHANGE
+    // The memory will never hold pointers to the heap, so the GC doesn't need
+    // to scan it. Ignored unless MICROPY_GC_NOSCAN is enabled.
+    GC_ALLOC_FLAG_NO_SCAN = 2,
+    // The only reference to the memory is the items pointer of a bytearray or
+    // array, so gc_compact() may move it.  Ignored unless MICROPY_GC_MOVABLE
+    // is enabled.
+    GC_ALLOC_FLAG_MOVABLE = 4,
 };
 
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags);
@@ -96,9 +122,41 @@ typedef struct _gc_info_t {
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     size_t max_new_split;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    // Allocations of up to 8 blocks served by, or missing, the free lists.
+    size_t free_list_hits;
+    size_t free_list_misses;
+    #endif
 } gc_info_t;
 
 void gc_info(gc_info_t *info);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+typedef struct _gc_area_stats_t {
+    size_t total;
+    size_t free;
+    size_t max_free;
+    // Number of free runs of 1, 2-3, 4-7 ... blocks.
+    size_t free_runs[MICROPY_GC_STATS_FREE_RUN_BUCKETS];
+} gc_area_stats_t;
+
+// Fills in stats for the index'th heap area. Returns false if there isn't one.
+bool gc_area_stats(size_t index, gc_area_stats_t *stats);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_RESERVE
+// Set aside n_bytes of the heap for allocations that would otherwise fail
+// while automatic collection is disabled. Replaces any previous reserve, and
+// 0 releases it. Returns false if there isn't room.
+bool gc_reserve(size_t n_bytes);
+// The number of bytes set aside, or 0 once the reserve has been used.
+size_t gc_reserve_available(void);
+// If the reserve has been used, collect and set it aside again.
+void gc_reserve_restore(void);
+#endif
 void gc_dump_info(const mp_print_t *print);
 void gc_dump_alloc_table(const mp_print_t *print);
 
@@ -12,6 +12,13 @@ py/objmodule.c that contains entries to be included in the definition of
 Extensible modules are modules that can be overridden from the filesystem, see
 py/builtinimnport.c:process_import_at_level. Regular modules will always use
 the built-in version.
+
+CIRCUITPY-CHANGE: If the generated qstr header is also given, the entries of
+each table are put in the order of a minimal perfect hash of the qstr numbers
+of the module names, and the per-bucket displacements of that hash are emitted
+alongside, so py/objmodule.c can find a built-in module in one probe. If no such
+hash is found for either table, both are left sorted and no displacements are
+emitted, so py/objmodule.c searches them instead.
 """
 
 from __future__ import print_function
@@ -27,6 +34,11 @@ register_pattern = re.compile(
     flags=re.DOTALL,
 )
 
+qdef_pattern = re.compile(r"^QDEF([01])\((\w+),")
+
+# CIRCUITPY-CHANGE: must match MP_MODULE_PHASH_SLOT in py/objmodule.c.
+PHASH_MULTIPLIER = 0x9E3779B1
+
 delegation_pattern = re.compile(
     r"\s*(?:MP_REGISTER_MODULE_DELEGATION)\((.*?),\s*(.*?)\);",
     flags=re.DOTALL,
@@ -46,22 +58,102 @@ def find_module_registrations(filename):
         return set(re.findall(register_pattern, c)), set(re.findall(delegation_pattern, c))
 
 
-def generate_module_table_header(modules):
+# CIRCUITPY-CHANGE
+def read_qstr_numbers(filename):
+    """Work out the enum value of each static qstr, the same way py/qstr.h does.
+
+    :param str filename: path to qstrdefs.generated.h
+    :return: Dict[str, int] mapping MP_QSTR_xxx to its value
+    """
+    pools = ([], [])
+    with io.open(filename, encoding="utf-8") as f:
+        for line in f:
+            match = qdef_pattern.match(line)
+            if match:
+                pools[int(match.group(1))].append(match.group(2))
+    return {qstr_id: n for n, qstr_id in enumerate(pools[0] + pools[1])}
+
+
+def phash_slot(qnum, disp, size):
+    h = qnum ^ ((disp * PHASH_MULTIPLIER) & 0xFFFFFFFF)
+    return (((h * PHASH_MULTIPLIER) & 0xFFFFFFFF) >> 16) % size
+
+
+def make_phash(qnums):
+    """Find a minimal perfect hash over the given distinct qstr numbers.
+
+    Keys are split into buckets by qnum % num_buckets, and then, largest bucket
+    first, each bucket gets the first displacement that puts all its keys in
+    free slots.
+
+    :return: (List[int] displacements, List[int] qnum in each slot), or None if
+        no displacement works for some bucket
+    """
+    size = len(qnums)
+    num_buckets = max(1, (size + 1) // 2)
+    buckets = [[] for _ in range(num_buckets)]
+    for qnum in qnums:
+        buckets[qnum % num_buckets].append(qnum)
+    disps = [0] * num_buckets
+    slots = [None] * size
+    for b in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            break
+        for disp in range(0x10000):
+            pos = [phash_slot(qnum, disp, size) for qnum in buckets[b]]
+            if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+                break
+        else:
+            return None
+        disps[b] = disp
+        for qnum, p in zip(buckets[b], pos):
+            slots[p] = qnum
+    return disps, slots
+
+
+def order_mod_defs(mod_defs, qstr_numbers):
+    """Order a table's entries by perfect hash slot.
+
+    :param Dict[str, str] mod_defs: MODULE_DEF_xxx to module name
+    :return: (List[int] displacements, List[str] MODULE_DEF_xxx in table order),
+        or None if there is no perfect hash for the table
+    """
+    by_qnum = {qstr_numbers["MP_QSTR_" + name]: mod_def for mod_def, name in mod_defs.items()}
+    phash = make_phash(sorted(by_qnum))
+    if phash is None:
+        return None
+    disps, slots = phash
+    return disps, [by_qnum[qnum] for qnum in slots]
+
+
+def generate_module_table_header(modules, qstr_numbers=None):
     """Generate header with module table entries for builtin modules.
 
     :param List[(module_name, obj_module)] modules: module defs
+    :param Dict[str, int] qstr_numbers: static qstr values, to order the tables by perfect hash
     :return: None
     """
 
     # Print header file for all external modules.
-    mod_defs = set()
-    extensible_mod_defs = set()
+    mod_defs = {}
+    extensible_mod_defs = {}
+    # CIRCUITPY-CHANGE: a second registration would silently replace the first.
+    registered = {}
     for macro_name, module_name, obj_module in modules:
+        if module_name in registered:
+            print(
+                "ERROR: module {} is registered as both {} and {}\n".format(
+                    module_name, registered[module_name], obj_module
+                ),
+                file=sys.stderr,
+            )
+            sys.exit(1)
+        registered[module_name] = obj_module
         mod_def = "MODULE_DEF_{}".format(module_name.upper())
         if macro_name == "MP_REGISTER_MODULE":
-            mod_defs.add(mod_def)
+            mod_defs[mod_def] = module_name
         elif macro_name == "MP_REGISTER_EXTENSIBLE_MODULE":
-            extensible_mod_defs.add(mod_def)
+            extensible_mod_defs[mod_def] = module_name
         if "," in obj_module:
             print(
                 "ERROR: Call to {}({}, {}) should be {}({}, {})\n".format(
@@ -87,16 +179,39 @@ def generate_module_table_header(modules):
             )
         )
 
-    print("\n#define MICROPY_REGISTERED_MODULES \\")
+    # CIRCUITPY-CHANGE
+    ordered = sorted(mod_defs)
+    extensible_ordered = sorted(extensible_mod_defs)
+    if qstr_numbers is not None:
+        phash = order_mod_defs(mod_defs, qstr_numbers)
+        extensible_phash = order_mod_defs(extensible_mod_defs, qstr_numbers)
+        if phash is not None and extensible_phash is not None:
+            print()
+            for macro_name, (disps, _) in (
+                ("MICROPY_REGISTERED_MODULES", phash),
+                ("MICROPY_REGISTERED_EXTENSIBLE_MODULES", extensible_phash),
+            ):
+                print("#define {}_PHASH_BUCKETS ({})".format(macro_name, len(disps)))
+                print(
+                    "#define {}_PHASH {{ {} }}".format(
+                        macro_name, ", ".join(str(d) for d in disps)
+                    )
+                )
+            ordered = phash[1]
+            extensible_ordered = extensible_phash[1]
 
-    for mod_def in sorted(mod_defs):
+    print()
+    print("#define MICROPY_REGISTERED_MODULES \\")
+
+    for mod_def in ordered:
         print("    {mod_def} \\".format(mod_def=mod_def))
 
     print("// MICROPY_REGISTERED_MODULES")
 
-    print("\n#define MICROPY_REGISTERED_EXTENSIBLE_MODULES \\")
+    print()
+    print("#define MICROPY_REGISTERED_EXTENSIBLE_MODULES \\")
 
-    for mod_def in sorted(extensible_mod_defs):
+    for mod_def in extensible_ordered:
         print("    {mod_def} \\".format(mod_def=mod_def))
 
     print("// MICROPY_REGISTERED_EXTENSIBLE_MODULES")
@@ -122,12 +237,17 @@ def generate_module_delegations(delegations):
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument("file", nargs=1, help="file with MP_REGISTER_MODULE definitions")
+    # CIRCUITPY-CHANGE
+    parser.add_argument(
+        "--qstrdefs", help="generated qstr header, to order the module tables by perfect hash"
+    )
     args = parser.parse_args()
 
     print("// Automatically generated by makemoduledefs.py.\n")
 
     modules, delegations = find_module_registrations(args.file[0])
-    generate_module_table_header(sorted(modules))
+    qstr_numbers = read_qstr_numbers(args.qstrdefs) if args.qstrdefs else None
+    generate_module_table_header(sorted(modules), qstr_numbers)
     generate_module_delegations(sorted(delegations))
 
 
@@ -316,6 +316,35 @@ def compute_hash(qstr, bytes_hash):
     return (hash & ((1 << (8 * (bytes_hash or 2))) - 1)) or 1
 
 
+# CIRCUITPY-CHANGE: this must match the index lookup in qstr_find_strn in qstr.c
+def make_pool_index(pool_qbytes):
+    """Build the hash index of a ROM qstr pool used by qstr_find_strn.
+
+    The first element is the slot mask (the number of slots is a power of two,
+    at most 3/4 full), followed by the slots. Each slot holds 0 if it's empty or
+    the 1-based position of a qstr in the pool. Slots are found by linear probing
+    from the low 16 bits of the unmasked djb2 hash of the qstr.
+    """
+    assert len(pool_qbytes) < 0xFFFF
+    num_slots = 4
+    while num_slots * 3 < len(pool_qbytes) * 4:
+        num_slots *= 2
+    mask = num_slots - 1
+    slots = [0] * num_slots
+    for pos, qbytes in enumerate(pool_qbytes):
+        if not qbytes:
+            # qstr_find_strn handles the empty string without searching
+            continue
+        hash = 5381
+        for b in qbytes:
+            hash = ((hash * 33) ^ b) & 0xFFFF
+        i = hash & mask
+        while slots[i]:
+            i = (i + 1) & mask
+        slots[i] = pos + 1
+    return [mask] + slots
+
+
 def qstr_escape(qst):
     def esc_char(m):
         c = ord(m.group(0))
@@ -424,6 +453,9 @@ def print_qstr_data(qcfgs, qstrs, translations):
     # get config variables
     cfg_bytes_len = int(qcfgs["BYTES_IN_LEN"])
     cfg_bytes_hash = int(qcfgs["BYTES_IN_HASH"])
+    # CIRCUITPY-CHANGE
+    cfg_pool_index = int(qcfgs.get("POOL_INDEX", "0"))
+    pools = ([b""], [])
 
     # print out the starter of the generated C header file
     print("// This file was automatically generated by makeqstrdata.py")
@@ -436,6 +468,8 @@ def print_qstr_data(qcfgs, qstrs, translations):
     for qstr in static_qstr_list:
         qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
         print("QDEF0(MP_QSTR_%s, %s)" % (qstr_escape(qstr), qbytes))
+        # CIRCUITPY-CHANGE
+        pools[0].append(bytes_cons(qstr, "utf8"))
 
     # CIRCUITPY-CHANGE: track total qstr size
     total_qstr_size = 0
@@ -446,6 +480,8 @@ def print_qstr_data(qcfgs, qstrs, translations):
         qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
         pool = 0 if qstr in unsorted_qstr_list else 1
         print("QDEF%d(MP_QSTR_%s, %s)" % (pool, ident, qbytes))
+        # CIRCUITPY-CHANGE
+        pools[pool].append(bytes_cons(qstr, "utf8"))
 
         # CIRCUITPY-CHANGE: track total qstr size
         total_qstr_size += len(qstr)
@@ -457,6 +493,14 @@ def print_qstr_data(qcfgs, qstrs, translations):
     for i, original in enumerate(sorted(translations)):
         print('TRANSLATION("{}", {})'.format(original, i))
 
+    # CIRCUITPY-CHANGE: hash indexes of the two pools, only used by qstr.c
+    if cfg_pool_index:
+        for n, pool in enumerate(pools):
+            print("#ifdef QINDEX%d" % n)
+            for slot in make_pool_index(pool):
+                print("QINDEX%d(%d)" % (n, slot))
+            print("#endif")
+
     print()
     print("// {} bytes worth of qstr".format(total_qstr_size))
 
@@ -179,7 +179,24 @@ class EncodingTable:
     qstrs_inv: object
 
 
-def compute_huffman_coding(qstrs, translation_name, translations, f, compression_level):
+def compute_decode_table(codes, table_bits):
+    # Entry i decodes a code that starts with the table_bits bits of i: the
+    # code's length in the top 4 bits and its index in values in the rest.
+    # Codes longer than table_bits have entry 0 and are decoded bit by bit.
+    table = [0] * (1 << table_bits)
+    for index, (length, code) in enumerate(codes):
+        if length > table_bits:
+            continue
+        assert index < 0x1000
+        first = code << (table_bits - length)
+        for i in range(1 << (table_bits - length)):
+            table[first + i] = (length << 12) | index
+    return table
+
+
+def compute_huffman_coding(
+    qstrs, translation_name, translations, f, compression_level, decompress_table_bits
+):
     # possible future improvement: some languages are better when consider len(k) > 2. try both?
     qstrs = dict((k, v) for k, v in qstrs.items() if len(k) > 3)
     qstr_strs = list(qstrs.keys())
@@ -346,6 +363,7 @@ def compute_huffman_coding(qstrs, translation_name, translations, f, compression
     renumbered = 0
     last_length = None
     canonical = {}
+    codes = []
     for atom, code in sorted(cb.items(), key=lambda x: (len(x[1]), x[0])):
         if atom in qstr_strs:
             atom = "\1"
@@ -357,6 +375,7 @@ def compute_huffman_coding(qstrs, translation_name, translations, f, compression
         if last_length:
             renumbered <<= length - last_length
         # print(f"atom={repr(atom)} code={code}", file=sys.stderr)
+        codes.append((length, renumbered))
         canonical[atom] = "{0:0{width}b}".format(renumbered, width=length)
         if len(atom) > 1:
             o = words.index(atom) + 0x80
@@ -414,6 +433,12 @@ def compute_huffman_coding(qstrs, translation_name, translations, f, compression
     f.write("#define translation_offset {}\n".format(offset))
     f.write("#define translation_qstr_bits {}\n".format(translation_qstr_bits))
 
+    decompress_table_bits = min(decompress_table_bits, max(length_count))
+    f.write("#define decompress_table_bits {}\n".format(decompress_table_bits))
+    if decompress_table_bits:
+        table = compute_decode_table(codes, decompress_table_bits)
+        f.write("const uint16_t decompress_table[] = {{ {} }};\n".format(", ".join(map(str, table))))
+
     qstrs_inv = dict((v, k) for k, v in qstrs.items())
     return EncodingTable(
         values,
@@ -628,6 +653,12 @@ if __name__ == "__main__":
         default=9,
         help="degree of compression (>5: construct dictionary; >3: use qstrs)",
     )
+    parser.add_argument(
+        "--decompress_table_bits",
+        type=int,
+        default=0,
+        help="decode up to this many bits at a time with a table of 2**bits entries",
+    )
     parser.add_argument(
         "--compression_filename",
         type=argparse.FileType("w", encoding="UTF-8"),
@@ -651,6 +682,11 @@ if __name__ == "__main__":
     i18ns = sorted(i18ns)
     translations = translate(args.translation, i18ns)
     encoding_table = compute_huffman_coding(
-        qstrs, args.translation, translations, args.compression_filename, args.compression_level
+        qstrs,
+        args.translation,
+        translations,
+        args.compression_filename,
+        args.compression_level,
+        args.decompress_table_bits,
     )
     output_translation_data(encoding_table, translations, args.translation_filename)
@@ -83,6 +83,81 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
     return (x + x / 2) | 1;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MAP_COMPACT
+// Hash maps (maps that aren't ordered) are stored as a single block holding a
+// dense array of alloc entries in insertion order, then the cached hash of each
+// entry, then the number of entries used (including deleted ones), then an open
+// addressing index of 1-based entry numbers (0 means an empty slot). The
+// index elements are a byte wide for small maps. Deleted entries have their key
+// set to MP_OBJ_SENTINEL and keep their index slot until the next rehash, so a
+// probe always stops at the first empty index slot.
+
+static inline size_t compact_index_len(size_t alloc) {
+    return alloc + alloc / 2 + 1;
+}
+
+static inline size_t compact_index_width(size_t alloc) {
+    return alloc < 0xff ? 1 : alloc < 0xffff ? 2 : 4;
+}
+
+static size_t compact_table_bytes(size_t alloc) {
+    return alloc * (sizeof(mp_map_elem_t) + sizeof(mp_uint_t)) + sizeof(size_t)
+           + compact_index_len(alloc) * compact_index_width(alloc);
+}
+
+static inline mp_uint_t *compact_hashes(const mp_map_t *map) {
+    return (mp_uint_t *)&map->table[map->alloc];
+}
+
+static inline size_t *compact_filled(const mp_map_t *map) {
+    return (size_t *)&compact_hashes(map)[map->alloc];
+}
+
+static inline void *compact_index(const mp_map_t *map) {
+    return compact_filled(map) + 1;
+}
+
+static inline size_t compact_index_get(const void *index, size_t width, size_t pos) {
+    if (width == 1) {
+        return ((const uint8_t *)index)[pos];
+    } else if (width == 2) {
+        return ((const uint16_t *)index)[pos];
+    } else {
+        return ((const uint32_t *)index)[pos];
+    }
+}
+
+static inline void compact_index_set(void *index, size_t width, size_t pos, size_t val) {
+    if (width == 1) {
+        ((uint8_t *)index)[pos] = val;
+    } else if (width == 2) {
+        ((uint16_t *)index)[pos] = val;
+    } else {
+        ((uint32_t *)index)[pos] = val;
+    }
+}
+#endif
+
+static void map_free_table(mp_map_t *map) {
+    #if MICROPY_OPT_MAP_COMPACT
+    if (!map->is_ordered && map->alloc != 0) {
+        m_del(byte, map->table, compact_table_bytes(map->alloc));
+        return;
+    }
+    #endif
+    m_del(mp_map_elem_t, map->table, map->alloc);
+}
+
+size_t mp_map_table_bytes(const mp_map_t *map) {
+    #if MICROPY_OPT_MAP_COMPACT
+    if (!map->is_ordered && map->alloc != 0) {
+        return compact_table_bytes(map->alloc);
+    }
+    #endif
+    return map->alloc * sizeof(mp_map_elem_t);
+}
+
 /******************************************************************************/
 /* map                                                                        */
 
@@ -92,7 +167,12 @@ void mp_map_init(mp_map_t *map, size_t n) {
         map->table = NULL;
     } else {
         map->alloc = n;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_MAP_COMPACT
+        map->table = m_malloc0(compact_table_bytes(n));
+        #else
         map->table = m_new0(mp_map_elem_t, map->alloc);
+        #endif
     }
     map->used = 0;
     map->all_keys_are_qstrs = 1;
@@ -112,14 +192,16 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        map_free_table(map);
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        map_free_table(map);
     }
     map->alloc = 0;
     map->used = 0;
@@ -128,6 +210,129 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MAP_COMPACT
+// Rebuild the table without its deleted entries, reusing the cached hashes.
+static void mp_map_compact_rehash(mp_map_t *map) {
+    size_t old_alloc = map->alloc;
+    mp_map_elem_t *old_table = map->table;
+    // Leave some headroom so that a map with a steady stream of inserts and
+    // deletes at a fixed size isn't rebuilt on every insert.
+    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->used + map->used / 4 + 1);
+    DEBUG_printf("mp_map_compact_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
+    mp_map_elem_t *new_table = m_malloc0(compact_table_bytes(new_alloc));
+    // If we reach this point, table resizing succeeded, now we can edit the old map.
+    size_t old_filled = old_alloc == 0 ? 0 : *compact_filled(map);
+    const mp_uint_t *old_hashes = old_alloc == 0 ? NULL : compact_hashes(map);
+    map->alloc = new_alloc;
+    map->all_keys_are_qstrs = 1;
+    map->table = new_table;
+    mp_uint_t *hashes = compact_hashes(map);
+    void *index = compact_index(map);
+    size_t index_len = compact_index_len(new_alloc);
+    size_t width = compact_index_width(new_alloc);
+    size_t n = 0;
+    for (size_t i = 0; i < old_filled; i++) {
+        if (old_table[i].key == MP_OBJ_SENTINEL) {
+            continue;
+        }
+        size_t pos = old_hashes[i] % index_len;
+        while (compact_index_get(index, width, pos) != 0) {
+            pos = (pos + 1) % index_len;
+        }
+        compact_index_set(index, width, pos, n + 1);
+        new_table[n] = old_table[i];
+        hashes[n] = old_hashes[i];
+        if (!mp_obj_is_qstr(old_table[i].key)) {
+            map->all_keys_are_qstrs = 0;
+        }
+        n++;
+    }
+    *compact_filled(map) = n;
+    if (old_alloc != 0) {
+        m_del(byte, old_table, compact_table_bytes(old_alloc));
+    }
+}
+
+static mp_map_elem_t *mp_map_compact_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind, bool compare_only_ptrs) {
+    if (map->alloc == 0) {
+        if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            mp_map_compact_rehash(map);
+        } else {
+            return NULL;
+        }
+    }
+
+    // get hash of index, with fast path for common case of qstr
+    mp_uint_t hash;
+    if (mp_obj_is_qstr(index)) {
+        hash = qstr_hash(MP_OBJ_QSTR_VALUE(index));
+    } else {
+        hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
+    }
+
+    for (;;) {
+        mp_uint_t *hashes = compact_hashes(map);
+        void *index_table = compact_index(map);
+        size_t index_len = compact_index_len(map->alloc);
+        size_t width = compact_index_width(map->alloc);
+        size_t pos = hash % index_len;
+        size_t avail = 0;
+        size_t n;
+        // The index always has empty slots, so this terminates.
+        while ((n = compact_index_get(index_table, width, pos)) != 0) {
+            mp_map_elem_t *elem = &map->table[n - 1];
+            if (elem->key == MP_OBJ_SENTINEL) {
+                // found deleted entry, remember for later
+                if (avail == 0) {
+                    avail = n;
+                }
+            } else if (hashes[n - 1] == hash
+                       && (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index)))) {
+                // found index (keys are only compared if their cached hash matches)
+                // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    // delete element, keeping elem->value so that caller can access it if needed
+                    map->used--;
+                    elem->key = MP_OBJ_SENTINEL;
+                }
+                MAP_CACHE_SET(index, n - 1);
+                return elem;
+            }
+            pos = (pos + 1) % index_len;
+        }
+
+        // found empty index slot, so index is not in table
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        size_t *filled = compact_filled(map);
+        if (*filled < map->alloc || avail != 0) {
+            if (*filled < map->alloc) {
+                // append the new entry, keeping insertion order
+                n = (*filled)++;
+                compact_index_set(index_table, width, pos, n + 1);
+            } else {
+                // the entries are all used, so reuse a deleted one on this
+                // probe sequence rather than rehashing (which allocates)
+                n = avail - 1;
+            }
+            hashes[n] = hash;
+            mp_map_elem_t *elem = &map->table[n];
+            elem->key = index;
+            elem->value = MP_OBJ_NULL;
+            map->used++;
+            if (!mp_obj_is_qstr(index)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            return elem;
+        }
+        // no room for another entry, rebuild the table and search again
+        mp_map_compact_rehash(map);
+    }
+}
+#else
+
 static void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
@@ -146,6 +351,7 @@ static void mp_map_rehash(mp_map_t *map) {
     }
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
+#endif
 
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
@@ -233,6 +439,11 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     // map is a hash table (not an ordered array), so do a hash lookup
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    return mp_map_compact_lookup(map, index, lookup_kind, compare_only_ptrs);
+    #else
+
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_map_rehash(map);
@@ -319,6 +530,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             }
         }
     }
+    #endif
 }
 
 /******************************************************************************/
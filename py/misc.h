@@ -77,6 +77,10 @@ typedef unsigned int uint;
 #define m_new(type, num) ((type *)(m_malloc(sizeof(type) * (num))))
 #define m_new_maybe(type, num) ((type *)(m_malloc_maybe(sizeof(type) * (num))))
 #define m_new0(type, num) ((type *)(m_malloc0(sizeof(type) * (num))))
+// CIRCUITPY-CHANGE: for memory that will never hold pointers to the heap
+#define m_new_noscan(type, num) ((type *)(m_malloc_noscan(sizeof(type) * (num))))
+// CIRCUITPY-CHANGE: for pointer-free memory referenced only by one known pointer
+#define m_new_movable(type, num) ((type *)(m_malloc_movable(sizeof(type) * (num))))
 #define m_new_obj(type) (m_new(type, 1))
 #define m_new_obj_maybe(type) (m_new_maybe(type, 1))
 #define m_new_obj_var(obj_type, var_field, var_type, var_num) ((obj_type *)m_malloc(offsetof(obj_type, var_field) + sizeof(var_type) * (var_num)))
@@ -99,6 +103,17 @@ void *m_malloc(size_t num_bytes);
 void *m_malloc_maybe(size_t num_bytes);
 void *m_malloc_with_finaliser(size_t num_bytes);
 void *m_malloc0(size_t num_bytes);
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_NOSCAN
+void *m_malloc_noscan(size_t num_bytes);
+#else
+#define m_malloc_noscan(num_bytes) m_malloc(num_bytes)
+#endif
+#if MICROPY_GC_MOVABLE
+void *m_malloc_movable(size_t num_bytes);
+#else
+#define m_malloc_movable(num_bytes) m_malloc_noscan(num_bytes)
+#endif
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
 void *m_realloc(void *ptr, size_t old_num_bytes, size_t new_num_bytes);
 void *m_realloc_maybe(void *ptr, size_t old_num_bytes, size_t new_num_bytes, bool allow_move);
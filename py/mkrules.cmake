@@ -145,8 +145,8 @@ add_custom_command(
 
 add_custom_command(
     OUTPUT ${MICROPY_MODULEDEFS}
-    COMMAND ${Python3_EXECUTABLE} ${MICROPY_PY_DIR}/makemoduledefs.py ${MICROPY_MODULEDEFS_COLLECTED} > ${MICROPY_MODULEDEFS}
-    DEPENDS ${MICROPY_MODULEDEFS_COLLECTED}
+    COMMAND ${Python3_EXECUTABLE} ${MICROPY_PY_DIR}/makemoduledefs.py --qstrdefs ${MICROPY_QSTRDEFS_GENERATED} ${MICROPY_MODULEDEFS_COLLECTED} > ${MICROPY_MODULEDEFS}
+    DEPENDS ${MICROPY_MODULEDEFS_COLLECTED} ${MICROPY_QSTRDEFS_GENERATED}
 )
 
 # Generate root_pointers.h
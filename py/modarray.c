@@ -28,9 +28,440 @@
 
 #if MICROPY_PY_ARRAY
 
+// CIRCUITPY-CHANGE: bulk arithmetic on arrays
+#if MICROPY_PY_ARRAY_OPS
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/runtime.h"
+#include "py/smallint.h"
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define ARRAY_OPS_SIMD (1)
+#else
+#define ARRAY_OPS_SIMD (0)
+#endif
+
+// The numbers in an array, memoryview, bytearray or bytes.
+typedef struct {
+    void *items;
+    size_t len;
+    char typecode;
+} vec_t;
+
+static void get_vec(mp_obj_t obj, vec_t *vec, mp_uint_t flags) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    char typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode;
+    switch (typecode) {
+        case 'b':
+        case 'B':
+        case 'h':
+        case 'H':
+        case 'i':
+        case 'I':
+        case 'l':
+        case 'L':
+        case 'q':
+        case 'Q':
+        case 'f':
+        case 'd':
+            break;
+        default:
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_typecode);
+    }
+    vec->items = bufinfo.buf;
+    vec->len = bufinfo.len / mp_binary_get_size('@', typecode, NULL);
+    vec->typecode = typecode;
+}
+
+static bool is_float(const vec_t *vec) {
+    return vec->typecode == 'f' || vec->typecode == 'd';
+}
+
+static bool is_number(mp_obj_t obj) {
+    return mp_obj_is_int(obj) || mp_obj_is_float(obj);
+}
+
+// Integer arithmetic saturates, first at the range of long long and then at
+// the range of the destination.
+static long long add_sat(long long a, long long b) {
+    long long r;
+    if (__builtin_add_overflow(a, b, &r)) {
+        return b < 0 ? LLONG_MIN : LLONG_MAX;
+    }
+    return r;
+}
+
+static long long mul_sat(long long a, long long b) {
+    long long r;
+    if (__builtin_mul_overflow(a, b, &r)) {
+        return (a < 0) != (b < 0) ? LLONG_MIN : LLONG_MAX;
+    }
+    return r;
+}
+
+static long long clamp(long long x, long long lo, long long hi) {
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+static long long get_int(const vec_t *vec, size_t i) {
+    switch (vec->typecode) {
+        case 'b':
+            return ((int8_t *)vec->items)[i];
+        case 'B':
+            return ((uint8_t *)vec->items)[i];
+        case 'h':
+            return ((int16_t *)vec->items)[i];
+        case 'H':
+            return ((uint16_t *)vec->items)[i];
+        case 'i':
+            return ((int *)vec->items)[i];
+        case 'I':
+            return ((unsigned int *)vec->items)[i];
+        case 'l':
+            return ((long *)vec->items)[i];
+        case 'L':
+            return MIN(((unsigned long *)vec->items)[i], (unsigned long long)LLONG_MAX);
+        case 'q':
+            return ((long long *)vec->items)[i];
+        default:
+            return MIN(((unsigned long long *)vec->items)[i], (unsigned long long)LLONG_MAX);
+    }
+}
+
+static mp_float_t get_float(const vec_t *vec, size_t i) {
+    switch (vec->typecode) {
+        case 'f':
+            return ((float *)vec->items)[i];
+        case 'd':
+            return (mp_float_t)((double *)vec->items)[i];
+        default:
+            return (mp_float_t)get_int(vec, i);
+    }
+}
+
+static void put_int(vec_t *vec, size_t i, long long x) {
+    switch (vec->typecode) {
+        case 'b':
+            ((int8_t *)vec->items)[i] = clamp(x, INT8_MIN, INT8_MAX);
+            break;
+        case 'B':
+            ((uint8_t *)vec->items)[i] = clamp(x, 0, UINT8_MAX);
+            break;
+        case 'h':
+            ((int16_t *)vec->items)[i] = clamp(x, INT16_MIN, INT16_MAX);
+            break;
+        case 'H':
+            ((uint16_t *)vec->items)[i] = clamp(x, 0, UINT16_MAX);
+            break;
+        case 'i':
+            ((int *)vec->items)[i] = clamp(x, INT_MIN, INT_MAX);
+            break;
+        case 'I':
+            ((unsigned int *)vec->items)[i] = clamp(x, 0, UINT_MAX);
+            break;
+        case 'l':
+            ((long *)vec->items)[i] = clamp(x, LONG_MIN, LONG_MAX);
+            break;
+        case 'L':
+            ((unsigned long *)vec->items)[i] = clamp(x, 0, (long long)MIN(ULONG_MAX, (unsigned long long)LLONG_MAX));
+            break;
+        case 'q':
+            ((long long *)vec->items)[i] = x;
+            break;
+        case 'Q':
+            ((unsigned long long *)vec->items)[i] = MAX(x, 0);
+            break;
+        case 'f':
+            ((float *)vec->items)[i] = x;
+            break;
+        default:
+            ((double *)vec->items)[i] = x;
+            break;
+    }
+}
+
+// Floats are rounded to the nearest integer, as by round(), when stored in an
+// integer array.
+static void put_float(vec_t *vec, size_t i, mp_float_t x) {
+    if (vec->typecode == 'f') {
+        ((float *)vec->items)[i] = (float)x;
+    } else if (vec->typecode == 'd') {
+        ((double *)vec->items)[i] = x;
+    } else if (isnan(x)) {
+        put_int(vec, i, 0);
+    } else {
+        x = MICROPY_FLOAT_C_FUN(nearbyint)(x);
+        if (x >= (mp_float_t)LLONG_MAX) {
+            put_int(vec, i, LLONG_MAX);
+        } else if (x <= (mp_float_t)LLONG_MIN) {
+            put_int(vec, i, LLONG_MIN);
+        } else {
+            put_int(vec, i, (long long)x);
+        }
+    }
+}
+
+static mp_obj_t new_int(long long x) {
+    if (x >= MP_SMALL_INT_MIN && x <= MP_SMALL_INT_MAX) {
+        return MP_OBJ_NEW_SMALL_INT(x);
+    }
+    return mp_obj_new_int_from_ll(x);
+}
+
+#if ARRAY_OPS_SIMD
+// Saturating adds of 8 and 16 bit items, four or two to a word. Returns false
+// if the arrays aren't all the same such type, or aren't word aligned.
+static bool add_simd(vec_t *dest, const vec_t *a, const vec_t *b) {
+    char typecode = dest->typecode;
+    if ((typecode != 'b' && typecode != 'B' && typecode != 'h') ||
+        a->typecode != typecode || b->typecode != typecode ||
+        (((uintptr_t)dest->items | (uintptr_t)a->items | (uintptr_t)b->items) & 3) != 0) {
+        return false;
+    }
+    size_t per_word = typecode == 'h' ? 2 : 4;
+    size_t words = dest->len / per_word;
+    uint32_t *d = dest->items;
+    const uint32_t *x = a->items;
+    const uint32_t *y = b->items;
+    for (size_t i = 0; i < words; i++) {
+        uint32_t xw, yw, r;
+        memcpy(&xw, x + i, 4);
+        memcpy(&yw, y + i, 4);
+        if (typecode == 'h') {
+            r = __qadd16(xw, yw);
+        } else if (typecode == 'b') {
+            r = __qadd8(xw, yw);
+        } else {
+            r = __uqadd8(xw, yw);
+        }
+        memcpy(d + i, &r, 4);
+    }
+    for (size_t i = words * per_word; i < dest->len; i++) {
+        put_int(dest, i, get_int(a, i) + get_int(b, i));
+    }
+    return true;
+}
+
+// The dot product of 16 bit items, two multiplies at a time. Returns false if
+// the arrays aren't both 'h' and word aligned.
+static bool dot_simd(const vec_t *a, const vec_t *b, long long *result) {
+    if (a->typecode != 'h' || b->typecode != 'h' ||
+        (((uintptr_t)a->items | (uintptr_t)b->items) & 3) != 0) {
+        return false;
+    }
+    size_t words = a->len / 2;
+    const uint32_t *x = a->items;
+    const uint32_t *y = b->items;
+    long long acc = 0;
+    for (size_t i = 0; i < words; i++) {
+        int32_t xw, yw;
+        memcpy(&xw, x + i, 4);
+        memcpy(&yw, y + i, 4);
+        acc = __smlald(xw, yw, acc);
+    }
+    if (a->len & 1) {
+        acc += get_int(a, a->len - 1) * get_int(b, a->len - 1);
+    }
+    *result = acc;
+    return true;
+}
+#endif
+
+// dest = a + b or dest = a * b, where b is an array or a number.
+static void array_op(mp_obj_t dest_in, mp_obj_t a_in, mp_obj_t b_in, bool mul) {
+    vec_t dest, a, b;
+    get_vec(dest_in, &dest, MP_BUFFER_WRITE);
+    get_vec(a_in, &a, MP_BUFFER_READ);
+    mp_arg_validate_length(a.len, dest.len, MP_QSTR_a);
+    bool b_is_number = is_number(b_in);
+    if (!b_is_number) {
+        get_vec(b_in, &b, MP_BUFFER_READ);
+        mp_arg_validate_length(b.len, dest.len, MP_QSTR_b);
+    }
+    if (is_float(&dest) || is_float(&a) || (b_is_number ? mp_obj_is_float(b_in) : is_float(&b))) {
+        mp_float_t y = b_is_number ? mp_obj_get_float(b_in) : 0;
+        for (size_t i = 0; i < dest.len; i++) {
+            mp_float_t x = get_float(&a, i);
+            if (!b_is_number) {
+                y = get_float(&b, i);
+            }
+            put_float(&dest, i, mul ? x * y : x + y);
+        }
+        return;
+    }
+    #if ARRAY_OPS_SIMD
+    if (!mul && !b_is_number && add_simd(&dest, &a, &b)) {
+        return;
+    }
+    #endif
+    long long y = b_is_number ? mp_obj_get_int(b_in) : 0;
+    for (size_t i = 0; i < dest.len; i++) {
+        long long x = get_int(&a, i);
+        if (!b_is_number) {
+            y = get_int(&b, i);
+        }
+        put_int(&dest, i, mul ? mul_sat(x, y) : add_sat(x, y));
+    }
+}
+
+static mp_obj_t array_add(mp_obj_t dest, mp_obj_t a, mp_obj_t b) {
+    array_op(dest, a, b, false);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(array_add_obj, array_add);
+
+static mp_obj_t array_mul(mp_obj_t dest, mp_obj_t a, mp_obj_t b) {
+    array_op(dest, a, b, true);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(array_mul_obj, array_mul);
+
+// dest = src * factor + offset, which also converts between types.
+static mp_obj_t array_scale(size_t n_args, const mp_obj_t *args) {
+    vec_t dest, src;
+    get_vec(args[0], &dest, MP_BUFFER_WRITE);
+    get_vec(args[1], &src, MP_BUFFER_READ);
+    mp_arg_validate_length(src.len, dest.len, MP_QSTR_src);
+    mp_obj_t factor = n_args > 2 ? args[2] : MP_OBJ_NEW_SMALL_INT(1);
+    mp_obj_t offset = n_args > 3 ? args[3] : MP_OBJ_NEW_SMALL_INT(0);
+    mp_float_t f = mp_arg_validate_type_float(factor, MP_QSTR_factor);
+    mp_float_t o = mp_arg_validate_type_float(offset, MP_QSTR_offset);
+    if (is_float(&dest) || is_float(&src) || mp_obj_is_float(factor) || mp_obj_is_float(offset)) {
+        for (size_t i = 0; i < dest.len; i++) {
+            put_float(&dest, i, get_float(&src, i) * f + o);
+        }
+    } else {
+        long long fi = mp_obj_get_int(factor);
+        long long oi = mp_obj_get_int(offset);
+        for (size_t i = 0; i < dest.len; i++) {
+            put_int(&dest, i, add_sat(mul_sat(get_int(&src, i), fi), oi));
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(array_scale_obj, 2, 4, array_scale);
+
+static mp_obj_t array_min_max(mp_obj_t a_in, bool max) {
+    vec_t a;
+    get_vec(a_in, &a, MP_BUFFER_READ);
+    mp_arg_validate_length_min(a.len, 1, MP_QSTR_a);
+    size_t best = 0;
+    if (is_float(&a)) {
+        for (size_t i = 1; i < a.len; i++) {
+            mp_float_t x = get_float(&a, i);
+            mp_float_t y = get_float(&a, best);
+            if (max ? x > y : x < y) {
+                best = i;
+            }
+        }
+    } else {
+        for (size_t i = 1; i < a.len; i++) {
+            long long x = get_int(&a, i);
+            long long y = get_int(&a, best);
+            if (max ? x > y : x < y) {
+                best = i;
+            }
+        }
+    }
+    return mp_binary_get_val_array(a.typecode, a.items, best);
+}
+
+static mp_obj_t array_min(mp_obj_t a) {
+    return array_min_max(a, false);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(array_min_obj, array_min);
+
+static mp_obj_t array_max(mp_obj_t a) {
+    return array_min_max(a, true);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(array_max_obj, array_max);
+
+static mp_obj_t array_sum(mp_obj_t a_in) {
+    vec_t a;
+    get_vec(a_in, &a, MP_BUFFER_READ);
+    if (is_float(&a)) {
+        mp_float_t sum = 0;
+        for (size_t i = 0; i < a.len; i++) {
+            sum += get_float(&a, i);
+        }
+        return mp_obj_new_float(sum);
+    }
+    long long sum = 0;
+    for (size_t i = 0; i < a.len; i++) {
+        sum = add_sat(sum, get_int(&a, i));
+    }
+    return new_int(sum);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(array_sum_obj, array_sum);
+
+static mp_obj_t array_mean(mp_obj_t a_in) {
+    vec_t a;
+    get_vec(a_in, &a, MP_BUFFER_READ);
+    mp_arg_validate_length_min(a.len, 1, MP_QSTR_a);
+    mp_float_t sum = 0;
+    if (is_float(&a)) {
+        for (size_t i = 0; i < a.len; i++) {
+            sum += get_float(&a, i);
+        }
+    } else {
+        // Sum exactly, then divide.
+        long long isum = 0;
+        for (size_t i = 0; i < a.len; i++) {
+            isum = add_sat(isum, get_int(&a, i));
+        }
+        sum = (mp_float_t)isum;
+    }
+    return mp_obj_new_float(sum / a.len);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(array_mean_obj, array_mean);
+
+static mp_obj_t array_dot(mp_obj_t a_in, mp_obj_t b_in) {
+    vec_t a, b;
+    get_vec(a_in, &a, MP_BUFFER_READ);
+    get_vec(b_in, &b, MP_BUFFER_READ);
+    mp_arg_validate_length(b.len, a.len, MP_QSTR_b);
+    if (is_float(&a) || is_float(&b)) {
+        mp_float_t sum = 0;
+        for (size_t i = 0; i < a.len; i++) {
+            sum += get_float(&a, i) * get_float(&b, i);
+        }
+        return mp_obj_new_float(sum);
+    }
+    long long sum = 0;
+    #if ARRAY_OPS_SIMD
+    if (dot_simd(&a, &b, &sum)) {
+        return new_int(sum);
+    }
+    #endif
+    for (size_t i = 0; i < a.len; i++) {
+        sum = add_sat(sum, mul_sat(get_int(&a, i), get_int(&b, i)));
+    }
+    return new_int(sum);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(array_dot_obj, array_dot);
+
+#endif // MICROPY_PY_ARRAY_OPS
+
 static const mp_rom_map_elem_t mp_module_array_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_array) },
     { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&mp_type_array) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_ARRAY_OPS
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&array_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mul), MP_ROM_PTR(&array_mul_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&array_scale_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&array_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&array_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&array_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&array_mean_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&array_dot_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_array_globals, mp_module_array_globals_table);
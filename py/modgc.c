@@ -27,6 +27,19 @@
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/gc.h"
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+#include "py/objlist.h"
+#endif
+#if MICROPY_GC_RESERVE
+#include "py/runtime.h"
+#endif
+#if MICROPY_GC_INCREMENTAL
+#include "py/mphal.h"
+#if CIRCUITPY_TIME
+#include "shared-bindings/time/__init__.h"
+#endif
+#endif
 
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
@@ -51,6 +64,10 @@ MP_DEFINE_CONST_FUN_OBJ_0(gc_disable_obj, gc_disable);
 // enable(): enable the garbage collector
 static mp_obj_t gc_enable(void) {
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_RESERVE
+    gc_reserve_restore();
+    #endif
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_enable_obj, gc_enable);
@@ -100,6 +117,109 @@ static mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+// step(budget_us): run one bounded slice of an incremental collection
+static mp_obj_t gc_step(mp_obj_t budget_in) {
+    mp_int_t budget_us = mp_obj_get_int(budget_in);
+    uint32_t start = MICROPY_GC_INCREMENTAL_TICKS_US();
+    if (!gc_sweep_pending()) {
+        // Marking isn't divisible, so a new cycle begins with a full mark.
+        gc_collect_incremental_start();
+        MP_STATE_MEM(gc_step_mark_us) = (uint32_t)MICROPY_GC_INCREMENTAL_TICKS_US() - start;
+    }
+    bool done;
+    uint32_t elapsed;
+    do {
+        done = gc_sweep_step(MICROPY_GC_INCREMENTAL_SLICE_BLOCKS);
+        elapsed = (uint32_t)MICROPY_GC_INCREMENTAL_TICKS_US() - start;
+    } while (!done && (mp_int_t)elapsed < budget_us);
+    MP_STATE_MEM(gc_step_last_us) = elapsed;
+    if (elapsed > MP_STATE_MEM(gc_step_max_us)) {
+        MP_STATE_MEM(gc_step_max_us) = elapsed;
+    }
+    return mp_obj_new_bool(done);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gc_step_obj, gc_step);
+
+// step_stats(): return (mark_us, last_step_us, max_step_us) timings of gc.step()
+static mp_obj_t gc_step_stats(void) {
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_step_mark_us)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_step_last_us)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_step_max_us)),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_step_stats_obj, gc_step_stats);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+// stats(): return (allocs_since_collect, collections, collect_us, areas), where
+// areas holds (total, free, max_free, free_runs) for each heap area and
+// free_runs counts the free runs of 1, 2-3, 4-7 ... blocks
+static mp_obj_t gc_stats(void) {
+    // Read the counters before the result's own allocations change them.
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_allocs)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_collections)),
+        mp_obj_new_int_from_ull(MP_STATE_MEM(gc_stats_collect_us)),
+        mp_const_none,
+    };
+    mp_obj_t areas = mp_obj_new_list(0, NULL);
+    gc_area_stats_t stats;
+    for (size_t i = 0; gc_area_stats(i, &stats); i++) {
+        mp_obj_t free_runs[MICROPY_GC_STATS_FREE_RUN_BUCKETS];
+        for (size_t j = 0; j < MICROPY_GC_STATS_FREE_RUN_BUCKETS; j++) {
+            free_runs[j] = MP_OBJ_NEW_SMALL_INT(stats.free_runs[j]);
+        }
+        mp_obj_t area[] = {
+            mp_obj_new_int_from_uint(stats.total),
+            mp_obj_new_int_from_uint(stats.free),
+            mp_obj_new_int_from_uint(stats.max_free),
+            mp_obj_new_tuple(MP_ARRAY_SIZE(free_runs), free_runs),
+        };
+        mp_obj_list_append(areas, mp_obj_new_tuple(MP_ARRAY_SIZE(area), area));
+    }
+    size_t n_areas;
+    mp_obj_t *area_items;
+    mp_obj_list_get(areas, &n_areas, &area_items);
+    items[3] = mp_obj_new_tuple(n_areas, area_items);
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_stats_obj, gc_stats);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_RESERVE
+// reserve([n_bytes]): set aside heap for when automatic collection is disabled,
+// or return the number of bytes still set aside
+static mp_obj_t gc_reserve_(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(gc_reserve_available());
+    }
+    size_t n_bytes = mp_arg_validate_int_min(mp_obj_get_int(args[0]), 0, MP_QSTR_n_bytes);
+    if (!gc_reserve(n_bytes)) {
+        m_malloc_fail(n_bytes);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_reserve_obj, 0, 1, gc_reserve_);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// compact(): collect and defragment the heap, return the largest free block size in bytes
+static mp_obj_t gc_compact_(void) {
+    gc_compact();
+    gc_info_t info;
+    gc_info(&info);
+    return MP_OBJ_NEW_SMALL_INT(info.max_free * MICROPY_BYTES_PER_GC_BLOCK);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, gc_compact_);
+#endif
+
 static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
@@ -111,6 +231,23 @@ static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    { MP_ROM_QSTR(MP_QSTR_step), MP_ROM_PTR(&gc_step_obj) },
+    { MP_ROM_QSTR(MP_QSTR_step_stats), MP_ROM_PTR(&gc_step_stats_obj) },
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_RESERVE
+    { MP_ROM_QSTR(MP_QSTR_reserve), MP_ROM_PTR(&gc_reserve_obj) },
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_MOVABLE
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
@@ -202,6 +202,192 @@ static MP_DEFINE_CONST_OBJ_TYPE(
     );
 #endif // MICROPY_PY_IO_BUFFEREDWRITER
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_IO_BUFFEREDREADER
+#define BUFREADER_DEFAULT_SIZE (128)
+
+typedef struct _mp_obj_bufreader_t {
+    mp_obj_base_t base;
+    mp_obj_t stream;
+    size_t alloc;
+    size_t pos;
+    size_t len;
+    byte buf[0];
+} mp_obj_bufreader_t;
+
+static mp_obj_t bufreader_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 2, false);
+    mp_get_stream_raise(args[0], MP_STREAM_OP_READ);
+    size_t alloc = BUFREADER_DEFAULT_SIZE;
+    if (n_args > 1) {
+        alloc = mp_obj_get_int(args[1]);
+        if ((mp_int_t)alloc <= 0) {
+            mp_raise_ValueError(NULL);
+        }
+    }
+    mp_obj_bufreader_t *o = mp_obj_malloc_var(mp_obj_bufreader_t, buf, byte, alloc, type);
+    o->stream = args[0];
+    o->alloc = alloc;
+    o->pos = 0;
+    o->len = 0;
+    return o;
+}
+
+// Refill the buffer, which must be empty, with a single read of the stream.
+static mp_uint_t bufreader_fill(mp_obj_bufreader_t *self, int *errcode) {
+    mp_uint_t out_sz = mp_get_stream(self->stream)->read(self->stream, self->buf, self->alloc, errcode);
+    if (out_sz != MP_STREAM_ERROR) {
+        self->pos = 0;
+        self->len = out_sz;
+    }
+    return out_sz;
+}
+
+static mp_uint_t bufreader_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
+    mp_obj_bufreader_t *self = MP_OBJ_TO_PTR(self_in);
+
+    if (self->pos == self->len) {
+        // Reads at least as large as the buffer go straight to the stream.
+        if (size >= self->alloc) {
+            return mp_get_stream(self->stream)->read(self->stream, buf, size, errcode);
+        }
+        mp_uint_t out_sz = bufreader_fill(self, errcode);
+        if (out_sz == MP_STREAM_ERROR || out_sz == 0) {
+            return out_sz;
+        }
+    }
+
+    mp_uint_t n = MIN(size, self->len - self->pos);
+    memcpy(buf, self->buf + self->pos, n);
+    self->pos += n;
+    return n;
+}
+
+static mp_obj_t bufreader_readline(size_t n_args, const mp_obj_t *args) {
+    mp_obj_bufreader_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    mp_int_t max_size = -1;
+    if (n_args > 1) {
+        max_size = mp_obj_get_int(args[1]);
+    }
+
+    vstr_t vstr;
+    vstr_init(&vstr, 16);
+
+    while (max_size != 0) {
+        if (self->pos == self->len) {
+            int error;
+            mp_uint_t out_sz = bufreader_fill(self, &error);
+            if (out_sz == MP_STREAM_ERROR) {
+                if (mp_is_nonblocking_error(error)) {
+                    if (vstr.len == 0) {
+                        // Same as the unbuffered readline(), see stream.c.
+                        vstr_clear(&vstr);
+                        return mp_const_none;
+                    }
+                    break;
+                }
+                mp_raise_OSError(error);
+            }
+            if (out_sz == 0) {
+                break;
+            }
+        }
+        const byte *start = self->buf + self->pos;
+        size_t n = self->len - self->pos;
+        if (max_size != -1 && n > (size_t)max_size) {
+            n = max_size;
+        }
+        const byte *nl = memchr(start, '\n', n);
+        if (nl != NULL) {
+            n = nl + 1 - start;
+        }
+        vstr_add_strn(&vstr, (const char *)start, n);
+        self->pos += n;
+        if (max_size != -1) {
+            max_size -= n;
+        }
+        if (nl != NULL) {
+            break;
+        }
+    }
+
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(bufreader_readline_obj, 1, 2, bufreader_readline);
+
+static mp_obj_t bufreader_readlines(mp_obj_t self_in) {
+    mp_obj_t lines = mp_obj_new_list(0, NULL);
+    for (;;) {
+        mp_obj_t line = bufreader_readline(1, &self_in);
+        if (!mp_obj_is_true(line)) {
+            break;
+        }
+        mp_obj_list_append(lines, line);
+    }
+    return lines;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(bufreader_readlines_obj, bufreader_readlines);
+
+static mp_obj_t bufreader_iternext(mp_obj_t self_in) {
+    mp_obj_t line = bufreader_readline(1, &self_in);
+    if (mp_obj_is_true(line)) {
+        return line;
+    }
+    return MP_OBJ_STOP_ITERATION;
+}
+
+static mp_uint_t bufreader_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    mp_obj_bufreader_t *self = MP_OBJ_TO_PTR(self_in);
+    const mp_stream_p_t *stream_p = mp_get_stream(self->stream);
+
+    if (request == MP_STREAM_CLOSE || request == MP_STREAM_POLL) {
+        mp_uint_t ret = 0;
+        if (request == MP_STREAM_POLL && self->pos != self->len) {
+            ret = arg & MP_STREAM_POLL_RD;
+        }
+        if (stream_p->ioctl == NULL) {
+            return ret;
+        }
+        mp_uint_t stream_ret = stream_p->ioctl(self->stream, request, arg, errcode);
+        if (stream_ret == MP_STREAM_ERROR) {
+            return ret != 0 ? ret : MP_STREAM_ERROR;
+        }
+        return ret | stream_ret;
+    }
+
+    // Seeking would have to discard the buffer, so it isn't supported.
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+static const mp_rom_map_elem_t bufreader_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&bufreader_readline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readlines), MP_ROM_PTR(&bufreader_readlines_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&mp_stream___exit___obj) },
+};
+static MP_DEFINE_CONST_DICT(bufreader_locals_dict, bufreader_locals_dict_table);
+
+static const mp_stream_p_t bufreader_stream_p = {
+    .read = bufreader_read,
+    .ioctl = bufreader_ioctl,
+};
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_bufreader,
+    MP_QSTR_BufferedReader,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    make_new, bufreader_make_new,
+    iter, bufreader_iternext,
+    protocol, &bufreader_stream_p,
+    locals_dict, &bufreader_locals_dict
+    );
+#endif // MICROPY_PY_IO_BUFFEREDREADER
+
 static const mp_rom_map_elem_t mp_module_io_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_io) },
     // Note: mp_builtin_open_obj should be defined by port, it's not
@@ -217,6 +403,10 @@ static const mp_rom_map_elem_t mp_module_io_globals_table[] = {
     #if MICROPY_PY_IO_BUFFEREDWRITER
     { MP_ROM_QSTR(MP_QSTR_BufferedWriter), MP_ROM_PTR(&mp_type_bufwriter) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_IO_BUFFEREDREADER
+    { MP_ROM_QSTR(MP_QSTR_BufferedReader), MP_ROM_PTR(&mp_type_bufreader) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_io_globals, mp_module_io_globals_table);
@@ -311,6 +311,16 @@
 #endif
 #endif
 
+// CIRCUITPY-CHANGE: Whether each qstr pool has a hash index, so qstr_find_strn
+// (and so interning a string) doesn't search the pools linearly. The index of
+// the ROM pools is generated at build time by makeqstrdata.py and mpy-tool.py,
+// costing about 2-3 bytes of ROM per qstr; pools allocated at runtime carry
+// their own index, costing about 2-3 bytes of RAM per entry. This must be a
+// plain 0 or 1 because makeqstrdata.py reads it.
+#ifndef MICROPY_QSTR_POOL_INDEX
+#define MICROPY_QSTR_POOL_INDEX (0)
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -342,11 +352,55 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether .mpy files whose data is memory mapped (eg in flash) are executed in
+// place: the bytecode and qstr data are referenced rather than copied to the
+// heap. A file is memory mapped if its file object exposes a read buffer,
+// which must stay valid for as long as the loaded code is in use.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether imported .py files are compiled once and cached as .mpy files in a
+// __pycache__ directory next to them, keyed on the size and mtime of the source.
+// Needs the VFS and persistent code loading; enables persistent code saving.
+#ifndef MICROPY_MODULE_COMPILE_CACHE
+#define MICROPY_MODULE_COMPILE_CACHE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Size in bytes of a cache of where imported modules were found, which is kept
+// across soft reloads, or 0 for none. Changes through the VFS clear it; ports
+// must call mp_module_path_cache_invalidate() for changes made any other way.
+#ifndef MICROPY_MODULE_PATH_CACHE
+#define MICROPY_MODULE_PATH_CACHE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Most bytes of compiled modules, from files under MICROPY_MODULE_RETAIN_PREFIX,
+// to keep outside the VM heap so that they are imported without compiling after
+// a soft reload, or 0 for none. Needs MICROPY_MODULE_COMPILE_CACHE. Ports call
+// mp_module_retain_collect() after each VM ends to free what wasn't used.
+#ifndef MICROPY_MODULE_RETAIN
+#define MICROPY_MODULE_RETAIN (0)
+#endif
+#ifndef MICROPY_MODULE_RETAIN_PREFIX
+#define MICROPY_MODULE_RETAIN_PREFIX "/lib/"
+#endif
+#ifndef MICROPY_MODULE_RETAIN_ALLOC
+#define MICROPY_MODULE_RETAIN_ALLOC(size) malloc(size)
+#endif
+#ifndef MICROPY_MODULE_RETAIN_FREE
+#define MICROPY_MODULE_RETAIN_FREE(ptr) free(ptr)
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
-#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE)
+// CIRCUITPY-CHANGE: also needed by the compile cache
+#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE || MICROPY_MODULE_COMPILE_CACHE)
 #endif
 
 // Whether to support saving persistent code to a file via mp_raw_code_save_file
@@ -418,8 +472,15 @@
 #define MICROPY_EMIT_XTENSAWIN (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to emit RV32IMC native code
+#ifndef MICROPY_EMIT_RV32
+#define MICROPY_EMIT_RV32 (0)
+#endif
+
 // Convenience definition for whether any native emitter is enabled
-#define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA || MICROPY_EMIT_XTENSAWIN)
+// CIRCUITPY-CHANGE: add MICROPY_EMIT_RV32
+#define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA || MICROPY_EMIT_XTENSAWIN || MICROPY_EMIT_RV32)
 
 // Some architectures cannot read byte-wise from executable memory.  In this case
 // the prelude for a native function (which usually sits after the machine code)
@@ -463,6 +524,16 @@
 #define MICROPY_COMP_ALLOW_TOP_LEVEL_AWAIT (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether .py modules loaded by import are compiled and run one top-level
+// statement at a time, freeing each parse tree once it's compiled, so peak RAM
+// depends on the largest statement rather than the size of the file. Unlike
+// CPython, statements before a syntax error will already have run. Modules
+// compiled for MICROPY_MODULE_COMPILE_CACHE are still compiled whole.
+#ifndef MICROPY_COMP_INCREMENTAL
+#define MICROPY_COMP_INCREMENTAL (0)
+#endif
+
 // Whether to enable constant folding; eg 1+2 rewritten as 3
 #ifndef MICROPY_COMP_CONST_FOLDING
 #define MICROPY_COMP_CONST_FOLDING (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
@@ -507,6 +578,13 @@
 #define MICROPY_COMP_RETURN_IF_EXPR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether jumps to an unconditional jump go straight to its destination, and
+// code that is then never reached is left out of the bytecode
+#ifndef MICROPY_COMP_JUMP_THREADING
+#define MICROPY_COMP_JUMP_THREADING (0)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -593,12 +671,69 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE: Store hash maps as a dense, insertion-ordered array of
+// entries plus a compact open addressing index, with each entry's hash cached.
+// Probes only compare keys whose hash matches and rehashing doesn't need to
+// recompute any hashes, which helps large dicts with non-qstr keys. Costs one
+// extra word per entry. Ordered and fixed maps are unaffected.
+#ifndef MICROPY_OPT_MAP_COMPACT
+#define MICROPY_OPT_MAP_COMPACT (0)
+#endif
+
+// CIRCUITPY-CHANGE: Cache where an attribute of an instance of a user-defined
+// class was found in the class hierarchy, keyed on the instance's type and the
+// attribute name. Repeated method calls and class attribute loads then skip
+// walking the base classes. Class attributes must be changed via setattr/delattr
+// on the class (not by mutating a dict passed to type()) for the cache to notice.
+#ifndef MICROPY_OPT_ATTR_CACHE
+#define MICROPY_OPT_ATTR_CACHE (0)
+#endif
+
+// Number of entries in the attribute cache; each entry is 4 words.
+#ifndef MICROPY_OPT_ATTR_CACHE_SIZE
+#define MICROPY_OPT_ATTR_CACHE_SIZE (32)
+#endif
+
+#if MICROPY_OPT_ATTR_CACHE && MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+#error MICROPY_OPT_ATTR_CACHE requires MICROPY_PY_THREAD_GIL when threads are enabled
+#endif
+
+// CIRCUITPY-CHANGE: Whether the bytecode compiler fuses common opcode pairs into
+// single superinstructions (LOAD_FAST 0 + LOAD_ATTR/LOAD_METHOD, and
+// LOAD_CONST_SMALL_INT + some binary ops), saving a dispatch and giving small
+// ints a fast path. Costs a few hundred bytes of code. The fused opcodes are not
+// part of the standard .mpy format, so saved .mpy files are flagged with
+// MPY_FEATURE_SUPERINSTRUCTIONS and builds without this option refuse them, and
+// the compile cache magic says whether they may be present. sys.settrace
+// expects one opcode per source step, so can't be used with this.
+#ifndef MICROPY_OPT_SUPERINSTRUCTIONS
+#define MICROPY_OPT_SUPERINSTRUCTIONS (0)
+#endif
+
+#if MICROPY_OPT_SUPERINSTRUCTIONS && MICROPY_PY_SYS_SETTRACE
+#error MICROPY_OPT_SUPERINSTRUCTIONS is incompatible with MICROPY_PY_SYS_SETTRACE
+#endif
+
+// CIRCUITPY-CHANGE: Whether the VM evaluates the common binary ops and comparisons
+// inline when both operands are small ints (or both are floats, if the object
+// representation stores them unboxed), instead of calling mp_binary_op().
+#ifndef MICROPY_OPT_VM_BINARY_OP_FAST_PATH
+#define MICROPY_OPT_VM_BINARY_OP_FAST_PATH (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: Whether mpz uses Karatsuba multiplication for large numbers
+// and Montgomery multiplication for pow() with an odd modulus. Both allocate
+// temporary digits while they work.
+#ifndef MICROPY_OPT_MPZ_FAST_MUL
+#define MICROPY_OPT_MPZ_FAST_MUL (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 
 // Whether math.factorial is large, fast and recursive (1) or small and slow (0).
 #ifndef MICROPY_OPT_MATH_FACTORIAL
@@ -685,6 +820,85 @@
 #define MICROPY_GC_HOOK_LOOP(i)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether the sweep phase of a collection can be deferred and run in bounded
+// slices, driven by gc.step() or gc_sweep_step().
+#ifndef MICROPY_GC_INCREMENTAL
+#define MICROPY_GC_INCREMENTAL (0)
+#endif
+
+// Number of blocks swept between checks of the time budget in gc.step().
+#ifndef MICROPY_GC_INCREMENTAL_SLICE_BLOCKS
+#define MICROPY_GC_INCREMENTAL_SLICE_BLOCKS (256)
+#endif
+
+// Microsecond time source used to bound and report gc.step() slices.
+#ifndef MICROPY_GC_INCREMENTAL_TICKS_US
+#define MICROPY_GC_INCREMENTAL_TICKS_US() mp_hal_ticks_us()
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether gc_alloc keeps free lists of runs of 1, 2-3, 4-7 and 8+ free blocks,
+// rebuilt by each sweep, so that allocations of up to 8 blocks usually don't
+// need to scan the allocation table.
+#ifndef MICROPY_GC_FREE_LISTS
+#define MICROPY_GC_FREE_LISTS (0)
+#endif
+
+// Number of free runs remembered by each of the free lists.
+#ifndef MICROPY_GC_FREE_LIST_LEN
+#define MICROPY_GC_FREE_LIST_LEN (8)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to count allocations and collections, and time collections with
+// MICROPY_GC_INCREMENTAL_TICKS_US, for gc.stats().
+#ifndef MICROPY_GC_STATS
+#define MICROPY_GC_STATS (0)
+#endif
+
+// Number of buckets in the histogram of free run lengths from gc.stats(). The
+// buckets hold runs of 1, 2-3, 4-7 ... blocks, and the last holds all the
+// longer runs.
+#ifndef MICROPY_GC_STATS_FREE_RUN_BUCKETS
+#define MICROPY_GC_STATS_FREE_RUN_BUCKETS (12)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether gc.reserve() can set aside heap memory for allocations that would
+// otherwise fail while automatic collection is disabled.
+#ifndef MICROPY_GC_RESERVE
+#define MICROPY_GC_RESERVE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether allocations can be flagged as holding no heap pointers (string and
+// bytes data, bytearray and array storage), so that the GC marks them without
+// scanning their contents.  Costs one bit per GC block.
+#ifndef MICROPY_GC_NOSCAN
+#define MICROPY_GC_NOSCAN (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to provide gc_compact(), which moves the storage of bytearray and
+// array objects to merge fragmented free memory.  Costs two bits per GC block.
+#ifndef MICROPY_GC_MOVABLE
+#define MICROPY_GC_MOVABLE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether split heap areas are tagged as fast (internal RAM) or slow (such as
+// PSRAM). Allocations smaller than MICROPY_GC_SLOW_AREA_THRESHOLD bytes look
+// in fast areas first and larger ones in slow areas first. Either falls back
+// to the other kind of area. Needs MICROPY_GC_SPLIT_HEAP_AUTO.
+#ifndef MICROPY_GC_TIERED
+#define MICROPY_GC_TIERED (0)
+#endif
+
+#ifndef MICROPY_GC_SLOW_AREA_THRESHOLD
+#define MICROPY_GC_SLOW_AREA_THRESHOLD (1024)
+#endif
+
 // Whether to provide m_tracked_calloc, m_tracked_free functions
 #ifndef MICROPY_TRACKED_ALLOC
 #define MICROPY_TRACKED_ALLOC (0)
@@ -853,6 +1067,15 @@ typedef long long mp_longint_impl_t;
 #define MICROPY_CONST_GENERATOREXIT_OBJ (!MICROPY_CPYTHON_EXCEPTION_CHAIN)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to skip recording traceback info in StopIteration exceptions. They
+// end iterators and return values from generators and coroutines, and are
+// nearly always caught by the caller, so this saves allocating a traceback
+// each time one is raised. An uncaught StopIteration is printed without it.
+#ifndef MICROPY_STOP_ITERATION_NO_TRACEBACK
+#define MICROPY_STOP_ITERATION_NO_TRACEBACK (0)
+#endif
+
 
 // Float and complex implementation
 #define MICROPY_FLOAT_IMPL_NONE (0)
@@ -896,6 +1119,16 @@ typedef double mp_float_t;
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to convert floats to and from decimal with integer arithmetic. Then
+// repr() gives the shortest digits that read back as the same float, formats
+// with a precision are correctly rounded, and short decimals are parsed
+// without pow(). Otherwise digits come from repeated float arithmetic, which
+// is smaller but slower and may be off in the last places.
+#ifndef MICROPY_FLOAT_FAST_CONVERSION
+#define MICROPY_FLOAT_FAST_CONVERSION (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Enable features which improve CPython compatibility
 // but may lead to more code size/memory usage.
 // TODO: Originally intended as generic category to not
@@ -924,6 +1157,13 @@ typedef double mp_float_t;
 #define MICROPY_STREAMS_POSIX_API (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of bytes readline() reads at a time from a stream that can seek back
+// over the ones it doesn't use. 0 reads every stream a byte at a time.
+#ifndef MICROPY_STREAMS_READLINE_CHUNK_SIZE
+#define MICROPY_STREAMS_READLINE_CHUNK_SIZE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 64 : 0)
+#endif
+
 // Whether modules can use MP_REGISTER_MODULE_DELEGATION() to delegate failed
 // attribute lookups to a custom handler function.
 #ifndef MICROPY_MODULE_ATTR_DELEGATION
@@ -937,6 +1177,14 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_BUILTIN_INIT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether built-in modules can have a __lazy_init__ that is called the first
+// time one of their non-dunder attributes is used after an import, instead of
+// doing the work at import time. Like __init__ it can run more than once.
+#ifndef MICROPY_MODULE_BUILTIN_LAZY_INIT
+#define MICROPY_MODULE_BUILTIN_LAZY_INIT (0)
+#endif
+
 // Whether to allow built-in modules to have sub-packages (by making the
 // sub-package a member of their locals dict). Sub-packages should not be
 // registered with MP_REGISTER_MODULE, instead they should be added as
@@ -951,6 +1199,13 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_BUILTIN_SUBPACKAGES (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
 #endif
 
+// CIRCUITPY-CHANGE: Whether to find built-in modules with the minimal perfect
+// hash generated by py/makemoduledefs.py (one probe) instead of searching the
+// module tables linearly. Costs about a byte of ROM per built-in module.
+#ifndef MICROPY_MODULE_BUILTIN_PHASH
+#define MICROPY_MODULE_BUILTIN_PHASH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to support module-level __getattr__ (see PEP 562)
 #ifndef MICROPY_MODULE_GETATTR
 #define MICROPY_MODULE_GETATTR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
@@ -1104,6 +1359,25 @@ typedef double mp_float_t;
 #define MICROPY_PY_GENERATOR_PEND_THROW (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether bytecode generators and coroutines keep their state in a separate
+// frame that is given back when they finish, to be reused by the next one of
+// the same size instead of allocating. Not with sys.settrace(), whose frame
+// objects point at the state.
+#ifndef MICROPY_PY_GENERATOR_FRAME_POOL
+#define MICROPY_PY_GENERATOR_FRAME_POOL (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES && !MICROPY_PY_SYS_SETTRACE && (!MICROPY_PY_THREAD || MICROPY_PY_THREAD_GIL))
+#endif
+
+// Number of frame sizes pooled, from 1 GC block up; larger frames are freed.
+#ifndef MICROPY_PY_GENERATOR_FRAME_POOL_SIZES
+#define MICROPY_PY_GENERATOR_FRAME_POOL_SIZES (8)
+#endif
+
+// Number of frames of each size kept between collections.
+#ifndef MICROPY_PY_GENERATOR_FRAME_POOL_DEPTH
+#define MICROPY_PY_GENERATOR_FRAME_POOL_DEPTH (4)
+#endif
+
 // Issue a warning when comparing str and bytes objects
 #ifndef MICROPY_PY_STR_BYTES_CMP_WARN
 #define MICROPY_PY_STR_BYTES_CMP_WARN (0)
@@ -1129,6 +1403,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_STR_CENTER (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether bytes methods like find(), split() and startswith() accept any
+// object with the buffer protocol as an argument, eg memoryview
+#ifndef MICROPY_PY_BUILTINS_BYTES_BUFFER_ARGS
+#define MICROPY_PY_BUILTINS_BYTES_BUFFER_ARGS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether str.count() method provided
 #ifndef MICROPY_PY_BUILTINS_STR_COUNT
 #define MICROPY_PY_BUILTINS_STR_COUNT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
@@ -1154,6 +1435,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_BYTEARRAY (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: Whether to support bytearray.format_into(), which appends
+// the output of str.format() without making a str first
+#ifndef MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO
+#define MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to support dict.fromkeys() class method
 #ifndef MICROPY_PY_BUILTINS_DICT_FROMKEYS
 #define MICROPY_PY_BUILTINS_DICT_FROMKEYS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
@@ -1277,6 +1564,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_REVERSED (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether list.sort() and sorted() use a stable merge sort that calls the key
+// function once per item, rather than a smaller quicksort that isn't stable,
+// calls it on every comparison and is slow on input that is already sorted.
+#ifndef MICROPY_PY_LIST_SORT_STABLE
+#define MICROPY_PY_LIST_SORT_STABLE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to define "NotImplemented" special constant
 #ifndef MICROPY_PY_BUILTINS_NOTIMPLEMENTED
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -1347,6 +1642,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide add, mul, scale, min, max, sum, mean and dot functions in
+// the "array" module, for arithmetic over whole arrays without a Python loop.
+// Needs float support.
+#ifndef MICROPY_PY_ARRAY_OPS
+#define MICROPY_PY_ARRAY_OPS (0)
+#endif
+
 // Whether to support attrtuple type (MicroPython extension)
 // It provides space-efficient tuples with attribute access
 #ifndef MICROPY_PY_ATTRTUPLE
@@ -1373,6 +1676,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_COLLECTIONS_DEQUE_SUBSCR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether "collections.deque" can store raw numbers given by a typecode, as
+// array does, and provides copy_into(), sum(), mean(), min() and max()
+#ifndef MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+#define MICROPY_PY_COLLECTIONS_DEQUE_TYPED (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
+#endif
+
 // Whether to provide "collections.OrderedDict" type
 #ifndef MICROPY_PY_COLLECTIONS_ORDEREDDICT
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -1463,11 +1773,22 @@ typedef double mp_float_t;
 #define MICROPY_PY_IO_BYTESIO (1)
 #endif
 
+// CIRCUITPY-CHANGE: Whether to provide "io.BytesIO.getbuffer()"
+#ifndef MICROPY_PY_IO_BYTESIO_GETBUFFER
+#define MICROPY_PY_IO_BYTESIO_GETBUFFER (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES && MICROPY_PY_BUILTINS_MEMORYVIEW)
+#endif
+
 // Whether to provide "io.BufferedWriter" class
 #ifndef MICROPY_PY_IO_BUFFEREDWRITER
 #define MICROPY_PY_IO_BUFFEREDWRITER (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide "io.BufferedReader" class
+#ifndef MICROPY_PY_IO_BUFFEREDREADER
+#define MICROPY_PY_IO_BUFFEREDREADER (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
+#endif
+
 // Whether to provide "struct" module
 #ifndef MICROPY_PY_STRUCT
 #define MICROPY_PY_STRUCT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
@@ -1554,6 +1875,17 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether the VM keeps MP_STATE_THREAD(current_code_state) pointing at the
+// innermost executing bytecode frame.  sys.settrace needs this, and so does
+// attributing heap allocations to source lines.
+#ifndef MICROPY_TRACK_CODE_STATE
+#define MICROPY_TRACK_CODE_STATE (MICROPY_PY_SYS_SETTRACE)
+#endif
+#if MICROPY_PY_SYS_SETTRACE && !MICROPY_TRACK_CODE_STATE
+#error MICROPY_PY_SYS_SETTRACE requires MICROPY_TRACK_CODE_STATE
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -1691,6 +2023,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_JSON_SEPARATORS (1)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to support the "object_hook" argument to load, loads
+#ifndef MICROPY_PY_JSON_OBJECT_HOOK
+#define MICROPY_PY_JSON_OBJECT_HOOK (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 #ifndef MICROPY_PY_OS
 #define MICROPY_PY_OS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -1719,10 +2057,37 @@ typedef double mp_float_t;
 #define MICROPY_PY_RE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of patterns given as strings to re.match() and friends whose
+// compiled form is kept for reuse, most recently used first
+#ifndef MICROPY_PY_RE_CACHE_SIZE
+#define MICROPY_PY_RE_CACHE_SIZE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to match with a Pike VM, which takes time linear in the length of
+// the subject, instead of the backtracking matcher
+#ifndef MICROPY_PY_RE_PIKEVM
+#define MICROPY_PY_RE_PIKEVM (0)
+#endif
+
 #ifndef MICROPY_PY_HEAPQ
 #define MICROPY_PY_HEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide heapq.PriorityQueue, a heap ordered by numeric priorities
+// that are compared in C
+#ifndef MICROPY_PY_HEAPQ_PRIORITYQUEUE
+#define MICROPY_PY_HEAPQ_PRIORITYQUEUE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to provide the "bisect" module
+#ifndef MICROPY_PY_BISECT
+#define MICROPY_PY_BISECT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 #ifndef MICROPY_PY_HASHLIB
 #define MICROPY_PY_HASHLIB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -1761,6 +2126,21 @@ typedef double mp_float_t;
 #define MICROPY_PY_BINASCII_CRC32 (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: binascii.crc_hqx
+#ifndef MICROPY_PY_BINASCII_CRC_HQX
+#define MICROPY_PY_BINASCII_CRC_HQX (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE: whether the port provides mp_hal_crc32() and mp_hal_crc_hqx()
+#ifndef MICROPY_PY_BINASCII_CRC_HW
+#define MICROPY_PY_BINASCII_CRC_HW (0)
+#endif
+
+// Shorter buffers are always done in software
+#ifndef MICROPY_PY_BINASCII_CRC_HW_MIN_LEN
+#define MICROPY_PY_BINASCII_CRC_HW_MIN_LEN (64)
+#endif
+
 #ifndef MICROPY_PY_RANDOM
 #define MICROPY_PY_RANDOM (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -2027,6 +2407,14 @@ typedef double mp_float_t;
 #ifndef MP_PLAT_FREE_HEAP
 #define MP_PLAT_FREE_HEAP(ptr) free(ptr)
 #endif
+// CIRCUITPY-CHANGE: allocate a new heap area from fast RAM if there is any
+// left, and tell whether an area is in slow RAM.
+#ifndef MP_PLAT_ALLOC_HEAP_FAST
+#define MP_PLAT_ALLOC_HEAP_FAST(size) MP_PLAT_ALLOC_HEAP(size)
+#endif
+#ifndef MP_PLAT_HEAP_IS_SLOW
+#define MP_PLAT_HEAP_IS_SLOW(ptr) (false)
+#endif
 #endif
 
 // This macro is used to do all output (except when MICROPY_PY_IO is defined)
@@ -88,6 +88,14 @@ mp_uint_t mp_hal_ticks_cpu(void);
 uint64_t mp_hal_time_ns(void);
 #endif
 
+// CIRCUITPY-CHANGE: hardware CRC for binascii
+#if MICROPY_PY_BINASCII_CRC_HW
+// Continue a crc32() or crc_hqx() computation from *crc, which holds the value
+// as seen by Python. Return false to have the caller do it in software.
+bool mp_hal_crc32(uint32_t *crc, const void *data, size_t len);
+bool mp_hal_crc_hqx(uint16_t *crc, const void *data, size_t len);
+#endif
+
 // If port HAL didn't define its own pin API, use generic
 // "virtual pin" API from the core.
 #ifndef mp_hal_pin_obj_t
@@ -51,6 +51,17 @@
 // memory system, runtime and virtual machine.  The state is a global
 // variable, but in the future it is hoped that the state can become local.
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_ATTR_CACHE
+// Attribute attr of instances of type was found at elem in found_in's locals.
+typedef struct _mp_attr_cache_entry_t {
+    const mp_obj_type_t *type;
+    qstr attr;
+    const mp_obj_type_t *found_in;
+    mp_map_elem_t *elem;
+} mp_attr_cache_entry_t;
+#endif
+
 #if MICROPY_PY_SYS_ATTR_DELEGATION
 // Must be kept in sync with sys_mutable_keys in modsys.c.
 enum {
@@ -100,13 +111,41 @@ typedef struct _mp_state_mem_area_t {
     #if MICROPY_ENABLE_FINALISER
     byte *gc_finaliser_table_start;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NOSCAN
+    byte *gc_noscan_table_start;
+    #endif
+    #if MICROPY_GC_MOVABLE
+    byte *gc_movable_table_start;
+    #endif
     byte *gc_pool_start;
     byte *gc_pool_end;
 
     size_t gc_last_free_atb_index;
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_TIERED
+    bool slow; // The area is in slower RAM, such as PSRAM
+    #endif
 } mp_state_mem_area_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FREE_LISTS
+// Number of size classes kept by the GC free lists: runs of 1, 2-3, 4-7 and
+// 8 or more blocks.
+#define MP_GC_FREE_LIST_CLASSES (4)
+
+// A run of free blocks remembered by the GC free lists.  Entries are only
+// hints: they are checked against the allocation table before being used.
+typedef struct _mp_gc_free_run_t {
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area;
+    #endif
+    size_t block;
+    size_t n_blocks;
+} mp_gc_free_run_t;
+#endif
+
 // This structure hold information about the memory allocation system.
 typedef struct _mp_state_mem_t {
     #if MICROPY_MEM_STATS
@@ -142,6 +181,48 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    // State of a deferred sweep. gc_sweep_area is NULL when no sweep is pending.
+    mp_state_mem_area_t *gc_sweep_area;
+    size_t gc_sweep_block;
+    size_t gc_sweep_last_used_block;
+    uint8_t gc_sweep_deferred;
+    // Timing of the most recent gc.step() calls, in microseconds.
+    uint32_t gc_step_mark_us;
+    uint32_t gc_step_last_us;
+    uint32_t gc_step_max_us;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    size_t gc_stats_allocs;
+    size_t gc_stats_collections;
+    uint32_t gc_stats_collect_start_us;
+    uint64_t gc_stats_collect_us;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_RESERVE
+    // The block set aside by gc.reserve(), or NULL once it has been used.
+    void *gc_reserve_ptr;
+    size_t gc_reserve_bytes;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_MOVABLE
+    // Set while gc_compact() is marking the heap.
+    uint8_t gc_compact_pinning;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_LISTS
+    mp_gc_free_run_t gc_free_runs[MP_GC_FREE_LIST_CLASSES][MICROPY_GC_FREE_LIST_LEN];
+    uint8_t gc_free_run_count[MP_GC_FREE_LIST_CLASSES];
+    size_t gc_free_list_hits;
+    size_t gc_free_list_misses;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_mutex_t gc_mutex;
@@ -202,6 +283,12 @@ typedef struct _mp_state_vm_t {
     mp_obj_dict_t *mp_module_builtins_override_dict;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_ATTR_CACHE
+    // See mp_obj_instance_load_attr. Traced so that cached types stay alive.
+    mp_attr_cache_entry_t attr_cache[MICROPY_OPT_ATTR_CACHE_SIZE];
+    #endif
+
     // Include any root pointers registered with MP_REGISTER_ROOT_POINTER().
     #ifndef NO_QSTR
     // Only include root pointer definitions when not doing qstr extraction, because
@@ -266,6 +353,15 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    // Frames of finished generators by size in GC blocks, linked through their
+    // fun_bc entry.  Not traced by the GC: each collection empties the pool and
+    // the frames are swept.
+    struct _mp_code_state_t *gen_frame_pool[MICROPY_PY_GENERATOR_FRAME_POOL_SIZES];
+    uint8_t gen_frame_pool_len[MICROPY_PY_GENERATOR_FRAME_POOL_SIZES];
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
@@ -289,6 +385,10 @@ typedef struct _mp_state_thread_t {
     uint8_t *pystack_start;
     uint8_t *pystack_end;
     uint8_t *pystack_cur;
+    // CIRCUITPY-CHANGE: provide max pystack usage
+    #if MICROPY_MAX_STACK_USAGE
+    uint8_t *pystack_max;
+    #endif
     #endif
 
     // Locking of the GC is done per thread.
@@ -315,6 +415,9 @@ typedef struct _mp_state_thread_t {
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACK_CODE_STATE
     struct _mp_code_state_t *current_code_state;
     #endif
 
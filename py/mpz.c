@@ -36,6 +36,11 @@
 #define DIG_MSB  (MPZ_LONG_1 << (DIG_SIZE - 1))
 #define DIG_BASE (MPZ_LONG_1 << DIG_SIZE)
 
+// CIRCUITPY-CHANGE: digits can be as wide as mp_uint_t, and shifting a value by
+// the full width of its type is undefined, so these shift by a digit in two steps.
+#define SHL_DIG(v) (((v) << (DIG_SIZE / 2)) << (DIG_SIZE - DIG_SIZE / 2))
+#define SHR_DIG(v) (((v) >> (DIG_SIZE / 2)) >> (DIG_SIZE - DIG_SIZE / 2))
+
 /*
  mpz is an arbitrary precision integer type with a public API.
 
@@ -461,6 +466,127 @@ static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+// CIRCUITPY-CHANGE: Karatsuba multiplication for large operands
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+// Below this many digits in the shorter operand long multiplication is faster.
+#ifndef MPZ_KARATSUBA_THRESHOLD
+#define MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
+#if MPZ_KARATSUBA_THRESHOLD < 4
+#error MPZ_KARATSUBA_THRESHOLD must be at least 4
+#endif
+
+/* computes i += j
+   returns the carry out of the top of i
+   assumes jlen <= ilen; i and j need not be normalised
+*/
+static mpz_dig_t mpn_add_n(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+    size_t n = 0;
+    for (; n < jlen; ++n) {
+        carry += (mpz_dbl_dig_t)idig[n] + (mpz_dbl_dig_t)jdig[n];
+        idig[n] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+    for (; carry != 0 && n < ilen; ++n) {
+        carry += idig[n];
+        idig[n] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+    return carry;
+}
+
+/* computes i -= j
+   returns the borrow out of the top of i
+   assumes jlen <= ilen; i and j need not be normalised
+*/
+static mpz_dig_t mpn_sub_n(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+    size_t n = 0;
+    for (; n < jlen; ++n) {
+        borrow += (mpz_dbl_dig_t)idig[n] - (mpz_dbl_dig_t)jdig[n];
+        idig[n] = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE; // signed shift
+    }
+    for (; borrow != 0 && n < ilen; ++n) {
+        borrow += idig[n];
+        idig[n] = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE; // signed shift
+    }
+    return borrow != 0;
+}
+
+/* returns the number of digits of workspace that mpn_kmul needs
+   (a bound on it, found by evaluating the recursion for all lengths to 1000)
+*/
+static size_t mpn_kmul_ws_len(size_t jlen, size_t klen) {
+    size_t len = MAX(jlen, klen);
+    size_t bits = 0;
+    for (size_t n = len; n != 0; n >>= 1) {
+        ++bits;
+    }
+    return 4 * len + 16 * bits;
+}
+
+/* computes i = j * k
+   writes all jlen + klen digits of i, including any leading zeros
+   assumes jlen, klen > 0; j and k need not be normalised
+   ws must hold mpn_kmul_ws_len(jlen, klen) digits; i, j, k and ws must not overlap
+*/
+static void mpn_kmul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen, mpz_dig_t *ws) {
+    if (jlen < klen) {
+        mpz_dig_t *d = jdig;
+        jdig = kdig;
+        kdig = d;
+        size_t l = jlen;
+        jlen = klen;
+        klen = l;
+    }
+
+    if (klen < MPZ_KARATSUBA_THRESHOLD) {
+        memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+        mpn_mul(idig, jdig, jlen, kdig, klen);
+        return;
+    }
+
+    size_t m = (jlen + 1) / 2;
+    size_t ilen = jlen + klen;
+
+    if (klen <= m) {
+        // k is short, so only split j: i = j0 * k + (j1 * k << m)
+        size_t tlen = jlen - m + klen;
+        mpn_kmul(idig, jdig, m, kdig, klen, ws);
+        mpn_kmul(ws, jdig + m, jlen - m, kdig, klen, ws + tlen);
+        memset(idig + m + klen, 0, (jlen - m) * sizeof(mpz_dig_t));
+        mpn_add_n(idig + m, ilen - m, ws, tlen);
+        return;
+    }
+
+    // i = z0 + (z1 << m) + (z2 << 2m), where z0 = j0 * k0, z2 = j1 * k1 and
+    // z1 = (j0 + j1) * (k0 + k1) - z0 - z2
+    mpn_kmul(idig, jdig, m, kdig, m, ws);
+    mpn_kmul(idig + 2 * m, jdig + m, jlen - m, kdig + m, klen - m, ws);
+
+    mpz_dig_t *jsum = ws;
+    mpz_dig_t *ksum = jsum + m + 1;
+    mpz_dig_t *z1 = ksum + m + 1;
+    memcpy(jsum, jdig, m * sizeof(mpz_dig_t));
+    jsum[m] = mpn_add_n(jsum, m, jdig + m, jlen - m);
+    memcpy(ksum, kdig, m * sizeof(mpz_dig_t));
+    ksum[m] = mpn_add_n(ksum, m, kdig + m, klen - m);
+    mpn_kmul(z1, jsum, m + 1, ksum, m + 1, z1 + 2 * (m + 1));
+    mpn_sub_n(z1, 2 * (m + 1), idig, 2 * m);
+    mpn_sub_n(z1, 2 * (m + 1), idig + 2 * m, ilen - 2 * m);
+
+    // z1 = j0 * k1 + j1 * k0 so it fits in the top of i, less its leading zeros
+    size_t z1len = mpn_remove_trailing_zeros(z1, z1 + 2 * (m + 1));
+    mpn_add_n(idig + m, ilen - m, z1, z1len);
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -736,7 +862,8 @@ void mpz_set_from_int(mpz_t *z, mp_int_t val) {
     z->len = 0;
     while (uval > 0) {
         z->dig[z->len++] = uval & DIG_MASK;
-        uval >>= DIG_SIZE;
+        // CIRCUITPY-CHANGE
+        uval = SHR_DIG(uval);
     }
 }
 
@@ -1310,8 +1437,23 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     }
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
-    memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    // CIRCUITPY-CHANGE: use Karatsuba multiplication if there is memory for it
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    mpz_dig_t *ws = NULL;
+    size_t ws_len = mpn_kmul_ws_len(lhs->len, rhs->len);
+    if (MIN(lhs->len, rhs->len) >= MPZ_KARATSUBA_THRESHOLD) {
+        ws = m_new_maybe(mpz_dig_t, ws_len);
+    }
+    if (ws != NULL) {
+        mpn_kmul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len, ws);
+        m_del(mpz_dig_t, ws, ws_len);
+        dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + lhs->len + rhs->len);
+    } else
+    #endif
+    {
+        memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+        dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    }
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1356,6 +1498,167 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+// CIRCUITPY-CHANGE: modular exponentiation by Montgomery multiplication
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+typedef struct _mpz_mont_t {
+    const mpz_dig_t *mod;
+    size_t len;
+    // -1 / mod, modulo the digit base
+    mpz_dig_t minv;
+    // Room for a product, 2 * len + 1 digits, and mpn_kmul's workspace.
+    mpz_dig_t *prod;
+    mpz_dig_t *ws;
+} mpz_mont_t;
+
+/* computes i = j * k / R % mod, where R is the digit base to the power of len
+   i, j and k are len digits and less than mod; can have i, j, k the same
+*/
+static void mpz_mont_mul(const mpz_mont_t *mt, mpz_dig_t *idig, mpz_dig_t *jdig, mpz_dig_t *kdig) {
+    size_t len = mt->len;
+    mpz_dig_t *t = mt->prod;
+    if (len >= MPZ_KARATSUBA_THRESHOLD) {
+        mpn_kmul(t, jdig, len, kdig, len, mt->ws);
+    } else {
+        memset(t, 0, 2 * len * sizeof(mpz_dig_t));
+        mpn_mul(t, jdig, len, kdig, len);
+    }
+    t[2 * len] = 0;
+
+    // Add multiples of mod to clear the low len digits. The sum is less than
+    // 2 * mod * R so the carry never gets past the top digit.
+    for (size_t i = 0; i < len; ++i) {
+        mpz_dig_t u = ((mpz_dbl_dig_t)t[i] * mt->minv) & DIG_MASK;
+        mpz_dbl_dig_t carry = 0;
+        for (size_t j = 0; j < len; ++j) {
+            carry += (mpz_dbl_dig_t)t[i + j] + (mpz_dbl_dig_t)u * mt->mod[j];
+            t[i + j] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        for (mpz_dig_t *d = t + i + len; carry != 0; ++d) {
+            carry += *d;
+            *d = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+    }
+
+    // What's left is less than 2 * mod.
+    if (t[2 * len] != 0 || mpn_cmp(t + len, len, mt->mod, len) >= 0) {
+        mpn_sub_n(t + len, len + 1, mt->mod, len);
+    }
+    memcpy(idig, t + len, len * sizeof(mpz_dig_t));
+}
+
+/* copies z, which is less than mod, into len digits */
+static void mpz_mont_set(const mpz_mont_t *mt, mpz_dig_t *idig, const mpz_t *z) {
+    memcpy(idig, z->dig, z->len * sizeof(mpz_dig_t));
+    memset(idig + z->len, 0, (mt->len - z->len) * sizeof(mpz_dig_t));
+}
+
+/* computes dest = (lhs ** rhs) % mod
+   assumes mod is odd and not 1 or -1; assumes lhs != 0 and rhs > 0
+   can have dest, lhs, rhs the same; mod can't be the same as dest
+*/
+static void mpz_pow3_mont(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t len = mod->len;
+
+    // Work modulo abs(mod), fixing the sign at the end.
+    mpz_t abs_mod = *mod;
+    abs_mod.neg = 0;
+
+    // The Montgomery form of lhs is lhs * R % mod.
+    mpz_t x, quo;
+    mpz_init_zero(&x);
+    mpz_init_zero(&quo);
+    mpz_shl_inpl(&x, lhs, len * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &x, &x, &abs_mod);
+    mpz_deinit(&quo);
+
+    // Sliding window exponentiation, with a table of the odd powers of x up
+    // to 2 ** window.
+    size_t bits = (rhs->len - 1) * DIG_SIZE;
+    for (mpz_dig_t d = rhs->dig[rhs->len - 1]; d != 0; d >>= 1) {
+        ++bits;
+    }
+    unsigned int window = bits > 256 ? 4 : bits > 64 ? 3 : bits > 16 ? 2 : 1;
+    size_t table_len = (size_t)1 << (window - 1);
+    size_t ws_len = len >= MPZ_KARATSUBA_THRESHOLD ? mpn_kmul_ws_len(len, len) : 0;
+    size_t buf_len = (table_len + 2) * len + 2 * len + 1 + ws_len;
+    mpz_dig_t *buf = m_new(mpz_dig_t, buf_len);
+
+    mpz_mont_t mt;
+    mt.mod = mod->dig;
+    mt.len = len;
+    mpz_dig_t *table = buf;
+    mpz_dig_t *acc = table + table_len * len;
+    mpz_dig_t *x2 = acc + len;
+    mt.prod = x2 + len;
+    mt.ws = mt.prod + 2 * len + 1;
+
+    // Newton's iteration for 1 / mod doubles the number of correct bits each
+    // time, starting with 3 as any odd number is its own inverse modulo 8.
+    mpz_dig_t inv = mod->dig[0];
+    for (int i = 3; i < DIG_SIZE; i *= 2) {
+        inv = (inv * (mpz_dbl_dig_t)(2 - (mpz_dbl_dig_t)mod->dig[0] * inv)) & DIG_MASK;
+    }
+    mt.minv = (DIG_BASE - inv) & DIG_MASK;
+
+    mpz_mont_set(&mt, table, &x);
+    mpz_mont_mul(&mt, x2, table, table);
+    for (size_t i = 1; i < table_len; ++i) {
+        mpz_mont_mul(&mt, table + i * len, table + (i - 1) * len, x2);
+    }
+    mpz_deinit(&x);
+
+    // The top bit is set, so acc is set by the first window.
+    bool started = false;
+    #define RHS_BIT(n) ((rhs->dig[(n) / DIG_SIZE] >> ((n) % DIG_SIZE)) & 1)
+    for (size_t i = bits; i > 0;) {
+        --i;
+        if (!RHS_BIT(i)) {
+            mpz_mont_mul(&mt, acc, acc, acc);
+            continue;
+        }
+        // The window is bits i down to lo, ending with a 1.
+        size_t lo = i + 1 >= window ? i + 1 - window : 0;
+        while (!RHS_BIT(lo)) {
+            ++lo;
+        }
+        size_t val = 0;
+        for (size_t n = i + 1; n > lo;) {
+            --n;
+            val = (val << 1) | RHS_BIT(n);
+            if (started) {
+                mpz_mont_mul(&mt, acc, acc, acc);
+            }
+        }
+        if (started) {
+            mpz_mont_mul(&mt, acc, acc, table + (val / 2) * len);
+        } else {
+            memcpy(acc, table + (val / 2) * len, len * sizeof(mpz_dig_t));
+            started = true;
+        }
+        i = lo;
+    }
+    #undef RHS_BIT
+
+    // Multiplying by 1 converts back from Montgomery form.
+    memset(x2, 0, len * sizeof(mpz_dig_t));
+    x2[0] = 1;
+    mpz_mont_mul(&mt, acc, acc, x2);
+
+    mpz_need_dig(dest, len);
+    memcpy(dest->dig, acc, len * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + len);
+    dest->neg = 0;
+    m_del(mpz_dig_t, buf, buf_len);
+
+    if (mod->neg && dest->len != 0) {
+        mpz_add_inpl(dest, dest, mod);
+    }
+}
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1371,6 +1674,14 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if ((mod->dig[0] & 1) != 0) {
+        mpz_pow3_mont(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_t *x = mpz_clone(lhs);
     mpz_t *n = mpz_clone(rhs);
     mpz_t quo;
@@ -1542,7 +1853,8 @@ mp_int_t mpz_hash(const mpz_t *z) {
     mpz_dig_t *d = z->dig + z->len;
 
     while (d-- > z->dig) {
-        val = (val << DIG_SIZE) | *d;
+        // CIRCUITPY-CHANGE
+        val = SHL_DIG(val) | *d;
     }
 
     if (z->neg != 0) {
@@ -1557,11 +1869,17 @@ bool mpz_as_int_checked(const mpz_t *i, mp_int_t *value) {
     mpz_dig_t *d = i->dig + i->len;
 
     while (d-- > i->dig) {
-        if (val > (~(MP_OBJ_WORD_MSBIT_HIGH) >> DIG_SIZE)) {
+        // CIRCUITPY-CHANGE
+        if (val > SHR_DIG(~(MP_OBJ_WORD_MSBIT_HIGH))) {
             // will overflow
             return false;
         }
-        val = (val << DIG_SIZE) | *d;
+        val = SHL_DIG(val) | *d;
+    }
+
+    // CIRCUITPY-CHANGE: a digit as wide as mp_uint_t can set the sign bit
+    if ((mp_int_t)val < 0) {
+        return false;
     }
 
     if (i->neg != 0) {
@@ -1586,7 +1904,8 @@ bool mpz_as_uint_checked(const mpz_t *i, mp_uint_t *value) {
             // will overflow
             return false;
         }
-        val = (val << DIG_SIZE) | *d;
+        // CIRCUITPY-CHANGE
+        val = SHL_DIG(val) | *d;
     }
 
     *value = val;
@@ -82,6 +82,9 @@ typedef int8_t mpz_dbl_dig_signed_t;
   #else
     #define MPZ_LONG_1 1i64
   #endif
+#elif MPZ_DIG_SIZE > 16
+// CIRCUITPY-CHANGE: long may be too narrow to hold the digit base
+  #define MPZ_LONG_1 1LL
 #else
   #define MPZ_LONG_1 1L
 #endif
@@ -37,6 +37,11 @@
 #include "py/objtype.h"
 #include "py/gc.h"
 
+// CIRCUITPY-CHANGE
+#if defined(MICROPY_NLR_RV32I) && MICROPY_NLR_RV32I
+#include <setjmp.h>
+#endif
+
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_printf DEBUG_printf
 #else // don't print debugging info
@@ -311,7 +316,8 @@ const mp_fun_table_t mp_fun_table = {
     mp_small_int_floor_divide,
     mp_small_int_modulo,
     mp_native_yield_from,
-    #if MICROPY_NLR_SETJMP
+    // CIRCUITPY-CHANGE: RV32 native code calls setjmp() with either nlr
+    #if MICROPY_NLR_SETJMP || (defined(MICROPY_NLR_RV32I) && MICROPY_NLR_RV32I)
     setjmp,
     #else
     NULL,
@@ -44,6 +44,8 @@
 #define MICROPY_NLR_NUM_REGS_MIPS           (13)
 #define MICROPY_NLR_NUM_REGS_XTENSA         (10)
 #define MICROPY_NLR_NUM_REGS_XTENSAWIN      (17)
+// CIRCUITPY-CHANGE: RV32I native nlr
+#define MICROPY_NLR_NUM_REGS_RV32I          (14)
 
 // *FORMAT-OFF*
 
@@ -99,6 +101,13 @@
 #elif defined(__mips__)
     #define MICROPY_NLR_MIPS (1)
     #define MICROPY_NLR_NUM_REGS (MICROPY_NLR_NUM_REGS_MIPS)
+// CIRCUITPY-CHANGE: RV32I native nlr, for ports that define MICROPY_NLR_RV32I
+#elif defined(__riscv) && __riscv_xlen == 32 && defined(MICROPY_NLR_RV32I) && MICROPY_NLR_RV32I
+    #if defined(__riscv_flen)
+    #error "MICROPY_NLR_RV32I doesn't save the floating point callee-save registers"
+    #endif
+    #define MICROPY_NLR_SETJMP (0)
+    #define MICROPY_NLR_NUM_REGS (MICROPY_NLR_NUM_REGS_RV32I)
 #else
     #define MICROPY_NLR_SETJMP (1)
     //#warning "No native NLR support for this arch, using setjmp implementation"
@@ -0,0 +1,71 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mpstate.h"
+
+#if defined(MICROPY_NLR_RV32I) && MICROPY_NLR_RV32I
+
+#undef nlr_push
+
+// RV32I calling conventions:
+//  x1 = ra, return address
+//  x2 = sp, stack pointer
+//  x10 = a0, first arg, return value
+//  callee save: x2, x8-x9 (s0-s1), x18-x27 (s2-s11)
+//
+// The registers are saved in the same order as newlib's setjmp (ra, s0-s11,
+// sp) so the native emitter can find s2 at the same nlr_buf_t index either way.
+
+__attribute__((naked, returns_twice)) unsigned int nlr_push(nlr_buf_t *nlr) {
+    __asm volatile (
+        "sw     ra, 8(a0)           \n" // save regs...
+        "sw     s0, 12(a0)          \n"
+        "sw     s1, 16(a0)          \n"
+        "sw     s2, 20(a0)          \n"
+        "sw     s3, 24(a0)          \n"
+        "sw     s4, 28(a0)          \n"
+        "sw     s5, 32(a0)          \n"
+        "sw     s6, 36(a0)          \n"
+        "sw     s7, 40(a0)          \n"
+        "sw     s8, 44(a0)          \n"
+        "sw     s9, 48(a0)          \n"
+        "sw     s10, 52(a0)         \n"
+        "sw     s11, 56(a0)         \n"
+        "sw     sp, 60(a0)          \n"
+        "j      nlr_push_tail       \n" // do the rest in C
+        );
+}
+
+NORETURN void nlr_jump(void *val) {
+    MP_NLR_JUMP_HEAD(val, top)
+
+    __asm volatile (
+        "mv     a0, %0              \n" // a0 points to nlr_buf
+        "lw     ra, 8(a0)           \n" // restore regs...
+        "lw     s0, 12(a0)          \n"
+        "lw     s1, 16(a0)          \n"
+        "lw     s2, 20(a0)          \n"
+        "lw     s3, 24(a0)          \n"
+        "lw     s4, 28(a0)          \n"
+        "lw     s5, 32(a0)          \n"
+        "lw     s6, 36(a0)          \n"
+        "lw     s7, 40(a0)          \n"
+        "lw     s8, 44(a0)          \n"
+        "lw     s9, 48(a0)          \n"
+        "lw     s10, 52(a0)         \n"
+        "lw     s11, 56(a0)         \n"
+        "lw     sp, 60(a0)          \n"
+        "li     a0, 1               \n" // return 1, non-local return
+        "ret                        \n" // return
+        :                           // output operands
+        : "r" (top)                 // input operands
+        : "memory"                  // clobbered registers
+        );
+
+    MP_UNREACHABLE
+}
+
+#endif // MICROPY_NLR_RV32I
@@ -116,11 +116,36 @@ static mp_obj_array_t *array_new(char typecode, size_t n) {
     o->typecode = typecode;
     o->free = 0;
     o->len = n;
-    o->items = m_new(byte, typecode_size * o->len);
+    // CIRCUITPY-CHANGE: only object and pointer arrays can hold heap pointers.
+    // The storage of other arrays is only referenced by o->items (memoryviews
+    // and C code holding it pin it in place), so gc_compact() may move it.
+    if (typecode == 'O' || typecode == 'P') {
+        o->items = m_new(byte, typecode_size * o->len);
+    } else {
+        o->items = m_new_movable(byte, typecode_size * o->len);
+    }
     return o;
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+bool mp_obj_array_is_items_slot(void *obj, void **slot) {
+    mp_obj_array_t *o = obj;
+    #if MICROPY_PY_BUILTINS_BYTEARRAY
+    if (o->base.type == &mp_type_bytearray && slot == &o->items) {
+        return true;
+    }
+    #endif
+    #if MICROPY_PY_ARRAY
+    if (o->base.type == &mp_type_array && slot == &o->items) {
+        return true;
+    }
+    #endif
+    return false;
+}
+#endif
+
 #if MICROPY_PY_BUILTINS_BYTEARRAY || MICROPY_PY_ARRAY
 static mp_obj_t array_construct(char typecode, mp_obj_t initializer) {
     // bytearrays can be raw-initialised from anything with the buffer protocol
@@ -756,6 +781,42 @@ static mp_obj_t array_decode(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(array_decode_obj, 1, 3, array_decode);
 #endif
 
+// CIRCUITPY-CHANGE: str.format() straight into a bytearray
+#if MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO
+static void bytearray_print_strn(void *data, const char *str, size_t len) {
+    mp_obj_array_t *self = data;
+    if (self->free < len) {
+        // Lines tend to be built from many small pieces, so leave room for more.
+        size_t free = len + self->len / 2 + 16;
+        self->items = m_renew(byte, self->items, self->len + self->free, self->len + free);
+        self->free = free;
+    }
+    memcpy((byte *)self->items + self->len, str, len);
+    self->len += len;
+    self->free -= len;
+}
+
+static mp_obj_t bytearray_format_into(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t len = self->len;
+    mp_print_t print = {self, bytearray_print_strn};
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_str_format_print(&print, n_args - 1, args + 1, kwargs);
+        nlr_pop();
+    } else {
+        // Take back what was added before the error.
+        if (self->len > len) {
+            self->free += self->len - len;
+            self->len = len;
+        }
+        nlr_jump(nlr.ret_val);
+    }
+    return MP_OBJ_NEW_SMALL_INT(self->len - len);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mp_obj_bytearray_format_into_obj, 2, bytearray_format_into);
+#endif
+
 
 #if MICROPY_PY_BUILTINS_BYTEARRAY
 static const mp_rom_map_elem_t bytearray_locals_dict_table[] = {
@@ -62,9 +62,21 @@ static inline void mp_obj_memoryview_init(mp_obj_array_t *self, size_t typecode,
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// Whether slot is the items pointer of obj, a bytearray or array, and so the
+// only reference to storage that gc_compact() may move.
+bool mp_obj_array_is_items_slot(void *obj, void **slot);
+#endif
+
 #if MICROPY_PY_ARRAY || MICROPY_PY_BUILTINS_BYTEARRAY
 MP_DECLARE_CONST_FUN_OBJ_2(mp_obj_array_append_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(mp_obj_array_extend_obj);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO
+MP_DECLARE_CONST_FUN_OBJ_KW(mp_obj_bytearray_format_into_obj);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJARRAY_H
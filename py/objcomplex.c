@@ -60,16 +60,17 @@ static void complex_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_
     char buf[32];
     const int precision = 16;
     #endif
+    // CIRCUITPY-CHANGE: shortest round trip digits, where supported
     if (o->real == 0) {
-        mp_format_float(o->imag, buf, sizeof(buf), 'g', precision, '\0');
+        mp_format_float(o->imag, buf, sizeof(buf), MP_FLOAT_REPR_FMT, precision, '\0');
         mp_printf(print, "%sj", buf);
     } else {
-        mp_format_float(o->real, buf, sizeof(buf), 'g', precision, '\0');
+        mp_format_float(o->real, buf, sizeof(buf), MP_FLOAT_REPR_FMT, precision, '\0');
         mp_printf(print, "(%s", buf);
         if (o->imag >= 0 || isnan(o->imag)) {
             mp_print_str(print, "+");
         }
-        mp_format_float(o->imag, buf, sizeof(buf), 'g', precision, '\0');
+        mp_format_float(o->imag, buf, sizeof(buf), MP_FLOAT_REPR_FMT, precision, '\0');
         mp_printf(print, "%sj)", buf);
     }
 }
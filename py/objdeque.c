@@ -24,9 +24,14 @@
  * THE SOFTWARE.
  */
 
+// CIRCUITPY-CHANGE
+#include <string.h>
 #include <unistd.h> // for ssize_t
 
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/binary.h"
+#include "py/smallint.h"
 
 #if MICROPY_PY_COLLECTIONS_DEQUE
 
@@ -38,8 +43,121 @@ typedef struct _mp_obj_deque_t {
     mp_obj_t *items;
     uint32_t flags;
     #define FLAG_CHECK_OVERFLOW 1
+    // CIRCUITPY-CHANGE: typed storage
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    // 0 when items holds objects, or the array typecode of the raw numbers it
+    // holds instead.
+    char typecode;
+    uint8_t itemsize;
+    // The sum of the items, kept up to date as they are added and removed. A
+    // float sum is recomputed once as many items as the deque holds have been
+    // removed, so that rounding errors don't build up.
+    size_t removed;
+    unsigned long long isum;
+    mp_float_t fsum;
+    #endif
 } mp_obj_deque_t;
 
+// CIRCUITPY-CHANGE: typed storage
+#if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+
+static bool deque_is_float(mp_obj_deque_t *self) {
+    return self->typecode == 'f' || self->typecode == 'd';
+}
+
+static byte *deque_item_ptr(mp_obj_deque_t *self, size_t i) {
+    return (byte *)self->items + i * self->itemsize;
+}
+
+static long long deque_item_int(mp_obj_deque_t *self, size_t i) {
+    return mp_binary_get_int(self->itemsize, self->typecode >= 'a', MP_ENDIANNESS_BIG, deque_item_ptr(self, i));
+}
+
+static mp_float_t deque_item_float(mp_obj_deque_t *self, size_t i) {
+    if (self->typecode == 'f') {
+        return ((float *)self->items)[i];
+    } else if (self->typecode == 'd') {
+        return (mp_float_t)((double *)self->items)[i];
+    }
+    return (mp_float_t)deque_item_int(self, i);
+}
+
+static void deque_sum_add(mp_obj_deque_t *self, size_t i) {
+    if (deque_is_float(self)) {
+        self->fsum += deque_item_float(self, i);
+    } else {
+        self->isum += deque_item_int(self, i);
+    }
+}
+
+static void deque_sum_recompute(mp_obj_deque_t *self) {
+    self->fsum = 0;
+    for (size_t i = self->i_get; i != self->i_put; i = i + 1 == self->alloc ? 0 : i + 1) {
+        self->fsum += deque_item_float(self, i);
+    }
+    self->removed = 0;
+}
+
+static void deque_sum_remove(mp_obj_deque_t *self, size_t i) {
+    if (deque_is_float(self)) {
+        self->fsum -= deque_item_float(self, i);
+        self->removed++;
+    } else {
+        self->isum -= deque_item_int(self, i);
+    }
+}
+
+#endif
+
+// CIRCUITPY-CHANGE: items are accessed through these, for typed storage.
+static mp_obj_t deque_get(mp_obj_deque_t *self, size_t i) {
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    if (self->typecode != 0) {
+        return mp_binary_get_val_array(self->typecode, self->items, i);
+    }
+    #endif
+    return self->items[i];
+}
+
+// Stores into a free slot.
+static void deque_set(mp_obj_deque_t *self, size_t i, mp_obj_t value) {
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    if (self->typecode != 0) {
+        mp_binary_set_val_array(self->typecode, self->items, i, value);
+        deque_sum_add(self, i);
+        return;
+    }
+    #endif
+    self->items[i] = value;
+}
+
+// Replaces the item in a slot that is in use.
+static void deque_replace(mp_obj_deque_t *self, size_t i, mp_obj_t value) {
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    if (self->typecode != 0) {
+        // Convert first, so that nothing changes if that raises.
+        long long raw;
+        mp_binary_set_val_array(self->typecode, &raw, 0, value);
+        deque_sum_remove(self, i);
+        memcpy(deque_item_ptr(self, i), &raw, self->itemsize);
+        deque_sum_add(self, i);
+        return;
+    }
+    #endif
+    self->items[i] = value;
+}
+
+// Frees a slot.
+static void deque_free_slot(mp_obj_deque_t *self, size_t i) {
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    if (self->typecode != 0) {
+        deque_sum_remove(self, i);
+        return;
+    }
+    #endif
+    self->items[i] = MP_OBJ_NULL;
+}
+
 static mp_obj_t mp_obj_deque_append(mp_obj_t self_in, mp_obj_t arg);
 static mp_obj_t mp_obj_deque_extend(mp_obj_t self_in, mp_obj_t arg_in);
 #if MICROPY_PY_COLLECTIONS_DEQUE_ITER
@@ -47,10 +165,35 @@ static mp_obj_t mp_obj_new_deque_it(mp_obj_t deque, mp_obj_iter_buf_t *iter_buf)
 #endif
 
 static mp_obj_t deque_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    // CIRCUITPY-CHANGE: typecode
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    enum { ARG_iterable, ARG_maxlen, ARG_flags, ARG_typecode };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_iterable, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_maxlen, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_flags, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_typecode, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t parsed[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, args, MP_ARRAY_SIZE(allowed_args), allowed_args, parsed);
+    mp_int_t maxlen = parsed[ARG_maxlen].u_int;
+    mp_obj_t iterable = parsed[ARG_iterable].u_obj;
+    char typecode = 0;
+    if (parsed[ARG_typecode].u_obj != mp_const_none) {
+        size_t len;
+        const char *tc = mp_obj_str_get_data(parsed[ARG_typecode].u_obj, &len);
+        if (len != 1 || *tc == '\0' || strchr("bBhHiIlLqQfd", *tc) == NULL) {
+            mp_raise_ValueError(MP_ERROR_TEXT("bad typecode"));
+        }
+        typecode = *tc;
+    }
+    #else
     mp_arg_check_num(n_args, n_kw, 2, 3, false);
+    mp_int_t maxlen = mp_obj_get_int(args[1]);
+    mp_obj_t iterable = args[0];
+    #endif
 
     // Protect against -1 leading to zero-length allocation and bad array access
-    mp_int_t maxlen = mp_obj_get_int(args[1]);
     if (maxlen < 0) {
         mp_raise_ValueError(NULL);
     }
@@ -58,13 +201,28 @@ static mp_obj_t deque_make_new(const mp_obj_type_t *type, size_t n_args, size_t
     mp_obj_deque_t *o = mp_obj_malloc(mp_obj_deque_t, type);
     o->alloc = maxlen + 1;
     o->i_get = o->i_put = 0;
+    // CIRCUITPY-CHANGE: typed storage
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    o->flags = parsed[ARG_flags].u_int;
+    o->typecode = typecode;
+    o->removed = 0;
+    o->isum = 0;
+    o->fsum = 0;
+    if (typecode != 0) {
+        o->itemsize = mp_binary_get_size('@', typecode, NULL);
+        o->items = (mp_obj_t *)m_new_noscan(byte, o->alloc * o->itemsize);
+    } else {
+        o->items = m_new0(mp_obj_t, o->alloc);
+    }
+    #else
     o->items = m_new0(mp_obj_t, o->alloc);
 
     if (n_args > 2) {
         o->flags = mp_obj_get_int(args[2]);
     }
+    #endif
 
-    mp_obj_deque_extend(MP_OBJ_FROM_PTR(o), args[0]);
+    mp_obj_deque_extend(MP_OBJ_FROM_PTR(o), iterable);
 
     return MP_OBJ_FROM_PTR(o);
 }
@@ -88,6 +246,12 @@ static mp_obj_t deque_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
         #if MICROPY_PY_SYS_GETSIZEOF
         case MP_UNARY_OP_SIZEOF: {
             size_t sz = sizeof(*self) + sizeof(mp_obj_t) * self->alloc;
+            // CIRCUITPY-CHANGE
+            #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+            if (self->typecode != 0) {
+                sz = sizeof(*self) + self->itemsize * self->alloc;
+            }
+            #endif
             return MP_OBJ_NEW_SMALL_INT(sz);
         }
         #endif
@@ -108,10 +272,12 @@ static mp_obj_t mp_obj_deque_append(mp_obj_t self_in, mp_obj_t arg) {
         mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("full"));
     }
 
-    self->items[self->i_put] = arg;
+    // CIRCUITPY-CHANGE
+    deque_set(self, self->i_put, arg);
     self->i_put = new_i_put;
 
     if (self->i_get == new_i_put) {
+        deque_free_slot(self, self->i_get);
         if (++self->i_get == self->alloc) {
             self->i_get = 0;
         }
@@ -134,7 +300,8 @@ static mp_obj_t mp_obj_deque_appendleft(mp_obj_t self_in, mp_obj_t arg) {
     }
 
     self->i_get = new_i_get;
-    self->items[self->i_get] = arg;
+    // CIRCUITPY-CHANGE
+    deque_set(self, self->i_get, arg);
 
     // overwriting first element in deque
     if (self->i_put == new_i_get) {
@@ -143,13 +310,54 @@ static mp_obj_t mp_obj_deque_appendleft(mp_obj_t self_in, mp_obj_t arg) {
         } else {
             self->i_put--;
         }
+        // CIRCUITPY-CHANGE
+        deque_free_slot(self, self->i_put);
     }
 
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(deque_appendleft_obj, mp_obj_deque_appendleft);
 
+// CIRCUITPY-CHANGE: bulk copies for typed storage
+#if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+static void deque_extend_raw(mp_obj_deque_t *self, const byte *src, size_t n) {
+    if (!(self->flags & FLAG_CHECK_OVERFLOW) && n > self->alloc - 1) {
+        // Only the last maxlen items would remain.
+        src += (n - (self->alloc - 1)) * self->itemsize;
+        n = self->alloc - 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        size_t new_i_put = self->i_put + 1;
+        if (new_i_put == self->alloc) {
+            new_i_put = 0;
+        }
+        if (self->flags & FLAG_CHECK_OVERFLOW && new_i_put == self->i_get) {
+            mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("full"));
+        }
+        memcpy(deque_item_ptr(self, self->i_put), src + i * self->itemsize, self->itemsize);
+        deque_sum_add(self, self->i_put);
+        self->i_put = new_i_put;
+        if (self->i_get == new_i_put) {
+            deque_free_slot(self, self->i_get);
+            if (++self->i_get == self->alloc) {
+                self->i_get = 0;
+            }
+        }
+    }
+}
+#endif
+
 static mp_obj_t mp_obj_deque_extend(mp_obj_t self_in, mp_obj_t arg_in) {
+    // CIRCUITPY-CHANGE: copy numbers of the same type without boxing them
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    if (self->typecode != 0 && !mp_obj_is_str(arg_in) && mp_get_buffer(arg_in, &bufinfo, MP_BUFFER_READ) &&
+        (bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode) == self->typecode) {
+        deque_extend_raw(self, bufinfo.buf, bufinfo.len / self->itemsize);
+        return mp_const_none;
+    }
+    #endif
     mp_obj_iter_buf_t iter_buf;
     mp_obj_t iter = mp_getiter(arg_in, &iter_buf);
     mp_obj_t item;
@@ -167,8 +375,9 @@ static mp_obj_t deque_popleft(mp_obj_t self_in) {
         mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty"));
     }
 
-    mp_obj_t ret = self->items[self->i_get];
-    self->items[self->i_get] = MP_OBJ_NULL;
+    // CIRCUITPY-CHANGE
+    mp_obj_t ret = deque_get(self, self->i_get);
+    deque_free_slot(self, self->i_get);
 
     if (++self->i_get == self->alloc) {
         self->i_get = 0;
@@ -191,8 +400,9 @@ static mp_obj_t deque_pop(mp_obj_t self_in) {
         self->i_put--;
     }
 
-    mp_obj_t ret = self->items[self->i_put];
-    self->items[self->i_put] = MP_OBJ_NULL;
+    // CIRCUITPY-CHANGE
+    mp_obj_t ret = deque_get(self, self->i_put);
+    deque_free_slot(self, self->i_put);
 
     return ret;
 }
@@ -208,21 +418,121 @@ static mp_obj_t deque_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
 
     size_t offset = mp_get_index(self->base.type, deque_len(self), index, false);
     size_t index_val = self->i_get + offset;
-    if (index_val > self->alloc) {
+    // CIRCUITPY-CHANGE: index alloc wraps to 0 too
+    if (index_val >= self->alloc) {
         index_val -= self->alloc;
     }
 
     if (value == MP_OBJ_SENTINEL) {
         // load
-        return self->items[index_val];
+        // CIRCUITPY-CHANGE
+        return deque_get(self, index_val);
     } else {
         // store into deque
-        self->items[index_val] = value;
+        // CIRCUITPY-CHANGE
+        deque_replace(self, index_val, value);
         return mp_const_none;
     }
 }
 #endif
 
+// CIRCUITPY-CHANGE: bulk copies and statistics
+#if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+static mp_obj_t deque_copy_into(mp_obj_t self_in, mp_obj_t buf_in) {
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    char typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode;
+    size_t itemsize = mp_binary_get_size('@', typecode, NULL);
+    size_t n = MIN(deque_len(self), bufinfo.len / itemsize);
+    if (typecode == self->typecode) {
+        // At most two pieces, either side of the end of the ring.
+        size_t first = MIN(n, self->alloc - self->i_get);
+        memcpy(bufinfo.buf, deque_item_ptr(self, self->i_get), first * itemsize);
+        memcpy((byte *)bufinfo.buf + first * itemsize, self->items, (n - first) * itemsize);
+    } else {
+        size_t i = self->i_get;
+        for (size_t j = 0; j < n; j++) {
+            mp_binary_set_val_array(typecode, bufinfo.buf, j, deque_get(self, i));
+            if (++i == self->alloc) {
+                i = 0;
+            }
+        }
+    }
+    return MP_OBJ_NEW_SMALL_INT(n);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(deque_copy_into_obj, deque_copy_into);
+
+static mp_obj_deque_t *deque_get_typed(mp_obj_t self_in, bool nonempty) {
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->typecode == 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_typecode);
+    }
+    if (nonempty && self->i_get == self->i_put) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty"));
+    }
+    return self;
+}
+
+static mp_float_t deque_fsum(mp_obj_deque_t *self) {
+    if (self->removed >= self->alloc) {
+        deque_sum_recompute(self);
+    }
+    return self->fsum;
+}
+
+static mp_obj_t deque_sum(mp_obj_t self_in) {
+    mp_obj_deque_t *self = deque_get_typed(self_in, false);
+    if (deque_is_float(self)) {
+        return mp_obj_new_float(deque_fsum(self));
+    }
+    long long sum = (long long)self->isum;
+    if (sum >= MP_SMALL_INT_MIN && sum <= MP_SMALL_INT_MAX) {
+        return MP_OBJ_NEW_SMALL_INT(sum);
+    }
+    return mp_obj_new_int_from_ll(sum);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(deque_sum_obj, deque_sum);
+
+static mp_obj_t deque_mean(mp_obj_t self_in) {
+    mp_obj_deque_t *self = deque_get_typed(self_in, true);
+    mp_float_t sum = deque_is_float(self) ? deque_fsum(self) : (mp_float_t)(long long)self->isum;
+    return mp_obj_new_float(sum / deque_len(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(deque_mean_obj, deque_mean);
+
+static mp_obj_t deque_min_max(mp_obj_t self_in, bool max) {
+    mp_obj_deque_t *self = deque_get_typed(self_in, true);
+    size_t best = self->i_get;
+    for (size_t i = best; i != self->i_put; i = i + 1 == self->alloc ? 0 : i + 1) {
+        bool better;
+        if (deque_is_float(self)) {
+            mp_float_t x = deque_item_float(self, i);
+            mp_float_t y = deque_item_float(self, best);
+            better = max ? x > y : x < y;
+        } else {
+            long long x = deque_item_int(self, i);
+            long long y = deque_item_int(self, best);
+            better = max ? x > y : x < y;
+        }
+        if (better) {
+            best = i;
+        }
+    }
+    return deque_get(self, best);
+}
+
+static mp_obj_t deque_min(mp_obj_t self_in) {
+    return deque_min_max(self_in, false);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(deque_min_obj, deque_min);
+
+static mp_obj_t deque_max(mp_obj_t self_in) {
+    return deque_min_max(self_in, true);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(deque_max_obj, deque_max);
+#endif
+
 #if 0
 static mp_obj_t deque_clear(mp_obj_t self_in) {
     mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
@@ -242,6 +552,14 @@ static const mp_rom_map_elem_t deque_locals_dict_table[] = {
     #endif
     { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&deque_pop_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&deque_popleft_obj) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_COLLECTIONS_DEQUE_TYPED
+    { MP_ROM_QSTR(MP_QSTR_copy_into), MP_ROM_PTR(&deque_copy_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&deque_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&deque_mean_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&deque_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&deque_max_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(deque_locals_dict, deque_locals_dict_table);
@@ -287,7 +605,8 @@ static mp_obj_t deque_it_iternext(mp_obj_t self_in) {
     mp_obj_deque_it_t *self = MP_OBJ_TO_PTR(self_in);
     mp_obj_deque_t *deque = MP_OBJ_TO_PTR(self->deque);
     if (self->cur != deque->i_put) {
-        mp_obj_t o_out = deque->items[self->cur];
+        // CIRCUITPY-CHANGE
+        mp_obj_t o_out = deque_get(deque, self->cur);
         if (++self->cur == deque->alloc) {
             self->cur = 0;
         }
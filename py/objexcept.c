@@ -642,6 +642,13 @@ void mp_obj_exception_clear_traceback(mp_obj_t self_in) {
 void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qstr block) {
     mp_obj_exception_t *self = mp_obj_exception_get_native(self_in);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_STOP_ITERATION_NO_TRACEBACK
+    if (self->base.type == &mp_type_StopIteration) {
+        return;
+    }
+    #endif
+
     // append this traceback info to traceback data
     // if memory allocation fails (eg because gc is locked), just return
 
@@ -79,7 +79,9 @@ mp_int_t mp_float_hash(mp_float_t src) {
     const int adj_exp = (int)u.p.exp - MP_FLOAT_EXP_BIAS;
     if (adj_exp < 0) {
         // value < 1; must be sure to handle 0.0 correctly (ie return 0)
-        val = u.i;
+        // CIRCUITPY-CHANGE: leave out the sign bit, which is applied below,
+        // so that -0.0 also hashes to 0 when mp_int_t is wider than the float.
+        val = u.i & ~((mp_float_uint_t)1 << (MP_FLOAT_EXP_BITS + MP_FLOAT_FRAC_BITS));
     } else {
         // if adj_exp is max then: u.p.frc==0 indicates inf, else NaN
         // else: 1 <= value
@@ -120,7 +122,8 @@ static void float_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t
     char buf[32];
     const int precision = 16;
     #endif
-    mp_format_float(o_val, buf, sizeof(buf), 'g', precision, '\0');
+    // CIRCUITPY-CHANGE: shortest round trip digits, where supported
+    mp_format_float(o_val, buf, sizeof(buf), MP_FLOAT_REPR_FMT, precision, '\0');
     mp_print_str(print, buf);
     if (strchr(buf, '.') == NULL && strchr(buf, 'e') == NULL && strchr(buf, 'n') == NULL) {
         // Python floats always have decimal point (unless inf or nan)
@@ -34,6 +34,11 @@
 #include "py/bc.h"
 #include "py/stackctrl.h"
 
+// CIRCUITPY-CHANGE
+#if CIRCUITPY_USTACK
+#include "shared-module/ustack/__init__.h"
+#endif
+
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
 #else // don't print debugging info
@@ -266,6 +271,11 @@ static mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
 
     INIT_CODESTATE(code_state, self, n_state, n_args, n_kw, args);
 
+    // CIRCUITPY-CHANGE
+    #if CIRCUITPY_USTACK
+    ustack_track_call(self);
+    #endif
+
     // execute the byte code with the correct globals context
     mp_globals_set(self->context->module.globals);
     mp_vm_return_kind_t vm_return_kind = mp_execute_bytecode(code_state, MP_OBJ_NULL);
@@ -27,6 +27,7 @@
 
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "py/bc.h"
@@ -34,6 +35,8 @@
 #include "py/objgenerator.h"
 #include "py/objfun.h"
 #include "py/stackctrl.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 // Instance of GeneratorExit exception - needed by generator.close()
 // CIRCUITPY-CHANGE: https://github.com/adafruit/circuitpython/pull/7069 fix
@@ -54,35 +57,101 @@ typedef struct _mp_obj_gen_instance_t {
     // MP_OBJ_NULL: Running, no exception.
     // other: Not running, pending exception.
     mp_obj_t pend_exc;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    struct _mp_obj_fun_bc_t *fun_bc;
+    // The state, in a frame of its own so that it can be reused once the
+    // generator finishes, or NULL when finished.
+    mp_code_state_t *frame;
+    #else
     mp_code_state_t code_state;
+    #endif
 } mp_obj_gen_instance_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_GENERATOR_FRAME_POOL
+
+#define GEN_FUN_BC(self) ((self)->fun_bc)
+
+#define GEN_FRAME_BLOCKS(n_bytes) (((n_bytes) + MICROPY_BYTES_PER_GC_BLOCK - 1) / MICROPY_BYTES_PER_GC_BLOCK)
+
+static size_t gen_frame_size(const mp_obj_fun_bc_t *fun) {
+    const uint8_t *ip = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    return sizeof(mp_code_state_t) + n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t);
+}
+
+static mp_code_state_t *gen_frame_new(size_t n_bytes) {
+    size_t i = GEN_FRAME_BLOCKS(n_bytes) - 1;
+    // A pooled frame isn't taken while the heap is locked, when allocating
+    // would fail.
+    if (i < MICROPY_PY_GENERATOR_FRAME_POOL_SIZES && MP_STATE_VM(gen_frame_pool)[i] != NULL && !gc_is_locked()) {
+        mp_code_state_t *frame = MP_STATE_VM(gen_frame_pool)[i];
+        MP_STATE_VM(gen_frame_pool)[i] = (mp_code_state_t *)frame->fun_bc;
+        MP_STATE_VM(gen_frame_pool_len)[i]--;
+        // Cleared like a new allocation, so that the GC doesn't find stale
+        // pointers in it.
+        memset(frame, 0, (i + 1) * MICROPY_BYTES_PER_GC_BLOCK);
+        return frame;
+    }
+    return m_malloc(n_bytes);
+}
+
+static void gen_frame_free(mp_code_state_t *frame) {
+    size_t n_bytes = gen_frame_size(frame->fun_bc);
+    size_t i = GEN_FRAME_BLOCKS(n_bytes) - 1;
+    if (i < MICROPY_PY_GENERATOR_FRAME_POOL_SIZES && MP_STATE_VM(gen_frame_pool_len)[i] < MICROPY_PY_GENERATOR_FRAME_POOL_DEPTH) {
+        frame->fun_bc = (mp_obj_fun_bc_t *)MP_STATE_VM(gen_frame_pool)[i];
+        MP_STATE_VM(gen_frame_pool)[i] = frame;
+        MP_STATE_VM(gen_frame_pool_len)[i]++;
+    } else {
+        // Nothing else refers to it, so it can go back to the heap now.
+        m_del(byte, frame, n_bytes);
+    }
+}
+
+#else
+
+#define GEN_FUN_BC(self) ((self)->code_state.fun_bc)
+
+#endif
+
 static mp_obj_t gen_wrap_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     // CIRCUITPY-CHANGE
     // A generating or coroutine function is just a bytecode function
     // with type mp_type_gen_wrap or mp_type_coro_wrap.
     mp_obj_fun_bc_t *self_fun = MP_OBJ_TO_PTR(self_in);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_ASYNC_AWAIT
+    const mp_obj_type_t *type = self_fun->base.type == &mp_type_gen_wrap ? &mp_type_gen_instance : &mp_type_coro_instance;
+    #else
+    const mp_obj_type_t *type = &mp_type_gen_instance;
+    #endif
+
     // bytecode prelude: get state size and exception stack size
     const uint8_t *ip = self_fun->bytecode;
     MP_BC_PRELUDE_SIG_DECODE(ip);
 
     // CIRCUITPY-CHANGE
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    // allocate the generator or coroutine object, and a frame for the local
+    // stack and exception stack
+    mp_obj_gen_instance_t *o = mp_obj_malloc(mp_obj_gen_instance_t, type);
+    o->fun_bc = self_fun;
+    o->frame = gen_frame_new(sizeof(mp_code_state_t) + n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t));
+    mp_code_state_t *code_state = o->frame;
+    #else
     // allocate the generator or coroutine object, with room for local stack and exception stack
     mp_obj_gen_instance_t *o = mp_obj_malloc_var(mp_obj_gen_instance_t, code_state.state, byte,
-        n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t),
-        // CIRCUITPY-CHANGE
-        #if MICROPY_PY_ASYNC_AWAIT
-        self_fun->base.type == &mp_type_gen_wrap ? &mp_type_gen_instance : &mp_type_coro_instance
-        #else
-        &mp_type_gen_instance
-        #endif
-        );
+        n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t), type);
+    mp_code_state_t *code_state = &o->code_state;
+    #endif
 
     o->pend_exc = mp_const_none;
-    o->code_state.fun_bc = self_fun;
-    o->code_state.n_state = n_state;
-    mp_setup_code_state(&o->code_state, n_args, n_kw, args);
+    code_state->fun_bc = self_fun;
+    code_state->n_state = n_state;
+    mp_setup_code_state(code_state, n_args, n_kw, args);
     return MP_OBJ_FROM_PTR(o);
 }
 
@@ -120,6 +189,11 @@ MP_DEFINE_CONST_OBJ_TYPE(
 typedef struct _mp_obj_gen_instance_native_t {
     mp_obj_base_t base;
     mp_obj_t pend_exc;
+    // CIRCUITPY-CHANGE: the frame always points at code_state
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    struct _mp_obj_fun_bc_t *fun_bc;
+    mp_code_state_t *frame;
+    #endif
     mp_code_state_native_t code_state;
 } mp_obj_gen_instance_native_t;
 
@@ -156,6 +230,12 @@ static mp_obj_t native_gen_wrap_call(mp_obj_t self_in, size_t n_args, size_t n_k
     // Prepare the generator instance for execution
     o->code_state.ip = mp_obj_fun_native_get_generator_start(self_fun);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    o->fun_bc = self_fun;
+    o->frame = (mp_code_state_t *)&o->code_state;
+    #endif
+
     return MP_OBJ_FROM_PTR(o);
 }
 
@@ -192,7 +272,7 @@ MP_DEFINE_CONST_OBJ_TYPE(
 static void gen_instance_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_gen_instance_t *self = MP_OBJ_TO_PTR(self_in);
-    mp_printf(print, "<generator object '%q' at %p>", mp_obj_fun_get_name(MP_OBJ_FROM_PTR(self->code_state.fun_bc)), self);
+    mp_printf(print, "<generator object '%q' at %p>", mp_obj_fun_get_name(MP_OBJ_FROM_PTR(GEN_FUN_BC(self))), self);
 }
 
 // CIRCUITPY-CHANGE
@@ -200,10 +280,25 @@ static void gen_instance_print(const mp_print_t *print, mp_obj_t self_in, mp_pri
 static void coro_instance_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_gen_instance_t *self = MP_OBJ_TO_PTR(self_in);
-    mp_printf(print, "<coroutine object '%q' at %p>", mp_obj_fun_get_name(MP_OBJ_FROM_PTR(self->code_state.fun_bc)), self);
+    mp_printf(print, "<coroutine object '%q' at %p>", mp_obj_fun_get_name(MP_OBJ_FROM_PTR(GEN_FUN_BC(self))), self);
 }
 #endif
 
+// CIRCUITPY-CHANGE
+static void gen_finished(mp_obj_gen_instance_t *self, mp_code_state_t *code_state) {
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    self->frame = NULL;
+    // Only the generator refers to the frame of a bytecode generator. A native
+    // generator's state is part of the generator object.
+    if (code_state->exc_sp_idx != MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
+        gen_frame_free(code_state);
+    }
+    #else
+    (void)self;
+    code_state->ip = 0;
+    #endif
+}
+
 mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_obj_t throw_value, mp_obj_t *ret_val) {
     MP_STACK_CHECK();
     // CIRCUITPY-CHANGE
@@ -216,7 +311,14 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
         #endif
         );
     mp_obj_gen_instance_t *self = MP_OBJ_TO_PTR(self_in);
-    if (self->code_state.ip == 0) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    mp_code_state_t *code_state = self->frame;
+    if (code_state == NULL) {
+    #else
+    mp_code_state_t *code_state = &self->code_state;
+    if (code_state->ip == 0) {
+    #endif
         // Trying to resume an already stopped generator.
         // This is an optimised "raise StopIteration(None)".
         *ret_val = mp_const_none;
@@ -236,43 +338,43 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
     #endif
 
     // If the generator is started, allow sending a value.
-    void *state_start = self->code_state.state - 1;
+    void *state_start = code_state->state - 1;
     #if MICROPY_EMIT_NATIVE
-    if (self->code_state.exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
-        state_start = ((mp_obj_gen_instance_native_t *)self)->code_state.state - 1;
+    if (code_state->exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
+        state_start = ((mp_code_state_native_t *)code_state)->state - 1;
     }
     #endif
-    if (self->code_state.sp == state_start) {
+    if (code_state->sp == state_start) {
         if (send_value != mp_const_none) {
             mp_raise_TypeError(MP_ERROR_TEXT("can't send non-None value to a just-started generator"));
         }
     } else {
-        *self->code_state.sp = send_value;
+        *code_state->sp = send_value;
     }
 
     // Mark as running
     self->pend_exc = MP_OBJ_NULL;
 
     // Set up the correct globals context for the generator and execute it
-    self->code_state.old_globals = mp_globals_get();
-    mp_globals_set(self->code_state.fun_bc->context->module.globals);
+    code_state->old_globals = mp_globals_get();
+    mp_globals_set(code_state->fun_bc->context->module.globals);
 
     mp_vm_return_kind_t ret_kind;
 
     #if MICROPY_EMIT_NATIVE
-    if (self->code_state.exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
+    if (code_state->exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
         // A native generator.
         typedef uintptr_t (*mp_fun_native_gen_t)(void *, mp_obj_t);
-        mp_fun_native_gen_t fun = mp_obj_fun_native_get_generator_resume(self->code_state.fun_bc);
-        ret_kind = fun((void *)&self->code_state, throw_value);
+        mp_fun_native_gen_t fun = mp_obj_fun_native_get_generator_resume(code_state->fun_bc);
+        ret_kind = fun((void *)code_state, throw_value);
     } else
     #endif
     {
         // A bytecode generator
-        ret_kind = mp_execute_bytecode(&self->code_state, throw_value);
+        ret_kind = mp_execute_bytecode(code_state, throw_value);
     }
 
-    mp_globals_set(self->code_state.old_globals);
+    mp_globals_set(code_state->old_globals);
 
     // Mark as not running
     self->pend_exc = mp_const_none;
@@ -280,31 +382,31 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
     switch (ret_kind) {
         case MP_VM_RETURN_NORMAL:
         default:
+            // This is an optimised "raise StopIteration(*ret_val)".
+            *ret_val = *code_state->sp;
             // Explicitly mark generator as completed. If we don't do this,
             // subsequent next() may re-execute statements after last yield
             // again and again, leading to side effects.
-            self->code_state.ip = 0;
-            // This is an optimised "raise StopIteration(*ret_val)".
-            *ret_val = *self->code_state.sp;
+            gen_finished(self, code_state);
             break;
 
         case MP_VM_RETURN_YIELD:
-            *ret_val = *self->code_state.sp;
+            *ret_val = *code_state->sp;
             #if MICROPY_PY_GENERATOR_PEND_THROW
-            *self->code_state.sp = mp_const_none;
+            *code_state->sp = mp_const_none;
             #endif
             break;
 
         case MP_VM_RETURN_EXCEPTION: {
-            self->code_state.ip = 0;
             #if MICROPY_EMIT_NATIVE
-            if (self->code_state.exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
-                *ret_val = ((mp_obj_gen_instance_native_t *)self)->code_state.state[0];
+            if (code_state->exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
+                *ret_val = ((mp_code_state_native_t *)code_state)->state[0];
             } else
             #endif
             {
-                *ret_val = self->code_state.state[0];
+                *ret_val = code_state->state[0];
             }
+            gen_finished(self, code_state);
             // PEP479: if StopIteration is raised inside a generator it is replaced with RuntimeError
             if (mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(*ret_val)), MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
                 *ret_val = mp_obj_new_exception_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("generator raised StopIteration"));
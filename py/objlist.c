@@ -311,6 +311,321 @@ static mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return mp_obj_list_pop(self, index);
 }
 
+// CIRCUITPY-CHANGE: stable merge sort
+#if MICROPY_PY_LIST_SORT_STABLE
+
+// A simplified Timsort. Runs already in order are found and merged, so sorted
+// and reverse sorted input takes linear time, and the key function is called
+// once per item.
+
+// Enough runs for any list that fits in memory, given how merge_collapse()
+// keeps their lengths growing.
+#define SORT_MAX_RUNS (sizeof(size_t) == 4 ? 40 : 85)
+
+typedef struct {
+    // What is compared, and the list items moved along with them, or NULL
+    // when the items are compared directly.
+    mp_obj_t *keys;
+    mp_obj_t *items;
+    // Space for the shorter of two runs being merged, keys then items. NULL
+    // if it couldn't be allocated, and then merges are done in place.
+    mp_obj_t *tmp_keys;
+    mp_obj_t *tmp_items;
+    bool tmp_tried;
+    bool reverse;
+    size_t n_runs;
+    size_t run_base[SORT_MAX_RUNS];
+    size_t run_len[SORT_MAX_RUNS];
+} sort_state_t;
+
+static bool sort_less(sort_state_t *ss, mp_obj_t a, mp_obj_t b) {
+    if (ss->reverse) {
+        // Equal items keep their order, as in CPython.
+        mp_obj_t t = a;
+        a = b;
+        b = t;
+    }
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a, b));
+}
+
+static inline void sort_move(sort_state_t *ss, size_t dest, size_t src) {
+    ss->keys[dest] = ss->keys[src];
+    if (ss->items != NULL) {
+        ss->items[dest] = ss->items[src];
+    }
+}
+
+static void sort_reverse(sort_state_t *ss, size_t lo, size_t hi) {
+    while (lo + 1 < hi) {
+        hi--;
+        mp_obj_t t = ss->keys[lo];
+        ss->keys[lo] = ss->keys[hi];
+        ss->keys[hi] = t;
+        if (ss->items != NULL) {
+            t = ss->items[lo];
+            ss->items[lo] = ss->items[hi];
+            ss->items[hi] = t;
+        }
+        lo++;
+    }
+}
+
+// The first index in [lo, hi) whose key is greater than key, or with
+// or_equal, not less than key.
+static size_t sort_search(sort_state_t *ss, mp_obj_t key, size_t lo, size_t hi, bool or_equal) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (or_equal ? !sort_less(ss, ss->keys[mid], key) : sort_less(ss, key, ss->keys[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Sorts [lo, hi), of which [lo, start) is already sorted.
+static void sort_insertion(sort_state_t *ss, size_t lo, size_t start, size_t hi) {
+    for (size_t i = start; i < hi; i++) {
+        mp_obj_t key = ss->keys[i];
+        mp_obj_t item = ss->items != NULL ? ss->items[i] : MP_OBJ_NULL;
+        // Nothing moves until the search is done, in case a comparison raises.
+        size_t pos = sort_search(ss, key, lo, i, false);
+        for (size_t j = i; j > pos; j--) {
+            sort_move(ss, j, j - 1);
+        }
+        ss->keys[pos] = key;
+        if (ss->items != NULL) {
+            ss->items[pos] = item;
+        }
+    }
+}
+
+// Returns the length of the run starting at lo, after putting it in order if
+// it was strictly descending.
+static size_t sort_count_run(sort_state_t *ss, size_t lo, size_t hi) {
+    size_t i = lo + 1;
+    if (i == hi) {
+        return 1;
+    }
+    if (sort_less(ss, ss->keys[i], ss->keys[lo])) {
+        while (++i < hi && sort_less(ss, ss->keys[i], ss->keys[i - 1])) {
+        }
+        sort_reverse(ss, lo, i);
+    } else {
+        while (++i < hi && !sort_less(ss, ss->keys[i], ss->keys[i - 1])) {
+        }
+    }
+    return i - lo;
+}
+
+// Rotates [lo, hi) so that mid comes first.
+static void sort_rotate(sort_state_t *ss, size_t lo, size_t mid, size_t hi) {
+    sort_reverse(ss, lo, mid);
+    sort_reverse(ss, mid, hi);
+    sort_reverse(ss, lo, hi);
+}
+
+// Merges [lo, mid) and [mid, hi) without extra memory, by rotation.
+static void sort_merge_in_place(sort_state_t *ss, size_t lo, size_t mid, size_t hi) {
+    MP_STACK_CHECK();
+    while (lo < mid && mid < hi) {
+        if (hi - lo == 2) {
+            if (sort_less(ss, ss->keys[mid], ss->keys[lo])) {
+                sort_reverse(ss, lo, hi);
+            }
+            return;
+        }
+        size_t cut_a, cut_b;
+        if (mid - lo > hi - mid) {
+            cut_a = lo + (mid - lo) / 2;
+            cut_b = sort_search(ss, ss->keys[cut_a], mid, hi, true);
+        } else {
+            cut_b = mid + (hi - mid) / 2;
+            cut_a = sort_search(ss, ss->keys[cut_b], lo, mid, false);
+        }
+        sort_rotate(ss, cut_a, mid, cut_b);
+        size_t new_mid = cut_a + (cut_b - mid);
+        // Recurse on the smaller side, to keep the stack within O(log(N)).
+        if (new_mid - lo < hi - new_mid) {
+            sort_merge_in_place(ss, lo, cut_a, new_mid);
+            lo = new_mid;
+            mid = cut_b;
+        } else {
+            sort_merge_in_place(ss, new_mid, cut_b, hi);
+            hi = new_mid;
+            mid = cut_a;
+        }
+    }
+}
+
+static void sort_to_tmp(sort_state_t *ss, size_t src, size_t len) {
+    memcpy(ss->tmp_keys, ss->keys + src, len * sizeof(mp_obj_t));
+    if (ss->items != NULL) {
+        memcpy(ss->tmp_items, ss->items + src, len * sizeof(mp_obj_t));
+    }
+}
+
+static void sort_from_tmp(sort_state_t *ss, size_t dest, size_t src, size_t len) {
+    memcpy(ss->keys + dest, ss->tmp_keys + src, len * sizeof(mp_obj_t));
+    if (ss->items != NULL) {
+        memcpy(ss->items + dest, ss->tmp_items + src, len * sizeof(mp_obj_t));
+    }
+}
+
+// Merges [lo, mid) into tmp, with [mid, hi), working up. If a comparison
+// raises, what is left in tmp is copied back so that the list keeps every item.
+static void sort_merge_lo(sort_state_t *ss, size_t lo, size_t mid, size_t hi) {
+    size_t len_a = mid - lo;
+    sort_to_tmp(ss, lo, len_a);
+    volatile size_t a = 0;
+    volatile size_t b = mid;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        while (a < len_a && b < hi) {
+            // The next place to fill is b - (len_a - a).
+            if (sort_less(ss, ss->keys[b], ss->tmp_keys[a])) {
+                sort_move(ss, b - (len_a - a), b);
+                b++;
+            } else {
+                ss->keys[b - (len_a - a)] = ss->tmp_keys[a];
+                if (ss->items != NULL) {
+                    ss->items[b - (len_a - a)] = ss->tmp_items[a];
+                }
+                a++;
+            }
+        }
+        nlr_pop();
+        sort_from_tmp(ss, b - (len_a - a), a, len_a - a);
+    } else {
+        sort_from_tmp(ss, b - (len_a - a), a, len_a - a);
+        nlr_jump(nlr.ret_val);
+    }
+}
+
+// Merges [lo, mid) with [mid, hi) in tmp, working down.
+static void sort_merge_hi(sort_state_t *ss, size_t lo, size_t mid, size_t hi) {
+    sort_to_tmp(ss, mid, hi - mid);
+    volatile size_t na = mid - lo;
+    volatile size_t nb = hi - mid;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        while (na > 0 && nb > 0) {
+            // The next place to fill is lo + na + nb - 1.
+            if (sort_less(ss, ss->tmp_keys[nb - 1], ss->keys[lo + na - 1])) {
+                sort_move(ss, lo + na + nb - 1, lo + na - 1);
+                na--;
+            } else {
+                ss->keys[lo + na + nb - 1] = ss->tmp_keys[nb - 1];
+                if (ss->items != NULL) {
+                    ss->items[lo + na + nb - 1] = ss->tmp_items[nb - 1];
+                }
+                nb--;
+            }
+        }
+        nlr_pop();
+        sort_from_tmp(ss, lo + na, 0, nb);
+    } else {
+        sort_from_tmp(ss, lo + na, 0, nb);
+        nlr_jump(nlr.ret_val);
+    }
+}
+
+static void sort_merge(sort_state_t *ss, size_t len, size_t lo, size_t mid, size_t hi) {
+    // Items of the first run not greater than the start of the second, and of
+    // the second run less than the end of the first, are already in place.
+    lo = sort_search(ss, ss->keys[mid], lo, mid, false);
+    if (lo == mid) {
+        return;
+    }
+    hi = sort_search(ss, ss->keys[mid - 1], mid, hi, true);
+    if (hi == mid) {
+        return;
+    }
+    if (!ss->tmp_tried) {
+        // No merge needs more than half of the list.
+        ss->tmp_tried = true;
+        size_t tmp_len = len / 2;
+        ss->tmp_keys = m_new_maybe(mp_obj_t, ss->items != NULL ? 2 * tmp_len : tmp_len);
+        ss->tmp_items = ss->tmp_keys + tmp_len;
+    }
+    if (ss->tmp_keys == NULL) {
+        sort_merge_in_place(ss, lo, mid, hi);
+    } else if (mid - lo <= hi - mid) {
+        sort_merge_lo(ss, lo, mid, hi);
+    } else {
+        sort_merge_hi(ss, lo, mid, hi);
+    }
+}
+
+// Merges runs i and i + 1.
+static void sort_merge_at(sort_state_t *ss, size_t len, size_t i) {
+    size_t lo = ss->run_base[i];
+    size_t mid = lo + ss->run_len[i];
+    size_t hi = mid + ss->run_len[i + 1];
+    ss->run_len[i] += ss->run_len[i + 1];
+    if (i + 2 < ss->n_runs) {
+        ss->run_base[i + 1] = ss->run_base[i + 2];
+        ss->run_len[i + 1] = ss->run_len[i + 2];
+    }
+    ss->n_runs--;
+    sort_merge(ss, len, lo, mid, hi);
+}
+
+// Merges runs until each is longer than the next two together, so that there
+// are O(log(N)) of them and merges are balanced.
+static void sort_merge_collapse(sort_state_t *ss, size_t len) {
+    size_t *run_len = ss->run_len;
+    while (ss->n_runs > 1) {
+        size_t n = ss->n_runs - 2;
+        if ((n > 0 && run_len[n - 1] <= run_len[n] + run_len[n + 1]) ||
+            (n > 1 && run_len[n - 2] <= run_len[n - 1] + run_len[n])) {
+            if (run_len[n - 1] < run_len[n + 1]) {
+                n--;
+            }
+        } else if (run_len[n] > run_len[n + 1]) {
+            break;
+        }
+        sort_merge_at(ss, len, n);
+    }
+}
+
+static void mp_timsort(sort_state_t *ss, size_t len) {
+    // Runs shorter than this are extended by insertion sort. It is 32 to 64,
+    // and chosen so that len / min_run is a power of 2 or just under.
+    size_t min_run = len;
+    size_t r = 0;
+    while (min_run >= 64) {
+        r |= min_run & 1;
+        min_run >>= 1;
+    }
+    min_run += r;
+
+    ss->n_runs = 0;
+    for (size_t lo = 0; lo < len;) {
+        size_t run = sort_count_run(ss, lo, len);
+        if (run < min_run) {
+            size_t forced = MIN(min_run, len - lo);
+            sort_insertion(ss, lo, lo + run, lo + forced);
+            run = forced;
+        }
+        ss->run_base[ss->n_runs] = lo;
+        ss->run_len[ss->n_runs] = run;
+        ss->n_runs++;
+        sort_merge_collapse(ss, len);
+        lo += run;
+    }
+    while (ss->n_runs > 1) {
+        size_t n = ss->n_runs - 2;
+        if (n > 0 && ss->run_len[n - 1] < ss->run_len[n + 1]) {
+            n--;
+        }
+        sort_merge_at(ss, len, n);
+    }
+}
+
+#else
+
 static void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
     MP_STACK_CHECK();
     while (head < tail) {
@@ -343,7 +658,10 @@ static void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
+#endif
+
+// CIRCUITPY-CHANGE: Python defines sort to be stable, which ours is with
+// MICROPY_PY_LIST_SORT_STABLE.
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
@@ -362,9 +680,37 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = native_list(pos_args[0]);
 
     if (self->len > 1) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_LIST_SORT_STABLE
+        sort_state_t ss;
+        size_t len = self->len;
+        ss.keys = self->items;
+        ss.items = NULL;
+        size_t n_keys = len;
+        if (args.key.u_obj != mp_const_none) {
+            ss.keys = m_new(mp_obj_t, n_keys);
+            for (size_t i = 0; i < n_keys; i++) {
+                ss.keys[i] = mp_call_function_1(args.key.u_obj, self->items[i]);
+            }
+            // In case the key function changed the list.
+            len = MIN(len, self->len);
+            ss.items = self->items;
+        }
+        ss.tmp_keys = NULL;
+        ss.tmp_tried = false;
+        ss.reverse = args.reverse.u_bool;
+        mp_timsort(&ss, len);
+        if (ss.items != NULL) {
+            m_del(mp_obj_t, ss.keys, n_keys);
+        }
+        if (ss.tmp_keys != NULL) {
+            m_del(mp_obj_t, ss.tmp_keys, 0);
+        }
+        #else
         mp_quicksort(self->items, self->items + self->len - 1,
             args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
             args.reverse.u_bool ? mp_const_false : mp_const_true);
+        #endif
     }
 
     return mp_const_none;
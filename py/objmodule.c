@@ -94,6 +94,13 @@ static void module_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
             #endif
         }
         #endif
+        // CIRCUITPY-CHANGE: finish deferred init before the first real use.
+        #if MICROPY_MODULE_BUILTIN_LAZY_INIT
+        // Dunder attributes like __name__ don't need the module to be set up.
+        if (MP_STATE_VM(module_lazy_init_pending) != MP_OBJ_NULL && strncmp(qstr_str(attr), "__", 2) != 0) {
+            mp_module_lazy_init(self_in);
+        }
+        #endif
         // load attribute
         mp_map_elem_t *elem = mp_map_lookup(&self->globals->map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
         if (elem != NULL) {
@@ -190,6 +197,26 @@ static const mp_rom_map_elem_t mp_builtin_extensible_module_table[] = {
 };
 MP_DEFINE_CONST_MAP(mp_builtin_extensible_module_map, mp_builtin_extensible_module_table);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_BUILTIN_PHASH && defined(MICROPY_REGISTERED_MODULES_PHASH)
+// The module tables are laid out in the order of a minimal perfect hash of the
+// module name qstrs, with these per-bucket displacements (see py/makemoduledefs.py).
+#define MP_MODULE_PHASH_MULTIPLIER (0x9E3779B1u)
+
+static const uint16_t mp_builtin_module_phash[] = MICROPY_REGISTERED_MODULES_PHASH;
+static const uint16_t mp_builtin_extensible_module_phash[] = MICROPY_REGISTERED_EXTENSIBLE_MODULES_PHASH;
+
+static mp_map_elem_t *mp_module_phash_lookup(const mp_map_t *map, const uint16_t *disps, size_t num_buckets, qstr module_name) {
+    if (map->used == 0) {
+        return NULL;
+    }
+    uint32_t h = (uint32_t)module_name ^ ((uint32_t)disps[module_name % num_buckets] * MP_MODULE_PHASH_MULTIPLIER);
+    mp_map_elem_t *elem = &map->table[((h * MP_MODULE_PHASH_MULTIPLIER) >> 16) % map->used];
+    // Any qstr lands in some slot, so check it's the right one.
+    return elem->key == MP_OBJ_NEW_QSTR(module_name) ? elem : NULL;
+}
+#endif
+
 #if MICROPY_MODULE_ATTR_DELEGATION && defined(MICROPY_MODULE_DELEGATIONS)
 typedef struct _mp_module_delegation_entry_t {
     mp_rom_obj_t mod;
@@ -211,7 +238,14 @@ mp_obj_t mp_module_get_builtin(qstr module_name, bool extensible) {
         warnings_warn(&mp_type_FutureWarning, MP_ERROR_TEXT("%q renamed %q"), MP_QSTR_paralleldisplay, MP_QSTR_paralleldisplaybus);
     }
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MODULE_BUILTIN_PHASH && defined(MICROPY_REGISTERED_MODULES_PHASH)
+    mp_map_elem_t *elem = extensible
+        ? mp_module_phash_lookup(&mp_builtin_extensible_module_map, mp_builtin_extensible_module_phash, MICROPY_REGISTERED_EXTENSIBLE_MODULES_PHASH_BUCKETS, module_name)
+        : mp_module_phash_lookup(&mp_builtin_module_map, mp_builtin_module_phash, MICROPY_REGISTERED_MODULES_PHASH_BUCKETS, module_name);
+    #else
     mp_map_elem_t *elem = mp_map_lookup((mp_map_t *)(extensible ? &mp_builtin_extensible_module_map : &mp_builtin_module_map), MP_OBJ_NEW_QSTR(module_name), MP_MAP_LOOKUP);
+    #endif
     if (!elem) {
         #if MICROPY_PY_SYS
         // Special case for sys, which isn't extensible but can always be
@@ -251,9 +285,60 @@ mp_obj_t mp_module_get_builtin(qstr module_name, bool extensible) {
     }
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MODULE_BUILTIN_LAZY_INIT
+    // Defer the more expensive part of the init until the module is used.
+    mp_obj_dict_t *globals = ((mp_obj_module_t *)MP_OBJ_TO_PTR(elem->value))->globals;
+    if (mp_map_lookup(&globals->map, MP_OBJ_NEW_QSTR(MP_QSTR___lazy_init__), MP_MAP_LOOKUP) != NULL) {
+        if (MP_STATE_VM(module_lazy_init_pending) == MP_OBJ_NULL) {
+            MP_STATE_VM(module_lazy_init_pending) = mp_obj_new_list(0, NULL);
+        }
+        mp_obj_list_t *pending = MP_OBJ_TO_PTR(MP_STATE_VM(module_lazy_init_pending));
+        size_t i = 0;
+        while (i < pending->len && pending->items[i] != elem->value) {
+            ++i;
+        }
+        if (i == pending->len) {
+            mp_obj_list_append(MP_STATE_VM(module_lazy_init_pending), elem->value);
+        }
+    }
+    #endif
+
     return elem->value;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_BUILTIN_LAZY_INIT
+// A list of the built-in modules imported since their __lazy_init__ last ran.
+MP_REGISTER_ROOT_POINTER(mp_obj_t module_lazy_init_pending);
+
+void mp_module_lazy_init(mp_obj_t module) {
+    mp_obj_t pending_in = MP_STATE_VM(module_lazy_init_pending);
+    if (pending_in == MP_OBJ_NULL) {
+        return;
+    }
+    mp_obj_list_t *pending = MP_OBJ_TO_PTR(pending_in);
+    size_t i = 0;
+    while (i < pending->len && pending->items[i] != module) {
+        ++i;
+    }
+    if (i == pending->len) {
+        return;
+    }
+    // Take the module off the list first so that attribute loads made by
+    // __lazy_init__ itself don't recurse.
+    mp_obj_list_remove(pending_in, module);
+    if (pending->len == 0) {
+        MP_STATE_VM(module_lazy_init_pending) = MP_OBJ_NULL;
+    }
+    mp_obj_dict_t *globals = ((mp_obj_module_t *)MP_OBJ_TO_PTR(module))->globals;
+    mp_map_elem_t *elem = mp_map_lookup(&globals->map, MP_OBJ_NEW_QSTR(MP_QSTR___lazy_init__), MP_MAP_LOOKUP);
+    if (elem != NULL) {
+        mp_call_function_0(elem->value);
+    }
+}
+#endif
+
 static void module_attr_try_delegation(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     #if MICROPY_MODULE_ATTR_DELEGATION && defined(MICROPY_MODULE_DELEGATIONS)
     // Delegate lookup to a module's custom attr method.
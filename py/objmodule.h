@@ -39,6 +39,16 @@ extern const mp_map_t mp_builtin_extensible_module_map;
 
 mp_obj_t mp_module_get_builtin(qstr module_name, bool extensible);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_BUILTIN_LAZY_INIT
+// Key of the entry in a built-in module's globals that sets it up: __init__
+// runs on import, __lazy_init__ on first use of a non-dunder attribute.
+#define MP_QSTR_MODULE_INIT MP_QSTR___lazy_init__
+void mp_module_lazy_init(mp_obj_t module);
+#else
+#define MP_QSTR_MODULE_INIT MP_QSTR___init__
+#endif
+
 void mp_module_generic_attr(qstr attr, mp_obj_t *dest, const uint16_t *keys, mp_obj_t *values);
 
 #endif // MICROPY_INCLUDED_PY_OBJMODULE_H
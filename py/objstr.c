@@ -70,6 +70,28 @@ static void str_check_arg_type(const mp_obj_type_t *self_type, const mp_obj_t ar
     }
 }
 
+// CIRCUITPY-CHANGE
+// Get the data of a str/bytes argument to a method of self_type. With
+// MICROPY_PY_BUILTINS_BYTES_BUFFER_ARGS, bytes methods also take any object
+// with the buffer protocol, eg a memoryview slice, so there's no need to copy
+// data out to a bytes object first.
+static const byte *str_get_arg_data(const mp_obj_type_t *self_type, mp_obj_t arg, size_t *len) {
+    #if MICROPY_PY_BUILTINS_BYTES_BUFFER_ARGS
+    if (self_type != &mp_type_str && !mp_obj_is_str_or_bytes(arg)) {
+        mp_buffer_info_t bufinfo;
+        if (!mp_get_buffer(arg, &bufinfo, MP_BUFFER_READ)) {
+            bad_implicit_conversion(arg);
+        }
+        *len = bufinfo.len;
+        return bufinfo.buf;
+    }
+    #endif
+    str_check_arg_type(self_type, arg);
+    GET_STR_DATA_LEN(arg, data, data_len);
+    *len = data_len;
+    return data;
+}
+
 static void check_is_str_or_bytes(mp_obj_t self_in) {
     mp_check_self(mp_obj_is_str_or_bytes(self_in));
 }
@@ -527,22 +549,29 @@ static mp_obj_t str_join(mp_obj_t self_in, mp_obj_t arg) {
         self_type = &mp_type_bytes;
     }
     #endif
+    // CIRCUITPY-CHANGE: as in CPython, bytes can be joined from any buffer
+    bool is_bytes = self_type != &mp_type_str;
     for (size_t i = 0; i < seq_len; i++) {
         const mp_obj_type_t *seq_type = mp_obj_get_type(seq_items[i]);
-        #if MICROPY_PY_BUILTINS_BYTEARRAY
-        if (seq_type == &mp_type_bytearray) {
-            seq_type = &mp_type_bytes;
-        }
-        #endif
-        if (seq_type != self_type) {
+        mp_buffer_info_t bufinfo;
+        if (is_bytes ? seq_type == &mp_type_str || !mp_get_buffer(seq_items[i], &bufinfo, MP_BUFFER_READ) : seq_type != self_type) {
             mp_raise_TypeError(
                 MP_ERROR_TEXT("join expects a list of str/bytes objects consistent with self object"));
         }
         if (i > 0) {
             required_len += sep_len;
         }
-        GET_STR_LEN(seq_items[i], l);
-        required_len += l;
+        if (is_bytes) {
+            required_len += bufinfo.len;
+        } else {
+            GET_STR_LEN(seq_items[i], l);
+            required_len += l;
+        }
+    }
+
+    // CIRCUITPY-CHANGE: a single str or bytes joins to itself
+    if (seq_len == 1 && mp_obj_get_type(seq_items[0]) == ret_type && ret_type != &mp_type_bytearray) {
+        return seq_items[0];
     }
 
     // make joined string
@@ -554,9 +583,16 @@ static mp_obj_t str_join(mp_obj_t self_in, mp_obj_t arg) {
             memcpy(data, sep_str, sep_len);
             data += sep_len;
         }
-        GET_STR_DATA_LEN(seq_items[i], s, l);
-        memcpy(data, s, l);
-        data += l;
+        if (is_bytes) {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(seq_items[i], &bufinfo, MP_BUFFER_READ);
+            memcpy(data, bufinfo.buf, bufinfo.len);
+            data += bufinfo.len;
+        } else {
+            GET_STR_DATA_LEN(seq_items[i], s, l);
+            memcpy(data, s, l);
+            data += l;
+        }
     }
 
     // return joined string
@@ -609,10 +645,8 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
 
     } else {
         // sep given
-        str_check_arg_type(self_type, sep);
-
         size_t sep_len;
-        const char *sep_str = mp_obj_str_get_data(sep, &sep_len);
+        const char *sep_str = (const char *)str_get_arg_data(self_type, sep, &sep_len);
 
         if (sep_len == 0) {
             mp_raise_ValueError(MP_ERROR_TEXT("empty separator"));
@@ -717,7 +751,7 @@ static mp_obj_t str_rsplit(size_t n_args, const mp_obj_t *args) {
         mp_raise_NotImplementedError(MP_ERROR_TEXT("rsplit(None,n)"));
     } else {
         size_t sep_len;
-        const char *sep_str = mp_obj_str_get_data(sep, &sep_len);
+        const char *sep_str = (const char *)str_get_arg_data(self_type, sep, &sep_len);
 
         if (sep_len == 0) {
             mp_raise_ValueError(MP_ERROR_TEXT("empty separator"));
@@ -761,10 +795,10 @@ static mp_obj_t str_finder(size_t n_args, const mp_obj_t *args, int direction, b
     check_is_str_or_bytes(args[0]);
 
     // check argument type
-    str_check_arg_type(self_type, args[1]);
+    size_t needle_len;
+    const byte *needle = str_get_arg_data(self_type, args[1], &needle_len);
 
     GET_STR_DATA_LEN(args[0], haystack, haystack_len);
-    GET_STR_DATA_LEN(args[1], needle, needle_len);
 
     const byte *start = haystack;
     const byte *end = haystack + haystack_len;
@@ -824,7 +858,7 @@ static mp_obj_t str_startswith(size_t n_args, const mp_obj_t *args) {
     const mp_obj_type_t *self_type = mp_obj_get_type(args[0]);
     GET_STR_DATA_LEN(args[0], str, str_len);
     size_t prefix_len;
-    const char *prefix = mp_obj_str_get_data(args[1], &prefix_len);
+    const byte *prefix = str_get_arg_data(self_type, args[1], &prefix_len);
     const byte *start = str;
     if (n_args > 2) {
         start = str_index_to_ptr(self_type, str, str_len, args[2], true);
@@ -837,9 +871,10 @@ static mp_obj_t str_startswith(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(str_startswith_obj, 2, 3, str_startswith);
 
 static mp_obj_t str_endswith(size_t n_args, const mp_obj_t *args) {
+    const mp_obj_type_t *self_type = mp_obj_get_type(args[0]);
     GET_STR_DATA_LEN(args[0], str, str_len);
     size_t suffix_len;
-    const char *suffix = mp_obj_str_get_data(args[1], &suffix_len);
+    const byte *suffix = str_get_arg_data(self_type, args[1], &suffix_len);
     if (n_args > 2) {
         mp_raise_NotImplementedError(MP_ERROR_TEXT("start/end indices"));
     }
@@ -865,9 +900,8 @@ static mp_obj_t str_uni_strip(int type, size_t n_args, const mp_obj_t *args) {
         chars_to_del = whitespace;
         chars_to_del_len = sizeof(whitespace) - 1;
     } else {
-        str_check_arg_type(self_type, args[1]);
-        GET_STR_DATA_LEN(args[1], s, l);
-        chars_to_del = s;
+        size_t l;
+        chars_to_del = str_get_arg_data(self_type, args[1], &l);
         chars_to_del_len = l;
     }
 
@@ -1009,16 +1043,15 @@ static NORETURN void terse_str_format_value_error(void) {
 #define terse_str_format_value_error()
 #endif
 
-static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
-    vstr_t vstr;
-    mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs);
 
+// CIRCUITPY-CHANGE: prints to any mp_print_t, so bytearray.format_into() can use it
+static void str_format_print(const mp_print_t *print, const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
     for (; str < top; str++) {
         if (*str == '}') {
             str++;
             if (str < top && *str == '}') {
-                vstr_add_byte(&vstr, '}');
+                mp_print_str(print, "}");
                 continue;
             }
             #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
@@ -1029,13 +1062,18 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             #endif
         }
         if (*str != '{') {
-            vstr_add_byte(&vstr, *str);
+            // CIRCUITPY-CHANGE: print plain text a run at a time
+            const char *run = str;
+            while (str + 1 < top && str[1] != '{' && str[1] != '}') {
+                str++;
+            }
+            print->print_strn(print->data, run, str + 1 - run);
             continue;
         }
 
         str++;
         if (str < top && *str == '{') {
-            vstr_add_byte(&vstr, '{');
+            mp_print_str(print, "{");
             continue;
         }
 
@@ -1297,19 +1335,19 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
         if (arg_looks_integer(arg)) {
             switch (type) {
                 case 'b':
-                    mp_print_mp_int(&print, arg, 2, 'a', flags, fill, width, 0);
+                    mp_print_mp_int(print, arg, 2, 'a', flags, fill, width, 0);
                     continue;
 
                 case 'c': {
                     char ch = mp_obj_get_int(arg);
-                    mp_print_strn(&print, &ch, 1, flags, fill, width);
+                    mp_print_strn(print, &ch, 1, flags, fill, width);
                     continue;
                 }
 
                 case '\0':  // No explicit format type implies 'd'
                 case 'n':   // I don't think we support locales in uPy so use 'd'
                 case 'd':
-                    mp_print_mp_int(&print, arg, 10, 'a', flags, fill, width, 0);
+                    mp_print_mp_int(print, arg, 10, 'a', flags, fill, width, 0);
                     continue;
 
                 case 'o':
@@ -1317,12 +1355,12 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                         flags |= PF_FLAG_SHOW_OCTAL_LETTER;
                     }
 
-                    mp_print_mp_int(&print, arg, 8, 'a', flags, fill, width, 0);
+                    mp_print_mp_int(print, arg, 8, 'a', flags, fill, width, 0);
                     continue;
 
                 case 'X':
                 case 'x':
-                    mp_print_mp_int(&print, arg, 16, type - ('X' - 'A'), flags, fill, width, 0);
+                    mp_print_mp_int(print, arg, 16, type - ('X' - 'A'), flags, fill, width, 0);
                     continue;
 
                 case 'e':
@@ -1394,7 +1432,7 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                 case 'F':
                 case 'g':
                 case 'G':
-                    mp_print_float(&print, mp_obj_get_float(arg), type, flags, fill, width, precision);
+                    mp_print_float(print, mp_obj_get_float(arg), type, flags, fill, width, precision);
                     break;
 
                 case '%':
@@ -1404,7 +1442,7 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                     #else
                     #define F100 100.0
                     #endif
-                    mp_print_float(&print, mp_obj_get_float(arg) * F100, 'f', flags, fill, width, precision);
+                    mp_print_float(print, mp_obj_get_float(arg) * F100, 'f', flags, fill, width, precision);
 #undef F100
                     break;
                 #endif
@@ -1442,7 +1480,7 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                     if (slen > (size_t)precision) {
                         slen = precision;
                     }
-                    mp_print_strn(&print, s, slen, flags, fill, width);
+                    mp_print_strn(print, s, slen, flags, fill, width);
                     break;
                 }
 
@@ -1459,6 +1497,14 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
         }
     }
 
+}
+
+static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
+    vstr_t vstr;
+    mp_print_t print;
+    // CIRCUITPY-CHANGE: start with room for the format string
+    vstr_init_print(&vstr, MAX((size_t)(top - str), 16), &print);
+    str_format_print(&print, str, top, arg_i, n_args, args, kwargs);
     return vstr;
 }
 
@@ -1472,6 +1518,15 @@ mp_obj_t mp_obj_str_format(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(str_format_obj, 1, mp_obj_str_format);
 
+// CIRCUITPY-CHANGE
+void mp_obj_str_format_print(const mp_print_t *print, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
+    check_is_str_or_bytes(args[0]);
+
+    GET_STR_DATA_LEN(args[0], str, len);
+    int arg_i = 0;
+    str_format_print(print, (const char *)str, (const char *)str + len, &arg_i, n_args, args, kwargs);
+}
+
 #if MICROPY_PY_BUILTINS_STR_OP_MODULO
 static mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_t *args, mp_obj_t dict) {
     check_is_str_or_bytes(pattern);
@@ -1484,7 +1539,8 @@ static mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_
     size_t arg_i = 0;
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    // CIRCUITPY-CHANGE: start with room for the format string
+    vstr_init_print(&vstr, MAX(len, 16), &print);
 
     for (const byte *top = str + len; str < top; str++) {
         mp_obj_t arg = MP_OBJ_NULL;
@@ -1706,14 +1762,14 @@ static mp_obj_t str_replace(size_t n_args, const mp_obj_t *args) {
 
     const mp_obj_type_t *self_type = mp_obj_get_type(args[0]);
 
-    str_check_arg_type(self_type, args[1]);
-    str_check_arg_type(self_type, args[2]);
+    size_t old_len;
+    const byte *old = str_get_arg_data(self_type, args[1], &old_len);
+    size_t new_len;
+    const byte *new = str_get_arg_data(self_type, args[2], &new_len);
 
     // extract string data
 
     GET_STR_DATA_LEN(args[0], str, str_len);
-    GET_STR_DATA_LEN(args[1], old, old_len);
-    GET_STR_DATA_LEN(args[2], new, new_len);
 
     // old won't exist in str if it's longer, so nothing to replace
     if (old_len > str_len) {
@@ -1794,10 +1850,10 @@ static mp_obj_t str_count(size_t n_args, const mp_obj_t *args) {
     check_is_str_or_bytes(args[0]);
 
     // check argument type
-    str_check_arg_type(self_type, args[1]);
+    size_t needle_len;
+    const byte *needle = str_get_arg_data(self_type, args[1], &needle_len);
 
     GET_STR_DATA_LEN(args[0], haystack, haystack_len);
-    GET_STR_DATA_LEN(args[1], needle, needle_len);
 
     const byte *start = haystack;
     const byte *end = haystack + haystack_len;
@@ -1835,10 +1891,10 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(str_count_obj, 2, 4, str_count);
 static mp_obj_t str_partitioner(mp_obj_t self_in, mp_obj_t arg, int direction) {
     check_is_str_or_bytes(self_in);
     const mp_obj_type_t *self_type = mp_obj_get_type(self_in);
-    str_check_arg_type(self_type, arg);
+    size_t sep_len;
+    const byte *sep = str_get_arg_data(self_type, arg, &sep_len);
 
     GET_STR_DATA_LEN(self_in, str, str_len);
-    GET_STR_DATA_LEN(arg, sep, sep_len);
 
     if (sep_len == 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("empty separator"));
@@ -2100,6 +2156,10 @@ void mp_obj_str_set_data(mp_obj_str_t *str, const byte *data, size_t len) {
 // This locals table is used for the following types: str, bytes, bytearray, array.array.
 // Each type takes a different section (start to end offset) of this table.
 static const mp_rom_map_elem_t array_bytearray_str_bytes_locals_table[] = {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO
+    { MP_ROM_QSTR(MP_QSTR_format_into), MP_ROM_PTR(&mp_obj_bytearray_format_into_obj) },
+    #endif
     #if MICROPY_PY_ARRAY || MICROPY_PY_BUILTINS_BYTEARRAY
     { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&mp_obj_array_append_obj) },
     { MP_ROM_QSTR(MP_QSTR_extend), MP_ROM_PTR(&mp_obj_array_extend_obj) },
@@ -2169,16 +2229,23 @@ static const mp_rom_map_elem_t array_bytearray_str_bytes_locals_table[] = {
 #define TABLE_ENTRIES_ARRAY 0
 #endif
 
+// CIRCUITPY-CHANGE: the entries only for bytearray
+#if MICROPY_PY_BUILTINS_BYTEARRAY_FORMAT_INTO
+#define TABLE_ENTRIES_BYTEARRAY 1
+#else
+#define TABLE_ENTRIES_BYTEARRAY 0
+#endif
+
 MP_DEFINE_CONST_DICT_WITH_SIZE(mp_obj_str_locals_dict,
-    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_ARRAY + TABLE_ENTRIES_HEX + TABLE_ENTRIES_COMPAT,
-    MP_ARRAY_SIZE(array_bytearray_str_bytes_locals_table) - (TABLE_ENTRIES_ARRAY + TABLE_ENTRIES_HEX + TABLE_ENTRIES_COMPAT));
+    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_BYTEARRAY + TABLE_ENTRIES_ARRAY + TABLE_ENTRIES_HEX + TABLE_ENTRIES_COMPAT,
+    MP_ARRAY_SIZE(array_bytearray_str_bytes_locals_table) - (TABLE_ENTRIES_BYTEARRAY + TABLE_ENTRIES_ARRAY + TABLE_ENTRIES_HEX + TABLE_ENTRIES_COMPAT));
 
 #if TABLE_ENTRIES_COMPAT == 0
 #define mp_obj_bytes_locals_dict mp_obj_str_locals_dict
 #else
 MP_DEFINE_CONST_DICT_WITH_SIZE(mp_obj_bytes_locals_dict,
-    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_ARRAY,
-    MP_ARRAY_SIZE(array_bytearray_str_bytes_locals_table) - (TABLE_ENTRIES_ARRAY + TABLE_ENTRIES_COMPAT));
+    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_BYTEARRAY + TABLE_ENTRIES_ARRAY,
+    MP_ARRAY_SIZE(array_bytearray_str_bytes_locals_table) - (TABLE_ENTRIES_BYTEARRAY + TABLE_ENTRIES_ARRAY + TABLE_ENTRIES_COMPAT));
 #endif
 
 #if MICROPY_PY_BUILTINS_BYTEARRAY
@@ -2189,14 +2256,14 @@ MP_DEFINE_CONST_DICT_WITH_SIZE(mp_obj_bytearray_locals_dict,
 
 #if MICROPY_PY_ARRAY
 MP_DEFINE_CONST_DICT_WITH_SIZE(mp_obj_array_locals_dict,
-    array_bytearray_str_bytes_locals_table,
+    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_BYTEARRAY,
     TABLE_ENTRIES_ARRAY);
 #endif
 
 // CIRCUITPY-CHANGE: hex() but no cast()
 #if MICROPY_PY_BUILTINS_MEMORYVIEW && MICROPY_PY_BUILTINS_BYTES_HEX && !MICROPY_CPYTHON_COMPAT
 MP_DEFINE_CONST_DICT_WITH_SIZE(mp_obj_memoryview_locals_dict,
-    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_ARRAY,
+    array_bytearray_str_bytes_locals_table + TABLE_ENTRIES_BYTEARRAY + TABLE_ENTRIES_ARRAY,
     1); // Just the "hex" entry.
 #endif
 
@@ -2243,7 +2310,8 @@ mp_obj_t mp_obj_new_str_copy(const mp_obj_type_t *type, const byte *data, size_t
     o->len = len;
     if (data) {
         o->hash = qstr_compute_hash(data, len);
-        byte *p = m_new(byte, len + 1);
+        // CIRCUITPY-CHANGE
+        byte *p = m_new_noscan(byte, len + 1);
         o->data = p;
         memcpy(p, data, len * sizeof(byte));
         p[len] = '\0'; // for now we add null for compatibility with C ASCIIZ strings
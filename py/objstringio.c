@@ -28,6 +28,8 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "py/binary.h"
+#include "py/objarray.h"
 #include "py/objstr.h"
 #include "py/objstringio.h"
 #include "py/runtime.h"
@@ -106,6 +108,18 @@ static mp_uint_t stringio_write(mp_obj_t o_in, const void *buf, mp_uint_t size,
         return MP_STREAM_ERROR;
     }
     mp_uint_t org_len = o->vstr->len;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_IO_BYTESIO_GETBUFFER
+    if (o->exported && new_pos > o->vstr->alloc) {
+        // A memoryview from getbuffer() may still use the buffer, so move to a
+        // new one and leave the old one to the GC, rather than reallocating it.
+        char *new_buf = m_new(char, new_pos + 16);
+        memcpy(new_buf, o->vstr->buf, org_len);
+        o->vstr->buf = new_buf;
+        o->vstr->alloc = new_pos + 16;
+        o->exported = false;
+    }
+    #endif
     if (new_pos > o->vstr->alloc) {
         // Take all what's already allocated...
         o->vstr->len = o->vstr->alloc;
@@ -160,6 +174,13 @@ static mp_uint_t stringio_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
         case MP_STREAM_FLUSH:
             return 0;
         case MP_STREAM_CLOSE:
+            // CIRCUITPY-CHANGE: don't free a buffer that a memoryview may be using
+            #if MICROPY_PY_IO_BYTESIO_GETBUFFER
+            if (o->exported) {
+                o->vstr->fixed_buf = true;
+                o->exported = false;
+            }
+            #endif
             #if MICROPY_CPYTHON_COMPAT
             vstr_free(o->vstr);
             o->vstr = NULL;
@@ -187,10 +208,29 @@ static mp_obj_t stringio_getvalue(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(stringio_getvalue_obj, stringio_getvalue);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_IO_BYTESIO && MICROPY_PY_IO_BYTESIO_GETBUFFER
+static mp_obj_t bytesio_getbuffer(mp_obj_t self_in) {
+    mp_obj_stringio_t *self = native_obj(self_in);
+    check_stringio_is_open(self);
+    if (self->vstr->fixed_buf) {
+        // Don't let the memoryview write to the bytes this was made from.
+        stringio_copy_on_write(self);
+    }
+    self->exported = true;
+    return mp_obj_new_memoryview(BYTEARRAY_TYPECODE | MP_OBJ_ARRAY_TYPECODE_FLAG_RW, self->vstr->len, self->vstr->buf);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(bytesio_getbuffer_obj, bytesio_getbuffer);
+#endif
+
 static mp_obj_stringio_t *stringio_new(const mp_obj_type_t *type) {
     mp_obj_stringio_t *o = mp_obj_malloc(mp_obj_stringio_t, type);
     o->pos = 0;
     o->ref_obj = MP_OBJ_NULL;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_IO_BYTESIO_GETBUFFER
+    o->exported = false;
+    #endif
     return o;
 }
 
@@ -266,6 +306,28 @@ MP_DEFINE_CONST_OBJ_TYPE(
     );
 
 #if MICROPY_PY_IO_BYTESIO
+// CIRCUITPY-CHANGE: BytesIO has getbuffer() too
+#if MICROPY_PY_IO_BYTESIO_GETBUFFER
+static const mp_rom_map_elem_t bytesio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
+    { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR_getvalue), MP_ROM_PTR(&stringio_getvalue_obj) },
+    { MP_ROM_QSTR(MP_QSTR_getbuffer), MP_ROM_PTR(&bytesio_getbuffer_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&mp_stream___exit___obj) },
+};
+
+static MP_DEFINE_CONST_DICT(bytesio_locals_dict, bytesio_locals_dict_table);
+#else
+#define bytesio_locals_dict stringio_locals_dict
+#endif
+
 static const mp_stream_p_t bytesio_stream_p = {
     .read = stringio_read,
     .write = stringio_write,
@@ -279,7 +341,7 @@ MP_DEFINE_CONST_OBJ_TYPE(
     make_new, stringio_make_new,
     print, stringio_print,
     protocol, &bytesio_stream_p,
-    locals_dict, &stringio_locals_dict
+    locals_dict, &bytesio_locals_dict
     );
 #endif
 
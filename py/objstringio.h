@@ -35,6 +35,10 @@ typedef struct _mp_obj_stringio_t {
     mp_uint_t pos;
     // Underlying object buffered by this StringIO
     mp_obj_t ref_obj;
+    // CIRCUITPY-CHANGE: set once getbuffer() has made a memoryview of the buffer
+    #if MICROPY_PY_IO_BYTESIO_GETBUFFER
+    bool exported;
+    #endif
 } mp_obj_stringio_t;
 
 #endif // MICROPY_INCLUDED_PY_OBJSTRINGIO_H
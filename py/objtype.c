@@ -159,6 +159,12 @@ struct class_lookup_data {
     size_t slot_offset;
     mp_obj_t *dest;
     bool is_type;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_ATTR_CACHE
+    // Set when the attribute was found in a locals_dict.
+    const mp_obj_type_t *found_in;
+    mp_map_elem_t *found_elem;
+    #endif
 };
 
 static void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_type_t *type) {
@@ -188,6 +194,11 @@ static void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
             mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map;
             mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(lookup->attr), MP_MAP_LOOKUP);
             if (elem != NULL) {
+                // CIRCUITPY-CHANGE
+                #if MICROPY_OPT_ATTR_CACHE
+                lookup->found_in = type;
+                lookup->found_elem = elem;
+                #endif
                 if (lookup->is_type) {
                     // If we look up a class method, we need to return original type for which we
                     // do a lookup, not a (base) type in which we found the class method.
@@ -433,7 +444,8 @@ static mp_obj_t instance_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
         size_t num_native_bases = instance_count_native_bases(mp_obj_get_type(self_in), &native_base);
 
         size_t sz = sizeof(*self) + sizeof(*self->subobj) * num_native_bases
-            + sizeof(*self->members.table) * self->members.alloc;
+            // CIRCUITPY-CHANGE
+            + mp_map_table_bytes(&self->members);
         return MP_OBJ_NEW_SMALL_INT(sz);
     }
     #endif
@@ -605,6 +617,48 @@ static mp_obj_t instance_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t
     return res;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_ATTR_CACHE
+#define ATTR_CACHE_ENTRY(type, attr) (&MP_STATE_VM(attr_cache)[(((uintptr_t)(type) >> 4) ^ (attr)) % MICROPY_OPT_ATTR_CACHE_SIZE])
+
+void mp_obj_instance_attr_cache_clear(void) {
+    memset(MP_STATE_VM(attr_cache), 0, sizeof(MP_STATE_VM(attr_cache)));
+}
+
+// Equivalent to mp_obj_class_lookup(lookup, lookup->obj->base.type), but first
+// tries the attribute cache, and records where the attribute was found in it.
+static void instance_class_lookup(struct class_lookup_data *lookup) {
+    const mp_obj_type_t *type = lookup->obj->base.type;
+    mp_attr_cache_entry_t *entry = ATTR_CACHE_ENTRY(type, lookup->attr);
+    if (entry->type == type && entry->attr == lookup->attr) {
+        // The locals map may have been resized or had the attribute removed
+        // since the entry was made, so check the element is still current.
+        const mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(entry->found_in, locals_dict)->map;
+        mp_map_elem_t *elem = entry->elem;
+        if (elem >= locals_map->table && elem < locals_map->table + locals_map->alloc
+            && elem->key == MP_OBJ_NEW_QSTR(lookup->attr)) {
+            // This mirrors the instance case of mp_obj_class_lookup.
+            if (mp_obj_is_type(elem->value, &mp_type_property)) {
+                lookup->dest[0] = elem->value;
+            } else {
+                mp_convert_member_lookup(lookup->obj, entry->found_in, elem->value, lookup->dest);
+            }
+            return;
+        }
+    }
+    mp_obj_class_lookup(lookup, type);
+    // With a native base the result can depend on the native instance, so
+    // only cache lookups through pure-Python class hierarchies.
+    const mp_obj_type_t *native_base;
+    if (lookup->found_elem != NULL && instance_count_native_bases(type, &native_base) == 0) {
+        entry->type = type;
+        entry->attr = lookup->attr;
+        entry->found_in = lookup->found_in;
+        entry->elem = lookup->found_elem;
+    }
+}
+#endif
+
 static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     // logic: look in instance members then class locals
     assert(mp_obj_is_instance_type(mp_obj_get_type(self_in)));
@@ -637,7 +691,12 @@ static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         .dest = dest,
         .is_type = false,
     };
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_ATTR_CACHE
+    instance_class_lookup(&lookup);
+    #else
     mp_obj_class_lookup(&lookup, self->base.type);
+    #endif
     mp_obj_t member = dest[0];
     if (member != MP_OBJ_NULL) {
         if (!(self->base.type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
@@ -1109,6 +1168,11 @@ static void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
                 // can't apply delete/store to a fixed map
                 return;
             }
+            // CIRCUITPY-CHANGE: this may shadow or remove a cached attribute
+            // of this class or of any subclass.
+            #if MICROPY_OPT_ATTR_CACHE
+            mp_obj_instance_attr_cache_clear();
+            #endif
             if (dest[1] == MP_OBJ_NULL) {
                 // delete attribute
                 mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
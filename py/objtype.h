@@ -55,4 +55,9 @@ mp_obj_t mp_obj_instance_getiter(mp_obj_t self_in, mp_obj_iter_buf_t *iter_buf);
 // CIRCUITPY-CHANGE: addition
 void mp_obj_assert_native_inited(mp_obj_t native_object);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_ATTR_CACHE
+void mp_obj_instance_attr_cache_clear(void);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJTYPE_H
@@ -238,7 +238,8 @@ typedef struct _parser_t {
     mp_parse_chunk_t *cur_chunk;
 
     #if MICROPY_COMP_CONST
-    mp_map_t consts;
+    // CIRCUITPY-CHANGE: a pointer so the constants can outlive one parse
+    mp_map_t *consts;
     #endif
 } parser_t;
 
@@ -593,7 +594,7 @@ static void push_result_token(parser_t *parser, uint8_t rule_id) {
         // if name is a standalone identifier, look it up in the table of dynamic constants
         mp_map_elem_t *elem;
         if (rule_id == RULE_atom
-            && (elem = mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP)) != NULL) {
+            && (elem = mp_map_lookup(parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP)) != NULL) {
             pn = make_node_const_object_optimised(parser, lex->tok_line, elem->value);
         } else {
             pn = mp_parse_node_new_leaf(MP_PARSE_NODE_ID, id);
@@ -833,7 +834,7 @@ static bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
                 mp_obj_t value = mp_parse_node_convert_to_obj(pn_value);
 
                 // store the value in the table of dynamic constants
-                mp_map_elem_t *elem = mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+                mp_map_elem_t *elem = mp_map_lookup(parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
                 assert(elem->value == MP_OBJ_NULL);
                 elem->value = value;
 
@@ -1028,11 +1029,9 @@ static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
-mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
-    // Set exception handler to free the lexer if an exception is raised.
-    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
-    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
-
+// CIRCUITPY-CHANGE: factored out of mp_parse so that a file can also be parsed
+// one statement at a time, in which case the input doesn't have to end after it.
+static mp_parse_tree_t mp_parse_helper(mp_lexer_t *lex, mp_parse_input_kind_t input_kind, mp_map_t *consts, bool one_stmt) {
     // initialise parser and allocate memory for its stacks
 
     parser_t parser;
@@ -1072,7 +1071,9 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     parser.cur_chunk = NULL;
 
     #if MICROPY_COMP_CONST
-    mp_map_init(&parser.consts, 0);
+    parser.consts = consts;
+    #else
+    (void)consts;
     #endif
 
     // work out the top-level rule to use, and push it on the stack
@@ -1087,6 +1088,9 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
         default:
             top_level_rule = RULE_file_input;
     }
+    if (one_stmt) {
+        top_level_rule = RULE_stmt;
+    }
     push_rule(&parser, lex->tok_line, top_level_rule, 0);
 
     // parse!
@@ -1347,10 +1351,6 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
         }
     }
 
-    #if MICROPY_COMP_CONST
-    mp_map_deinit(&parser.consts);
-    #endif
-
     // truncate final chunk and link into chain of chunks
     if (parser.cur_chunk != NULL) {
         (void)m_renew_maybe(byte, parser.cur_chunk,
@@ -1363,7 +1363,8 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     }
 
     if (
-        lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
+        // CIRCUITPY-CHANGE: one_stmt
+        (!one_stmt && lex->tok_kind != MP_TOKEN_END) // check we are at the end of the token stream
         || parser.result_stack_top == 0 // check that we got a node (can fail on empty input)
         ) {
     syntax_error:;
@@ -1400,11 +1401,44 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     m_del(rule_stack_t, parser.rule_stack, parser.rule_stack_alloc);
     m_del(mp_parse_node_t, parser.result_stack, parser.result_stack_alloc);
 
+    return parser.tree;
+}
+
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    // Set exception handler to free the lexer if an exception is raised.
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_CONST
+    mp_map_t consts;
+    mp_map_init(&consts, 0);
+    mp_parse_tree_t tree = mp_parse_helper(lex, input_kind, &consts, false);
+    mp_map_deinit(&consts);
+    #else
+    mp_parse_tree_t tree = mp_parse_helper(lex, input_kind, NULL, false);
+    #endif
+
     // Deregister exception handler and free the lexer.
     nlr_pop_jump_callback(true);
 
-    return parser.tree;
+    return tree;
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_INCREMENTAL
+bool mp_parse_next_stmt(mp_lexer_t *lex, mp_map_t *consts, mp_parse_tree_t *tree) {
+    // skip blank lines between statements
+    while (lex->tok_kind == MP_TOKEN_NEWLINE) {
+        mp_lexer_to_next(lex);
+    }
+    if (lex->tok_kind == MP_TOKEN_END) {
+        return false;
+    }
+    *tree = mp_parse_helper(lex, MP_PARSE_FILE_INPUT, consts, true);
+    return true;
 }
+#endif
 
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
     mp_parse_chunk_t *chunk = tree->chunk;
@@ -111,6 +111,15 @@ typedef struct _mp_parse_t {
 // the parser will raise an exception if an error occurred
 // the parser will free the lexer before it returns
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_INCREMENTAL
+// Parse the next top-level statement of file input, so that a file can be
+// compiled and run one statement at a time. Returns false at the end of the
+// input. Unlike mp_parse the lexer isn't freed. consts holds the values from
+// const() and must be passed to each call for the same file.
+bool mp_parse_next_stmt(struct _mp_lexer_t *lex, mp_map_t *consts, mp_parse_tree_t *tree);
+#endif
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
 #endif // MICROPY_INCLUDED_PY_PARSE_H
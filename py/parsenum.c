@@ -31,6 +31,8 @@
 #include "py/parsenumbase.h"
 #include "py/parsenum.h"
 #include "py/smallint.h"
+// CIRCUITPY-CHANGE
+#include "py/formatfloat.h"
 
 #if MICROPY_PY_BUILTINS_FLOAT
 #include <math.h>
@@ -215,6 +217,126 @@ static void accept_digit(mp_float_t *p_dec_val, int dig, int *p_exp_extra, int i
         }
     }
 }
+
+// CIRCUITPY-CHANGE
+#if MICROPY_FLOAT_FAST_CONVERSION
+// The largest integer that all smaller ones are exact floats.
+#define FAST_MANT_MAX ((uint64_t)1 << (MP_FLOAT_FRAC_BITS + 1))
+
+static const mp_float_t pow10_exact[EXACT_POWER_OF_10 + 1] = {
+    MICROPY_FLOAT_CONST(1e0), MICROPY_FLOAT_CONST(1e1), MICROPY_FLOAT_CONST(1e2),
+    MICROPY_FLOAT_CONST(1e3), MICROPY_FLOAT_CONST(1e4), MICROPY_FLOAT_CONST(1e5),
+    MICROPY_FLOAT_CONST(1e6), MICROPY_FLOAT_CONST(1e7), MICROPY_FLOAT_CONST(1e8),
+    MICROPY_FLOAT_CONST(1e9),
+    #if EXACT_POWER_OF_10 > 9
+    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    #endif
+};
+
+// A decimal's first 19 significant digits, gathered in an integer. If they
+// fit exactly in a float and the exponent is small, the result is one
+// correctly rounded multiply or divide by an exact power of ten (Clinger's
+// fast path). Otherwise mp_float_from_decimal() does it with integers; if
+// digits were cut off, it must give the same float for both ends of the range
+// the value lies in. Returns false, leaving *str_in alone, to use the general
+// way.
+static bool parse_dec_fast(const char **str_in, const char *top, mp_float_t *val) {
+    const char *str = *str_in;
+    uint64_t mant = 0;
+    int num_digits = 0;
+    int zeros = 0;
+    int exp = 0;
+    bool any_digits = false;
+    bool in_frac = false;
+    bool cut = false;
+    for (; str < top; str++) {
+        unsigned int dig = *str;
+        if ('0' <= dig && dig <= '9') {
+            any_digits = true;
+            exp -= in_frac;
+            if (dig == '0') {
+                // Held back, in case they're trailing zeros.
+                zeros += mant != 0;
+                continue;
+            }
+            if (num_digits + zeros >= 19) {
+                // Dropped, but keep the scale.
+                exp++;
+                cut = true;
+                continue;
+            }
+            for (; zeros > 0; zeros--) {
+                mant *= 10;
+                num_digits++;
+            }
+            mant = 10 * mant + (dig - '0');
+            num_digits++;
+        } else if (dig == '.' && !in_frac) {
+            in_frac = true;
+        } else {
+            break;
+        }
+    }
+    if (!any_digits) {
+        return false;
+    }
+    if (str < top && (*str | 0x20) == 'e') {
+        str++;
+        bool exp_neg = false;
+        if (str < top && (*str == '+' || *str == '-')) {
+            exp_neg = *str++ == '-';
+        }
+        if (str == top || !unichar_isdigit(*str)) {
+            return false;
+        }
+        int exp_val = 0;
+        for (; str < top && unichar_isdigit(*str); str++) {
+            if (exp_val > 1000) {
+                return false;
+            }
+            exp_val = 10 * exp_val + (*str - '0');
+        }
+        exp += exp_neg ? -exp_val : exp_val;
+    }
+    if (str < top && *str == '_') {
+        return false;
+    }
+    exp += zeros;
+    if (mant <= FAST_MANT_MAX) {
+        // Move some of a large exponent into the digits, if they stay exact.
+        for (; exp > EXACT_POWER_OF_10 && mant * 10 <= FAST_MANT_MAX; exp--) {
+            mant *= 10;
+        }
+    }
+    if (mant == 0) {
+        *val = 0;
+    } else if (cut) {
+        // mant + 1 may be 10^19, which has too many digits.
+        uint64_t upper_mant = mant + 1;
+        int upper_exp = exp;
+        if (upper_mant % 10 == 0) {
+            upper_mant /= 10;
+            upper_exp++;
+        }
+        mp_float_t lower, upper;
+        if (!mp_float_from_decimal(mant, exp, &lower) || !mp_float_from_decimal(upper_mant, upper_exp, &upper)
+            || lower != upper) {
+            return false;
+        }
+        *val = lower;
+    } else if (mant <= FAST_MANT_MAX && exp >= -EXACT_POWER_OF_10 && exp <= EXACT_POWER_OF_10) {
+        if (exp < 0) {
+            *val = (mp_float_t)mant / pow10_exact[-exp];
+        } else {
+            *val = (mp_float_t)mant * pow10_exact[exp];
+        }
+    } else if (!mp_float_from_decimal(mant, exp, val)) {
+        return false;
+    }
+    *str_in = str;
+    return true;
+}
+#endif
 #endif // MICROPY_PY_BUILTINS_FLOAT
 
 #if MICROPY_PY_BUILTINS_COMPLEX
@@ -270,6 +392,11 @@ parse_start:
             str += 3;
             dec_val = MICROPY_FLOAT_C_FUN(nan)("");
         }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FLOAT_FAST_CONVERSION
+    } else if (parse_dec_fast(&str, top, &dec_val)) {
+        // short decimal, done
+    #endif
     } else {
         // string should be a decimal number
         parse_dec_in_t in = PARSE_DEC_IN_INTG;
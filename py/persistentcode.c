@@ -174,6 +174,13 @@ static qstr load_qstr(mp_reader_t *reader) {
         return len >> 1;
     }
     len >>= 1;
+    // CIRCUITPY-CHANGE: intern qstr data that is in ROM without copying it
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    const char *rom_str = (const char *)mp_reader_try_read_rom(reader, len + 1);
+    if (rom_str != NULL) {
+        return qstr_from_strn_static(rom_str, len);
+    }
+    #endif
     char *str = m_new(char, len);
     read_bytes(reader, (byte *)str, len);
     read_byte(reader); // read and discard null terminator
@@ -250,10 +257,17 @@ static mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     #endif
 
     if (kind == MP_CODE_BYTECODE) {
-        // Allocate memory for the bytecode
-        fun_data = m_new(uint8_t, fun_data_len);
-        // Load bytecode
-        read_bytes(reader, fun_data, fun_data_len);
+        // CIRCUITPY-CHANGE: execute bytecode that is in ROM in place
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+        fun_data = (uint8_t *)mp_reader_try_read_rom(reader, fun_data_len);
+        if (fun_data == NULL)
+        #endif
+        {
+            // Allocate memory for the bytecode
+            fun_data = m_new(uint8_t, fun_data_len);
+            // Load bytecode
+            read_bytes(reader, fun_data, fun_data_len);
+        }
 
     #if MICROPY_EMIT_MACHINE_CODE
     } else {
@@ -412,7 +426,9 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
     if (header[0] != 'C'
         || header[1] != MPY_VERSION
         || (arch != MP_NATIVE_ARCH_NONE && MPY_FEATURE_DECODE_SUB_VERSION(header[2]) != MPY_SUB_VERSION)
-        || header[3] > MP_SMALL_INT_BITS) {
+        || header[3] > MP_SMALL_INT_BITS
+        // CIRCUITPY-CHANGE
+        || (!MICROPY_OPT_SUPERINSTRUCTIONS && (header[2] & MPY_FEATURE_SUPERINSTRUCTIONS))) {
         mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
     }
     if (MPY_FEATURE_DECODE_ARCH(header[2]) != MP_NATIVE_ARCH_NONE) {
@@ -608,12 +624,14 @@ void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print) {
     // CIRCUITPY-CHANGE
     //  byte  'C' (CIRCUITPY)
     //  byte  version
-    //  byte  native arch (and sub-version if native)
+    //  byte  native arch (and sub-version if native), and whether the
+    //        bytecode may contain superinstructions
     //  byte  number of bits in a small int
     byte header[4] = {
         'C',
         MPY_VERSION,
-        cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0,
+        (cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0)
+        | (MICROPY_OPT_SUPERINSTRUCTIONS ? MPY_FEATURE_SUPERINSTRUCTIONS : 0),
         #if MICROPY_DYNAMIC_COMPILER
         mp_dynamic_compiler.small_int_bits,
         #else
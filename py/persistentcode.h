@@ -45,7 +45,13 @@
 
 // Macros to encode/decode native architecture to/from the feature byte
 #define MPY_FEATURE_ENCODE_ARCH(arch) ((arch) << 2)
-#define MPY_FEATURE_DECODE_ARCH(feat) ((feat) >> 2)
+// CIRCUITPY-CHANGE: bit 7 is MPY_FEATURE_SUPERINSTRUCTIONS
+#define MPY_FEATURE_DECODE_ARCH(feat) (((feat) >> 2) & 0x1f)
+
+// CIRCUITPY-CHANGE: Set in the feature byte when the bytecode may contain the
+// fused opcodes of MICROPY_OPT_SUPERINSTRUCTIONS, which only builds with that
+// option can run.
+#define MPY_FEATURE_SUPERINSTRUCTIONS (0x80)
 
 // Define the host architecture
 #if MICROPY_EMIT_X86
@@ -71,6 +77,9 @@
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_XTENSA)
 #elif MICROPY_EMIT_XTENSAWIN
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_XTENSAWIN)
+// CIRCUITPY-CHANGE
+#elif MICROPY_EMIT_RV32
+    #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_RV32IMC)
 #else
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_NONE)
 #endif
@@ -95,6 +104,8 @@ enum {
     MP_NATIVE_ARCH_ARMV7EMDP,
     MP_NATIVE_ARCH_XTENSA,
     MP_NATIVE_ARCH_XTENSAWIN,
+    // CIRCUITPY-CHANGE
+    MP_NATIVE_ARCH_RV32IMC,
 };
 
 enum {
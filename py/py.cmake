@@ -9,6 +9,7 @@ set(MICROPY_SOURCE_PY
     ${MICROPY_PY_DIR}/argcheck.c
     ${MICROPY_PY_DIR}/asmarm.c
     ${MICROPY_PY_DIR}/asmbase.c
+    ${MICROPY_PY_DIR}/asmrv32.c
     ${MICROPY_PY_DIR}/asmthumb.c
     ${MICROPY_PY_DIR}/asmx64.c
     ${MICROPY_PY_DIR}/asmx86.c
@@ -25,6 +26,7 @@ set(MICROPY_SOURCE_PY
     ${MICROPY_PY_DIR}/emitinlinethumb.c
     ${MICROPY_PY_DIR}/emitinlinextensa.c
     ${MICROPY_PY_DIR}/emitnarm.c
+    ${MICROPY_PY_DIR}/emitnrv32.c
     ${MICROPY_PY_DIR}/emitnthumb.c
     ${MICROPY_PY_DIR}/emitnx64.c
     ${MICROPY_PY_DIR}/emitnx86.c
@@ -55,6 +57,7 @@ set(MICROPY_SOURCE_PY
     ${MICROPY_PY_DIR}/nlr.c
     ${MICROPY_PY_DIR}/nlrmips.c
     ${MICROPY_PY_DIR}/nlrpowerpc.c
+    ${MICROPY_PY_DIR}/nlrrv32.c
     ${MICROPY_PY_DIR}/nlrsetjmp.c
     ${MICROPY_PY_DIR}/nlrthumb.c
     ${MICROPY_PY_DIR}/nlrx64.c
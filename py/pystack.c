@@ -34,6 +34,10 @@ void mp_pystack_init(void *start, void *end) {
     MP_STATE_THREAD(pystack_start) = start;
     MP_STATE_THREAD(pystack_end) = end;
     MP_STATE_THREAD(pystack_cur) = start;
+    // CIRCUITPY-CHANGE: provide max pystack usage
+    #if MICROPY_MAX_STACK_USAGE
+    MP_STATE_THREAD(pystack_max) = start;
+    #endif
 }
 
 // CIRCUITPY-CHANGE: PLACE_IN_ITCM
@@ -48,6 +52,12 @@ void *PLACE_IN_ITCM(mp_pystack_alloc)(size_t n_bytes) {
     }
     void *ptr = MP_STATE_THREAD(pystack_cur);
     MP_STATE_THREAD(pystack_cur) += n_bytes;
+    // CIRCUITPY-CHANGE: provide max pystack usage
+    #if MICROPY_MAX_STACK_USAGE
+    if (MP_STATE_THREAD(pystack_cur) > MP_STATE_THREAD(pystack_max)) {
+        MP_STATE_THREAD(pystack_max) = MP_STATE_THREAD(pystack_cur);
+    }
+    #endif
     #if MP_PYSTACK_DEBUG
     *(size_t *)(MP_STATE_THREAD(pystack_cur) - MICROPY_PYSTACK_ALIGN) = n_bytes;
     #endif
@@ -61,12 +61,18 @@
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
 // this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+// CIRCUITPY-CHANGE: split into the unmasked hash, whose low bits also place
+// qstrs in a pool index, and the masking that gives the stored hash.
+static size_t qstr_compute_unmasked_hash(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+static size_t qstr_mask_hash(size_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -75,6 +81,26 @@ size_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_mask_hash(qstr_compute_unmasked_hash(data, len));
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_QSTR_POOL_INDEX
+// Number of index slots for a runtime pool of the given size, at most 3/4 full
+// like the ROM pool indexes. Returns 0 if the pool is too big to index.
+static size_t qstr_pool_index_slots(size_t alloc) {
+    if (alloc >= 0xffff / 2) {
+        return 0;
+    }
+    size_t num_slots = 4;
+    while (num_slots * 3 < alloc * 4) {
+        num_slots *= 2;
+    }
+    return num_slots;
+}
+#endif
+
 // The first pool is the static qstr table. The contents must remain stable as
 // it is part of the .mpy ABI. See the top of py/persistentcode.c and
 // static_qstr_list in makeqstrdata.py. This pool is unsorted (although in a
@@ -97,6 +123,23 @@ const qstr_hash_t mp_qstr_const_hashes_static[] = {
 };
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_QSTR_POOL_INDEX
+static const uint16_t mp_qstr_const_index_static[] = {
+    #ifndef NO_QSTR
+#define QDEF0(id, hash, len, str)
+#define QDEF1(id, hash, len, str)
+#define TRANSLATION(id, length, compressed ...)
+#define QINDEX0(slot) slot,
+    #include "genhdr/qstrdefs.generated.h"
+#undef QDEF0
+#undef QDEF1
+#undef TRANSLATION
+#undef QINDEX0
+    #endif
+};
+#endif
+
 const qstr_len_t mp_qstr_const_lengths_static[] = {
     #ifndef NO_QSTR
 #define QDEF0(id, hash, len, str) len,
@@ -121,6 +164,10 @@ const qstr_pool_t mp_qstr_const_pool_static = {
     (qstr_hash_t *)mp_qstr_const_hashes_static,
     #endif
     (qstr_len_t *)mp_qstr_const_lengths_static,
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_POOL_INDEX
+    (uint16_t *)mp_qstr_const_index_static,
+    #endif
     {
         #ifndef NO_QSTR
 #define QDEF0(id, hash, len, str) str,
@@ -154,6 +201,23 @@ const qstr_hash_t mp_qstr_const_hashes[] = {
 };
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_QSTR_POOL_INDEX
+static const uint16_t mp_qstr_const_index[] = {
+    #ifndef NO_QSTR
+#define QDEF0(id, hash, len, str)
+#define QDEF1(id, hash, len, str)
+#define TRANSLATION(id, length, compressed ...)
+#define QINDEX1(slot) slot,
+    #include "genhdr/qstrdefs.generated.h"
+#undef QDEF0
+#undef QDEF1
+#undef TRANSLATION
+#undef QINDEX1
+    #endif
+};
+#endif
+
 const qstr_len_t mp_qstr_const_lengths[] = {
     #ifndef NO_QSTR
 #define QDEF0(id, hash, len, str)
@@ -178,6 +242,10 @@ const qstr_pool_t mp_qstr_const_pool = {
     (qstr_hash_t *)mp_qstr_const_hashes,
     #endif
     (qstr_len_t *)mp_qstr_const_lengths,
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_POOL_INDEX
+    (uint16_t *)mp_qstr_const_index,
+    #endif
     {
         #ifndef NO_QSTR
 #define QDEF0(id, hash, len, str)
@@ -230,8 +298,16 @@ static const qstr_pool_t *find_qstr(qstr *q) {
 
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_POOL_INDEX
+    size_t unmasked_hash = qstr_compute_unmasked_hash((const byte *)q_ptr, len);
+    #endif
     #if MICROPY_QSTR_BYTES_IN_HASH
+    #if MICROPY_QSTR_POOL_INDEX
+    mp_uint_t hash = qstr_mask_hash(unmasked_hash);
+    #else
     mp_uint_t hash = qstr_compute_hash((const byte *)q_ptr, len);
+    #endif
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
     #else
     DEBUG_printf("QSTR: add len=%d data=%.*s\n", len, len, q_ptr);
@@ -250,6 +326,13 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
                 + sizeof(qstr_hash_t)
                 #endif
                 + sizeof(qstr_len_t)) * new_alloc;
+        // CIRCUITPY-CHANGE: the index goes straight after the qstr pointers
+        #if MICROPY_QSTR_POOL_INDEX
+        size_t num_index_slots = qstr_pool_index_slots(new_alloc);
+        if (num_index_slots != 0) {
+            pool_size += sizeof(uint16_t) * (1 + num_index_slots);
+        }
+        #endif
         qstr_pool_t *pool = (qstr_pool_t *)m_malloc_maybe(pool_size);
         if (pool == NULL) {
             // Keep qstr_last_chunk consistent with qstr_pool_t: qstr_last_chunk is not scanned
@@ -261,11 +344,23 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
             QSTR_EXIT();
             m_malloc_fail(new_alloc);
         }
+        // CIRCUITPY-CHANGE
+        void *pool_arrays = pool->qstrs + new_alloc;
+        #if MICROPY_QSTR_POOL_INDEX
+        if (num_index_slots != 0) {
+            pool->index = pool_arrays;
+            pool->index[0] = num_index_slots - 1;
+            memset(pool->index + 1, 0, sizeof(uint16_t) * num_index_slots);
+            pool_arrays = pool->index + 1 + num_index_slots;
+        } else {
+            pool->index = NULL;
+        }
+        #endif
         #if MICROPY_QSTR_BYTES_IN_HASH
-        pool->hashes = (qstr_hash_t *)(pool->qstrs + new_alloc);
+        pool->hashes = (qstr_hash_t *)pool_arrays;
         pool->lengths = (qstr_len_t *)(pool->hashes + new_alloc);
         #else
-        pool->lengths = (qstr_len_t *)(pool->qstrs + new_alloc);
+        pool->lengths = (qstr_len_t *)pool_arrays;
         #endif
         pool->prev = MP_STATE_VM(last_pool);
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
@@ -283,6 +378,18 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->lengths[at] = len;
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_POOL_INDEX
+    uint16_t *index = MP_STATE_VM(last_pool)->index;
+    if (index != NULL) {
+        size_t mask = index[0];
+        size_t i = unmasked_hash & mask;
+        while (index[1 + i] != 0) {
+            i = (i + 1) & mask;
+        }
+        index[1 + i] = at + 1;
+    }
+    #endif
 
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
@@ -294,13 +401,44 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
         return MP_QSTR_;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_POOL_INDEX
+    size_t unmasked_hash = qstr_compute_unmasked_hash((const byte *)str, str_len);
+    #endif
     #if MICROPY_QSTR_BYTES_IN_HASH
     // work out hash of str
+    #if MICROPY_QSTR_POOL_INDEX
+    size_t str_hash = qstr_mask_hash(unmasked_hash);
+    #else
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
+    #endif
 
     // search pools for the data
     for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+        // CIRCUITPY-CHANGE: probe the pool's index, if it has one
+        #if MICROPY_QSTR_POOL_INDEX
+        if (pool->index != NULL) {
+            size_t mask = pool->index[0];
+            for (size_t i = unmasked_hash & mask;; i = (i + 1) & mask) {
+                size_t at = pool->index[1 + i];
+                if (at == 0) {
+                    break;
+                }
+                at -= 1;
+                if (
+                    #if MICROPY_QSTR_BYTES_IN_HASH
+                    pool->hashes[at] == str_hash &&
+                    #endif
+                    pool->lengths[at] == str_len
+                    && memcmp(pool->qstrs[at], str, str_len) == 0) {
+                    return pool->total_prev_len + at;
+                }
+            }
+            continue;
+        }
+        #endif
+
         size_t low = 0;
         size_t high = pool->len - 1;
 
@@ -338,7 +476,8 @@ qstr qstr_from_str(const char *str) {
     return qstr_from_strn(str, strlen(str));
 }
 
-qstr qstr_from_strn(const char *str, size_t len) {
+// CIRCUITPY-CHANGE: factored out of qstr_from_strn to support static data
+static qstr qstr_from_strn_helper(const char *str, size_t len, bool data_is_static) {
     QSTR_ENTER();
     qstr q = qstr_find_strn(str, len);
     if (q == 0) {
@@ -350,6 +489,14 @@ qstr qstr_from_strn(const char *str, size_t len) {
             mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("name too long"));
         }
 
+        if (data_is_static) {
+            // the data is null terminated and will outlive the qstr, so use it in place
+            assert(str[len] == '\0');
+            q = qstr_add(len, str);
+            QSTR_EXIT();
+            return q;
+        }
+
         // compute number of bytes needed to intern this string
         size_t n_bytes = len + 1;
 
@@ -399,6 +546,14 @@ qstr qstr_from_strn(const char *str, size_t len) {
     return q;
 }
 
+qstr qstr_from_strn(const char *str, size_t len) {
+    return qstr_from_strn_helper(str, len, false);
+}
+
+qstr qstr_from_strn_static(const char *str, size_t len) {
+    return qstr_from_strn_helper(str, len, true);
+}
+
 mp_uint_t qstr_hash(qstr q) {
     const qstr_pool_t *pool = find_qstr(&q);
     #if MICROPY_QSTR_BYTES_IN_HASH
@@ -445,6 +600,12 @@ void qstr_pool_info(size_t *n_pool, size_t *n_qstr, size_t *n_str_data_bytes, si
                 + sizeof(qstr_hash_t)
                 #endif
                 + sizeof(qstr_len_t)) * pool->alloc;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_QSTR_POOL_INDEX
+        if (pool->index != NULL) {
+            *n_total_bytes += sizeof(uint16_t) * (1 + qstr_pool_index_slots(pool->alloc));
+        }
+        #endif
         #endif
     }
     *n_total_bytes += *n_str_data_bytes;
@@ -92,6 +92,12 @@ typedef struct _qstr_pool_t {
     qstr_hash_t *hashes;
     #endif
     qstr_len_t *lengths;
+    // CIRCUITPY-CHANGE: hash index of the pool, or NULL to search it linearly.
+    // index[0] is the slot mask, then each slot is 0 or the 1-based position
+    // of a qstr in the pool; see make_pool_index in makeqstrdata.py.
+    #if MICROPY_QSTR_POOL_INDEX
+    uint16_t *index;
+    #endif
     const char *qstrs[];
 } qstr_pool_t;
 
@@ -107,6 +113,10 @@ qstr qstr_find_strn(const char *str, size_t str_len); // returns MP_QSTRnull if
 
 qstr qstr_from_str(const char *str);
 qstr qstr_from_strn(const char *str, size_t len);
+// CIRCUITPY-CHANGE
+// Like qstr_from_strn but str, which must be null terminated, is referenced
+// rather than copied, so it must never be freed or modified.
+qstr qstr_from_strn_static(const char *str, size_t len);
 
 mp_uint_t qstr_hash(qstr q);
 const char *qstr_str(qstr q);
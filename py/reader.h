@@ -33,6 +33,11 @@
 // it can be called again after returning MP_READER_EOF, and in that case must return MP_READER_EOF
 #define MP_READER_EOF ((mp_uint_t)(-1))
 
+// CIRCUITPY-CHANGE
+// Pass as free_len to mp_reader_new_mem() if buf is read-only memory that
+// outlives anything loaded from it, so the data can be used in place.
+#define MP_READER_IS_ROM ((size_t)-1)
+
 typedef struct _mp_reader_t {
     void *data;
     mp_uint_t (*readbyte)(void *data);
@@ -40,6 +45,10 @@ typedef struct _mp_reader_t {
 } mp_reader_t;
 
 void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t free_len);
+// CIRCUITPY-CHANGE
+// If the reader is over ROM then skip len bytes and return a pointer to them,
+// otherwise return NULL and leave the reader unchanged.
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len);
 void mp_reader_new_file(mp_reader_t *reader, qstr filename);
 void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd);
 
@@ -74,6 +74,17 @@ MP_REGISTER_MODULE(MP_QSTR___main__, mp_module___main__);
 void mp_init(void) {
     qstr_init();
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_ATTR_CACHE
+    mp_obj_instance_attr_cache_clear();
+    #endif
+
+    // CIRCUITPY-CHANGE: pooled generator frames were in the old heap
+    #if MICROPY_PY_GENERATOR_FRAME_POOL
+    memset(MP_STATE_VM(gen_frame_pool_len), 0, sizeof(MP_STATE_VM(gen_frame_pool_len)));
+    memset(MP_STATE_VM(gen_frame_pool), 0, sizeof(MP_STATE_VM(gen_frame_pool)));
+    #endif
+
     // no pending exceptions to start with
     MP_STATE_THREAD(mp_pending_exception) = MP_OBJ_NULL;
     #if MICROPY_ENABLE_SCHEDULER
@@ -134,6 +145,18 @@ void mp_init(void) {
     MP_STATE_VM(track_reloc_code_list) = MP_OBJ_NULL;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MODULE_BUILTIN_LAZY_INIT
+    MP_STATE_VM(module_lazy_init_pending) = MP_OBJ_NULL;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_RE && MICROPY_PY_RE_CACHE_SIZE
+    for (size_t i = 0; i < MICROPY_PY_RE_CACHE_SIZE; ++i) {
+        MP_STATE_VM(re_cache[i]) = MP_OBJ_NULL;
+    }
+    #endif
+
     #if MICROPY_PY_OS_DUPTERM
     for (size_t i = 0; i < MICROPY_PY_OS_DUPTERM; ++i) {
         MP_STATE_VM(dupterm_objs[i]) = MP_OBJ_NULL;
@@ -172,6 +195,9 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACK_CODE_STATE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
@@ -1678,6 +1704,11 @@ mp_obj_t __attribute__((noinline, )) mp_import_from(mp_obj_t module, qstr name)
 void mp_import_all(mp_obj_t module) {
     DEBUG_printf("import all %p\n", module);
 
+    // CIRCUITPY-CHANGE: the names are read straight from the globals map.
+    #if MICROPY_MODULE_BUILTIN_LAZY_INIT
+    mp_module_lazy_init(module);
+    #endif
+
     // CIRCUITPY-CHANGE: displayio name changes; remove in 10.0
     #if CIRCUITPY_DISPLAYIO && CIRCUITPY_WARNINGS
     if (module == &displayio_module) {
@@ -1749,6 +1780,42 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
     return ret;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_INCREMENTAL
+void mp_parse_compile_execute_incremental(mp_lexer_t *lex, mp_obj_dict_t *globals) {
+    // set exception handler to free the lexer if an exception is raised
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(lex_ctx, mp_lexer_free, lex);
+    nlr_push_jump_callback(&lex_ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+
+    // save context
+    nlr_jump_callback_node_globals_locals_t ctx;
+    ctx.globals = mp_globals_get();
+    ctx.locals = mp_locals_get();
+
+    // set new context
+    mp_globals_set(globals);
+    mp_locals_set(globals);
+
+    // set exception handler to restore context if an exception is raised
+    nlr_push_jump_callback(&ctx.callback, mp_globals_locals_set_from_nlr_jump_callback);
+
+    // compile and execute each statement in turn; mp_compile frees its parse tree
+    qstr source_name = lex->source_name;
+    mp_map_t consts;
+    mp_map_init(&consts, 0);
+    mp_parse_tree_t parse_tree;
+    while (mp_parse_next_stmt(lex, &consts, &parse_tree)) {
+        mp_obj_t module_fun = mp_compile(&parse_tree, source_name, false);
+        mp_call_function_0(module_fun);
+    }
+    mp_map_deinit(&consts);
+
+    // deregister exception handlers, restoring the context and freeing the lexer
+    nlr_pop_jump_callback(true);
+    nlr_pop_jump_callback(true);
+}
+#endif
+
 #endif // MICROPY_ENABLE_COMPILER
 
 // CIRCUITPY-CHANGE: MP_COLD
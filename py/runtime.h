@@ -198,6 +198,12 @@ static inline void mp_thread_init_state(mp_state_thread_t *ts, size_t stack_size
     ts->nlr_jump_callback_top = NULL;
     ts->mp_pending_exception = MP_OBJ_NULL;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACK_CODE_STATE
+    // No bytecode is executing on this thread yet
+    ts->current_code_state = NULL;
+    #endif
+
     // If locals/globals are not given, inherit from main thread
     if (locals == NULL) {
         locals = mp_state_ctx.thread.dict_locals;
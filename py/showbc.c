@@ -526,6 +526,39 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        case MP_BC_LOAD_FAST_0_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_0_ATTR %s", qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_FAST_0_METHOD:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_0_METHOD %s", qstr_str(qst));
+            break;
+
+        case MP_BC_BINARY_OP_SMALL_INT_MULTI:
+        case MP_BC_BINARY_OP_SMALL_INT_MULTI + 1:
+        case MP_BC_BINARY_OP_SMALL_INT_MULTI + 2:
+        case MP_BC_BINARY_OP_SMALL_INT_MULTI + 3:
+        case MP_BC_BINARY_OP_SMALL_INT_MULTI + 4:
+        case MP_BC_BINARY_OP_SMALL_INT_MULTI + 5: {
+            static const byte small_int_ops[MP_BC_BINARY_OP_SMALL_INT_MULTI_NUM] = MP_BC_BINARY_OP_SMALL_INT_OPS;
+            mp_uint_t op = small_int_ops[ip[-1] - MP_BC_BINARY_OP_SMALL_INT_MULTI];
+            mp_int_t num = 0;
+            if ((ip[0] & 0x40) != 0) {
+                // Number is negative
+                num--;
+            }
+            do {
+                num = ((mp_uint_t)num << 7) | (*ip & 0x7f);
+            } while ((*ip++ & 0x80) != 0);
+            mp_printf(print, "BINARY_OP_SMALL_INT " UINT_FMT " %s " INT_FMT, op, qstr_str(mp_binary_op_method_name[op]), num);
+            break;
+        }
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
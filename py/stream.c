@@ -29,6 +29,8 @@
 #include <unistd.h>
 
 #include "py/objstr.h"
+// CIRCUITPY-CHANGE
+#include "py/objtype.h"
 #include "py/stream.h"
 #include "py/runtime.h"
 
@@ -358,7 +360,58 @@ static mp_obj_t stream_readall(mp_obj_t self_in) {
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_STREAMS_READLINE_CHUNK_SIZE
+// A stream that can seek is read a chunk at a time, and what follows the
+// newline is given back by seeking. Returns false, having read nothing, if the
+// stream can't seek.
+static bool stream_readline_chunked(mp_obj_t stream, const mp_stream_p_t *stream_p, mp_int_t max_size, vstr_t *vstr) {
+    struct mp_stream_seek_t seek_s = { .offset = 0, .whence = MP_SEEK_CUR };
+    int error;
+    // Only native streams are probed, a Python ioctl() can't take seek_s.
+    if (stream_p->ioctl == NULL
+        || !mp_obj_is_native_type(mp_obj_get_type(stream))
+        || stream_p->ioctl(stream, MP_STREAM_SEEK, (uintptr_t)&seek_s, &error) == MP_STREAM_ERROR) {
+        return false;
+    }
+
+    for (;;) {
+        mp_uint_t chunk = MICROPY_STREAMS_READLINE_CHUNK_SIZE;
+        if (max_size != -1 && (mp_uint_t)max_size - vstr->len < chunk) {
+            chunk = max_size - vstr->len;
+            if (chunk == 0) {
+                break;
+            }
+        }
+        char *p = vstr_add_len(vstr, chunk);
+        mp_uint_t out_sz = stream_p->read(stream, p, chunk, &error);
+        if (out_sz == MP_STREAM_ERROR) {
+            mp_raise_OSError(error);
+        }
+        char *nl = memchr(p, '\n', out_sz);
+        if (nl != NULL) {
+            mp_uint_t used = nl + 1 - p;
+            vstr_cut_tail_bytes(vstr, chunk - used);
+            if (used < out_sz) {
+                seek_s.offset = -(mp_off_t)(out_sz - used);
+                seek_s.whence = MP_SEEK_CUR;
+                if (stream_p->ioctl(stream, MP_STREAM_SEEK, (uintptr_t)&seek_s, &error) == MP_STREAM_ERROR) {
+                    mp_raise_OSError(error);
+                }
+            }
+            break;
+        }
+        vstr_cut_tail_bytes(vstr, chunk - out_sz);
+        if (out_sz == 0) {
+            break;
+        }
+    }
+    return true;
+}
+#endif
+
 // Unbuffered, inefficient implementation of readline() for raw I/O files.
+// CIRCUITPY-CHANGE: seekable streams are read in chunks.
 static mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args) {
     const mp_stream_p_t *stream_p = mp_get_stream(args[0]);
 
@@ -374,6 +427,13 @@ static mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args)
         vstr_init(&vstr, 16);
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_STREAMS_READLINE_CHUNK_SIZE
+    if (stream_readline_chunked(args[0], stream_p, max_size, &vstr)) {
+        max_size = 0;
+    }
+    #endif
+
     while (max_size == -1 || max_size-- != 0) {
         char *p = vstr_add_len(&vstr, 1);
         int error;
@@ -35,6 +35,8 @@
 #include "py/runtime.h"
 #include "py/bc0.h"
 #include "py/profile.h"
+// CIRCUITPY-CHANGE
+#include "py/smallint.h"
 
 // *FORMAT-OFF*
 
@@ -187,6 +189,24 @@
     } \
 } while(0)
 
+// CIRCUITPY-CHANGE
+#elif MICROPY_TRACK_CODE_STATE
+
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while (0)
+
+#define FRAME_ENTER() do { \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while (0)
+
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while (0)
+
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -205,6 +225,100 @@ static mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+#if MICROPY_OPT_VM_BINARY_OP_FAST_PATH
+// CIRCUITPY-CHANGE: evaluate the common arithmetic and comparison ops inline when
+// both operands are small ints, or both are floats and floats are unboxed.
+// Returns MP_OBJ_NULL if the op has to go through mp_binary_op instead.
+static inline mp_obj_t vm_binary_op_fast(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+        mp_int_t res;
+        switch (op) {
+            case MP_BINARY_OP_ADD:
+            case MP_BINARY_OP_INPLACE_ADD:
+                // Both operands are small ints so this can't overflow a machine word.
+                res = lhs_val + rhs_val;
+                break;
+            case MP_BINARY_OP_SUBTRACT:
+            case MP_BINARY_OP_INPLACE_SUBTRACT:
+                res = lhs_val - rhs_val;
+                break;
+            case MP_BINARY_OP_MULTIPLY:
+            case MP_BINARY_OP_INPLACE_MULTIPLY:
+                if (mp_small_int_mul_overflow(lhs_val, rhs_val)) {
+                    return MP_OBJ_NULL;
+                }
+                res = lhs_val * rhs_val;
+                break;
+            // The bitwise ops can't leave the small int range.
+            case MP_BINARY_OP_OR:
+            case MP_BINARY_OP_INPLACE_OR:
+                return MP_OBJ_NEW_SMALL_INT(lhs_val | rhs_val);
+            case MP_BINARY_OP_XOR:
+            case MP_BINARY_OP_INPLACE_XOR:
+                return MP_OBJ_NEW_SMALL_INT(lhs_val ^ rhs_val);
+            case MP_BINARY_OP_AND:
+            case MP_BINARY_OP_INPLACE_AND:
+                return MP_OBJ_NEW_SMALL_INT(lhs_val & rhs_val);
+            case MP_BINARY_OP_LESS:
+                return mp_obj_new_bool(lhs_val < rhs_val);
+            case MP_BINARY_OP_MORE:
+                return mp_obj_new_bool(lhs_val > rhs_val);
+            case MP_BINARY_OP_EQUAL:
+                return mp_obj_new_bool(lhs_val == rhs_val);
+            case MP_BINARY_OP_LESS_EQUAL:
+                return mp_obj_new_bool(lhs_val <= rhs_val);
+            case MP_BINARY_OP_MORE_EQUAL:
+                return mp_obj_new_bool(lhs_val >= rhs_val);
+            case MP_BINARY_OP_NOT_EQUAL:
+                return mp_obj_new_bool(lhs_val != rhs_val);
+            default:
+                return MP_OBJ_NULL;
+        }
+        if (MP_SMALL_INT_FITS(res)) {
+            return MP_OBJ_NEW_SMALL_INT(res);
+        }
+        return MP_OBJ_NULL;
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT && (MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C || MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D)
+    // Floats are encoded in the object itself so new results don't allocate.
+    if (mp_obj_is_float(lhs) && mp_obj_is_float(rhs)) {
+        mp_float_t lhs_val = mp_obj_float_get(lhs);
+        mp_float_t rhs_val = mp_obj_float_get(rhs);
+        switch (op) {
+            case MP_BINARY_OP_ADD:
+            case MP_BINARY_OP_INPLACE_ADD:
+                return mp_obj_new_float(lhs_val + rhs_val);
+            case MP_BINARY_OP_SUBTRACT:
+            case MP_BINARY_OP_INPLACE_SUBTRACT:
+                return mp_obj_new_float(lhs_val - rhs_val);
+            case MP_BINARY_OP_MULTIPLY:
+            case MP_BINARY_OP_INPLACE_MULTIPLY:
+                return mp_obj_new_float(lhs_val * rhs_val);
+            // Float equality isn't reflexive (nan != nan) so compare the values
+            // even when lhs and rhs are the same object.
+            case MP_BINARY_OP_LESS:
+                return mp_obj_new_bool(lhs_val < rhs_val);
+            case MP_BINARY_OP_MORE:
+                return mp_obj_new_bool(lhs_val > rhs_val);
+            case MP_BINARY_OP_EQUAL:
+                return mp_obj_new_bool(lhs_val == rhs_val);
+            case MP_BINARY_OP_LESS_EQUAL:
+                return mp_obj_new_bool(lhs_val <= rhs_val);
+            case MP_BINARY_OP_MORE_EQUAL:
+                return mp_obj_new_bool(lhs_val >= rhs_val);
+            case MP_BINARY_OP_NOT_EQUAL:
+                return mp_obj_new_bool(lhs_val != rhs_val);
+            default:
+                return MP_OBJ_NULL;
+        }
+    }
+    #endif
+    return MP_OBJ_NULL;
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -415,6 +529,9 @@ dispatch_loop:
                 }
 
                 ENTRY(MP_BC_LOAD_ATTR): {
+                    #if MICROPY_OPT_SUPERINSTRUCTIONS
+                    load_attr:
+                    #endif
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -442,6 +559,9 @@ dispatch_loop:
                 }
 
                 ENTRY(MP_BC_LOAD_METHOD): {
+                    #if MICROPY_OPT_SUPERINSTRUCTIONS
+                    load_method:
+                    #endif
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     mp_load_method(*sp, qst, sp);
@@ -449,6 +569,79 @@ dispatch_loop:
                     DISPATCH();
                 }
 
+                // CIRCUITPY-CHANGE: superinstructions
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_FAST_0_ATTR):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto load_attr;
+
+                ENTRY(MP_BC_LOAD_FAST_0_METHOD):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto load_method;
+
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MULTI):
+                #if !MICROPY_OPT_COMPUTED_GOTO
+                // The computed goto table maps the whole range to the entry above.
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MULTI + 1):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MULTI + 2):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MULTI + 3):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MULTI + 4):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MULTI + 5):
+                #endif
+                {
+                    MP_STATIC_ASSERT(MP_BC_BINARY_OP_SMALL_INT_MULTI_NUM == 6);
+                    static const byte small_int_ops[MP_BC_BINARY_OP_SMALL_INT_MULTI_NUM] = MP_BC_BINARY_OP_SMALL_INT_OPS;
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_binary_op_t op = small_int_ops[ip[-1] - MP_BC_BINARY_OP_SMALL_INT_MULTI];
+                    mp_uint_t num = 0;
+                    if ((ip[0] & 0x40) != 0) {
+                        // Number is negative
+                        num--;
+                    }
+                    do {
+                        num = (num << 7) | (*ip & 0x7f);
+                    } while ((*ip++ & 0x80) != 0);
+                    mp_int_t rhs = num;
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs)) {
+                        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+                        switch (op) {
+                            case MP_BINARY_OP_ADD:
+                            case MP_BINARY_OP_INPLACE_ADD:
+                            case MP_BINARY_OP_SUBTRACT: {
+                                // Both operands are small ints so this can't overflow a machine word.
+                                mp_int_t res = op == MP_BINARY_OP_SUBTRACT ? lhs_val - rhs : lhs_val + rhs;
+                                if (MP_SMALL_INT_FITS(res)) {
+                                    SET_TOP(MP_OBJ_NEW_SMALL_INT(res));
+                                    DISPATCH();
+                                }
+                                break;
+                            }
+                            case MP_BINARY_OP_LESS:
+                                SET_TOP(mp_obj_new_bool(lhs_val < rhs));
+                                DISPATCH();
+                            case MP_BINARY_OP_MORE:
+                                SET_TOP(mp_obj_new_bool(lhs_val > rhs));
+                                DISPATCH();
+                            default:
+                                assert(op == MP_BINARY_OP_EQUAL);
+                                SET_TOP(mp_obj_new_bool(lhs_val == rhs));
+                                DISPATCH();
+                        }
+                    }
+                    SET_TOP(mp_binary_op(op, lhs, MP_OBJ_NEW_SMALL_INT(rhs)));
+                    DISPATCH();
+                }
+                #endif
+
                 ENTRY(MP_BC_LOAD_SUPER_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -1306,6 +1499,14 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_VM_BINARY_OP_FAST_PATH
+                    mp_obj_t res = vm_binary_op_fast(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs);
+                    if (res != MP_OBJ_NULL) {
+                        SET_TOP(res);
+                        DISPATCH();
+                    }
+                    #endif
                     SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                     DISPATCH();
                 }
@@ -1329,6 +1530,14 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
+                        // CIRCUITPY-CHANGE
+                        #if MICROPY_OPT_VM_BINARY_OP_FAST_PATH
+                        mp_obj_t res = vm_binary_op_fast(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs);
+                        if (res != MP_OBJ_NULL) {
+                            SET_TOP(res);
+                            DISPATCH();
+                        }
+                        #endif
                         SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
@@ -1450,6 +1659,9 @@ unwind_loop:
                 #if MICROPY_CONST_GENERATOREXIT_OBJ
                 && nlr.ret_val != &mp_const_GeneratorExit_obj
                 #endif
+                #if MICROPY_STOP_ITERATION_NO_TRACEBACK
+                && ((mp_obj_base_t *)nlr.ret_val)->type != &mp_type_StopIteration
+                #endif
                 && *code_state->ip != MP_BC_END_FINALLY
                 && *code_state->ip != MP_BC_RAISE_LAST) {
                 const byte *ip = code_state->fun_bc->bytecode;
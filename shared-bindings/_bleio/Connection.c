@@ -136,6 +136,26 @@ static mp_obj_t bleio_connection_discover_remote_services(mp_uint_t n_args, cons
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_connection_discover_remote_services_obj, 1, bleio_connection_discover_remote_services);
 
+//|     def request_larger_packets(self) -> None:
+//|         """Ask the peer for the largest ATT MTU and link layer data length (data length
+//|         extension) both sides support. `max_packet_length` grows once the peer agrees.
+//|         A central already does this when it connects, so this is mostly useful from
+//|         a peripheral.
+//|
+//|         Not available on all ports."""
+//|         ...
+MP_WEAK void common_hal_bleio_connection_request_larger_packets(bleio_connection_internal_t *self) {
+}
+
+static mp_obj_t bleio_connection_request_larger_packets(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    common_hal_bleio_connection_request_larger_packets(self->connection);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_request_larger_packets_obj, bleio_connection_request_larger_packets);
+
 //|     connected: bool
 //|     """True if connected to the remote peer."""
 static mp_obj_t bleio_connection_get_connected(mp_obj_t self_in) {
@@ -216,17 +236,58 @@ MP_PROPERTY_GETSET(bleio_connection_connection_interval_obj,
 MP_PROPERTY_GETTER(bleio_connection_max_packet_length_obj,
     (mp_obj_t)&bleio_connection_get_max_packet_length_obj);
 
+//|     phy: int
+//|     """The transmit PHY data rate in Mbps, ``1`` or ``2``. The 2 Mbps PHY roughly doubles
+//|     throughput at slightly shorter range.
+//|
+//|     When setting phy, the peer may reject the new PHY and `phy` will then remain the same.
+//|     Setting it is not available on all ports."""
+//|
+MP_WEAK mp_int_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self) {
+    return 1;
+}
+
+MP_WEAK void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, mp_int_t phy) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+static mp_obj_t bleio_connection_get_phy(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_bleio_connection_get_phy(self->connection));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_get_phy_obj, bleio_connection_get_phy);
+
+static mp_obj_t bleio_connection_set_phy(mp_obj_t self_in, mp_obj_t phy_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_int_t phy = mp_arg_validate_int_range(mp_obj_get_int(phy_in), 1, 2, MP_QSTR_phy);
+
+    bleio_connection_ensure_connected(self);
+    common_hal_bleio_connection_set_phy(self->connection, phy);
+
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(bleio_connection_set_phy_obj, bleio_connection_set_phy);
+
+MP_PROPERTY_GETSET(bleio_connection_phy_obj,
+    (mp_obj_t)&bleio_connection_get_phy_obj,
+    (mp_obj_t)&bleio_connection_set_phy_obj);
+
 static const mp_rom_map_elem_t bleio_connection_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_pair),                     MP_ROM_PTR(&bleio_connection_pair_obj) },
     { MP_ROM_QSTR(MP_QSTR_disconnect),               MP_ROM_PTR(&bleio_connection_disconnect_obj) },
     { MP_ROM_QSTR(MP_QSTR_discover_remote_services), MP_ROM_PTR(&bleio_connection_discover_remote_services_obj) },
+    { MP_ROM_QSTR(MP_QSTR_request_larger_packets),   MP_ROM_PTR(&bleio_connection_request_larger_packets_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_connected),           MP_ROM_PTR(&bleio_connection_connected_obj) },
     { MP_ROM_QSTR(MP_QSTR_paired),              MP_ROM_PTR(&bleio_connection_paired_obj) },
     { MP_ROM_QSTR(MP_QSTR_connection_interval), MP_ROM_PTR(&bleio_connection_connection_interval_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_packet_length),   MP_ROM_PTR(&bleio_connection_max_packet_length_obj) },
+    { MP_ROM_QSTR(MP_QSTR_phy),                 MP_ROM_PTR(&bleio_connection_phy_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(bleio_connection_locals_dict, bleio_connection_locals_dict_table);
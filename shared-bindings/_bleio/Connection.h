@@ -23,4 +23,9 @@ mp_obj_tuple_t *common_hal_bleio_connection_discover_remote_services(bleio_conne
 mp_float_t common_hal_bleio_connection_get_connection_interval(bleio_connection_internal_t *self);
 void common_hal_bleio_connection_set_connection_interval(bleio_connection_internal_t *self, mp_float_t new_interval);
 
+// PHY data rate in Mbps.
+mp_int_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self);
+void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, mp_int_t phy);
+void common_hal_bleio_connection_request_larger_packets(bleio_connection_internal_t *self);
+
 void bleio_connection_ensure_connected(bleio_connection_obj_t *self);
@@ -146,6 +146,56 @@ static mp_obj_t bleio_packet_buffer_write(mp_uint_t n_args, const mp_obj_t *pos_
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_packet_buffer_write_obj, 1, bleio_packet_buffer_write);
 
+//|     def write_many(self, data: Sequence[ReadableBuffer], *, header: Optional[bytes] = None) -> int:
+//|         """Writes each buffer in data as `write` would, without a Python call per buffer.
+//|         Small buffers are packed together into full outgoing packets, so streaming many short
+//|         samples this way uses far fewer packets than one notification per sample. A buffer is
+//|         never split across packets.
+//|
+//|         This blocks only while waiting for room in the outgoing packets.
+//|
+//|         :return: total number of bytes written, including header bytes. Stops early if the
+//|           connection is lost.
+//|         :rtype: int"""
+//|         ...
+static mp_obj_t bleio_packet_buffer_write_many(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_header };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data,  MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_header, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none}},
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    bleio_packet_buffer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+
+    mp_buffer_info_t header_bufinfo;
+    header_bufinfo.len = 0;
+    if (args[ARG_header].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_header].u_obj, &header_bufinfo, MP_BUFFER_READ);
+    }
+
+    mp_int_t total_written = 0;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(args[ARG_data].u_obj, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_buffer_info_t data_bufinfo;
+        mp_get_buffer_raise(item, &data_bufinfo, MP_BUFFER_READ);
+        mp_int_t num_bytes_written = common_hal_bleio_packet_buffer_write(
+            self, data_bufinfo.buf, data_bufinfo.len, header_bufinfo.buf, header_bufinfo.len);
+        if (num_bytes_written < 0) {
+            // Not connected. See the note in write().
+            break;
+        }
+        total_written += num_bytes_written;
+    }
+    return MP_OBJ_NEW_SMALL_INT(total_written);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_packet_buffer_write_many_obj, 1, bleio_packet_buffer_write_many);
+
 //|     def deinit(self) -> None:
 //|         """Disable permanently."""
 //|         ...
@@ -195,6 +245,7 @@ static const mp_rom_map_elem_t bleio_packet_buffer_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_readinto),               MP_ROM_PTR(&bleio_packet_buffer_readinto_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),                  MP_ROM_PTR(&bleio_packet_buffer_write_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_write_many),             MP_ROM_PTR(&bleio_packet_buffer_write_many_obj) },
 
     { MP_OBJ_NEW_QSTR(MP_QSTR_incoming_packet_length), MP_ROM_PTR(&bleio_packet_buffer_incoming_packet_length_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_outgoing_packet_length), MP_ROM_PTR(&bleio_packet_buffer_outgoing_packet_length_obj) },
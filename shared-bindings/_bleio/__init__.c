@@ -9,6 +9,7 @@
 #include <stdarg.h>
 
 #include "py/objexcept.h"
+#include "py/objmodule.h"
 #include "py/runtime.h"
 #include "shared-bindings/_bleio/__init__.h"
 #include "shared-bindings/_bleio/Address.h"
@@ -86,7 +87,8 @@ NORETURN void mp_raise_bleio_SecurityError(mp_rom_error_text_t fmt, ...) {
     nlr_raise(exception);
 }
 
-// Called when _bleio is imported.
+// Called when _bleio is imported, or when it's first used if built-in modules
+// are initialised lazily.
 static mp_obj_t bleio___init__(void) {
 // HCI cannot be enabled on import, because we need to setup the HCI adapter first.
     common_hal_bleio_init();
@@ -166,7 +168,7 @@ static const mp_rom_map_elem_t bleio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_SecurityError),        OBJ_FROM_PTR(&mp_type_bleio_SecurityError) },
 
     // Initialization
-    { MP_ROM_QSTR(MP_QSTR___init__),             OBJ_FROM_PTR(&bleio___init___obj) },
+    { MP_ROM_QSTR(MP_QSTR_MODULE_INIT),          OBJ_FROM_PTR(&bleio___init___obj) },
 };
 
 #if CIRCUITPY_BLEIO_HCI
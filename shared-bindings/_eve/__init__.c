@@ -68,6 +68,9 @@ static MP_DEFINE_CONST_FUN_OBJ_1(flush_obj, _flush);
 //|     def cc(self, b: ReadableBuffer) -> None:
 //|         """Append bytes to the command FIFO.
 //|
+//|         Buffers larger than the command buffer, such as long blocks from
+//|         `end_block`, are written as they are without being copied.
+//|
 //|         :param ~circuitpython_typing.ReadableBuffer b: The bytes to add"""
 //|         ...
 static mp_obj_t _cc(mp_obj_t self, mp_obj_t b) {
@@ -78,6 +81,27 @@ static mp_obj_t _cc(mp_obj_t self, mp_obj_t b) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(cc_obj, _cc);
 
+//|     def begin_block(self) -> None:
+//|         """Record the commands that follow instead of sending them, until
+//|         `end_block`. Commands already queued are sent first.
+//|
+//|         A block holds commands that are the same every frame, so that they
+//|         are built once and then sent again with `cc`."""
+//|         ...
+static mp_obj_t _begin_block(mp_obj_t self) {
+    common_hal__eve_begin_block(EVEHAL(self));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(begin_block_obj, _begin_block);
+
+//|     def end_block(self) -> bytes:
+//|         """Stop recording and return the commands recorded since `begin_block`."""
+//|         ...
+static mp_obj_t _end_block(mp_obj_t self) {
+    return common_hal__eve_end_block(EVEHAL(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(end_block_obj, _end_block);
+
 // {
 
 //|     def AlphaFunc(self, func: int, ref: int) -> None:
@@ -1140,6 +1164,8 @@ static const mp_rom_map_elem_t _EVE_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_setmodel), MP_ROM_PTR(&setmodel_obj) },
     { MP_ROM_QSTR(MP_QSTR_cc), MP_ROM_PTR(&cc_obj) },
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_begin_block), MP_ROM_PTR(&begin_block_obj) },
+    { MP_ROM_QSTR(MP_QSTR_end_block), MP_ROM_PTR(&end_block_obj) },
     { MP_ROM_QSTR(MP_QSTR_Vertex2f), MP_ROM_PTR(&vertex2f_obj) },
     { MP_ROM_QSTR(MP_QSTR_cmd), MP_ROM_PTR(&cmd_obj) },
     { MP_ROM_QSTR(MP_QSTR_cmd0), MP_ROM_PTR(&cmd0_obj) },
@@ -1151,6 +1177,7 @@ static mp_obj_t _EVE_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
     // mp_arg_check_num(n_args, kw_args, 1, 1, false);
     mp_obj__EVE_t *o = mp_obj_malloc(mp_obj__EVE_t, &_EVE_type);
     o->_eve.n = 0;
+    o->_eve.block = NULL;
     o->_eve.vscale = 16;
     o->_eve.model = 0;  // default is legacy behavior
     return MP_OBJ_FROM_PTR(o);
@@ -10,6 +10,8 @@
 
 void common_hal__eve_flush(common_hal__eve_t *eve);
 void common_hal__eve_add(common_hal__eve_t *eve, size_t len, void *buf);
+void common_hal__eve_begin_block(common_hal__eve_t *eve);
+mp_obj_t common_hal__eve_end_block(common_hal__eve_t *eve);
 void common_hal__eve_Vertex2f(common_hal__eve_t *eve, mp_float_t x, mp_float_t y);
 
 void common_hal__eve_AlphaFunc(common_hal__eve_t *eve, uint32_t func, uint32_t ref);
@@ -209,7 +209,6 @@ MP_DEFINE_CONST_FUN_OBJ_KW(adafruit_bus_device_i2cdevice_write_obj, 1, adafruit_
 //|         :param int in_end: end of ``in_buffer slice``; if not specified, use ``len(in_buffer)``
 //|         """
 //|         ...
-//|
 static mp_obj_t adafruit_bus_device_i2cdevice_write_then_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_out_buffer, ARG_in_buffer, ARG_out_start, ARG_out_end, ARG_in_start, ARG_in_end };
     static const mp_arg_t allowed_args[] = {
@@ -254,12 +253,39 @@ static mp_obj_t adafruit_bus_device_i2cdevice_write_then_readinto(size_t n_args,
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(adafruit_bus_device_i2cdevice_write_then_readinto_obj, 1, adafruit_bus_device_i2cdevice_write_then_readinto);
 
+//|     def transaction(
+//|         self,
+//|         segments: Sequence[Union[Tuple[Optional[ReadableBuffer], Optional[WriteableBuffer]], int]],
+//|     ) -> None:
+//|         """Run a list of transfers with the device while holding the bus lock, without
+//|         returning to Python between them. Each segment is one of:
+//|
+//|         * ``(out_buffer, None)`` writes ``out_buffer``, then transmits a stop bit
+//|         * ``(None, in_buffer)`` reads into ``in_buffer``
+//|         * ``(out_buffer, in_buffer)`` is the same as `write_then_readinto`
+//|         * an ``int`` waits that many microseconds
+//|
+//|         All segments are checked before anything is sent.
+//|         """
+//|         ...
+//|
+static mp_obj_t adafruit_bus_device_i2cdevice_transaction(mp_obj_t self_in, mp_obj_t segments) {
+    adafruit_bus_device_i2cdevice_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n;
+    mp_obj_t *items;
+    mp_obj_get_array(segments, &n, &items);
+    common_hal_adafruit_bus_device_i2cdevice_transaction(self, n, items);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(adafruit_bus_device_i2cdevice_transaction_obj, adafruit_bus_device_i2cdevice_transaction);
+
 static const mp_rom_map_elem_t adafruit_bus_device_i2cdevice_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&adafruit_bus_device_i2cdevice___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&adafruit_bus_device_i2cdevice___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_then_readinto), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_write_then_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transaction), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_transaction_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(adafruit_bus_device_i2cdevice_locals_dict, adafruit_bus_device_i2cdevice_locals_dict_table);
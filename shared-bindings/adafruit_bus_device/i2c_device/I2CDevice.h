@@ -26,3 +26,4 @@ extern void common_hal_adafruit_bus_device_i2cdevice_construct(adafruit_bus_devi
 extern void common_hal_adafruit_bus_device_i2cdevice_lock(adafruit_bus_device_i2cdevice_obj_t *self);
 extern void common_hal_adafruit_bus_device_i2cdevice_unlock(adafruit_bus_device_i2cdevice_obj_t *self);
 extern void common_hal_adafruit_bus_device_i2cdevice_probe_for_device(adafruit_bus_device_i2cdevice_obj_t *self);
+extern void common_hal_adafruit_bus_device_i2cdevice_transaction(adafruit_bus_device_i2cdevice_obj_t *self, size_t n, const mp_obj_t *segments);
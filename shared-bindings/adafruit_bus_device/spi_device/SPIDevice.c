@@ -108,16 +108,55 @@ static MP_DEFINE_CONST_FUN_OBJ_1(adafruit_bus_device_spidevice___enter___obj, ad
 //|         """Ends a SPI transaction by deasserting chip select. See
 //|         :ref:`lifetime-and-contextmanagers` for more info."""
 //|         ...
-//|
 static mp_obj_t adafruit_bus_device_spidevice_obj___exit__(size_t n_args, const mp_obj_t *args) {
     common_hal_adafruit_bus_device_spidevice_exit(MP_OBJ_TO_PTR(args[0]));
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(adafruit_bus_device_spidevice___exit___obj, 4, 4, adafruit_bus_device_spidevice_obj___exit__);
 
+//|     def transaction(
+//|         self,
+//|         segments: Sequence[
+//|             Union[
+//|                 Tuple[Optional[ReadableBuffer], Optional[WriteableBuffer]], int, None
+//|             ]
+//|         ],
+//|     ) -> None:
+//|         """Run a list of transfers as one transaction, without returning to Python
+//|         between them. The bus is locked, configured and chip select asserted once for
+//|         the whole list. Each segment is one of:
+//|
+//|         * ``(out_buffer, None)`` writes ``out_buffer``
+//|         * ``(None, in_buffer)`` reads into ``in_buffer``
+//|         * ``(out_buffer, in_buffer)`` writes and reads at the same time. The buffers must
+//|           be the same length.
+//|         * an ``int`` waits that many microseconds
+//|         * ``None`` deasserts chip select and asserts it again
+//|
+//|         All segments are checked before anything is sent.
+//|
+//|         Example::
+//|
+//|             cmd = bytes((0x80 | 0x28,))
+//|             accel = bytearray(6)
+//|             device.transaction(((cmd, None), (None, accel)))
+//|         """
+//|         ...
+//|
+static mp_obj_t adafruit_bus_device_spidevice_transaction(mp_obj_t self_in, mp_obj_t segments) {
+    adafruit_bus_device_spidevice_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n;
+    mp_obj_t *items;
+    mp_obj_get_array(segments, &n, &items);
+    common_hal_adafruit_bus_device_spidevice_transaction(self, n, items);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(adafruit_bus_device_spidevice_transaction_obj, adafruit_bus_device_spidevice_transaction);
+
 static const mp_rom_map_elem_t adafruit_bus_device_spidevice_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&adafruit_bus_device_spidevice___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&adafruit_bus_device_spidevice___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_transaction), MP_ROM_PTR(&adafruit_bus_device_spidevice_transaction_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(adafruit_bus_device_spidevice_locals_dict, adafruit_bus_device_spidevice_locals_dict_table);
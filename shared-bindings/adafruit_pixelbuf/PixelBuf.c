@@ -18,7 +18,6 @@
 
 #include "shared-bindings/adafruit_pixelbuf/PixelBuf.h"
 #include "shared-module/adafruit_pixelbuf/PixelBuf.h"
-#include "shared-bindings/digitalio/DigitalInOut.h"
 
 #if CIRCUITPY_ULAB
 #include "extmod/ulab/code/ndarray.h"
@@ -64,7 +63,7 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
 static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_size, ARG_byteorder, ARG_brightness, ARG_auto_write, ARG_header, ARG_trailer };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
         { MP_QSTR_byteorder, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_BGR) } },
         { MP_QSTR_brightness, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_auto_write, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
@@ -89,7 +88,7 @@ static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         trailer_bufinfo.len = 0;
     }
 
-    float brightness = 1.0;
+    mp_float_t brightness = MICROPY_FLOAT_CONST(1.0);
     if (args[ARG_brightness].u_obj != mp_const_none) {
         brightness = mp_obj_get_float(args[ARG_brightness].u_obj);
         if (brightness < 0) {
@@ -242,6 +241,51 @@ static mp_obj_t pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t value) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_fill);
 
+//|     def set_pixels_from_buffer(self, buffer: ReadableBuffer, byteorder: Optional[str] = None) -> None:
+//|         """Sets pixels from the start of the pixelbuf to the bytes in ``buffer``, which holds
+//|         one pixel after another in the given byteorder. This is much faster than setting them
+//|         one at a time from Python, and brightness is applied to all of them by `show`.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer buffer: Pixel bytes. It may hold fewer
+//|           pixels than the pixelbuf, but not more.
+//|         :param str byteorder: Byte order string of ``buffer``, such as "RGB" or "GRBW".
+//|           Defaults to "RGBW" when the pixelbuf has white, and "RGB" otherwise. When it has
+//|           no white, white is 0, or full brightness for DotStars. A ``P`` or ``W`` byte is
+//|           DotStar brightness from 0 to 255."""
+//|         ...
+//|
+static mp_obj_t pixelbuf_pixelbuf_set_pixels_from_buffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_byteorder };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_byteorder, MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t self_in = pos_args[0];
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    mp_obj_t byteorder = args[ARG_byteorder].u_obj;
+    if (byteorder == mp_const_none) {
+        mp_obj_t self_byteorder = common_hal_adafruit_pixelbuf_pixelbuf_get_byteorder_string(self_in);
+        byteorder = MP_OBJ_NEW_QSTR(strchr(mp_obj_str_get_str(self_byteorder), 'W') ? MP_QSTR_RGBW : MP_QSTR_RGB);
+    }
+    pixelbuf_byteorder_details_t byteorder_details;
+    parse_byteorder(byteorder, &byteorder_details);
+
+    if (bufinfo.len % byteorder_details.bpp != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), byteorder_details.bpp);
+    }
+    mp_arg_validate_length_max(bufinfo.len / byteorder_details.bpp,
+        common_hal_adafruit_pixelbuf_pixelbuf_get_len(self_in), MP_QSTR_buffer);
+
+    common_hal_adafruit_pixelbuf_pixelbuf_set_pixels_from_buffer(self_in, bufinfo.buf, bufinfo.len, &byteorder_details);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(pixelbuf_pixelbuf_set_pixels_from_buffer_obj, 1, pixelbuf_pixelbuf_set_pixels_from_buffer);
+
 //|     @overload
 //|     def __getitem__(self, index: slice) -> PixelReturnSequence:
 //|         """Returns the pixel value at the given index as a tuple of (Red, Green, Blue[, White]) values
@@ -345,6 +389,7 @@ static const mp_rom_map_elem_t pixelbuf_pixelbuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_byteorder), MP_ROM_PTR(&pixelbuf_pixelbuf_byteorder_str)},
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&pixelbuf_pixelbuf_show_obj)},
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_obj)},
+    { MP_ROM_QSTR(MP_QSTR_set_pixels_from_buffer), MP_ROM_PTR(&pixelbuf_pixelbuf_set_pixels_from_buffer_obj)},
 };
 
 static MP_DEFINE_CONST_DICT(pixelbuf_pixelbuf_locals_dict, pixelbuf_pixelbuf_locals_dict_table);
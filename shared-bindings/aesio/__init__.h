@@ -14,17 +14,28 @@ void common_hal_aesio_aes_construct(aesio_aes_obj_t *self,
     const uint8_t *key,
     uint32_t key_length,
     const uint8_t *iv,
+    size_t iv_length,
     int mode,
     int counter);
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self,
     const uint8_t *key,
     uint32_t key_length,
-    const uint8_t *iv);
+    const uint8_t *iv,
+    size_t iv_length);
 void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self,
     int mode);
+// src and dest may be the same buffer.
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self,
-    uint8_t *buffer,
+    const uint8_t *src,
+    uint8_t *dest,
     size_t len);
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self,
-    uint8_t *buffer,
+    const uint8_t *src,
+    uint8_t *dest,
+    size_t len);
+// GCM mode only. Returns false if encryption or decryption has started.
+bool common_hal_aesio_aes_update(aesio_aes_obj_t *self,
+    const uint8_t *data,
     size_t len);
+void common_hal_aesio_aes_digest(aesio_aes_obj_t *self,
+    uint8_t tag[AES_BLOCKLEN]);
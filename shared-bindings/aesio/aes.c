@@ -18,6 +18,7 @@
 //| MODE_ECB: int
 //| MODE_CBC: int
 //| MODE_CTR: int
+//| MODE_GCM: int
 //|
 //| class AES:
 //|     """Encrypt and decrypt AES streams"""
@@ -32,12 +33,16 @@
 //|         """Create a new AES state with the given key.
 //|
 //|         :param ~circuitpython_typing.ReadableBuffer key: A 16-, 24-, or 32-byte key
-//|         :param int mode: AES mode to use.  One of: `MODE_ECB`, `MODE_CBC`, or
-//|                          `MODE_CTR`
-//|         :param ~circuitpython_typing.ReadableBuffer IV: Initialization vector to use for CBC or CTR mode
+//|         :param int mode: AES mode to use.  One of: `MODE_ECB`, `MODE_CBC`, `MODE_CTR`
+//|                          or `MODE_GCM`
+//|         :param ~circuitpython_typing.ReadableBuffer IV: Initialization vector to use for CBC or CTR mode,
+//|                                                         or the nonce for GCM mode, which may be 1 to 16
+//|                                                         bytes long and is usually 12
 //|
 //|         Additional arguments are supported for legacy reasons.
 //|
+//|         On some boards, AES is done by a hardware engine.
+//|
 //|         Encrypting a string::
 //|
 //|           import aesio
@@ -51,6 +56,34 @@
 //|           hexlify(outp)"""
 //|         ...
 
+static void validate_mode(int mode) {
+    switch (mode) {
+        case AES_MODE_CBC:
+        case AES_MODE_ECB:
+        case AES_MODE_CTR:
+        case AES_MODE_GCM:
+            break;
+        default:
+            mp_raise_NotImplementedError(MP_ERROR_TEXT("Requested AES mode is unsupported"));
+    }
+}
+
+// The IV of GCM may be any length up to a block, and must be a block otherwise.
+static const uint8_t *get_iv(mp_obj_t iv_obj, int mode, size_t *iv_length) {
+    mp_buffer_info_t bufinfo;
+    if (iv_obj == MP_OBJ_NULL || !mp_get_buffer(iv_obj, &bufinfo, MP_BUFFER_READ)) {
+        *iv_length = 0;
+        return NULL;
+    }
+    if (mode == AES_MODE_GCM) {
+        mp_arg_validate_length_range(bufinfo.len, 1, AES_BLOCKLEN, MP_QSTR_IV);
+    } else {
+        mp_arg_validate_length(bufinfo.len, AES_BLOCKLEN, MP_QSTR_IV);
+    }
+    *iv_length = bufinfo.len;
+    return bufinfo.buf;
+}
+
 static mp_obj_t aesio_aes_make_new(const mp_obj_type_t *type, size_t n_args,
     size_t n_kw, const mp_obj_t *all_args) {
     aesio_aes_obj_t *self = mp_obj_malloc(aesio_aes_obj_t, &aesio_aes_type);
@@ -80,25 +113,13 @@ static mp_obj_t aesio_aes_make_new(const mp_obj_type_t *type, size_t n_args,
     key_length = bufinfo.len;
 
     int mode = args[ARG_mode].u_int;
-    switch (args[ARG_mode].u_int) {
-        case AES_MODE_CBC:
-        case AES_MODE_ECB:
-        case AES_MODE_CTR:
-            break;
-        default:
-            mp_raise_NotImplementedError(MP_ERROR_TEXT("Requested AES mode is unsupported"));
-    }
+    validate_mode(mode);
 
     // IV is required for CBC mode and is ignored for other modes.
-    const uint8_t *iv = NULL;
-    if (args[ARG_IV].u_obj != NULL &&
-        mp_get_buffer(args[ARG_IV].u_obj, &bufinfo, MP_BUFFER_READ)) {
-        (void)mp_arg_validate_length(bufinfo.len, AES_BLOCKLEN, MP_QSTR_IV);
-
-        iv = bufinfo.buf;
-    }
+    size_t iv_length;
+    const uint8_t *iv = get_iv(args[ARG_IV].u_obj, mode, &iv_length);
 
-    common_hal_aesio_aes_construct(self, key, key_length, iv, mode,
+    common_hal_aesio_aes_construct(self, key, key_length, iv, iv_length, mode,
         args[ARG_counter].u_int);
     return MP_OBJ_FROM_PTR(self);
 }
@@ -112,7 +133,7 @@ static mp_obj_t aesio_aes_make_new(const mp_obj_type_t *type, size_t n_args,
 //|
 //|         :param ~circuitpython_typing.ReadableBuffer key: A 16-, 24-, or 32-byte key
 //|         :param ~circuitpython_typing.ReadableBuffer IV: Initialization vector to use
-//|                                                         for CBC or CTR mode"""
+//|                                                         for CBC or CTR mode, or the nonce for GCM mode"""
 //|         ...
 static mp_obj_t aesio_aes_rekey(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -134,15 +155,10 @@ static mp_obj_t aesio_aes_rekey(size_t n_args, const mp_obj_t *pos_args, mp_map_
         mp_raise_ValueError(MP_ERROR_TEXT("Key must be 16, 24, or 32 bytes long"));
     }
 
-    const uint8_t *iv = NULL;
-    if (args[ARG_IV].u_obj != NULL &&
-        mp_get_buffer(args[ARG_IV].u_obj, &bufinfo, MP_BUFFER_READ)) {
-        (void)mp_arg_validate_length(bufinfo.len, AES_BLOCKLEN, MP_QSTR_IV);
+    size_t iv_length;
+    const uint8_t *iv = get_iv(args[ARG_IV].u_obj, self->mode, &iv_length);
 
-        iv = bufinfo.buf;
-    }
-
-    common_hal_aesio_aes_rekey(self, key, key_length, iv);
+    common_hal_aesio_aes_rekey(self, key, key_length, iv, iv_length);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(aesio_aes_rekey_obj, 1, aesio_aes_rekey);
@@ -166,16 +182,18 @@ static void validate_length(aesio_aes_obj_t *self, size_t src_length,
             }
             break;
         case AES_MODE_CTR:
+        case AES_MODE_GCM:
             break;
     }
 }
 
 //|     def encrypt_into(self, src: ReadableBuffer, dest: WriteableBuffer) -> None:
-//|         """Encrypt the buffer from ``src`` into ``dest``.
+//|         """Encrypt the buffer from ``src`` into ``dest``, which may be the same buffer.
 //|
 //|         For ECB mode, the buffers must be 16 bytes long.  For CBC mode, the
 //|         buffers must be a multiple of 16 bytes, and must be equal length.  For
-//|         CTR mode, there are no restrictions."""
+//|         CTR and GCM modes, there are no restrictions, and a stream may be
+//|         encrypted in pieces of any length."""
 //|         ...
 static mp_obj_t aesio_aes_encrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t dest) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -185,21 +203,19 @@ static mp_obj_t aesio_aes_encrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
     mp_get_buffer_raise(dest, &destbufinfo, MP_BUFFER_WRITE);
     validate_length(self, srcbufinfo.len, destbufinfo.len);
 
-    memcpy(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
-
-    common_hal_aesio_aes_encrypt(self, (uint8_t *)destbufinfo.buf, destbufinfo.len);
+    common_hal_aesio_aes_encrypt(self, srcbufinfo.buf, destbufinfo.buf, destbufinfo.len);
     return mp_const_none;
 }
 
 static MP_DEFINE_CONST_FUN_OBJ_3(aesio_aes_encrypt_into_obj, aesio_aes_encrypt_into);
 
 //|     def decrypt_into(self, src: ReadableBuffer, dest: WriteableBuffer) -> None:
-//|         """Decrypt the buffer from ``src`` into ``dest``.
+//|         """Decrypt the buffer from ``src`` into ``dest``, which may be the same buffer.
 //|         For ECB mode, the buffers must be 16 bytes long.  For CBC mode, the
 //|         buffers must be a multiple of 16 bytes, and must be equal length.  For
-//|         CTR mode, there are no restrictions."""
+//|         CTR and GCM modes, there are no restrictions, and a stream may be
+//|         decrypted in pieces of any length."""
 //|         ...
-//|
 static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t dest) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -208,14 +224,77 @@ static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
     mp_get_buffer_raise(dest, &destbufinfo, MP_BUFFER_WRITE);
     validate_length(self, srcbufinfo.len, destbufinfo.len);
 
-    memcpy(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
-
-    common_hal_aesio_aes_decrypt(self, (uint8_t *)destbufinfo.buf, destbufinfo.len);
+    common_hal_aesio_aes_decrypt(self, srcbufinfo.buf, destbufinfo.buf, destbufinfo.len);
     return mp_const_none;
 }
 
 static MP_DEFINE_CONST_FUN_OBJ_3(aesio_aes_decrypt_into_obj, aesio_aes_decrypt_into);
 
+static void check_gcm(aesio_aes_obj_t *self) {
+    if (self->mode != AES_MODE_GCM) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_mode);
+    }
+}
+
+//|     def update(self, data: ReadableBuffer) -> None:
+//|         """Authenticate ``data`` without encrypting it, in GCM mode. This must
+//|         come before any encryption or decryption."""
+//|         ...
+static mp_obj_t aesio_aes_update(mp_obj_t self_in, mp_obj_t data) {
+    aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_gcm(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    if (!common_hal_aesio_aes_update(self, bufinfo.buf, bufinfo.len)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_update);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(aesio_aes_update_obj, aesio_aes_update);
+
+//|     def digest(self) -> bytes:
+//|         """Return the 16 byte authentication tag of the data so far, in GCM mode."""
+//|         ...
+static mp_obj_t aesio_aes_digest(mp_obj_t self_in) {
+    aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_gcm(self);
+
+    uint8_t tag[AES_BLOCKLEN];
+    common_hal_aesio_aes_digest(self, tag);
+    return mp_obj_new_bytes(tag, sizeof(tag));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(aesio_aes_digest_obj, aesio_aes_digest);
+
+//|     def verify(self, tag: ReadableBuffer) -> None:
+//|         """Check ``tag`` against the authentication tag of the data so far, in
+//|         GCM mode. It may be shortened, but no shorter than 4 bytes.
+//|
+//|         :raises ValueError: if the tag doesn't match"""
+//|         ...
+//|
+static mp_obj_t aesio_aes_verify(mp_obj_t self_in, mp_obj_t tag_in) {
+    aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_gcm(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(tag_in, &bufinfo, MP_BUFFER_READ);
+    mp_arg_validate_length_range(bufinfo.len, 4, AES_BLOCKLEN, MP_QSTR_tag);
+
+    uint8_t tag[AES_BLOCKLEN];
+    common_hal_aesio_aes_digest(self, tag);
+    // Look at every byte, so the time taken doesn't tell where a forged tag is wrong.
+    uint8_t diff = 0;
+    for (size_t i = 0; i < bufinfo.len; i++) {
+        diff |= tag[i] ^ ((const uint8_t *)bufinfo.buf)[i];
+    }
+    if (diff != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Authentication failure"));
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(aesio_aes_verify_obj, aesio_aes_verify);
+
 static mp_obj_t aesio_aes_get_mode(mp_obj_t self_in) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -227,14 +306,7 @@ static mp_obj_t aesio_aes_set_mode(mp_obj_t self_in, mp_obj_t mode_obj) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
     int mode = mp_obj_get_int(mode_obj);
-    switch (mode) {
-        case AES_MODE_CBC:
-        case AES_MODE_ECB:
-        case AES_MODE_CTR:
-            break;
-        default:
-            mp_raise_NotImplementedError(MP_ERROR_TEXT("Requested AES mode is unsupported"));
-    }
+    validate_mode(mode);
 
     common_hal_aesio_aes_set_mode(self, mode);
     return mp_const_none;
@@ -251,6 +323,9 @@ static const mp_rom_map_elem_t aesio_locals_dict_table[] = {
     {MP_ROM_QSTR(MP_QSTR_encrypt_into), (mp_obj_t)&aesio_aes_encrypt_into_obj},
     {MP_ROM_QSTR(MP_QSTR_decrypt_into), (mp_obj_t)&aesio_aes_decrypt_into_obj},
     {MP_ROM_QSTR(MP_QSTR_rekey), (mp_obj_t)&aesio_aes_rekey_obj},
+    {MP_ROM_QSTR(MP_QSTR_update), (mp_obj_t)&aesio_aes_update_obj},
+    {MP_ROM_QSTR(MP_QSTR_digest), (mp_obj_t)&aesio_aes_digest_obj},
+    {MP_ROM_QSTR(MP_QSTR_verify), (mp_obj_t)&aesio_aes_verify_obj},
     {MP_ROM_QSTR(MP_QSTR_mode), (mp_obj_t)&aesio_aes_mode_obj},
 };
 static MP_DEFINE_CONST_DICT(aesio_locals_dict, aesio_locals_dict_table);
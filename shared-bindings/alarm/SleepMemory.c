@@ -13,7 +13,9 @@
 
 //| class SleepMemory:
 //|     """Store raw bytes in RAM that persists during deep sleep.
-//|     The class acts as a ``bytearray``.
+//|     The class acts as a ``bytearray`` and supports the buffer protocol, so
+//|     ``memoryview(alarm.sleep_memory)`` and `struct.pack_into` read and write
+//|     it in place, without copying it byte by byte.
 //|     If power is lost, the memory contents are lost.
 //|
 //|     Note that this class can't be imported and used directly. The sole
@@ -27,6 +29,10 @@
 //|        import alarm
 //|        alarm.sleep_memory[0] = True
 //|        alarm.sleep_memory[1] = 12
+//|
+//|        import struct
+//|        struct.pack_into("<ff", alarm.sleep_memory, 4, x, y)
+//|        x, y = struct.unpack_from("<ff", alarm.sleep_memory, 4)
 //|     """
 //|
 
@@ -56,6 +62,14 @@ static mp_obj_t alarm_sleep_memory_unary_op(mp_unary_op_t op, mp_obj_t self_in)
     }
 }
 
+static mp_int_t alarm_sleep_memory_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    alarm_sleep_memory_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bufinfo->buf = common_hal_alarm_sleep_memory_get_buffer(self);
+    bufinfo->len = common_hal_alarm_sleep_memory_get_length(self);
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
 static const mp_rom_map_elem_t alarm_sleep_memory_locals_dict_table[] = {
 };
 
@@ -157,5 +171,6 @@ MP_DEFINE_CONST_OBJ_TYPE(
     MP_TYPE_FLAG_NONE,
     locals_dict, &alarm_sleep_memory_locals_dict,
     subscr, alarm_sleep_memory_subscr,
-    unary_op, alarm_sleep_memory_unary_op
+    unary_op, alarm_sleep_memory_unary_op,
+    buffer, alarm_sleep_memory_get_buffer
     );
@@ -105,11 +105,14 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(analogbufio_bufferedin___exit___obj,
 //|         For 16-bit samples, if loop=False, the 12-bit ADC values are scaled up to fill the 16 bit range.
 //|         If loop=True, ADC values are stored without scaling.
 //|
+//|         With loop=True, conversions continue into the buffer as a ring, with no gap
+//|         between passes, until `deinit` is called. Use `loop_position` to find which
+//|         part of the buffer is safe to read. Looping is only supported on RP2040.
+//|
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples
 //|         :param ~bool loop: loop: Set to true for continuous conversions, False to fill buffer once then stop
 //|         """
 //|         ...
-//|
 static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_buffer, ARG_loop };
     static const mp_arg_t allowed_args[] = {
@@ -135,12 +138,41 @@ static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_readinto_obj, 1, analogbufio_bufferedin_obj_readinto);
 
+//|     loop_position: int
+//|     """Index of the next sample to be written while `readinto` is looping, or 0
+//|     when not looping. Samples before this index were written during the current
+//|     pass, so processing one half of the buffer while the other half fills gives
+//|     gap-free capture::
+//|
+//|         adcbuf.readinto(mybuffer, loop=True)
+//|         half = len(mybuffer) // 2
+//|         while True:
+//|             while adcbuf.loop_position < half:
+//|                 pass
+//|             process(mybuffer[:half])
+//|             while adcbuf.loop_position >= half:
+//|                 pass
+//|             process(mybuffer[half:])
+//|
+//|     (read only)"""
+//|
+static mp_obj_t analogbufio_bufferedin_obj_get_loop_position(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_analogbufio_bufferedin_get_loop_position(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_loop_position_obj, analogbufio_bufferedin_obj_get_loop_position);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_loop_position_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_loop_position_obj);
+
 static const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&analogbufio_bufferedin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),   MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_loop_position), MP_ROM_PTR(&analogbufio_bufferedin_loop_position_obj)},
 };
 
 static MP_DEFINE_CONST_DICT(analogbufio_bufferedin_locals_dict, analogbufio_bufferedin_locals_dict_table);
@@ -177,6 +177,22 @@ static mp_obj_t audiomp3_mp3file_obj_open(mp_obj_t self_in, mp_obj_t path) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_open_obj, audiomp3_mp3file_obj_open);
 
+//|     def seek(self, seconds: float) -> None:
+//|         """Continue decoding from ``seconds`` into the file, without decoding
+//|         the audio before it. The position is exact for constant bit rate (CBR)
+//|         files and estimated from the first frame's bit rate for variable bit
+//|         rate ones. `samples_decoded` is updated to match.
+//|
+//|         Raises `OSError` if the file can't seek, such as when streaming from a socket."""
+//|         ...
+static mp_obj_t audiomp3_mp3file_obj_seek(mp_obj_t self_in, mp_obj_t seconds) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiomp3_mp3file_seek(self, mp_obj_get_float(seconds));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_seek_obj, audiomp3_mp3file_obj_seek);
+
 MP_PROPERTY_GETSET(audiomp3_mp3file_file_obj,
     (mp_obj_t)&audiomp3_mp3file_get_file_obj,
     (mp_obj_t)&audiomp3_mp3file_set_file_obj);
@@ -258,6 +274,7 @@ MP_PROPERTY_GETTER(audiomp3_mp3file_samples_decoded_obj,
 static const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&audiomp3_mp3file_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&audiomp3_mp3file_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -908,6 +908,87 @@ static mp_obj_t bitmaptools_dither(size_t n_args, const mp_obj_t *pos_args, mp_m
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_dither_obj, 0, bitmaptools_dither);
+
+//| def downsample(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source_bitmap: displayio.Bitmap,
+//|     source_colorspace: displayio.Colorspace,
+//|     *,
+//|     x: int = 0,
+//|     y: int = 0,
+//|     factor: int = 1,
+//| ) -> None:
+//|     """Crop, bin and optionally convert to grayscale in a single pass, such as to
+//|     shrink a camera frame before running detection on it.
+//|
+//|     Each destination pixel is the average of a ``factor`` x ``factor`` block of source
+//|     pixels. The blocks start at ``x``, ``y`` in the source, and together cover
+//|     ``dest_bitmap.width * factor`` by ``dest_bitmap.height * factor`` pixels, which must
+//|     lie within the source.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap. With a value_count of 256 it receives
+//|         grayscale; with a value_count of 65536 it receives color in ``source_colorspace``.
+//|     :param bitmap source_bitmap: Source bitmap, such as a frame from `espcamera.Camera.take`
+//|         or one passed to `imagecapture.ParallelImageCapture.capture`.
+//|     :param colorspace source_colorspace: The colorspace of the source. The supported colorspaces
+//|         are ``L8``, ``RGB565``, ``BGR565``, ``RGB565_SWAPPED`` and ``BGR565_SWAPPED``.
+//|     :param int x: Left edge of the region to use from the source
+//|     :param int y: Top edge of the region to use from the source
+//|     :param int factor: How many source pixels, in each direction, make up one destination pixel. 1 to 16.
+//|     """
+//|     ...
+//|
+static mp_obj_t bitmaptools_downsample(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_dest_bitmap, ARG_source_bitmap, ARG_source_colorspace, ARG_x, ARG_y, ARG_factor };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_source_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_source_colorspace, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_x, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_factor, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    displayio_bitmap_t *source_bitmap = mp_arg_validate_type(args[ARG_source_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_source_bitmap);
+    displayio_bitmap_t *dest_bitmap = mp_arg_validate_type(args[ARG_dest_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+    displayio_colorspace_t colorspace = cp_enum_value(&displayio_colorspace_type, args[ARG_source_colorspace].u_obj, MP_QSTR_source_colorspace);
+    mp_int_t factor = mp_arg_validate_int_range(args[ARG_factor].u_int, 1, 16, MP_QSTR_factor);
+
+    switch (colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+        case DISPLAYIO_COLORSPACE_BGR565:
+        case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+            if (source_bitmap->bits_per_value != 16) {
+                mp_raise_TypeError(MP_ERROR_TEXT("source_bitmap must have value_count of 65536"));
+            }
+            if (dest_bitmap->bits_per_value != 8 && dest_bitmap->bits_per_value != 16) {
+                mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_dest_bitmap);
+            }
+            break;
+
+        case DISPLAYIO_COLORSPACE_L8:
+            if (source_bitmap->bits_per_value != 8) {
+                mp_raise_TypeError(MP_ERROR_TEXT("source_bitmap must have value_count of 8"));
+            }
+            if (dest_bitmap->bits_per_value != 8) {
+                mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_dest_bitmap);
+            }
+            break;
+
+        default:
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_source_colorspace);
+    }
+
+    mp_int_t x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, source_bitmap->width - dest_bitmap->width * factor, MP_QSTR_x);
+    mp_int_t y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, source_bitmap->height - dest_bitmap->height * factor, MP_QSTR_y);
+
+    common_hal_bitmaptools_downsample(dest_bitmap, source_bitmap, colorspace, x, y, factor);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_downsample_obj, 0, bitmaptools_downsample);
 // requires all 5 arguments
 
 //| def draw_circle(
@@ -1096,6 +1177,7 @@ static const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_draw_circle), MP_ROM_PTR(&bitmaptools_draw_circle_obj) },
     { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&bitmaptools_blit_obj) },
     { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&bitmaptools_dither_obj) },
+    { MP_ROM_QSTR(MP_QSTR_downsample), MP_ROM_PTR(&bitmaptools_downsample_obj) },
     { MP_ROM_QSTR(MP_QSTR_BlendMode), MP_ROM_PTR(&bitmaptools_blendmode_type) },
     { MP_ROM_QSTR(MP_QSTR_DitherAlgorithm), MP_ROM_PTR(&bitmaptools_dither_algorithm_type) },
 };
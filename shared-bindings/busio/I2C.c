@@ -374,6 +374,68 @@ static mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 1, busio_i2c_writeto_then_readfrom);
+
+//|     def readfrom_registers(
+//|         self, address: int, registers: ReadableBuffer, buffers: Sequence[WriteableBuffer]
+//|     ) -> None:
+//|         """Read several register blocks from the device selected by ``address``. For each
+//|         register number in ``registers``, write it, then generate a repeated start and
+//|         read into the matching buffer in ``buffers``, as `writeto_then_readfrom` does.
+//|         All the reads happen in one call, so polling a sensor's registers does not go
+//|         back to Python between blocks.
+//|
+//|         Example::
+//|
+//|             accel = bytearray(6)
+//|             gyro = bytearray(6)
+//|             i2c.readfrom_registers(0x6A, bytes((0x28, 0x22)), (accel, gyro))
+//|
+//|         :param int address: 7-bit device address
+//|         :param ~circuitpython_typing.ReadableBuffer registers: 8-bit register numbers
+//|         :param Sequence[~circuitpython_typing.WriteableBuffer] buffers: one buffer to read into per register
+//|         """
+//|         ...
+//|
+static mp_obj_t busio_i2c_readfrom_registers(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_address, ARG_registers, ARG_buffers };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_address,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_registers,  MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buffers,    MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t registers;
+    mp_get_buffer_raise(args[ARG_registers].u_obj, &registers, MP_BUFFER_READ);
+    size_t n;
+    mp_obj_t *buffers;
+    mp_obj_get_array(args[ARG_buffers].u_obj, &n, &buffers);
+    mp_arg_validate_length(n, registers.len, MP_QSTR_buffers);
+
+    // Check every buffer before starting, so a bad one doesn't leave the reads half done.
+    for (size_t i = 0; i < n; i++) {
+        mp_buffer_info_t in_bufinfo;
+        mp_get_buffer_raise(buffers[i], &in_bufinfo, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(in_bufinfo.len, 1, MP_QSTR_buffers);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        mp_buffer_info_t in_bufinfo;
+        mp_get_buffer(buffers[i], &in_bufinfo, MP_BUFFER_WRITE);
+        uint8_t status = common_hal_busio_i2c_write_read(self, args[ARG_address].u_int,
+            ((uint8_t *)registers.buf) + i, 1, in_bufinfo.buf, in_bufinfo.len);
+        if (status != 0) {
+            mp_raise_OSError(status);
+        }
+    }
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_readfrom_registers_obj, 1, busio_i2c_readfrom_registers);
 #endif // CIRCUITPY_BUSIO_I2C
 
 static const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
@@ -391,6 +453,7 @@ static const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readfrom_registers), MP_ROM_PTR(&busio_i2c_readfrom_registers_obj) },
     #endif // CIRCUITPY_BUSIO_I2C
 };
 
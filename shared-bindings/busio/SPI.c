@@ -112,6 +112,19 @@ static mp_obj_t busio_spi_make_new(const mp_obj_type_t *type, size_t n_args, siz
 }
 
 #if CIRCUITPY_BUSIO_SPI
+// Ports that can't transfer in the background do the whole transfer up front.
+MP_WEAK bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, mp_obj_t buffer_obj, const uint8_t *data, size_t len) {
+    return common_hal_busio_spi_write(self, data, len);
+}
+
+MP_WEAK bool common_hal_busio_spi_start_read(busio_spi_obj_t *self, mp_obj_t buffer_obj, uint8_t *data, size_t len, uint8_t write_value) {
+    return common_hal_busio_spi_read(self, data, len, write_value);
+}
+
+MP_WEAK bool common_hal_busio_spi_get_busy(busio_spi_obj_t *self) {
+    return false;
+}
+
 //|     def deinit(self) -> None:
 //|         """Turn off the SPI bus."""
 //|         ...
@@ -434,6 +447,119 @@ static mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_readinto_obj, 1, busio_spi_write_readinto);
 
+// Returns buffer[start:end] in bytes, as the blocking methods compute it.
+static uint8_t *get_buffer_slice(mp_obj_t buffer, int32_t start, mp_int_t end, mp_uint_t flags, size_t *length) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, flags);
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    *length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, end, length);
+    *length *= stride_in_bytes;
+    return ((uint8_t *)bufinfo.buf) + start * stride_in_bytes;
+}
+
+//|     import sys
+//|     def write_async(self, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize) -> None:
+//|         """Start writing the data contained in ``buffer`` and return without waiting
+//|         for it to be sent. Check `busy` to find out when the write is done. The SPI
+//|         object must be locked, and ``buffer`` must not be changed until the write is done.
+//|
+//|         Any other use of the SPI object waits for the write to finish first. On ports
+//|         without background transfers, and for short buffers, the write is done before
+//|         this returns.
+//|
+//|         ``start`` and ``end`` slice the buffer as for `write`.
+//|         """
+//|         ...
+
+static mp_obj_t busio_spi_write_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t length;
+    uint8_t *data = get_buffer_slice(args[ARG_buffer].u_obj, args[ARG_start].u_int, args[ARG_end].u_int, MP_BUFFER_READ, &length);
+    if (length == 0) {
+        return mp_const_none;
+    }
+
+    bool ok = common_hal_busio_spi_start_write(self, args[ARG_buffer].u_obj, data, length);
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_async_obj, 1, busio_spi_write_async);
+
+//|     import sys
+//|     def readinto_async(
+//|         self,
+//|         buffer: WriteableBuffer,
+//|         *,
+//|         start: int = 0,
+//|         end: int = sys.maxsize,
+//|         write_value: int = 0
+//|     ) -> None:
+//|         """Start reading into ``buffer`` while writing ``write_value`` for each byte
+//|         read, and return without waiting for the data. Check `busy` to find out when
+//|         ``buffer`` has been filled. The SPI object must be locked.
+//|
+//|         This waits and falls back the same way as `write_async`.
+//|
+//|         ``start`` and ``end`` slice the buffer as for `readinto`.
+//|         """
+//|         ...
+
+static mp_obj_t busio_spi_readinto_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end, ARG_write_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+        { MP_QSTR_write_value, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t length;
+    uint8_t *data = get_buffer_slice(args[ARG_buffer].u_obj, args[ARG_start].u_int, args[ARG_end].u_int, MP_BUFFER_WRITE, &length);
+    if (length == 0) {
+        return mp_const_none;
+    }
+
+    bool ok = common_hal_busio_spi_start_read(self, args[ARG_buffer].u_obj, data, length, args[ARG_write_value].u_int);
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_readinto_async_obj, 1, busio_spi_readinto_async);
+
+//|     busy: bool
+//|     """True while a transfer started by `write_async` or `readinto_async` is in progress.
+//|     (read only)"""
+//|
+static mp_obj_t busio_spi_obj_get_busy(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_busio_spi_get_busy(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_get_busy_obj, busio_spi_obj_get_busy);
+
+MP_PROPERTY_GETTER(busio_spi_busy_obj,
+    (mp_obj_t)&busio_spi_get_busy_obj);
+
 //|     frequency: int
 //|     """The actual SPI bus frequency. This may not match the frequency requested
 //|     due to internal limitations."""
@@ -464,6 +590,9 @@ static const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto_async), MP_ROM_PTR(&busio_spi_readinto_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_async), MP_ROM_PTR(&busio_spi_write_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&busio_spi_busy_obj) },
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
     #endif // CIRCUITPY_BUSIO_SPI
 };
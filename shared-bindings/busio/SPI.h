@@ -37,6 +37,15 @@ extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size
 // Reads and write len bytes simultaneously.
 extern bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, const uint8_t *data_out, uint8_t *data_in, size_t len);
 
+// Start a write or read that finishes in the background. buffer_obj owns data and must be kept
+// alive until the transfer is no longer busy. Ports without background transfers finish
+// before returning.
+extern bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, mp_obj_t buffer_obj, const uint8_t *data, size_t len);
+extern bool common_hal_busio_spi_start_read(busio_spi_obj_t *self, mp_obj_t buffer_obj, uint8_t *data, size_t len, uint8_t write_value);
+
+// True while a transfer started by common_hal_busio_spi_start_* is still running.
+extern bool common_hal_busio_spi_get_busy(busio_spi_obj_t *self);
+
 // Return actual SPI bus frequency.
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t *self);
 
@@ -6,6 +6,7 @@
 
 #include "shared-bindings/canio/Listener.h"
 #include "shared-bindings/canio/Message.h"
+#include "shared-bindings/canio/RemoteTransmissionRequest.h"
 #include "common-hal/canio/Listener.h"
 
 #include "py/runtime.h"
@@ -43,6 +44,46 @@ static mp_obj_t canio_listener_receive(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_receive_obj, canio_listener_receive);
 
+//|     def readinto(
+//|         self, messages: List[Union[RemoteTransmissionRequest, Message]]
+//|     ) -> int:
+//|         """Reads messages into the existing objects in ``messages``, without allocating
+//|
+//|         Waits up to ``self.timeout`` seconds for the first message. Further
+//|         messages are read only while they are already waiting, until
+//|         ``messages`` is full.
+//|
+//|         Each filled item becomes a `Message` or `RemoteTransmissionRequest`
+//|         according to what was received, so check its type before using it.
+//|         Items past the returned count are left unchanged.
+//|
+//|         :return: the number of messages read
+//|         :rtype: int"""
+//|         ...
+static mp_obj_t canio_listener_readinto(mp_obj_t self_in, mp_obj_t messages_in) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(messages_in, &len, &items);
+    for (size_t i = 0; i < len; i++) {
+        const mp_obj_type_t *type = mp_obj_get_type(items[i]);
+        if (type != &canio_message_type && type != &canio_remote_transmission_request_type) {
+            mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q or %q, not %q"),
+                MP_QSTR_messages, MP_QSTR_Message, MP_QSTR_RemoteTransmissionRequest, type->name);
+        }
+    }
+
+    size_t count = 0;
+    while (count < len &&
+           common_hal_canio_listener_receive_into(self, MP_OBJ_TO_PTR(items[count]), count == 0)) {
+        count++;
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(canio_listener_readinto_obj, canio_listener_readinto);
+
 //|     def in_waiting(self) -> int:
 //|         """Returns the number of messages (including remote
 //|         transmission requests) waiting"""
@@ -142,6 +183,7 @@ static const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&canio_listener_exit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&canio_listener_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&canio_listener_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&canio_listener_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&canio_listener_receive_obj) },
     { MP_ROM_QSTR(MP_QSTR_timeout), MP_ROM_PTR(&canio_listener_timeout_obj) },
 };
@@ -9,6 +9,7 @@
 #include "py/obj.h"
 #include "shared-bindings/canio/CAN.h"
 #include "shared-bindings/canio/Match.h"
+#include "shared-module/canio/Message.h"
 
 extern const mp_obj_type_t canio_listener_type;
 
@@ -18,6 +19,9 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
 void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self);
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self);
 mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self);
+// Fill an existing message object, setting its type to match the frame received.
+// When wait is false, return immediately if no frame is waiting.
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait);
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self);
 float common_hal_canio_listener_get_timeout(canio_listener_obj_t *self);
 void common_hal_canio_listener_set_timeout(canio_listener_obj_t *self, float timeout);
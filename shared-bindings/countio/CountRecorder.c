@@ -0,0 +1,174 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/binary.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/countio/Counter.h"
+#include "shared-bindings/countio/CountRecorder.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_COUNTIO_RECORDER
+
+//| class CountRecorder:
+//|     """Record how many edges a `Counter` sees in each of a series of intervals
+//|
+//|     Recording runs in the background, so Python does not need to wake up
+//|     every interval."""
+//|
+//|     def __init__(self, counter: Counter, buffer: WriteableBuffer, *, interval: float = 0.001) -> None:
+//|         """Start recording the edges counted by ``counter`` in each ``interval``.
+//|
+//|         The count for each interval goes into the next item of ``buffer``,
+//|         starting again at the beginning once the end is reached. Counts too large
+//|         for an item are stored as its largest value.
+//|
+//|         :param Counter counter: The counter to record
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: A bytearray or
+//|           ``array.array`` of 8, 16 or 32 bit unsigned integers
+//|         :param float interval: The length of each interval in seconds. It is
+//|           rounded to a whole number of 1/1024 second ticks
+//|
+//|         Counts per millisecond over the last second::
+//|
+//|           import array
+//|           import board
+//|           import countio
+//|
+//|           counter = countio.Counter(board.D1)
+//|           history = array.array("H", [0] * 1024)
+//|           recorder = countio.CountRecorder(counter, history)"""
+//|         ...
+//|
+static mp_obj_t countio_countrecorder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_counter, ARG_buffer, ARG_interval };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_counter, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_interval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    countio_counter_obj_t *counter = MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_counter].u_obj, &countio_counter_type, MP_QSTR_counter));
+    if (common_hal_countio_counter_deinited(counter)) {
+        raise_deinited_error();
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    size_t itemsize = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    if (itemsize != 1 && itemsize != 2 && itemsize != 4) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad typecode"));
+    }
+    size_t len = bufinfo.len / itemsize;
+    mp_arg_validate_length_min(len, 1, MP_QSTR_buffer);
+
+    mp_float_t interval = MICROPY_FLOAT_CONST(0.001);
+    if (args[ARG_interval].u_obj != MP_OBJ_NULL) {
+        interval = mp_arg_validate_obj_float_range(args[ARG_interval].u_obj, 0, 3600, MP_QSTR_interval);
+    }
+    uint32_t interval_ticks = MAX((uint32_t)(interval * 1024 + MICROPY_FLOAT_CONST(0.5)), 1);
+
+    countio_countrecorder_obj_t *self = mp_obj_malloc_with_finaliser(countio_countrecorder_obj_t, &countio_countrecorder_type);
+    common_hal_countio_countrecorder_construct(self, counter, args[ARG_buffer].u_obj, bufinfo.buf, len, itemsize, interval_ticks);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Stop recording. The buffer keeps the counts recorded so far."""
+//|         ...
+//|
+static mp_obj_t countio_countrecorder_deinit(mp_obj_t self_in) {
+    countio_countrecorder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_countio_countrecorder_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(countio_countrecorder_deinit_obj, countio_countrecorder_deinit);
+
+static void check_for_deinit(countio_countrecorder_obj_t *self) {
+    if (common_hal_countio_countrecorder_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> CountRecorder:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t countio_countrecorder___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_countio_countrecorder_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(countio_countrecorder___exit___obj, 4, 4, countio_countrecorder___exit__);
+
+//|     interval: float
+//|     """The length of each interval in seconds, after rounding. (read-only)"""
+static mp_obj_t countio_countrecorder_get_interval(mp_obj_t self_in) {
+    countio_countrecorder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_countio_countrecorder_get_interval(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(countio_countrecorder_get_interval_obj, countio_countrecorder_get_interval);
+
+MP_PROPERTY_GETTER(countio_countrecorder_interval_obj,
+    (mp_obj_t)&countio_countrecorder_get_interval_obj);
+
+//|     recorded: int
+//|     """The number of intervals recorded so far. The latest count is at index
+//|     ``(recorded - 1) % len(buffer)``. (read-only)"""
+static mp_obj_t countio_countrecorder_get_recorded(mp_obj_t self_in) {
+    countio_countrecorder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_countio_countrecorder_get_recorded(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(countio_countrecorder_get_recorded_obj, countio_countrecorder_get_recorded);
+
+MP_PROPERTY_GETTER(countio_countrecorder_recorded_obj,
+    (mp_obj_t)&countio_countrecorder_get_recorded_obj);
+
+//|     frequency: float
+//|     """The edges per second in the last complete interval. (read-only)"""
+//|
+static mp_obj_t countio_countrecorder_get_frequency(mp_obj_t self_in) {
+    countio_countrecorder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_countio_countrecorder_get_frequency(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(countio_countrecorder_get_frequency_obj, countio_countrecorder_get_frequency);
+
+MP_PROPERTY_GETTER(countio_countrecorder_frequency_obj,
+    (mp_obj_t)&countio_countrecorder_get_frequency_obj);
+
+static const mp_rom_map_elem_t countio_countrecorder_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&countio_countrecorder_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&countio_countrecorder_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&countio_countrecorder___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&countio_countrecorder_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_interval), MP_ROM_PTR(&countio_countrecorder_interval_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recorded), MP_ROM_PTR(&countio_countrecorder_recorded_obj) },
+};
+static MP_DEFINE_CONST_DICT(countio_countrecorder_locals_dict, countio_countrecorder_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    countio_countrecorder_type,
+    MP_QSTR_CountRecorder,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, countio_countrecorder_make_new,
+    locals_dict, &countio_countrecorder_locals_dict
+    );
+
+#endif // CIRCUITPY_COUNTIO_RECORDER
@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/countio/CountRecorder.h"
+
+extern const mp_obj_type_t countio_countrecorder_type;
+
+void common_hal_countio_countrecorder_construct(countio_countrecorder_obj_t *self,
+    countio_counter_obj_t *counter, mp_obj_t buffer_obj, void *buffer, size_t len, size_t itemsize,
+    uint32_t interval_ticks);
+void common_hal_countio_countrecorder_deinit(countio_countrecorder_obj_t *self);
+bool common_hal_countio_countrecorder_deinited(countio_countrecorder_obj_t *self);
+mp_float_t common_hal_countio_countrecorder_get_interval(countio_countrecorder_obj_t *self);
+size_t common_hal_countio_countrecorder_get_recorded(countio_countrecorder_obj_t *self);
+mp_float_t common_hal_countio_countrecorder_get_frequency(countio_countrecorder_obj_t *self);
@@ -7,9 +7,11 @@
 #include <stdint.h>
 
 #include "shared/runtime/context_manager_helpers.h"
+#include "py/mperrno.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/runtime0.h"
+#include "py/stream.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/countio/Counter.h"
 #include "shared-bindings/countio/Edge.h"
@@ -47,6 +49,10 @@
 //|                     pin_counter.reset()
 //|                 print(pin_counter.count)
 //|
+//|         A `Counter` can be registered with `select.poll`, and so waited on by
+//|         asyncio. It is ready to read while `count` is not zero, so call
+//|         `reset()` after handling the counted edges.
+//|
 //|         **Limitations:** On RP2040, `Counter` uses the PWM peripheral, and
 //|         is limited to using PWM channel B pins due to hardware restrictions.
 //|         See the pin assignments for your board to see which pins can be used.
@@ -149,10 +155,39 @@ static const mp_rom_map_elem_t countio_counter_locals_dict_table[] = {
 };
 static MP_DEFINE_CONST_DICT(countio_counter_locals_dict, countio_counter_locals_dict_table);
 
+#if MICROPY_PY_SELECT
+static mp_uint_t countio_counter_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    countio_counter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (request) {
+        case MP_STREAM_POLL: {
+            mp_uint_t flags = arg;
+            mp_uint_t ret = 0;
+            if (common_hal_countio_counter_deinited(self)) {
+                return MP_STREAM_POLL_NVAL;
+            }
+            if ((flags & MP_STREAM_POLL_RD) && common_hal_countio_counter_get_count(self) != 0) {
+                ret |= MP_STREAM_POLL_RD;
+            }
+            return ret;
+        }
+        default:
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+    }
+}
+
+static const mp_stream_p_t countio_counter_p = {
+    .ioctl = countio_counter_ioctl,
+};
+#endif
+
 MP_DEFINE_CONST_OBJ_TYPE(
     countio_counter_type,
     MP_QSTR_Counter,
     MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
     make_new, countio_counter_make_new,
+    #if MICROPY_PY_SELECT
+    protocol, &countio_counter_p,
+    #endif
     locals_dict, &countio_counter_locals_dict
     );
@@ -12,6 +12,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/countio/__init__.h"
 #include "shared-bindings/countio/Counter.h"
+#include "shared-bindings/countio/CountRecorder.h"
 #include "shared-bindings/countio/Edge.h"
 
 //| """Support for edge counting
@@ -30,6 +31,9 @@
 static const mp_rom_map_elem_t countio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_countio) },
     { MP_ROM_QSTR(MP_QSTR_Counter),  MP_ROM_PTR(&countio_counter_type) },
+    #if CIRCUITPY_COUNTIO_RECORDER
+    { MP_ROM_QSTR(MP_QSTR_CountRecorder),  MP_ROM_PTR(&countio_countrecorder_type) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_Edge),  MP_ROM_PTR(&countio_edge_type) },
 };
 
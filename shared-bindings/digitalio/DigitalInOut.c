@@ -26,7 +26,7 @@
 #include "bindings/cyw43/__init__.h"
 #endif
 
-static void check_result(digitalinout_result_t result) {
+void digitalio_digitalinout_check_result(digitalinout_result_t result) {
     switch (result) {
         case DIGITALINOUT_OK:
             return;
@@ -135,7 +135,7 @@ static mp_obj_t digitalio_digitalinout_switch_to_output(size_t n_args, const mp_
         drive_mode = DRIVE_MODE_OPEN_DRAIN;
     }
     // do the transfer
-    check_result(common_hal_digitalio_digitalinout_switch_to_output(self, args[ARG_value].u_bool, drive_mode));
+    digitalio_digitalinout_check_result(common_hal_digitalio_digitalinout_switch_to_output(self, args[ARG_value].u_bool, drive_mode));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_digitalinout_switch_to_output_obj, 1, digitalio_digitalinout_switch_to_output);
@@ -166,7 +166,7 @@ static mp_obj_t digitalio_digitalinout_switch_to_input(size_t n_args, const mp_o
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    check_result(common_hal_digitalio_digitalinout_switch_to_input(self, validate_pull(args[ARG_pull].u_rom_obj, MP_QSTR_pull)));
+    digitalio_digitalinout_check_result(common_hal_digitalio_digitalinout_switch_to_input(self, validate_pull(args[ARG_pull].u_rom_obj, MP_QSTR_pull)));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_digitalinout_switch_to_input_obj, 1, digitalio_digitalinout_switch_to_input);
@@ -199,9 +199,9 @@ static mp_obj_t digitalio_digitalinout_obj_set_direction(mp_obj_t self_in, mp_ob
     digitalio_digitalinout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
     if (value == MP_ROM_PTR(&digitalio_direction_input_obj)) {
-        check_result(common_hal_digitalio_digitalinout_switch_to_input(self, PULL_NONE));
+        digitalio_digitalinout_check_result(common_hal_digitalio_digitalinout_switch_to_input(self, PULL_NONE));
     } else if (value == MP_ROM_PTR(&digitalio_direction_output_obj)) {
-        check_result(common_hal_digitalio_digitalinout_switch_to_output(self, false, DRIVE_MODE_PUSH_PULL));
+        digitalio_digitalinout_check_result(common_hal_digitalio_digitalinout_switch_to_output(self, false, DRIVE_MODE_PUSH_PULL));
     } else {
         mp_arg_error_invalid(MP_QSTR_direction);
     }
@@ -270,7 +270,7 @@ static mp_obj_t digitalio_digitalinout_obj_set_drive_mode(mp_obj_t self_in, mp_o
     if (drive_mode == MP_ROM_PTR(&digitalio_drive_mode_open_drain_obj)) {
         c_drive_mode = DRIVE_MODE_OPEN_DRAIN;
     }
-    check_result(common_hal_digitalio_digitalinout_set_drive_mode(self, c_drive_mode));
+    digitalio_digitalinout_check_result(common_hal_digitalio_digitalinout_set_drive_mode(self, c_drive_mode));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(digitalio_digitalinout_set_drive_mode_obj, digitalio_digitalinout_obj_set_drive_mode);
@@ -313,7 +313,7 @@ static mp_obj_t digitalio_digitalinout_obj_set_pull(mp_obj_t self_in, mp_obj_t p
         return mp_const_none;
     }
 
-    check_result(common_hal_digitalio_digitalinout_set_pull(self, validate_pull(pull_obj, MP_QSTR_pull)));
+    digitalio_digitalinout_check_result(common_hal_digitalio_digitalinout_set_pull(self, validate_pull(pull_obj, MP_QSTR_pull)));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(digitalio_digitalinout_set_pull_obj, digitalio_digitalinout_obj_set_pull);
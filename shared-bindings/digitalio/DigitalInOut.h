@@ -51,6 +51,7 @@ digitalinout_result_t common_hal_digitalio_digitalinout_set_pull(digitalio_digit
 digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(digitalio_digitalinout_obj_t *self);
 void common_hal_digitalio_digitalinout_never_reset(digitalio_digitalinout_obj_t *self);
 digitalio_digitalinout_obj_t *assert_digitalinout(mp_obj_t obj);
+void digitalio_digitalinout_check_result(digitalinout_result_t result);
 
 volatile uint32_t *common_hal_digitalio_digitalinout_get_reg(digitalio_digitalinout_obj_t *self, digitalinout_reg_op_t op, uint32_t *mask);
 bool common_hal_digitalio_has_reg_op(digitalinout_reg_op_t op);
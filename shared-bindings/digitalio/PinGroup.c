@@ -0,0 +1,257 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/binary.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/digitalio/Direction.h"
+#include "shared-bindings/digitalio/DriveMode.h"
+#include "shared-bindings/digitalio/PinGroup.h"
+#include "shared-bindings/digitalio/Pull.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_DIGITALIO_PINGROUP
+
+//| class PinGroup:
+//|     """Several pins read and written together as the bits of an integer
+//|
+//|     Bit ``i`` of a value is the level of ``pins[i]``. Where the port provides
+//|     the GPIO registers behind its pins, pins that share an output register
+//|     change on the same cycle. Pins without such a register, and all pins in
+//|     open-drain mode, are written one after another."""
+//|
+//|     def __init__(self, pins: Sequence[microcontroller.Pin]) -> None:
+//|         """Create a group of up to 32 pins, as inputs with no pull.
+//|
+//|         :param Sequence[~microcontroller.Pin] pins: The pins, least significant bit first
+//|
+//|         Example usage::
+//|
+//|           import board
+//|           import digitalio
+//|
+//|           bus = digitalio.PinGroup((board.D0, board.D1, board.D2, board.D3))
+//|           bus.switch_to_output()
+//|           bus.value = 0b1010
+//|           bus.write_sequence(bytes(range(16)), delay_us=1)"""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+
+    validate_no_duplicate_pins(args[0], MP_QSTR_pins);
+    const mcu_pin_obj_t *pins[DIGITALIO_PINGROUP_MAX_PINS];
+    uint8_t num_pins;
+    validate_list_is_free_pins(MP_QSTR_pins, pins, DIGITALIO_PINGROUP_MAX_PINS, args[0], &num_pins);
+    mp_arg_validate_length_min(num_pins, 1, MP_QSTR_pins);
+
+    digitalio_pingroup_obj_t *self = mp_obj_malloc_var(digitalio_pingroup_obj_t, pins, digitalio_pingroup_pin_t, num_pins, type);
+    common_hal_digitalio_pingroup_construct(self, pins, num_pins);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Release the pins for other use."""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup_deinit(mp_obj_t self_in) {
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_digitalio_pingroup_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(digitalio_pingroup_deinit_obj, digitalio_pingroup_deinit);
+
+//|     def __enter__(self) -> PinGroup:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_digitalio_pingroup_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(digitalio_pingroup___exit___obj, 4, 4, digitalio_pingroup___exit__);
+
+static void check_for_deinit(digitalio_pingroup_obj_t *self) {
+    if (common_hal_digitalio_pingroup_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+static void check_output(digitalio_pingroup_obj_t *self) {
+    check_for_deinit(self);
+    if (!common_hal_digitalio_pingroup_get_output(self)) {
+        mp_raise_AttributeError(MP_ERROR_TEXT("Cannot set value when direction is input."));
+    }
+}
+
+//|     def switch_to_output(self, value: int = 0, drive_mode: DriveMode = DriveMode.PUSH_PULL) -> None:
+//|         """Set the drive mode and values and then switch all the pins to outputs.
+//|
+//|         :param int value: the initial levels, one bit per pin
+//|         :param ~digitalio.DriveMode drive_mode: drive mode for the outputs"""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup_switch_to_output(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_value, ARG_drive_mode };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_value,      MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+        { MP_QSTR_drive_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&digitalio_drive_mode_push_pull_obj)} },
+    };
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    digitalio_drive_mode_t drive_mode = DRIVE_MODE_PUSH_PULL;
+    if (args[ARG_drive_mode].u_rom_obj == MP_ROM_PTR(&digitalio_drive_mode_open_drain_obj)) {
+        drive_mode = DRIVE_MODE_OPEN_DRAIN;
+    }
+    uint32_t value = mp_obj_int_get_truncated(args[ARG_value].u_obj);
+    digitalio_digitalinout_check_result(common_hal_digitalio_pingroup_switch_to_output(self, value, drive_mode));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_pingroup_switch_to_output_obj, 1, digitalio_pingroup_switch_to_output);
+
+//|     def switch_to_input(self, pull: Optional[Pull] = None) -> None:
+//|         """Set the pull and then switch all the pins to inputs.
+//|
+//|         :param Pull pull: pull configuration for the inputs"""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup_switch_to_input(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_pull };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pull, MP_ARG_OBJ, {.u_rom_obj = mp_const_none} },
+    };
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    digitalio_digitalinout_check_result(common_hal_digitalio_pingroup_switch_to_input(self, validate_pull(args[ARG_pull].u_rom_obj, MP_QSTR_pull)));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_pingroup_switch_to_input_obj, 1, digitalio_pingroup_switch_to_input);
+
+//|     direction: Direction
+//|     """The direction of the pins. (read-only)"""
+static mp_obj_t digitalio_pingroup_get_direction(mp_obj_t self_in) {
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (common_hal_digitalio_pingroup_get_output(self)) {
+        return MP_OBJ_FROM_PTR(&digitalio_direction_output_obj);
+    }
+    return MP_OBJ_FROM_PTR(&digitalio_direction_input_obj);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(digitalio_pingroup_get_direction_obj, digitalio_pingroup_get_direction);
+
+MP_PROPERTY_GETTER(digitalio_pingroup_direction_obj,
+    (mp_obj_t)&digitalio_pingroup_get_direction_obj);
+
+//|     value: int
+//|     """The levels of all the pins, one bit per pin. The pins are sampled
+//|     together. Outputs read back the levels last written."""
+static mp_obj_t digitalio_pingroup_get_value(mp_obj_t self_in) {
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_digitalio_pingroup_get_value(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(digitalio_pingroup_get_value_obj, digitalio_pingroup_get_value);
+
+static mp_obj_t digitalio_pingroup_set_value(mp_obj_t self_in, mp_obj_t value) {
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_output(self);
+    common_hal_digitalio_pingroup_write(self, mp_obj_int_get_truncated(value), 0xffffffff);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(digitalio_pingroup_set_value_obj, digitalio_pingroup_set_value);
+
+MP_PROPERTY_GETSET(digitalio_pingroup_value_obj,
+    (mp_obj_t)&digitalio_pingroup_get_value_obj,
+    (mp_obj_t)&digitalio_pingroup_set_value_obj);
+
+//|     def write(self, value: int, mask: int) -> None:
+//|         """Set the pins whose bits are set in ``mask`` to the levels in ``value``,
+//|         leaving the other pins as they are."""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup_write(mp_obj_t self_in, mp_obj_t value, mp_obj_t mask) {
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_output(self);
+    common_hal_digitalio_pingroup_write(self, mp_obj_int_get_truncated(value), mp_obj_int_get_truncated(mask));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(digitalio_pingroup_write_obj, digitalio_pingroup_write);
+
+//|     def write_sequence(self, values: ReadableBuffer, *, delay_us: int = 0) -> None:
+//|         """Write each value in turn to all the pins, waiting ``delay_us``
+//|         microseconds after each one. The loop runs in C, so the values change
+//|         at a steady rate much faster than writing `value` from Python.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer values: the values, as a
+//|           bytearray or an array of 8, 16 or 32 bit unsigned integers
+//|         :param int delay_us: the time to hold each value"""
+//|         ...
+//|
+static mp_obj_t digitalio_pingroup_write_sequence(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_values, ARG_delay_us };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_values,   MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_delay_us, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    digitalio_pingroup_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_output(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_values].u_obj, &bufinfo, MP_BUFFER_READ);
+    size_t itemsize = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    if (itemsize != 1 && itemsize != 2 && itemsize != 4) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad typecode"));
+    }
+    uint32_t delay_us = mp_arg_validate_int_min(args[ARG_delay_us].u_int, 0, MP_QSTR_delay_us);
+    common_hal_digitalio_pingroup_write_sequence(self, bufinfo.buf, bufinfo.len / itemsize, itemsize, delay_us);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_pingroup_write_sequence_obj, 1, digitalio_pingroup_write_sequence);
+
+static const mp_rom_map_elem_t digitalio_pingroup_locals_dict_table[] = {
+    // instance methods
+    { MP_ROM_QSTR(MP_QSTR_deinit),             MP_ROM_PTR(&digitalio_pingroup_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__),          MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__),           MP_ROM_PTR(&digitalio_pingroup___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_switch_to_output),   MP_ROM_PTR(&digitalio_pingroup_switch_to_output_obj) },
+    { MP_ROM_QSTR(MP_QSTR_switch_to_input),    MP_ROM_PTR(&digitalio_pingroup_switch_to_input_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write),              MP_ROM_PTR(&digitalio_pingroup_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_sequence),     MP_ROM_PTR(&digitalio_pingroup_write_sequence_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_direction),          MP_ROM_PTR(&digitalio_pingroup_direction_obj) },
+    { MP_ROM_QSTR(MP_QSTR_value),              MP_ROM_PTR(&digitalio_pingroup_value_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(digitalio_pingroup_locals_dict, digitalio_pingroup_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    digitalio_pingroup_type,
+    MP_QSTR_PinGroup,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, digitalio_pingroup_make_new,
+    locals_dict, &digitalio_pingroup_locals_dict
+    );
+
+#endif // CIRCUITPY_DIGITALIO_PINGROUP
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-module/digitalio/PinGroup.h"
+
+extern const mp_obj_type_t digitalio_pingroup_type;
+
+void common_hal_digitalio_pingroup_construct(digitalio_pingroup_obj_t *self, const mcu_pin_obj_t **pins, size_t num_pins);
+void common_hal_digitalio_pingroup_deinit(digitalio_pingroup_obj_t *self);
+bool common_hal_digitalio_pingroup_deinited(digitalio_pingroup_obj_t *self);
+digitalinout_result_t common_hal_digitalio_pingroup_switch_to_input(digitalio_pingroup_obj_t *self, digitalio_pull_t pull);
+digitalinout_result_t common_hal_digitalio_pingroup_switch_to_output(digitalio_pingroup_obj_t *self, uint32_t value, digitalio_drive_mode_t drive_mode);
+bool common_hal_digitalio_pingroup_get_output(digitalio_pingroup_obj_t *self);
+uint32_t common_hal_digitalio_pingroup_get_value(digitalio_pingroup_obj_t *self);
+void common_hal_digitalio_pingroup_write(digitalio_pingroup_obj_t *self, uint32_t value, uint32_t mask);
+void common_hal_digitalio_pingroup_write_sequence(digitalio_pingroup_obj_t *self, const void *values, size_t len, size_t itemsize, uint32_t delay_us);
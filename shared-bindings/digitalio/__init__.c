@@ -14,6 +14,7 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/digitalio/Direction.h"
 #include "shared-bindings/digitalio/DriveMode.h"
+#include "shared-bindings/digitalio/PinGroup.h"
 #include "shared-bindings/digitalio/Pull.h"
 
 #include "py/runtime.h"
@@ -84,6 +85,9 @@
 static const mp_rom_map_elem_t digitalio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_digitalio) },
     { MP_ROM_QSTR(MP_QSTR_DigitalInOut),  MP_ROM_PTR(&digitalio_digitalinout_type) },
+    #if CIRCUITPY_DIGITALIO_PINGROUP
+    { MP_ROM_QSTR(MP_QSTR_PinGroup),      MP_ROM_PTR(&digitalio_pingroup_type) },
+    #endif
 
     // Enum-like Classes.
     { MP_ROM_QSTR(MP_QSTR_Direction),          MP_ROM_PTR(&digitalio_direction_type) },
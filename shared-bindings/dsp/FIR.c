@@ -0,0 +1,111 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/dsp/__init__.h"
+#include "shared-bindings/dsp/FIR.h"
+
+//| class FIR:
+//|     def __init__(self, taps: ReadableBuffer, *, decimation: int = 1) -> None:
+//|         """A finite impulse response filter, optionally followed by decimation.
+//|
+//|         Each output sample is ``sum(taps[j] * x[n - j])``. The last
+//|         ``len(taps) - 1`` input samples are kept between calls to `filter`, so
+//|         a long signal can be filtered in blocks without gaps.
+//|
+//|         :param ReadableBuffer taps: The filter coefficients, an array of type ``'f'``.
+//|           They are copied, so later changes to ``taps`` have no effect.
+//|         :param int decimation: Keep only every ``decimation``-th output sample"""
+//|
+static mp_obj_t dsp_fir_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_taps, ARG_decimation };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_taps, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_decimation, MP_ARG_INT | MP_ARG_KW_ONLY, { .u_int = 1 } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t n_taps;
+    float *taps = dsp_get_float_buffer(args[ARG_taps].u_obj, MP_QSTR_taps, MP_BUFFER_READ, &n_taps);
+    mp_arg_validate_length_min(n_taps, 1, MP_QSTR_taps);
+    size_t decimation = mp_arg_validate_int_min(args[ARG_decimation].u_int, 1, MP_QSTR_decimation);
+
+    dsp_fir_obj_t *self = mp_obj_malloc_var(dsp_fir_obj_t, coefficients, float, 2 * n_taps - 1, &dsp_fir_type);
+    common_hal_dsp_fir_construct(self, taps, n_taps, decimation);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     decimation: int
+//|     """The decimation factor (read only)"""
+//|
+static mp_obj_t dsp_fir_get_decimation(mp_obj_t self_in) {
+    dsp_fir_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_dsp_fir_get_decimation(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dsp_fir_get_decimation_obj, dsp_fir_get_decimation);
+
+MP_PROPERTY_GETTER(dsp_fir_decimation_obj,
+    (mp_obj_t)&dsp_fir_get_decimation_obj);
+
+//|     def filter(self, input: ReadableBuffer, output: WriteableBuffer) -> WriteableBuffer:
+//|         """Filter ``input`` into ``output``.
+//|
+//|         Both are arrays of type ``'f'`` and must not be the same buffer. The length
+//|         of ``input`` must be a multiple of `decimation`, and ``output`` must hold
+//|         at least ``len(input) // decimation`` values.
+//|
+//|         Returns the output buffer."""
+//|
+static mp_obj_t dsp_fir_filter(mp_obj_t self_in, mp_obj_t input_in, mp_obj_t output_in) {
+    dsp_fir_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    size_t n_input, n_output;
+    float *input = dsp_get_float_buffer(input_in, MP_QSTR_input, MP_BUFFER_READ, &n_input);
+    float *output = dsp_get_float_buffer(output_in, MP_QSTR_output, MP_BUFFER_WRITE, &n_output);
+    size_t decimation = common_hal_dsp_fir_get_decimation(self);
+    if (n_input % decimation != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_input);
+    }
+    mp_arg_validate_length_min(n_output, n_input / decimation, MP_QSTR_output);
+    if (output < input + n_input && input < output + n_output) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_output);
+    }
+
+    common_hal_dsp_fir_filter(self, output, input, n_input);
+    return output_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(dsp_fir_filter_obj, dsp_fir_filter);
+
+//|     def reset(self) -> None:
+//|         """Forget the input samples kept from previous calls to `filter`"""
+//|
+//|
+static mp_obj_t dsp_fir_reset(mp_obj_t self_in) {
+    dsp_fir_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_dsp_fir_reset(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dsp_fir_reset_obj, dsp_fir_reset);
+
+static const mp_rom_map_elem_t dsp_fir_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_filter), MP_ROM_PTR(&dsp_fir_filter_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&dsp_fir_reset_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_decimation), MP_ROM_PTR(&dsp_fir_decimation_obj) },
+};
+static MP_DEFINE_CONST_DICT(dsp_fir_locals_dict, dsp_fir_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    dsp_fir_type,
+    MP_QSTR_FIR,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, dsp_fir_make_new,
+    locals_dict, &dsp_fir_locals_dict
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/dsp/FIR.h"
+
+extern const mp_obj_type_t dsp_fir_type;
+
+void common_hal_dsp_fir_construct(dsp_fir_obj_t *self, const float *taps, size_t n_taps, size_t decimation);
+size_t common_hal_dsp_fir_get_decimation(dsp_fir_obj_t *self);
+void common_hal_dsp_fir_reset(dsp_fir_obj_t *self);
+void common_hal_dsp_fir_filter(dsp_fir_obj_t *self, float *output, const float *input, size_t n_input);
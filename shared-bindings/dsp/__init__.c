@@ -0,0 +1,188 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/enum.h"
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/dsp/__init__.h"
+#include "shared-bindings/dsp/FIR.h"
+
+//| """Signal processing on arrays of samples
+//|
+//| The functions in this module work on arrays of type ``'f'`` and write their
+//| results into a buffer supplied by the caller, so they can be used repeatedly
+//| without allocating memory. A typical spectrum analysis looks like::
+//|
+//|     import array
+//|     import dsp
+//|
+//|     samples = array.array("f", [0] * 256)
+//|     power = array.array("f", [0] * 128)
+//|     # ... fill samples ...
+//|     dsp.window(samples, dsp.Window.HANN)
+//|     dsp.rfft(samples)
+//|     dsp.power_spectrum(samples, power)
+//| """
+//|
+
+//| class Window:
+//|     """The shape of a window function"""
+//|
+//|     HANN: Window
+//|     """A Hann window, as computed by ``numpy.hanning``"""
+//|     HAMMING: Window
+//|     """A Hamming window, as computed by ``numpy.hamming``"""
+//|     BLACKMAN: Window
+//|     """A Blackman window, as computed by ``numpy.blackman``"""
+//|
+
+MAKE_ENUM_VALUE(dsp_window_type, dsp_window, HANN, DSP_WINDOW_HANN);
+MAKE_ENUM_VALUE(dsp_window_type, dsp_window, HAMMING, DSP_WINDOW_HAMMING);
+MAKE_ENUM_VALUE(dsp_window_type, dsp_window, BLACKMAN, DSP_WINDOW_BLACKMAN);
+
+MAKE_ENUM_MAP(dsp_window) {
+    MAKE_ENUM_MAP_ENTRY(dsp_window, HANN),
+    MAKE_ENUM_MAP_ENTRY(dsp_window, HAMMING),
+    MAKE_ENUM_MAP_ENTRY(dsp_window, BLACKMAN),
+};
+
+static MP_DEFINE_CONST_DICT(dsp_window_locals_dict, dsp_window_locals_table);
+
+MAKE_PRINTER(dsp, dsp_window);
+
+MAKE_ENUM_TYPE(dsp, Window, dsp_window);
+
+float *dsp_get_float_buffer(mp_obj_t obj, qstr arg_name, mp_uint_t flags, size_t *len) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    if (bufinfo.typecode != 'f') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'f'"), arg_name);
+    }
+    *len = bufinfo.len / sizeof(float);
+    return bufinfo.buf;
+}
+
+//| def rfft(input: ReadableBuffer, output: WriteableBuffer | None = None) -> WriteableBuffer:
+//|     """Compute the discrete Fourier transform of the real signal ``input``.
+//|
+//|     The length of ``input`` must be a power of 2, at least 2. The result has
+//|     the same length and is packed as in CMSIS-DSP's ``arm_rfft_fast_f32``:
+//|     ``output[0]`` is the DC term, ``output[1]`` is the Nyquist term, and
+//|     ``output[2*k]`` and ``output[2*k+1]`` are the real and imaginary parts
+//|     of term ``k`` for the remaining ``1 <= k < len(input) // 2``.
+//|
+//|     If ``output`` is not given, ``input`` is transformed in place.
+//|
+//|     Returns the output buffer."""
+//|     ...
+//|
+static mp_obj_t dsp_rfft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_input, ARG_output };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_output, MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t output_obj = args[ARG_output].u_obj;
+    if (output_obj == mp_const_none) {
+        output_obj = args[ARG_input].u_obj;
+    }
+
+    size_t n, output_len;
+    float *input = dsp_get_float_buffer(args[ARG_input].u_obj, MP_QSTR_input, MP_BUFFER_READ, &n);
+    float *output = dsp_get_float_buffer(output_obj, MP_QSTR_output, MP_BUFFER_WRITE, &output_len);
+    if (n < 2 || (n & (n - 1)) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_input);
+    }
+    mp_arg_validate_length_min(output_len, n, MP_QSTR_output);
+
+    common_hal_dsp_rfft(output, input, n);
+    return output_obj;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(dsp_rfft_obj, 0, dsp_rfft);
+
+//| def power_spectrum(
+//|     spectrum: ReadableBuffer, output: WriteableBuffer | None = None
+//| ) -> WriteableBuffer:
+//|     """Compute the squared magnitude of each term of a spectrum from `rfft`.
+//|
+//|     For a spectrum of length ``n``, ``n // 2`` values are written, starting
+//|     with the DC term. The Nyquist term is not included.
+//|
+//|     If ``output`` is not given, the values are written over the start of
+//|     ``spectrum`` and a memoryview of them is returned.
+//|
+//|     Returns the output buffer."""
+//|     ...
+//|
+static mp_obj_t dsp_power_spectrum(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_spectrum, ARG_output };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_spectrum, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_output, MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t n;
+    float *spectrum = dsp_get_float_buffer(args[ARG_spectrum].u_obj, MP_QSTR_spectrum, MP_BUFFER_READ, &n);
+    mp_obj_t output_obj = args[ARG_output].u_obj;
+    float *output = spectrum;
+    if (output_obj == mp_const_none) {
+        output_obj = mp_obj_new_memoryview('f', n / 2, spectrum);
+    } else {
+        size_t output_len;
+        output = dsp_get_float_buffer(output_obj, MP_QSTR_output, MP_BUFFER_WRITE, &output_len);
+        mp_arg_validate_length_min(output_len, n / 2, MP_QSTR_output);
+    }
+
+    common_hal_dsp_power_spectrum(output, spectrum, n);
+    return output_obj;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(dsp_power_spectrum_obj, 0, dsp_power_spectrum);
+
+//| def window(buffer: WriteableBuffer, kind: Window = Window.HANN) -> None:
+//|     """Multiply ``buffer`` in place by a window function of the same length."""
+//|     ...
+//|
+static mp_obj_t dsp_window_buffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_kind };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_kind, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_PTR(&dsp_window_HANN_obj) } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t n;
+    float *buffer = dsp_get_float_buffer(args[ARG_buffer].u_obj, MP_QSTR_buffer, MP_BUFFER_WRITE, &n);
+    dsp_window_t kind = cp_enum_value(&dsp_window_type, args[ARG_kind].u_obj, MP_QSTR_kind);
+
+    common_hal_dsp_window(buffer, n, kind);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(dsp_window_buffer_obj, 0, dsp_window_buffer);
+
+static const mp_rom_map_elem_t dsp_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_dsp) },
+    { MP_ROM_QSTR(MP_QSTR_FIR), MP_ROM_PTR(&dsp_fir_type) },
+    { MP_ROM_QSTR(MP_QSTR_Window), MP_ROM_PTR(&dsp_window_type) },
+    { MP_ROM_QSTR(MP_QSTR_power_spectrum), MP_ROM_PTR(&dsp_power_spectrum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_rfft), MP_ROM_PTR(&dsp_rfft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_window), MP_ROM_PTR(&dsp_window_buffer_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(dsp_module_globals, dsp_module_globals_table);
+
+const mp_obj_module_t dsp_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&dsp_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_dsp, dsp_module);
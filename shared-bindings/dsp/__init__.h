@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef enum {
+    DSP_WINDOW_HANN, DSP_WINDOW_HAMMING, DSP_WINDOW_BLACKMAN
+} dsp_window_t;
+
+extern const mp_obj_type_t dsp_window_type;
+
+// Returns the items of an array of type 'f', raising ValueError otherwise.
+float *dsp_get_float_buffer(mp_obj_t obj, qstr arg_name, mp_uint_t flags, size_t *len);
+
+void common_hal_dsp_rfft(float *output, const float *input, size_t n);
+void common_hal_dsp_power_spectrum(float *output, const float *spectrum, size_t n);
+void common_hal_dsp_window(float *buffer, size_t n, dsp_window_t kind);
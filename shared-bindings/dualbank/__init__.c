@@ -24,6 +24,11 @@
 //| and on a successful validation this partition is set as the boot partition.
 //| On next reset, firmware will be loaded from this partition.
 //|
+//| Flash is erased as writes reach it, so an update can be written as it
+//| arrives, and continued after a reset with ``resume=True``. A compressed
+//| image can be written as it is decompressed by a `zlib.decompressobj()`.
+//| `dualbank.sha256()` checks what was written against the expected image.
+//|
 //| Use cases:
 //|     * Can be used for ``OTA`` Over-The-Air updates.
 //|     * Can be used for ``dual-boot`` of different firmware versions or platforms.
@@ -42,7 +47,8 @@
 //|     import dualbank
 //|
 //|     dualbank.flash(buffer, offset)
-//|     dualbank.switch()
+//|     if dualbank.sha256() == expected_sha256:
+//|         dualbank.switch()
 //| """
 //| ...
 //|
@@ -55,21 +61,25 @@ static void raise_error_if_storage_extended(void) {
 }
 #endif
 
-//| def flash(buffer: ReadableBuffer, offset: int = 0) -> None:
+//| def flash(buffer: ReadableBuffer, offset: int = 0, *, resume: bool = False) -> None:
 //|     """Writes one of the two app partitions at the given offset.
 //|
 //|     This can be called multiple times when flashing the firmware in smaller chunks.
+//|     Chunks must not overlap. Writing them in order is fastest.
 //|
 //|     :param ReadableBuffer buffer: The entire firmware or a partial chunk.
 //|     :param int offset: Start writing at this offset in the app partition.
+//|     :param bool resume: Continue an update that was interrupted by a reset. Everything
+//|       before ``offset`` must have been written by the earlier calls.
 //|     """
 //|     ...
 //|
 static mp_obj_t dualbank_flash(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_buffer, ARG_offset };
+    enum { ARG_buffer, ARG_offset, ARG_resume };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED },
         { MP_QSTR_offset, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_resume, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
 
     #if CIRCUITPY_STORAGE_EXTEND
@@ -86,11 +96,32 @@ static mp_obj_t dualbank_flash(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
 
+    if (args[ARG_resume].u_bool) {
+        common_hal_dualbank_resume(args[ARG_offset].u_int);
+    }
     common_hal_dualbank_flash(bufinfo.buf, bufinfo.len, args[ARG_offset].u_int);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_flash_obj, 0, dualbank_flash);
 
+//| def sha256() -> bytes:
+//|     """Returns the SHA-256 digest of the next-update partition, from its start to the
+//|     end of the furthest write.
+//|
+//|     Data written in order is hashed as it is written, so this is quick. Anything
+//|     else, such as data written before `flash()` was resumed, is read back."""
+//|     ...
+//|
+static mp_obj_t dualbank_sha256(void) {
+    #if CIRCUITPY_STORAGE_EXTEND
+    raise_error_if_storage_extended();
+    #endif
+    uint8_t digest[32];
+    common_hal_dualbank_sha256(digest);
+    return mp_obj_new_bytes(digest, sizeof(digest));
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(dualbank_sha256_obj, dualbank_sha256);
+
 //| def switch() -> None:
 //|     """Switches to the next-update partition.
 //|
@@ -112,6 +143,7 @@ static const mp_rom_map_elem_t dualbank_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_dualbank) },
     // module functions
     { MP_ROM_QSTR(MP_QSTR_flash), MP_ROM_PTR(&dualbank_flash_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&dualbank_sha256_obj) },
     { MP_ROM_QSTR(MP_QSTR_switch), MP_ROM_PTR(&dualbank_switch_obj) },
 };
 static MP_DEFINE_CONST_DICT(dualbank_module_globals, dualbank_module_globals_table);
@@ -10,3 +10,6 @@
 
 extern void common_hal_dualbank_switch(void);
 extern void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset);
+// Continue an update whose data below offset was written before a reset.
+extern void common_hal_dualbank_resume(size_t offset);
+extern void common_hal_dualbank_sha256(uint8_t digest[32]);
@@ -62,7 +62,9 @@
 //|         advanced_color_epaper: bool = False,
 //|         two_byte_sequence_length: bool = False,
 //|         start_up_time: float = 0,
-//|         address_little_endian: bool = False
+//|         address_little_endian: bool = False,
+//|         partial_refresh_sequence: Optional[ReadableBuffer] = None,
+//|         full_refresh_interval: int = 0
 //|     ) -> None:
 //|         """Create a EPaperDisplay object on the given display bus (`fourwire.FourWire` or `paralleldisplaybus.ParallelBus`).
 //|
@@ -105,6 +107,11 @@
 //|         :param bool two_byte_sequence_length: When true, use two bytes to define sequence length
 //|         :param float start_up_time: Time to wait after reset before sending commands
 //|         :param bool address_little_endian: Send the least significant byte (not bit) of multi-byte addresses first. Ignored when ram is addressed with one byte
+//|         :param ~circuitpython_typing.ReadableBuffer partial_refresh_sequence: Byte-packed command sequence used
+//|           instead of ``refresh_display_command`` when only part of the display changed, such as one that
+//|           loads the controller's partial update waveform and starts the update. Requires the window commands.
+//|         :param int full_refresh_interval: Number of partial refreshes after which the next refresh is a full
+//|           refresh to clear ghosting. 0 never forces one.
 //|         """
 //|         ...
 static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -115,7 +122,8 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
            ARG_write_color_ram_command, ARG_color_bits_inverted, ARG_highlight_color,
            ARG_refresh_display_command,  ARG_refresh_time, ARG_busy_pin, ARG_busy_state,
            ARG_seconds_per_frame, ARG_always_toggle_chip_select, ARG_grayscale, ARG_advanced_color_epaper,
-           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian };
+           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian,
+           ARG_partial_refresh_sequence, ARG_full_refresh_interval };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_start_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -147,6 +155,8 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         { MP_QSTR_two_byte_sequence_length, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
         { MP_QSTR_start_up_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
         { MP_QSTR_address_little_endian, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_partial_refresh_sequence, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_full_refresh_interval, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -200,6 +210,12 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_refresh_display_command);
     }
 
+    mp_buffer_info_t partial_refresh_bufinfo = { .buf = NULL, .len = 0 };
+    if (args[ARG_partial_refresh_sequence].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_partial_refresh_sequence].u_obj, &partial_refresh_bufinfo, MP_BUFFER_READ);
+    }
+    mp_int_t full_refresh_interval = mp_arg_validate_int_range(args[ARG_full_refresh_interval].u_int, 0, 0xffff, MP_QSTR_full_refresh_interval);
+
     self->base.type = &epaperdisplay_epaperdisplay_type;
     common_hal_epaperdisplay_epaperdisplay_construct(
         self,
@@ -215,6 +231,8 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         args[ARG_always_toggle_chip_select].u_bool, args[ARG_grayscale].u_bool, args[ARG_advanced_color_epaper].u_bool,
         two_byte_sequence_length, args[ARG_address_little_endian].u_bool
         );
+    common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(self,
+        partial_refresh_bufinfo.buf, partial_refresh_bufinfo.len, full_refresh_interval);
 
     return self;
 }
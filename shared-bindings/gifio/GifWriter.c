@@ -22,6 +22,8 @@
 //|         colorspace: displayio.Colorspace,
 //|         loop: bool = True,
 //|         dither: bool = False,
+//|         *,
+//|         delta: bool = False,
 //|     ) -> None:
 //|         """Construct a GifWriter object
 //|
@@ -31,10 +33,16 @@
 //|         :param colorspace: The colorspace of the image.  All frames must have the same colorspace.  The supported colorspaces are ``RGB565``, ``BGR565``, ``RGB565_SWAPPED``, ``BGR565_SWAPPED``, and ``L8`` (greyscale)
 //|         :param loop: If True, the GIF is marked for looping playback
 //|         :param dither: If True, and the image is in color, a simple ordered dither is applied.
+//|         :param delta: If True, each frame after the first only stores the box around the pixels that
+//|             changed since the one before, with unchanged pixels inside it left transparent. This needs
+//|             a byte of memory per pixel, and makes recordings of mostly still images much smaller and faster to write.
+//|
+//|         Frames are LZW compressed and written out as they are encoded, so no buffer the size of a frame is needed
+//|         beyond the one for ``delta``.
 //|         """
 //|         ...
 static mp_obj_t gifio_gifwriter_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_file, ARG_width, ARG_height, ARG_colorspace, ARG_loop, ARG_dither };
+    enum { ARG_file, ARG_width, ARG_height, ARG_colorspace, ARG_loop, ARG_dither, ARG_delta };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = NULL} },
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
@@ -42,6 +50,7 @@ static mp_obj_t gifio_gifwriter_make_new(const mp_obj_type_t *type, size_t n_arg
         { MP_QSTR_colorspace, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = NULL} },
         { MP_QSTR_loop, MP_ARG_BOOL, { .u_bool = true } },
         { MP_QSTR_dither, MP_ARG_BOOL, { .u_bool = false } },
+        { MP_QSTR_delta, MP_ARG_BOOL | MP_ARG_KW_ONLY, { .u_bool = false } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -57,11 +66,12 @@ static mp_obj_t gifio_gifwriter_make_new(const mp_obj_type_t *type, size_t n_arg
     shared_module_gifio_gifwriter_construct(
         self,
         file,
-        args[ARG_width].u_int,
-        args[ARG_height].u_int,
+        mp_arg_validate_int_range(args[ARG_width].u_int, 1, 65535, MP_QSTR_width),
+        mp_arg_validate_int_range(args[ARG_height].u_int, 1, 65535, MP_QSTR_height),
         (displayio_colorspace_t)cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace),
         args[ARG_loop].u_bool,
         args[ARG_dither].u_bool,
+        args[ARG_delta].u_bool,
         own_file);
 
     return self;
@@ -14,6 +14,10 @@
 #include "shared-bindings/util.h"
 #include "shared-bindings/gifio/OnDiskGif.h"
 
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#endif
+
 //| class OnDiskGif:
 //|     """Loads one frame of a GIF into memory at a time.
 //|
@@ -78,6 +82,16 @@
 //|           display_bus.send(43, struct.pack(">hh", 0, odg.bitmap.height - 1))
 //|           display_bus.send(44, odg.bitmap)
 //|
+//|     Rows can also be sent to the display as they are decoded, which avoids
+//|     waiting for a full refresh of the bitmap. With ``skip_late``, frames that
+//|     decoding has fallen behind on are not shown, to keep to the GIF's timing:
+//|
+//|     .. code-block:: Python
+//|
+//|       display.auto_refresh = False
+//|       while True:
+//|           time.sleep(odg.next_frame(display, skip_late=True))
+//|
 //|       # The following optional code will free the OnDiskGif and allocated resources
 //|       # after use. This may be required before loading a new GIF in situations
 //|       # where RAM is limited and the first GIF took most of the RAM.
@@ -204,16 +218,72 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_palette_obj, gifio_ondiskgif_obj_g
 MP_PROPERTY_GETTER(gifio_ondiskgif_palette_obj,
     (mp_obj_t)&gifio_ondiskgif_get_palette_obj);
 
-//|     def next_frame(self) -> float:
-//|         """Loads the next frame. Returns expected delay before the next frame in seconds."""
-static mp_obj_t gifio_ondiskgif_obj_next_frame(mp_obj_t self_in) {
+//|     def next_frame(
+//|         self,
+//|         display: Optional[busdisplay.BusDisplay] = None,
+//|         *,
+//|         x: int = 0,
+//|         y: int = 0,
+//|         skip_late: bool = False,
+//|     ) -> float:
+//|         """Loads the next frame. Returns expected delay before the next frame in seconds.
+//|
+//|         :param busdisplay.BusDisplay display: If given, each row is sent straight to this
+//|           display as it is decoded instead of marking ``bitmap`` dirty for displayio to
+//|           refresh. The GIF must not use a palette and the display must take 16 bit
+//|           pixels in its native orientation. Turn off ``auto_refresh`` so that displayio
+//|           doesn't hold the bus while the frame is drawn.
+//|         :param int x: The display column of the GIF's left edge
+//|         :param int y: The display row of the GIF's top edge
+//|         :param bool skip_late: Keep to the GIF's timing when decoding falls behind.
+//|           Frames that are already late are decoded into ``bitmap`` but not shown, and the
+//|           return value is the time left until the next frame is due rather than the
+//|           frame's own delay."""
+static mp_obj_t gifio_ondiskgif_obj_next_frame(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_display, ARG_x, ARG_y, ARG_skip_late };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_display, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_skip_late, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    check_for_deinit(self);
+
+    mp_obj_t display = args[ARG_display].u_obj;
+    #if CIRCUITPY_BUSDISPLAY
+    mp_arg_validate_type_or_none(display, &busdisplay_busdisplay_type, MP_QSTR_display);
+    #else
+    if (display != mp_const_none) {
+        mp_raise_NotImplementedError_varg(MP_ERROR_TEXT("%q"), MP_QSTR_display);
+    }
+    #endif
+    int16_t x = mp_arg_validate_int_range(args[ARG_x].u_int, -32768, 32767, MP_QSTR_x);
+    int16_t y = mp_arg_validate_int_range(args[ARG_y].u_int, -32768, 32767, MP_QSTR_y);
+
+    uint32_t delay = common_hal_gifio_ondiskgif_next_frame_to(self, display, x, y, args[ARG_skip_late].u_bool);
+    return mp_obj_new_float((float)delay / 1000);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(gifio_ondiskgif_next_frame_obj, 1, gifio_ondiskgif_obj_next_frame);
+
+//|     frames_skipped: int
+//|     """The number of frames ``next_frame(skip_late=True)`` has decoded without showing
+//|     because they were late. (read only)"""
+static mp_obj_t gifio_ondiskgif_obj_get_frames_skipped(mp_obj_t self_in) {
     gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
 
     check_for_deinit(self);
-    return mp_obj_new_float((float)common_hal_gifio_ondiskgif_next_frame(self, true) / 1000);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_gifio_ondiskgif_get_frames_skipped(self));
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_next_frame_obj, gifio_ondiskgif_obj_next_frame);
+MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_frames_skipped_obj, gifio_ondiskgif_obj_get_frames_skipped);
+
+MP_PROPERTY_GETTER(gifio_ondiskgif_frames_skipped_obj,
+    (mp_obj_t)&gifio_ondiskgif_get_frames_skipped_obj);
 
 
 //|     duration: float
@@ -293,6 +363,7 @@ static const mp_rom_map_elem_t gifio_ondiskgif_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_palette), MP_ROM_PTR(&gifio_ondiskgif_palette_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&gifio_ondiskgif_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_next_frame), MP_ROM_PTR(&gifio_ondiskgif_next_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frames_skipped), MP_ROM_PTR(&gifio_ondiskgif_frames_skipped_obj) },
     { MP_ROM_QSTR(MP_QSTR_duration), MP_ROM_PTR(&gifio_ondiskgif_duration_obj) },
     { MP_ROM_QSTR(MP_QSTR_frame_count), MP_ROM_PTR(&gifio_ondiskgif_frame_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_min_delay), MP_ROM_PTR(&gifio_ondiskgif_min_delay_obj) },
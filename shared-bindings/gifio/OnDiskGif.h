@@ -21,6 +21,8 @@ mp_obj_t common_hal_gifio_ondiskgif_get_bitmap(gifio_ondiskgif_t *self);
 mp_obj_t common_hal_gifio_ondiskgif_get_palette(gifio_ondiskgif_t *self);
 uint16_t common_hal_gifio_ondiskgif_get_width(gifio_ondiskgif_t *self);
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty);
+uint32_t common_hal_gifio_ondiskgif_next_frame_to(gifio_ondiskgif_t *self, mp_obj_t display, int16_t x, int16_t y, bool skip_late);
+int32_t common_hal_gifio_ondiskgif_get_frames_skipped(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_duration(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_frame_count(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_min_delay(gifio_ondiskgif_t *self);
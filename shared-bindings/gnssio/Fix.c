@@ -0,0 +1,184 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/gnssio/Fix.h"
+#if CIRCUITPY_TIME
+#include "shared-bindings/time/__init__.h"
+#endif
+
+//| class Fix:
+//|     """A copy of a receiver's latest position fix
+//|
+//|     Create one Fix and pass it to `Receiver.read_fix` each time, so that
+//|     reading a receiver doesn't allocate. Reading a float property doesn't
+//|     allocate either."""
+//|
+//|     def __init__(self) -> None:
+//|         """Create an empty, invalid fix."""
+//|         ...
+//|
+static mp_obj_t gnssio_fix_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    gnssio_fix_obj_t *self = mp_obj_malloc(gnssio_fix_obj_t, &gnssio_fix_type);
+    common_hal_gnssio_fix_construct(self);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     valid: bool
+//|     """True when the receiver had a position. The position fields keep their
+//|     last values while it is False. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_valid(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_gnssio_fix_get_valid(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_valid_obj, gnssio_fix_obj_get_valid);
+
+MP_PROPERTY_GETTER(gnssio_fix_valid_obj,
+    (mp_obj_t)&gnssio_fix_get_valid_obj);
+
+//|     quality: int
+//|     """0 for no fix, 1 for a GNSS fix and 2 for a differential fix, as in NMEA GGA
+//|     sentences. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_quality(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_gnssio_fix_get_quality(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_quality_obj, gnssio_fix_obj_get_quality);
+
+MP_PROPERTY_GETTER(gnssio_fix_quality_obj,
+    (mp_obj_t)&gnssio_fix_get_quality_obj);
+
+//|     satellites: int
+//|     """Number of satellites used. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_satellites(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_gnssio_fix_get_satellites(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_satellites_obj, gnssio_fix_obj_get_satellites);
+
+MP_PROPERTY_GETTER(gnssio_fix_satellites_obj,
+    (mp_obj_t)&gnssio_fix_get_satellites_obj);
+
+//|     latitude: float
+//|     """Latitude in degrees, negative in the south. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_latitude(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_gnssio_fix_get_latitude(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_latitude_obj, gnssio_fix_obj_get_latitude);
+
+MP_PROPERTY_GETTER(gnssio_fix_latitude_obj,
+    (mp_obj_t)&gnssio_fix_get_latitude_obj);
+
+//|     longitude: float
+//|     """Longitude in degrees, negative in the west. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_longitude(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_gnssio_fix_get_longitude(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_longitude_obj, gnssio_fix_obj_get_longitude);
+
+MP_PROPERTY_GETTER(gnssio_fix_longitude_obj,
+    (mp_obj_t)&gnssio_fix_get_longitude_obj);
+
+//|     altitude: float
+//|     """Altitude above mean sea level in meters. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_altitude(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_gnssio_fix_get_altitude(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_altitude_obj, gnssio_fix_obj_get_altitude);
+
+MP_PROPERTY_GETTER(gnssio_fix_altitude_obj,
+    (mp_obj_t)&gnssio_fix_get_altitude_obj);
+
+//|     speed: float
+//|     """Speed over the ground in meters per second. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_speed(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_gnssio_fix_get_speed(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_speed_obj, gnssio_fix_obj_get_speed);
+
+MP_PROPERTY_GETTER(gnssio_fix_speed_obj,
+    (mp_obj_t)&gnssio_fix_get_speed_obj);
+
+//|     course: float
+//|     """Direction of motion in degrees clockwise from true north. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_course(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_gnssio_fix_get_course(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_course_obj, gnssio_fix_obj_get_course);
+
+MP_PROPERTY_GETTER(gnssio_fix_course_obj,
+    (mp_obj_t)&gnssio_fix_get_course_obj);
+
+//|     dop: float
+//|     """Dilution of precision: the horizontal DOP from NMEA, or the position DOP
+//|     from UBX. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_dop(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_gnssio_fix_get_dop(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_dop_obj, gnssio_fix_obj_get_dop);
+
+MP_PROPERTY_GETTER(gnssio_fix_dop_obj,
+    (mp_obj_t)&gnssio_fix_get_dop_obj);
+
+#if CIRCUITPY_TIME
+//|     timestamp: Optional[time.struct_time]
+//|     """UTC time of the fix, or None until the receiver has sent the date. Reading
+//|     this allocates a `time.struct_time`. (read-only)"""
+//|
+static mp_obj_t gnssio_fix_obj_get_timestamp(mp_obj_t self_in) {
+    gnssio_fix_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    timeutils_struct_time_t tm;
+    if (!common_hal_gnssio_fix_get_timestamp(self, &tm)) {
+        return mp_const_none;
+    }
+    return struct_time_from_tm(&tm);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnssio_fix_get_timestamp_obj, gnssio_fix_obj_get_timestamp);
+
+MP_PROPERTY_GETTER(gnssio_fix_timestamp_obj,
+    (mp_obj_t)&gnssio_fix_get_timestamp_obj);
+#endif
+
+static const mp_rom_map_elem_t gnssio_fix_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_valid), MP_ROM_PTR(&gnssio_fix_valid_obj) },
+    { MP_ROM_QSTR(MP_QSTR_quality), MP_ROM_PTR(&gnssio_fix_quality_obj) },
+    { MP_ROM_QSTR(MP_QSTR_satellites), MP_ROM_PTR(&gnssio_fix_satellites_obj) },
+    { MP_ROM_QSTR(MP_QSTR_latitude), MP_ROM_PTR(&gnssio_fix_latitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_longitude), MP_ROM_PTR(&gnssio_fix_longitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_altitude), MP_ROM_PTR(&gnssio_fix_altitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_speed), MP_ROM_PTR(&gnssio_fix_speed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_course), MP_ROM_PTR(&gnssio_fix_course_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dop), MP_ROM_PTR(&gnssio_fix_dop_obj) },
+    #if CIRCUITPY_TIME
+    { MP_ROM_QSTR(MP_QSTR_timestamp), MP_ROM_PTR(&gnssio_fix_timestamp_obj) },
+    #endif
+};
+static MP_DEFINE_CONST_DICT(gnssio_fix_locals_dict, gnssio_fix_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    gnssio_fix_type,
+    MP_QSTR_Fix,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, gnssio_fix_make_new,
+    locals_dict, &gnssio_fix_locals_dict
+    );
@@ -0,0 +1,25 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/gnssio/Fix.h"
+#include "shared/timeutils/timeutils.h"
+
+extern const mp_obj_type_t gnssio_fix_type;
+
+void common_hal_gnssio_fix_construct(gnssio_fix_obj_t *self);
+bool common_hal_gnssio_fix_get_valid(gnssio_fix_obj_t *self);
+uint8_t common_hal_gnssio_fix_get_quality(gnssio_fix_obj_t *self);
+uint8_t common_hal_gnssio_fix_get_satellites(gnssio_fix_obj_t *self);
+mp_float_t common_hal_gnssio_fix_get_latitude(gnssio_fix_obj_t *self);
+mp_float_t common_hal_gnssio_fix_get_longitude(gnssio_fix_obj_t *self);
+mp_float_t common_hal_gnssio_fix_get_altitude(gnssio_fix_obj_t *self);
+mp_float_t common_hal_gnssio_fix_get_speed(gnssio_fix_obj_t *self);
+mp_float_t common_hal_gnssio_fix_get_course(gnssio_fix_obj_t *self);
+mp_float_t common_hal_gnssio_fix_get_dop(gnssio_fix_obj_t *self);
+// Returns false when no date has been received.
+bool common_hal_gnssio_fix_get_timestamp(gnssio_fix_obj_t *self, timeutils_struct_time_t *tm);
@@ -0,0 +1,161 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/gnssio/Receiver.h"
+#include "shared-bindings/util.h"
+#if CIRCUITPY_BUSIO_UART
+#include "shared-bindings/busio/UART.h"
+#endif
+
+//| class Receiver:
+//|     """Parse what a GNSS receiver sends into position fixes
+//|
+//|     Usage::
+//|
+//|         import board
+//|         import busio
+//|         import gnssio
+//|
+//|         uart = busio.UART(board.TX, board.RX, baudrate=9600, receiver_buffer_size=256)
+//|         receiver = gnssio.Receiver(uart)
+//|         fix = gnssio.Fix()
+//|         while True:
+//|             if receiver.read_fix(fix) and fix.valid:
+//|                 print(fix.latitude, fix.longitude)"""
+//|
+//|     def __init__(self, uart: Optional[busio.UART] = None) -> None:
+//|         """Parse what arrives on ``uart``, or what is passed to `feed`.
+//|
+//|         A ``uart`` is read in the background every few milliseconds, so its
+//|         receive buffer only needs to hold that long's worth of bytes. Don't
+//|         read from it elsewhere while the receiver is using it.
+//|
+//|         :param busio.UART uart: The UART the receiver is connected to"""
+//|         ...
+//|
+static mp_obj_t gnssio_receiver_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_uart };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_uart, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t uart = args[ARG_uart].u_obj;
+    #if CIRCUITPY_BUSIO_UART
+    mp_arg_validate_type_or_none(uart, &busio_uart_type, MP_QSTR_uart);
+    #else
+    if (uart != mp_const_none) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_uart);
+    }
+    #endif
+
+    gnssio_receiver_obj_t *self = mp_obj_malloc_with_finaliser(gnssio_receiver_obj_t, &gnssio_receiver_type);
+    common_hal_gnssio_receiver_construct(self, uart);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Stop reading the UART. The UART itself is left as it is."""
+//|         ...
+//|
+static mp_obj_t gnssio_receiver_deinit(mp_obj_t self_in) {
+    gnssio_receiver_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_gnssio_receiver_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(gnssio_receiver_deinit_obj, gnssio_receiver_deinit);
+
+static void check_for_deinit(gnssio_receiver_obj_t *self) {
+    if (common_hal_gnssio_receiver_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Receiver:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t gnssio_receiver___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_gnssio_receiver_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gnssio_receiver___exit___obj, 4, 4, gnssio_receiver___exit__);
+
+//|     def feed(self, data: ReadableBuffer) -> None:
+//|         """Parse bytes read from the receiver some other way. Sentences and
+//|         messages may be split across calls."""
+//|         ...
+//|
+static mp_obj_t gnssio_receiver_feed(mp_obj_t self_in, mp_obj_t data_in) {
+    gnssio_receiver_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    common_hal_gnssio_receiver_feed(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(gnssio_receiver_feed_obj, gnssio_receiver_feed);
+
+//|     def read_fix(self, fix: Fix) -> bool:
+//|         """Copy the latest fix into ``fix``, first parsing anything the UART has
+//|         received.
+//|
+//|         :returns: True if a sentence or message updated the fix since the last call
+//|         :rtype: bool"""
+//|         ...
+//|
+static mp_obj_t gnssio_receiver_read_fix(mp_obj_t self_in, mp_obj_t fix_in) {
+    gnssio_receiver_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    gnssio_fix_obj_t *fix = MP_OBJ_TO_PTR(mp_arg_validate_type(fix_in, &gnssio_fix_type, MP_QSTR_fix));
+    return mp_obj_new_bool(common_hal_gnssio_receiver_read_fix(self, fix));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(gnssio_receiver_read_fix_obj, gnssio_receiver_read_fix);
+
+//|     checksum_errors: int
+//|     """Number of sentences and messages dropped because their checksum was wrong.
+//|     (read-only)"""
+//|
+static mp_obj_t gnssio_receiver_get_checksum_errors(mp_obj_t self_in) {
+    gnssio_receiver_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_gnssio_receiver_get_checksum_errors(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(gnssio_receiver_get_checksum_errors_obj, gnssio_receiver_get_checksum_errors);
+
+MP_PROPERTY_GETTER(gnssio_receiver_checksum_errors_obj,
+    (mp_obj_t)&gnssio_receiver_get_checksum_errors_obj);
+
+static const mp_rom_map_elem_t gnssio_receiver_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&gnssio_receiver_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&gnssio_receiver_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&gnssio_receiver___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&gnssio_receiver_feed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_fix), MP_ROM_PTR(&gnssio_receiver_read_fix_obj) },
+    { MP_ROM_QSTR(MP_QSTR_checksum_errors), MP_ROM_PTR(&gnssio_receiver_checksum_errors_obj) },
+};
+static MP_DEFINE_CONST_DICT(gnssio_receiver_locals_dict, gnssio_receiver_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    gnssio_receiver_type,
+    MP_QSTR_Receiver,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, gnssio_receiver_make_new,
+    locals_dict, &gnssio_receiver_locals_dict
+    );
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-bindings/gnssio/Fix.h"
+#include "shared-module/gnssio/Receiver.h"
+
+extern const mp_obj_type_t gnssio_receiver_type;
+
+// uart is a busio.UART or None.
+void common_hal_gnssio_receiver_construct(gnssio_receiver_obj_t *self, mp_obj_t uart);
+void common_hal_gnssio_receiver_deinit(gnssio_receiver_obj_t *self);
+bool common_hal_gnssio_receiver_deinited(gnssio_receiver_obj_t *self);
+void common_hal_gnssio_receiver_feed(gnssio_receiver_obj_t *self, const uint8_t *data, size_t len);
+// Copies the latest fix into fix. Returns true when a sentence or message
+// updated it since the last call.
+bool common_hal_gnssio_receiver_read_fix(gnssio_receiver_obj_t *self, gnssio_fix_obj_t *fix);
+uint32_t common_hal_gnssio_receiver_get_checksum_errors(gnssio_receiver_obj_t *self);
@@ -0,0 +1,36 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/gnssio/Fix.h"
+#include "shared-bindings/gnssio/Receiver.h"
+
+//| """Position fixes from GNSS receivers
+//|
+//| The `gnssio` module parses the NMEA 0183 sentences and u-blox UBX messages
+//| that GNSS receivers send, natively and without allocating, so reading a
+//| receiver on a UART doesn't build a string for every sentence.
+//|
+//| NMEA GGA and RMC sentences from any talker, and UBX NAV-PVT messages, are
+//| used. Everything else is skipped. For the CXD56's built in receiver, use
+//| `gnss` instead."""
+
+static const mp_rom_map_elem_t gnssio_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gnssio) },
+    { MP_ROM_QSTR(MP_QSTR_Fix), MP_ROM_PTR(&gnssio_fix_type) },
+    { MP_ROM_QSTR(MP_QSTR_Receiver), MP_ROM_PTR(&gnssio_receiver_type) },
+};
+
+static MP_DEFINE_CONST_DICT(gnssio_module_globals, gnssio_module_globals_table);
+
+const mp_obj_module_t gnssio_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&gnssio_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_gnssio, gnssio_module);
@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/hashlib/Hash.h"
 
 #include "py/obj.h"
@@ -26,6 +28,21 @@ static mp_obj_t hashlib_hash_digest_size_get(mp_obj_t self_in) {
 MP_DEFINE_CONST_FUN_OBJ_1(hashlib_hash_digest_size_get_obj, hashlib_hash_digest_size_get);
 MP_PROPERTY_GETTER(hashlib_hash_digest_size_obj, (mp_obj_t)&hashlib_hash_digest_size_get_obj);
 
+//|     backend: str
+//|     """Name of the implementation doing the hashing: ``"mbedtls"`` for software, or the name
+//|     of the hardware engine. A hash using a hardware engine moves to software when another hash
+//|     of the same kind is created or when `digest()` is called. (read-only)
+//|
+//|     This is a CircuitPython extension, meant for checking that hardware is used."""
+static mp_obj_t hashlib_hash_backend_get(mp_obj_t self_in) {
+    mp_check_self(mp_obj_is_type(self_in, &hashlib_hash_type));
+    hashlib_hash_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const char *backend = common_hal_hashlib_hash_get_backend(self);
+    return mp_obj_new_str(backend, strlen(backend));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(hashlib_hash_backend_get_obj, hashlib_hash_backend_get);
+MP_PROPERTY_GETTER(hashlib_hash_backend_obj, (mp_obj_t)&hashlib_hash_backend_get_obj);
+
 //|     def update(self, data: ReadableBuffer) -> None:
 //|         """Update the hash with the given bytes.
 //|
@@ -63,6 +80,7 @@ static MP_DEFINE_CONST_FUN_OBJ_1(hashlib_hash_digest_obj, hashlib_hash_digest);
 
 static const mp_rom_map_elem_t hashlib_hash_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_digest_size), MP_ROM_PTR(&hashlib_hash_digest_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_backend), MP_ROM_PTR(&hashlib_hash_backend_obj) },
     { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&hashlib_hash_update_obj) },
     { MP_ROM_QSTR(MP_QSTR_digest), MP_ROM_PTR(&hashlib_hash_digest_obj) },
 };
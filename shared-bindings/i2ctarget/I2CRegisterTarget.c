@@ -0,0 +1,149 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_I2CTARGET_REGISTERS
+
+#include "shared-bindings/i2ctarget/I2CRegisterTarget.h"
+
+//| class I2CRegisterTarget:
+//|     """An I2C target that serves a block of registers without Python
+//|
+//|     The controller writes a register index, then reads or writes registers
+//|     starting there, moving to the next one after each byte. A read that
+//|     doesn't write an index first continues from where the last transfer
+//|     stopped. The index wraps around at the end of the registers.
+//|
+//|     Transfers are handled as they happen, so the controller doesn't wait
+//|     for Python. Python updates the registers it wants the controller to
+//|     read, and checks `changes` for the ones the controller wrote."""
+//|
+//|     def __init__(
+//|         self,
+//|         scl: microcontroller.Pin,
+//|         sda: microcontroller.Pin,
+//|         address: int,
+//|         registers: WriteableBuffer,
+//|     ) -> None:
+//|         """Respond to ``address`` with the contents of ``registers``.
+//|
+//|         :param ~microcontroller.Pin scl: The clock pin
+//|         :param ~microcontroller.Pin sda: The data pin
+//|         :param int address: The 7-bit address to respond to
+//|         :param ~circuitpython_typing.WriteableBuffer registers: Up to 256 bytes
+//|           of registers. The controller reads and writes this buffer directly.
+//|
+//|         Share a status byte and a settings byte::
+//|
+//|           import board
+//|           import i2ctarget
+//|
+//|           registers = bytearray(2)
+//|           target = i2ctarget.I2CRegisterTarget(board.SCL, board.SDA, 0x40, registers)
+//|           while True:
+//|               registers[0] = read_status()
+//|               if target.changes():
+//|                   apply_setting(registers[1])"""
+//|         ...
+//|
+static mp_obj_t i2ctarget_i2c_register_target_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_scl, ARG_sda, ARG_address, ARG_registers };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_scl, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_sda, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_address, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_registers, MP_ARG_REQUIRED | MP_ARG_OBJ },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const mcu_pin_obj_t *scl = validate_obj_is_free_pin(args[ARG_scl].u_obj, MP_QSTR_scl);
+    const mcu_pin_obj_t *sda = validate_obj_is_free_pin(args[ARG_sda].u_obj, MP_QSTR_sda);
+    uint8_t address = mp_arg_validate_int_range(args[ARG_address].u_int, 0x00, 0x7f, MP_QSTR_address);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_registers].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_range(bufinfo.len, 1, 256, MP_QSTR_registers);
+
+    i2ctarget_i2c_register_target_obj_t *self = mp_obj_malloc_with_finaliser(i2ctarget_i2c_register_target_obj_t, &i2ctarget_i2c_register_target_type);
+    common_hal_i2ctarget_i2c_register_target_construct(self, scl, sda, address,
+        args[ARG_registers].u_obj, bufinfo.buf, bufinfo.len);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Releases control of the underlying hardware so other classes can use it."""
+//|         ...
+//|
+static mp_obj_t i2ctarget_i2c_register_target_deinit(mp_obj_t self_in) {
+    i2ctarget_i2c_register_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_i2ctarget_i2c_register_target_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(i2ctarget_i2c_register_target_deinit_obj, i2ctarget_i2c_register_target_deinit);
+
+//|     def __enter__(self) -> I2CRegisterTarget:
+//|         """No-op used in Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware on context exit. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t i2ctarget_i2c_register_target___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_i2ctarget_i2c_register_target_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(i2ctarget_i2c_register_target___exit___obj, 4, 4, i2ctarget_i2c_register_target___exit__);
+
+//|     def changes(self) -> Optional[Tuple[int, int]]:
+//|         """Return ``(start, end)`` covering the registers the controller has written
+//|         since the last call, so that ``registers[start:end]`` holds every change,
+//|         or None if it hasn't written any."""
+//|         ...
+//|
+static mp_obj_t i2ctarget_i2c_register_target_changes(mp_obj_t self_in) {
+    i2ctarget_i2c_register_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2ctarget_i2c_register_target_deinited(self)) {
+        raise_deinited_error();
+    }
+    size_t start, end;
+    if (!common_hal_i2ctarget_i2c_register_target_get_changes(self, &start, &end)) {
+        return mp_const_none;
+    }
+    mp_obj_t items[] = { MP_OBJ_NEW_SMALL_INT(start), MP_OBJ_NEW_SMALL_INT(end) };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(i2ctarget_i2c_register_target_changes_obj, i2ctarget_i2c_register_target_changes);
+
+static const mp_rom_map_elem_t i2ctarget_i2c_register_target_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&i2ctarget_i2c_register_target_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&i2ctarget_i2c_register_target_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&i2ctarget_i2c_register_target___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_changes), MP_ROM_PTR(&i2ctarget_i2c_register_target_changes_obj) },
+};
+static MP_DEFINE_CONST_DICT(i2ctarget_i2c_register_target_locals_dict, i2ctarget_i2c_register_target_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    i2ctarget_i2c_register_target_type,
+    MP_QSTR_I2CRegisterTarget,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, i2ctarget_i2c_register_target_make_new,
+    locals_dict, &i2ctarget_i2c_register_target_locals_dict
+    );
+
+#endif // CIRCUITPY_I2CTARGET_REGISTERS
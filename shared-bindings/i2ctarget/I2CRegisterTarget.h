@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "common-hal/microcontroller/Pin.h"
+#include "common-hal/i2ctarget/I2CRegisterTarget.h"
+
+extern const mp_obj_type_t i2ctarget_i2c_register_target_type;
+
+// registers_obj owns registers and is kept alive by the target.
+void common_hal_i2ctarget_i2c_register_target_construct(i2ctarget_i2c_register_target_obj_t *self,
+    const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda, uint8_t address,
+    mp_obj_t registers_obj, uint8_t *registers, size_t len);
+void common_hal_i2ctarget_i2c_register_target_deinit(i2ctarget_i2c_register_target_obj_t *self);
+bool common_hal_i2ctarget_i2c_register_target_deinited(i2ctarget_i2c_register_target_obj_t *self);
+// Sets the range of registers written by the controller since the last call,
+// and returns false if there were none.
+bool common_hal_i2ctarget_i2c_register_target_get_changes(i2ctarget_i2c_register_target_obj_t *self, size_t *start, size_t *end);
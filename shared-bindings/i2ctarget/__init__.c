@@ -11,6 +11,9 @@
 
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/i2ctarget/I2CTarget.h"
+#if CIRCUITPY_I2CTARGET_REGISTERS
+#include "shared-bindings/i2ctarget/I2CRegisterTarget.h"
+#endif
 
 #include "py/runtime.h"
 
@@ -222,6 +225,9 @@
 static const mp_rom_map_elem_t i2ctarget_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_i2ctarget) },
     { MP_ROM_QSTR(MP_QSTR_I2CTarget), MP_ROM_PTR(&i2ctarget_i2c_target_type) },
+    #if CIRCUITPY_I2CTARGET_REGISTERS
+    { MP_ROM_QSTR(MP_QSTR_I2CRegisterTarget), MP_ROM_PTR(&i2ctarget_i2c_register_target_type) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(i2ctarget_module_globals, i2ctarget_module_globals_table);
@@ -64,6 +64,36 @@ static mp_obj_t keypad_eventqueue_get_into(mp_obj_t self_in, mp_obj_t event_in)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_into_obj, keypad_eventqueue_get_into);
 
+//|     def readinto(self, events: List[Event]) -> int:
+//|         """Store queued key transition events in the existing ``Event`` objects in
+//|         ``events``, oldest first, until the queue is empty or ``events`` is full.
+//|
+//|         Like ``get_into()``, this does not allocate storage, so a loop that drains
+//|         the queue with it runs without allocating. Items past the returned count
+//|         are left unchanged.
+//|
+//|         :return: the number of events stored
+//|         :rtype: int
+//|         """
+//|         ...
+static mp_obj_t keypad_eventqueue_readinto(mp_obj_t self_in, mp_obj_t events_in) {
+    keypad_eventqueue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(events_in, &len, &items);
+    for (size_t i = 0; i < len; i++) {
+        mp_arg_validate_type(items[i], &keypad_event_type, MP_QSTR_event);
+    }
+
+    size_t count = 0;
+    while (count < len && common_hal_keypad_eventqueue_get_into(self, MP_OBJ_TO_PTR(items[count]))) {
+        count++;
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_readinto_obj, keypad_eventqueue_readinto);
+
 //|     def clear(self) -> None:
 //|         """Clear any queued key transition events. Also sets `overflowed` to ``False``."""
 //|         ...
@@ -115,6 +145,7 @@ static const mp_rom_map_elem_t keypad_eventqueue_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_clear),      MP_ROM_PTR(&keypad_eventqueue_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_get),        MP_ROM_PTR(&keypad_eventqueue_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_into),   MP_ROM_PTR(&keypad_eventqueue_get_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),   MP_ROM_PTR(&keypad_eventqueue_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_overflowed), MP_ROM_PTR(&keypad_eventqueue_overflowed_obj) },
 };
 
@@ -23,3 +23,5 @@ void common_hal_mdns_remoteservice_deinit(mdns_remoteservice_obj_t *self);
 
 // For internal use.
 uint32_t mdns_remoteservice_get_ipv4_address(mdns_remoteservice_obj_t *self);
+// Seconds until the first of the service's records expires.
+uint32_t mdns_remoteservice_get_ttl(mdns_remoteservice_obj_t *self);
@@ -14,6 +14,7 @@
 #include "shared-bindings/mdns/__init__.h"
 #include "shared-bindings/mdns/Server.h"
 #include "shared-bindings/util.h"
+#include "shared-module/mdns/__init__.h"
 
 #if CIRCUITPY_WEB_WORKFLOW
 #include "supervisor/shared/web_workflow/web_workflow.h"
@@ -113,7 +114,7 @@ MP_PROPERTY_GETSET(mdns_server_instance_name_obj,
 
 
 //|     def find(
-//|         self, service_type: str, protocol: str, *, timeout: float = 1
+//|         self, service_type: str, protocol: str, *, timeout: float = 1, max_age: float = 0
 //|     ) -> Tuple[RemoteService]:
 //|         """Find all locally available remote services with the given service type and protocol.
 //|
@@ -122,30 +123,96 @@ MP_PROPERTY_GETSET(mdns_server_instance_name_obj,
 //|
 //|         :param str service_type: The service type such as "_http"
 //|         :param str protocol: The service protocol such as "_tcp"
-//|         :param float/int timeout: Time to wait for responses"""
+//|         :param float/int timeout: Time to wait for responses
+//|         :param float/int max_age: Return the results of an earlier `find` for the same
+//|           service without asking the network again, if it was at most this many seconds
+//|           ago and none of the records it found have expired. 0 always asks the network."""
 //|         ...
 static mp_obj_t _mdns_server_find(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mdns_server_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
 
-    enum { ARG_service_type, ARG_protocol, ARG_timeout };
+    enum { ARG_service_type, ARG_protocol, ARG_timeout, ARG_max_age };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_service_type, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_protocol, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
+        { MP_QSTR_max_age, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_float_t timeout = mp_obj_get_float(args[ARG_timeout].u_obj);
+    mp_float_t max_age = mp_obj_get_float(args[ARG_max_age].u_obj);
     const char *service_type = mp_obj_str_get_str(args[ARG_service_type].u_obj);
     const char *protocol = mp_obj_str_get_str(args[ARG_protocol].u_obj);
 
-    return common_hal_mdns_server_find(self, service_type, protocol, timeout);
+    mp_obj_t results = mdns_cache_lookup(service_type, protocol, max_age);
+    if (results == MP_OBJ_NULL) {
+        results = common_hal_mdns_server_find(self, service_type, protocol, timeout);
+        mdns_cache_store(service_type, protocol, results);
+    }
+    return results;
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(mdns_server_find_obj, 1, _mdns_server_find);
 
+//|     def browse(self, service_type: str, protocol: str, *, timeout: float = 1) -> None:
+//|         """Start looking for remote services with the given service type and protocol in
+//|         the background, and return right away. Collect what is found with `browse_results`.
+//|         Starting a new browse stops the one before.
+//|
+//|         :param str service_type: The service type such as "_http"
+//|         :param str protocol: The service protocol such as "_tcp"
+//|         :param float/int timeout: Time to keep listening for responses"""
+//|         ...
+static mp_obj_t _mdns_server_browse(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mdns_server_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+
+    enum { ARG_service_type, ARG_protocol, ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_service_type, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_protocol, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t timeout = mp_obj_get_float(args[ARG_timeout].u_obj);
+    const char *service_type = mp_obj_str_get_str(args[ARG_service_type].u_obj);
+    const char *protocol = mp_obj_str_get_str(args[ARG_protocol].u_obj);
+
+    common_hal_mdns_server_browse(self, service_type, protocol, timeout);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mdns_server_browse_obj, 1, _mdns_server_browse);
+
+//|     def browse_results(self) -> Tuple[RemoteService]:
+//|         """Return the remote services found by `browse` since the last call. On Espressif
+//|         boards, they are all returned once the browse's timeout has passed."""
+//|         ...
+static mp_obj_t mdns_server_browse_results(mp_obj_t self_in) {
+    mdns_server_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_mdns_server_get_browse_results(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mdns_server_browse_results_obj, mdns_server_browse_results);
+
+//|     browsing: bool
+//|     """True while a `browse` is still listening for responses. (read-only)"""
+//|
+static mp_obj_t mdns_server_get_browsing(mp_obj_t self_in) {
+    mdns_server_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_mdns_server_get_browsing(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mdns_server_get_browsing_obj, mdns_server_get_browsing);
+
+MP_PROPERTY_GETTER(mdns_server_browsing_obj,
+    (mp_obj_t)&mdns_server_get_browsing_obj);
+
 //|     def advertise_service(self, *, service_type: str, protocol: str, port: int) -> None:
 //|         """Respond to queries for the given service with the given port.
 //|
@@ -206,6 +273,9 @@ static const mp_rom_map_elem_t mdns_server_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_instance_name),     MP_ROM_PTR(&mdns_server_instance_name_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_find),              MP_ROM_PTR(&mdns_server_find_obj) },
+    { MP_ROM_QSTR(MP_QSTR_browse),            MP_ROM_PTR(&mdns_server_browse_obj) },
+    { MP_ROM_QSTR(MP_QSTR_browse_results),    MP_ROM_PTR(&mdns_server_browse_results_obj) },
+    { MP_ROM_QSTR(MP_QSTR_browsing),          MP_ROM_PTR(&mdns_server_browsing_obj) },
     { MP_ROM_QSTR(MP_QSTR_advertise_service), MP_ROM_PTR(&mdns_server_advertise_service_obj) },
 
     { MP_ROM_QSTR(MP_QSTR___del__),           MP_ROM_PTR(&mdns_server_deinit_obj) },
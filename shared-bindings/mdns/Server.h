@@ -22,6 +22,10 @@ void common_hal_mdns_server_set_hostname(mdns_server_obj_t *self, const char *ho
 const char *common_hal_mdns_server_get_instance_name(mdns_server_obj_t *self);
 void common_hal_mdns_server_set_instance_name(mdns_server_obj_t *self, const char *instance_name);
 mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout);
+void common_hal_mdns_server_browse(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout);
+// Returns a tuple of the RemoteService found since the last call.
+mp_obj_t common_hal_mdns_server_get_browse_results(mdns_server_obj_t *self);
+bool common_hal_mdns_server_get_browsing(mdns_server_obj_t *self);
 
 /**
  * @brief Advertises service
@@ -39,3 +43,5 @@ void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const cha
 void mdns_server_construct(mdns_server_obj_t *self, bool workflow);
 size_t mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol,
     mp_float_t timeout, mdns_remoteservice_obj_t *out, size_t out_len);
+// Stops any browse and forgets its results.
+void mdns_server_browse_reset(void);
@@ -19,6 +19,8 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Processor.h"
 
+#include "supervisor/shared/perf.h"
+
 //| """Pin references and cpu functionality
 //|
 //| The `microcontroller` module defines the pins and other bare-metal hardware
@@ -119,6 +121,53 @@ static mp_obj_t mcu_reset(void) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(mcu_reset_obj, mcu_reset);
 
+#if CIRCUITPY_PERF_COUNTERS
+//| def cycles() -> int:
+//|     """Return the number of CPU clock cycles since an arbitrary point, such as
+//|     power on. This has the resolution of the CPU clock, unlike
+//|     `time.monotonic_ns`, so it can time short stretches of code. The count
+//|     stops while the CPU sleeps.
+//|
+//|     Only available on chips with a CPU cycle counter."""
+//|     ...
+//|
+static mp_obj_t mcu_cycles(void) {
+    return mp_obj_new_int_from_ull(perf_cycles());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(mcu_cycles_obj, mcu_cycles);
+
+//| def perf_counters(reset: bool = False) -> Tuple[int, int, int, int, int]:
+//|     """Return the CPU cycles the runtime has spent in garbage collection,
+//|     background tasks, display refreshes, USB and filesystem flushes, in that
+//|     order, since start up or the last reset. Background tasks include the
+//|     display refreshes and USB work they run. Compare them with `cycles` to
+//|     see how much CPU time is left for Python code.
+//|
+//|     Only available on chips with a CPU cycle counter.
+//|
+//|     :param bool reset: Clear the counts after reading them."""
+//|     ...
+//|
+static mp_obj_t mcu_perf_counters(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t items[PERF_COUNTER_COUNT];
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        items[i] = mp_obj_new_int_from_ull(perf_counter_get(i));
+    }
+    if (args[ARG_reset].u_bool) {
+        perf_counters_reset();
+    }
+    return mp_obj_new_tuple(PERF_COUNTER_COUNT, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mcu_perf_counters_obj, 0, mcu_perf_counters);
+#endif
+
 //| nvm: Optional[ByteArray]
 //| """Available non-volatile memory.
 //| This object is the sole instance of `nvm.ByteArray` when available or ``None`` otherwise.
@@ -145,6 +194,10 @@ static const mp_rom_map_elem_t mcu_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_enable_interrupts), MP_ROM_PTR(&mcu_enable_interrupts_obj) },
     { MP_ROM_QSTR(MP_QSTR_on_next_reset), MP_ROM_PTR(&mcu_on_next_reset_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&mcu_reset_obj) },
+    #if CIRCUITPY_PERF_COUNTERS
+    { MP_ROM_QSTR(MP_QSTR_cycles), MP_ROM_PTR(&mcu_cycles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_perf_counters), MP_ROM_PTR(&mcu_perf_counters_obj) },
+    #endif
     #if CIRCUITPY_NVM && CIRCUITPY_INTERNAL_NVM_SIZE > 0
     { MP_ROM_QSTR(MP_QSTR_nvm),  MP_ROM_PTR(&common_hal_mcu_nvm_obj) },
     #else
@@ -85,8 +85,8 @@
 static mp_obj_t mod_msgpack_pack(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_obj, ARG_buffer, ARG_default };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_obj, MP_ARG_REQUIRED | MP_ARG_OBJ },
-        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_obj, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_default, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -123,7 +123,7 @@ MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_obj, 0, mod_msgpack_pack);
 static mp_obj_t mod_msgpack_unpack(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_buffer, ARG_ext_hook, ARG_use_list };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, },
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
     };
@@ -140,11 +140,116 @@ static mp_obj_t mod_msgpack_unpack(size_t n_args, const mp_obj_t *pos_args, mp_m
 MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_unpack_obj, 0, mod_msgpack_unpack);
 
 
+//| def pack_into(
+//|     obj: object,
+//|     buffer: WriteableBuffer,
+//|     offset: int = 0,
+//|     *,
+//|     default: Union[Callable[[object], None], None] = None
+//| ) -> int:
+//|     """Output object to buffer in msgpack format, starting at offset.
+//|     Nothing is allocated, so this can be used to build frames in a
+//|     preallocated buffer.
+//|
+//|     :param object obj: Object to convert to msgpack format.
+//|     :param ~circuitpython_typing.WriteableBuffer buffer: buffer to write to
+//|     :param int offset: position in buffer to start writing at
+//|     :param Optional[~circuitpython_typing.Callable[[object], None]] default:
+//|           function called for python objects that do not have
+//|           a representation in msgpack format.
+//|
+//|     :return int: the offset just past the packed object.
+//|
+//|     Raises `ValueError` if the object does not fit in the buffer. The part
+//|     of the buffer past offset may have been changed when this happens.
+//|     """
+//|     ...
+//|
+static mp_obj_t mod_msgpack_pack_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_obj, ARG_buffer, ARG_offset, ARG_default };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_obj, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_default, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t handler = args[ARG_default].u_obj;
+    if (handler != mp_const_none && !mp_obj_is_fun(handler) && !MP_OBJ_IS_METH(handler)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("default is not a function"));
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    size_t offset = mp_arg_validate_int_range(args[ARG_offset].u_int, 0, bufinfo.len, MP_QSTR_offset);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_msgpack_pack_into(args[ARG_obj].u_obj, bufinfo.buf, bufinfo.len, offset, handler));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_into_obj, 0, mod_msgpack_pack_into);
+
+
+//| def unpack_from(
+//|     buffer: ReadableBuffer,
+//|     offset: int = 0,
+//|     *,
+//|     ext_hook: Union[Callable[[int, bytes], object], None] = None,
+//|     use_list: bool = True,
+//|     zero_copy: bool = False
+//| ) -> Tuple[object, int]:
+//|     """Unpack one object from buffer, starting at offset.
+//|
+//|     :param ~circuitpython_typing.ReadableBuffer buffer: buffer to read from
+//|     :param int offset: position in buffer to start reading at
+//|     :param Optional[~circuitpython_typing.Callable[[int, bytes], object]] ext_hook: function called for objects in
+//|            msgpack ext format.
+//|     :param Optional[bool] use_list: return array as list or tuple (use_list=False).
+//|     :param Optional[bool] zero_copy: return bin data, and the data passed to ext_hook,
+//|            as read-only memoryviews of buffer instead of copying it to new bytes objects.
+//|            The memoryviews see any later changes to buffer.
+//|
+//|     :return tuple: the object read, and the offset just past it, which is where
+//|            the next object in buffer starts.
+//|     """
+//|     ...
+//|
+static mp_obj_t mod_msgpack_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_ext_hook, ARG_use_list, ARG_zero_copy };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
+        { MP_QSTR_zero_copy, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t hook = args[ARG_ext_hook].u_obj;
+    if (hook != mp_const_none && !mp_obj_is_fun(hook) && !MP_OBJ_IS_METH(hook)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ext_hook is not a function"));
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    size_t offset = mp_arg_validate_int_range(args[ARG_offset].u_int, 0, bufinfo.len, MP_QSTR_offset);
+
+    mp_obj_t items[2];
+    items[0] = common_hal_msgpack_unpack_from(args[ARG_buffer].u_obj, &offset, hook, args[ARG_use_list].u_bool, args[ARG_zero_copy].u_bool);
+    items[1] = MP_OBJ_NEW_SMALL_INT(offset);
+    return mp_obj_new_tuple(2, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_unpack_from_obj, 0, mod_msgpack_unpack_from);
+
+
 static const mp_rom_map_elem_t msgpack_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_msgpack) },
     { MP_ROM_QSTR(MP_QSTR_ExtType), MP_ROM_PTR(&mod_msgpack_exttype_type) },
     { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&mod_msgpack_pack_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&mod_msgpack_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&mod_msgpack_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&mod_msgpack_unpack_from_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(msgpack_module_globals, msgpack_module_globals_table);
@@ -10,6 +10,7 @@
 #include "py/runtime.h"
 #include "py/runtime0.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/onewireio/__init__.h"
 #include "shared-bindings/onewireio/OneWire.h"
 #include "shared-bindings/util.h"
 
@@ -17,7 +18,8 @@
 //|     def __init__(self, pin: microcontroller.Pin) -> None:
 //|         """Create a OneWire object associated with the given pin.
 //|
-//|         The object implements the lowest level timing-sensitive bits of the protocol.
+//|         The object implements the timing-sensitive parts of the protocol: bits,
+//|         bytes, selecting devices and searching the bus for them.
 //|
 //|         :param ~microcontroller.Pin pin: Pin connected to the OneWire bus
 //|
@@ -120,6 +122,145 @@ static mp_obj_t onewireio_onewire_obj_write_bit(mp_obj_t self_in, mp_obj_t bool_
 }
 MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_write_bit_obj, onewireio_onewire_obj_write_bit);
 
+//|     def readinto(self, buffer: WriteableBuffer) -> None:
+//|         """Read bytes into ``buffer``, least significant bit first."""
+//|         ...
+//|
+static mp_obj_t onewireio_onewire_obj_readinto(mp_obj_t self_in, mp_obj_t buffer_in) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    common_hal_onewireio_onewire_read(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_readinto_obj, onewireio_onewire_obj_readinto);
+
+//|     def write(self, buffer: ReadableBuffer) -> None:
+//|         """Write the bytes in ``buffer``, least significant bit first."""
+//|         ...
+//|
+static mp_obj_t onewireio_onewire_obj_write(mp_obj_t self_in, mp_obj_t buffer_in) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_READ);
+    common_hal_onewireio_onewire_write(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_write_obj, onewireio_onewire_obj_write);
+
+static const uint8_t *validate_rom(mp_obj_t rom_in, mp_buffer_info_t *bufinfo) {
+    mp_get_buffer_raise(rom_in, bufinfo, MP_BUFFER_READ);
+    mp_arg_validate_length(bufinfo->len, ONEWIRE_ROM_LENGTH, MP_QSTR_rom);
+    return bufinfo->buf;
+}
+
+//|     def select(self, rom: Optional[ReadableBuffer] = None) -> bool:
+//|         """Reset the bus and address the device with the 8 byte ``rom``, or every
+//|         device when ``rom`` is None. A command written next goes to the selected
+//|         devices.
+//|
+//|         :returns: False when at least one device is present
+//|         :rtype: bool"""
+//|         ...
+//|
+static mp_obj_t onewireio_onewire_obj_select(size_t n_args, const mp_obj_t *args) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+
+    const uint8_t *rom = NULL;
+    mp_buffer_info_t bufinfo;
+    if (n_args > 1 && args[1] != mp_const_none) {
+        rom = validate_rom(args[1], &bufinfo);
+    }
+    return mp_obj_new_bool(common_hal_onewireio_onewire_select(self, rom));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(onewireio_onewire_select_obj, 1, 2, onewireio_onewire_obj_select);
+
+//|     def search(self, *, alarm: bool = False) -> List[bytes]:
+//|         """Find the ROM of every device on the bus.
+//|
+//|         :param bool alarm: Only find devices with their alarm set
+//|         :returns: The 8 byte ROM of each device found. ROMs that fail their CRC are left out.
+//|         :rtype: List[bytes]
+//|
+//|         Read every DS18B20 on the bus at once::
+//|
+//|           import time
+//|
+//|           roms = [rom for rom in onewire.search() if rom[0] == 0x28]
+//|           onewire.select()
+//|           onewire.write(b"\x44")  # Convert T
+//|           time.sleep(0.75)
+//|           for scratchpad in onewire.read_each(roms, 0xBE, 9):
+//|               if scratchpad is not None:
+//|                   print(int.from_bytes(scratchpad[0:2], "little", True) / 16)"""
+//|         ...
+//|
+static mp_obj_t onewireio_onewire_obj_search(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_alarm };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_alarm, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    check_for_deinit(self);
+
+    uint8_t command = args[ARG_alarm].u_bool ? ONEWIRE_ALARM_SEARCH : ONEWIRE_SEARCH_ROM;
+    uint8_t rom[ONEWIRE_ROM_LENGTH] = { 0 };
+    int last_discrepancy = ONEWIRE_ROM_LENGTH * 8;
+    mp_obj_t roms = mp_obj_new_list(0, NULL);
+    while (common_hal_onewireio_onewire_search_next(self, command, rom, &last_discrepancy)) {
+        if (common_hal_onewireio_crc8(rom, ONEWIRE_ROM_LENGTH) == 0) {
+            mp_obj_list_append(roms, mp_obj_new_bytes(rom, ONEWIRE_ROM_LENGTH));
+        }
+    }
+    return roms;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(onewireio_onewire_search_obj, 1, onewireio_onewire_obj_search);
+
+//|     def read_each(self, roms: Sequence[ReadableBuffer], command: int, length: int) -> List[Optional[bytes]]:
+//|         """Select each device in ``roms`` in turn, write ``command`` to it and read
+//|         ``length`` bytes back. The last byte read must be the CRC of the others.
+//|
+//|         :returns: The bytes read from each device, or None for a device that didn't
+//|           answer or whose bytes fail their CRC
+//|         :rtype: List[Optional[bytes]]"""
+//|         ...
+//|
+static mp_obj_t onewireio_onewire_obj_read_each(size_t n_args, const mp_obj_t *args) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+    uint8_t command = mp_arg_validate_int_range(mp_obj_get_int(args[2]), 0, 255, MP_QSTR_command);
+    size_t length = mp_arg_validate_int_range(mp_obj_get_int(args[3]), 1, 255, MP_QSTR_length);
+
+    size_t count;
+    mp_obj_t *items;
+    mp_obj_get_array(args[1], &count, &items);
+    mp_obj_t results = mp_obj_new_list(count, NULL);
+    uint8_t *data = m_new(uint8_t, length);
+    for (size_t i = 0; i < count; i++) {
+        mp_buffer_info_t bufinfo;
+        const uint8_t *rom = validate_rom(items[i], &bufinfo);
+        mp_obj_t result = mp_const_none;
+        if (!common_hal_onewireio_onewire_select(self, rom)) {
+            common_hal_onewireio_onewire_write(self, &command, 1);
+            common_hal_onewireio_onewire_read(self, data, length);
+            if (common_hal_onewireio_crc8(data, length) == 0) {
+                result = mp_obj_new_bytes(data, length);
+            }
+        }
+        mp_obj_list_store(results, MP_OBJ_NEW_SMALL_INT(i), result);
+    }
+    m_del(uint8_t, data, length);
+    return results;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(onewireio_onewire_read_each_obj, 4, 4, onewireio_onewire_obj_read_each);
+
 static const mp_rom_map_elem_t onewireio_onewire_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&onewireio_onewire_deinit_obj) },
@@ -128,6 +269,11 @@ static const mp_rom_map_elem_t onewireio_onewire_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&onewireio_onewire_reset_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_bit), MP_ROM_PTR(&onewireio_onewire_read_bit_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_bit), MP_ROM_PTR(&onewireio_onewire_write_bit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&onewireio_onewire_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&onewireio_onewire_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_select), MP_ROM_PTR(&onewireio_onewire_select_obj) },
+    { MP_ROM_QSTR(MP_QSTR_search), MP_ROM_PTR(&onewireio_onewire_search_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_each), MP_ROM_PTR(&onewireio_onewire_read_each_obj) },
 };
 static MP_DEFINE_CONST_DICT(onewireio_onewire_locals_dict, onewireio_onewire_locals_dict_table);
 
@@ -18,3 +18,13 @@ extern bool common_hal_onewireio_onewire_deinited(onewireio_onewire_obj_t *self)
 extern bool common_hal_onewireio_onewire_reset(onewireio_onewire_obj_t *self);
 extern bool common_hal_onewireio_onewire_read_bit(onewireio_onewire_obj_t *self);
 extern void common_hal_onewireio_onewire_write_bit(onewireio_onewire_obj_t *self, bool bit);
+
+// Bytes are sent and received least significant bit first.
+extern void common_hal_onewireio_onewire_read(onewireio_onewire_obj_t *self, uint8_t *buf, size_t len);
+extern void common_hal_onewireio_onewire_write(onewireio_onewire_obj_t *self, const uint8_t *buf, size_t len);
+// Resets the bus and addresses the device with the given ROM, or every device
+// when rom is NULL. Returns true when no device is present, like reset.
+extern bool common_hal_onewireio_onewire_select(onewireio_onewire_obj_t *self, const uint8_t *rom);
+// Finds the next device's ROM. Returns false when there are no more.
+extern bool common_hal_onewireio_onewire_search_next(onewireio_onewire_obj_t *self, uint8_t command,
+    uint8_t rom[ONEWIRE_ROM_LENGTH], int *last_discrepancy);
@@ -18,10 +18,24 @@
 //| """Low-level bit primitives for Maxim (formerly Dallas Semi) one-wire protocol.
 //|
 //|    Protocol definition is here: https://www.analog.com/en/technical-articles/1wire-communication-through-software.html"""
+//|
+
+//| def crc8(data: ReadableBuffer) -> int:
+//|     """Return the one-wire CRC-8 of ``data``. It is 0 when the last byte of
+//|     ``data`` is the CRC of the rest, as it is for ROMs and DS18B20 scratchpads."""
+//|     ...
+//|
+static mp_obj_t onewireio_crc8(mp_obj_t data_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_onewireio_crc8(bufinfo.buf, bufinfo.len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(onewireio_crc8_obj, onewireio_crc8);
 
 static const mp_rom_map_elem_t onewireio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_onewireio) },
     { MP_ROM_QSTR(MP_QSTR_OneWire),   MP_ROM_PTR(&onewireio_onewire_type) },
+    { MP_ROM_QSTR(MP_QSTR_crc8),   MP_ROM_PTR(&onewireio_crc8_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(onewireio_module_globals, onewireio_module_globals_table);
@@ -5,3 +5,9 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A CRC of the data followed by its own CRC byte is 0.
+uint8_t common_hal_onewireio_crc8(const uint8_t *data, size_t len);
@@ -16,6 +16,7 @@
 #include "py/objstr.h"
 #include "py/runtime.h"
 #include "shared-bindings/os/__init__.h"
+#include "supervisor/shared/progress.h"
 
 //| """functions that an OS normally provides
 //|
@@ -121,6 +122,32 @@ static mp_obj_t os_listdir(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_listdir_obj, 0, 1, os_listdir);
 
+//| def ilistdir_stat(dir: str = ".") -> Iterator[Tuple[str, int, int, int]]:
+//|     """Iterate over the entries of a directory as ``(name, type, size, mtime)``
+//|     tuples. ``type`` is ``0x4000`` for a directory and ``0x8000`` for a file,
+//|     as in the ``st_mode`` of `stat`.
+//|
+//|     On FAT filesystems this reads the information while listing the
+//|     directory, so it is much faster than calling `stat` for every name
+//|     returned by `listdir`::
+//|
+//|         for name, type, size, mtime in os.ilistdir_stat("/sd/logs"):
+//|             if mtime < cutoff:
+//|                 os.remove("/sd/logs/" + name)
+//|     """
+//|     ...
+//|
+static mp_obj_t os_ilistdir_stat(size_t n_args, const mp_obj_t *args) {
+    const char *path;
+    if (n_args == 1) {
+        path = mp_obj_str_get_str(args[0]);
+    } else {
+        path = mp_obj_str_get_str(common_hal_os_getcwd());
+    }
+    return common_hal_os_ilistdir_stat(path);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_ilistdir_stat_obj, 0, 1, os_ilistdir_stat);
+
 //| def mkdir(path: str) -> None:
 //|     """Create a new directory."""
 //|     ...
@@ -227,10 +254,12 @@ MP_DEFINE_CONST_FUN_OBJ_1(os_statvfs_obj, os_statvfs);
 //|     ...
 //|
 static mp_obj_t os_sync(void) {
+    supervisor_long_operation_begin();
     for (mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table); vfs != NULL; vfs = vfs->next) {
         // this assumes that vfs->obj is fs_user_mount_t with block device functions
         disk_ioctl(MP_OBJ_TO_PTR(vfs->obj), CTRL_SYNC, NULL);
     }
+    supervisor_long_operation_end();
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_0(os_sync_obj, os_sync);
@@ -272,6 +301,7 @@ static const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_chdir), MP_ROM_PTR(&os_chdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_getcwd), MP_ROM_PTR(&os_getcwd_obj) },
     { MP_ROM_QSTR(MP_QSTR_getenv), MP_ROM_PTR(&os_getenv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ilistdir_stat), MP_ROM_PTR(&os_ilistdir_stat_obj) },
     { MP_ROM_QSTR(MP_QSTR_listdir), MP_ROM_PTR(&os_listdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_mkdir), MP_ROM_PTR(&os_mkdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&os_remove_obj) },
@@ -168,6 +168,33 @@ static mp_obj_t pulseio_pulsein_obj_popleft(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(pulseio_pulsein_popleft_obj, pulseio_pulsein_obj_popleft);
 
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Removes the oldest pulse durations, up to the length of ``buffer``, and
+//|         stores them in ``buffer``, without allocating.
+//|
+//|         :param array.array buffer: array of type 'H' to receive pulse durations in microseconds
+//|         :return: the number of durations stored
+//|         :rtype: int"""
+//|         ...
+static mp_obj_t pulseio_pulsein_obj_readinto(mp_obj_t self_in, mp_obj_t buffer_in) {
+    pulseio_pulsein_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'H') {
+        mp_raise_TypeError(MP_ERROR_TEXT("Array must contain halfwords (type 'H')"));
+    }
+    uint16_t *durations = bufinfo.buf;
+    size_t len = bufinfo.len / sizeof(uint16_t);
+    size_t count = 0;
+    while (count < len && common_hal_pulseio_pulsein_get_len(self) > 0) {
+        durations[count++] = common_hal_pulseio_pulsein_popleft(self);
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pulseio_pulsein_readinto_obj, pulseio_pulsein_obj_readinto);
+
 //|     maxlen: int
 //|     """The maximum length of the PulseIn. When len() is equal to maxlen,
 //|     it is unclear which pulses are active and which are idle."""
@@ -261,6 +288,7 @@ static const mp_rom_map_elem_t pulseio_pulsein_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_resume), MP_ROM_PTR(&pulseio_pulsein_resume_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&pulseio_pulsein_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&pulseio_pulsein_popleft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&pulseio_pulsein_readinto_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_maxlen), MP_ROM_PTR(&pulseio_pulsein_maxlen_obj) },
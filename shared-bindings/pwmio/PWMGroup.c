@@ -0,0 +1,282 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/binary.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_PWMIO_PWMGROUP
+
+#include "shared-bindings/pwmio/PWMGroup.h"
+#include "shared-bindings/pwmio/PWMOut.h"
+
+//| class PWMGroup:
+//|     """Several PWM outputs that share one timebase
+//|
+//|     All the outputs run at the same frequency with their periods locked
+//|     together, and new duty cycles for every output take effect at the same
+//|     period boundary. This is what a motor driver needs to update all of its
+//|     phases at once.
+//|
+//|     Each pin must be on its own PWM channel, and the group takes over the
+//|     whole timer behind each of its pins."""
+//|
+//|     def __init__(
+//|         self,
+//|         pins: Sequence[microcontroller.Pin],
+//|         *,
+//|         frequency: int = 500,
+//|         phases: Optional[Sequence[int]] = None,
+//|         phase_correct: bool = False,
+//|         dead_time: int = 0,
+//|     ) -> None:
+//|         """Create a group of PWM outputs, all with a duty cycle of 0.
+//|
+//|         :param Sequence[~microcontroller.Pin] pins: The pins to output to. With
+//|           ``dead_time``, pairs of high side and low side pins, each pair on the
+//|           two outputs of one timer
+//|         :param int frequency: The target frequency in Hertz. The frequency
+//|           actually used is available from ``frequency``
+//|         :param Sequence[int] phases: The start of each channel's period, as a
+//|           16 bit fraction of the period. Channels on the same timer must have
+//|           the same phase. Not available with ``phase_correct``
+//|         :param bool phase_correct: Center the pulses within each period, as
+//|           motor drivers usually want. This halves the resolution
+//|         :param int dead_time: The time in nanoseconds that both pins of a
+//|           complementary pair are off at each switch. A nonzero dead time
+//|           implies ``phase_correct``
+//|
+//|         Three phase driver with 500ns dead time::
+//|
+//|           import board
+//|           import pwmio
+//|
+//|           motor = pwmio.PWMGroup(
+//|               (board.GP0, board.GP1, board.GP2, board.GP3, board.GP4, board.GP5),
+//|               frequency=20000, dead_time=500)
+//|           motor.duty_cycles = (0x4000, 0x8000, 0xc000)"""
+//|         ...
+//|
+static mp_obj_t pwmio_pwmgroup_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_pins, ARG_frequency, ARG_phases, ARG_phase_correct, ARG_dead_time };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pins, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_frequency, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 500} },
+        { MP_QSTR_phases, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_phase_correct, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_dead_time, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    validate_no_duplicate_pins(args[ARG_pins].u_obj, MP_QSTR_pins);
+    const mcu_pin_obj_t *pins[PWMIO_PWMGROUP_MAX_CHANNELS];
+    uint8_t num_pins;
+    validate_list_is_free_pins(MP_QSTR_pins, pins, PWMIO_PWMGROUP_MAX_CHANNELS, args[ARG_pins].u_obj, &num_pins);
+    mp_arg_validate_length_min(num_pins, 1, MP_QSTR_pins);
+
+    uint32_t frequency = mp_arg_validate_int_min(args[ARG_frequency].u_int, 1, MP_QSTR_frequency);
+    uint32_t dead_time = mp_arg_validate_int_range(args[ARG_dead_time].u_int, 0, 1000000, MP_QSTR_dead_time);
+    bool phase_correct = args[ARG_phase_correct].u_bool || dead_time > 0;
+    size_t channel_count = num_pins;
+    if (dead_time > 0) {
+        if (num_pins % 2 != 0) {
+            mp_arg_error_invalid(MP_QSTR_pins);
+        }
+        channel_count = num_pins / 2;
+    }
+
+    uint16_t phases[PWMIO_PWMGROUP_MAX_CHANNELS];
+    uint16_t *phases_arg = NULL;
+    if (args[ARG_phases].u_obj != mp_const_none) {
+        if (phase_correct) {
+            mp_arg_error_invalid(MP_QSTR_phases);
+        }
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_phases].u_obj, &len, &items);
+        mp_arg_validate_length(len, channel_count, MP_QSTR_phases);
+        for (size_t i = 0; i < len; i++) {
+            phases[i] = mp_arg_validate_int_range(mp_obj_get_int(items[i]), 0, 0xffff, MP_QSTR_phases);
+        }
+        phases_arg = phases;
+    }
+
+    pwmio_pwmgroup_obj_t *self = mp_obj_malloc_with_finaliser(pwmio_pwmgroup_obj_t, &pwmio_pwmgroup_type);
+    common_hal_pwmio_pwmgroup_construct(self, pins, num_pins, frequency, phases_arg, phase_correct, dead_time);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Stop the outputs and release the pins and timers for other use."""
+//|         ...
+//|
+static mp_obj_t pwmio_pwmgroup_deinit(mp_obj_t self_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_pwmio_pwmgroup_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(pwmio_pwmgroup_deinit_obj, pwmio_pwmgroup_deinit);
+
+static void check_for_deinit(pwmio_pwmgroup_obj_t *self) {
+    if (common_hal_pwmio_pwmgroup_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> PWMGroup:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t pwmio_pwmgroup___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_pwmio_pwmgroup_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(pwmio_pwmgroup___exit___obj, 4, 4, pwmio_pwmgroup___exit__);
+
+//|     frequency: int
+//|     """The frequency of all the outputs in Hertz. (read-only)"""
+static mp_obj_t pwmio_pwmgroup_get_frequency(mp_obj_t self_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_pwmio_pwmgroup_get_frequency(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(pwmio_pwmgroup_get_frequency_obj, pwmio_pwmgroup_get_frequency);
+
+MP_PROPERTY_GETTER(pwmio_pwmgroup_frequency_obj,
+    (mp_obj_t)&pwmio_pwmgroup_get_frequency_obj);
+
+//|     duty_cycles: Tuple[int, ...]
+//|     """The 16 bit duty cycle of each channel, as for `PWMOut.duty_cycle`.
+//|     A complementary pair is one channel, whose duty cycle is that of its
+//|     high side pin. Setting this stops any `play` in progress, and all the
+//|     new duty cycles start with the same period."""
+static mp_obj_t pwmio_pwmgroup_get_duty_cycles(mp_obj_t self_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    size_t channel_count = common_hal_pwmio_pwmgroup_get_channel_count(self);
+    mp_obj_t items[PWMIO_PWMGROUP_MAX_CHANNELS];
+    for (size_t i = 0; i < channel_count; i++) {
+        items[i] = MP_OBJ_NEW_SMALL_INT(common_hal_pwmio_pwmgroup_get_duty_cycle(self, i));
+    }
+    return mp_obj_new_tuple(channel_count, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(pwmio_pwmgroup_get_duty_cycles_obj, pwmio_pwmgroup_get_duty_cycles);
+
+static mp_obj_t pwmio_pwmgroup_set_duty_cycles(mp_obj_t self_in, mp_obj_t duty_cycles_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(duty_cycles_in, &len, &items);
+    mp_arg_validate_length(len, common_hal_pwmio_pwmgroup_get_channel_count(self), MP_QSTR_duty_cycles);
+    uint16_t duty_cycles[PWMIO_PWMGROUP_MAX_CHANNELS];
+    for (size_t i = 0; i < len; i++) {
+        duty_cycles[i] = mp_arg_validate_int_range(mp_obj_get_int(items[i]), 0, 0xffff, MP_QSTR_duty_cycle);
+    }
+    common_hal_pwmio_pwmgroup_set_duty_cycles(self, duty_cycles);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(pwmio_pwmgroup_set_duty_cycles_obj, pwmio_pwmgroup_set_duty_cycles);
+
+MP_PROPERTY_GETSET(pwmio_pwmgroup_duty_cycles_obj,
+    (mp_obj_t)&pwmio_pwmgroup_get_duty_cycles_obj,
+    (mp_obj_t)&pwmio_pwmgroup_set_duty_cycles_obj);
+
+//|     def play(self, frames: ReadableBuffer) -> None:
+//|         """Output a new set of duty cycles every period, in the background.
+//|
+//|         The buffer holds one duty cycle per channel for each period, in channel
+//|         order. Once the frames are used up, the outputs stay at the last one.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer frames: an ``array.array``
+//|           of 16 bit unsigned duty cycles, a multiple of the channel count long"""
+//|         ...
+//|
+static mp_obj_t pwmio_pwmgroup_play(mp_obj_t self_in, mp_obj_t frames_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(frames_in, &bufinfo, MP_BUFFER_READ);
+    if (mp_binary_get_size('@', bufinfo.typecode, NULL) != 2) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad typecode"));
+    }
+    size_t frame_size = common_hal_pwmio_pwmgroup_get_channel_count(self) * sizeof(uint16_t);
+    if (bufinfo.len % frame_size != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), (int)frame_size);
+    }
+    size_t frame_count = bufinfo.len / frame_size;
+    mp_arg_validate_length_min(frame_count, 1, MP_QSTR_frames);
+    common_hal_pwmio_pwmgroup_play(self, bufinfo.buf, frame_count);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(pwmio_pwmgroup_play_obj, pwmio_pwmgroup_play);
+
+//|     def stop(self) -> None:
+//|         """Stop any `play` in progress. The outputs keep the duty cycles of
+//|         the frame being output."""
+//|         ...
+//|
+static mp_obj_t pwmio_pwmgroup_stop(mp_obj_t self_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_pwmio_pwmgroup_stop(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(pwmio_pwmgroup_stop_obj, pwmio_pwmgroup_stop);
+
+//|     playing: bool
+//|     """True while `play` is still outputting frames. (read-only)"""
+//|
+static mp_obj_t pwmio_pwmgroup_get_playing(mp_obj_t self_in) {
+    pwmio_pwmgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_pwmio_pwmgroup_get_playing(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(pwmio_pwmgroup_get_playing_obj, pwmio_pwmgroup_get_playing);
+
+MP_PROPERTY_GETTER(pwmio_pwmgroup_playing_obj,
+    (mp_obj_t)&pwmio_pwmgroup_get_playing_obj);
+
+static const mp_rom_map_elem_t pwmio_pwmgroup_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&pwmio_pwmgroup_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&pwmio_pwmgroup_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&pwmio_pwmgroup___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&pwmio_pwmgroup_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&pwmio_pwmgroup_stop_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_duty_cycles), MP_ROM_PTR(&pwmio_pwmgroup_duty_cycles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&pwmio_pwmgroup_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&pwmio_pwmgroup_playing_obj) },
+};
+static MP_DEFINE_CONST_DICT(pwmio_pwmgroup_locals_dict, pwmio_pwmgroup_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    pwmio_pwmgroup_type,
+    MP_QSTR_PWMGroup,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, pwmio_pwmgroup_make_new,
+    locals_dict, &pwmio_pwmgroup_locals_dict
+    );
+
+#endif // CIRCUITPY_PWMIO_PWMGROUP
@@ -0,0 +1,27 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/microcontroller/Pin.h"
+#include "common-hal/pwmio/PWMGroup.h"
+
+extern const mp_obj_type_t pwmio_pwmgroup_type;
+
+// phases may be NULL. A nonzero dead_time_ns pairs up the pins.
+void common_hal_pwmio_pwmgroup_construct(pwmio_pwmgroup_obj_t *self,
+    const mcu_pin_obj_t **pins, size_t num_pins, uint32_t frequency,
+    const uint16_t *phases, bool phase_correct, uint32_t dead_time_ns);
+void common_hal_pwmio_pwmgroup_deinit(pwmio_pwmgroup_obj_t *self);
+bool common_hal_pwmio_pwmgroup_deinited(pwmio_pwmgroup_obj_t *self);
+size_t common_hal_pwmio_pwmgroup_get_channel_count(pwmio_pwmgroup_obj_t *self);
+uint32_t common_hal_pwmio_pwmgroup_get_frequency(pwmio_pwmgroup_obj_t *self);
+uint16_t common_hal_pwmio_pwmgroup_get_duty_cycle(pwmio_pwmgroup_obj_t *self, size_t channel);
+void common_hal_pwmio_pwmgroup_set_duty_cycles(pwmio_pwmgroup_obj_t *self, const uint16_t *duty_cycles);
+// frames holds frame_count groups of one duty cycle per channel.
+void common_hal_pwmio_pwmgroup_play(pwmio_pwmgroup_obj_t *self, const uint16_t *frames, size_t frame_count);
+void common_hal_pwmio_pwmgroup_stop(pwmio_pwmgroup_obj_t *self);
+bool common_hal_pwmio_pwmgroup_get_playing(pwmio_pwmgroup_obj_t *self);
@@ -12,6 +12,9 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/pwmio/__init__.h"
 #include "shared-bindings/pwmio/PWMOut.h"
+#if CIRCUITPY_PWMIO_PWMGROUP
+#include "shared-bindings/pwmio/PWMGroup.h"
+#endif
 
 //| """Support for PWM based protocols
 //|
@@ -45,6 +48,9 @@
 static const mp_rom_map_elem_t pwmio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_pwmio) },
     { MP_ROM_QSTR(MP_QSTR_PWMOut), MP_ROM_PTR(&pwmio_pwmout_type) },
+    #if CIRCUITPY_PWMIO_PWMGROUP
+    { MP_ROM_QSTR(MP_QSTR_PWMGroup), MP_ROM_PTR(&pwmio_pwmgroup_type) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(pwmio_module_globals, pwmio_module_globals_table);
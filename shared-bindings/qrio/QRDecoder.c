@@ -49,17 +49,48 @@ static void verify_buffer_size(qrio_qrdecoder_obj_t *self, mp_obj_t *buffer, siz
     mp_get_index(mp_obj_get_type(*buffer), len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
 }
 
+static void validate_region(qrio_qrdecoder_obj_t *self, mp_obj_t roi_in, mp_int_t scale, qrio_region_t *roi) {
+    int width = shared_module_qrio_qrdecoder_get_width(self);
+    int height = shared_module_qrio_qrdecoder_get_height(self);
+    if (roi_in == mp_const_none) {
+        *roi = (qrio_region_t) { 0, 0, width, height };
+    } else {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(roi_in, 4, &items);
+        roi->x = mp_arg_validate_int_range(mp_obj_get_int(items[0]), 0, width - 1, MP_QSTR_x);
+        roi->y = mp_arg_validate_int_range(mp_obj_get_int(items[1]), 0, height - 1, MP_QSTR_y);
+        roi->width = mp_arg_validate_int_range(mp_obj_get_int(items[2]), 1, width - roi->x, MP_QSTR_width);
+        roi->height = mp_arg_validate_int_range(mp_obj_get_int(items[3]), 1, height - roi->y, MP_QSTR_height);
+    }
+    mp_arg_validate_int_range(scale, 1, MIN(roi->width, roi->height), MP_QSTR_scale);
+}
+
 //|     def decode(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         roi: Optional[Tuple[int, int, int, int]] = None,
+//|         scale: int = 1,
 //|     ) -> List[QRInfo]:
-//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         :param roi: Only search this ``(x, y, width, height)`` part of the image. Decoding time grows with the area searched.
+//|         :param int scale: Search a copy of the image shrunk by this factor first, then decode each code
+//|             found at full resolution if it couldn't be read in the shrunk copy. Larger codes are found
+//|             much faster this way; codes smaller than about ``scale`` times the minimum quirc can find are missed.
+//|
+//|         The buffers for ``roi`` and ``scale`` searches are kept between calls, so decoding frames of one size
+//|         repeatedly doesn't allocate beyond the results."""
 static mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_roi, ARG_scale };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_roi, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -69,22 +100,35 @@ static mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, m
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
 
-    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy);
+    qrio_region_t roi;
+    validate_region(self, args[ARG_roi].u_obj, args[ARG_scale].u_int, &roi);
+
+    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy, &roi, args[ARG_scale].u_int);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 
 
 //|     def find(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         roi: Optional[Tuple[int, int, int, int]] = None,
+//|         scale: int = 1,
 //|     ) -> List[QRPosition]:
-//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         ``roi`` and ``scale`` are as for `decode`, except that no full resolution pass is made. Positions are
+//|         always in the coordinates of the whole image."""
 static mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_roi, ARG_scale };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_roi, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -94,7 +138,10 @@ static mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
 
-    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy);
+    qrio_region_t roi;
+    validate_region(self, args[ARG_roi].u_obj, args[ARG_scale].u_int, &roi);
+
+    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy, &roi, args[ARG_scale].u_int);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_find_obj, 1, qrio_qrdecoder_find);
 
@@ -53,6 +53,20 @@ static mp_obj_t random_getrandbits(mp_obj_t num_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(random_getrandbits_obj, random_getrandbits);
 
+//| def randbytes_into(buffer: WriteableBuffer) -> None:
+//|     """Fills ``buffer`` with random bytes. This is much faster than calling
+//|     `getrandbits` for each byte. Like the rest of this module, the bytes are
+//|     not suitable for keys or nonces; use `os.urandom` for those."""
+//|     ...
+//|
+static mp_obj_t random_randbytes_into(mp_obj_t buffer_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    shared_modules_random_randbytes(bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(random_randbytes_into_obj, random_randbytes_into);
+
 //| @overload
 //| def randrange(stop: int) -> int: ...
 //| @overload
@@ -154,6 +168,7 @@ static const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_random) },
     { MP_ROM_QSTR(MP_QSTR_seed), MP_ROM_PTR(&random_seed_obj) },
     { MP_ROM_QSTR(MP_QSTR_getrandbits), MP_ROM_PTR(&random_getrandbits_obj) },
+    { MP_ROM_QSTR(MP_QSTR_randbytes_into), MP_ROM_PTR(&random_randbytes_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_randrange), MP_ROM_PTR(&random_randrange_obj) },
     { MP_ROM_QSTR(MP_QSTR_randint), MP_ROM_PTR(&random_randint_obj) },
     { MP_ROM_QSTR(MP_QSTR_choice), MP_ROM_PTR(&random_choice_obj) },
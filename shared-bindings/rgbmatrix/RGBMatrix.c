@@ -328,7 +328,10 @@ MP_PROPERTY_GETSET(rgbmatrix_rgbmatrix_brightness_obj,
 
 //|     def refresh(self) -> None:
 //|         """Transmits the color data in the buffer to the pixels so that
-//|         they are shown."""
+//|         they are shown.
+//|
+//|         When double-buffered, this returns without waiting for the panel to
+//|         finish showing the previous frame. The new one appears after that."""
 //|         ...
 static mp_obj_t rgbmatrix_rgbmatrix_refresh(mp_obj_t self_in) {
     rgbmatrix_rgbmatrix_obj_t *self = (rgbmatrix_rgbmatrix_obj_t *)self_in;
@@ -378,8 +381,15 @@ static void rgbmatrix_rgbmatrix_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *
 // These version exists so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 static void rgbmatrix_rgbmatrix_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
-    common_hal_rgbmatrix_rgbmatrix_refresh(self_in);
+    // Protomatter converts whole frames, so all that can be saved is a refresh
+    // where no row changed.
+    int height = common_hal_rgbmatrix_rgbmatrix_get_height(self_in);
+    for (int i = 0; i < (height + 7) / 8; i++) {
+        if (dirty_row_bitmap[i] != 0) {
+            common_hal_rgbmatrix_rgbmatrix_refresh(self_in);
+            return;
+        }
+    }
 }
 
 static void rgbmatrix_rgbmatrix_deinit_proto(mp_obj_t self_in) {
@@ -148,6 +148,51 @@ MP_PROPERTY_GETSET(rotaryio_incrementalencoder_position_obj,
     (mp_obj_t)&rotaryio_incrementalencoder_get_position_obj,
     (mp_obj_t)&rotaryio_incrementalencoder_set_position_obj);
 
+#if CIRCUITPY_ROTARYIO_SOFTENCODER
+//|     velocity: float
+//|     """The speed in `position` units per second, negative when the position
+//|     is decreasing. It is measured over the edges in the last completed
+//|     `velocity_window`, and falls towards zero once the edges stop. (read-only)"""
+//|
+static mp_obj_t rotaryio_incrementalencoder_obj_get_velocity(mp_obj_t self_in) {
+    rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    return mp_obj_new_float(common_hal_rotaryio_incrementalencoder_get_velocity(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rotaryio_incrementalencoder_get_velocity_obj, rotaryio_incrementalencoder_obj_get_velocity);
+
+MP_PROPERTY_GETTER(rotaryio_incrementalencoder_velocity_obj,
+    (mp_obj_t)&rotaryio_incrementalencoder_get_velocity_obj);
+
+//|     velocity_window: float
+//|     """The shortest time in seconds that `velocity` is measured over.
+//|     Longer windows smooth out timing jitter, shorter ones follow changes in
+//|     speed sooner. Defaults to 0.005."""
+//|
+static mp_obj_t rotaryio_incrementalencoder_obj_get_velocity_window(mp_obj_t self_in) {
+    rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    return mp_obj_new_float(common_hal_rotaryio_incrementalencoder_get_velocity_window(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rotaryio_incrementalencoder_get_velocity_window_obj, rotaryio_incrementalencoder_obj_get_velocity_window);
+
+static mp_obj_t rotaryio_incrementalencoder_obj_set_velocity_window(mp_obj_t self_in, mp_obj_t window_in) {
+    rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_float_t window = mp_arg_validate_obj_float_range(window_in, 0, 4, MP_QSTR_velocity_window);
+    common_hal_rotaryio_incrementalencoder_set_velocity_window(self, window);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(rotaryio_incrementalencoder_set_velocity_window_obj, rotaryio_incrementalencoder_obj_set_velocity_window);
+
+MP_PROPERTY_GETSET(rotaryio_incrementalencoder_velocity_window_obj,
+    (mp_obj_t)&rotaryio_incrementalencoder_get_velocity_window_obj,
+    (mp_obj_t)&rotaryio_incrementalencoder_set_velocity_window_obj);
+#endif
+
 static const mp_rom_map_elem_t rotaryio_incrementalencoder_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&rotaryio_incrementalencoder_deinit_obj) },
@@ -156,6 +201,10 @@ static const mp_rom_map_elem_t rotaryio_incrementalencoder_locals_dict_table[] =
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&rotaryio_incrementalencoder___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&rotaryio_incrementalencoder_position_obj) },
     { MP_ROM_QSTR(MP_QSTR_divisor), MP_ROM_PTR(&rotaryio_incrementalencoder_divisor_obj) },
+    #if CIRCUITPY_ROTARYIO_SOFTENCODER
+    { MP_ROM_QSTR(MP_QSTR_velocity), MP_ROM_PTR(&rotaryio_incrementalencoder_velocity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_velocity_window), MP_ROM_PTR(&rotaryio_incrementalencoder_velocity_window_obj) },
+    #endif
 };
 static MP_DEFINE_CONST_DICT(rotaryio_incrementalencoder_locals_dict, rotaryio_incrementalencoder_locals_dict_table);
 
@@ -21,3 +21,9 @@ extern void common_hal_rotaryio_incrementalencoder_set_position(rotaryio_increme
 extern mp_int_t common_hal_rotaryio_incrementalencoder_get_divisor(rotaryio_incrementalencoder_obj_t *self);
 extern void common_hal_rotaryio_incrementalencoder_set_divisor(rotaryio_incrementalencoder_obj_t *self,
     mp_int_t new_divisor);
+#if CIRCUITPY_ROTARYIO_SOFTENCODER
+extern mp_float_t common_hal_rotaryio_incrementalencoder_get_velocity(rotaryio_incrementalencoder_obj_t *self);
+extern mp_float_t common_hal_rotaryio_incrementalencoder_get_velocity_window(rotaryio_incrementalencoder_obj_t *self);
+extern void common_hal_rotaryio_incrementalencoder_set_velocity_window(rotaryio_incrementalencoder_obj_t *self,
+    mp_float_t window);
+#endif
@@ -15,6 +15,7 @@
 
 #include "shared/runtime/buffer_helper.h"
 #include "shared/runtime/context_manager_helpers.h"
+#include "extmod/vfs.h"
 #include "py/mperrno.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
@@ -179,6 +180,42 @@ static mp_obj_t _sdioio_sdcard_writeblocks(mp_obj_t self_in, mp_obj_t start_bloc
 
 MP_DEFINE_CONST_FUN_OBJ_3(sdioio_sdcard_writeblocks_obj, _sdioio_sdcard_writeblocks);
 
+// Native block device entry points, so VfsFat can call the card without going
+// through the Python methods above. Errors are returned as positive errno values.
+mp_uint_t sdioio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
+    sdioio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo = { .buf = buf, .len = nblocks * 512 };
+    int result = common_hal_sdioio_sdcard_readblocks(self, start_block, &bufinfo);
+    return result < 0 ? -result : 0;
+}
+
+mp_uint_t sdioio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
+    sdioio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo = { .buf = buf, .len = nblocks * 512 };
+    int result = common_hal_sdioio_sdcard_writeblocks(self, start_block, &bufinfo);
+    return result < 0 ? -result : 0;
+}
+
+bool sdioio_sdcard_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *out_value) {
+    sdioio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    *out_value = 0;
+    switch (cmd) {
+        case MP_BLOCKDEV_IOCTL_DEINIT:
+        case MP_BLOCKDEV_IOCTL_SYNC:
+            // Writes complete before writeblocks returns, so there is nothing to flush.
+            break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            *out_value = common_hal_sdioio_sdcard_get_count(self);
+            break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            *out_value = 512;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
 //|     frequency: int
 //|     """The actual SDIO bus frequency. This may not match the frequency
 //|     requested due to internal limitations."""
@@ -39,5 +39,10 @@ uint32_t common_hal_sdioio_sdcard_get_count(sdioio_sdcard_obj_t *self);
 int common_hal_sdioio_sdcard_readblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo);
 int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo);
 
+// Used by native vfs blockdev.
+mp_uint_t sdioio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks);
+mp_uint_t sdioio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks);
+bool sdioio_sdcard_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *out_value);
+
 // This is used by the supervisor to claim SDIO devices indefinitely.
 extern void common_hal_sdioio_sdcard_never_reset(sdioio_sdcard_obj_t *self);
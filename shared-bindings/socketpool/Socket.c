@@ -46,11 +46,21 @@
 //|         ...
 static mp_obj_t socketpool_socket___exit__(size_t n_args, const mp_obj_t *args) {
     (void)n_args;
+    common_hal_socketpool_socket_release_buffer(args[0]);
     common_hal_socketpool_socket_close(args[0]);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket___exit___obj, 4, 4, socketpool_socket___exit__);
 
+// The finaliser only runs once any view lent by recv_buffer() is garbage too,
+// so unlike close() it leaves the view alone.
+static mp_obj_t socketpool_socket___del__(mp_obj_t self_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_socketpool_socket_close(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(socketpool_socket___del___obj, socketpool_socket___del__);
+
 //|     def accept(self) -> Tuple[Socket, Tuple[str, int]]:
 //|         """Accept a connection on a listening socket of type SOCK_STREAM,
 //|         creating a new socket of type SOCK_STREAM.
@@ -96,6 +106,7 @@ static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_bind_obj, socketpool_socket_b
 //|         """Closes this Socket and makes its resources available to its SocketPool."""
 static mp_obj_t _socketpool_socket_close(mp_obj_t self_in) {
     socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_socketpool_socket_release_buffer(self);
     common_hal_socketpool_socket_close(self);
     return mp_const_none;
 }
@@ -161,6 +172,43 @@ static mp_obj_t socketpool_socket_recvfrom_into(mp_obj_t self_in, mp_obj_t data_
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_obj, socketpool_socket_recvfrom_into);
 
+//|     def recvfrom_into_many(
+//|         self, buffers: Sequence[WriteableBuffer]
+//|     ) -> List[Tuple[int, Tuple[str, int]]]:
+//|         """Receives a datagram into each of ``buffers`` in turn.
+//|
+//|         Waits for the first datagram as `recvfrom_into` does. Further
+//|         datagrams are received only while they are already waiting, until
+//|         every buffer has been used.
+//|
+//|         Returns a list with a tuple for each buffer filled, in order, holding
+//|         * the number of bytes received into the buffer
+//|         * a remote_address, which is a tuple of ip address and port number
+//|
+//|         :param buffers: buffers to read into"""
+//|         ...
+static mp_obj_t socketpool_socket_recvfrom_into_many(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t count;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &count, &buffers);
+
+    mp_obj_list_t *result = MP_OBJ_TO_PTR(mp_obj_new_list(0, NULL));
+    for (size_t i = 0; i < count; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_WRITE);
+        if (i > 0 && !common_hal_socketpool_readable(self)) {
+            break;
+        }
+        mp_obj_t tuple_contents[2];
+        tuple_contents[0] = mp_obj_new_int_from_uint(common_hal_socketpool_socket_recvfrom_into(self,
+            (byte *)bufinfo.buf, bufinfo.len, &tuple_contents[1]));
+        mp_obj_list_append(MP_OBJ_FROM_PTR(result), mp_obj_new_tuple(2, tuple_contents));
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_many_obj, socketpool_socket_recvfrom_into_many);
+
 //|     def recv_into(self, buffer: WriteableBuffer, bufsize: int) -> int:
 //|         """Reads some bytes from the connected remote address, writing
 //|         into the provided buffer. If bufsize <= len(buffer) is given,
@@ -206,6 +254,49 @@ static mp_obj_t _socketpool_socket_recv_into(size_t n_args, const mp_obj_t *args
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket_recv_into_obj, 2, 3, _socketpool_socket_recv_into);
 
+//|     def recv_buffer(self) -> memoryview:
+//|         """Receives the next block of data without copying it.
+//|
+//|         Returns a read-only `memoryview` of the network stack's own receive
+//|         buffer. For SOCK_STREAM it holds the next contiguous run of received
+//|         bytes, and for SOCK_DGRAM the next whole datagram. It is empty once
+//|         the peer has closed the connection.
+//|
+//|         `release_buffer`, the next `recv_buffer` and `close` empty the
+//|         memoryview, so it can't read memory the network stack has reused.
+//|         Slices of it are not emptied, and must not be used after that.
+//|         Release it promptly, because the network stack can't reuse the
+//|         memory while it is held.
+//|
+//|         Not available on all ports."""
+//|         ...
+MP_WEAK mp_obj_t common_hal_socketpool_socket_recv_buffer(socketpool_socket_obj_t *self) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+MP_WEAK void common_hal_socketpool_socket_release_buffer(socketpool_socket_obj_t *self) {
+}
+
+static mp_obj_t _socketpool_socket_recv_buffer(mp_obj_t self_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    return common_hal_socketpool_socket_recv_buffer(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(socketpool_socket_recv_buffer_obj, _socketpool_socket_recv_buffer);
+
+//|     def release_buffer(self) -> None:
+//|         """Returns the data lent by `recv_buffer` to the network stack."""
+//|         ...
+static mp_obj_t _socketpool_socket_release_buffer(mp_obj_t self_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_socketpool_socket_release_buffer(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(socketpool_socket_release_buffer_obj, _socketpool_socket_release_buffer);
+
 //|     def send(self, bytes: ReadableBuffer) -> int:
 //|         """Send some bytes to the connected remote address.
 //|         Suits sockets of type SOCK_STREAM
@@ -301,6 +392,50 @@ static mp_obj_t socketpool_socket_sendto(mp_obj_t self_in, mp_obj_t data_in, mp_
 }
 static MP_DEFINE_CONST_FUN_OBJ_3(socketpool_socket_sendto_obj, socketpool_socket_sendto);
 
+//|     def sendto_many(self, buffers: Sequence[ReadableBuffer], address: Tuple[str, int]) -> int:
+//|         """Send each of ``buffers`` as a separate datagram to one address.
+//|         Suits sockets of type SOCK_DGRAM
+//|
+//|         The address is only looked up once, so this is faster than calling
+//|         `sendto` for each buffer.
+//|
+//|         :param buffers: the datagrams to send
+//|         :param ~tuple address: tuple of (remote_address, remote_port)
+//|         :return: the number of datagrams sent"""
+//|         ...
+static mp_obj_t socketpool_socket_sendto_many(mp_obj_t self_in, mp_obj_t buffers_in, mp_obj_t addr_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    size_t count;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &count, &buffers);
+
+    mp_obj_t *addr_items;
+    mp_obj_get_array_fixed_n(addr_in, 2, &addr_items);
+
+    size_t hostlen;
+    const char *host = mp_obj_str_get_data(addr_items[0], &hostlen);
+    mp_int_t port = mp_obj_get_int(addr_items[1]);
+    if (port < 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("port must be >= 0"));
+    }
+
+    size_t sent = common_hal_socketpool_socket_sendto_many(self, host, hostlen, (uint32_t)port, buffers, count);
+
+    return mp_obj_new_int_from_uint(sent);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(socketpool_socket_sendto_many_obj, socketpool_socket_sendto_many);
+
+MP_WEAK size_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *self,
+    const char *host, size_t hostlen, uint32_t port, const mp_obj_t *buffers, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_READ);
+        common_hal_socketpool_socket_sendto(self, host, hostlen, port, bufinfo.buf, bufinfo.len);
+    }
+    return count;
+}
+
 //|     def setblocking(self, flag: bool) -> Optional[int]:
 //|         """Set the blocking behaviour of this socket.
 //|
@@ -388,7 +523,7 @@ MP_PROPERTY_GETTER(socketpool_socket_type_obj,
 static const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&socketpool_socket___exit___obj) },
-    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&socketpool_socket_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&socketpool_socket___del___obj) },
 
 
     { MP_ROM_QSTR(MP_QSTR_accept), MP_ROM_PTR(&socketpool_socket_accept_obj) },
@@ -397,10 +532,14 @@ static const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&socketpool_socket_connect_obj) },
     { MP_ROM_QSTR(MP_QSTR_listen), MP_ROM_PTR(&socketpool_socket_listen_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&socketpool_socket_recvfrom_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvfrom_into_many), MP_ROM_PTR(&socketpool_socket_recvfrom_into_many_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv_buffer), MP_ROM_PTR(&socketpool_socket_recv_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&socketpool_socket_recv_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release_buffer), MP_ROM_PTR(&socketpool_socket_release_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socketpool_socket_sendall_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socketpool_socket_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socketpool_socket_sendto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendto_many), MP_ROM_PTR(&socketpool_socket_sendto_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
     { MP_ROM_QSTR(MP_QSTR_setsockopt), MP_ROM_PTR(&socketpool_socket_setsockopt_obj) },
     { MP_ROM_QSTR(MP_QSTR_settimeout), MP_ROM_PTR(&socketpool_socket_settimeout_obj) },
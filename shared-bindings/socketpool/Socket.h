@@ -22,9 +22,18 @@ bool common_hal_socketpool_socket_listen(socketpool_socket_obj_t *self, int back
 mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *self,
     uint8_t *buf, uint32_t len, mp_obj_t *peer_out);
 mp_uint_t common_hal_socketpool_socket_recv_into(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
+// Lends the next received data to the caller as a read-only memoryview, without
+// copying it, until release_buffer() or the next recv_buffer() empties the view.
+// The view is empty at the end of a stream.
+mp_obj_t common_hal_socketpool_socket_recv_buffer(socketpool_socket_obj_t *self);
+void common_hal_socketpool_socket_release_buffer(socketpool_socket_obj_t *self);
 mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
 mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len);
+// Sends each buffer as its own datagram, resolving the address only once.
+// Returns the number of datagrams sent.
+size_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *self,
+    const char *host, size_t hostlen, uint32_t port, const mp_obj_t *buffers, size_t count);
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms);
 int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen);
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self);
@@ -25,7 +25,7 @@
 static mp_obj_t ssl_sslcontext_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 0, 1, false);
 
-    ssl_sslcontext_obj_t *s = mp_obj_malloc(ssl_sslcontext_obj_t, &ssl_sslcontext_type);
+    ssl_sslcontext_obj_t *s = mp_obj_malloc_with_finaliser(ssl_sslcontext_obj_t, &ssl_sslcontext_type);
 
     common_hal_ssl_sslcontext_construct(s);
 
@@ -148,6 +148,31 @@ MP_PROPERTY_GETSET(ssl_sslcontext_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_get_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_set_check_hostname_obj);
 
+//|     reuse_connection_state: bool
+//|     """Keep the TLS state of a closed socket, including its record buffers,
+//|     and reuse it for the next socket wrapped by this context. This holds
+//|     on to around 20 kB between connections but stops each reconnect from
+//|     allocating, and so fragmenting, the heap again. Defaults to ``False``."""
+
+static mp_obj_t ssl_sslcontext_get_reuse_connection_state(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_bool(common_hal_ssl_sslcontext_get_reuse_connection_state(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext_get_reuse_connection_state_obj, ssl_sslcontext_get_reuse_connection_state);
+
+static mp_obj_t ssl_sslcontext_set_reuse_connection_state(mp_obj_t self_in, mp_obj_t value) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_ssl_sslcontext_set_reuse_connection_state(self, mp_obj_is_true(value));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(ssl_sslcontext_set_reuse_connection_state_obj, ssl_sslcontext_set_reuse_connection_state);
+
+MP_PROPERTY_GETSET(ssl_sslcontext_reuse_connection_state_obj,
+    (mp_obj_t)&ssl_sslcontext_get_reuse_connection_state_obj,
+    (mp_obj_t)&ssl_sslcontext_set_reuse_connection_state_obj);
+
 //|     def wrap_socket(
 //|         self,
 //|         sock: socketpool.Socket,
@@ -186,12 +211,21 @@ static mp_obj_t ssl_sslcontext_wrap_socket(size_t n_args, const mp_obj_t *pos_ar
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(ssl_sslcontext_wrap_socket_obj, 1, ssl_sslcontext_wrap_socket);
 
+static mp_obj_t ssl_sslcontext___del__(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_ssl_sslcontext_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext___del___obj, ssl_sslcontext___del__);
+
 static const mp_rom_map_elem_t ssl_sslcontext_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&ssl_sslcontext___del___obj) },
     { MP_ROM_QSTR(MP_QSTR_wrap_socket), MP_ROM_PTR(&ssl_sslcontext_wrap_socket_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_cert_chain), MP_ROM_PTR(&ssl_sslcontext_load_cert_chain_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_verify_locations), MP_ROM_PTR(&ssl_sslcontext_load_verify_locations_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_default_verify_paths), MP_ROM_PTR(&ssl_sslcontext_set_default_verify_paths_obj) },
     { MP_ROM_QSTR(MP_QSTR_check_hostname), MP_ROM_PTR(&ssl_sslcontext_check_hostname_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reuse_connection_state), MP_ROM_PTR(&ssl_sslcontext_reuse_connection_state_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(ssl_sslcontext_locals_dict, ssl_sslcontext_locals_dict_table);
@@ -17,6 +17,7 @@
 extern const mp_obj_type_t ssl_sslcontext_type;
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self);
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self);
 
 ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t *self,
     mp_obj_t socket, bool server_side, const char *server_hostname);
@@ -28,4 +29,6 @@ void common_hal_ssl_sslcontext_set_default_verify_paths(ssl_sslcontext_obj_t *se
 
 bool common_hal_ssl_sslcontext_get_check_hostname(ssl_sslcontext_obj_t *self);
 void common_hal_ssl_sslcontext_set_check_hostname(ssl_sslcontext_obj_t *self, bool value);
+bool common_hal_ssl_sslcontext_get_reuse_connection_state(ssl_sslcontext_obj_t *self);
+void common_hal_ssl_sslcontext_set_reuse_connection_state(ssl_sslcontext_obj_t *self, bool value);
 void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_buffer_info_t *cert_buf, mp_buffer_info_t *key_buf);
@@ -0,0 +1,229 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/KeyValueStore.h"
+#include "shared-bindings/storage/Partition.h"
+
+#if CIRCUITPY_STORAGE_KEYVALUESTORE
+
+//| class KeyValueStore:
+//|     """Persistent storage for small named values in a `Partition`
+//|
+//|     The store uses a ring of erase blocks in the partition. Each change is
+//|     appended to a log in the active block without erasing it. When the log
+//|     fills up, the live values are copied into the next block in the ring,
+//|     so the erases are spread evenly over the blocks. An index of the keys
+//|     is kept in RAM, so reading a value does not search the log.
+//|
+//|     Every change is atomic, even if power is lost while it is written.
+//|     Records carry a CRC, and all of the changes made by one `update` take
+//|     effect together or not at all. When the log is copied, the new block
+//|     only becomes active once all of its records are written, and the old
+//|     block is left untouched until then."""
+//|
+//|     def __init__(self, partition: Partition, start_block: int = 0, block_count: int = 2) -> None:
+//|         """Use ``block_count`` blocks of ``partition``, starting at block
+//|         ``start_block``, as a key/value store.
+//|
+//|         If the blocks do not already hold a store, the first one is erased
+//|         and an empty store is started. The other blocks are erased as the
+//|         store moves onto them. Only create one store at a time for a given
+//|         range of blocks.
+//|
+//|         The store can hold up to one block, less a 12 byte header. Each key
+//|         takes six bytes more than the length of its name and value. Using
+//|         more blocks does not make the store larger, but each block is erased
+//|         less often.
+//|
+//|         :param Partition partition: The partition to use
+//|         :param int start_block: The first block to use
+//|         :param int block_count: The number of blocks to use, at least 2
+//|
+//|         Count boots::
+//|
+//|           import storage
+//|
+//|           store = storage.KeyValueStore(storage.Partition())
+//|           boots = int.from_bytes(store.get("boots", b"\\x00"), "little") + 1
+//|           store["boots"] = boots.to_bytes(4, "little")"""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_partition, ARG_start_block, ARG_block_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_partition, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_start_block, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_block_count, MP_ARG_INT, {.u_int = 2} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    storage_partition_obj_t *partition = MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_partition].u_obj, &storage_partition_type, MP_QSTR_partition));
+    mp_int_t blocks = common_hal_storage_partition_get_size(partition) / common_hal_storage_partition_get_block_size(partition);
+    mp_int_t start_block = mp_arg_validate_int_range(args[ARG_start_block].u_int, 0, blocks - 2, MP_QSTR_start_block);
+    mp_int_t block_count = mp_arg_validate_int_range(args[ARG_block_count].u_int, 2, MIN(blocks - start_block, UINT16_MAX), MP_QSTR_block_count);
+
+    storage_keyvaluestore_obj_t *self = mp_obj_malloc(storage_keyvaluestore_obj_t, &storage_keyvaluestore_type);
+    common_hal_storage_keyvaluestore_construct(self, partition, start_block, block_count);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def __len__(self) -> int:
+//|         """Return the number of keys in the store. This is used by (`len`)"""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t len = common_hal_storage_keyvaluestore_get_len(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(len);
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+//|     def __contains__(self, key: str) -> bool:
+//|         """Return True if ``key`` is in the store. This is used by (`in`)"""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(lhs_in);
+    switch (op) {
+        case MP_BINARY_OP_CONTAINS:
+            return mp_obj_new_bool(common_hal_storage_keyvaluestore_contains(self, rhs_in));
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+//|     def __getitem__(self, key: str) -> bytes:
+//|         """Return the value stored for ``key``. Raises `KeyError` if there is none."""
+//|         ...
+//|
+//|     def __setitem__(self, key: str, value: ReadableBuffer) -> None:
+//|         """Store ``value`` for ``key``. Keys are at most 64 bytes long.
+//|
+//|         Raises `OSError` with ``errno.ENOSPC`` if the store is full."""
+//|         ...
+//|
+//|     def __delitem__(self, key: str) -> None:
+//|         """Remove ``key`` from the store. Raises `KeyError` if it is not there."""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_subscr(mp_obj_t self_in, mp_obj_t key, mp_obj_t value) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_arg_validate_type_string(key, MP_QSTR_key);
+    if (value == MP_OBJ_SENTINEL) {
+        // load
+        mp_obj_t result = common_hal_storage_keyvaluestore_get(self, key);
+        if (result == MP_OBJ_NULL) {
+            mp_raise_type_arg(&mp_type_KeyError, key);
+        }
+        return result;
+    }
+    if (value == MP_OBJ_NULL) {
+        // delete
+        if (!common_hal_storage_keyvaluestore_contains(self, key)) {
+            mp_raise_type_arg(&mp_type_KeyError, key);
+        }
+        value = mp_const_none;
+    } else if (value == mp_const_none) {
+        mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, not %q"), MP_QSTR_value, MP_QSTR_bytes, mp_obj_get_type(value)->name);
+    }
+    common_hal_storage_keyvaluestore_update(self, 1, &key, &value);
+    return mp_const_none;
+}
+
+//|     def get(self, key: str, default: Optional[bytes] = None) -> Optional[bytes]:
+//|         """Return the value stored for ``key``, or ``default`` if there is none."""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_get(size_t n_args, const mp_obj_t *args) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_t key = mp_arg_validate_type_string(args[1], MP_QSTR_key);
+    mp_obj_t result = common_hal_storage_keyvaluestore_get(self, key);
+    if (result == MP_OBJ_NULL) {
+        return n_args > 2 ? args[2] : mp_const_none;
+    }
+    return result;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(storage_keyvaluestore_get_obj, 2, 3, storage_keyvaluestore_get);
+
+//|     def keys(self) -> List[str]:
+//|         """Return a list of the keys in the store."""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_keys(mp_obj_t self_in) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_storage_keyvaluestore_keys(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(storage_keyvaluestore_keys_obj, storage_keyvaluestore_keys);
+
+//|     def update(self, values: Dict[str, Optional[ReadableBuffer]]) -> None:
+//|         """Store several values at once. A value of ``None`` removes its key.
+//|
+//|         The changes are committed together, so either all of them take
+//|         effect or, if power is lost while they are written, none do. This
+//|         also needs fewer writes than setting the keys one at a time."""
+//|         ...
+//|
+static mp_obj_t storage_keyvaluestore_update(mp_obj_t self_in, mp_obj_t values_in) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_arg_validate_type(values_in, &mp_type_dict, MP_QSTR_values);
+    mp_map_t *map = mp_obj_dict_get_map(values_in);
+    mp_obj_t *keys = m_new(mp_obj_t, map->used * 2);
+    mp_obj_t *values = keys + map->used;
+    size_t n = 0;
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (mp_map_slot_is_filled(map, i)) {
+            keys[n] = mp_arg_validate_type_string(map->table[i].key, MP_QSTR_key);
+            values[n] = map->table[i].value;
+            n++;
+        }
+    }
+    common_hal_storage_keyvaluestore_update(self, n, keys, values);
+    m_del(mp_obj_t, keys, map->used * 2);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(storage_keyvaluestore_update_obj, storage_keyvaluestore_update);
+
+//|     free: int
+//|     """The number of bytes left for new keys and longer values. (read-only)"""
+//|
+static mp_obj_t storage_keyvaluestore_get_free(mp_obj_t self_in) {
+    storage_keyvaluestore_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_storage_keyvaluestore_get_free(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(storage_keyvaluestore_get_free_obj, storage_keyvaluestore_get_free);
+
+MP_PROPERTY_GETTER(storage_keyvaluestore_free_obj,
+    (mp_obj_t)&storage_keyvaluestore_get_free_obj);
+
+static const mp_rom_map_elem_t storage_keyvaluestore_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_free), MP_ROM_PTR(&storage_keyvaluestore_free_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&storage_keyvaluestore_get_obj) },
+    { MP_ROM_QSTR(MP_QSTR_keys), MP_ROM_PTR(&storage_keyvaluestore_keys_obj) },
+    { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&storage_keyvaluestore_update_obj) },
+};
+static MP_DEFINE_CONST_DICT(storage_keyvaluestore_locals_dict, storage_keyvaluestore_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    storage_keyvaluestore_type,
+    MP_QSTR_KeyValueStore,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, storage_keyvaluestore_make_new,
+    locals_dict, &storage_keyvaluestore_locals_dict,
+    subscr, storage_keyvaluestore_subscr,
+    unary_op, storage_keyvaluestore_unary_op,
+    binary_op, storage_keyvaluestore_binary_op
+    );
+
+#endif // CIRCUITPY_STORAGE_KEYVALUESTORE
@@ -0,0 +1,23 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/storage/KeyValueStore.h"
+
+extern const mp_obj_type_t storage_keyvaluestore_type;
+
+// Uses block_count blocks of the partition, starting at block start_block.
+void common_hal_storage_keyvaluestore_construct(storage_keyvaluestore_obj_t *self, storage_partition_obj_t *partition, uint32_t start_block, uint32_t block_count);
+// Returns MP_OBJ_NULL if key isn't in the store.
+mp_obj_t common_hal_storage_keyvaluestore_get(storage_keyvaluestore_obj_t *self, mp_obj_t key);
+bool common_hal_storage_keyvaluestore_contains(storage_keyvaluestore_obj_t *self, mp_obj_t key);
+size_t common_hal_storage_keyvaluestore_get_len(storage_keyvaluestore_obj_t *self);
+mp_obj_t common_hal_storage_keyvaluestore_keys(storage_keyvaluestore_obj_t *self);
+uint32_t common_hal_storage_keyvaluestore_get_free(storage_keyvaluestore_obj_t *self);
+// Stores each key's value, or removes the key if its value is None. All of the
+// changes are committed together.
+void common_hal_storage_keyvaluestore_update(storage_keyvaluestore_obj_t *self, size_t n, const mp_obj_t *keys, const mp_obj_t *values);
@@ -0,0 +1,246 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/objstr.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/LogFile.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_STORAGE_LOGFILE
+
+//| class LogFile:
+//|     """A ring of fixed-size records kept in a preallocated file
+//|
+//|     The file is created once at its full size, so appending a record only
+//|     writes the sector that holds it. The filesystem's allocation table and
+//|     directory entry are not touched, which keeps appends fast and avoids
+//|     wearing out the same flash blocks. When the log is full, each new record
+//|     replaces the oldest one.
+//|
+//|     Records are read back by index, with ``0`` being the oldest record
+//|     still in the log. Each record also has a sequence number that counts
+//|     every record ever appended, so a reader can tell where it left off.
+//|
+//|     The log must be on a FAT filesystem that is writable from Python.
+//|
+//|     Usage::
+//|
+//|        import storage
+//|        import struct
+//|
+//|        log = storage.LogFile("/telemetry.log", record_size=16, record_count=4096)
+//|        log.append(struct.pack("<Iff", time.monotonic_ns() // 1000000, x, y))
+//|        newest = log[-1]
+//|        log.flush()
+//|     """
+//|
+//|     def __init__(self, path: str, record_size: int, record_count: int) -> None:
+//|         """Open the log at ``path``, creating it if it does not exist.
+//|
+//|         :param str path: The path of the log file
+//|         :param int record_size: The size of each record in bytes, from 1 to 508
+//|         :param int record_count: The minimum number of records to keep. It is
+//|           rounded up to fill the last sector; see `capacity`.
+//|
+//|         An existing log is reopened with its records intact. If it was
+//|         created with a different ``record_size`` or ``record_count``,
+//|         `ValueError` is raised. Any other file at ``path`` is replaced.
+//|         """
+//|         ...
+//|
+static mp_obj_t storage_logfile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_path, ARG_record_size, ARG_record_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_path, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_record_size, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_record_count, MP_ARG_REQUIRED | MP_ARG_INT },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const char *path = mp_obj_str_get_str(args[ARG_path].u_obj);
+    mp_int_t record_size = mp_arg_validate_int_range(args[ARG_record_size].u_int, 1, STORAGE_LOGFILE_SECTOR_SIZE - 4, MP_QSTR_record_size);
+    mp_int_t record_count = mp_arg_validate_int_range(args[ARG_record_count].u_int, 1, 0x10000000, MP_QSTR_record_count);
+
+    storage_logfile_obj_t *self = mp_obj_malloc(storage_logfile_obj_t, &storage_logfile_type);
+    common_hal_storage_logfile_construct(self, path, record_size, record_count);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void check_for_deinit(storage_logfile_obj_t *self) {
+    if (common_hal_storage_logfile_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def deinit(self) -> None:
+//|         """Write any buffered records and release the log's memory."""
+//|         ...
+//|
+static mp_obj_t storage_logfile_deinit(mp_obj_t self_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_storage_logfile_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(storage_logfile_deinit_obj, storage_logfile_deinit);
+
+//|     def __enter__(self) -> LogFile:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t storage_logfile_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_storage_logfile_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(storage_logfile___exit___obj, 4, 4, storage_logfile_obj___exit__);
+
+//|     def append(self, record: ReadableBuffer) -> None:
+//|         """Add a record to the end of the log, replacing the oldest record
+//|         when the log is full. A record shorter than `record_size` is padded
+//|         with zeros.
+//|
+//|         Records are buffered until a sector fills up. Call `flush` to write
+//|         a partly filled sector."""
+//|         ...
+//|
+static mp_obj_t storage_logfile_append(mp_obj_t self_in, mp_obj_t record_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(record_in, &bufinfo, MP_BUFFER_READ);
+    mp_arg_validate_length_max(bufinfo.len, common_hal_storage_logfile_get_record_size(self), MP_QSTR_record);
+    common_hal_storage_logfile_append(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(storage_logfile_append_obj, storage_logfile_append);
+
+//|     def flush(self) -> None:
+//|         """Write any buffered records to the filesystem."""
+//|         ...
+//|
+static mp_obj_t storage_logfile_flush(mp_obj_t self_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_storage_logfile_flush(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(storage_logfile_flush_obj, storage_logfile_flush);
+
+//|     record_size: int
+//|     """The size of each record in bytes. (read-only)"""
+static mp_obj_t storage_logfile_obj_get_record_size(mp_obj_t self_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_storage_logfile_get_record_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(storage_logfile_get_record_size_obj, storage_logfile_obj_get_record_size);
+
+MP_PROPERTY_GETTER(storage_logfile_record_size_obj,
+    (mp_obj_t)&storage_logfile_get_record_size_obj);
+
+//|     capacity: int
+//|     """The number of records the log holds before it wraps around. This is
+//|     ``record_count`` rounded up to a whole number of sectors. (read-only)"""
+static mp_obj_t storage_logfile_obj_get_capacity(mp_obj_t self_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_storage_logfile_get_capacity(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(storage_logfile_get_capacity_obj, storage_logfile_obj_get_capacity);
+
+MP_PROPERTY_GETTER(storage_logfile_capacity_obj,
+    (mp_obj_t)&storage_logfile_get_capacity_obj);
+
+//|     sequence: int
+//|     """The sequence number of the newest record. Records are numbered from
+//|     1, so this is the total number of records ever appended, and
+//|     ``log[i]`` has sequence number ``sequence - len(log) + 1 + i``.
+//|     (read-only)"""
+//|
+static mp_obj_t storage_logfile_obj_get_sequence(mp_obj_t self_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_storage_logfile_get_sequence(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(storage_logfile_get_sequence_obj, storage_logfile_obj_get_sequence);
+
+MP_PROPERTY_GETTER(storage_logfile_sequence_obj,
+    (mp_obj_t)&storage_logfile_get_sequence_obj);
+
+//|     def __len__(self) -> int:
+//|         """Return the number of records in the log. This is used by (`len`)"""
+//|         ...
+//|
+static mp_obj_t storage_logfile_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t len = common_hal_storage_logfile_get_length(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(len);
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+//|     def __getitem__(self, index: int) -> bytes:
+//|         """Return the record at ``index``. ``0`` is the oldest record and
+//|         ``-1`` the newest."""
+//|         ...
+//|
+static mp_obj_t storage_logfile_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value) {
+    if (value != MP_OBJ_SENTINEL) {
+        // Records can't be deleted or replaced.
+        return MP_OBJ_NULL; // op not supported
+    }
+    storage_logfile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    size_t index = mp_get_index(self->base.type, common_hal_storage_logfile_get_length(self), index_in, false);
+    vstr_t vstr;
+    vstr_init_len(&vstr, common_hal_storage_logfile_get_record_size(self));
+    common_hal_storage_logfile_read(self, index, (uint8_t *)vstr.buf);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+
+static const mp_rom_map_elem_t storage_logfile_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&storage_logfile_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&storage_logfile___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&storage_logfile_append_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&storage_logfile_flush_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_record_size), MP_ROM_PTR(&storage_logfile_record_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_capacity), MP_ROM_PTR(&storage_logfile_capacity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sequence), MP_ROM_PTR(&storage_logfile_sequence_obj) },
+};
+static MP_DEFINE_CONST_DICT(storage_logfile_locals_dict, storage_logfile_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    storage_logfile_type,
+    MP_QSTR_LogFile,
+    MP_TYPE_FLAG_ITER_IS_GETITER,
+    make_new, storage_logfile_make_new,
+    locals_dict, &storage_logfile_locals_dict,
+    subscr, storage_logfile_subscr,
+    unary_op, storage_logfile_unary_op,
+    iter, mp_obj_generic_subscript_getiter
+    );
+
+#endif // CIRCUITPY_STORAGE_LOGFILE
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/storage/LogFile.h"
+
+extern const mp_obj_type_t storage_logfile_type;
+
+void common_hal_storage_logfile_construct(storage_logfile_obj_t *self, const char *path, mp_int_t record_size, mp_int_t record_count);
+void common_hal_storage_logfile_deinit(storage_logfile_obj_t *self);
+bool common_hal_storage_logfile_deinited(storage_logfile_obj_t *self);
+void common_hal_storage_logfile_append(storage_logfile_obj_t *self, const uint8_t *data, size_t len);
+void common_hal_storage_logfile_read(storage_logfile_obj_t *self, uint32_t index, uint8_t *data);
+void common_hal_storage_logfile_flush(storage_logfile_obj_t *self);
+uint32_t common_hal_storage_logfile_get_length(storage_logfile_obj_t *self);
+uint32_t common_hal_storage_logfile_get_capacity(storage_logfile_obj_t *self);
+uint32_t common_hal_storage_logfile_get_record_size(storage_logfile_obj_t *self);
+uint32_t common_hal_storage_logfile_get_sequence(storage_logfile_obj_t *self);
@@ -0,0 +1,172 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "extmod/vfs.h"
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/Partition.h"
+
+#if CIRCUITPY_STORAGE_PARTITION
+
+//| class Partition:
+//|     """A region of flash reserved for data, outside of CIRCUITPY
+//|
+//|     Large constant data, such as lookup tables and models, can live in the
+//|     partition and be read in place through a `memoryview`, without copying
+//|     it into RAM. On boards that map flash into the address space, the
+//|     `memoryview` reads flash directly::
+//|
+//|        import storage
+//|
+//|        part = storage.Partition()
+//|        table = memoryview(part)
+//|        print(table[0:16])
+//|
+//|     The partition is also a block device with 4096 byte blocks, matching
+//|     the flash erase size, so the data can be written from Python::
+//|
+//|        with open("/model.bin", "rb") as f:
+//|            block = 0
+//|            while data := f.read(part.ioctl(5, 0)):
+//|                part.writeblocks(block, data)
+//|                block += 1
+//|
+//|     It supports the extended block protocol, so it can also hold a
+//|     `VfsLfs2` filesystem.
+//|
+//|     The board has to reserve the partition. On RP2040 and RP2350 it is the
+//|     last ``CIRCUITPY_STORAGE_PARTITION_SIZE`` bytes of flash. On Espressif
+//|     boards it is a data partition labelled ``user`` in the partition table.
+//|     """
+//|
+//|     def __init__(self) -> None:
+//|         """Access the board's reserved partition. Raises `OSError` if the
+//|         board doesn't reserve one, or if `enable_data_drive` is using it."""
+//|         ...
+//|
+static mp_obj_t storage_partition_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    storage_partition_obj_t *self = mp_obj_malloc(storage_partition_obj_t, &storage_partition_type);
+    common_hal_storage_partition_construct(self);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static uint32_t partition_address(storage_partition_obj_t *self, size_t n_args, const mp_obj_t *args) {
+    uint32_t address = mp_obj_get_int(args[1]) * common_hal_storage_partition_get_block_size(self);
+    if (n_args > 3) {
+        address += mp_obj_get_int(args[3]);
+    }
+    return address;
+}
+
+//|     def readblocks(self, block_num: int, buf: WriteableBuffer, offset: int = 0) -> int:
+//|         """Read ``buf`` from the partition, starting ``offset`` bytes into
+//|         block ``block_num``. Returns 0 on success."""
+//|         ...
+//|
+static mp_obj_t storage_partition_readblocks(size_t n_args, const mp_obj_t *args) {
+    storage_partition_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    bool ok = common_hal_storage_partition_read(self, partition_address(self, n_args, args), bufinfo.buf, bufinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(storage_partition_readblocks_obj, 3, 4, storage_partition_readblocks);
+
+//|     def writeblocks(self, block_num: int, buf: ReadableBuffer, offset: Optional[int] = None) -> int:
+//|         """Write ``buf`` to the partition starting at block ``block_num``.
+//|
+//|         Without ``offset``, the blocks are erased first. With ``offset``,
+//|         the data is written ``offset`` bytes into the block, which must
+//|         already be erased. Returns 0 on success."""
+//|         ...
+//|
+static mp_obj_t storage_partition_writeblocks(size_t n_args, const mp_obj_t *args) {
+    storage_partition_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+    bool ok = common_hal_storage_partition_write(self, partition_address(self, n_args, args), bufinfo.buf, bufinfo.len, n_args == 3);
+    return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(storage_partition_writeblocks_obj, 3, 4, storage_partition_writeblocks);
+
+//|     def ioctl(self, op: int, arg: int) -> Optional[int]:
+//|         """Block device control. Supports the block count (4), block size
+//|         (5) and block erase (6) operations."""
+//|         ...
+//|
+static mp_obj_t storage_partition_ioctl(mp_obj_t self_in, mp_obj_t cmd_in, mp_obj_t arg_in) {
+    storage_partition_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t block_size = common_hal_storage_partition_get_block_size(self);
+    switch (mp_obj_get_int(cmd_in)) {
+        case MP_BLOCKDEV_IOCTL_INIT:
+        case MP_BLOCKDEV_IOCTL_DEINIT:
+        case MP_BLOCKDEV_IOCTL_SYNC:
+            // Writes and erases complete before returning.
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            return MP_OBJ_NEW_SMALL_INT(common_hal_storage_partition_get_size(self) / block_size);
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            return MP_OBJ_NEW_SMALL_INT(block_size);
+        case MP_BLOCKDEV_IOCTL_BLOCK_ERASE: {
+            bool ok = common_hal_storage_partition_erase(self, mp_obj_get_int(arg_in) * block_size);
+            return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+        }
+        default:
+            return mp_const_none;
+    }
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(storage_partition_ioctl_obj, storage_partition_ioctl);
+
+//|     def __len__(self) -> int:
+//|         """Return the size of the partition in bytes. This is used by (`len`)"""
+//|         ...
+//|
+static mp_obj_t storage_partition_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    storage_partition_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t len = common_hal_storage_partition_get_size(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(len);
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+// The buffer is read-only: flash has to be erased before it is written, so
+// writes go through writeblocks().
+static mp_int_t storage_partition_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    storage_partition_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const uint8_t *mapped = common_hal_storage_partition_get_mapped(self);
+    if ((flags & MP_BUFFER_WRITE) || mapped == NULL) {
+        return 1;
+    }
+    bufinfo->buf = (void *)mapped;
+    bufinfo->len = common_hal_storage_partition_get_size(self);
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+static const mp_rom_map_elem_t storage_partition_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&storage_partition_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&storage_partition_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&storage_partition_ioctl_obj) },
+};
+static MP_DEFINE_CONST_DICT(storage_partition_locals_dict, storage_partition_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    storage_partition_type,
+    MP_QSTR_Partition,
+    MP_TYPE_FLAG_NONE,
+    make_new, storage_partition_make_new,
+    locals_dict, &storage_partition_locals_dict,
+    unary_op, storage_partition_unary_op,
+    buffer, storage_partition_get_buffer
+    );
+
+#endif // CIRCUITPY_STORAGE_PARTITION
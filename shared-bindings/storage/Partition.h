@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/storage/Partition.h"
+
+extern const mp_obj_type_t storage_partition_type;
+
+void common_hal_storage_partition_construct(storage_partition_obj_t *self);
+uint32_t common_hal_storage_partition_get_size(storage_partition_obj_t *self);
+uint32_t common_hal_storage_partition_get_block_size(storage_partition_obj_t *self);
+const uint8_t *common_hal_storage_partition_get_mapped(storage_partition_obj_t *self);
+bool common_hal_storage_partition_read(storage_partition_obj_t *self, uint32_t address, uint8_t *dest, uint32_t len);
+// Erases the blocks first when erase is true. Otherwise they must already be erased.
+bool common_hal_storage_partition_write(storage_partition_obj_t *self, uint32_t address, const uint8_t *src, uint32_t len, bool erase);
+bool common_hal_storage_partition_erase(storage_partition_obj_t *self, uint32_t address);
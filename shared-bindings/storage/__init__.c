@@ -9,10 +9,22 @@
 #include <string.h>
 
 #include "extmod/vfs_fat.h"
+#if CIRCUITPY_LITTLEFS
+#include "extmod/vfs_lfs.h"
+#endif
 #include "py/obj.h"
 #include "py/objnamedtuple.h"
 #include "py/runtime.h"
 #include "shared-bindings/storage/__init__.h"
+#if CIRCUITPY_STORAGE_KEYVALUESTORE
+#include "shared-bindings/storage/KeyValueStore.h"
+#endif
+#if CIRCUITPY_STORAGE_LOGFILE
+#include "shared-bindings/storage/LogFile.h"
+#endif
+#if CIRCUITPY_STORAGE_PARTITION
+#include "shared-bindings/storage/Partition.h"
+#endif
 #include "supervisor/flash.h"
 
 //| """Storage management
@@ -35,6 +47,9 @@
 //|     :param VfsFat filesystem: The filesystem to mount.
 //|     :param str mount_path: Where to mount the filesystem.
 //|     :param bool readonly: True when the filesystem should be readonly to CircuitPython.
+//|
+//|     Writes to the filesystem's block device may be held in a small block cache.
+//|     They are written to the device by `os.sync()`, `umount()` and at the end of the program.
 //|     """
 //|     ...
 //|
@@ -130,7 +145,7 @@ static mp_obj_t storage_getmount(const mp_obj_t mnt_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(storage_getmount_obj, storage_getmount);
 
-//| def erase_filesystem(extended: Optional[bool] = None) -> None:
+//| def erase_filesystem(extended: Optional[bool] = None, *, littlefs: bool = False) -> None:
 //|     """Erase and re-create the ``CIRCUITPY`` filesystem.
 //|
 //|     On boards that present USB-visible ``CIRCUITPY`` drive (e.g., SAMD21 and SAMD51),
@@ -148,20 +163,35 @@ MP_DEFINE_CONST_FUN_OBJ_1(storage_getmount_obj, storage_getmount);
 //|     .. note:: New firmware starts with storage extended. In case of an existing
 //|          filesystem (e.g. uf2 load), the existing extension setting is preserved.
 //|
+//|     :param bool littlefs: On boards built with LittleFS support, format ``CIRCUITPY``
+//|         as LittleFS instead of FAT. LittleFS is power-loss safe and wear-levelled, but
+//|         it can't be presented as a USB drive or edited over the web or BLE workflows,
+//|         so files must be managed from Python. Calling ``erase_filesystem()`` without it
+//|         goes back to FAT.
+//|
 //|     .. warning:: All the data on ``CIRCUITPY`` will be lost, and
 //|         CircuitPython will restart on certain boards."""
 //|     ...
 //|
 
 static mp_obj_t storage_erase_filesystem(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_extended };
+    enum { ARG_extended, ARG_littlefs };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_extended, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        #if CIRCUITPY_LITTLEFS
+        { MP_QSTR_littlefs, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        #endif
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    #if CIRCUITPY_LITTLEFS
+    if (args[ARG_littlefs].u_bool) {
+        common_hal_storage_erase_filesystem_littlefs();
+    }
+    #endif
+
     #if CIRCUITPY_STORAGE_EXTEND
     bool extended = (args[ARG_extended].u_obj == mp_const_none) ? supervisor_flash_get_extended() : mp_obj_is_true(args[ARG_extended].u_obj);
     common_hal_storage_erase_filesystem(extended);
@@ -219,6 +249,33 @@ static mp_obj_t storage_enable_usb_drive(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(storage_enable_usb_drive_obj, storage_enable_usb_drive);
 
+//| def enable_data_drive() -> None:
+//|     """Mount the board's reserved flash partition (see `Partition`) as a
+//|     FAT filesystem at ``/data`` that Python can always write, and present it
+//|     to the host as a second, read-only USB drive. The partition is formatted
+//|     first if it doesn't hold a FAT filesystem.
+//|
+//|     ``CIRCUITPY`` stays writable by the host, so code can be deployed while
+//|     Python logs to ``/data`` and the host copies the logs off, without
+//|     remounting or rebooting in between. Each drive has a single writer, so
+//|     neither can be corrupted by the other. The host is told the drive has
+//|     changed whenever Python's writes reach flash, such as when a file is
+//|     flushed or closed.
+//|
+//|     The drive stays enabled until the next hard reset. Call it in
+//|     ``boot.py``, before USB is connected. Raises `OSError` if the board
+//|     doesn't reserve a large enough partition.
+//|     """
+//|     ...
+//|
+#if CIRCUITPY_STORAGE_DATA_DRIVE
+static mp_obj_t storage_enable_data_drive(void) {
+    common_hal_storage_enable_data_drive();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(storage_enable_data_drive_obj, storage_enable_data_drive);
+#endif
+
 static const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_storage) },
 
@@ -229,6 +286,9 @@ static const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_erase_filesystem),  MP_ROM_PTR(&storage_erase_filesystem_obj) },
     { MP_ROM_QSTR(MP_QSTR_disable_usb_drive), MP_ROM_PTR(&storage_disable_usb_drive_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable_usb_drive),  MP_ROM_PTR(&storage_enable_usb_drive_obj) },
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    { MP_ROM_QSTR(MP_QSTR_enable_data_drive), MP_ROM_PTR(&storage_enable_data_drive_obj) },
+    #endif
 
 //| class VfsFat:
 //|     def __init__(self, block_device: BlockDevice) -> None:
@@ -290,8 +350,51 @@ static const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|     def umount(self) -> None:
 //|         """Don't call this directly, call `storage.umount`."""
 //|         ...
+//|
+
+//| class VfsLfs2:
+//|     def __init__(
+//|         self,
+//|         block_device: BlockDevice,
+//|         *,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 32,
+//|         mtime: bool = True,
+//|     ) -> None:
+//|         """Create a new LittleFS filesystem around the given block device. Only
+//|         available on boards built with LittleFS support.
+//|
+//|         The block device must support the extended block protocol: ``readblocks``
+//|         and ``writeblocks`` take a byte offset, and ``ioctl`` handles block erase (6).
+//|
+//|         :param block_device: Block device the the filesystem lives on"""
+//|         ...
+//|
+//|     @staticmethod
+//|     def mkfs(
+//|         block_device: BlockDevice,
+//|         *,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 32,
+//|     ) -> None:
+//|         """Format the block device, deleting any data that may have been there."""
+//|         ...
 //|
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
+    #if CIRCUITPY_LITTLEFS
+    { MP_ROM_QSTR(MP_QSTR_VfsLfs2), MP_ROM_PTR(&mp_type_vfs_lfs2) },
+    #endif
+    #if CIRCUITPY_STORAGE_KEYVALUESTORE
+    { MP_ROM_QSTR(MP_QSTR_KeyValueStore), MP_ROM_PTR(&storage_keyvaluestore_type) },
+    #endif
+    #if CIRCUITPY_STORAGE_LOGFILE
+    { MP_ROM_QSTR(MP_QSTR_LogFile), MP_ROM_PTR(&storage_logfile_type) },
+    #endif
+    #if CIRCUITPY_STORAGE_PARTITION
+    { MP_ROM_QSTR(MP_QSTR_Partition), MP_ROM_PTR(&storage_partition_type) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(storage_module_globals, storage_module_globals_table);
@@ -17,6 +17,12 @@ void common_hal_storage_umount_object(mp_obj_t vfs_obj);
 void common_hal_storage_remount(const char *path, bool readonly, bool disable_concurrent_write_protection);
 mp_obj_t common_hal_storage_getmount(const char *path);
 void common_hal_storage_erase_filesystem(bool extended);
+#if CIRCUITPY_LITTLEFS
+void common_hal_storage_erase_filesystem_littlefs(void);
+#endif
 
 bool common_hal_storage_disable_usb_drive(void);
 bool common_hal_storage_enable_usb_drive(void);
+#if CIRCUITPY_STORAGE_DATA_DRIVE
+void common_hal_storage_enable_data_drive(void);
+#endif
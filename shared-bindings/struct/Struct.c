@@ -0,0 +1,256 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/struct/Struct.h"
+
+//| class Struct:
+//|     """A compiled format string. Packing and unpacking with a `Struct` doesn't
+//|     parse the format again, so it is faster than the module functions when the
+//|     same format is used many times."""
+//|
+//|     def __init__(self, format: str) -> None:
+//|         """Compile ``format``, which is as for `struct.pack`."""
+//|         ...
+//|
+
+static mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    char fmt_type;
+    size_t num_ops = shared_modules_struct_parse(mp_obj_str_get_str(args[0]), &fmt_type, NULL);
+    struct_struct_obj_t *self = mp_obj_malloc_var(struct_struct_obj_t, ops, struct_op_t, num_ops, type);
+    self->num_ops = num_ops;
+    shared_modules_struct_struct_construct(self, args[0]);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Returns a pointer to offset in the buffer, counting from the end if offset
+// is negative.
+static byte *struct_struct_get_ptr(mp_buffer_info_t *bufinfo, mp_int_t offset) {
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset = (mp_int_t)bufinfo->len + offset;
+        if (offset < 0) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+        }
+    }
+    return (byte *)bufinfo->buf + offset;
+}
+
+//|     format: str
+//|     """The format string used to construct this object. (read-only)"""
+//|
+static mp_obj_t struct_struct_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes needed to store the format, as from `struct.calcsize`. (read-only)"""
+//|
+static mp_obj_t struct_struct_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->size);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values according to the format.
+//|         The return value is a bytes object encoding the values."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    vstr_t vstr;
+    vstr_init_len(&vstr, self->size);
+    byte *p = (byte *)vstr.buf;
+    memset(p, 0, self->size);
+    shared_modules_struct_struct_pack_into(self, p, p + self->size, n_args - 1, &args[1]);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values according to the format into a buffer starting at
+//|         offset, without allocating. offset may be negative to count from the
+//|         end of buffer."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    byte *p = struct_struct_get_ptr(&bufinfo, mp_obj_get_int(args[2]));
+    shared_modules_struct_struct_pack_into(self, p, (byte *)bufinfo.buf + bufinfo.len, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+//|     def unpack(self, data: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpack from the data according to the format. The return value is a
+//|         tuple of the unpacked values. The buffer size must match `size`."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    byte *p = bufinfo.buf;
+    // true means check the size must be exactly right.
+    shared_modules_struct_struct_unpack_into(self, p, p + bufinfo.len, true, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, data: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
+//|         """Unpack from the data starting at offset according to the format.
+//|         offset may be negative to count from the end of buffer. The return
+//|         value is a tuple of the unpacked values. The buffer size must be at
+//|         least offset plus `size`."""
+//|         ...
+//|
+//|     def unpack_from_into(self, values: List[Any], data: ReadableBuffer, offset: int = 0) -> None:
+//|         """As `unpack_from`, but store the unpacked values in the list
+//|         ``values`` instead of allocating a tuple. ``values`` must have one
+//|         element for each value in the format."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_from_helper(struct_struct_obj_t *self, mp_obj_t data, mp_obj_t offset_in, mp_obj_t *items) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    byte *p = struct_struct_get_ptr(&bufinfo, offset_in == MP_OBJ_NULL ? 0 : mp_obj_get_int(offset_in));
+    // false means the size doesn't have to be exact, the buffer only has to
+    // be big enough.
+    shared_modules_struct_struct_unpack_into(self, p, (byte *)bufinfo.buf + bufinfo.len, false, items);
+    return mp_const_none;
+}
+
+static mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    struct_struct_unpack_from_helper(self, args[1], n_args > 2 ? args[2] : MP_OBJ_NULL, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_unpack_from_obj, 2, 3, struct_struct_unpack_from);
+
+static mp_obj_t struct_struct_unpack_from_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_list_t *values = MP_OBJ_TO_PTR(mp_arg_validate_type(args[1], &mp_type_list, MP_QSTR_values));
+    mp_arg_validate_length(values->len, self->num_items, MP_QSTR_values);
+    return struct_struct_unpack_from_helper(self, args[2], n_args > 3 ? args[3] : MP_OBJ_NULL, values->items);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_unpack_from_into_obj, 3, 4, struct_struct_unpack_from_into);
+
+//|     def unpack_columns_into(self, columns: Sequence[Any], data: ReadableBuffer, offset: int = 0) -> int:
+//|         """Unpack consecutive records from the data starting at offset, storing
+//|         each value of the format in the next element of its column instead of
+//|         allocating a tuple per record. ``columns`` has one entry for each
+//|         value in the format: a writable buffer such as an `array.array`, a
+//|         list, or None to skip that value. Integers and floats are stored in
+//|         buffer columns without allocating.
+//|
+//|         Unpacking stops at the end of the data or of the shortest column.
+//|         Returns the number of records unpacked."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_columns_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t n_columns;
+    mp_obj_t *columns;
+    mp_obj_get_array(args[1], &n_columns, &columns);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+    byte *p = struct_struct_get_ptr(&bufinfo, n_args > 3 ? mp_obj_get_int(args[3]) : 0);
+    return MP_OBJ_NEW_SMALL_INT(shared_modules_struct_unpack_columns_ops(self->fmt_type, self->ops, self->num_ops,
+        p, (byte *)bufinfo.buf + bufinfo.len, n_columns, columns));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_unpack_columns_into_obj, 3, 4, struct_struct_unpack_columns_into);
+
+typedef struct {
+    mp_obj_base_t base;
+    struct_struct_obj_t *st;
+    mp_obj_t data;
+    size_t offset;
+} struct_unpack_iter_obj_t;
+
+static mp_obj_t struct_unpack_iter_iternext(mp_obj_t self_in) {
+    struct_unpack_iter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Get the buffer each time, in case it has been resized.
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->data, &bufinfo, MP_BUFFER_READ);
+    if (self->offset + self->st->size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->st->num_items, NULL));
+    byte *p = (byte *)bufinfo.buf + self->offset;
+    shared_modules_struct_struct_unpack_into(self->st, p, (byte *)bufinfo.buf + bufinfo.len, false, res->items);
+    self->offset += self->st->size;
+    return MP_OBJ_FROM_PTR(res);
+}
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    struct_unpack_iter_type,
+    MP_QSTR_unpack_iterator,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, struct_unpack_iter_iternext
+    );
+
+//|     def iter_unpack(self, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|         """Return an iterator that unpacks consecutive records from the data,
+//|         yielding a tuple for each. The buffer size must be a multiple of
+//|         `size`."""
+//|         ...
+//|
+mp_obj_t struct_struct_iter_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_arg_validate_int_min(self->size, 1, MP_QSTR_size);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len % self->size != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), (int)self->size);
+    }
+    struct_unpack_iter_obj_t *iter = mp_obj_malloc(struct_unpack_iter_obj_t, &struct_unpack_iter_type);
+    iter->st = self;
+    iter->data = data;
+    iter->offset = 0;
+    return MP_OBJ_FROM_PTR(iter);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_iter_unpack_obj, struct_struct_iter_unpack);
+
+static const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from_into), MP_ROM_PTR(&struct_struct_unpack_from_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_columns_into), MP_ROM_PTR(&struct_struct_unpack_columns_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_struct_iter_unpack_obj) },
+};
+static MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_type,
+    MP_QSTR_Struct,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, struct_struct_make_new,
+    locals_dict, &struct_struct_locals_dict
+    );
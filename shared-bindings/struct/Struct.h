@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/struct/__init__.h"
+
+extern const mp_obj_type_t struct_struct_type;
+
+mp_obj_t struct_struct_iter_unpack(mp_obj_t self_in, mp_obj_t data);
+
+void shared_modules_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format);
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args);
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, byte *end_p, bool exact_size, mp_obj_t *items);
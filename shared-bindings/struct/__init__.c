@@ -15,6 +15,7 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
 #include "shared-module/struct/__init__.h"
 
 //| """Manipulation of c-style data
@@ -24,7 +25,10 @@
 //| Supported size/byte order prefixes: *@*, *<*, *>*, *!*.
 //|
 //| Supported format codes: *b*, *B*, *x*, *h*, *H*, *i*, *I*, *l*, *L*, *q*, *Q*,
-//| *s*, *P*, *f*, *d* (the latter 2 depending on the floating-point support)."""
+//| *s*, *P*, *f*, *d* (the latter 2 depending on the floating-point support).
+//|
+//| Code that packs or unpacks the same format many times should compile it once
+//| with `Struct`."""
 //|
 
 
@@ -141,6 +145,48 @@ static mp_obj_t struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_m
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
 
+//| def unpack_columns_into(fmt: str, data: ReadableBuffer, offset: int, columns: Sequence[Any]) -> int:
+//|     """Unpack consecutive records from the data starting at offset according
+//|     to the format string fmt, storing each value in the next element of its
+//|     column. See `Struct.unpack_columns_into`. Returns the number of records
+//|     unpacked."""
+//|     ...
+//|
+
+static mp_obj_t struct_unpack_columns_into(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_READ);
+    mp_int_t offset = mp_obj_get_int(args[2]);
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset = (mp_int_t)bufinfo.len + offset;
+        if (offset < 0) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+        }
+    }
+    byte *p = (byte *)bufinfo.buf;
+    byte *end_p = &p[bufinfo.len];
+    p += offset;
+
+    size_t n_columns;
+    mp_obj_t *columns;
+    mp_obj_get_array(args[3], &n_columns, &columns);
+    return MP_OBJ_NEW_SMALL_INT(shared_modules_struct_unpack_columns(args[0], p, end_p, n_columns, columns));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_unpack_columns_into_obj, 4, 4, struct_unpack_columns_into);
+
+//| def iter_unpack(fmt: str, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|     """Return an iterator that unpacks consecutive records from the data
+//|     according to the format string fmt, yielding a tuple for each. The buffer
+//|     size must be a multiple of the size required by the format."""
+//|     ...
+//|
+
+static mp_obj_t struct_iter_unpack(mp_obj_t fmt_in, mp_obj_t data) {
+    return struct_struct_iter_unpack(mp_call_function_1(MP_OBJ_FROM_PTR(&struct_struct_type), fmt_in), data);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_iter_unpack_obj, struct_iter_unpack);
+
 static const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_struct) },
     { MP_ROM_QSTR(MP_QSTR_calcsize), MP_ROM_PTR(&struct_calcsize_obj) },
@@ -148,6 +194,9 @@ static const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_unpack_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_columns_into), MP_ROM_PTR(&struct_unpack_columns_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_iter_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_struct_type) },
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_struct_globals, mp_module_struct_globals_table);
@@ -14,6 +14,11 @@
 //| class StatusBar:
 //|     """Current status of runtime objects.
 //|
+//|     The status bar is only sent when what it shows changes, and changes from
+//|     the background, such as the network connecting, are sent at most twice a
+//|     second. Setting both `console` and `display` to ``False`` in ``boot.py``
+//|     stops all status bar work.
+//|
 //|     Usage::
 //|
 //|        import supervisor
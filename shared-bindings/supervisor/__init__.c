@@ -10,6 +10,7 @@
 #include "py/objstr.h"
 
 #include "shared/runtime/interrupt_char.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/reload.h"
@@ -20,6 +21,15 @@
 #include "supervisor/usb.h"
 #endif
 
+#if CIRCUITPY_SUPERVISOR_PROFILE
+#include "supervisor/shared/profile.h"
+#endif
+
+#if CIRCUITPY_TRACE
+#include "py/stream.h"
+#include "supervisor/shared/trace.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/supervisor/__init__.h"
 #include "shared-bindings/time/__init__.h"
@@ -310,6 +320,159 @@ static mp_obj_t supervisor_set_usb_identification(size_t n_args, const mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_set_usb_identification_obj, 0, supervisor_set_usb_identification);
 
+#if CIRCUITPY_SUPERVISOR_PROFILE
+//| def profile_start() -> None:
+//|     """Start sampling which Python function is running on every supervisor tick
+//|     (1/1024th of a second). Any samples from a previous run are discarded."""
+//|     ...
+//|
+static mp_obj_t supervisor_profile_start_(void) {
+    supervisor_profile_start();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_profile_start_obj, supervisor_profile_start_);
+
+//| def profile_stop() -> None:
+//|     """Stop sampling. The samples taken so far are kept for `profile`."""
+//|     ...
+//|
+static mp_obj_t supervisor_profile_stop_(void) {
+    supervisor_profile_stop();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_profile_stop_obj, supervisor_profile_stop_);
+
+//| def profile() -> List[Tuple[Optional[str], Optional[str], int]]:
+//|     """Return ``(source_file, function_name, samples)`` tuples, busiest function first.
+//|
+//|     Samples taken while no Python function was running, while a function was
+//|     running that has since been freed, or that didn't fit in the profiler's
+//|     fixed-size table are reported together as ``(None, None, samples)``."""
+//|     ...
+//|
+static mp_obj_t supervisor_profile(void) {
+    return supervisor_profile_result();
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_profile_obj, supervisor_profile);
+#endif
+
+//| def background_stats(
+//|     reset: bool = False,
+//| ) -> Tuple[Tuple[int, int, int, int], Tuple[int, int, int, int], Tuple[int, int, int, int]]:
+//|     """Return the time spent running background tasks, as
+//|     ``(runs, total_us, max_us, deferred)`` tuples for the real time (audio,
+//|     USB), normal and bulk (display, filesystem) classes, in that order.
+//|     ``deferred`` counts how often bulk tasks were left for later to keep
+//|     within the board's time budget for them.
+//|
+//|     :param bool reset: Clear the counts after reading them."""
+//|     ...
+//|
+static mp_obj_t supervisor_background_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    static const background_callback_priority_t order[] = {
+        BACKGROUND_CALLBACK_PRIORITY_REALTIME,
+        BACKGROUND_CALLBACK_PRIORITY_NORMAL,
+        BACKGROUND_CALLBACK_PRIORITY_BULK,
+    };
+    mp_obj_t classes[MP_ARRAY_SIZE(order)];
+    for (size_t i = 0; i < MP_ARRAY_SIZE(order); i++) {
+        background_callback_stats_t stats;
+        background_callback_get_stats(order[i], &stats);
+        mp_obj_t items[] = {
+            mp_obj_new_int_from_uint(stats.runs),
+            mp_obj_new_int_from_ull(stats.total_us),
+            mp_obj_new_int_from_uint(stats.max_us),
+            mp_obj_new_int_from_uint(stats.deferred),
+        };
+        classes[i] = mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+    }
+    if (args[ARG_reset].u_bool) {
+        background_callback_reset_stats();
+    }
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(classes), classes);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_background_stats_obj, 0, supervisor_background_stats);
+
+#if CIRCUITPY_TRACE
+//| def trace_start() -> None:
+//|     """Start recording runtime events, such as garbage collections, background
+//|     tasks, USB, display refreshes, filesystem flushes and code.py starting and
+//|     stopping, with timestamps. Drivers also record when keys change, counts
+//|     are recorded, pulses arrive, camera frames are taken and audio buffers
+//|     are refilled, so their latency can be compared. Only the most recent
+//|     events are kept. Any events from a previous run are discarded. Recording
+//|     continues across reloads, so a trace can be dumped after code.py fails."""
+//|     ...
+//|
+static mp_obj_t supervisor_trace_start(void) {
+    trace_start();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_trace_start_obj, supervisor_trace_start);
+
+//| def trace_stop() -> None:
+//|     """Stop recording. The events so far are kept for `trace_dump`."""
+//|     ...
+//|
+static mp_obj_t supervisor_trace_stop(void) {
+    trace_stop();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_trace_stop_obj, supervisor_trace_stop);
+
+static void trace_write(void *context, const void *buf, size_t len) {
+    int errcode;
+    mp_stream_rw(*(mp_obj_t *)context, (void *)buf, len, &errcode, MP_STREAM_RW_WRITE);
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+}
+
+//| def trace_dump(stream: circuitpython_typing.ByteStream) -> None:
+//|     """Write the recorded events to ``stream`` in a compact binary form, such
+//|     as to a file opened with ``"wb"`` or to `usb_cdc.data`. Recording pauses
+//|     while the events are written. ``tools/decode_trace.py`` on the host
+//|     prints them or converts them for a trace viewer, with times either from
+//|     the first event or on the same clock as `time.monotonic_ns`."""
+//|     ...
+//|
+static mp_obj_t supervisor_trace_dump(mp_obj_t stream) {
+    mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
+    bool was_enabled = trace_enabled;
+    trace_stop();
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        trace_dump(trace_write, &stream);
+        nlr_pop();
+    } else {
+        trace_enabled = was_enabled;
+        nlr_jump(nlr.ret_val);
+    }
+    trace_enabled = was_enabled;
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_trace_dump_obj, supervisor_trace_dump);
+
+//| def trace_mark(value: int = 0) -> None:
+//|     """Record a ``mark`` event with ``value``, from 0 to 65535, while recording,
+//|     so that points in the Python code show up among the runtime events."""
+//|     ...
+//|
+static mp_obj_t supervisor_trace_mark(size_t n_args, const mp_obj_t *args) {
+    mp_int_t value = n_args > 0 ? mp_arg_validate_int_range(mp_obj_get_int(args[0]), 0, UINT16_MAX, MP_QSTR_value) : 0;
+    trace_event(TRACE_EVENT_MARK, value);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_trace_mark_obj, 0, 1, supervisor_trace_mark);
+#endif
+
 static const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_supervisor) },
     { MP_ROM_QSTR(MP_QSTR_runtime),  MP_ROM_PTR(&common_hal_supervisor_runtime_obj) },
@@ -326,6 +489,18 @@ static const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset_terminal),  MP_ROM_PTR(&supervisor_reset_terminal_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_usb_identification),  MP_ROM_PTR(&supervisor_set_usb_identification_obj) },
     { MP_ROM_QSTR(MP_QSTR_status_bar),  MP_ROM_PTR(&shared_module_supervisor_status_bar_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background_stats),  MP_ROM_PTR(&supervisor_background_stats_obj) },
+    #if CIRCUITPY_TRACE
+    { MP_ROM_QSTR(MP_QSTR_trace_start),  MP_ROM_PTR(&supervisor_trace_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_trace_stop),  MP_ROM_PTR(&supervisor_trace_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_trace_dump),  MP_ROM_PTR(&supervisor_trace_dump_obj) },
+    { MP_ROM_QSTR(MP_QSTR_trace_mark),  MP_ROM_PTR(&supervisor_trace_mark_obj) },
+    #endif
+    #if CIRCUITPY_SUPERVISOR_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_profile_start),  MP_ROM_PTR(&supervisor_profile_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_stop),  MP_ROM_PTR(&supervisor_profile_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile),  MP_ROM_PTR(&supervisor_profile_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(supervisor_module_globals, supervisor_module_globals_table);
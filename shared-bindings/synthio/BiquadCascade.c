@@ -0,0 +1,107 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Biquad.h"
+#include "shared-bindings/synthio/BiquadCascade.h"
+
+//| class BiquadCascade:
+//|     def __init__(self, filters: Biquad | Sequence[Biquad]) -> None:
+//|         """A series of `Biquad` filters for processing arrays of samples directly,
+//|         such as sensor readings, rather than during audio playback.
+//|
+//|         The filters are applied one after another with the same fixed-point
+//|         arithmetic used by `Note` and `audiofilters.Filter`. Their history is kept
+//|         between calls to `process`, so a long signal can be filtered in pieces.
+//|
+//|         :param Sequence[Biquad] filters: The filters to apply, in order"""
+//|
+static mp_obj_t synthio_biquad_cascade_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_filters };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_filters, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t filters = args[ARG_filters].u_obj;
+    size_t n_sections;
+    mp_obj_t *items;
+    if (mp_obj_is_type(filters, (const mp_obj_type_t *)&synthio_biquad_type_obj)) {
+        n_sections = 1;
+        items = &filters;
+    } else {
+        mp_obj_get_array(filters, &n_sections, &items);
+    }
+    for (size_t i = 0; i < n_sections; i++) {
+        mp_arg_validate_type(items[i], (const mp_obj_type_t *)&synthio_biquad_type_obj, MP_QSTR_filters);
+    }
+
+    synthio_biquad_cascade_obj_t *self =
+        mp_obj_malloc_var(synthio_biquad_cascade_obj_t, sections, biquad_filter_state, n_sections, &synthio_biquad_cascade_type);
+    common_hal_synthio_biquad_cascade_construct(self, mp_obj_new_tuple(n_sections, items));
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     filters: Tuple[Biquad, ...]
+//|     """The filters, in the order they are applied (read-only)"""
+//|
+static mp_obj_t synthio_biquad_cascade_get_filters(mp_obj_t self_in) {
+    synthio_biquad_cascade_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_biquad_cascade_get_filters(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_biquad_cascade_get_filters_obj, synthio_biquad_cascade_get_filters);
+
+MP_PROPERTY_GETTER(synthio_biquad_cascade_filters_obj,
+    (mp_obj_t)&synthio_biquad_cascade_get_filters_obj);
+
+//|     def process(self, buffer: WriteableBuffer) -> None:
+//|         """Filter the signed 16-bit samples in ``buffer`` in place. Results that
+//|         don't fit in 16 bits are clipped.
+//|
+//|         :param WriteableBuffer buffer: An array of type 'h'"""
+//|         ...
+//|
+static mp_obj_t synthio_biquad_cascade_process(mp_obj_t self_in, mp_obj_t buffer) {
+    synthio_biquad_cascade_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
+    if (bufinfo.typecode != 'h') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'h'"), MP_QSTR_buffer);
+    }
+    common_hal_synthio_biquad_cascade_process(self, bufinfo.buf, bufinfo.len / sizeof(int16_t));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_biquad_cascade_process_obj, synthio_biquad_cascade_process);
+
+//|     def reset(self) -> None:
+//|         """Clear the filters' history, as if no samples had been processed yet."""
+//|         ...
+//|
+static mp_obj_t synthio_biquad_cascade_reset(mp_obj_t self_in) {
+    synthio_biquad_cascade_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_biquad_cascade_reset(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_biquad_cascade_reset_obj, synthio_biquad_cascade_reset);
+
+static const mp_rom_map_elem_t synthio_biquad_cascade_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_filters), MP_ROM_PTR(&synthio_biquad_cascade_filters_obj) },
+    { MP_ROM_QSTR(MP_QSTR_process), MP_ROM_PTR(&synthio_biquad_cascade_process_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&synthio_biquad_cascade_reset_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_biquad_cascade_locals_dict, synthio_biquad_cascade_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_biquad_cascade_type,
+    MP_QSTR_BiquadCascade,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_biquad_cascade_make_new,
+    locals_dict, &synthio_biquad_cascade_locals_dict
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/synthio/BiquadCascade.h"
+
+extern const mp_obj_type_t synthio_biquad_cascade_type;
+
+void common_hal_synthio_biquad_cascade_construct(synthio_biquad_cascade_obj_t *self, mp_obj_t filters);
+mp_obj_t common_hal_synthio_biquad_cascade_get_filters(synthio_biquad_cascade_obj_t *self);
+void common_hal_synthio_biquad_cascade_reset(synthio_biquad_cascade_obj_t *self);
+void common_hal_synthio_biquad_cascade_process(synthio_biquad_cascade_obj_t *self, int16_t *samples, size_t n_samples);
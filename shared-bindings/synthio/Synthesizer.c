@@ -283,6 +283,72 @@ MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_blocks_obj, synthio_synthesize
 MP_PROPERTY_GETTER(synthio_synthesizer_blocks_obj,
     (mp_obj_t)&synthio_synthesizer_get_blocks_obj);
 
+//|     midi_in: Optional[object]
+//|     """A stream to read MIDI messages from, such as a `usb_midi.PortIn` or `busio.UART`, or `None`.
+//|
+//|     The messages are read and acted on just before each buffer of audio is
+//|     made, so notes start without any Python code running. Note On and Note Off
+//|     press and release integer notes, ignoring the velocity, and the All Notes
+//|     Off and All Sound Off controllers release all notes. Other messages are
+//|     ignored.
+//|
+//|     Play the notes sent by the computer::
+//|
+//|       import audiobusio
+//|       import board
+//|       import synthio
+//|       import usb_midi
+//|
+//|       audio = audiobusio.I2SOut(board.GP0, board.GP1, board.GP2)
+//|       synth = synthio.Synthesizer(sample_rate=22050)
+//|       synth.midi_in = usb_midi.ports[0]
+//|       audio.play(synth)"""
+static mp_obj_t synthio_synthesizer_obj_get_midi_in(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_synthio_synthesizer_get_midi_in(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_midi_in_obj, synthio_synthesizer_obj_get_midi_in);
+
+static mp_obj_t synthio_synthesizer_obj_set_midi_in(mp_obj_t self_in, mp_obj_t midi_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_set_midi_in(self, midi_in);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_midi_in_obj, synthio_synthesizer_obj_set_midi_in);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_midi_in_obj,
+    (mp_obj_t)&synthio_synthesizer_get_midi_in_obj,
+    (mp_obj_t)&synthio_synthesizer_set_midi_in_obj);
+
+//|     midi_channel: Optional[int]
+//|     """The MIDI channel, 0 to 15, whose messages from `midi_in` are acted on, or `None` for all channels. The default is `None`."""
+//|
+static mp_obj_t synthio_synthesizer_obj_get_midi_channel(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t channel = common_hal_synthio_synthesizer_get_midi_channel(self);
+    return channel < 0 ? mp_const_none : MP_OBJ_NEW_SMALL_INT(channel);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_midi_channel_obj, synthio_synthesizer_obj_get_midi_channel);
+
+static mp_obj_t synthio_synthesizer_obj_set_midi_channel(mp_obj_t self_in, mp_obj_t channel_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t channel = -1;
+    if (channel_in != mp_const_none) {
+        channel = mp_arg_validate_int_range(mp_obj_get_int(channel_in), 0, 15, MP_QSTR_midi_channel);
+    }
+    common_hal_synthio_synthesizer_set_midi_channel(self, channel);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_midi_channel_obj, synthio_synthesizer_obj_set_midi_channel);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_midi_channel_obj,
+    (mp_obj_t)&synthio_synthesizer_get_midi_channel_obj,
+    (mp_obj_t)&synthio_synthesizer_set_midi_channel_obj);
+
 //|     max_polyphony: int
 //|     """Maximum polyphony of the synthesizer (read-only class property)"""
 //|
@@ -413,6 +479,8 @@ static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
     { MP_ROM_QSTR(MP_QSTR_blocks), MP_ROM_PTR(&synthio_synthesizer_blocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_midi_in), MP_ROM_PTR(&synthio_synthesizer_midi_in_obj) },
+    { MP_ROM_QSTR(MP_QSTR_midi_channel), MP_ROM_PTR(&synthio_synthesizer_midi_channel_obj) },
 };
 static MP_DEFINE_CONST_DICT(synthio_synthesizer_locals_dict, synthio_synthesizer_locals_dict_table);
 
@@ -25,4 +25,9 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self);
+mp_obj_t common_hal_synthio_synthesizer_get_midi_in(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_set_midi_in(synthio_synthesizer_obj_t *self, mp_obj_t midi_in);
+// channel is 0 to 15, or -1 for all channels.
+mp_int_t common_hal_synthio_synthesizer_get_midi_channel(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_set_midi_channel(synthio_synthesizer_obj_t *self, mp_int_t channel);
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out);
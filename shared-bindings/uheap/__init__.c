@@ -26,9 +26,46 @@ static mp_obj_t uheap_info(mp_obj_t obj) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(uheap_info_obj, uheap_info);
 
+//| def profile_start(every: int = 1) -> None:
+//|     """Start profiling heap allocations, discarding any previous samples.
+//|     Every ``every``-th allocation is attributed to the line of Python code
+//|     that made it. Only the most recent samples are kept."""
+//|     ...
+//|
+static mp_obj_t uheap_profile_start(size_t n_args, const mp_obj_t *args) {
+    mp_int_t every = n_args > 0 ? mp_arg_validate_int_min(mp_obj_get_int(args[0]), 1, MP_QSTR_every) : 1;
+    shared_module_uheap_profile_start(every);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(uheap_profile_start_obj, 0, 1, uheap_profile_start);
+
+//| def profile_stop() -> None:
+//|     """Stop profiling heap allocations. The samples taken so far are kept."""
+//|     ...
+//|
+static mp_obj_t uheap_profile_stop(void) {
+    shared_module_uheap_profile_stop();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(uheap_profile_stop_obj, uheap_profile_stop);
+
+//| def profile() -> Dict[Tuple[Optional[str], int], Tuple[int, int]]:
+//|     """Return a histogram of the sampled allocations, mapping each
+//|     ``(source_file, line)`` to ``(count, total_bytes)``. Allocations made
+//|     outside of Python code have a ``source_file`` of ``None``."""
+//|     ...
+//|
+static mp_obj_t uheap_profile(void) {
+    return shared_module_uheap_profile();
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(uheap_profile_obj, uheap_profile);
+
 static const mp_rom_map_elem_t uheap_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uheap) },
     { MP_ROM_QSTR(MP_QSTR_info), MP_ROM_PTR(&uheap_info_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_start), MP_ROM_PTR(&uheap_profile_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_stop), MP_ROM_PTR(&uheap_profile_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile), MP_ROM_PTR(&uheap_profile_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(uheap_module_globals, uheap_module_globals_table);
@@ -9,3 +9,6 @@
 #include "py/obj.h"
 
 extern uint32_t shared_module_uheap_info(mp_obj_t obj);
+extern void shared_module_uheap_profile_start(size_t every);
+extern void shared_module_uheap_profile_stop(void);
+extern mp_obj_t shared_module_uheap_profile(void);
@@ -184,6 +184,28 @@ static mp_obj_t usb_core_device_read(size_t n_args, const mp_obj_t *pos_args, mp
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_device_read_obj, 2, usb_core_device_read);
 
+//|     def submit(self, endpoint: int, buffer: WriteableBuffer) -> Transfer:
+//|         """Queue a transfer of the whole buffer on a bulk or interrupt endpoint
+//|         and return without waiting for it. The endpoint's direction bit picks
+//|         between reading into and writing from the buffer, which must not be
+//|         changed or resized until the transfer is done.
+//|
+//|         Transfers on one endpoint run in the order they were submitted, each
+//|         starting as soon as the one before it finishes. Queue several to keep
+//|         a streaming endpoint busy while Python handles earlier data.
+//|
+//|         :param int endpoint: the bEndpointAddress to transfer on
+//|         :param WriteableBuffer buffer: data to write or space to read into
+//|         :returns: the queued `Transfer`
+//|         """
+//|         ...
+static mp_obj_t usb_core_device_submit(mp_obj_t self_in, mp_obj_t endpoint_in, mp_obj_t buffer_in) {
+    usb_core_device_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t endpoint = mp_obj_get_int(endpoint_in);
+    return common_hal_usb_core_device_submit(self, endpoint, buffer_in);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_core_device_submit_obj, usb_core_device_submit);
+
 //|     def ctrl_transfer(
 //|         self,
 //|         bmRequestType: int,
@@ -302,6 +324,7 @@ static const mp_rom_map_elem_t usb_core_device_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_configuration), MP_ROM_PTR(&usb_core_device_set_configuration_obj) },
     { MP_ROM_QSTR(MP_QSTR_write),            MP_ROM_PTR(&usb_core_device_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_read),             MP_ROM_PTR(&usb_core_device_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_submit),           MP_ROM_PTR(&usb_core_device_submit_obj) },
     { MP_ROM_QSTR(MP_QSTR_ctrl_transfer),    MP_ROM_PTR(&usb_core_device_ctrl_transfer_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_is_kernel_driver_active), MP_ROM_PTR(&usb_core_device_is_kernel_driver_active_obj) },
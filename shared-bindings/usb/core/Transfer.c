@@ -0,0 +1,86 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/usb/core/Transfer.h"
+
+//| class Transfer:
+//|     """A bulk or interrupt transfer queued by `Device.submit()`.
+//|
+//|     It can be waited on, or polled from an async task so other tasks run
+//|     while the device is busy::
+//|
+//|         t = device.submit(0x81, buf)
+//|         while not t.done:
+//|             await asyncio.sleep(0)
+//|         n = t.wait()
+//|     """
+//|
+//|     def __init__(self) -> None:
+//|         """Transfers can't be created directly. Use `Device.submit()`."""
+//|         ...
+
+//|     done: bool
+//|     """True once the transfer has finished, failed or been cancelled. (read-only)"""
+static mp_obj_t usb_core_transfer_obj_get_done(mp_obj_t self_in) {
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_core_transfer_get_done(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_transfer_get_done_obj, usb_core_transfer_obj_get_done);
+
+MP_PROPERTY_GETTER(usb_core_transfer_done_obj,
+    (mp_obj_t)&usb_core_transfer_get_done_obj);
+
+//|     def wait(self, timeout: Optional[int] = None) -> int:
+//|         """Wait for the transfer to finish.
+//|
+//|         :param int timeout: Time to wait in milliseconds, or 0 or None to wait forever.
+//|             The transfer stays queued after a timeout.
+//|         :returns: the number of bytes transferred, 0 if it failed or was cancelled
+//|         """
+//|         ...
+static mp_obj_t usb_core_transfer_wait(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_timeout, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t timeout = 0;
+    if (args[ARG_timeout].u_obj != mp_const_none) {
+        timeout = mp_arg_validate_int_min(mp_obj_get_int(args[ARG_timeout].u_obj), 0, MP_QSTR_timeout);
+    }
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_core_transfer_wait(self, timeout));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_transfer_wait_obj, 1, usb_core_transfer_wait);
+
+//|     def cancel(self) -> None:
+//|         """Stop the transfer if it hasn't finished. Transfers queued after it
+//|         on the same endpoint still run."""
+//|         ...
+static mp_obj_t usb_core_transfer_cancel(mp_obj_t self_in) {
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_core_transfer_cancel(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_transfer_cancel_obj, usb_core_transfer_cancel);
+
+static const mp_rom_map_elem_t usb_core_transfer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_done),   MP_ROM_PTR(&usb_core_transfer_done_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait),   MP_ROM_PTR(&usb_core_transfer_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cancel), MP_ROM_PTR(&usb_core_transfer_cancel_obj) },
+};
+static MP_DEFINE_CONST_DICT(usb_core_transfer_locals_dict, usb_core_transfer_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    usb_core_transfer_type,
+    MP_QSTR_Transfer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &usb_core_transfer_locals_dict
+    );
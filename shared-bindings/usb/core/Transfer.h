@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/usb/core/Transfer.h"
+
+extern const mp_obj_type_t usb_core_transfer_type;
+
+bool common_hal_usb_core_transfer_get_done(usb_core_transfer_obj_t *self);
+mp_int_t common_hal_usb_core_transfer_wait(usb_core_transfer_obj_t *self, mp_int_t timeout);
+void common_hal_usb_core_transfer_cancel(usb_core_transfer_obj_t *self);
@@ -67,6 +67,10 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_cdc_disable_obj, usb_cdc_disable);
 //|     The number of available endpoints varies by microcontroller.
 //|     CircuitPython will go into safe mode after running boot.py to inform you if
 //|     not enough endpoints are available.
+//|
+//|     Each device buffers incoming and outgoing data in FIFOs whose sizes are fixed
+//|     when CircuitPython is built. A board can set ``USB_CDC_RX_BUFSIZE`` and
+//|     ``USB_CDC_TX_BUFSIZE`` in its ``mpconfigboard.mk`` to trade RAM for throughput.
 //|     """
 //|     ...
 //|
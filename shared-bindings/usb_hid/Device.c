@@ -145,11 +145,21 @@ static mp_obj_t usb_hid_device_make_new(const mp_obj_type_t *type, size_t n_args
 }
 
 
-//|     def send_report(self, report: ReadableBuffer, report_id: Optional[int] = None) -> None:
+//|     def send_report(
+//|         self, report: ReadableBuffer, report_id: Optional[int] = None, *, wait: bool = True
+//|     ) -> bool:
 //|         """Send an HID report. If the device descriptor specifies zero or one report id's,
 //|         you can supply `None` (the default) as the value of ``report_id``.
 //|         Otherwise you must specify which report id to use when sending the report.
 //|
+//|         If ``report_queue_depth`` was set in `usb_hid.enable()`, the report is queued and
+//|         sent when the host next polls, and `send_report()` waits only when the queue is full.
+//|         Otherwise it waits until the host has taken the previous report.
+//|         If ``wait`` is ``False``, it never waits, and returns ``False`` instead of sending the
+//|         report if it would have had to.
+//|
+//|         :return: ``True`` if the report was sent or queued, ``False`` if it was dropped
+//|
 //|         If the USB host is suspended (sleeping), then `send_report()` will request that the host wake up.
 //|         The ``report`` itself will be discarded, to prevent unwanted extraneous characters,
 //|         mouse clicks, etc.
@@ -164,10 +174,11 @@ static mp_obj_t usb_hid_device_make_new(const mp_obj_type_t *type, size_t n_args
 static mp_obj_t usb_hid_device_send_report(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     usb_hid_device_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_report, ARG_report_id };
+    enum { ARG_report, ARG_report_id, ARG_wait };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_report, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_report_id, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_wait, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -183,8 +194,8 @@ static mp_obj_t usb_hid_device_send_report(size_t n_args, const mp_obj_t *pos_ar
     }
     const uint8_t report_id = common_hal_usb_hid_device_validate_report_id(self, report_id_arg);
 
-    common_hal_usb_hid_device_send_report(self, ((uint8_t *)bufinfo.buf), bufinfo.len, report_id);
-    return mp_const_none;
+    return mp_obj_new_bool(common_hal_usb_hid_device_send_report(
+        self, ((uint8_t *)bufinfo.buf), bufinfo.len, report_id, args[ARG_wait].u_bool));
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_hid_device_send_report_obj, 1, usb_hid_device_send_report);
 
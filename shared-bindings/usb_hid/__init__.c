@@ -44,7 +44,13 @@ static mp_obj_t usb_hid_disable(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 
-//| def enable(devices: Optional[Sequence[Device]], boot_device: int = 0) -> None:
+//| def enable(
+//|     devices: Optional[Sequence[Device]],
+//|     boot_device: int = 0,
+//|     *,
+//|     report_queue_depth: int = 0,
+//|     poll_interval_us: Optional[int] = None,
+//| ) -> None:
 //|     """Specify which USB HID devices that will be available.
 //|     Can be called in ``boot.py``, before USB is connected.
 //|
@@ -57,6 +63,14 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 //|       If ``boot_device=1``, a boot keyboard is available.
 //|       If ``boot_device=2``, a boot mouse is available. No other values are allowed.
 //|       See below.
+//|     :param int report_queue_depth: Number of IN reports that `Device.send_report()` may queue
+//|       ahead of the host. With ``0``, the default, each report waits until the previous one has
+//|       been taken. Queued reports go out one per poll, so several reports per frame do not stall
+//|       Python. Up to 32 reports may be queued.
+//|     :param int poll_interval_us: How often the host should poll the HID endpoints, in microseconds.
+//|       The shortest interval the bus supports is 1000 on full speed USB and 125 on high speed USB.
+//|       The descriptor uses the longest interval the bus can express that is no longer than
+//|       this. ``None`` keeps the default of 8 frames.
 //|
 //|     If you enable too many devices at once, you will run out of USB endpoints.
 //|     The number of available endpoints varies by microcontroller.
@@ -90,10 +104,12 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 //|     ...
 //|
 static mp_obj_t usb_hid_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_devices, ARG_boot_device };
+    enum { ARG_devices, ARG_boot_device, ARG_report_queue_depth, ARG_poll_interval_us };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_devices, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_boot_device, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_report_queue_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_poll_interval_us, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -109,7 +125,17 @@ static mp_obj_t usb_hid_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     uint8_t boot_device =
         (uint8_t)mp_arg_validate_int_range(args[ARG_boot_device].u_int, 0, 2, MP_QSTR_boot_device);
 
-    if (!common_hal_usb_hid_enable(devices, boot_device)) {
+    uint8_t report_queue_depth =
+        (uint8_t)mp_arg_validate_int_range(args[ARG_report_queue_depth].u_int, 0, 32, MP_QSTR_report_queue_depth);
+
+    // 0 keeps the default interval.
+    uint32_t poll_interval_us = 0;
+    if (args[ARG_poll_interval_us].u_obj != mp_const_none) {
+        poll_interval_us = (uint32_t)mp_arg_validate_int_range(
+            mp_obj_get_int(args[ARG_poll_interval_us].u_obj), 125, 255000, MP_QSTR_poll_interval_us);
+    }
+
+    if (!common_hal_usb_hid_enable(devices, boot_device, report_queue_depth, poll_interval_us)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
     }
 
@@ -15,5 +15,5 @@ extern mp_obj_tuple_t common_hal_usb_hid_devices;
 void usb_hid_set_devices(mp_obj_t devices);
 
 bool common_hal_usb_hid_disable(void);
-bool common_hal_usb_hid_enable(const mp_obj_t devices_seq, uint8_t boot_device);
+bool common_hal_usb_hid_enable(const mp_obj_t devices_seq, uint8_t boot_device, uint8_t report_queue_depth, uint32_t poll_interval_us);
 uint8_t common_hal_usb_hid_get_boot_device(void);
@@ -0,0 +1,109 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared-bindings/usb_vendor/Bulk.h"
+#include "shared-bindings/util.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+//| class Bulk:
+//|     """A pair of raw USB bulk endpoints in a vendor specific interface.
+//|
+//|     Data moves in whole USB packets with no framing, line discipline or flow control
+//|     beyond what USB provides. Both directions are buffered by FIFOs that hold at least
+//|     two full packets, so the host can keep the bus busy while Python refills them."""
+//|
+//|     def __init__(self) -> None:
+//|         """You cannot create an instance of `usb_vendor.Bulk`.
+//|         Use `usb_vendor.bulk` once `usb_vendor.enable()` has been called in ``boot.py``."""
+//|         ...
+//|
+//|     def readinto(self, buf: WriteableBuffer) -> int:
+//|         """Copy bytes the host has sent into ``buf`` without waiting.
+//|
+//|         :return: the number of bytes stored, which may be 0
+//|         :rtype: int"""
+//|         ...
+//|
+static mp_obj_t usb_vendor_bulk_readinto(mp_obj_t self_in, mp_obj_t buf_in) {
+    usb_vendor_bulk_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_vendor_bulk_readinto(self, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_vendor_bulk_readinto_obj, usb_vendor_bulk_readinto);
+
+//|     def write(self, buf: ReadableBuffer) -> int:
+//|         """Queue as many bytes from ``buf`` as fit in the IN FIFO and start sending them,
+//|         without waiting. Pass a `memoryview` slice to send the remainder later
+//|         without copying.
+//|
+//|         :return: the number of bytes queued, which may be 0
+//|         :rtype: int"""
+//|         ...
+//|
+static mp_obj_t usb_vendor_bulk_write(mp_obj_t self_in, mp_obj_t buf_in) {
+    usb_vendor_bulk_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_vendor_bulk_write(self, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_vendor_bulk_write_obj, usb_vendor_bulk_write);
+
+//|     connected: bool
+//|     """True if the host has configured the device. (read-only)"""
+static mp_obj_t usb_vendor_bulk_get_connected(mp_obj_t self_in) {
+    usb_vendor_bulk_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_vendor_bulk_get_connected(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_vendor_bulk_get_connected_obj, usb_vendor_bulk_get_connected);
+
+MP_PROPERTY_GETTER(usb_vendor_bulk_connected_obj,
+    (mp_obj_t)&usb_vendor_bulk_get_connected_obj);
+
+//|     in_waiting: int
+//|     """Returns the number of bytes received from the host and not yet read. (read-only)"""
+static mp_obj_t usb_vendor_bulk_get_in_waiting(mp_obj_t self_in) {
+    usb_vendor_bulk_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(common_hal_usb_vendor_bulk_get_in_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_vendor_bulk_get_in_waiting_obj, usb_vendor_bulk_get_in_waiting);
+
+MP_PROPERTY_GETTER(usb_vendor_bulk_in_waiting_obj,
+    (mp_obj_t)&usb_vendor_bulk_get_in_waiting_obj);
+
+//|     out_waiting: int
+//|     """Returns the number of queued bytes the host has not yet taken. (read-only)"""
+//|
+static mp_obj_t usb_vendor_bulk_get_out_waiting(mp_obj_t self_in) {
+    usb_vendor_bulk_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(common_hal_usb_vendor_bulk_get_out_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_vendor_bulk_get_out_waiting_obj, usb_vendor_bulk_get_out_waiting);
+
+MP_PROPERTY_GETTER(usb_vendor_bulk_out_waiting_obj,
+    (mp_obj_t)&usb_vendor_bulk_get_out_waiting_obj);
+
+static const mp_rom_map_elem_t usb_vendor_bulk_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readinto),    MP_ROM_PTR(&usb_vendor_bulk_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write),       MP_ROM_PTR(&usb_vendor_bulk_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_connected),   MP_ROM_PTR(&usb_vendor_bulk_connected_obj) },
+    { MP_ROM_QSTR(MP_QSTR_in_waiting),  MP_ROM_PTR(&usb_vendor_bulk_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_out_waiting), MP_ROM_PTR(&usb_vendor_bulk_out_waiting_obj) },
+};
+static MP_DEFINE_CONST_DICT(usb_vendor_bulk_locals_dict, usb_vendor_bulk_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    usb_vendor_bulk_type,
+    MP_QSTR_Bulk,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &usb_vendor_bulk_locals_dict
+    );
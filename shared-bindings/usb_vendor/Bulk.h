@@ -0,0 +1,19 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/usb_vendor/Bulk.h"
+
+extern const mp_obj_type_t usb_vendor_bulk_type;
+
+extern size_t common_hal_usb_vendor_bulk_readinto(usb_vendor_bulk_obj_t *self, uint8_t *data, size_t len);
+extern size_t common_hal_usb_vendor_bulk_write(usb_vendor_bulk_obj_t *self, const uint8_t *data, size_t len);
+
+extern uint32_t common_hal_usb_vendor_bulk_get_in_waiting(usb_vendor_bulk_obj_t *self);
+extern uint32_t common_hal_usb_vendor_bulk_get_out_waiting(usb_vendor_bulk_obj_t *self);
+
+extern bool common_hal_usb_vendor_bulk_get_connected(usb_vendor_bulk_obj_t *self);
@@ -0,0 +1,83 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/usb_vendor/__init__.h"
+#include "shared-bindings/usb_vendor/Bulk.h"
+
+//| """Raw USB bulk endpoints
+//|
+//| The `usb_vendor` module presents a vendor specific USB interface with one bulk OUT
+//| and one bulk IN endpoint, for host software that talks to the device with libusb,
+//| WinUSB or similar instead of through a serial port.
+//|
+//| On Windows the interface must be bound to the WinUSB driver (for example with Zadig)
+//| before host software can open it.
+//| """
+//|
+//| bulk: Optional[Bulk]
+//| """The `Bulk` endpoint pair, or ``None`` if `usb_vendor` is not enabled.
+//| Note that the interface is *disabled* by default."""
+//|
+
+//| def disable() -> None:
+//|     """Do not present the bulk interface to the host.
+//|     Can be called in ``boot.py``, before USB is connected."""
+//|     ...
+//|
+static mp_obj_t usb_vendor_disable(void) {
+    if (!common_hal_usb_vendor_disable()) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(usb_vendor_disable_obj, usb_vendor_disable);
+
+//| def enable() -> None:
+//|     """Present the bulk interface to the host.
+//|     Can be called in ``boot.py``, before USB is connected.
+//|
+//|     The interface uses one IN and one OUT endpoint. If you enable too many devices
+//|     at once, you will run out of USB endpoints."""
+//|     ...
+//|
+static mp_obj_t usb_vendor_enable(void) {
+    if (!common_hal_usb_vendor_enable()) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(usb_vendor_enable_obj, usb_vendor_enable);
+
+// The usb_vendor module dict is mutable so that .bulk may
+// be set to a Bulk or to None depending on whether it is enabled or not.
+static mp_map_elem_t usb_vendor_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_usb_vendor) },
+    { MP_ROM_QSTR(MP_QSTR_Bulk),     MP_OBJ_FROM_PTR(&usb_vendor_bulk_type) },
+    { MP_ROM_QSTR(MP_QSTR_bulk),     mp_const_none },
+    { MP_ROM_QSTR(MP_QSTR_disable),  MP_OBJ_FROM_PTR(&usb_vendor_disable_obj) },
+    { MP_ROM_QSTR(MP_QSTR_enable),   MP_OBJ_FROM_PTR(&usb_vendor_enable_obj) },
+};
+
+static MP_DEFINE_MUTABLE_DICT(usb_vendor_module_globals, usb_vendor_module_globals_table);
+
+const mp_obj_module_t usb_vendor_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&usb_vendor_module_globals,
+};
+
+void usb_vendor_set_bulk(mp_obj_t bulk_obj) {
+    mp_map_elem_t *elem = mp_map_lookup(&usb_vendor_module_globals.map, MP_ROM_QSTR(MP_QSTR_bulk), MP_MAP_LOOKUP);
+    if (elem) {
+        elem->value = bulk_obj;
+    }
+}
+
+MP_REGISTER_MODULE(MP_QSTR_usb_vendor, usb_vendor_module);
@@ -0,0 +1,14 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/usb_vendor/__init__.h"
+
+void usb_vendor_set_bulk(mp_obj_t bulk_obj);
+
+extern bool common_hal_usb_vendor_disable(void);
+extern bool common_hal_usb_vendor_enable(void);
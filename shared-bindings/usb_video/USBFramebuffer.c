@@ -4,8 +4,11 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/enum.h"
 #include "py/obj.h"
 #include "py/objproperty.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/__init__.h"
 
 #include "shared-bindings/usb_video/__init__.h"
 #include "shared-bindings/usb_video/USBFramebuffer.h"
@@ -77,8 +80,87 @@ MP_DEFINE_CONST_FUN_OBJ_1(usb_video_uvcframebuffer_get_height_obj, usb_video_uvc
 MP_PROPERTY_GETTER(usb_video_uvcframebuffer_height_obj,
     (mp_obj_t)&usb_video_uvcframebuffer_get_height_obj);
 
+//|     def send(
+//|         self,
+//|         frame: Union[ReadableBuffer, displayio.Bitmap],
+//|         *,
+//|         colorspace: Optional[displayio.Colorspace] = None,
+//|     ) -> None:
+//|         """Send one frame instead of the contents of the framebuffer, without
+//|         copying it into the framebuffer first.
+//|
+//|         A buffer must hold a whole frame in YUY2 format, 2×``width``×``height``
+//|         bytes, such as an image from a camera set to YUV422. It is sent as it is,
+//|         so it must not be changed until `busy` is False.
+//|
+//|         A `displayio.Bitmap` must be ``width`` by ``height`` with 16 bits per
+//|         value, in the ``RGB565`` or ``RGB565_SWAPPED`` colorspace. It is converted
+//|         straight into the frame that is sent next, so it can be changed as soon
+//|         as this returns.
+//|
+//|         Waits until the previous frame passed to `send` has been sent. Does
+//|         nothing if the host is not receiving video.
+//|
+//|         The framebuffer is sent again after it is next refreshed.
+//|
+//|         :param frame: The frame to send
+//|         :param displayio.Colorspace colorspace: The colorspace of a Bitmap.
+//|           Defaults to ``RGB565_SWAPPED``, the format of the framebuffer and of `jpegio`."""
+//|         ...
+//|
+static mp_obj_t usb_video_uvcframebuffer_send(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_frame, ARG_colorspace };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_frame, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_colorspace, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    usb_video_uvcframebuffer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    int width = shared_module_usb_video_uvcframebuffer_get_width(self);
+    int height = shared_module_usb_video_uvcframebuffer_get_height(self);
+    mp_obj_t frame = args[ARG_frame].u_obj;
+    if (mp_obj_is_type(frame, &displayio_bitmap_type)) {
+        displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(frame);
+        mp_arg_validate_int(common_hal_displayio_bitmap_get_width(bitmap), width, MP_QSTR_width);
+        mp_arg_validate_int(common_hal_displayio_bitmap_get_height(bitmap), height, MP_QSTR_height);
+        mp_arg_validate_int(common_hal_displayio_bitmap_get_bits_per_value(bitmap), 16, MP_QSTR_bits_per_value);
+        displayio_colorspace_t colorspace = DISPLAYIO_COLORSPACE_RGB565_SWAPPED;
+        if (args[ARG_colorspace].u_obj != mp_const_none) {
+            colorspace = (displayio_colorspace_t)cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+        }
+        if (colorspace != DISPLAYIO_COLORSPACE_RGB565 && colorspace != DISPLAYIO_COLORSPACE_RGB565_SWAPPED) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_colorspace);
+        }
+        shared_module_usb_video_send_bitmap(bitmap, colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED);
+    } else {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(frame, &bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length(bufinfo.len, 2 * width * height, MP_QSTR_frame);
+        shared_module_usb_video_send(frame, bufinfo.buf);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_video_uvcframebuffer_send_obj, 1, usb_video_uvcframebuffer_send);
+
+//|     busy: bool
+//|     """True while a buffer passed to `send` is waiting to be sent or being sent. (read-only)"""
+//|
+static mp_obj_t usb_video_uvcframebuffer_get_busy(mp_obj_t self_in) {
+    (void)self_in;
+    return mp_obj_new_bool(shared_module_usb_video_get_busy());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_video_uvcframebuffer_get_busy_obj, usb_video_uvcframebuffer_get_busy);
+
+MP_PROPERTY_GETTER(usb_video_uvcframebuffer_busy_obj,
+    (mp_obj_t)&usb_video_uvcframebuffer_get_busy_obj);
+
 static const mp_rom_map_elem_t usb_video_uvcframebuffer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&usb_video_uvcframebuffer_busy_obj) },
     { MP_ROM_QSTR(MP_QSTR_refresh), MP_ROM_PTR(&usb_video_uvcframebuffer_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&usb_video_uvcframebuffer_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&usb_video_uvcframebuffer_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&usb_video_uvcframebuffer_height_obj) },
 };
@@ -91,8 +173,7 @@ static void usb_video_uvcframebuffer_get_bufinfo(mp_obj_t self_in, mp_buffer_inf
 // These version exists so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 static void usb_video_uvcframebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
-    shared_module_usb_video_uvcframebuffer_refresh(self_in);
+    shared_module_usb_video_uvcframebuffer_swapbuffers(self_in, dirty_row_bitmap);
 }
 
 static void usb_video_uvcframebuffer_deinit_proto(mp_obj_t self_in) {
@@ -108,7 +189,7 @@ static int usb_video_uvcframebuffer_get_height_proto(mp_obj_t self_in) {
 }
 
 static int usb_video_uvcframebuffer_get_native_frames_per_second_proto(mp_obj_t self_in) {
-    return 10;
+    return shared_module_usb_video_uvcframebuffer_get_frame_rate(self_in);
 }
 
 static bool usb_video_uvcframebuffer_get_reverse_pixels_in_word_proto(mp_obj_t self_in) {
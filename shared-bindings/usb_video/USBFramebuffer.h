@@ -13,5 +13,7 @@ extern usb_video_uvcframebuffer_obj_t usb_video_uvcframebuffer_singleton_obj;
 
 void shared_module_usb_video_uvcframebuffer_get_bufinfo(usb_video_uvcframebuffer_obj_t *self, mp_buffer_info_t *bufinfo);
 void shared_module_usb_video_uvcframebuffer_refresh(usb_video_uvcframebuffer_obj_t *self);
+void shared_module_usb_video_uvcframebuffer_swapbuffers(usb_video_uvcframebuffer_obj_t *self, uint8_t *dirty_row_bitmap);
+int shared_module_usb_video_uvcframebuffer_get_frame_rate(usb_video_uvcframebuffer_obj_t *self);
 int shared_module_usb_video_uvcframebuffer_get_width(usb_video_uvcframebuffer_obj_t *self);
 int shared_module_usb_video_uvcframebuffer_get_height(usb_video_uvcframebuffer_obj_t *self);
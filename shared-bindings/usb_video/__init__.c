@@ -47,7 +47,9 @@
 //| versions of CircuitPython."""
 //|
 
-//| def enable_framebuffer(width: int, height: int) -> None:
+//| def enable_framebuffer(
+//|     width: int, height: int, *, frame_rate: int = 10, double_buffered: bool = False
+//| ) -> None:
 //|     """Enable a USB video framebuffer, setting the given width & height
 //|
 //|     This function may only be used from ``boot.py``.
@@ -57,14 +59,20 @@
 //|     After boot.py completes, the framebuffer will be allocated. Total storage
 //|     of 4×``width``×``height`` bytes is required, reducing the amount available
 //|     for Python objects. If the allocation fails, a MemoryError is raised.
-//|     This message can be seen in ``boot_out.txt``."""
+//|     This message can be seen in ``boot_out.txt``.
+//|
+//|     :param int frame_rate: The frame rate offered to the host, from 1 to 60 frames per second
+//|     :param bool double_buffered: Prepare each frame while the previous one is
+//|       being sent. This takes another 2×``width``×``height`` bytes."""
 //|
 
 static mp_obj_t usb_video_enable_framebuffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_width, ARG_height };
+    enum { ARG_width, ARG_height, ARG_frame_rate, ARG_double_buffered };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
         { MP_QSTR_height, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_frame_rate, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 10 } },
+        { MP_QSTR_double_buffered, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -72,7 +80,8 @@ static mp_obj_t usb_video_enable_framebuffer(size_t n_args, const mp_obj_t *pos_
     // (but note that most devices will not be able to allocate this much memory.
     uint32_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 0, 32767, MP_QSTR_width);
     uint32_t height = mp_arg_validate_int_range(args[ARG_height].u_int, 0, 32767, MP_QSTR_height);
-    if (!shared_module_usb_video_enable(width, height)) {
+    uint32_t frame_rate = mp_arg_validate_int_range(args[ARG_frame_rate].u_int, 1, 60, MP_QSTR_frame_rate);
+    if (!shared_module_usb_video_enable(width, height, frame_rate, args[ARG_double_buffered].u_bool)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
     }
 
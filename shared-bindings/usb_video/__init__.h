@@ -7,6 +7,10 @@
 #pragma once
 
 #include "shared-module/displayio/Bitmap.h"
-bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height);
+bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height, mp_int_t frame_rate, bool double_buffered);
 bool shared_module_usb_video_disable(void);
-void shared_module_usb_video_swapbuffers(void);
+// dirty_row_bitmap has one bit per row, or is NULL if every row changed.
+void shared_module_usb_video_swapbuffers(const uint8_t *dirty_row_bitmap);
+void shared_module_usb_video_send(mp_obj_t frame_obj, const uint8_t *frame);
+void shared_module_usb_video_send_bitmap(displayio_bitmap_t *bitmap, bool swapped);
+bool shared_module_usb_video_get_busy(void);
@@ -50,6 +50,74 @@ static mp_obj_t stack_usage(void) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(stack_usage_obj, stack_usage);
 
+#if MICROPY_ENABLE_PYSTACK
+#if MICROPY_MAX_STACK_USAGE
+//| def max_pystack_usage() -> int:
+//|     """Return the most pystack used since the VM started. Compare with
+//|     `pystack_size()` to choose ``CIRCUITPY_PYSTACK_SIZE``."""
+//|     ...
+//|
+static mp_obj_t max_pystack_usage(void) {
+    return MP_OBJ_NEW_SMALL_INT(shared_module_ustack_max_pystack_usage());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(max_pystack_usage_obj, max_pystack_usage);
+#endif // MICROPY_MAX_STACK_USAGE
+
+//| def pystack_size() -> int:
+//|     """Return the size of the pystack, which holds the frames of Python
+//|     function calls."""
+//|     ...
+//|
+static mp_obj_t pystack_size(void) {
+    return MP_OBJ_NEW_SMALL_INT(shared_module_ustack_pystack_size());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(pystack_size_obj, pystack_size);
+
+//| def pystack_usage() -> int:
+//|     """Return how much pystack is currently in use."""
+//|     ...
+//|
+static mp_obj_t pystack_usage(void) {
+    return MP_OBJ_NEW_SMALL_INT(shared_module_ustack_pystack_usage());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(pystack_usage_obj, pystack_usage);
+#endif // MICROPY_ENABLE_PYSTACK
+
+//| def profile_start() -> None:
+//|     """Start profiling stack depth, discarding any previous results. Every
+//|     call to a Python function notes how much stack and pystack were in use
+//|     once the function was entered, and the deepest of each is kept per
+//|     function. Calls are a little slower while profiling."""
+//|     ...
+//|
+static mp_obj_t ustack_profile_start(void) {
+    shared_module_ustack_profile_start();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(ustack_profile_start_obj, ustack_profile_start);
+
+//| def profile_stop() -> None:
+//|     """Stop profiling stack depth. The results so far are kept."""
+//|     ...
+//|
+static mp_obj_t ustack_profile_stop(void) {
+    shared_module_ustack_profile_stop();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(ustack_profile_stop_obj, ustack_profile_stop);
+
+//| def profile() -> List[Tuple[Optional[str], Optional[str], int, int]]:
+//|     """Return ``(source_file, function_name, max_stack, max_pystack)`` for
+//|     each function called while profiling, deepest stack first. Functions
+//|     that didn't fit in the profiler's table are combined into one last
+//|     entry with a ``source_file`` and ``function_name`` of ``None``."""
+//|     ...
+//|
+static mp_obj_t ustack_profile(void) {
+    return shared_module_ustack_profile();
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(ustack_profile_obj, ustack_profile);
+
 static const mp_rom_map_elem_t ustack_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_ustack) },
     #if MICROPY_MAX_STACK_USAGE
@@ -57,6 +125,16 @@ static const mp_rom_map_elem_t ustack_module_globals_table[] = {
     #endif
     { MP_ROM_QSTR(MP_QSTR_stack_size), MP_ROM_PTR(&stack_size_obj) },
     { MP_ROM_QSTR(MP_QSTR_stack_usage), MP_ROM_PTR(&stack_usage_obj) },
+    #if MICROPY_ENABLE_PYSTACK
+    #if MICROPY_MAX_STACK_USAGE
+    { MP_ROM_QSTR(MP_QSTR_max_pystack_usage), MP_ROM_PTR(&max_pystack_usage_obj) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_pystack_size), MP_ROM_PTR(&pystack_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pystack_usage), MP_ROM_PTR(&pystack_usage_obj) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_profile_start), MP_ROM_PTR(&ustack_profile_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_stop), MP_ROM_PTR(&ustack_profile_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile), MP_ROM_PTR(&ustack_profile_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(ustack_module_globals, ustack_module_globals_table);
@@ -13,3 +13,15 @@ extern uint32_t shared_module_ustack_max_stack_usage(void);
 #endif
 extern uint32_t shared_module_ustack_stack_size(void);
 extern uint32_t shared_module_ustack_stack_usage(void);
+
+#if MICROPY_ENABLE_PYSTACK
+#if MICROPY_MAX_STACK_USAGE
+extern uint32_t shared_module_ustack_max_pystack_usage(void);
+#endif
+extern uint32_t shared_module_ustack_pystack_size(void);
+extern uint32_t shared_module_ustack_pystack_usage(void);
+#endif
+
+extern void shared_module_ustack_profile_start(void);
+extern void shared_module_ustack_profile_stop(void);
+extern mp_obj_t shared_module_ustack_profile(void);
@@ -26,6 +26,10 @@
 //|
 //|     A lock up is detected when the watchdog hasn't been fed after a given duration. So, make
 //|     sure to call `feed` within the timeout.
+//|
+//|     Some long operations feed the watchdog themselves for as long as they keep making
+//|     progress, so the timeout doesn't need to cover them. These are `os.sync`,
+//|     `storage.erase_filesystem` and the TLS handshake in `ssl.SSLSocket.connect`.
 //|     """
 //|
 
@@ -0,0 +1,49 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/enum.h"
+
+#include "shared-bindings/wifi/PowerManagement.h"
+
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, NONE, POWER_MANAGEMENT_NONE);
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, MIN, POWER_MANAGEMENT_MIN);
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, MAX, POWER_MANAGEMENT_MAX);
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, UNKNOWN, POWER_MANAGEMENT_UNKNOWN);
+
+//| class PowerManagement:
+//|     """Power-saving options for wifi
+//|
+//|     .. note:: On boards using the CYW43 radio module, setting
+//|               `PowerManagement.MIN` is the same as `cyw43.PM_STANDARD`,
+//|               `PowerManagement.MAX` is the same as `cyw43.PM_AGGRESSIVE`, and
+//|               `PowerManagement.NONE` is the same as `cyw43.PM_DISABLED`. A custom value
+//|               set with `cyw43.set_power_management()` reads back as the closest of the three.
+//|     """
+//|
+//|     MIN: PowerManagement
+//|     """The radio sleeps between beacons and wakes for every DTIM period."""
+//|
+//|     MAX: PowerManagement
+//|     """The radio sleeps for longer, waking every `Radio.listen_interval` DTIM periods.
+//|     This saves the most power but adds the most latency."""
+//|
+//|     NONE: PowerManagement
+//|     """The radio stays awake. Lowest latency, highest power use."""
+//|
+//|     UNKNOWN: PowerManagement
+//|     """The power management setting could not be determined."""
+//|
+MAKE_ENUM_MAP(wifi_power_management) {
+    MAKE_ENUM_MAP_ENTRY(power_management, NONE),
+    MAKE_ENUM_MAP_ENTRY(power_management, MIN),
+    MAKE_ENUM_MAP_ENTRY(power_management, MAX),
+    MAKE_ENUM_MAP_ENTRY(power_management, UNKNOWN),
+};
+static MP_DEFINE_CONST_DICT(wifi_power_management_locals_dict, wifi_power_management_locals_table);
+
+MAKE_PRINTER(wifi, wifi_power_management);
+
+MAKE_ENUM_TYPE(wifi, PowerManagement, wifi_power_management);
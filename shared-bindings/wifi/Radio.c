@@ -214,6 +214,72 @@ MP_PROPERTY_GETSET(wifi_radio_listen_interval_obj,
     (mp_obj_t)&wifi_radio_get_listen_interval_obj,
     (mp_obj_t)&wifi_radio_set_listen_interval_obj);
 
+//|     power_management: PowerManagement
+//|     """Wifi power management setting. See `wifi.PowerManagement`. The default is `wifi.PowerManagement.MIN`
+//|     on Espressif boards and `wifi.PowerManagement.NONE` on CYW43 boards.
+//|     """
+static mp_obj_t wifi_radio_get_power_management(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&wifi_power_management_type, common_hal_wifi_radio_get_power_management(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_power_management_obj, wifi_radio_get_power_management);
+
+static mp_obj_t wifi_radio_set_power_management(mp_obj_t self_in, mp_obj_t power_management_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    wifi_power_management_t power_management =
+        cp_enum_value(&wifi_power_management_type, power_management_in, MP_QSTR_power_management);
+    if (power_management == POWER_MANAGEMENT_UNKNOWN) {
+        mp_arg_error_invalid(MP_QSTR_power_management);
+    }
+    common_hal_wifi_radio_set_power_management(self, power_management);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_radio_set_power_management_obj, wifi_radio_set_power_management);
+
+MP_PROPERTY_GETSET(wifi_radio_power_management_obj,
+    (mp_obj_t)&wifi_radio_get_power_management_obj,
+    (mp_obj_t)&wifi_radio_set_power_management_obj);
+
+//|     def stay_awake(self, duration: float) -> None:
+//|         """Turn power saving off for ``duration`` seconds, for a burst of low latency
+//|         traffic, and then go back to `power_management`. Calling it again restarts the
+//|         time, and a ``duration`` of 0 goes back right away."""
+//|         ...
+//|
+static mp_obj_t wifi_radio_stay_awake(mp_obj_t self_in, mp_obj_t duration_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_float_t duration = mp_arg_validate_obj_float_non_negative(duration_in, 0, MP_QSTR_duration);
+    common_hal_wifi_radio_stay_awake(self, (uint32_t)(duration * 1000));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_radio_stay_awake_obj, wifi_radio_stay_awake);
+
+//|     awake_time: float
+//|     """Seconds the radio has spent with power saving off, from `PowerManagement.NONE`
+//|     or `stay_awake()`, since wifi was last reset. (read-only)"""
+static mp_obj_t wifi_radio_get_awake_time(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_wifi_radio_get_awake_time_ms(self) / MICROPY_FLOAT_CONST(1000.0));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_awake_time_obj, wifi_radio_get_awake_time);
+
+MP_PROPERTY_GETTER(wifi_radio_awake_time_obj,
+    (mp_obj_t)&wifi_radio_get_awake_time_obj);
+
+//|     beacon_timeouts: int
+//|     """How many times the station missed enough beacons from its access point to
+//|     count as a beacon timeout, since wifi was last reset. A count that climbs after
+//|     raising `listen_interval` means the radio is sleeping through too much.
+//|     Always 0 on CYW43 boards, which don't report it. (read-only)"""
+static mp_obj_t wifi_radio_get_beacon_timeouts(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_wifi_radio_get_beacon_timeouts(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_beacon_timeouts_obj, wifi_radio_get_beacon_timeouts);
+
+MP_PROPERTY_GETTER(wifi_radio_beacon_timeouts_obj,
+    (mp_obj_t)&wifi_radio_get_beacon_timeouts_obj);
+
 //|     mac_address_ap: ReadableBuffer
 //|     """MAC address for the AP. When the address is altered after interface is started
 //|        the changes would only be reflected once the interface restarts.
@@ -821,6 +887,11 @@ static const mp_rom_map_elem_t wifi_radio_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_mac_address_ap), MP_ROM_PTR(&wifi_radio_mac_address_ap_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_tx_power), MP_ROM_PTR(&wifi_radio_tx_power_obj) },
+    { MP_ROM_QSTR(MP_QSTR_listen_interval), MP_ROM_PTR(&wifi_radio_listen_interval_obj) },
+    { MP_ROM_QSTR(MP_QSTR_power_management), MP_ROM_PTR(&wifi_radio_power_management_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stay_awake), MP_ROM_PTR(&wifi_radio_stay_awake_obj) },
+    { MP_ROM_QSTR(MP_QSTR_awake_time), MP_ROM_PTR(&wifi_radio_awake_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_beacon_timeouts), MP_ROM_PTR(&wifi_radio_beacon_timeouts_obj) },
     { MP_ROM_QSTR(MP_QSTR_start_scanning_networks),    MP_ROM_PTR(&wifi_radio_start_scanning_networks_obj) },
     { MP_ROM_QSTR(MP_QSTR_stop_scanning_networks),    MP_ROM_PTR(&wifi_radio_stop_scanning_networks_obj) },
 
@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include "common-hal/wifi/Radio.h"
+#include "shared-bindings/wifi/PowerManagement.h"
 
 #include "py/objstr.h"
 #include "py/objnamedtuple.h"
@@ -78,6 +79,12 @@ extern void common_hal_wifi_radio_set_tx_power(wifi_radio_obj_t *self, const mp_
 extern void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, const mp_int_t listen_interval);
 extern mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self);
 
+extern wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self);
+extern void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management);
+extern void common_hal_wifi_radio_stay_awake(wifi_radio_obj_t *self, uint32_t duration_ms);
+extern uint64_t common_hal_wifi_radio_get_awake_time_ms(wifi_radio_obj_t *self);
+extern uint32_t common_hal_wifi_radio_get_beacon_timeouts(wifi_radio_obj_t *self);
+
 extern mp_obj_t common_hal_wifi_radio_start_scanning_networks(wifi_radio_obj_t *self, uint8_t start_channel, uint8_t stop_channel);
 extern void common_hal_wifi_radio_stop_scanning_networks(wifi_radio_obj_t *self);
 
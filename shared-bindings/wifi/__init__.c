@@ -4,11 +4,13 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/objmodule.h"
 #include "shared-bindings/wifi/__init__.h"
 #include "shared-bindings/wifi/AuthMode.h"
 #include "shared-bindings/wifi/Network.h"
 #include "shared-bindings/wifi/Monitor.h"
 #include "shared-bindings/wifi/Packet.h"
+#include "shared-bindings/wifi/PowerManagement.h"
 #include "shared-bindings/wifi/Radio.h"
 
 //| """
@@ -20,7 +22,8 @@
 //| """Wifi radio used to manage both station and AP modes.
 //| This object is the sole instance of `wifi.Radio`."""
 
-// Called when wifi is imported.
+// Called when wifi is imported, or when it's first used if built-in modules
+// are initialised lazily.
 static mp_obj_t wifi___init__(void) {
     common_hal_wifi_init(true);
     return mp_const_none;
@@ -32,13 +35,14 @@ static const mp_rom_map_elem_t wifi_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__),    MP_ROM_QSTR(MP_QSTR_wifi) },
 
     // Initialization
-    { MP_ROM_QSTR(MP_QSTR___init__),    MP_ROM_PTR(&wifi___init___obj) },
+    { MP_ROM_QSTR(MP_QSTR_MODULE_INIT), MP_ROM_PTR(&wifi___init___obj) },
 
     // Classes
     { MP_ROM_QSTR(MP_QSTR_AuthMode),    MP_ROM_PTR(&wifi_authmode_type) },
     { MP_ROM_QSTR(MP_QSTR_Monitor),     MP_ROM_PTR(&wifi_monitor_type) },
     { MP_ROM_QSTR(MP_QSTR_Network),     MP_ROM_PTR(&wifi_network_type) },
     { MP_ROM_QSTR(MP_QSTR_Packet),      MP_ROM_PTR(&wifi_packet_type) },
+    { MP_ROM_QSTR(MP_QSTR_PowerManagement), MP_ROM_PTR(&wifi_power_management_type) },
     { MP_ROM_QSTR(MP_QSTR_Radio),       MP_ROM_PTR(&wifi_radio_type) },
     { MP_ROM_QSTR(MP_QSTR_Station),     MP_ROM_PTR(&wifi_radio_station_type) },
 
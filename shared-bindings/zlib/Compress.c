@@ -0,0 +1,55 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Compress.h"
+
+//| class Compress:
+//|     """Compresses data in pieces. Created by `zlib.compressobj()`."""
+//|
+//|     def compress(self, data: ReadableBuffer) -> bytes:
+//|         """Compress *data*, returning the compressed data that is ready so far.
+//|         The rest is returned by later calls and by `flush()`."""
+//|         ...
+//|
+static mp_obj_t zlib_compress_compress(mp_obj_t self_in, mp_obj_t data) {
+    zlib_compress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    vstr_t vstr;
+    vstr_init(&vstr, bufinfo.len / 2 + 16);
+    common_hal_zlib_compress_compress(self, bufinfo.buf, bufinfo.len, &vstr);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(zlib_compress_compress_obj, zlib_compress_compress);
+
+//|     def flush(self) -> bytes:
+//|         """Finish the compressed stream and return the rest of it. The object can't
+//|         be used after this, and its buffers are freed."""
+//|         ...
+//|
+static mp_obj_t zlib_compress_flush(mp_obj_t self_in) {
+    zlib_compress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    vstr_t vstr;
+    vstr_init(&vstr, 16);
+    common_hal_zlib_compress_flush(self, &vstr);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(zlib_compress_flush_obj, zlib_compress_flush);
+
+static const mp_rom_map_elem_t zlib_compress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&zlib_compress_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_compress_flush_obj) },
+};
+static MP_DEFINE_CONST_DICT(zlib_compress_locals_dict, zlib_compress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_compress_type,
+    MP_QSTR_Compress,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &zlib_compress_locals_dict
+    );
@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/zlib/Compress.h"
+
+extern const mp_obj_type_t zlib_compress_type;
+
+void common_hal_zlib_compress_construct(zlib_compress_obj_t *self, mp_int_t level, mp_int_t wbits, mp_int_t mem_level);
+void common_hal_zlib_compress_compress(zlib_compress_obj_t *self, const uint8_t *data, size_t len, vstr_t *out);
+void common_hal_zlib_compress_flush(zlib_compress_obj_t *self, vstr_t *out);
@@ -0,0 +1,114 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Decompress.h"
+
+//| class Decompress:
+//|     """Decompresses a stream in pieces. Created by `zlib.decompressobj()`.
+//|
+//|     Input can be split anywhere. Input that ends partway through a DEFLATE
+//|     symbol is kept and decoded when more arrives."""
+//|
+//|     def decompress(self, data: ReadableBuffer, max_length: int = 0) -> bytes:
+//|         """Decompress *data*, returning as much of the decompressed data as is ready.
+//|
+//|         :param ReadableBuffer data: the next piece of the compressed stream
+//|         :param int max_length: if not zero, return at most this many bytes. The input
+//|           that was not used is put in `unconsumed_tail` and must be passed to the next
+//|           call. This bounds the memory used for each piece of output.
+//|         """
+//|         ...
+//|
+static mp_obj_t zlib_decompress_decompress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_max_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_max_length, MP_ARG_INT, {.u_int = 0} },
+    };
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    mp_int_t max_length = mp_arg_validate_int_min(args[ARG_max_length].u_int, 0, MP_QSTR_max_length);
+
+    vstr_t vstr;
+    vstr_init(&vstr, max_length > 0 ? (size_t)max_length : bufinfo.len * 2 + 16);
+    common_hal_zlib_decompress_decompress(self, bufinfo.buf, bufinfo.len, max_length, &vstr);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompress_decompress_obj, 1, zlib_decompress_decompress);
+
+//|     def flush(self) -> bytes:
+//|         """Return any decompressed data that is left. Unlike CPython this does not
+//|         process `unconsumed_tail`; pass it to `decompress()` instead."""
+//|         ...
+//|
+static mp_obj_t zlib_decompress_flush(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    vstr_t vstr;
+    vstr_init(&vstr, 16);
+    common_hal_zlib_decompress_decompress(self, NULL, 0, 0, &vstr);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_flush_obj, zlib_decompress_flush);
+
+//|     eof: bool
+//|     """True once the end of the compressed stream has been reached. (read-only)"""
+//|
+static mp_obj_t zlib_decompress_get_eof(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->eof);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_eof_obj, zlib_decompress_get_eof);
+
+MP_PROPERTY_GETTER(zlib_decompress_eof_obj,
+    (mp_obj_t)&zlib_decompress_get_eof_obj);
+
+//|     unconsumed_tail: bytes
+//|     """Input left over from the last `decompress()` call because *max_length*
+//|     was reached. (read-only)"""
+//|
+static mp_obj_t zlib_decompress_get_unconsumed_tail(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->unconsumed_tail;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_unconsumed_tail_obj, zlib_decompress_get_unconsumed_tail);
+
+MP_PROPERTY_GETTER(zlib_decompress_unconsumed_tail_obj,
+    (mp_obj_t)&zlib_decompress_get_unconsumed_tail_obj);
+
+//|     unused_data: bytes
+//|     """Input found after the end of the compressed stream. (read-only)"""
+//|
+static mp_obj_t zlib_decompress_get_unused_data(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->unused_data;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_unused_data_obj, zlib_decompress_get_unused_data);
+
+MP_PROPERTY_GETTER(zlib_decompress_unused_data_obj,
+    (mp_obj_t)&zlib_decompress_get_unused_data_obj);
+
+static const mp_rom_map_elem_t zlib_decompress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_decompress_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_eof), MP_ROM_PTR(&zlib_decompress_eof_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unconsumed_tail), MP_ROM_PTR(&zlib_decompress_unconsumed_tail_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unused_data), MP_ROM_PTR(&zlib_decompress_unused_data_obj) },
+};
+static MP_DEFINE_CONST_DICT(zlib_decompress_locals_dict, zlib_decompress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_decompress_type,
+    MP_QSTR_Decompress,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &zlib_decompress_locals_dict
+    );
@@ -18,14 +18,121 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Compress.h"
+#include "shared-bindings/zlib/Decompress.h"
 
-//| """zlib decompression functionality
+//| """zlib compression and decompression functionality
 //|
 //| The `zlib` module allows limited functionality similar to the CPython zlib library.
-//| This module allows to decompress binary data compressed with DEFLATE algorithm
-//| (commonly used in zlib library and gzip archiver). Compression is not yet implemented."""
+//| This module allows to compress and decompress binary data with the DEFLATE algorithm
+//| (commonly used in zlib library and gzip archiver). Compressed output uses only the
+//| fixed Huffman codes, so it is larger than CPython's for the same level."""
 //|
 
+// Positive wbits is zlib format, negative is raw DEFLATE, and 16 more is gzip.
+static mp_int_t validate_wbits(mp_int_t wbits) {
+    mp_int_t bits = wbits < 0 ? -wbits : (wbits > 16 ? wbits - 16 : wbits);
+    if (bits < 9 || bits > 15) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_wbits);
+    }
+    return wbits;
+}
+
+static mp_obj_t make_compress(mp_int_t level, mp_int_t wbits, mp_int_t mem_level) {
+    mp_arg_validate_int_range(level, -1, 9, MP_QSTR_level);
+    mp_arg_validate_int_range(mem_level, 1, 9, MP_QSTR_memLevel);
+    zlib_compress_obj_t *self = mp_obj_malloc(zlib_compress_obj_t, &zlib_compress_type);
+    common_hal_zlib_compress_construct(self, level, validate_wbits(wbits), mem_level);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//| def compress(data: ReadableBuffer, /, level: int = -1, wbits: int = 15) -> bytes:
+//|     """Return *data* compressed.
+//|
+//|     :param ReadableBuffer data: data to be compressed
+//|     :param int level: 0 (no matching, fastest) to 9 (slowest, smallest output), or -1 for
+//|       the default of 6. Higher levels search longer chains of earlier matches.
+//|     :param int wbits: window size and format, as for `decompress()`: 9 to 15 for zlib
+//|       format, -9 to -15 for raw DEFLATE, and 25 to 31 for gzip format
+//|     """
+//|     ...
+//|
+static mp_obj_t zlib_compress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_level, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_level, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 15} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    zlib_compress_obj_t *self = MP_OBJ_TO_PTR(make_compress(args[ARG_level].u_int, args[ARG_wbits].u_int, 8));
+    vstr_t vstr;
+    vstr_init(&vstr, bufinfo.len / 2 + 32);
+    common_hal_zlib_compress_compress(self, bufinfo.buf, bufinfo.len, &vstr);
+    common_hal_zlib_compress_flush(self, &vstr);
+    m_del_obj(zlib_compress_obj_t, self);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_compress_obj, 1, zlib_compress);
+
+//| def compressobj(level: int = -1, method: int = 8, wbits: int = 15, memLevel: int = 8) -> Compress:
+//|     """Return a `Compress` object, to compress a stream that doesn't fit in memory at once.
+//|
+//|     :param int level: as for `compress()`
+//|     :param int method: must be 8 (DEFLATE)
+//|     :param int wbits: as for `compress()`. The object uses 4 << wbits bytes for the window
+//|       and its hash chains.
+//|     :param int memLevel: 1 to 9. The hash table has 1 << (memLevel + 3) entries.
+//|     """
+//|     ...
+//|
+static mp_obj_t zlib_compressobj(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_level, ARG_method, ARG_wbits, ARG_memLevel };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_level, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_method, MP_ARG_INT, {.u_int = 8} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 15} },
+        { MP_QSTR_memLevel, MP_ARG_INT, {.u_int = 8} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_arg_validate_int(args[ARG_method].u_int, 8, MP_QSTR_method);
+    return make_compress(args[ARG_level].u_int, args[ARG_wbits].u_int, args[ARG_memLevel].u_int);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_compressobj_obj, 0, zlib_compressobj);
+
+//| def decompressobj(wbits: int = 15) -> Decompress:
+//|     """Return a `Decompress` object, to decompress a stream that arrives in pieces or
+//|     whose output doesn't fit in memory at once.
+//|
+//|     :param int wbits: as for `decompress()`. The object uses about 1 << wbits bytes for
+//|       the window, or the size given in the zlib header if *wbits* is 0.
+//|     """
+//|     ...
+//|
+static mp_obj_t zlib_decompressobj(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 15} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t wbits = args[ARG_wbits].u_int;
+    if (wbits != 0) {
+        validate_wbits(wbits);
+    }
+    zlib_decompress_obj_t *self = mp_obj_malloc(zlib_decompress_obj_t, &zlib_decompress_type);
+    common_hal_zlib_decompress_construct(self, wbits);
+    return MP_OBJ_FROM_PTR(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompressobj_obj, 0, zlib_decompressobj);
+
 //| def decompress(data: bytes, wbits: Optional[int] = 0, bufsize: Optional[int] = 0) -> bytes:
 //|     """Return decompressed *data* as bytes. *wbits* is DEFLATE dictionary window
 //|     size used during compression (8-15, the dictionary size is power of 2 of
@@ -60,7 +167,12 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decom
 
 static const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&zlib_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compressobj), MP_ROM_PTR(&zlib_compressobj_obj) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompressobj), MP_ROM_PTR(&zlib_decompressobj_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Compress), MP_ROM_PTR(&zlib_compress_type) },
+    { MP_ROM_QSTR(MP_QSTR_Decompress), MP_ROM_PTR(&zlib_decompress_type) },
 };
 
 static MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
@@ -11,6 +11,10 @@
 #include "shared-module/_eve/__init__.h"
 
 static void write(common_hal__eve_t *eve, size_t len, void *buf) {
+    if (eve->block != NULL) {
+        vstr_add_strn(eve->block, buf, len);
+        return;
+    }
     eve->dest[2] = mp_obj_new_bytearray_by_ref(len, buf);
     mp_call_method_n_kw(1, 0, eve->dest);
 }
@@ -44,6 +48,27 @@ void common_hal__eve_add(common_hal__eve_t *eve, size_t len, void *buf) {
     }
 }
 
+void common_hal__eve_begin_block(common_hal__eve_t *eve) {
+    if (eve->block != NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already in progress"));
+    }
+    // Send what came before so that it isn't part of the block.
+    common_hal__eve_flush(eve);
+    eve->block = vstr_new(sizeof(eve->buf));
+}
+
+mp_obj_t common_hal__eve_end_block(common_hal__eve_t *eve) {
+    if (eve->block == NULL) {
+        return mp_const_empty_bytes;
+    }
+    common_hal__eve_flush(eve);
+    vstr_t *block = eve->block;
+    eve->block = NULL;
+    mp_obj_t result = mp_obj_new_bytes_from_vstr(block);
+    m_del_obj(vstr_t, block);
+    return result;
+}
+
 #define C4(eve, u) (*(uint32_t *)append((eve), sizeof(uint32_t)) = (u))
 
 void common_hal__eve_Vertex2f(common_hal__eve_t *eve, mp_float_t x, mp_float_t y) {
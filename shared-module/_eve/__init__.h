@@ -6,10 +6,13 @@
 
 #pragma once
 
+#include "py/obj.h"
+
 typedef struct _common_hal__eve_t {
     mp_obj_t dest[3];           // Own 'write' method, plus argument
     int model;                  // 0 for unknown, or 810, 815, 817 for the three EVE generations
     int vscale;                 // fixed-point scaling used for Vertex2f
+    vstr_t *block;              // Commands being recorded by begin_block(), or NULL
     size_t n;                   // Current size of command buffer
-    uint8_t buf[512];           // Command buffer
+    uint8_t buf[CIRCUITPY__EVE_BUFFER_SIZE]; // Command buffer
 } common_hal__eve_t;
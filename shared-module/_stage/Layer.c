@@ -83,3 +83,24 @@ uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y) {
     // Convert to 16-bit color using the palette.
     return layer->palette[pixel << 1] | layer->palette[(pixel << 1) + 1] << 8;
 }
+
+// Fill the transparent pixels of a row of len pixels starting at x with the
+// layer's pixels, and return how many were filled.
+size_t fill_layer_span(layer_obj_t *layer, int16_t x, int16_t y, uint16_t *span, size_t len) {
+    if ((y < layer->y) || (y >= layer->y + (layer->height << 4))) {
+        return 0;
+    }
+    int start = MAX(x, layer->x);
+    int end = MIN(x + (int)len, layer->x + (layer->width << 4));
+    size_t filled = 0;
+    for (int i = start; i < end; ++i) {
+        if (span[i - x] == TRANSPARENT) {
+            uint16_t c = get_layer_pixel(layer, i, y);
+            if (c != TRANSPARENT) {
+                span[i - x] = c;
+                filled += 1;
+            }
+        }
+    }
+    return filled;
+}
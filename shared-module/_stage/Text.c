@@ -45,3 +45,24 @@ uint16_t get_text_pixel(text_obj_t *text, int16_t x, int16_t y) {
     // Convert to 16-bit color using the palette.
     return text->palette[pixel << 1] | text->palette[(pixel << 1) + 1] << 8;
 }
+
+// Fill the transparent pixels of a row of len pixels starting at x with the
+// text's pixels, and return how many were filled.
+size_t fill_text_span(text_obj_t *text, int16_t x, int16_t y, uint16_t *span, size_t len) {
+    if ((y < text->y) || (y >= text->y + (text->height << 3))) {
+        return 0;
+    }
+    int start = MAX(x, text->x);
+    int end = MIN(x + (int)len, text->x + (text->width << 3));
+    size_t filled = 0;
+    for (int i = start; i < end; ++i) {
+        if (span[i - x] == TRANSPARENT) {
+            uint16_t c = get_text_pixel(text, i, y);
+            if (c != TRANSPARENT) {
+                span[i - x] = c;
+                filled += 1;
+            }
+        }
+    }
+    return filled;
+}
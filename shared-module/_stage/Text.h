@@ -21,3 +21,4 @@ typedef struct {
 } text_obj_t;
 
 uint16_t get_text_pixel(text_obj_t *text, int16_t x, int16_t y);
+size_t fill_text_span(text_obj_t *text, int16_t x, int16_t y, uint16_t *span, size_t len);
@@ -10,6 +10,9 @@
 #include "shared-bindings/_stage/Layer.h"
 #include "shared-bindings/_stage/Text.h"
 
+// Pixels of a row resolved together. Each layer is checked against the whole
+// span once, so layers that don't cover it cost almost nothing.
+#define SPAN_SIZE (32)
 
 void render_stage(
     uint16_t x0, uint16_t y0,
@@ -35,33 +38,40 @@ void render_stage(
         CHIP_SELECT_TOGGLE_EVERY_BYTE,
         &display->write_ram_command, 1);
     size_t index = 0;
+    uint16_t span[SPAN_SIZE];
     for (int16_t y = y0 + vy; y < y1 + vy; ++y) {
         for (uint8_t yscale = 0; yscale < scale; ++yscale) {
-            for (int16_t x = x0 + vx; x < x1 + vx; ++x) {
-                uint16_t c = TRANSPARENT;
-                for (size_t layer = 0; layer < layers_size; ++layer) {
+            for (int16_t x = x0 + vx; x < x1 + vx; x += SPAN_SIZE) {
+                size_t len = MIN(SPAN_SIZE, x1 + vx - x);
+                for (size_t i = 0; i < len; ++i) {
+                    span[i] = TRANSPARENT;
+                }
+                // The layers are in front to back order, so stop as soon as
+                // every pixel has been filled.
+                size_t left = len;
+                for (size_t layer = 0; layer < layers_size && left > 0; ++layer) {
                     layer_obj_t *obj = MP_OBJ_TO_PTR(layers[layer]);
                     if (obj->base.type == &mp_type_layer) {
-                        c = get_layer_pixel(obj, x, y);
+                        left -= fill_layer_span(obj, x, y, span, len);
                     } else if (obj->base.type == &mp_type_text) {
-                        c = get_text_pixel((text_obj_t *)obj, x, y);
-                    }
-                    if (c != TRANSPARENT) {
-                        break;
+                        left -= fill_text_span((text_obj_t *)obj, x, y, span, len);
                     }
                 }
-                if (c == TRANSPARENT) {
-                    c = background;
-                }
-                for (uint8_t xscale = 0; xscale < scale; ++xscale) {
-                    buffer[index] = c;
-                    index += 1;
-                    // The buffer is full, send it.
-                    if (index >= buffer_size) {
-                        display->bus.send(display->bus.bus, DISPLAY_DATA,
-                            CHIP_SELECT_UNTOUCHED,
-                            ((uint8_t *)buffer), buffer_size * 2);
-                        index = 0;
+                for (size_t i = 0; i < len; ++i) {
+                    uint16_t c = span[i];
+                    if (c == TRANSPARENT) {
+                        c = background;
+                    }
+                    for (uint8_t xscale = 0; xscale < scale; ++xscale) {
+                        buffer[index] = c;
+                        index += 1;
+                        // The buffer is full, send it.
+                        if (index >= buffer_size) {
+                            display->bus.send(display->bus.bus, DISPLAY_DATA,
+                                CHIP_SELECT_UNTOUCHED,
+                                ((uint8_t *)buffer), buffer_size * 2);
+                            index = 0;
+                        }
                     }
                 }
             }
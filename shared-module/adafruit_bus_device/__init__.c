@@ -3,3 +3,37 @@
 // SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
 //
 // SPDX-License-Identifier: MIT
+
+#include "shared-module/adafruit_bus_device/__init__.h"
+
+#include "py/runtime.h"
+
+void adafruit_bus_device_validate_segments(size_t n, const mp_obj_t *segments, bool allow_none, bool equal_lengths) {
+    for (size_t i = 0; i < n; i++) {
+        mp_obj_t segment = segments[i];
+        if (segment == mp_const_none && allow_none) {
+            continue;
+        }
+        if (mp_obj_is_small_int(segment)) {
+            mp_arg_validate_int_min(MP_OBJ_SMALL_INT_VALUE(segment), 0, MP_QSTR_delay);
+            continue;
+        }
+        mp_obj_t *pair;
+        mp_obj_get_array_fixed_n(segment, 2, &pair);
+        if (pair[0] == mp_const_none && pair[1] == mp_const_none) {
+            mp_arg_error_invalid(MP_QSTR_segments);
+        }
+        mp_buffer_info_t out_info = { .len = 0 };
+        mp_buffer_info_t in_info = { .len = 0 };
+        if (pair[0] != mp_const_none) {
+            mp_get_buffer_raise(pair[0], &out_info, MP_BUFFER_READ);
+        }
+        if (pair[1] != mp_const_none) {
+            mp_get_buffer_raise(pair[1], &in_info, MP_BUFFER_WRITE);
+        }
+        if (equal_lengths && pair[0] != mp_const_none && pair[1] != mp_const_none &&
+            out_info.len != in_info.len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer slices must be of equal length"));
+        }
+    }
+}
@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// Checks every transaction segment before the bus is touched. A segment is an (out, in)
+// tuple, where one of the buffers may be None, or a delay in microseconds. allow_none also
+// accepts None, which SPIDevice uses to pulse chip select. With equal_lengths, the two
+// buffers of an (out, in) pair must be the same length.
+void adafruit_bus_device_validate_segments(size_t n, const mp_obj_t *segments, bool allow_none, bool equal_lengths);
@@ -6,7 +6,9 @@
 
 #include "shared-bindings/adafruit_bus_device/i2c_device/I2CDevice.h"
 #include "shared-bindings/busio/I2C.h"
+#include "shared-module/adafruit_bus_device/__init__.h"
 #include "py/mperrno.h"
+#include "py/mphal.h"
 #include "py/nlr.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
@@ -52,3 +54,46 @@ void common_hal_adafruit_bus_device_i2cdevice_probe_for_device(adafruit_bus_devi
         mp_raise_ValueError_varg(MP_ERROR_TEXT("No I2C device at address: 0x%x"), self->device_address);
     }
 }
+
+static void i2cdevice_run_segments(adafruit_bus_device_i2cdevice_obj_t *self, size_t n, const mp_obj_t *segments) {
+    for (size_t i = 0; i < n; i++) {
+        mp_obj_t segment = segments[i];
+        if (mp_obj_is_small_int(segment)) {
+            mp_hal_delay_us(MP_OBJ_SMALL_INT_VALUE(segment));
+            continue;
+        }
+        mp_obj_t *pair;
+        mp_obj_get_array_fixed_n(segment, 2, &pair);
+        mp_obj_t dest[5];
+        dest[2] = MP_OBJ_NEW_SMALL_INT(self->device_address);
+        if (pair[1] == mp_const_none) {
+            mp_load_method(self->i2c, MP_QSTR_writeto, dest);
+            dest[3] = pair[0];
+            mp_call_method_n_kw(2, 0, dest);
+        } else if (pair[0] == mp_const_none) {
+            mp_load_method(self->i2c, MP_QSTR_readfrom_into, dest);
+            dest[3] = pair[1];
+            mp_call_method_n_kw(2, 0, dest);
+        } else {
+            mp_load_method(self->i2c, MP_QSTR_writeto_then_readfrom, dest);
+            dest[3] = pair[0];
+            dest[4] = pair[1];
+            mp_call_method_n_kw(3, 0, dest);
+        }
+    }
+}
+
+void common_hal_adafruit_bus_device_i2cdevice_transaction(adafruit_bus_device_i2cdevice_obj_t *self, size_t n, const mp_obj_t *segments) {
+    adafruit_bus_device_validate_segments(n, segments, false, false);
+
+    common_hal_adafruit_bus_device_i2cdevice_lock(self);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        i2cdevice_run_segments(self, n, segments);
+        nlr_pop();
+    } else {
+        common_hal_adafruit_bus_device_i2cdevice_unlock(self);
+        nlr_jump(nlr.ret_val);
+    }
+    common_hal_adafruit_bus_device_i2cdevice_unlock(self);
+}
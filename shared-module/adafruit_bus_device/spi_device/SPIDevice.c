@@ -7,7 +7,9 @@
 #include "shared-bindings/adafruit_bus_device/spi_device/SPIDevice.h"
 #include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-module/adafruit_bus_device/__init__.h"
 #include "py/mperrno.h"
+#include "py/mphal.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 
@@ -85,3 +87,54 @@ void common_hal_adafruit_bus_device_spidevice_exit(adafruit_bus_device_spidevice
     mp_load_method(self->spi, MP_QSTR_unlock, dest);
     mp_call_method_n_kw(0, 0, dest);
 }
+
+static void spidevice_run_segments(adafruit_bus_device_spidevice_obj_t *self, size_t n, const mp_obj_t *segments) {
+    for (size_t i = 0; i < n; i++) {
+        mp_obj_t segment = segments[i];
+        if (segment == mp_const_none) {
+            if (self->chip_select != mp_const_none) {
+                digitalio_digitalinout_obj_t *cs = MP_OBJ_TO_PTR(self->chip_select);
+                common_hal_digitalio_digitalinout_set_value(cs, !(self->cs_active_value));
+                common_hal_digitalio_digitalinout_set_value(cs, self->cs_active_value);
+            }
+            continue;
+        }
+        if (mp_obj_is_small_int(segment)) {
+            mp_hal_delay_us(MP_OBJ_SMALL_INT_VALUE(segment));
+            continue;
+        }
+        mp_obj_t *pair;
+        mp_obj_get_array_fixed_n(segment, 2, &pair);
+        mp_obj_t dest[4];
+        if (pair[1] == mp_const_none) {
+            mp_load_method(self->spi, MP_QSTR_write, dest);
+            dest[2] = pair[0];
+            mp_call_method_n_kw(1, 0, dest);
+        } else if (pair[0] == mp_const_none) {
+            mp_load_method(self->spi, MP_QSTR_readinto, dest);
+            dest[2] = pair[1];
+            mp_call_method_n_kw(1, 0, dest);
+        } else {
+            mp_load_method(self->spi, MP_QSTR_write_readinto, dest);
+            dest[2] = pair[0];
+            dest[3] = pair[1];
+            mp_call_method_n_kw(2, 0, dest);
+        }
+    }
+}
+
+void common_hal_adafruit_bus_device_spidevice_transaction(adafruit_bus_device_spidevice_obj_t *self, size_t n, const mp_obj_t *segments) {
+    adafruit_bus_device_validate_segments(n, segments, true, true);
+
+    common_hal_adafruit_bus_device_spidevice_enter(self);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        spidevice_run_segments(self, n, segments);
+        nlr_pop();
+    } else {
+        // Release chip select and the bus before passing the exception on.
+        common_hal_adafruit_bus_device_spidevice_exit(self);
+        nlr_jump(nlr.ret_val);
+    }
+    common_hal_adafruit_bus_device_spidevice_exit(self);
+}
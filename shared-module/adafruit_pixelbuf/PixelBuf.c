@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 
+#include "py/binary.h"
 #include "py/obj.h"
 #include "py/objstr.h"
 #include "py/objtype.h"
@@ -37,6 +38,8 @@ void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *se
     memcpy(transmit_buffer, header, header_len);
     memcpy(transmit_buffer + header_len + pixel_len, trailer, trailer_len);
     self->post_brightness_buffer = transmit_buffer + header_len;
+    self->pre_brightness_buffer = NULL;
+    self->brightness_pending = false;
 
     if (self->byteorder.is_dotstar) {
         // Initialize the buffer with the dotstar start bytes.
@@ -103,13 +106,8 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_f
             self->pre_brightness_buffer = m_malloc(pixel_len);
             memcpy(self->pre_brightness_buffer, self->post_brightness_buffer, pixel_len);
         }
-        for (size_t i = 0; i < pixel_len; i++) {
-            // Don't adjust per-pixel luminance bytes in dotstar mode
-            if (self->byteorder.is_dotstar && i % 4 == 0) {
-                continue;
-            }
-            self->post_brightness_buffer[i] = (self->pre_brightness_buffer[i] * self->scaled_brightness) / 256;
-        }
+        // The pixels are scaled by show().
+        self->brightness_pending = true;
 
         if (self->auto_write) {
             common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
@@ -117,6 +115,35 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_f
     }
 }
 
+// Scale the pre_brightness_buffer into the post_brightness_buffer, four bytes
+// at a time. Each byte is multiplied in its own 16 bit lane, which can't
+// overflow since scaled_brightness is at most 256.
+static void pixelbuf_apply_brightness(pixelbuf_pixelbuf_obj_t *self) {
+    const uint8_t *src = self->pre_brightness_buffer;
+    uint8_t *dest = self->post_brightness_buffer;
+    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    uint32_t scale = self->scaled_brightness;
+    // Don't adjust per-pixel luminance bytes in dotstar mode. Their pixels
+    // are four bytes, so the luminance byte is the first of each word.
+    uint32_t keep = 0;
+    if (self->byteorder.is_dotstar) {
+        const uint8_t first_byte[4] = { 0xff, 0, 0, 0 };
+        memcpy(&keep, first_byte, sizeof(keep));
+    }
+    size_t i = 0;
+    for (; i + 4 <= pixel_len; i += 4) {
+        uint32_t word;
+        memcpy(&word, src + i, sizeof(word));
+        uint32_t even = (((word & 0x00ff00ff) * scale) >> 8) & 0x00ff00ff;
+        uint32_t odd = (((word >> 8) & 0x00ff00ff) * scale) & 0xff00ff00;
+        word = ((even | odd) & ~keep) | (word & keep);
+        memcpy(dest + i, &word, sizeof(word));
+    }
+    for (; i < pixel_len; i++) {
+        dest[i] = (src[i] * scale) / 256;
+    }
+}
+
 static uint8_t _pixelbuf_get_as_uint8(mp_obj_t obj) {
     if (mp_obj_is_small_int(obj)) {
         return MP_OBJ_SMALL_INT_VALUE(obj);
@@ -157,7 +184,7 @@ static void pixelbuf_parse_color(pixelbuf_pixelbuf_obj_t *self, mp_obj_t color,
         *b = _pixelbuf_get_as_uint8(items[PIXEL_B]);
         if (len > 3) {
             if (mp_obj_is_float(items[PIXEL_W])) {
-                *w = 255 * mp_obj_get_float(items[PIXEL_W]);
+                *w = (uint8_t)(255 * mp_obj_get_float(items[PIXEL_W]));
             } else {
                 *w = mp_obj_get_int_truncated(items[PIXEL_W]);
             }
@@ -179,6 +206,16 @@ void common_hal_adafruit_pixelbuf_pixelbuf_parse_color(mp_obj_t self_in, mp_obj_
     pixelbuf_parse_color(self, color, r, g, b, w);
 }
 
+// The buffer that pixels are written to. When there is a pre_brightness_buffer,
+// show() scales the pixels into the post_brightness_buffer.
+static uint8_t *pixelbuf_unscaled_buffer(pixelbuf_pixelbuf_obj_t *self) {
+    if (self->pre_brightness_buffer == NULL) {
+        return self->post_brightness_buffer;
+    }
+    self->brightness_pending = true;
+    return self->pre_brightness_buffer;
+}
+
 static void pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t *self, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     // DotStars don't have white, instead they have 5 bit brightness so pack it into w. Shift right
     // by three to leave the top five bits.
@@ -186,15 +223,7 @@ static void pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t *self, size_t index
         w = DOTSTAR_LED_START | w >> 3;
     }
     pixelbuf_rgbw_t *rgbw_order = &self->byteorder.byteorder;
-    size_t offset = index * self->bytes_per_pixel;
-    uint8_t *scaled_buffer, *unscaled_buffer;
-    if (self->pre_brightness_buffer) {
-        scaled_buffer = self->post_brightness_buffer + offset;
-        unscaled_buffer = self->pre_brightness_buffer + offset;
-    } else {
-        scaled_buffer = NULL;
-        unscaled_buffer = self->post_brightness_buffer + offset;
-    }
+    uint8_t *unscaled_buffer = pixelbuf_unscaled_buffer(self) + index * self->bytes_per_pixel;
 
     if (self->bytes_per_pixel == 4) {
         unscaled_buffer[rgbw_order->w] = w;
@@ -203,22 +232,48 @@ static void pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t *self, size_t index
     unscaled_buffer[rgbw_order->r] = r;
     unscaled_buffer[rgbw_order->g] = g;
     unscaled_buffer[rgbw_order->b] = b;
+}
+void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(mp_obj_t self_in, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    pixelbuf_set_pixel_color(self, index, r, g, b, w);
+}
 
-    if (scaled_buffer) {
-        if (self->bytes_per_pixel == 4) {
-            if (!self->byteorder.is_dotstar) {
-                w = (w * self->scaled_brightness) / 256;
+// Set count pixels from bytes holding in_bpp bytes per pixel in in_order. A
+// white byte becomes the DotStar brightness, like the 4th value of a tuple.
+static void pixelbuf_set_pixels_from_bytes(pixelbuf_pixelbuf_obj_t *self, size_t start, mp_int_t step,
+    const uint8_t *data, size_t count, const pixelbuf_rgbw_t *in_order, uint8_t in_bpp) {
+    uint8_t *buffer = pixelbuf_unscaled_buffer(self);
+    uint8_t bpp = self->bytes_per_pixel;
+    const pixelbuf_rgbw_t *out_order = &self->byteorder.byteorder;
+    bool is_dotstar = self->byteorder.is_dotstar;
+    if (step == 1 && in_bpp == bpp && !is_dotstar && memcmp(in_order, out_order, sizeof(pixelbuf_rgbw_t)) == 0) {
+        memcpy(buffer + start * bpp, data, count * bpp);
+        return;
+    }
+    uint8_t default_w = is_dotstar ? 255 : 0;
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *in = data + i * in_bpp;
+        uint8_t *out = buffer + ((mp_int_t)start + (mp_int_t)i * step) * bpp;
+        out[out_order->r] = in[in_order->r];
+        out[out_order->g] = in[in_order->g];
+        out[out_order->b] = in[in_order->b];
+        if (bpp == 4) {
+            uint8_t w = in_bpp == 4 ? in[in_order->w] : default_w;
+            if (is_dotstar) {
+                w = DOTSTAR_LED_START | w >> 3;
             }
-            scaled_buffer[rgbw_order->w] = w;
+            out[out_order->w] = w;
         }
-        scaled_buffer[rgbw_order->r] = (r * self->scaled_brightness) / 256;
-        scaled_buffer[rgbw_order->g] = (g * self->scaled_brightness) / 256;
-        scaled_buffer[rgbw_order->b] = (b * self->scaled_brightness) / 256;
     }
 }
-void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(mp_obj_t self_in, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+
+void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels_from_buffer(mp_obj_t self_in, const uint8_t *data, size_t len,
+    pixelbuf_byteorder_details_t *byteorder) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
-    pixelbuf_set_pixel_color(self, index, r, g, b, w);
+    pixelbuf_set_pixels_from_bytes(self, 0, 1, data, len / byteorder->bpp, &byteorder->byteorder, byteorder->bpp);
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
 }
 
 static void _pixelbuf_set_pixel(pixelbuf_pixelbuf_obj_t *self, size_t index, mp_obj_t value) {
@@ -233,11 +288,23 @@ static void _pixelbuf_set_pixel(pixelbuf_pixelbuf_obj_t *self, size_t index, mp_
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, mp_obj_t *values,
     mp_obj_tuple_t *flatten_to) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    bool flattened = flatten_to != mp_const_none;
+    // Flattened bytes hold pixels in (red, green, blue[, white]) order, so
+    // they can be copied without making an object for each value.
+    mp_buffer_info_t bufinfo;
+    if (flattened && mp_get_buffer(values, &bufinfo, MP_BUFFER_READ) &&
+        (bufinfo.typecode == 'B' || bufinfo.typecode == BYTEARRAY_TYPECODE)) {
+        static const pixelbuf_rgbw_t rgbw_order = { PIXEL_R, PIXEL_G, PIXEL_B, PIXEL_W };
+        pixelbuf_set_pixels_from_bytes(self, start, step, bufinfo.buf, slice_len, &rgbw_order, self->bytes_per_pixel);
+        if (self->auto_write) {
+            common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+        }
+        return;
+    }
     mp_obj_iter_buf_t iter_buf;
     mp_obj_t iterable = mp_getiter(values, &iter_buf);
     mp_obj_t item;
     size_t i = 0;
-    bool flattened = flatten_to != mp_const_none;
     if (flattened) {
         flatten_to->len = self->bytes_per_pixel;
     }
@@ -295,6 +362,10 @@ mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_pixel(mp_obj_t self_in, size_
 
 void common_hal_adafruit_pixelbuf_pixelbuf_show(mp_obj_t self_in) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    if (self->brightness_pending) {
+        pixelbuf_apply_brightness(self);
+        self->brightness_pending = false;
+    }
     mp_obj_t dest[2 + 1];
     mp_load_method(self_in, MP_QSTR__transmit, dest);
 
@@ -312,8 +383,14 @@ void common_hal_adafruit_pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t fill_
     uint8_t w;
     common_hal_adafruit_pixelbuf_pixelbuf_parse_color(self, fill_color, &r, &g, &b, &w);
 
-    for (size_t i = 0; i < self->pixel_count; i++) {
-        common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(self, i, r, g, b, w);
+    if (self->pixel_count > 0) {
+        // Set the first pixel, then copy it to the rest.
+        pixelbuf_set_pixel_color(self, 0, r, g, b, w);
+        uint8_t *buffer = pixelbuf_unscaled_buffer(self);
+        size_t bpp = self->bytes_per_pixel;
+        for (size_t i = 1; i < self->pixel_count; i++) {
+            memcpy(buffer + i * bpp, buffer, bpp);
+        }
     }
     if (self->auto_write) {
         common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
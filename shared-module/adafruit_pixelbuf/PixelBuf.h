@@ -36,6 +36,9 @@ typedef struct {
     // account for any header.
     uint8_t *post_brightness_buffer;
     uint8_t *pre_brightness_buffer;
+    // Set when the pre_brightness_buffer or the brightness has changed, so
+    // that show() needs to scale the pixels again.
+    bool brightness_pending;
     bool auto_write;
 } pixelbuf_pixelbuf_obj_t;
 
@@ -11,54 +11,346 @@
 #include "shared-bindings/aesio/__init__.h"
 #include "shared-module/aesio/__init__.h"
 
+// Encrypt or decrypt whole blocks with the port's engine if it can, otherwise
+// in software.
+static void crypt_blocks(aesio_aes_obj_t *self, enum AES_MODE mode, bool encrypt,
+    const uint8_t *src, uint8_t *dest, size_t len) {
+    #if CIRCUITPY_AESIO_HW
+    if (aesio_hw_crypt(self->key, self->ctx.KeyLength, mode, encrypt, self->ctx.Iv, src, dest, len)) {
+        return;
+    }
+    #endif
+    if (src != dest) {
+        memmove(dest, src, len);
+    }
+    switch (mode) {
+        case AES_MODE_ECB:
+            for (size_t i = 0; i < len; i += AES_BLOCKLEN) {
+                if (encrypt) {
+                    AES_ECB_encrypt(&self->ctx, dest + i);
+                } else {
+                    AES_ECB_decrypt(&self->ctx, dest + i);
+                }
+            }
+            break;
+        case AES_MODE_CBC:
+            if (encrypt) {
+                AES_CBC_encrypt_buffer(&self->ctx, dest, len);
+            } else {
+                AES_CBC_decrypt_buffer(&self->ctx, dest, len);
+            }
+            break;
+        default:
+            AES_CTR_xcrypt_buffer(&self->ctx, dest, len);
+            break;
+    }
+}
+
+// Whole blocks in counter mode. GCM only increments the last 32 bits of the
+// counter, so there the blocks are done in runs that don't carry out of them.
+static void ctr_blocks(aesio_aes_obj_t *self, const uint8_t *src, uint8_t *dest, size_t len) {
+    if (self->mode != AES_MODE_GCM) {
+        crypt_blocks(self, AES_MODE_CTR, true, src, dest, len);
+        return;
+    }
+    uint8_t *iv = self->ctx.Iv;
+    while (len > 0) {
+        uint32_t low = ((uint32_t)iv[12] << 24) | (iv[13] << 16) | (iv[14] << 8) | iv[15];
+        uint64_t blocks_to_carry = ((uint64_t)1 << 32) - low;
+        size_t run = len;
+        if (run / AES_BLOCKLEN > blocks_to_carry) {
+            run = blocks_to_carry * AES_BLOCKLEN;
+        }
+        uint8_t upper[AES_BLOCKLEN - 4];
+        memcpy(upper, iv, sizeof(upper));
+        crypt_blocks(self, AES_MODE_CTR, true, src, dest, run);
+        memcpy(iv, upper, sizeof(upper));
+        src += run;
+        dest += run;
+        len -= run;
+    }
+}
+
+// Key stream left from a partial block is used by the next call, so data can
+// be streamed in pieces of any length.
+static void ctr_xcrypt(aesio_aes_obj_t *self, const uint8_t *src, uint8_t *dest, size_t len) {
+    while (len > 0 && self->stream_used < AES_BLOCKLEN) {
+        *dest++ = *src++ ^ self->stream[self->stream_used++];
+        len--;
+    }
+    size_t whole = len & ~(AES_BLOCKLEN - 1);
+    if (whole > 0) {
+        ctr_blocks(self, src, dest, whole);
+        src += whole;
+        dest += whole;
+        len -= whole;
+    }
+    if (len > 0) {
+        memset(self->stream, 0, AES_BLOCKLEN);
+        ctr_blocks(self, self->stream, self->stream, AES_BLOCKLEN);
+        self->stream_used = 0;
+        while (len > 0) {
+            *dest++ = *src++ ^ self->stream[self->stream_used++];
+            len--;
+        }
+    }
+}
+
+static uint64_t get_be64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < 8; i++) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static void put_be64(uint8_t *p, uint64_t v) {
+    for (size_t i = 0; i < 8; i++) {
+        p[7 - i] = v >> (8 * i);
+    }
+}
+
+// Reduction of the 4 bits shifted out by each step of the multiplication.
+static const uint16_t gcm_last4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0,
+};
+
+// Fill the tables with the products of H and each 4-bit value.
+static void gcm_init_tables(aesio_gcm_t *gcm, const uint8_t h[AES_BLOCKLEN]) {
+    uint64_t vh = get_be64(h);
+    uint64_t vl = get_be64(h + 8);
+    gcm->hl[0] = 0;
+    gcm->hh[0] = 0;
+    gcm->hl[8] = vl;
+    gcm->hh[8] = vh;
+    for (size_t i = 4; i > 0; i >>= 1) {
+        uint32_t t = (vl & 1) * 0xe1000000U;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ ((uint64_t)t << 32);
+        gcm->hl[i] = vl;
+        gcm->hh[i] = vh;
+    }
+    for (size_t i = 2; i <= 8; i *= 2) {
+        vh = gcm->hh[i];
+        vl = gcm->hl[i];
+        for (size_t j = 1; j < i; j++) {
+            gcm->hh[i + j] = vh ^ gcm->hh[j];
+            gcm->hl[i + j] = vl ^ gcm->hl[j];
+        }
+    }
+}
+
+// x = x * H in GF(2^128).
+static void gcm_mult(const aesio_gcm_t *gcm, uint8_t x[AES_BLOCKLEN]) {
+    uint8_t lo = x[15] & 0xf;
+    uint64_t zh = gcm->hh[lo];
+    uint64_t zl = gcm->hl[lo];
+    for (int i = 15; i >= 0; i--) {
+        lo = x[i] & 0xf;
+        uint8_t hi = x[i] >> 4;
+        if (i != 15) {
+            uint8_t rem = zl & 0xf;
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ ((uint64_t)gcm_last4[rem] << 48);
+            zh ^= gcm->hh[lo];
+            zl ^= gcm->hl[lo];
+        }
+        uint8_t rem = zl & 0xf;
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ((uint64_t)gcm_last4[rem] << 48);
+        zh ^= gcm->hh[hi];
+        zl ^= gcm->hl[hi];
+    }
+    put_be64(x, zh);
+    put_be64(x + 8, zl);
+}
+
+static void gcm_hash_block(const aesio_gcm_t *gcm, uint8_t ghash[AES_BLOCKLEN], const uint8_t *block) {
+    for (size_t i = 0; i < AES_BLOCKLEN; i++) {
+        ghash[i] ^= block[i];
+    }
+    gcm_mult(gcm, ghash);
+}
+
+static void gcm_hash(aesio_gcm_t *gcm, const uint8_t *data, size_t len) {
+    if (gcm->partial_len > 0) {
+        size_t n = MIN(len, (size_t)(AES_BLOCKLEN - gcm->partial_len));
+        memcpy(gcm->partial + gcm->partial_len, data, n);
+        gcm->partial_len += n;
+        data += n;
+        len -= n;
+        if (gcm->partial_len < AES_BLOCKLEN) {
+            return;
+        }
+        gcm_hash_block(gcm, gcm->ghash, gcm->partial);
+        gcm->partial_len = 0;
+    }
+    while (len >= AES_BLOCKLEN) {
+        gcm_hash_block(gcm, gcm->ghash, data);
+        data += AES_BLOCKLEN;
+        len -= AES_BLOCKLEN;
+    }
+    memcpy(gcm->partial, data, len);
+    gcm->partial_len = len;
+}
+
+// Hash what is left of a partial block, padded with zeros.
+static void gcm_hash_pad(const aesio_gcm_t *gcm, uint8_t ghash[AES_BLOCKLEN]) {
+    if (gcm->partial_len > 0) {
+        uint8_t block[AES_BLOCKLEN] = {0};
+        memcpy(block, gcm->partial, gcm->partial_len);
+        gcm_hash_block(gcm, ghash, block);
+    }
+}
+
+// Derive the hash key and the first counter from the key and the IV.
+static void gcm_start(aesio_aes_obj_t *self) {
+    aesio_gcm_t *gcm = self->gcm;
+    if (gcm == NULL) {
+        gcm = self->gcm = m_new_obj(aesio_gcm_t);
+    }
+    memset(gcm, 0, sizeof(*gcm));
+
+    uint8_t h[AES_BLOCKLEN] = {0};
+    crypt_blocks(self, AES_MODE_ECB, true, h, h, AES_BLOCKLEN);
+    gcm_init_tables(gcm, h);
+
+    uint8_t *j0 = self->ctx.Iv;
+    if (self->iv_len == 12) {
+        memcpy(j0, self->iv, 12);
+        memset(j0 + 12, 0, 3);
+        j0[15] = 1;
+    } else {
+        gcm_hash(gcm, self->iv, self->iv_len);
+        gcm_hash_pad(gcm, gcm->ghash);
+        uint8_t lengths[AES_BLOCKLEN] = {0};
+        put_be64(lengths + 8, (uint64_t)self->iv_len * 8);
+        gcm_hash_block(gcm, gcm->ghash, lengths);
+        memcpy(j0, gcm->ghash, AES_BLOCKLEN);
+        memset(gcm->ghash, 0, AES_BLOCKLEN);
+        gcm->partial_len = 0;
+    }
+    // The first counter block masks the tag, and the text starts at the next.
+    memset(self->stream, 0, AES_BLOCKLEN);
+    ctr_blocks(self, self->stream, gcm->tag_mask, AES_BLOCKLEN);
+    self->stream_used = AES_BLOCKLEN;
+}
+
+// Start the mode over with the current key and IV.
+static void start_mode(aesio_aes_obj_t *self) {
+    self->stream_used = AES_BLOCKLEN;
+    if (self->mode == AES_MODE_GCM) {
+        gcm_start(self);
+    } else {
+        memcpy(self->ctx.Iv, self->iv, AES_BLOCKLEN);
+    }
+}
+
 void common_hal_aesio_aes_construct(aesio_aes_obj_t *self, const uint8_t *key,
-    uint32_t key_length, const uint8_t *iv,
+    uint32_t key_length, const uint8_t *iv, size_t iv_length,
     int mode, int counter) {
     self->mode = mode;
     self->counter = counter;
-    common_hal_aesio_aes_rekey(self, key, key_length, iv);
+    self->gcm = NULL;
+    common_hal_aesio_aes_rekey(self, key, key_length, iv, iv_length);
 }
 
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self, const uint8_t *key,
-    uint32_t key_length, const uint8_t *iv) {
+    uint32_t key_length, const uint8_t *iv, size_t iv_length) {
     memset(&self->ctx, 0, sizeof(self->ctx));
+    AES_init_ctx(&self->ctx, key, key_length);
+    #if CIRCUITPY_AESIO_HW
+    memcpy(self->key, key, key_length);
+    #endif
+    memset(self->iv, 0, AES_BLOCKLEN);
+    self->iv_len = AES_BLOCKLEN;
     if (iv != NULL) {
-        AES_init_ctx_iv(&self->ctx, key, key_length, iv);
-    } else {
-        AES_init_ctx(&self->ctx, key, key_length);
+        memcpy(self->iv, iv, iv_length);
+        self->iv_len = iv_length;
     }
+    start_mode(self);
 }
 
 void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
+    bool restart = mode == AES_MODE_GCM || self->mode == AES_MODE_GCM;
     self->mode = mode;
+    if (restart) {
+        start_mode(self);
+    }
 }
 
-void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
-    size_t length) {
+void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, const uint8_t *src,
+    uint8_t *dest, size_t length) {
     switch (self->mode) {
         case AES_MODE_ECB:
-            AES_ECB_encrypt(&self->ctx, buffer);
-            break;
         case AES_MODE_CBC:
-            AES_CBC_encrypt_buffer(&self->ctx, buffer, length);
+            crypt_blocks(self, self->mode, true, src, dest, length);
             break;
         case AES_MODE_CTR:
-            AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
+            ctr_xcrypt(self, src, dest, length);
+            break;
+        case AES_MODE_GCM: {
+            aesio_gcm_t *gcm = self->gcm;
+            if (!gcm->text_started) {
+                gcm_hash_pad(gcm, gcm->ghash);
+                gcm->partial_len = 0;
+                gcm->text_started = true;
+            }
+            ctr_xcrypt(self, src, dest, length);
+            gcm_hash(gcm, dest, length);
+            gcm->text_len += length;
             break;
+        }
     }
 }
 
-void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
-    size_t length) {
+void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, const uint8_t *src,
+    uint8_t *dest, size_t length) {
     switch (self->mode) {
         case AES_MODE_ECB:
-            AES_ECB_decrypt(&self->ctx, buffer);
-            break;
         case AES_MODE_CBC:
-            AES_CBC_decrypt_buffer(&self->ctx, buffer, length);
+            crypt_blocks(self, self->mode, false, src, dest, length);
             break;
         case AES_MODE_CTR:
-            AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
+            ctr_xcrypt(self, src, dest, length);
+            break;
+        case AES_MODE_GCM: {
+            aesio_gcm_t *gcm = self->gcm;
+            if (!gcm->text_started) {
+                gcm_hash_pad(gcm, gcm->ghash);
+                gcm->partial_len = 0;
+                gcm->text_started = true;
+            }
+            // Hash the ciphertext before it may be overwritten.
+            gcm_hash(gcm, src, length);
+            gcm->text_len += length;
+            ctr_xcrypt(self, src, dest, length);
             break;
+        }
+    }
+}
+
+bool common_hal_aesio_aes_update(aesio_aes_obj_t *self, const uint8_t *data, size_t len) {
+    aesio_gcm_t *gcm = self->gcm;
+    if (gcm->text_started) {
+        return false;
+    }
+    gcm_hash(gcm, data, len);
+    gcm->aad_len += len;
+    return true;
+}
+
+// The tag of everything so far. Encryption or decryption can go on after it.
+void common_hal_aesio_aes_digest(aesio_aes_obj_t *self, uint8_t tag[AES_BLOCKLEN]) {
+    const aesio_gcm_t *gcm = self->gcm;
+    memcpy(tag, gcm->ghash, AES_BLOCKLEN);
+    gcm_hash_pad(gcm, tag);
+    uint8_t lengths[AES_BLOCKLEN];
+    put_be64(lengths, gcm->aad_len * 8);
+    put_be64(lengths + 8, gcm->text_len * 8);
+    gcm_hash_block(gcm, tag, lengths);
+    for (size_t i = 0; i < AES_BLOCKLEN; i++) {
+        tag[i] ^= gcm->tag_mask[i];
     }
 }
@@ -20,17 +20,65 @@ enum AES_MODE {
     AES_MODE_ECB = 1,
     AES_MODE_CBC = 2,
     AES_MODE_CTR = 6,
+    AES_MODE_GCM = 11,
 };
 
+// GCM state, allocated when the mode is first set to GCM.
+typedef struct {
+    // Multiples of the hash key H, for Shoup's 4-bit table method.
+    uint64_t hl[16];
+    uint64_t hh[16];
+    // The block encrypted with the first counter, which masks the tag.
+    uint8_t tag_mask[AES_BLOCKLEN];
+    // GHASH of the data so far, and the bytes of a block not yet hashed.
+    uint8_t ghash[AES_BLOCKLEN];
+    uint8_t partial[AES_BLOCKLEN];
+    uint8_t partial_len;
+    // Set once encryption or decryption starts, after which there can be no
+    // more additional data.
+    bool text_started;
+    uint64_t aad_len;
+    uint64_t text_len;
+} aesio_gcm_t;
+
 typedef struct {
     mp_obj_base_t base;
 
-    // The tinyaes context
+    // The tinyaes context. Its Iv is the CBC chaining value, or the next
+    // counter block in CTR and GCM modes.
     struct AES_ctx ctx;
 
+    #if CIRCUITPY_AESIO_HW
+    // The key, loaded into the engine for each call.
+    uint8_t key[AES_KEYLEN256];
+    #endif
+
+    // The IV as given, to start GCM.
+    uint8_t iv[AES_BLOCKLEN];
+    uint8_t iv_len;
+
+    // Key stream left over from the last partial block in CTR and GCM modes.
+    uint8_t stream[AES_BLOCKLEN];
+    uint8_t stream_used;
+
     // Which AES mode this instance of the object is configured to use
     enum AES_MODE mode;
 
     // Counter for running in CTR mode
     uint32_t counter;
+
+    aesio_gcm_t *gcm;
 } aesio_aes_obj_t;
+
+#if CIRCUITPY_AESIO_HW
+// Implemented by ports with an AES engine. Each call loads the key, so any
+// number of AES objects can share the engine.
+
+// Encrypt or decrypt len bytes, a multiple of 16, from src to dest, which may
+// be the same buffer. In CBC mode iv is the chaining value and in CTR mode it
+// is the counter block; both are updated as in software. Returns false,
+// without changing anything, if the engine can't do this, such as for a key
+// size, mode or direction it doesn't support, and software is used instead.
+bool aesio_hw_crypt(const uint8_t *key, size_t key_length, enum AES_MODE mode, bool encrypt,
+    uint8_t iv[AES_BLOCKLEN], const uint8_t *src, uint8_t *dest, size_t len);
+#endif
@@ -92,7 +92,8 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     // Try to allocate two buffers, one will be loaded from file and the other
     // DMAed to DAC.
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        // Keep the second buffer word aligned.
+        self->len = (buffer_size / 2) & ~(sizeof(uint32_t) - 1);
         self->buffer = buffer;
         self->second_buffer = buffer + self->len;
     } else {
@@ -109,6 +110,20 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
             m_malloc_fail(self->len);
         }
     }
+
+    // FatFs reads whole sectors straight into the caller's buffer, skipping
+    // its own sector cache, when a read starts on a sector boundary. The data
+    // usually starts 44 bytes into the file, so make the first read stop at
+    // the next sector boundary and every later read will start on one. This
+    // only pays off when a buffer holds at least a sector, and the first read
+    // must still be whole frames.
+    uint32_t frame_size = self->channel_count * (self->bits_per_sample / 8);
+    uint32_t head = (WAVEFILE_SECTOR_SIZE - self->data_start % WAVEFILE_SECTOR_SIZE) % WAVEFILE_SECTOR_SIZE;
+    self->first_read_len = self->len;
+    if (self->len >= WAVEFILE_SECTOR_SIZE && head != 0 && frame_size != 0 &&
+        head % frame_size == 0 && head % sizeof(uint32_t) == 0) {
+        self->first_read_len = head;
+    }
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
@@ -175,7 +190,7 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
+        uint32_t num_bytes_to_load = self->bytes_remaining == self->file_length ? self->first_read_len : self->len;
         if (num_bytes_to_load > self->bytes_remaining) {
             num_bytes_to_load = self->bytes_remaining;
         }
@@ -191,7 +206,7 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         self->bytes_remaining -= length_read;
         // Pad the last buffer to word align it.
         if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
+            uint32_t pad = sizeof(uint32_t) - length_read % sizeof(uint32_t);
             length_read += pad;
             if (self->bits_per_sample == 8) {
                 for (uint32_t i = 0; i < pad; i++) {
@@ -240,7 +255,7 @@ void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t *self, bool si
     *single_buffer = false;
     // In WAV files, 8-bit samples are always unsigned, and larger samples are always signed.
     *samples_signed = self->bits_per_sample > 8;
-    *max_buffer_length = 512;
+    *max_buffer_length = self->len;
     if (single_channel_output) {
         *spacing = self->channel_count;
     } else {
@@ -11,6 +11,8 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+#define WAVEFILE_SECTOR_SIZE (512)
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t *buffer;
@@ -27,6 +29,8 @@ typedef struct {
     uint32_t sample_rate;
 
     uint32_t len;
+    // Length of the first read after a rewind, which ends on a sector boundary.
+    uint32_t first_read_len;
     pyb_file_obj_t *file;
 
     uint32_t read_count;
@@ -110,3 +110,82 @@ void audiosample_convert_s16m_s16s(int16_t *buffer_out, const int16_t *buffer_in
         *buffer_out++ = sample;
     }
 }
+
+static inline bool audiosample_word_aligned(const void *a, const void *b) {
+    return (((uintptr_t)a | (uintptr_t)b) & 3) == 0;
+}
+
+// The word-at-a-time loops below rely on samples being stored little endian,
+// which is true of every port that does audio.
+
+void audiosample_convert_8_8(uint8_t *buffer_out, const uint8_t *buffer_in, size_t nsamples, size_t spacing, uint8_t flip) {
+    if (spacing == 1 && audiosample_word_aligned(buffer_out, buffer_in)) {
+        uint32_t *out = (void *)buffer_out;
+        const uint32_t *in = (const void *)buffer_in;
+        uint32_t flip4 = flip * 0x01010101;
+        for (; nsamples >= 4; nsamples -= 4) {
+            *out++ = *in++ ^ flip4;
+        }
+        buffer_out = (uint8_t *)out;
+        buffer_in = (const uint8_t *)in;
+    }
+    for (; nsamples--; buffer_in += spacing) {
+        *buffer_out++ = *buffer_in ^ flip;
+    }
+}
+
+void audiosample_convert_8_16(uint16_t *buffer_out, const uint8_t *buffer_in, size_t nsamples, size_t spacing, uint8_t flip, uint16_t mul, uint16_t add) {
+    if (spacing == 1 && audiosample_word_aligned(buffer_out, buffer_in)) {
+        uint32_t *out = (void *)buffer_out;
+        const uint32_t *in = (const void *)buffer_in;
+        uint32_t flip4 = flip * 0x01010101;
+        for (; nsamples >= 4; nsamples -= 4) {
+            uint32_t w = *in++ ^ flip4;
+            uint16_t s0 = (w & 0xff) * mul + add;
+            uint16_t s1 = ((w >> 8) & 0xff) * mul + add;
+            uint16_t s2 = ((w >> 16) & 0xff) * mul + add;
+            uint16_t s3 = (w >> 24) * mul + add;
+            *out++ = s0 | (uint32_t)s1 << 16;
+            *out++ = s2 | (uint32_t)s3 << 16;
+        }
+        buffer_out = (uint16_t *)out;
+        buffer_in = (const uint8_t *)in;
+    }
+    for (; nsamples--; buffer_in += spacing) {
+        *buffer_out++ = (uint16_t)((*buffer_in ^ flip) * mul + add);
+    }
+}
+
+void audiosample_convert_16_16(uint16_t *buffer_out, const uint16_t *buffer_in, size_t nsamples, size_t spacing, uint16_t flip, uint8_t shift, bool output_signed) {
+    // A logical shift can be done on both halves of a word at once, but an
+    // arithmetic one can't, so signed output that needs shifting goes sample
+    // by sample.
+    if (spacing == 1 && (shift == 0 || !output_signed) &&
+        audiosample_word_aligned(buffer_out, buffer_in)) {
+        uint32_t *out = (void *)buffer_out;
+        const uint32_t *in = (const void *)buffer_in;
+        uint32_t flip2 = flip * 0x00010001;
+        uint32_t mask = (0xffffu >> shift) * 0x00010001;
+        for (; nsamples >= 2; nsamples -= 2) {
+            *out++ = ((*in++ ^ flip2) >> shift) & mask;
+        }
+        buffer_out = (uint16_t *)out;
+        buffer_in = (const uint16_t *)in;
+    }
+    if (output_signed) {
+        for (; nsamples--; buffer_in += spacing) {
+            *buffer_out++ = (uint16_t)((int16_t)(*buffer_in ^ flip) >> shift);
+        }
+    } else {
+        for (; nsamples--; buffer_in += spacing) {
+            *buffer_out++ = (uint16_t)(*buffer_in ^ flip) >> shift;
+        }
+    }
+}
+
+void audiosample_swap_channels_16(uint16_t *buffer, size_t nframes) {
+    uint32_t *frames = (void *)buffer;
+    for (; nframes--; frames++) {
+        *frames = (*frames >> 16) | (*frames << 16);
+    }
+}
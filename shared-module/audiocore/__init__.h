@@ -60,3 +60,15 @@ void audiosample_convert_s8s_s16s(int16_t *buffer_out, const int8_t *buffer_in,
 void audiosample_convert_u16m_s16s(int16_t *buffer_out, const uint16_t *buffer_in, size_t nframes);
 void audiosample_convert_u16s_s16s(int16_t *buffer_out, const uint16_t *buffer_in, size_t nframes);
 void audiosample_convert_s16m_s16s(int16_t *buffer_out, const int16_t *buffer_in, size_t nframes);
+
+// Converters for the ports' audio DMA output. Every spacing'th input sample
+// is used, so one channel can be taken from an interleaved buffer, and flip
+// is XORed into each sample to change its signedness. 8 bit samples are
+// widened to (sample ^ flip) * mul + add, and 16 bit samples are narrowed by
+// shifting them right.
+void audiosample_convert_8_8(uint8_t *buffer_out, const uint8_t *buffer_in, size_t nsamples, size_t spacing, uint8_t flip);
+void audiosample_convert_8_16(uint16_t *buffer_out, const uint8_t *buffer_in, size_t nsamples, size_t spacing, uint8_t flip, uint16_t mul, uint16_t add);
+void audiosample_convert_16_16(uint16_t *buffer_out, const uint16_t *buffer_in, size_t nsamples, size_t spacing, uint16_t flip, uint8_t shift, bool output_signed);
+// Swaps the left and right samples of each 16 bit stereo frame in place.
+// buffer must be word aligned.
+void audiosample_swap_channels_16(uint16_t *buffer, size_t nframes);
@@ -242,6 +242,23 @@ int16_t mix_down_sample(int32_t sample) {
     return sample;
 }
 
+static void load_sample_buffer(audiofilters_filter_obj_t *self) {
+    if (!self->more_data) { // The sample has indicated it has no more data to play
+        if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
+            audiosample_reset_buffer(self->sample, false, 0);
+        } else { // If we were not supposed to loop the sample, stop playing it
+            self->sample = NULL;
+        }
+    }
+    if (self->sample) {
+        // Load another sample buffer to play
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+        // Track length in terms of words.
+        self->sample_buffer_length /= (self->bits_per_sample / 8);
+        self->more_data = result == GET_BUFFER_MORE_DATA;
+    }
+}
+
 audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     (void)channel;
@@ -253,6 +270,24 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
     // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
     mp_float_t mix = MIN(1.0, MAX(synthio_block_slot_get(&self->mix), 0.0));
 
+    // When nothing is being filtered and the sample has a whole block ready,
+    // hand on the sample's own data instead of copying it into our buffer. The
+    // sample keeps it valid until it is asked for two more blocks, just as we
+    // do with ours.
+    if (mix <= 0.01 || !self->filter_states) {
+        if (self->sample != NULL && self->sample_buffer_length == 0) {
+            load_sample_buffer(self);
+        }
+        uint32_t block_length = self->buffer_len / (self->bits_per_sample / 8);
+        if (self->sample != NULL && self->sample_buffer_length >= block_length) {
+            *buffer = self->sample_remaining_buffer;
+            *buffer_length = self->buffer_len;
+            self->sample_remaining_buffer += self->buffer_len;
+            self->sample_buffer_length -= block_length;
+            return GET_BUFFER_MORE_DATA;
+        }
+    }
+
     // Switch our buffers to the other buffer
     self->last_buf_idx = !self->last_buf_idx;
 
@@ -265,20 +300,7 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
         if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                // Track length in terms of words.
-                self->sample_buffer_length /= (self->bits_per_sample / 8);
-                self->more_data = result == GET_BUFFER_MORE_DATA;
-            }
+            load_sample_buffer(self);
         }
 
         if (self->sample == NULL) {
@@ -333,9 +355,7 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                     }
 
                     // Process biquad filters
-                    for (uint8_t j = 0; j < self->filter_states_len; j++) {
-                        synthio_biquad_filter_samples(&self->filter_states[j], self->filter_buffer, n_samples);
-                    }
+                    synthio_biquad_filter_cascade(self->filter_states, self->filter_states_len, self->filter_buffer, n_samples);
 
                     // Mix processed signal with original sample and transfer to output buffer
                     for (uint32_t j = 0; j < n_samples; j++) {
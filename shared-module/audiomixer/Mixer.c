@@ -8,6 +8,7 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
@@ -16,6 +17,17 @@
 #include "cmsis_compiler.h"
 #endif
 
+// The DSP extension provides the SIMD instructions used below. Checking for
+// the feature rather than ARMv7E-M also covers Cortex-M33 cores that have it.
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define MIXER_HAVE_DSP (1)
+#else
+#define MIXER_HAVE_DSP (0)
+#endif
+
+// MixerVoice level for a gain of 1.0.
+#define UNITY_LEVEL (1 << 15)
+
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t voice_count,
     uint32_t buffer_size,
@@ -84,7 +96,7 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
 
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAVE_DSP
     return __QADD16(a, b);
     #else
     uint32_t result = 0;
@@ -105,7 +117,7 @@ static inline uint32_t add16signed(uint32_t a, uint32_t b) {
 
 __attribute__((always_inline))
 static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAVE_DSP
     mul <<= 16;
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
@@ -135,7 +147,7 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
 }
 
 static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAVE_DSP
     return __UADD8(val, 0x80808080);
     #else
     return val ^ 0x80808080;
@@ -143,7 +155,7 @@ static inline uint32_t tounsigned8(uint32_t val) {
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAVE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -151,7 +163,7 @@ static inline uint32_t tounsigned16(uint32_t val) {
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAVE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -195,7 +207,13 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         // First active voice gets copied over verbatim.
         if (!voices_active) {
             if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
+                if (level == UNITY_LEVEL && self->samples_signed) {
+                    memcpy(word_buffer, src, n * sizeof(uint32_t));
+                } else if (level == UNITY_LEVEL) {
+                    for (uint32_t i = 0; i < n; i++) {
+                        word_buffer[i] = tosigned16(src[i]);
+                    }
+                } else if (MP_LIKELY(self->samples_signed)) {
                     for (uint32_t i = 0; i < n; i++) {
                         uint32_t v = src[i];
                         word_buffer[i] = mult16signed(v, level);
@@ -221,7 +239,15 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
             }
         } else {
             if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
+                if (level == UNITY_LEVEL && self->samples_signed) {
+                    for (uint32_t i = 0; i < n; i++) {
+                        word_buffer[i] = add16signed(src[i], word_buffer[i]);
+                    }
+                } else if (level == UNITY_LEVEL) {
+                    for (uint32_t i = 0; i < n; i++) {
+                        word_buffer[i] = add16signed(tosigned16(src[i]), word_buffer[i]);
+                    }
+                } else if (MP_LIKELY(self->samples_signed)) {
                     for (uint32_t i = 0; i < n; i++) {
                         uint32_t word = src[i];
                         word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
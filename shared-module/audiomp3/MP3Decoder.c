@@ -233,7 +233,7 @@ static void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self, bool block_ok) {
     size -= to_consume;
 
     // Next, seek in the file after the header
-    if (stream_lseek(self->stream, SEEK_CUR, size) == 0) {
+    if (stream_lseek(self->stream, size, SEEK_CUR) >= 0) {
         return;
     }
 
@@ -352,7 +352,7 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     stream_set_blocking(self, true);
 
     self->other_channel = -1;
-    mp3file_update_inbuf_half(self, true);
+    mp3file_skip_id3v2(self, true);
     mp3file_find_sync_word(self, true);
     // It **SHOULD** not be necessary to do this; the buffer should be filled
     // with fresh content before it is returned by get_buffer().  The fact that
@@ -385,6 +385,41 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     self->frame_buffer_size = fi.outputSamps * sizeof(int16_t);
     self->len = 2 * self->frame_buffer_size;
     self->samples_decoded = 0;
+    self->bitrate = fi.bitrate;
+
+    // Remember where the first frame starts so seek() can compute file
+    // offsets from it. Streams that can't report a position can't seek.
+    off_t pos = stream_lseek(self->stream, 0, SEEK_CUR);
+    self->data_start = pos < 0 ? -1 : pos - BYTES_LEFT(self);
+}
+
+void common_hal_audiomp3_mp3file_seek(audiomp3_mp3file_obj_t *self, mp_float_t seconds) {
+    if (self->data_start < 0 || self->bitrate == 0) {
+        mp_raise_OSError(MP_EINVAL);
+    }
+    if (seconds < 0) {
+        seconds = 0;
+    }
+    // The offset is exact for constant bit rate files and an estimate for
+    // variable bit rate ones. Either way decoding resumes at the next frame,
+    // so nothing before it has to be read or decoded.
+    uint32_t frames = (uint32_t)(seconds * self->sample_rate * self->channel_count / (self->frame_buffer_size / sizeof(int16_t)));
+    uint32_t samples = frames * (self->frame_buffer_size / sizeof(int16_t));
+    off_t offset = self->data_start + (off_t)((uint64_t)samples * self->bitrate / 8 / self->sample_rate / self->channel_count);
+
+    background_callback_prevent();
+    off_t result = stream_lseek(self->stream, offset, SEEK_SET);
+    if (result >= 0) {
+        INPUT_BUFFER_CLEAR(self->inbuf);
+        self->eof = 0;
+        self->other_channel = -1;
+        self->samples_decoded = samples;
+        mp3file_find_sync_word(self, true);
+    }
+    background_callback_allow();
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
 }
 
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
@@ -430,7 +465,7 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
     background_callback_prevent();
-    if (self->eof && stream_lseek(self->stream, SEEK_SET, 0) == 0) {
+    if (self->eof && stream_lseek(self->stream, 0, SEEK_SET) == 0) {
         INPUT_BUFFER_CLEAR(self->inbuf);
         self->eof = 0;
         self->samples_decoded = 0;
@@ -42,6 +42,9 @@ typedef struct {
     int8_t other_buffer_index;
 
     uint32_t samples_decoded;
+    // Bits per second of the first frame, and the file offset of that frame.
+    uint32_t bitrate;
+    int32_t data_start;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
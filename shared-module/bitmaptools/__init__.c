@@ -20,6 +20,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(__arm__) && __arm__
+#include "cmsis_compiler.h"
+#endif
+
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
@@ -685,6 +689,28 @@ enum {
     SWAP_RB = 1 << 1,
 };
 
+// pixel must already have its bytes in order.
+static inline int rgb565_luma(uint16_t pixel, int swap) {
+    int r = (pixel >> 8) & 0xf8;
+    int g = (pixel >> 3) & 0xfc;
+    int b = (pixel << 3) & 0xf8;
+
+    if (swap & SWAP_RB) {
+        uint8_t tmp = r;
+        r = b;
+        b = tmp;
+    }
+
+    // ideal coefficients are around .299, .587, .114 (according to
+    // ppmtopnm), this differs from the 'other' luma-converting
+    // function in circuitpython (why?)
+
+    // we correct for the fact that the input ranges are 0..0xf8 (or
+    // 0xfc) rather than 0x00..0xff
+    // Check: (0xf8 *  78 + 0xfc * 154 + 0xf8 * 29) // 256 == 255
+    return (r * 78 + g * 154 + b * 29) / 256;
+}
+
 static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_data, int y, int mx) {
     if (y >= bitmap->height) {
         return;
@@ -708,24 +734,7 @@ static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
             if (swap & SWAP_BYTES) {
                 pixel = __builtin_bswap16(pixel);
             }
-            int r = (pixel >> 8) & 0xf8;
-            int g = (pixel >> 3) & 0xfc;
-            int b = (pixel << 3) & 0xf8;
-
-            if (swap & SWAP_RB) {
-                uint8_t tmp = r;
-                r = b;
-                b = tmp;
-            }
-
-            // ideal coefficients are around .299, .587, .114 (according to
-            // ppmtopnm), this differs from the 'other' luma-converting
-            // function in circuitpython (why?)
-
-            // we correct for the fact that the input ranges are 0..0xf8 (or
-            // 0xfc) rather than 0x00..0xff
-            // Check: (0xf8 *  78 + 0xfc * 154 + 0xf8 * 29) // 256 == 255
-            *luminance_data++ = (r * 78 + g * 154 + b * 29) / 256;
+            *luminance_data++ = rgb565_luma(pixel, swap);
         }
     }
 }
@@ -841,6 +850,74 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
     displayio_bitmap_set_dirty_area(dest_bitmap, &a);
 }
 
+void common_hal_bitmaptools_downsample(displayio_bitmap_t *dest_bitmap, displayio_bitmap_t *source_bitmap, displayio_colorspace_t colorspace, int x, int y, int factor) {
+    if (dest_bitmap->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    int swap = 0;
+    if (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
+        swap |= SWAP_BYTES;
+    }
+    if (colorspace == DISPLAYIO_COLORSPACE_BGR565 || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
+        swap |= SWAP_RB;
+    }
+    bool gray_source = source_bitmap->bits_per_value == 8;
+    bool gray_dest = dest_bitmap->bits_per_value == 8;
+    uint32_t area = factor * factor;
+
+    // Each destination pixel is the mean of a factor x factor block of the
+    // source, converted as it is read so the frame is only walked once.
+    for (int dy = 0; dy < dest_bitmap->height; dy++) {
+        uint8_t *dest8 = (uint8_t *)(dest_bitmap->data + dest_bitmap->stride * dy);
+        uint16_t *dest16 = (uint16_t *)(dest_bitmap->data + dest_bitmap->stride * dy);
+        int sy = y + dy * factor;
+        for (int dx = 0; dx < dest_bitmap->width; dx++) {
+            int sx = x + dx * factor;
+            // Luma or value when the destination is gray, otherwise R, G and B.
+            uint32_t sum0 = 0, sum1 = 0, sum2 = 0;
+            for (int j = 0; j < factor; j++) {
+                uint32_t *row = source_bitmap->data + source_bitmap->stride * (sy + j);
+                if (gray_source) {
+                    const uint8_t *src = (const uint8_t *)row + sx;
+                    for (int i = 0; i < factor; i++) {
+                        sum0 += src[i];
+                    }
+                    continue;
+                }
+                const uint16_t *src = (const uint16_t *)row + sx;
+                for (int i = 0; i < factor; i++) {
+                    uint16_t pixel = src[i];
+                    if (swap & SWAP_BYTES) {
+                        pixel = __builtin_bswap16(pixel);
+                    }
+                    if (gray_dest) {
+                        sum0 += rgb565_luma(pixel, swap);
+                    } else {
+                        sum0 += pixel >> 11;
+                        sum1 += (pixel >> 5) & 0x3f;
+                        sum2 += pixel & 0x1f;
+                    }
+                }
+            }
+            if (gray_dest) {
+                dest8[dx] = sum0 / area;
+            } else {
+                uint16_t pixel = (sum0 / area) << 11 | (sum1 / area) << 5 | (sum2 / area);
+                if (swap & SWAP_BYTES) {
+                    pixel = __builtin_bswap16(pixel);
+                }
+                dest16[dx] = pixel;
+            }
+        }
+        if (dy % 16 == 15) {
+            RUN_BACKGROUND_TASKS;
+        }
+    }
+
+    displayio_area_t a = { 0, 0, dest_bitmap->width, dest_bitmap->height, NULL };
+    displayio_bitmap_set_dirty_area(dest_bitmap, &a);
+}
+
 void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
     bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none) {
     displayio_area_t a = {0, 0, dest->width, dest->height, NULL};
@@ -1034,6 +1111,101 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Copy one row of 8 bit values, leaving destination values where the source
+// holds skip_value.
+static void blit_row_skip8(uint8_t *dest, const uint8_t *src, int count, uint8_t skip_value) {
+    int i = 0;
+    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    // Four values at a time: USUB8 sets a byte's GE flag when it differs from
+    // skip_value, and SEL then takes that byte from the source.
+    uint32_t skip_word = skip_value * 0x01010101u;
+    for (; i + 4 <= count; i += 4) {
+        uint32_t s, d;
+        memcpy(&s, src + i, 4);
+        memcpy(&d, dest + i, 4);
+        __USUB8(s ^ skip_word, 0x01010101u);
+        d = __SEL(s, d);
+        memcpy(dest + i, &d, 4);
+    }
+    #endif
+    for (; i < count; i++) {
+        if (src[i] != skip_value) {
+            dest[i] = src[i];
+        }
+    }
+}
+
+// The same for 16 bit values, two at a time.
+static void blit_row_skip16(uint16_t *dest, const uint16_t *src, int count, uint16_t skip_value) {
+    int i = 0;
+    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    uint32_t skip_word = skip_value * 0x00010001u;
+    for (; i + 2 <= count; i += 2) {
+        uint32_t s, d;
+        memcpy(&s, src + i, 4);
+        memcpy(&d, dest + i, 4);
+        __USUB16(s ^ skip_word, 0x00010001u);
+        d = __SEL(s, d);
+        memcpy(dest + i, &d, 4);
+    }
+    #endif
+    for (; i < count; i++) {
+        if (src[i] != skip_value) {
+            dest[i] = src[i];
+        }
+    }
+}
+
+// Blit between bitmaps of the same byte sized depth a row at a time, rather
+// than a pixel at a time. Returns false if the bitmaps don't qualify.
+static bool blit_rows(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none) {
+    uint8_t bytes_per_value = source->bits_per_value / 8;
+    if (bytes_per_value == 0 || destination->bits_per_value != source->bits_per_value) {
+        return false;
+    }
+    // Clip to the destination.
+    if (x < 0) {
+        x1 -= x;
+        x = 0;
+    }
+    if (y < 0) {
+        y1 -= y;
+        y = 0;
+    }
+    int count = MIN(x2 - x1, destination->width - x);
+    int rows = MIN(y2 - y1, destination->height - y);
+    if (count <= 0 || rows <= 0) {
+        return true;
+    }
+    if (skip_source_index > source->bitmask) {
+        // No value can match it.
+        skip_source_index_none = true;
+    }
+    // Skipping values one at a time has to run in the direction that keeps an
+    // overlapping copy within the same bitmap correct, so leave that to the
+    // pixel loop.
+    bool overlap = source == destination;
+    if (!skip_source_index_none && (overlap || bytes_per_value == 4)) {
+        return false;
+    }
+    // Walk rows bottom up when copying down within the same bitmap.
+    bool y_reverse = overlap && y > y1;
+    for (int j = 0; j < rows; j++) {
+        int row = y_reverse ? rows - j - 1 : j;
+        uint8_t *dest_row = (uint8_t *)(destination->data + (y + row) * destination->stride) + x * bytes_per_value;
+        const uint8_t *src_row = (const uint8_t *)(source->data + (y1 + row) * source->stride) + x1 * bytes_per_value;
+        if (skip_source_index_none) {
+            memmove(dest_row, src_row, count * bytes_per_value);
+        } else if (bytes_per_value == 1) {
+            blit_row_skip8(dest_row, src_row, count, skip_source_index);
+        } else {
+            blit_row_skip16((uint16_t *)dest_row, (const uint16_t *)src_row, count, skip_source_index);
+        }
+    }
+    return true;
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1070,6 +1242,11 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         y_reverse = true;
     }
 
+    if (skip_dest_index_none &&
+        blit_rows(destination, source, x, y, x1, y1, x2, y2, skip_source_index, skip_source_index_none)) {
+        return;
+    }
+
     // simplest version - use internal functions for get/set pixels
     for (int16_t i = 0; i < (x2 - x1); i++) {
 
@@ -44,6 +44,7 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
 
     // Turn off auto-refresh as we init.
     self->auto_refresh = false;
+    self->refresh_deadline.fun = NULL;
     uint16_t ram_width = 0x100;
     uint16_t ram_height = 0x100;
     if (single_byte_bounds) {
@@ -214,7 +215,7 @@ static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uin
 }
 
 static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+    uint16_t buffer_size = CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -374,12 +375,11 @@ bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj
 void common_hal_busdisplay_busdisplay_set_auto_refresh(busdisplay_busdisplay_obj_t *self,
     bool auto_refresh) {
     self->first_manual_refresh = !auto_refresh;
-    if (auto_refresh != self->auto_refresh) {
-        if (auto_refresh) {
-            supervisor_enable_tick();
-        } else {
-            supervisor_disable_tick();
-        }
+    if (auto_refresh) {
+        // Refresh on the next tick. Background refreshes schedule the following ones.
+        supervisor_deadline_set(&self->refresh_deadline, 0);
+    } else {
+        supervisor_deadline_cancel(&self->refresh_deadline);
     }
     self->auto_refresh = auto_refresh;
 }
@@ -393,9 +393,15 @@ mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_o
 }
 
 void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self) {
-    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
+    if (!self->auto_refresh) {
+        return;
+    }
+    uint64_t since_refresh = supervisor_ticks_ms64() - self->core.last_refresh;
+    if (since_refresh > self->native_ms_per_frame) {
         _refresh_display(self);
+        since_refresh = 0;
     }
+    supervisor_deadline_set_after_ms(&self->refresh_deadline, self->native_ms_per_frame + 1 - since_refresh);
 }
 
 void release_busdisplay(busdisplay_busdisplay_obj_t *self) {
@@ -15,6 +15,7 @@
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/bus_core.h"
 #include "shared-module/displayio/display_core.h"
+#include "supervisor/shared/tick.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -27,6 +28,8 @@ typedef struct {
         #endif
     };
     uint64_t last_refresh_call;
+    // Wakes the supervisor for the next auto refresh.
+    supervisor_deadline_t refresh_deadline;
     mp_float_t current_brightness;
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
@@ -0,0 +1,141 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared-bindings/countio/Counter.h"
+#include "shared-bindings/countio/CountRecorder.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/shared/trace.h"
+
+static void countrecorder_due(void);
+
+// One deadline for all the recorders, set for whichever is due first.
+static supervisor_deadline_t countrecorder_deadline = { .fun = countrecorder_due };
+
+static void countrecorder_store(countio_countrecorder_obj_t *self, mp_int_t delta) {
+    size_t i = self->recorded % self->len;
+    switch (self->itemsize) {
+        case 1:
+            ((uint8_t *)self->buffer)[i] = MIN(delta, UINT8_MAX);
+            break;
+        case 2:
+            ((uint16_t *)self->buffer)[i] = MIN(delta, UINT16_MAX);
+            break;
+        default:
+            ((uint32_t *)self->buffer)[i] = delta;
+            break;
+    }
+    self->recorded++;
+    trace_event(TRACE_EVENT_COUNT, MIN(delta, UINT16_MAX));
+}
+
+// Called from supervisor_tick, so from an interrupt on most ports.
+static void countrecorder_due(void) {
+    uint64_t now = port_get_raw_ticks(NULL);
+    bool any = false;
+    uint64_t next = UINT64_MAX;
+    for (countio_countrecorder_obj_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(countio_recorders)); self != NULL; self = self->next) {
+        if (!self->running) {
+            continue;
+        }
+        if (common_hal_countio_counter_deinited(self->counter)) {
+            self->running = false;
+            continue;
+        }
+        if (self->next_ticks <= now) {
+            mp_int_t count = common_hal_countio_counter_get_count(self->counter);
+            // The count can be set from Python, so never store a negative number of edges.
+            self->last_delta = MAX(count - self->last_count, 0);
+            self->last_count = count;
+            countrecorder_store(self, self->last_delta);
+            self->next_ticks += self->interval_ticks;
+            if (self->next_ticks <= now) {
+                // Intervals that were missed are skipped, not recorded as zero.
+                self->next_ticks = now + self->interval_ticks;
+            }
+        }
+        any = true;
+        next = MIN(next, self->next_ticks);
+    }
+    if (any) {
+        supervisor_deadline_set(&countrecorder_deadline, next);
+    }
+}
+
+void common_hal_countio_countrecorder_construct(countio_countrecorder_obj_t *self,
+    countio_counter_obj_t *counter, mp_obj_t buffer_obj, void *buffer, size_t len, size_t itemsize,
+    uint32_t interval_ticks) {
+    self->counter = counter;
+    self->buffer_obj = buffer_obj;
+    self->buffer = buffer;
+    self->len = len;
+    self->itemsize = itemsize;
+    self->interval_ticks = interval_ticks;
+    self->last_count = common_hal_countio_counter_get_count(counter);
+    self->last_delta = 0;
+    self->recorded = 0;
+
+    common_hal_mcu_disable_interrupts();
+    self->next_ticks = port_get_raw_ticks(NULL) + interval_ticks;
+    self->running = true;
+    self->next = MP_OBJ_TO_PTR(MP_STATE_VM(countio_recorders));
+    MP_STATE_VM(countio_recorders) = MP_OBJ_FROM_PTR(self);
+    if (!countrecorder_deadline.pending || self->next_ticks < countrecorder_deadline.ticks) {
+        supervisor_deadline_set(&countrecorder_deadline, self->next_ticks);
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+bool common_hal_countio_countrecorder_deinited(countio_countrecorder_obj_t *self) {
+    return self->buffer == NULL;
+}
+
+void common_hal_countio_countrecorder_deinit(countio_countrecorder_obj_t *self) {
+    if (common_hal_countio_countrecorder_deinited(self)) {
+        return;
+    }
+    common_hal_mcu_disable_interrupts();
+    if (MP_OBJ_TO_PTR(MP_STATE_VM(countio_recorders)) == self) {
+        MP_STATE_VM(countio_recorders) = MP_OBJ_FROM_PTR(self->next);
+    } else {
+        countio_countrecorder_obj_t *prev = MP_OBJ_TO_PTR(MP_STATE_VM(countio_recorders));
+        while (prev != NULL && prev->next != self) {
+            prev = prev->next;
+        }
+        if (prev != NULL) {
+            prev->next = self->next;
+        }
+    }
+    if (MP_STATE_VM(countio_recorders) == MP_OBJ_NULL) {
+        supervisor_deadline_cancel(&countrecorder_deadline);
+    }
+    self->running = false;
+    self->buffer = NULL;
+    self->buffer_obj = MP_OBJ_NULL;
+    common_hal_mcu_enable_interrupts();
+}
+
+void countio_countrecorder_reset(void) {
+    supervisor_deadline_cancel(&countrecorder_deadline);
+    MP_STATE_VM(countio_recorders) = MP_OBJ_NULL;
+}
+
+mp_float_t common_hal_countio_countrecorder_get_interval(countio_countrecorder_obj_t *self) {
+    return self->interval_ticks / MICROPY_FLOAT_CONST(1024.0);
+}
+
+size_t common_hal_countio_countrecorder_get_recorded(countio_countrecorder_obj_t *self) {
+    return self->recorded;
+}
+
+mp_float_t common_hal_countio_countrecorder_get_frequency(countio_countrecorder_obj_t *self) {
+    return self->last_delta * MICROPY_FLOAT_CONST(1024.0) / self->interval_ticks;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t countio_recorders);
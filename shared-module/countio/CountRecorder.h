@@ -0,0 +1,30 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "common-hal/countio/Counter.h"
+
+typedef struct _countio_countrecorder_obj_t {
+    mp_obj_base_t base;
+    countio_counter_obj_t *counter;
+    // Kept so the buffer isn't collected while it is written to.
+    mp_obj_t buffer_obj;
+    void *buffer;
+    size_t len;
+    uint8_t itemsize;
+    bool running;
+    uint32_t interval_ticks;
+    uint64_t next_ticks;
+    mp_int_t last_count;
+    // Edges in the last complete interval.
+    mp_int_t last_delta;
+    size_t recorded;
+    struct _countio_countrecorder_obj_t *next;
+} countio_countrecorder_obj_t;
+
+void countio_countrecorder_reset(void);
@@ -0,0 +1,209 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared/runtime/interrupt_char.h"
+#include "shared-bindings/digitalio/PinGroup.h"
+#include "shared-bindings/microcontroller/__init__.h"
+
+// Ports that can't give the registers behind a pin write every pin separately.
+MP_WEAK bool common_hal_digitalio_has_reg_op(digitalinout_reg_op_t op) {
+    return false;
+}
+
+MP_WEAK volatile uint32_t *common_hal_digitalio_digitalinout_get_reg(digitalio_digitalinout_obj_t *self, digitalinout_reg_op_t op, uint32_t *mask) {
+    return NULL;
+}
+
+static void pingroup_find_port(digitalio_pingroup_obj_t *self, digitalio_pingroup_pin_t *pin) {
+    pin->port_bit = 0;
+    if (!common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_READ) ||
+        !common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_WRITE)) {
+        return;
+    }
+    uint32_t bit;
+    volatile uint32_t *out_reg = common_hal_digitalio_digitalinout_get_reg(&pin->dio, DIGITALINOUT_REG_WRITE, &bit);
+    volatile uint32_t *in_reg = common_hal_digitalio_digitalinout_get_reg(&pin->dio, DIGITALINOUT_REG_READ, &bit);
+    if (out_reg == NULL || in_reg == NULL) {
+        return;
+    }
+    size_t port = 0;
+    while (port < self->num_ports && self->ports[port].out_reg != out_reg) {
+        port++;
+    }
+    if (port == self->num_ports) {
+        if (port == DIGITALIO_PINGROUP_MAX_PORTS) {
+            return;
+        }
+        self->ports[port].out_reg = out_reg;
+        self->ports[port].in_reg = in_reg;
+        self->ports[port].mask = 0;
+        self->num_ports++;
+    }
+    self->ports[port].mask |= bit;
+    pin->port = port;
+    pin->port_bit = bit;
+}
+
+void common_hal_digitalio_pingroup_construct(digitalio_pingroup_obj_t *self, const mcu_pin_obj_t **pins, size_t num_pins) {
+    self->num_pins = num_pins;
+    self->num_ports = 0;
+    self->output = false;
+    self->use_regs = false;
+    for (size_t i = 0; i < num_pins; i++) {
+        common_hal_digitalio_digitalinout_construct(&self->pins[i].dio, pins[i]);
+        pingroup_find_port(self, &self->pins[i]);
+    }
+
+    self->shift = -1;
+    if (self->num_ports == 1 && self->pins[0].port_bit != 0) {
+        int8_t shift = __builtin_ctz(self->pins[0].port_bit);
+        bool contiguous = true;
+        for (size_t i = 0; i < num_pins; i++) {
+            if (self->pins[i].port_bit != (self->pins[0].port_bit << i)) {
+                contiguous = false;
+                break;
+            }
+        }
+        if (contiguous) {
+            self->shift = shift;
+        }
+    }
+}
+
+bool common_hal_digitalio_pingroup_deinited(digitalio_pingroup_obj_t *self) {
+    return self->num_pins == 0;
+}
+
+void common_hal_digitalio_pingroup_deinit(digitalio_pingroup_obj_t *self) {
+    for (size_t i = 0; i < self->num_pins; i++) {
+        common_hal_digitalio_digitalinout_deinit(&self->pins[i].dio);
+    }
+    self->num_pins = 0;
+}
+
+digitalinout_result_t common_hal_digitalio_pingroup_switch_to_input(digitalio_pingroup_obj_t *self, digitalio_pull_t pull) {
+    self->output = false;
+    self->use_regs = false;
+    for (size_t i = 0; i < self->num_pins; i++) {
+        digitalinout_result_t result = common_hal_digitalio_digitalinout_switch_to_input(&self->pins[i].dio, pull);
+        if (result != DIGITALINOUT_OK) {
+            return result;
+        }
+    }
+    return DIGITALINOUT_OK;
+}
+
+digitalinout_result_t common_hal_digitalio_pingroup_switch_to_output(digitalio_pingroup_obj_t *self, uint32_t value, digitalio_drive_mode_t drive_mode) {
+    for (size_t i = 0; i < self->num_pins; i++) {
+        digitalinout_result_t result = common_hal_digitalio_digitalinout_switch_to_output(&self->pins[i].dio, (value >> i) & 1, drive_mode);
+        if (result != DIGITALINOUT_OK) {
+            return result;
+        }
+    }
+    self->output = true;
+    self->use_regs = drive_mode == DRIVE_MODE_PUSH_PULL;
+    return DIGITALINOUT_OK;
+}
+
+bool common_hal_digitalio_pingroup_get_output(digitalio_pingroup_obj_t *self) {
+    return self->output;
+}
+
+uint32_t common_hal_digitalio_pingroup_get_value(digitalio_pingroup_obj_t *self) {
+    // Sample every port first so the pins are read together.
+    uint32_t port_values[DIGITALIO_PINGROUP_MAX_PORTS];
+    for (size_t p = 0; p < self->num_ports; p++) {
+        // Outputs read back what was last written.
+        port_values[p] = self->output ? *self->ports[p].out_reg : *self->ports[p].in_reg;
+    }
+    if (self->shift >= 0) {
+        return (port_values[0] & self->ports[0].mask) >> self->shift;
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < self->num_pins; i++) {
+        digitalio_pingroup_pin_t *pin = &self->pins[i];
+        bool bit;
+        if (pin->port_bit != 0) {
+            bit = (port_values[pin->port] & pin->port_bit) != 0;
+        } else {
+            bit = common_hal_digitalio_digitalinout_get_value(&pin->dio);
+        }
+        value |= (uint32_t)bit << i;
+    }
+    return value;
+}
+
+// Writes to the output registers with interrupts off, so all of a port's pins
+// change on the same cycle and nothing else writes the port in between.
+static inline void pingroup_write_ports(digitalio_pingroup_obj_t *self, const uint32_t *set, const uint32_t *clear) {
+    common_hal_mcu_disable_interrupts();
+    for (size_t p = 0; p < self->num_ports; p++) {
+        if ((set[p] | clear[p]) != 0) {
+            volatile uint32_t *out_reg = self->ports[p].out_reg;
+            *out_reg = (*out_reg & ~clear[p]) | set[p];
+        }
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+void common_hal_digitalio_pingroup_write(digitalio_pingroup_obj_t *self, uint32_t value, uint32_t mask) {
+    uint32_t set[DIGITALIO_PINGROUP_MAX_PORTS] = { 0 };
+    uint32_t clear[DIGITALIO_PINGROUP_MAX_PORTS] = { 0 };
+    if (self->use_regs && self->shift >= 0) {
+        set[0] = ((value & mask) << self->shift) & self->ports[0].mask;
+        clear[0] = ((~value & mask) << self->shift) & self->ports[0].mask;
+    } else {
+        for (size_t i = 0; i < self->num_pins; i++) {
+            if (((mask >> i) & 1) == 0) {
+                continue;
+            }
+            digitalio_pingroup_pin_t *pin = &self->pins[i];
+            bool bit = (value >> i) & 1;
+            if (self->use_regs && pin->port_bit != 0) {
+                if (bit) {
+                    set[pin->port] |= pin->port_bit;
+                } else {
+                    clear[pin->port] |= pin->port_bit;
+                }
+            } else {
+                common_hal_digitalio_digitalinout_set_value(&pin->dio, bit);
+            }
+        }
+        if (!self->use_regs) {
+            return;
+        }
+    }
+    pingroup_write_ports(self, set, clear);
+}
+
+void common_hal_digitalio_pingroup_write_sequence(digitalio_pingroup_obj_t *self, const void *values, size_t len, size_t itemsize, uint32_t delay_us) {
+    const uint32_t all = self->num_pins == 32 ? 0xffffffff : (1u << self->num_pins) - 1;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t value;
+        switch (itemsize) {
+            case 1:
+                value = ((const uint8_t *)values)[i];
+                break;
+            case 2:
+                value = ((const uint16_t *)values)[i];
+                break;
+            default:
+                value = ((const uint32_t *)values)[i];
+                break;
+        }
+        common_hal_digitalio_pingroup_write(self, value, all);
+        if (delay_us != 0) {
+            common_hal_mcu_delay_us(delay_us);
+        }
+        // Long sequences can still be stopped with ctrl-C.
+        if ((i & 0xff) == 0xff && mp_hal_is_interrupted()) {
+            return;
+        }
+    }
+}
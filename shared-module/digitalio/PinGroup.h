@@ -0,0 +1,43 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "common-hal/digitalio/DigitalInOut.h"
+
+#define DIGITALIO_PINGROUP_MAX_PINS (32)
+// Pins on more output registers than this are written one at a time.
+#define DIGITALIO_PINGROUP_MAX_PORTS (4)
+
+typedef struct {
+    volatile uint32_t *out_reg;
+    volatile uint32_t *in_reg;
+    // The bits of all the group's pins on this port.
+    uint32_t mask;
+} digitalio_pingroup_port_t;
+
+typedef struct {
+    digitalio_digitalinout_obj_t dio;
+    // The pin's bit in its port's registers, or 0 if it is written through dio.
+    uint32_t port_bit;
+    uint8_t port;
+} digitalio_pingroup_pin_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    digitalio_pingroup_port_t ports[DIGITALIO_PINGROUP_MAX_PORTS];
+    uint8_t num_ports;
+    uint8_t num_pins;
+    // If all pins are consecutive bits of one port, in order, the bit of the
+    // first pin. A group value is then moved to the port with one shift.
+    int8_t shift;
+    bool output;
+    // Outputs are written through the port registers. Not for open drain,
+    // which some ports emulate by switching direction.
+    bool use_regs;
+    digitalio_pingroup_pin_t pins[];
+} digitalio_pingroup_obj_t;
@@ -6,11 +6,11 @@
 
 #include "shared-bindings/displayio/ColorConverter.h"
 
+#include <string.h>
+
 #include "py/misc.h"
 #include "py/runtime.h"
 
-#define NO_TRANSPARENT_COLOR (0x1000000)
-
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n) {
     n = (n >> 13) ^ n;
     int nn = (n * (n * n * 60493 + 19990303) + 1376312589) & 0x7fffffff;
@@ -26,6 +26,7 @@ void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *s
     self->transparent_color = NO_TRANSPARENT_COLOR;
     self->input_colorspace = input_colorspace;
     self->output_colorspace.depth = 16;
+    self->cached_colorspace = NULL;
 }
 
 uint16_t displayio_colorconverter_compute_rgb565(uint32_t color_rgb888) {
@@ -315,6 +316,33 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
+static void _cache_use_colorspace(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->cached_colorspace != colorspace) {
+        memset(self->cache_valid, 0, sizeof(self->cache_valid));
+        self->cached_colorspace = colorspace;
+    }
+}
+
+static size_t _cache_index(uint32_t pixel) {
+    // Multiplicative hashing spreads similar colors, such as those of a
+    // gradient, over the entries.
+    return ((pixel * 2654435761u) >> 16) % CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE;
+}
+
+static bool _cache_lookup(displayio_colorconverter_t *self, size_t index, uint32_t pixel, uint32_t *output_color) {
+    if ((self->cache_valid[index / 32] & (1u << (index % 32))) == 0 || self->cache[index].input_pixel != pixel) {
+        return false;
+    }
+    *output_color = self->cache[index].output_color;
+    return true;
+}
+
+static void _cache_store(displayio_colorconverter_t *self, size_t index, uint32_t pixel, uint32_t output_color) {
+    self->cache[index].input_pixel = pixel;
+    self->cache[index].output_color = output_color;
+    self->cache_valid[index / 32] |= 1u << (index % 32);
+}
+
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
 
@@ -323,19 +351,49 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
         return;
     }
 
-    if (!self->dither && self->cached_colorspace == colorspace && self->cached_input_pixel == input_pixel->pixel) {
-        output_color->pixel = self->cached_output_color;
-        return;
+    // Dithered colors depend on the pixel's position, so they can't be cached.
+    size_t index = 0;
+    if (!self->dither) {
+        _cache_use_colorspace(self, colorspace);
+        index = _cache_index(pixel);
+        if (_cache_lookup(self, index, pixel, &output_color->pixel)) {
+            output_color->opaque = true;
+            return;
+        }
     }
 
     displayio_input_pixel_t rgb888_pixel = *input_pixel;
     rgb888_pixel.pixel = displayio_colorconverter_convert_pixel(self->input_colorspace, input_pixel->pixel);
     displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
 
-    if (!self->dither) {
-        self->cached_colorspace = colorspace;
-        self->cached_input_pixel = input_pixel->pixel;
-        self->cached_output_color = output_color->pixel;
+    if (!self->dither && output_color->opaque) {
+        _cache_store(self, index, pixel, output_color->pixel);
+    }
+}
+
+bool displayio_colorconverter_can_convert_row16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    return colorspace->depth == 16 && !self->dither && self->transparent_color == NO_TRANSPARENT_COLOR;
+}
+
+void displayio_colorconverter_convert_row16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const uint32_t *input, uint16_t *output, size_t count) {
+    _cache_use_colorspace(self, colorspace);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t pixel = input[i];
+        // Runs of one color are common, so check the previous pixel first.
+        if (i > 0 && pixel == input[i - 1]) {
+            output[i] = output[i - 1];
+            continue;
+        }
+        size_t index = _cache_index(pixel);
+        uint32_t color;
+        if (!_cache_lookup(self, index, pixel, &color)) {
+            color = displayio_colorconverter_compute_rgb565(displayio_colorconverter_convert_pixel(self->input_colorspace, pixel));
+            if (colorspace->reverse_bytes_in_word) {
+                color = __builtin_bswap16(color);
+            }
+            _cache_store(self, index, pixel, color);
+        }
+        output[i] = color;
     }
 }
 
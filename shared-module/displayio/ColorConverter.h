@@ -12,6 +12,13 @@
 #include "py/obj.h"
 #include "shared-module/displayio/Palette.h"
 
+#define NO_TRANSPARENT_COLOR (0x1000000)
+
+typedef struct {
+    uint32_t input_pixel;
+    uint32_t output_color;
+} displayio_colorconverter_cache_entry_t;
+
 typedef struct displayio_colorconverter {
     mp_obj_base_t base;
     bool dither;
@@ -19,15 +26,21 @@ typedef struct displayio_colorconverter {
     _displayio_colorspace_t output_colorspace;
     uint32_t transparent_color;
 
-    // Cache the last computed color in case the are the same.
+    // Recently computed colors, indexed by a hash of the input pixel. The
+    // entries are for cached_colorspace, and cache_valid has a bit for each.
     const _displayio_colorspace_t *cached_colorspace;
-    uint32_t cached_input_pixel;
-    uint32_t cached_output_color;
+    uint32_t cache_valid[(CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE + 31) / 32];
+    displayio_colorconverter_cache_entry_t cache[CIRCUITPY_DISPLAYIO_COLORCONVERTER_CACHE_SIZE];
 } displayio_colorconverter_t;
 
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
+// Whether displayio_colorconverter_convert_row16() can be used: the display is
+// 16 bit and every pixel converts to an opaque color independent of position.
+bool displayio_colorconverter_can_convert_row16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace);
+// Converts count input pixels to 16 bit display colors.
+void displayio_colorconverter_convert_row16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const uint32_t *input, uint16_t *output, size_t count);
 
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n);
 uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y);
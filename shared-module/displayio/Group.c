@@ -366,7 +366,53 @@ void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members,
     self->readonly = false;
 }
 
+void displayio_group_update_bounds(displayio_group_t *self) {
+    self->bounds.x1 = 0;
+    self->bounds.x2 = 0;
+    self->bounds.y1 = 0;
+    self->bounds.y2 = 0;
+    if (self->hidden) {
+        return;
+    }
+    for (int32_t i = self->members->len - 1; i >= 0; i--) {
+        mp_obj_t layer;
+        displayio_area_t layer_area;
+        #if CIRCUITPY_VECTORIO
+        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
+        if (draw_protocol != NULL) {
+            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
+            draw_protocol->draw_protocol_impl->draw_get_dirty_area(layer, &layer_area);
+            displayio_area_union(&self->bounds, &layer_area, &self->bounds);
+            continue;
+        }
+        #endif
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_tilegrid_t *tilegrid = layer;
+            if (!tilegrid->hidden && !tilegrid->hidden_by_parent) {
+                displayio_area_union(&self->bounds, &tilegrid->current_area, &self->bounds);
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_group_t *group = layer;
+            displayio_group_update_bounds(group);
+            displayio_area_union(&self->bounds, &group->bounds, &self->bounds);
+            continue;
+        }
+    }
+}
+
 bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    // Skip the whole subtree when none of it overlaps the area. This keeps
+    // small updates cheap in groups with many layers.
+    displayio_area_t overlap;
+    if (!displayio_area_compute_overlap(area, &self->bounds, &overlap)) {
+        return false;
+    }
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     if (self->hidden == false) {
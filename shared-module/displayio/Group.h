@@ -19,6 +19,7 @@ typedef struct {
     mp_obj_list_t *members;
     displayio_buffer_transform_t absolute_transform;
     displayio_area_t dirty_area; // Catch all for changed area
+    displayio_area_t bounds; // Union of the layers' areas, updated for each refresh
     int16_t x;
     int16_t y;
     uint16_t scale;
@@ -36,4 +37,5 @@ bool displayio_group_get_previous_area(displayio_group_t *group, displayio_area_
 bool displayio_group_fill_area(displayio_group_t *group, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 void displayio_group_update_transform(displayio_group_t *group, const displayio_buffer_transform_t *parent_transform);
 void displayio_group_finish_refresh(displayio_group_t *self);
+void displayio_group_update_bounds(displayio_group_t *self);
 displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_t *tail);
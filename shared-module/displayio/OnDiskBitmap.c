@@ -15,6 +15,10 @@
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
+// Bytes of rows to read at once. Displays fill areas from the top down,
+// which is backwards through the file, so a read covers the rows below.
+#define ROW_CACHE_SIZE (2048)
+
 static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
@@ -126,6 +130,31 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->row_cache_count = 0;
+    self->row_cache_capacity = MAX(1, MIN(ROW_CACHE_SIZE / self->stride, MIN(self->height, 255)));
+    self->row_cache = m_malloc_maybe(self->row_cache_capacity * self->stride);
+}
+
+// Returns the file data for row y, reading it and the rows below it when needed.
+static const uint8_t *get_row(displayio_ondiskbitmap_t *self, int16_t y) {
+    if (self->row_cache == NULL) {
+        return NULL;
+    }
+    if (self->row_cache_count == 0 || y < self->row_cache_y || y >= self->row_cache_y + self->row_cache_count) {
+        uint16_t count = MIN(self->row_cache_capacity, self->height - y);
+        // Rows are stored bottom up, so the last row we want comes first.
+        uint32_t location = self->data_offset + (self->height - y - count) * self->stride;
+        self->row_cache_count = 0;
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        if (f_read(&self->file->fp, self->row_cache, count * self->stride, &bytes_read) != FR_OK ||
+            bytes_read != count * self->stride) {
+            return NULL;
+        }
+        self->row_cache_y = y;
+        self->row_cache_count = count;
+    }
+    return self->row_cache + (self->row_cache_count - 1 - (y - self->row_cache_y)) * self->stride;
 }
 
 
@@ -143,11 +172,16 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result = FR_OK;
+    const uint8_t *row = get_row(self, y);
+    if (row != NULL) {
+        memcpy(&pixel_data, row + location - (self->data_offset + (self->height - y - 1) * self->stride), bytes_per_pixel);
+    } else {
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
@@ -28,6 +28,12 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    // Raw file data for rows row_cache_y to row_cache_y + row_cache_count - 1,
+    // or NULL if it couldn't be allocated.
+    uint8_t *row_cache;
+    uint16_t row_cache_y;
+    uint8_t row_cache_count;
+    uint8_t row_cache_capacity;
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
@@ -361,6 +361,58 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Whether a 16 bit bitmap can be copied straight into a 16 bit display buffer:
+// it's already RGB565 in the display's byte order, or only needs its bytes
+// swapped, and it has no transparency. Returns -1 if not, otherwise whether
+// to swap bytes.
+static int8_t _rgb565_copy_mode(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace) {
+    if (colorspace->depth != 16 || !mp_obj_is_type(self->bitmap, &displayio_bitmap_type) ||
+        ((displayio_bitmap_t *)self->bitmap)->bits_per_value != 16) {
+        return -1;
+    }
+    if (self->pixel_shader == mp_const_none) {
+        return 0;
+    }
+    if (!mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return -1;
+    }
+    displayio_colorconverter_t *converter = self->pixel_shader;
+    if (converter->dither || converter->transparent_color != NO_TRANSPARENT_COLOR) {
+        return -1;
+    }
+    if (converter->input_colorspace == DISPLAYIO_COLORSPACE_RGB565) {
+        return colorspace->reverse_bytes_in_word;
+    } else if (converter->input_colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) {
+        return !colorspace->reverse_bytes_in_word;
+    }
+    return -1;
+}
+
+// Whether any of the mask bits from start to start + count are set.
+static bool _mask_span_any(const uint32_t *mask, uint32_t start, uint32_t count) {
+    uint32_t end = start + count;
+    while (start < end) {
+        uint32_t bit = start % 32;
+        uint32_t n = MIN(32 - bit, end - start);
+        uint32_t bits = (n == 32 ? 0xffffffff : ((1u << n) - 1)) << bit;
+        if ((mask[start / 32] & bits) != 0) {
+            return true;
+        }
+        start += n;
+    }
+    return false;
+}
+
+static void _mask_span_set(uint32_t *mask, uint32_t start, uint32_t count) {
+    uint32_t end = start + count;
+    while (start < end) {
+        uint32_t bit = start % 32;
+        uint32_t n = MIN(32 - bit, end - start);
+        mask[start / 32] |= (n == 32 ? 0xffffffff : ((1u << n) - 1)) << bit;
+        start += n;
+    }
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -448,6 +500,83 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    // Do whole rows at once when a single tile shows an entire bitmap unscaled
+    // and in its own orientation, such as a full screen background image.
+    bool whole_rows = mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        x_stride == 1 && y_stride > 0 && self->absolute_transform->scale == 1 &&
+        self->transpose_xy == self->absolute_transform->transpose_xy &&
+        self->width_in_tiles == 1 && self->height_in_tiles == 1 && tiles[0] == 0 &&
+        self->tile_width == ((displayio_bitmap_t *)self->bitmap)->width &&
+        self->tile_height == ((displayio_bitmap_t *)self->bitmap)->height;
+    // RGB565 bitmaps can be copied.
+    int8_t copy_mode = whole_rows ? _rgb565_copy_mode(self, colorspace) : -1;
+    if (copy_mode >= 0) {
+        displayio_bitmap_t *bitmap = self->bitmap;
+        uint16_t count = end_x - start_x;
+        for (int16_t y = start_y; y < end_y; y++) {
+            uint32_t offset = start + (y - start_y + y_shift) * y_stride + x_shift;
+            const uint16_t *src = (const uint16_t *)(bitmap->data + y * bitmap->stride) + start_x;
+            uint16_t *dest = ((uint16_t *)buffer) + offset;
+            if (!_mask_span_any(mask, offset, count)) {
+                if (copy_mode == 0) {
+                    memcpy(dest, src, count * sizeof(uint16_t));
+                } else {
+                    for (uint16_t i = 0; i < count; i++) {
+                        dest[i] = __builtin_bswap16(src[i]);
+                    }
+                }
+                _mask_span_set(mask, offset, count);
+                continue;
+            }
+            // A layer above covers part of this row.
+            for (uint16_t i = 0; i < count; i++) {
+                uint32_t o = offset + i;
+                if ((mask[o / 32] & (1 << (o % 32))) == 0) {
+                    dest[i] = copy_mode == 0 ? src[i] : __builtin_bswap16(src[i]);
+                    mask[o / 32] |= 1 << (o % 32);
+                }
+            }
+        }
+        return full_coverage;
+    }
+    // Other bitmaps, such as photos, can be converted a row at a time.
+    if (whole_rows && mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+        displayio_colorconverter_can_convert_row16(self->pixel_shader, colorspace)) {
+        displayio_bitmap_t *bitmap = self->bitmap;
+        displayio_colorconverter_t *converter = self->pixel_shader;
+        uint16_t count = end_x - start_x;
+        uint32_t input[32];
+        uint16_t output[MP_ARRAY_SIZE(input)];
+        for (int16_t y = start_y; y < end_y; y++) {
+            uint32_t offset = start + (y - start_y + y_shift) * y_stride + x_shift;
+            uint16_t *dest = ((uint16_t *)buffer) + offset;
+            bool covered = _mask_span_any(mask, offset, count);
+            for (uint16_t x = 0; x < count; x += MP_ARRAY_SIZE(input)) {
+                uint16_t n = MIN(MP_ARRAY_SIZE(input), (size_t)(count - x));
+                for (uint16_t i = 0; i < n; i++) {
+                    input[i] = common_hal_displayio_bitmap_get_pixel(bitmap, start_x + x + i, y);
+                }
+                if (!covered) {
+                    displayio_colorconverter_convert_row16(converter, colorspace, input, dest + x, n);
+                    continue;
+                }
+                // A layer above covers part of this row.
+                displayio_colorconverter_convert_row16(converter, colorspace, input, output, n);
+                for (uint16_t i = 0; i < n; i++) {
+                    uint32_t o = offset + x + i;
+                    if ((mask[o / 32] & (1 << (o % 32))) == 0) {
+                        dest[x + i] = output[i];
+                        mask[o / 32] |= 1 << (o % 32);
+                    }
+                }
+            }
+            if (!covered) {
+                _mask_span_set(mask, offset, count);
+            }
+        }
+        return full_coverage;
+    }
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
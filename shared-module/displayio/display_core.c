@@ -12,6 +12,8 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "supervisor/shared/display.h"
+#include "supervisor/shared/perf.h"
+#include "supervisor/shared/trace.h"
 #include "supervisor/shared/tick.h"
 
 #include <stdint.h>
@@ -145,7 +147,14 @@ bool displayio_display_core_start_refresh(displayio_display_core_t *self) {
         return false;
     }
     self->refresh_in_progress = true;
+    trace_event(TRACE_EVENT_DISPLAY_START, 0);
+    #if CIRCUITPY_PERF_COUNTERS
+    self->refresh_start_cycles = perf_begin();
+    #endif
     self->last_refresh = supervisor_ticks_ms64();
+    if (self->current_group != NULL) {
+        displayio_group_update_bounds(self->current_group);
+    }
     return true;
 }
 
@@ -154,6 +163,12 @@ void displayio_display_core_finish_refresh(displayio_display_core_t *self) {
         DISPLAYIO_CORE_DEBUG("displayiocore group_finish_refresh\n");
         displayio_group_finish_refresh(self->current_group);
     }
+    if (self->refresh_in_progress) {
+        #if CIRCUITPY_PERF_COUNTERS
+        perf_end(PERF_COUNTER_DISPLAY, self->refresh_start_cycles);
+        #endif
+        trace_event(TRACE_EVENT_DISPLAY_END, 0);
+    }
     self->full_refresh = false;
     self->refresh_in_progress = false;
     self->last_refresh = supervisor_ticks_ms64();
@@ -171,6 +186,10 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self) {
 
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     if (self->current_group != NULL) {
+        if (!self->refresh_in_progress) {
+            // Outside a refresh, such as for fill_row(), the bounds may be stale.
+            displayio_group_update_bounds(self->current_group);
+        }
         return displayio_group_fill_area(self->current_group, &self->colorspace, area, mask, buffer);
     }
     return false;
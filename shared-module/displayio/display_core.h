@@ -23,6 +23,9 @@ typedef struct {
     uint16_t rotation;
     _displayio_colorspace_t colorspace;
 
+    #if CIRCUITPY_PERF_COUNTERS
+    uint32_t refresh_start_cycles;
+    #endif
     bool full_refresh; // New group means we need to refresh the whole display.
     bool refresh_in_progress;
 } displayio_display_core_t;
@@ -0,0 +1,57 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stddef.h>
+#include <string.h>
+
+#include "shared-bindings/dsp/FIR.h"
+
+void common_hal_dsp_fir_construct(dsp_fir_obj_t *self, const float *taps, size_t n_taps, size_t decimation) {
+    self->n_taps = n_taps;
+    self->decimation = decimation;
+    memcpy(self->coefficients, taps, n_taps * sizeof(float));
+    common_hal_dsp_fir_reset(self);
+}
+
+size_t common_hal_dsp_fir_get_decimation(dsp_fir_obj_t *self) {
+    return self->decimation;
+}
+
+void common_hal_dsp_fir_reset(dsp_fir_obj_t *self) {
+    memset(self->coefficients + self->n_taps, 0, (self->n_taps - 1) * sizeof(float));
+}
+
+void common_hal_dsp_fir_filter(dsp_fir_obj_t *self, float *output, const float *input, size_t n_input) {
+    const float *taps = self->coefficients;
+    size_t n_taps = self->n_taps;
+    size_t history_len = n_taps - 1;
+    float *history = self->coefficients + n_taps;
+
+    // Only the samples that are kept after decimation are computed. The
+    // taps that reach back before this block read from the history instead,
+    // so the two loops have no per-tap branch.
+    size_t n_output = n_input / self->decimation;
+    for (size_t m = 0; m < n_output; m++) {
+        size_t n = m * self->decimation;
+        size_t from_input = n < history_len ? n + 1 : n_taps;
+        const float *x = input + n;
+        float acc = 0;
+        for (size_t j = 0; j < from_input; j++) {
+            acc += taps[j] * x[-(ptrdiff_t)j];
+        }
+        for (size_t j = from_input; j < n_taps; j++) {
+            acc += taps[j] * history[history_len + n - j];
+        }
+        output[m] = acc;
+    }
+
+    if (n_input >= history_len) {
+        memcpy(history, input + n_input - history_len, history_len * sizeof(float));
+    } else {
+        memmove(history, history + n_input, (history_len - n_input) * sizeof(float));
+        memcpy(history + history_len - n_input, input, n_input * sizeof(float));
+    }
+}
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    size_t n_taps;
+    size_t decimation;
+    // n_taps coefficients, followed by the last n_taps - 1 input samples.
+    float coefficients[];
+} dsp_fir_obj_t;
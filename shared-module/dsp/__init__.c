@@ -0,0 +1,112 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <string.h>
+
+#include "shared-bindings/dsp/__init__.h"
+
+#define DSP_PI (3.14159265358979323846f)
+
+// In-place radix-2 FFT of n complex values stored as interleaved re, im.
+static void complex_fft(float *data, size_t n) {
+    // Bit reversal permutation
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            float re = data[2 * i], im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+
+    // Each twiddle factor is computed once per stage rather than by
+    // recurrence, which keeps the error flat for large transforms.
+    for (size_t len = 2; len <= n; len <<= 1) {
+        size_t half = len >> 1;
+        float angle = -2 * DSP_PI / len;
+        for (size_t j = 0; j < half; j++) {
+            float wr = cosf(angle * j), wi = sinf(angle * j);
+            for (size_t k = j; k < n; k += len) {
+                float *a = data + 2 * k, *b = data + 2 * (k + half);
+                float tr = b[0] * wr - b[1] * wi;
+                float ti = b[0] * wi + b[1] * wr;
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+void common_hal_dsp_rfft(float *output, const float *input, size_t n) {
+    if (output != input) {
+        memcpy(output, input, n * sizeof(float));
+    }
+    // Treat the n real values as n/2 complex ones, transform those, then
+    // separate the even and odd parts to get the spectrum of the real signal.
+    size_t half = n / 2;
+    complex_fft(output, half);
+
+    float r0 = output[0], i0 = output[1];
+    output[0] = r0 + i0;
+    output[1] = r0 - i0;
+
+    float angle = -2 * DSP_PI / n;
+    for (size_t k = 1; k <= half / 2; k++) {
+        float *a = output + 2 * k, *b = output + 2 * (half - k);
+        // even = (Z[k] + conj(Z[half-k])) / 2, odd = (Z[k] - conj(Z[half-k])) / 2i
+        float even_r = (a[0] + b[0]) * 0.5f, even_i = (a[1] - b[1]) * 0.5f;
+        float odd_r = (a[1] + b[1]) * 0.5f, odd_i = (b[0] - a[0]) * 0.5f;
+        float wr = cosf(angle * k), wi = sinf(angle * k);
+        float tr = odd_r * wr - odd_i * wi;
+        float ti = odd_r * wi + odd_i * wr;
+        // X[k] = even + t, X[half-k] = conj(even - t)
+        a[0] = even_r + tr;
+        a[1] = even_i + ti;
+        b[0] = even_r - tr;
+        b[1] = ti - even_i;
+    }
+}
+
+void common_hal_dsp_power_spectrum(float *output, const float *spectrum, size_t n) {
+    // spectrum[1] holds the Nyquist term, which has no slot in the output.
+    output[0] = spectrum[0] * spectrum[0];
+    for (size_t k = 1; k < n / 2; k++) {
+        float re = spectrum[2 * k], im = spectrum[2 * k + 1];
+        output[k] = re * re + im * im;
+    }
+}
+
+void common_hal_dsp_window(float *buffer, size_t n, dsp_window_t kind) {
+    if (n < 2) {
+        return;
+    }
+    float step = 2 * DSP_PI / (n - 1);
+    for (size_t i = 0; i < n; i++) {
+        float c = cosf(step * i);
+        float w;
+        switch (kind) {
+            case DSP_WINDOW_HAMMING:
+                w = 0.54f - 0.46f * c;
+                break;
+            case DSP_WINDOW_BLACKMAN:
+                w = 0.42f - 0.5f * c + 0.08f * cosf(2 * step * i);
+                break;
+            default:
+                w = 0.5f - 0.5f * c;
+                break;
+        }
+        buffer[i] *= w;
+    }
+}
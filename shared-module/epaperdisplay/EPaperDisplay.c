@@ -79,6 +79,10 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     self->stop_sequence_len = stop_sequence_len;
     self->refresh_sequence = refresh_sequence;
     self->refresh_sequence_len = refresh_sequence_len;
+    self->partial_refresh_sequence = NULL;
+    self->partial_refresh_sequence_len = 0;
+    self->full_refresh_interval = 0;
+    self->partial_refresh_count = 0;
 
     self->busy.base.type = &mp_type_NoneType;
     self->two_byte_sequence_length = two_byte_sequence_length;
@@ -98,6 +102,14 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     common_hal_epaperdisplay_epaperdisplay_set_root_group(self, &circuitpython_splash);
 }
 
+void common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len, uint16_t full_refresh_interval) {
+    self->partial_refresh_sequence = partial_refresh_sequence;
+    self->partial_refresh_sequence_len = partial_refresh_sequence_len;
+    self->full_refresh_interval = full_refresh_interval;
+    self->partial_refresh_count = 0;
+}
+
 bool common_hal_epaperdisplay_epaperdisplay_set_root_group(epaperdisplay_epaperdisplay_obj_t *self, displayio_group_t *root_group) {
     return displayio_display_core_set_root_group(&self->core, root_group);
 }
@@ -213,9 +225,13 @@ uint32_t common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(epaperdispla
     return self->milliseconds_per_frame - elapsed_time;
 }
 
-static void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
+static void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self, bool partial) {
     // Actually refresh the display now that all pixel RAM has been updated.
-    send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    if (partial) {
+        send_command_sequence(self, false, self->partial_refresh_sequence, self->partial_refresh_sequence_len);
+    } else {
+        send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    }
 
     supervisor_enable_tick();
     self->refreshing = true;
@@ -424,14 +440,24 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
         // Can't acquire display bus; skip updating this display. Try next display.
         return false;
     }
+    // Only the dirty areas are sent either way. Partial refreshes also use the
+    // controller's quicker partial update sequence until a full one is due.
+    bool partial = self->partial_refresh_sequence_len > 0 && self->bus.row_command != NO_COMMAND &&
+        !self->core.full_refresh;
     const displayio_area_t *current_area = epaperdisplay_epaperdisplay_get_refresh_areas(self);
     if (current_area == NULL) {
         return true;
     }
+    if (partial && self->full_refresh_interval > 0 &&
+        self->partial_refresh_count >= self->full_refresh_interval) {
+        self->core.full_refresh = true;
+        current_area = epaperdisplay_epaperdisplay_get_refresh_areas(self);
+        partial = false;
+    }
     if (self->acep) {
         epaperdisplay_epaperdisplay_start_refresh(self);
         _clean_area(self);
-        epaperdisplay_epaperdisplay_finish_refresh(self);
+        epaperdisplay_epaperdisplay_finish_refresh(self, false);
         while (self->refreshing && !mp_hal_is_interrupted()) {
             RUN_BACKGROUND_TASKS;
         }
@@ -445,7 +471,8 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
         epaperdisplay_epaperdisplay_refresh_area(self, current_area);
         current_area = current_area->next;
     }
-    epaperdisplay_epaperdisplay_finish_refresh(self);
+    epaperdisplay_epaperdisplay_finish_refresh(self, partial);
+    self->partial_refresh_count = partial ? self->partial_refresh_count + 1 : 0;
     return true;
 }
 
@@ -498,6 +525,7 @@ void epaperdisplay_epaperdisplay_collect_ptrs(epaperdisplay_epaperdisplay_obj_t
     gc_collect_ptr((void *)self->start_sequence);
     gc_collect_ptr((void *)self->stop_sequence);
     gc_collect_ptr((void *)self->refresh_sequence);
+    gc_collect_ptr((void *)self->partial_refresh_sequence);
 }
 
 size_t maybe_refresh_epaperdisplay(void) {
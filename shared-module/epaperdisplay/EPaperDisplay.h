@@ -22,9 +22,14 @@ typedef struct {
     const uint8_t *start_sequence;
     const uint8_t *stop_sequence;
     const uint8_t *refresh_sequence;
+    const uint8_t *partial_refresh_sequence;
     uint16_t start_sequence_len;
     uint16_t stop_sequence_len;
     uint16_t refresh_sequence_len;
+    uint16_t partial_refresh_sequence_len;
+    // Partial refreshes allowed before a full one clears ghosting. 0 is no limit.
+    uint16_t full_refresh_interval;
+    uint16_t partial_refresh_count;
     uint16_t start_up_time_ms;
     uint16_t refresh_time;
     uint16_t write_black_ram_command;
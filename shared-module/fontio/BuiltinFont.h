@@ -17,7 +17,8 @@ typedef struct {
     const displayio_bitmap_t *bitmap;
     uint8_t width;
     uint8_t height;
-    const byte *unicode_characters;
+    // Codepoints of the glyphs after visible ASCII, in ascending order.
+    const uint16_t *unicode_characters;
     uint16_t unicode_characters_len;
 } fontio_builtinfont_t;
 
@@ -34,6 +34,7 @@ void common_hal_framebufferio_framebufferdisplay_construct(framebufferio_framebu
     bool auto_refresh) {
     // Turn off auto-refresh as we init.
     self->auto_refresh = false;
+    self->refresh_deadline.fun = NULL;
     self->framebuffer = framebuffer;
     self->framebuffer_protocol = mp_proto_get_or_throw(MP_QSTR_protocol_framebuffer, framebuffer);
 
@@ -116,6 +117,50 @@ static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdispl
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
+
+// Render whole framebuffer rows in place instead of through an area buffer
+// and a copy. The mask gets the stack space the area buffer would have used.
+static void _refresh_area_direct(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *clipped, uint8_t *dirty_row_bitmask) {
+    uint16_t width = displayio_area_width(clipped);
+    uint8_t bytes_per_pixel = self->core.colorspace.depth / 8;
+    uint16_t rows_per_chunk = MAX(1, CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE * 8 / width);
+    uint32_t mask_length = (rows_per_chunk * width / 32) + 1;
+    uint32_t mask[mask_length];
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf + self->first_pixel_offset;
+
+    for (uint16_t y = clipped->y1; y < clipped->y2; y += rows_per_chunk) {
+        displayio_area_t chunk = {
+            .x1 = clipped->x1,
+            .y1 = y,
+            .x2 = clipped->x2,
+            .y2 = MIN(y + rows_per_chunk, clipped->y2)
+        };
+        uint8_t *dest = buf + y * self->row_stride;
+
+        memset(mask, 0, mask_length * sizeof(mask[0]));
+        if (!displayio_display_core_fill_area(&self->core, &chunk, mask, (uint32_t *)dest)) {
+            // Clear the pixels no layer drew, as the zeroed area buffer would.
+            uint32_t pixels = displayio_area_size(&chunk);
+            for (uint32_t i = 0; i < pixels; i++) {
+                if (i % 32 == 0 && mask[i / 32] == 0xffffffff) {
+                    i += 31;
+                    continue;
+                }
+                if ((mask[i / 32] & (1 << (i % 32))) == 0) {
+                    memset(dest + i * bytes_per_pixel, 0, bytes_per_pixel);
+                }
+            }
+        }
+        for (uint16_t i = chunk.y1; i < chunk.y2; i++) {
+            MARK_ROW_DIRTY(i);
+        }
+
+        #if CIRCUITPY_TINYUSB
+        usb_background();
+        #endif
+    }
+}
+
 static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
@@ -133,6 +178,16 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         clipped.x2 = ((clipped.x2 + div - 1) / div) * div;
     }
 
+    // When the area covers whole rows with no padding between them, the
+    // framebuffer is laid out just like the area buffer, so render into it.
+    uint8_t *first_pixel = (uint8_t *)self->bufinfo.buf + self->first_pixel_offset;
+    if (self->core.colorspace.depth >= 8 &&
+        displayio_area_width(&clipped) * self->core.colorspace.depth / 8 == self->row_stride &&
+        self->row_stride % sizeof(uint32_t) == 0 && (uintptr_t)first_pixel % sizeof(uint32_t) == 0) {
+        _refresh_area_direct(self, &clipped, dirty_row_bitmask);
+        return true;
+    }
+
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
     uint16_t pixels_per_buffer = displayio_area_size(&clipped);
@@ -287,12 +342,11 @@ bool common_hal_framebufferio_framebufferdisplay_get_auto_refresh(framebufferio_
 void common_hal_framebufferio_framebufferdisplay_set_auto_refresh(framebufferio_framebufferdisplay_obj_t *self,
     bool auto_refresh) {
     self->first_manual_refresh = !auto_refresh;
-    if (auto_refresh != self->auto_refresh) {
-        if (auto_refresh) {
-            supervisor_enable_tick();
-        } else {
-            supervisor_disable_tick();
-        }
+    if (auto_refresh) {
+        // Refresh on the next tick. Background refreshes schedule the following ones.
+        supervisor_deadline_set(&self->refresh_deadline, 0);
+    } else {
+        supervisor_deadline_cancel(&self->refresh_deadline);
     }
     self->auto_refresh = auto_refresh;
 }
@@ -305,9 +359,15 @@ static void _update_backlight(framebufferio_framebufferdisplay_obj_t *self) {
 void framebufferio_framebufferdisplay_background(framebufferio_framebufferdisplay_obj_t *self) {
     _update_backlight(self);
 
-    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
+    if (!self->auto_refresh) {
+        return;
+    }
+    uint64_t since_refresh = supervisor_ticks_ms64() - self->core.last_refresh;
+    if (since_refresh > self->native_ms_per_frame) {
         _refresh_display(self);
+        since_refresh = 0;
     }
+    supervisor_deadline_set_after_ms(&self->refresh_deadline, self->native_ms_per_frame + 1 - since_refresh);
 }
 
 void release_framebufferdisplay(framebufferio_framebufferdisplay_obj_t *self) {
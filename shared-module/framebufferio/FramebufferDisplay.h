@@ -14,6 +14,7 @@
 
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/display_core.h"
+#include "supervisor/shared/tick.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -22,6 +23,8 @@ typedef struct {
     const struct _framebuffer_p_t *framebuffer_protocol;
     mp_buffer_info_t bufinfo;
     uint64_t last_refresh_call;
+    // Wakes the supervisor for the next auto refresh.
+    supervisor_deadline_t refresh_deadline;
     uint16_t native_frames_per_second;
     uint16_t native_ms_per_frame;
     uint16_t first_pixel_offset;
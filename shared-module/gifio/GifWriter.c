@@ -16,7 +16,17 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+#define BUFFER_SIZE (1024)
+// Codes are at most 12 bits, so the dictionary holds at most this many.
+#define LZW_MAX_CODES (4096)
+// A prime comfortably larger than LZW_MAX_CODES, as in compress(1).
+#define LZW_HASH_SIZE (5003)
+#define LZW_EMPTY (0xffffffff)
+// With delta frames the palette doubles and this otherwise unused entry
+// marks pixels that are the same as in the previous frame.
+#define TRANSPARENT_INDEX (128)
+// In the previous frame, marks a pixel that changed in the current one.
+#define CHANGED (0x80)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -36,9 +46,12 @@ static void flush_data(gifio_gifwriter_t *self) {
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
+// Output is written to the file whenever the buffer fills, so it only needs
+// to hold the largest single write, the color table.
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
+    if (self->cur + size > self->size) {
+        flush_data(self);
+    }
     assert(self->cur + size <= self->size);
     memcpy(self->data + self->cur, data, size);
     self->cur += size;
@@ -48,15 +61,98 @@ static void write_byte(gifio_gifwriter_t *self, uint8_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-static void write_long(gifio_gifwriter_t *self, uint32_t value) {
+static void write_word(gifio_gifwriter_t *self, uint16_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-static void write_word(gifio_gifwriter_t *self, uint16_t value) {
-    write_data(self, &value, sizeof(value));
+// LZW codes are packed LSB first into sub-blocks of up to 255 bytes.
+static void lzw_put_code(gifio_gifwriter_t *self, uint16_t code) {
+    self->bits |= (uint32_t)code << self->bit_count;
+    self->bit_count += self->code_size;
+    while (self->bit_count >= 8) {
+        self->block[self->block_len++] = self->bits & 0xff;
+        self->bits >>= 8;
+        self->bit_count -= 8;
+        if (self->block_len == sizeof(self->block)) {
+            write_byte(self, self->block_len);
+            write_data(self, self->block, self->block_len);
+            self->block_len = 0;
+        }
+    }
+}
+
+static void lzw_reset(gifio_gifwriter_t *self) {
+    memset(self->hash, 0xff, LZW_HASH_SIZE * sizeof(uint32_t));
+    self->next_code = (1 << self->min_code_size) + 2;
+    self->code_size = self->min_code_size + 1;
 }
 
-void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool own_file) {
+static void lzw_begin(gifio_gifwriter_t *self) {
+    write_byte(self, self->min_code_size);
+    self->bits = 0;
+    self->bit_count = 0;
+    self->block_len = 0;
+    self->prefix = -1;
+    lzw_reset(self);
+    lzw_put_code(self, 1 << self->min_code_size);
+}
+
+static void lzw_add(gifio_gifwriter_t *self, const uint8_t *pixels, int count) {
+    int prefix = self->prefix;
+    int i = 0;
+    if (prefix < 0 && count > 0) {
+        prefix = pixels[i++];
+    }
+    for (; i < count; i++) {
+        uint8_t c = pixels[i];
+        uint32_t key = ((uint32_t)c << 12) | prefix;
+        int h = (c << 4) ^ prefix;
+        int disp = h == 0 ? 1 : LZW_HASH_SIZE - h;
+        uint32_t entry;
+        while ((entry = self->hash[h]) != LZW_EMPTY && (entry >> 12) != key) {
+            h -= disp;
+            if (h < 0) {
+                h += LZW_HASH_SIZE;
+            }
+        }
+        if (entry != LZW_EMPTY) {
+            prefix = entry & 0xfff;
+            continue;
+        }
+        lzw_put_code(self, prefix);
+        if (self->next_code < LZW_MAX_CODES) {
+            if (self->next_code == (1 << self->code_size)) {
+                self->code_size++;
+            }
+            self->hash[h] = (key << 12) | self->next_code++;
+        } else {
+            // The dictionary is full, so start a new one.
+            lzw_put_code(self, 1 << self->min_code_size);
+            lzw_reset(self);
+        }
+        prefix = c;
+    }
+    self->prefix = prefix;
+}
+
+static void lzw_end(gifio_gifwriter_t *self) {
+    if (self->prefix >= 0) {
+        lzw_put_code(self, self->prefix);
+    }
+    lzw_put_code(self, (1 << self->min_code_size) + 1);
+    if (self->bit_count > 0) {
+        // Pad out the last byte.
+        self->code_size = 8 - self->bit_count;
+        lzw_put_code(self, 0);
+    }
+    if (self->block_len > 0) {
+        write_byte(self, self->block_len);
+        write_data(self, self->block, self->block_len);
+    }
+    write_byte(self, 0); // end of image data
+}
+
+void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool delta, bool own_file) {
     self->file = file;
     self->file_proto = mp_get_stream_raise(file, MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
     if (self->file_proto->is_text) {
@@ -68,16 +164,21 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->dither = dither;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
+    self->size = BUFFER_SIZE;
     self->data = m_malloc(self->size);
     self->cur = 0;
     self->error = 0;
+    self->hash = m_malloc(LZW_HASH_SIZE * sizeof(uint32_t));
+    self->row = m_malloc(width);
+    self->previous = delta ? m_malloc(width * height) : NULL;
+    self->have_previous = false;
+    // The palette has 128 colors, or 256 with the transparent entry.
+    self->min_code_size = delta ? 8 : 7;
 
     write_data(self, "GIF89a", 6);
     write_word(self, width);
     write_word(self, height);
-    write_data(self, (uint8_t []) {0xF6, 0x00, 0x00}, 3);
+    write_data(self, (uint8_t []) {delta ? 0xF7 : 0xF6, 0x00, 0x00}, 3);
 
     switch (colorspace) {
         case DISPLAYIO_COLORSPACE_RGB565:
@@ -113,6 +214,11 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
             write_data(self, (uint8_t []) {gray, gray, gray}, 3);
         }
     }
+    if (delta) {
+        for (int i = 128; i < 256; i++) {
+            write_data(self, (uint8_t []) {0, 0, 0}, 3);
+        }
+    }
 
     if (loop) {
         write_data(self, (uint8_t []) {'!', 0xFF, 0x0B}, 3);
@@ -154,96 +260,116 @@ static const uint8_t g_bayer[4][4] = {
     {31, 14, 26, 10}
 };
 
-void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
-    if (delay) {
-        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
-        write_word(self, delay);
-        write_word(self, 0); // end
-    }
-
-    write_byte(self, 0x2C);
-    write_long(self, 0);
-    write_word(self, self->width);
-    write_word(self, self->height);
-    write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
-
-    int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
-
-    uint8_t *data = self->data + self->cur;
-
+// Convert row y of the frame to palette indices.
+static void quantize_row(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int y, uint8_t *out) {
+    int width = self->width;
     if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
-
-        uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
-            }
+        const uint8_t *pixels = (const uint8_t *)bufinfo->buf + y * width;
+        for (int x = 0; x < width; x++) {
+            out[x] = pixels[x] >> 1;
         }
     } else if (!self->dither) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
+        const uint16_t *pixels = (const uint16_t *)bufinfo->buf + y * width;
+        for (int x = 0; x < width; x++) {
+            int pixel = pixels[x];
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
             }
+            int red = (pixel >> (11 + (5 - 2))) & 0x3;
+            int green = (pixel >> (5 + (6 - 3))) & 0x7;
+            int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+            out[x] = (red << 5) | (green << 2) | blue;
         }
     } else {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
-                }
+        const uint16_t *pixels = (const uint16_t *)bufinfo->buf + y * width;
+        for (int x = 0; x < width; x++) {
+            int pixel = pixels[x];
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            int red = (pixel >> 8) & 0xf8;
+            int green = (pixel >> 3) & 0xfc;
+            int blue = (pixel << 3) & 0xf8;
+
+            red = MAX(0, red - rb_bayer[x % 4][y % 4]);
+            green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
+            blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
+
+            out[x] = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+        }
+    }
+}
 
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
+    int pixel_count = self->width * self->height;
+    int bytes_per_pixel = self->colorspace == DISPLAYIO_COLORSPACE_L8 ? 1 : 2;
+    mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(bytes_per_pixel * pixel_count - 1), false);
+
+    // The part of the frame to write. Without delta frames, all of it.
+    int x1 = 0, y1 = 0, x2 = self->width, y2 = self->height;
+    bool transparent = false;
+    if (self->previous != NULL) {
+        // Mark the pixels that changed, and find the box around them.
+        x1 = self->width;
+        y1 = self->height;
+        x2 = y2 = 0;
+        for (int y = 0; y < self->height; y++) {
+            uint8_t *previous = self->previous + y * self->width;
+            quantize_row(self, bufinfo, y, self->row);
+            for (int x = 0; x < self->width; x++) {
+                if (!self->have_previous || self->row[x] != previous[x]) {
+                    previous[x] = self->row[x] | CHANGED;
+                    x1 = MIN(x1, x);
+                    x2 = MAX(x2, x + 1);
+                    y1 = MIN(y1, y);
+                    y2 = MAX(y2, y + 1);
+                }
             }
         }
+        if (x2 == 0) {
+            // Nothing changed, but the frame still needs an image for its delay.
+            x1 = y1 = 0;
+            x2 = y2 = 1;
+        }
+        transparent = self->have_previous;
+        self->have_previous = true;
+    }
+
+    if (delay || transparent) {
+        // Leave the previous frame in place, and maybe mark a transparent color.
+        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, transparent ? 0x05 : 0x04}, 4);
+        write_word(self, delay);
+        write_data(self, (uint8_t []) {transparent ? TRANSPARENT_INDEX : 0, 0}, 2); // end
     }
 
-    self->cur = data - self->data;
+    write_byte(self, 0x2C);
+    write_word(self, x1);
+    write_word(self, y1);
+    write_word(self, x2 - x1);
+    write_word(self, y2 - y1);
+    write_byte(self, 0x00); // no local color table, not interlaced
+
+    lzw_begin(self);
+    for (int y = y1; y < y2; y++) {
+        if (self->previous == NULL) {
+            quantize_row(self, bufinfo, y, self->row);
+        } else {
+            uint8_t *previous = self->previous + y * self->width;
+            for (int x = x1; x < x2; x++) {
+                uint8_t value = previous[x];
+                if (value & CHANGED || !transparent) {
+                    value &= ~CHANGED;
+                    previous[x] = value;
+                } else {
+                    value = TRANSPARENT_INDEX;
+                }
+                self->row[x - x1] = value;
+            }
+        }
+        lzw_add(self, self->previous == NULL ? self->row + x1 : self->row, x2 - x1);
+    }
+    lzw_end(self);
 
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
     flush_data(self);
     handle_error(self);
 }
@@ -19,7 +19,22 @@ typedef struct gifio_gifwriter {
     int error;
     uint8_t *data;
     size_t cur, size;
+    // One row of palette indices.
+    uint8_t *row;
+    // Palette indices of the last frame, when writing delta frames.
+    uint8_t *previous;
+    // LZW encoder state. hash maps (pixel, prefix code) to a code.
+    uint32_t *hash;
+    uint32_t bits;
+    int prefix;
+    uint16_t next_code;
+    uint8_t min_code_size;
+    uint8_t code_size;
+    uint8_t bit_count;
+    uint8_t block_len;
+    uint8_t block[255];
     bool own_file;
     bool byteswap;
     bool dither;
+    bool have_previous;
 } gifio_gifwriter_t;
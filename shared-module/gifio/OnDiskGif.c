@@ -12,6 +12,7 @@
 
 #include "py/mperrno.h"
 #include "py/runtime.h"
+#include "supervisor/shared/tick.h"
 
 
 static int32_t GIFReadFile(GIFFILE *pFile, uint8_t *pBuf, int32_t iLen) {
@@ -42,6 +43,35 @@ static int32_t GIFSeekFile(GIFFILE *pFile, int32_t iPosition) {
     return pFile->iPos;
 } /* GIFSeekFile() */
 
+#if CIRCUITPY_BUSDISPLAY
+// Send one row of the canvas straight to the display, so the frame doesn't
+// wait for displayio to refresh the whole bitmap.
+static void send_row(gifio_ondiskgif_t *self, uint16_t *row, int x, int y, int width) {
+    busdisplay_busdisplay_obj_t *display = self->display;
+    displayio_area_t area = {
+        .x1 = self->display_x + x,
+        .y1 = self->display_y + y,
+        .x2 = self->display_x + x + width,
+        .y2 = self->display_y + y + 1,
+    };
+    displayio_area_t clipped;
+    if (!displayio_display_core_clip_area(&display->core, &area, &clipped) ||
+        !displayio_display_bus_is_free(&display->bus)) {
+        return;
+    }
+    displayio_display_bus_set_region_to_update(&display->bus, &display->core, &clipped);
+
+    displayio_display_bus_begin_transaction(&display->bus);
+    if (!display->bus.data_as_commands) {
+        display->bus.send(display->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &display->write_ram_command, 1);
+    }
+    uint16_t *pixels = row + x + (clipped.x1 - area.x1);
+    display->bus.send(display->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED,
+        (uint8_t *)pixels, displayio_area_width(&clipped) * sizeof(uint16_t));
+    displayio_display_bus_end_transaction(&display->bus);
+}
+#endif
+
 static void GIFDraw(GIFDRAW *pDraw) {
     // Called for every scan line of the image as it decodes
     // The pixels delivered are the 8-bit native GIF output
@@ -124,6 +154,14 @@ static void GIFDraw(GIFDRAW *pDraw) {
                 *d++ = pPal[c];
             }
         }
+
+        #if CIRCUITPY_BUSDISPLAY
+        // Transparent pixels kept the previous frame, so send the composited
+        // row from the canvas rather than the decoded one.
+        if (ondiskgif->display != NULL && !ondiskgif->skipping) {
+            send_row(ondiskgif, (uint16_t *)row, pDraw->iX, pDraw->iY + pDraw->y, iWidth);
+        }
+        #endif
     }
 }
 
@@ -179,6 +217,14 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
     self->frame_count = info.iFrameCount;
     self->min_delay = info.iMinDelay;
     self->max_delay = info.iMaxDelay;
+
+    #if CIRCUITPY_BUSDISPLAY
+    self->display = NULL;
+    #endif
+    self->next_frame_due = 0;
+    self->last_delay = 0;
+    self->frames_skipped = 0;
+    self->skipping = false;
 }
 
 void common_hal_gifio_ondiskgif_deinit(gifio_ondiskgif_t *self) {
@@ -227,7 +273,7 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
     return self->max_delay;
 }
 
-uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
+static uint32_t play_frame(gifio_ondiskgif_t *self, bool setDirty) {
     int nextDelay = 0;
     int result = 0;
     result = GIF_playFrame(&self->gif, &nextDelay, self);
@@ -245,3 +291,82 @@ uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool set
 
     return nextDelay;
 }
+
+uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
+    #if CIRCUITPY_BUSDISPLAY
+    self->display = NULL;
+    #endif
+    self->skipping = false;
+    self->next_frame_due = 0;
+    return play_frame(self, setDirty);
+}
+
+uint32_t common_hal_gifio_ondiskgif_next_frame_to(gifio_ondiskgif_t *self, mp_obj_t display, int16_t x, int16_t y, bool skip_late) {
+    #if CIRCUITPY_BUSDISPLAY
+    busdisplay_busdisplay_obj_t *busdisplay = NULL;
+    if (display != mp_const_none) {
+        busdisplay = MP_OBJ_TO_PTR(display);
+        // Rows are sent as the canvas holds them: RGB565 in the display's
+        // native orientation.
+        if (self->palette != NULL || busdisplay->core.colorspace.depth != 16 || busdisplay->core.colorspace.grayscale) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+        }
+        const displayio_buffer_transform_t *transform = &busdisplay->core.transform;
+        if (transform->transpose_xy || transform->mirror_x || transform->mirror_y) {
+            mp_arg_error_invalid(MP_QSTR_display);
+        }
+    }
+    self->display = NULL;
+    self->display_x = x;
+    self->display_y = y;
+    #else
+    (void)display;
+    (void)x;
+    (void)y;
+    #endif
+    self->skipping = false;
+
+    uint64_t now = supervisor_ticks_ms64();
+    if (!skip_late) {
+        self->next_frame_due = 0;
+    } else if (self->next_frame_due != 0) {
+        // A frame that is already a whole frame late is decoded only to keep
+        // the canvas correct. The previous delay stands in for its own, which
+        // isn't known until it has been decoded. Never skip a whole loop.
+        self->skipping = true;
+        for (int32_t i = 1; i < self->frame_count && now >= self->next_frame_due + self->last_delay; i++) {
+            self->last_delay = play_frame(self, false);
+            self->next_frame_due += self->last_delay;
+            self->frames_skipped++;
+            now = supervisor_ticks_ms64();
+        }
+        self->skipping = false;
+        if (now >= self->next_frame_due + self->last_delay) {
+            // Too far behind to catch up. Start the schedule again from now.
+            self->next_frame_due = now;
+        }
+    }
+
+    #if CIRCUITPY_BUSDISPLAY
+    self->display = busdisplay;
+    uint32_t delay = play_frame(self, busdisplay == NULL);
+    self->display = NULL;
+    #else
+    uint32_t delay = play_frame(self, true);
+    #endif
+
+    if (!skip_late) {
+        return delay;
+    }
+    now = supervisor_ticks_ms64();
+    if (self->next_frame_due == 0) {
+        self->next_frame_due = now;
+    }
+    self->next_frame_due += delay;
+    self->last_delay = delay;
+    return self->next_frame_due > now ? self->next_frame_due - now : 0;
+}
+
+int32_t common_hal_gifio_ondiskgif_get_frames_skipped(gifio_ondiskgif_t *self) {
+    return self->frames_skipped;
+}
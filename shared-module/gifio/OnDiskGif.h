@@ -17,6 +17,10 @@
 
 #include "extmod/vfs_fat.h"
 
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-module/busdisplay/BusDisplay.h"
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     GIFIMAGE gif;
@@ -27,4 +31,17 @@ typedef struct {
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    #if CIRCUITPY_BUSDISPLAY
+    // Only set during next_frame(). Decoded rows are also sent here.
+    busdisplay_busdisplay_obj_t *display;
+    int16_t display_x;
+    int16_t display_y;
+    #endif
+    // When the frame after the last one shown is due, in ticks. 0 when
+    // frames aren't being scheduled.
+    uint64_t next_frame_due;
+    int32_t last_delay;
+    int32_t frames_skipped;
+    // Decoding a late frame only to keep the canvas up to date.
+    bool skipping;
 } gifio_ondiskgif_t;
@@ -0,0 +1,65 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "shared-bindings/gnssio/Fix.h"
+
+void common_hal_gnssio_fix_construct(gnssio_fix_obj_t *self) {
+    memset(&self->fix, 0, sizeof(self->fix));
+}
+
+bool common_hal_gnssio_fix_get_valid(gnssio_fix_obj_t *self) {
+    return self->fix.valid;
+}
+
+uint8_t common_hal_gnssio_fix_get_quality(gnssio_fix_obj_t *self) {
+    return self->fix.quality;
+}
+
+uint8_t common_hal_gnssio_fix_get_satellites(gnssio_fix_obj_t *self) {
+    return self->fix.satellites;
+}
+
+mp_float_t common_hal_gnssio_fix_get_latitude(gnssio_fix_obj_t *self) {
+    return self->fix.latitude_e7 / MICROPY_FLOAT_CONST(1e7);
+}
+
+mp_float_t common_hal_gnssio_fix_get_longitude(gnssio_fix_obj_t *self) {
+    return self->fix.longitude_e7 / MICROPY_FLOAT_CONST(1e7);
+}
+
+mp_float_t common_hal_gnssio_fix_get_altitude(gnssio_fix_obj_t *self) {
+    return self->fix.altitude_mm / MICROPY_FLOAT_CONST(1e3);
+}
+
+mp_float_t common_hal_gnssio_fix_get_speed(gnssio_fix_obj_t *self) {
+    return self->fix.speed_mm_s / MICROPY_FLOAT_CONST(1e3);
+}
+
+mp_float_t common_hal_gnssio_fix_get_course(gnssio_fix_obj_t *self) {
+    return self->fix.course_e5 / MICROPY_FLOAT_CONST(1e5);
+}
+
+mp_float_t common_hal_gnssio_fix_get_dop(gnssio_fix_obj_t *self) {
+    return self->fix.dop_e2 / MICROPY_FLOAT_CONST(1e2);
+}
+
+bool common_hal_gnssio_fix_get_timestamp(gnssio_fix_obj_t *self, timeutils_struct_time_t *tm) {
+    const gnssio_fix_t *fix = &self->fix;
+    if (fix->year == 0) {
+        return false;
+    }
+    tm->tm_year = fix->year;
+    tm->tm_mon = fix->month;
+    tm->tm_mday = fix->day;
+    tm->tm_hour = fix->hour;
+    tm->tm_min = fix->minute;
+    tm->tm_sec = fix->second;
+    tm->tm_wday = timeutils_calc_weekday(fix->year, fix->month, fix->day);
+    tm->tm_yday = timeutils_year_day(fix->year, fix->month, fix->day);
+    return true;
+}
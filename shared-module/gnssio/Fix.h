@@ -0,0 +1,38 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// Kept in integer units, as UBX sends them, so NMEA's decimal fields lose
+// nothing to single precision floats until they are read.
+typedef struct {
+    int32_t latitude_e7;
+    int32_t longitude_e7;
+    // Above mean sea level.
+    int32_t altitude_mm;
+    int32_t speed_mm_s;
+    int32_t course_e5;
+    // HDOP from NMEA, PDOP from UBX.
+    uint16_t dop_e2;
+    // 0 until a date has been received.
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t satellites;
+    // As in NMEA GGA: 0 for none, 1 for a GNSS fix, 2 for a differential fix.
+    uint8_t quality;
+    bool valid;
+} gnssio_fix_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    gnssio_fix_t fix;
+} gnssio_fix_obj_t;
@@ -0,0 +1,351 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/gnssio/Receiver.h"
+#include "shared-module/gnssio/__init__.h"
+
+#if CIRCUITPY_BUSIO_UART
+#include "shared-bindings/busio/UART.h"
+#endif
+
+enum {
+    STATE_IDLE,
+    // Between '$' and the end of the line.
+    STATE_NMEA,
+    // After the first UBX sync byte.
+    STATE_UBX_SYNC,
+    // Class, id, length, payload and checksum.
+    STATE_UBX,
+};
+
+#define UBX_SYNC_1 (0xb5)
+#define UBX_SYNC_2 (0x62)
+#define UBX_NAV_PVT_CLASS (0x01)
+#define UBX_NAV_PVT_ID (0x07)
+#define UBX_NAV_PVT_LENGTH (92)
+
+#define NMEA_FIELDS_MAX (20)
+
+void common_hal_gnssio_receiver_construct(gnssio_receiver_obj_t *self, mp_obj_t uart) {
+    self->uart = uart;
+    memset(&self->fix, 0, sizeof(self->fix));
+    self->sequence = 0;
+    self->read_sequence = 0;
+    self->checksum_errors = 0;
+    self->len = 0;
+    self->state = STATE_IDLE;
+    self->deinited = false;
+    self->next = NULL;
+    if (uart != mp_const_none) {
+        gnssio_register_receiver(self);
+    }
+}
+
+bool common_hal_gnssio_receiver_deinited(gnssio_receiver_obj_t *self) {
+    return self->deinited;
+}
+
+void common_hal_gnssio_receiver_deinit(gnssio_receiver_obj_t *self) {
+    if (common_hal_gnssio_receiver_deinited(self)) {
+        return;
+    }
+    if (self->uart != mp_const_none) {
+        gnssio_deregister_receiver(self);
+    }
+    self->uart = mp_const_none;
+    self->deinited = true;
+}
+
+// Parses an optionally negative decimal number, scaled by 10 ** decimals.
+// Further digits are dropped.
+static bool parse_fixed(const char *s, size_t len, int decimals, int64_t *out) {
+    bool negative = len > 0 && s[0] == '-';
+    size_t i = negative ? 1 : 0;
+    int64_t value = 0;
+    bool digits = false;
+    int fraction = -1;
+    for (; i < len; i++) {
+        if (s[i] == '.' && fraction < 0) {
+            fraction = 0;
+        } else if (s[i] >= '0' && s[i] <= '9') {
+            digits = true;
+            if (fraction < 0) {
+                value = value * 10 + (s[i] - '0');
+            } else if (fraction < decimals) {
+                value = value * 10 + (s[i] - '0');
+                fraction++;
+            }
+        } else {
+            return false;
+        }
+    }
+    if (!digits) {
+        return false;
+    }
+    for (fraction = MAX(fraction, 0); fraction < decimals; fraction++) {
+        value *= 10;
+    }
+    *out = negative ? -value : value;
+    return true;
+}
+
+static int parse_two_digits(const char *s) {
+    return (s[0] - '0') * 10 + (s[1] - '0');
+}
+
+static bool all_digits(const char *s, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (s[i] < '0' || s[i] > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// NMEA positions are degrees and decimal minutes, dddmm.mmmm, followed by a
+// hemisphere field.
+static bool parse_coordinate(const char *s, size_t len, char hemisphere, int32_t *out) {
+    int64_t value;
+    if (!parse_fixed(s, len, 5, &value) || value < 0) {
+        return false;
+    }
+    int64_t degrees = value / 10000000;
+    int64_t minutes_e5 = value % 10000000;
+    int64_t e7 = degrees * 10000000 + minutes_e5 * 100 / 60;
+    *out = (hemisphere == 'S' || hemisphere == 'W') ? -e7 : e7;
+    return true;
+}
+
+static void parse_time(gnssio_fix_t *fix, const char *s, size_t len) {
+    if (len >= 6 && all_digits(s, 6)) {
+        fix->hour = parse_two_digits(s);
+        fix->minute = parse_two_digits(s + 2);
+        fix->second = parse_two_digits(s + 4);
+    }
+}
+
+static void parse_nmea(gnssio_receiver_obj_t *self) {
+    char *sentence = (char *)self->buf;
+    size_t len = self->len;
+    char *star = memchr(sentence, '*', len);
+    if (star == NULL || star + 3 > sentence + len) {
+        self->checksum_errors++;
+        return;
+    }
+    uint8_t checksum = 0;
+    for (char *c = sentence; c < star; c++) {
+        checksum ^= *c;
+    }
+    static const char hex[] = "0123456789ABCDEF";
+    if (star[1] != hex[checksum >> 4] || star[2] != hex[checksum & 0xf]) {
+        self->checksum_errors++;
+        return;
+    }
+
+    const char *fields[NMEA_FIELDS_MAX];
+    size_t lengths[NMEA_FIELDS_MAX];
+    size_t count = 0;
+    const char *start = sentence;
+    for (const char *c = sentence; c <= star && count < NMEA_FIELDS_MAX; c++) {
+        if (c == star || *c == ',') {
+            fields[count] = start;
+            lengths[count] = c - start;
+            count++;
+            start = c + 1;
+        }
+    }
+    // The address field is a two letter talker, such as GP or GN, then the type.
+    if (lengths[0] != 5) {
+        return;
+    }
+    const char *type = fields[0] + 2;
+    gnssio_fix_t *fix = &self->fix;
+    int64_t value;
+    if (memcmp(type, "GGA", 3) == 0 && count >= 10) {
+        parse_time(fix, fields[1], lengths[1]);
+        fix->quality = 0;
+        if (parse_fixed(fields[6], lengths[6], 0, &value)) {
+            fix->quality = MIN(value, 255);
+        }
+        fix->valid = fix->quality > 0;
+        if (fix->valid) {
+            parse_coordinate(fields[2], lengths[2], lengths[3] > 0 ? fields[3][0] : 'N', &fix->latitude_e7);
+            parse_coordinate(fields[4], lengths[4], lengths[5] > 0 ? fields[5][0] : 'E', &fix->longitude_e7);
+            if (parse_fixed(fields[7], lengths[7], 0, &value)) {
+                fix->satellites = MIN(value, 255);
+            }
+            if (parse_fixed(fields[8], lengths[8], 2, &value)) {
+                fix->dop_e2 = MIN(value, UINT16_MAX);
+            }
+            if (parse_fixed(fields[9], lengths[9], 3, &value)) {
+                fix->altitude_mm = value;
+            }
+        }
+        self->sequence++;
+    } else if (memcmp(type, "RMC", 3) == 0 && count >= 10) {
+        parse_time(fix, fields[1], lengths[1]);
+        if (lengths[9] == 6 && all_digits(fields[9], 6)) {
+            fix->day = parse_two_digits(fields[9]);
+            fix->month = parse_two_digits(fields[9] + 2);
+            fix->year = 2000 + parse_two_digits(fields[9] + 4);
+        }
+        fix->valid = lengths[2] == 1 && fields[2][0] == 'A';
+        if (fix->valid) {
+            parse_coordinate(fields[3], lengths[3], lengths[4] > 0 ? fields[4][0] : 'N', &fix->latitude_e7);
+            parse_coordinate(fields[5], lengths[5], lengths[6] > 0 ? fields[6][0] : 'E', &fix->longitude_e7);
+            if (parse_fixed(fields[7], lengths[7], 3, &value)) {
+                // A knot is 514.444 mm/s.
+                fix->speed_mm_s = value * 514444 / 1000000;
+            }
+            if (parse_fixed(fields[8], lengths[8], 5, &value)) {
+                fix->course_e5 = value;
+            }
+        }
+        self->sequence++;
+    }
+}
+
+static uint32_t read_u16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// buf holds the class, id, length and payload.
+static void parse_ubx(gnssio_receiver_obj_t *self, size_t payload_len) {
+    const uint8_t *buf = self->buf;
+    if (buf[0] != UBX_NAV_PVT_CLASS || buf[1] != UBX_NAV_PVT_ID || payload_len < UBX_NAV_PVT_LENGTH) {
+        return;
+    }
+    const uint8_t *pvt = buf + 4;
+    gnssio_fix_t *fix = &self->fix;
+    uint8_t valid = pvt[11];
+    if (valid & 0x01) {
+        fix->year = read_u16(pvt + 4);
+        fix->month = pvt[6];
+        fix->day = pvt[7];
+    }
+    if (valid & 0x02) {
+        fix->hour = pvt[8];
+        fix->minute = pvt[9];
+        fix->second = pvt[10];
+    }
+    uint8_t flags = pvt[21];
+    // gnssFixOK and diffSoln
+    fix->valid = flags & 0x01;
+    fix->quality = fix->valid ? ((flags & 0x02) ? 2 : 1) : 0;
+    fix->satellites = pvt[23];
+    if (fix->valid) {
+        fix->longitude_e7 = (int32_t)read_u32(pvt + 24);
+        fix->latitude_e7 = (int32_t)read_u32(pvt + 28);
+        fix->altitude_mm = (int32_t)read_u32(pvt + 36);
+        fix->speed_mm_s = (int32_t)read_u32(pvt + 60);
+        fix->course_e5 = (int32_t)read_u32(pvt + 64);
+        fix->dop_e2 = read_u16(pvt + 76);
+    }
+    self->sequence++;
+}
+
+void common_hal_gnssio_receiver_feed(gnssio_receiver_obj_t *self, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        switch (self->state) {
+            case STATE_NMEA:
+                if (b == '\r' || b == '\n') {
+                    parse_nmea(self);
+                    self->state = STATE_IDLE;
+                } else if (b == '$' || self->len == GNSSIO_MESSAGE_MAX) {
+                    // Start again on a new sentence or drop one that is too long.
+                    self->len = 0;
+                    self->state = b == '$' ? STATE_NMEA : STATE_IDLE;
+                } else {
+                    self->buf[self->len++] = b;
+                }
+                break;
+            case STATE_UBX_SYNC:
+                self->state = b == UBX_SYNC_2 ? STATE_UBX : STATE_IDLE;
+                self->len = 0;
+                break;
+            case STATE_UBX: {
+                self->buf[self->len++] = b;
+                if (self->len < 4) {
+                    break;
+                }
+                size_t payload_len = read_u16(self->buf + 2);
+                if (4 + payload_len + 2 > GNSSIO_MESSAGE_MAX) {
+                    // Not a message that is parsed, so wait for the next one.
+                    self->state = STATE_IDLE;
+                    break;
+                }
+                if (self->len < 4 + payload_len + 2) {
+                    break;
+                }
+                uint8_t ck_a = 0, ck_b = 0;
+                for (size_t j = 0; j < 4 + payload_len; j++) {
+                    ck_a += self->buf[j];
+                    ck_b += ck_a;
+                }
+                if (ck_a == self->buf[4 + payload_len] && ck_b == self->buf[4 + payload_len + 1]) {
+                    parse_ubx(self, payload_len);
+                } else {
+                    self->checksum_errors++;
+                }
+                self->state = STATE_IDLE;
+                break;
+            }
+            default:
+                if (b == '$') {
+                    self->state = STATE_NMEA;
+                    self->len = 0;
+                } else if (b == UBX_SYNC_1) {
+                    self->state = STATE_UBX_SYNC;
+                }
+                break;
+        }
+    }
+}
+
+void gnssio_receiver_poll(gnssio_receiver_obj_t *self) {
+    #if CIRCUITPY_BUSIO_UART
+    if (self->uart == mp_const_none) {
+        return;
+    }
+    busio_uart_obj_t *uart = MP_OBJ_TO_PTR(self->uart);
+    if (common_hal_busio_uart_deinited(uart)) {
+        return;
+    }
+    uint8_t chunk[32];
+    uint32_t available;
+    while ((available = common_hal_busio_uart_rx_characters_available(uart)) > 0) {
+        int errcode;
+        size_t n = common_hal_busio_uart_read(uart, chunk, MIN(available, sizeof(chunk)), &errcode);
+        if (n == 0 || n == MP_STREAM_ERROR) {
+            break;
+        }
+        common_hal_gnssio_receiver_feed(self, chunk, n);
+    }
+    #else
+    (void)self;
+    #endif
+}
+
+bool common_hal_gnssio_receiver_read_fix(gnssio_receiver_obj_t *self, gnssio_fix_obj_t *fix) {
+    gnssio_receiver_poll(self);
+    fix->fix = self->fix;
+    bool updated = self->sequence != self->read_sequence;
+    self->read_sequence = self->sequence;
+    return updated;
+}
+
+uint32_t common_hal_gnssio_receiver_get_checksum_errors(gnssio_receiver_obj_t *self) {
+    return self->checksum_errors;
+}
@@ -0,0 +1,32 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/gnssio/Fix.h"
+
+// Long enough for any NMEA 0183 sentence (82 characters) and a UBX NAV-PVT
+// message (92 byte payload, 6 byte header and 2 byte checksum).
+#define GNSSIO_MESSAGE_MAX (100)
+
+typedef struct _gnssio_receiver_obj_t {
+    mp_obj_base_t base;
+    // A busio.UART to read from in the background, or None.
+    mp_obj_t uart;
+    gnssio_fix_t fix;
+    uint32_t sequence;
+    uint32_t read_sequence;
+    uint32_t checksum_errors;
+    uint16_t len;
+    uint8_t state;
+    bool deinited;
+    uint8_t buf[GNSSIO_MESSAGE_MAX];
+    struct _gnssio_receiver_obj_t *next;
+} gnssio_receiver_obj_t;
+
+// Reads whatever the UART has received, if there is one.
+void gnssio_receiver_poll(gnssio_receiver_obj_t *self);
@@ -0,0 +1,85 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mpstate.h"
+#include "shared-module/gnssio/__init__.h"
+
+#if CIRCUITPY_BUSIO_UART
+
+#include "supervisor/background_callback.h"
+#include "supervisor/shared/tick.h"
+
+static void gnssio_due(void);
+
+// One deadline for all the receivers. It queues a callback to read them,
+// because UARTs can't be read from an interrupt.
+static supervisor_deadline_t gnssio_deadline = { .fun = gnssio_due };
+static background_callback_t gnssio_callback;
+
+static void gnssio_poll(void *unused) {
+    (void)unused;
+    gnssio_receiver_obj_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(gnssio_receivers));
+    if (self == NULL) {
+        return;
+    }
+    for (; self != NULL; self = self->next) {
+        gnssio_receiver_poll(self);
+    }
+    supervisor_deadline_set_after_ms(&gnssio_deadline, CIRCUITPY_GNSSIO_POLL_MS);
+}
+
+// Called from supervisor_tick, so from an interrupt on most ports.
+static void gnssio_due(void) {
+    background_callback_add(&gnssio_callback, gnssio_poll, NULL);
+}
+
+void gnssio_register_receiver(gnssio_receiver_obj_t *self) {
+    self->next = MP_OBJ_TO_PTR(MP_STATE_VM(gnssio_receivers));
+    MP_STATE_VM(gnssio_receivers) = MP_OBJ_FROM_PTR(self);
+    if (!gnssio_deadline.pending) {
+        supervisor_deadline_set_after_ms(&gnssio_deadline, CIRCUITPY_GNSSIO_POLL_MS);
+    }
+}
+
+void gnssio_deregister_receiver(gnssio_receiver_obj_t *self) {
+    if (MP_OBJ_TO_PTR(MP_STATE_VM(gnssio_receivers)) == self) {
+        MP_STATE_VM(gnssio_receivers) = MP_OBJ_FROM_PTR(self->next);
+    } else {
+        gnssio_receiver_obj_t *prev = MP_OBJ_TO_PTR(MP_STATE_VM(gnssio_receivers));
+        while (prev != NULL && prev->next != self) {
+            prev = prev->next;
+        }
+        if (prev != NULL) {
+            prev->next = self->next;
+        }
+    }
+    self->next = NULL;
+    if (MP_STATE_VM(gnssio_receivers) == MP_OBJ_NULL) {
+        supervisor_deadline_cancel(&gnssio_deadline);
+    }
+}
+
+void gnssio_reset(void) {
+    supervisor_deadline_cancel(&gnssio_deadline);
+    MP_STATE_VM(gnssio_receivers) = MP_OBJ_NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t gnssio_receivers);
+
+#else
+
+void gnssio_register_receiver(gnssio_receiver_obj_t *self) {
+    (void)self;
+}
+
+void gnssio_deregister_receiver(gnssio_receiver_obj_t *self) {
+    (void)self;
+}
+
+void gnssio_reset(void) {
+}
+
+#endif // CIRCUITPY_BUSIO_UART
@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/gnssio/Receiver.h"
+
+// Receivers with a UART are read in the background while they are registered.
+void gnssio_register_receiver(gnssio_receiver_obj_t *self);
+void gnssio_deregister_receiver(gnssio_receiver_obj_t *self);
+
+void gnssio_reset(void);
@@ -4,16 +4,91 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
+#include "py/runtime.h"
+
 #include "shared-bindings/hashlib/Hash.h"
 #include "shared-module/hashlib/__init__.h"
 
 #include "mbedtls/ssl.h"
 
+#if CIRCUITPY_HASHLIB_SHA256_HW
+// The hash using the SHA-256 engine. As a root pointer it keeps the object
+// alive, so its state can always be moved back to software when another
+// hash wants the engine.
+MP_REGISTER_ROOT_POINTER(mp_obj_t hashlib_sha256_hw_owner);
+
+static void sha256_hw_release(hashlib_hash_obj_t *self) {
+    mbedtls_sha256_context *ctx = &self->sha256;
+    // Until the first block is done, the engine has no intermediate hash and
+    // ctx->state still has the initial one.
+    bool started = ctx->total[0] >= 64 || ctx->total[1] != 0;
+    hashlib_sha256_hw_stop(started ? ctx->state : NULL);
+    self->hw = false;
+    MP_STATE_VM(hashlib_sha256_hw_owner) = MP_OBJ_NULL;
+}
+
+void shared_module_hashlib_hash_sha256_hw_claim(hashlib_hash_obj_t *self) {
+    mp_obj_t owner = MP_STATE_VM(hashlib_sha256_hw_owner);
+    if (owner != MP_OBJ_NULL) {
+        sha256_hw_release(MP_OBJ_TO_PTR(owner));
+    }
+    self->hw = hashlib_sha256_hw_start();
+    if (self->hw) {
+        MP_STATE_VM(hashlib_sha256_hw_owner) = MP_OBJ_FROM_PTR(self);
+    }
+}
+
+// Same bookkeeping as mbedtls_sha256_update, with whole blocks going to the
+// engine instead of mbedtls_internal_sha256_process.
+static void sha256_hw_update(mbedtls_sha256_context *ctx, const uint8_t *data, size_t datalen) {
+    size_t left = ctx->total[0] & 0x3f;
+    ctx->total[0] += (uint32_t)datalen;
+    if (ctx->total[0] < (uint32_t)datalen) {
+        ctx->total[1]++;
+    }
+    if (left > 0) {
+        size_t fill = 64 - left;
+        if (datalen < fill) {
+            memcpy(ctx->buffer + left, data, datalen);
+            return;
+        }
+        memcpy(ctx->buffer + left, data, fill);
+        hashlib_sha256_hw_update(ctx->buffer, 64);
+        data += fill;
+        datalen -= fill;
+    }
+    size_t whole = datalen & ~(size_t)0x3f;
+    if (whole > 0) {
+        hashlib_sha256_hw_update(data, whole);
+    }
+    memcpy(ctx->buffer, data + whole, datalen - whole);
+}
+
+void hashlib_reset(void) {
+    mp_obj_t owner = MP_STATE_VM(hashlib_sha256_hw_owner);
+    if (owner != MP_OBJ_NULL) {
+        sha256_hw_release(MP_OBJ_TO_PTR(owner));
+    }
+}
+#endif
+
 void common_hal_hashlib_hash_update(hashlib_hash_obj_t *self, const uint8_t *data, size_t datalen) {
     if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
         mbedtls_sha1_update_ret(&self->sha1, data, datalen);
         return;
     }
+    if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        #if CIRCUITPY_HASHLIB_SHA256_HW
+        if (self->hw) {
+            sha256_hw_update(&self->sha256, data, datalen);
+            return;
+        }
+        #endif
+        mbedtls_sha256_update_ret(&self->sha256, data, datalen);
+        return;
+    }
 }
 
 void common_hal_hashlib_hash_digest(hashlib_hash_obj_t *self, uint8_t *data, size_t datalen) {
@@ -28,11 +103,47 @@ void common_hal_hashlib_hash_digest(hashlib_hash_obj_t *self, uint8_t *data, siz
         mbedtls_sha1_finish_ret(&self->sha1, data);
         mbedtls_sha1_clone(&self->sha1, &copy);
     }
+    if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        #if CIRCUITPY_HASHLIB_SHA256_HW
+        // The engine can't be loaded with a state, so padding it would end
+        // the hash. Finish in software instead; only the last block or two
+        // are left.
+        if (self->hw) {
+            sha256_hw_release(self);
+        }
+        #endif
+        mbedtls_sha256_context copy;
+        mbedtls_sha256_clone(&copy, &self->sha256);
+        mbedtls_sha256_finish_ret(&self->sha256, data);
+        mbedtls_sha256_clone(&self->sha256, &copy);
+    }
 }
 
 size_t common_hal_hashlib_hash_get_digest_size(hashlib_hash_obj_t *self) {
     if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
         return 20;
     }
+    if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        return 32;
+    }
     return 0;
 }
+
+const char *common_hal_hashlib_hash_get_backend(hashlib_hash_obj_t *self) {
+    if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        #if CIRCUITPY_HASHLIB_SHA256_HW
+        if (self->hw) {
+            return hashlib_sha256_hw_name;
+        }
+        #endif
+        #if defined(MBEDTLS_SHA256_ALT)
+        return CIRCUITPY_HASHLIB_ALT_BACKEND;
+        #endif
+    }
+    #if defined(MBEDTLS_SHA1_ALT)
+    if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
+        return CIRCUITPY_HASHLIB_ALT_BACKEND;
+    }
+    #endif
+    return "mbedtls";
+}
@@ -7,12 +7,25 @@
 #pragma once
 
 #include "mbedtls/sha1.h"
+#include "mbedtls/sha256.h"
 
 typedef struct {
     mp_obj_base_t base;
     union {
         mbedtls_sha1_context sha1;
+        mbedtls_sha256_context sha256;
     };
     // Of MBEDTLS_SSL_HASH_*
     uint8_t hash_type;
+    #if CIRCUITPY_HASHLIB_SHA256_HW
+    // True while the port's SHA-256 engine holds the state of sha256. Whole
+    // blocks go to the engine and sha256 only tracks the length and the
+    // partial block.
+    bool hw;
+    #endif
 } hashlib_hash_obj_t;
+
+#if CIRCUITPY_HASHLIB_SHA256_HW
+// Move the SHA-256 engine to self, taking it from any other hash first.
+void shared_module_hashlib_hash_sha256_hw_claim(hashlib_hash_obj_t *self);
+#endif
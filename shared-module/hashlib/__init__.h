@@ -13,4 +13,31 @@
 #define mbedtls_sha1_starts_ret mbedtls_sha1_starts
 #define mbedtls_sha1_update_ret mbedtls_sha1_update
 #define mbedtls_sha1_finish_ret mbedtls_sha1_finish
+#define mbedtls_sha256_starts_ret mbedtls_sha256_starts
+#define mbedtls_sha256_update_ret mbedtls_sha256_update
+#define mbedtls_sha256_finish_ret mbedtls_sha256_finish
+#endif
+
+// Reported by Hash.backend when mbedtls was built with an alternate
+// (usually hardware) implementation of an algorithm.
+#ifndef CIRCUITPY_HASHLIB_ALT_BACKEND
+#define CIRCUITPY_HASHLIB_ALT_BACKEND "mbedtls_alt"
+#endif
+
+#if CIRCUITPY_HASHLIB_SHA256_HW
+// Implemented by ports with a SHA-256 engine that can be fed whole blocks and
+// read back the intermediate hash, but cannot be loaded with one. Only one
+// hash at a time can use it.
+
+// Claim the engine and start a new hash. Returns false if it is unavailable.
+bool hashlib_sha256_hw_start(void);
+// Hash len bytes of data. len is a multiple of 64.
+void hashlib_sha256_hw_update(const uint8_t *data, size_t len);
+// Release the engine. If state is not NULL, store the intermediate hash there.
+void hashlib_sha256_hw_stop(uint32_t state[8]);
+// Name of the engine, reported by Hash.backend.
+extern const char hashlib_sha256_hw_name[];
+
+// Give up the engine before the VM goes away.
+void hashlib_reset(void);
 #endif
@@ -204,6 +204,11 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     self->skip_dest_index_none = skip_dest_index_none;
 
     self->dest = bitmap;
+    // Only decode the MCUs that overlap the part of the scaled image being copied.
+    self->decoder.roi_left = MIN(lim->x1 << scale, self->decoder.width);
+    self->decoder.roi_top = MIN(lim->y1 << scale, self->decoder.height);
+    self->decoder.roi_right = MIN(lim->x2 << scale, self->decoder.width);
+    self->decoder.roi_bottom = MIN(lim->y2 << scale, self->decoder.height);
     JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
     common_hal_jpegio_jpegdecoder_close(self);
     if (result != JDR_INTR) {
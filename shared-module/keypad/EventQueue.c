@@ -8,6 +8,8 @@
 #include "shared-bindings/keypad/EventQueue.h"
 #include "shared-bindings/supervisor/__init__.h"
 #include "shared-module/keypad/EventQueue.h"
+#include "supervisor/shared/object_pool.h"
+#include "supervisor/shared/trace.h"
 
 // Key number is lower 15 bits of a 16-bit value.
 #define EVENT_PRESSED (1 << 15)
@@ -33,13 +35,16 @@ bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad
     return true;
 }
 
+// Events are created for every key transition, so they come from a pool.
+static OBJECT_POOL(event_pool, keypad_event_obj_t);
+
 mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self) {
-    keypad_event_obj_t *event = mp_obj_malloc(keypad_event_obj_t, &keypad_event_type);
+    keypad_event_obj_t *event = object_pool_obj_malloc(&event_pool, keypad_event_obj_t, &keypad_event_type);
     bool result = common_hal_keypad_eventqueue_get_into(self, event);
     if (result) {
         return event;
     }
-    m_free(event);
+    object_pool_free(event);
     return MP_ROM_NONE;
 }
 
@@ -76,6 +81,7 @@ bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_numbe
         encoded_event |= EVENT_PRESSED;
     }
     ringbuf_put16(&self->encoded_events, encoded_event);
+    trace_event(TRACE_EVENT_KEYPAD, encoded_event);
     ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(mp_obj_t));
 
     if (self->event_handler) {
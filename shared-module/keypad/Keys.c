@@ -18,12 +18,24 @@
 
 static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp);
 static size_t keys_get_key_count(void *self_in);
+static bool keys_sleep(void *self_in);
+static void keys_wake(void *self_in);
 
 static keypad_scanner_funcs_t keys_funcs = {
     .scan_now = keypad_keys_scan_now,
     .get_key_count = keys_get_key_count,
+    .sleep = keys_sleep,
+    .wake = keys_wake,
 };
 
+// Ports that can interrupt on pin edges replace these.
+MP_WEAK bool keypad_keys_port_wait_for_press(keypad_keys_obj_t *self) {
+    return false;
+}
+
+MP_WEAK void keypad_keys_port_stop_waiting(keypad_keys_obj_t *self) {
+}
+
 void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed, bool pull, mp_float_t interval, size_t max_events, uint8_t debounce_threshold) {
     mp_obj_t dios[num_pins];
 
@@ -82,3 +94,24 @@ static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp) {
         }
     }
 }
+
+static bool keys_sleep(void *self_in) {
+    keypad_keys_obj_t *self = self_in;
+    if (!keypad_keys_port_wait_for_press(self)) {
+        return false;
+    }
+    // A key pressed just before the edge interrupts were enabled would be missed, so check again.
+    size_t key_count = keys_get_key_count(self);
+    for (mp_uint_t key_number = 0; key_number < key_count; key_number++) {
+        if (common_hal_digitalio_digitalinout_get_value(self->digitalinouts->items[key_number]) ==
+            self->value_when_pressed) {
+            keypad_keys_port_stop_waiting(self);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void keys_wake(void *self_in) {
+    keypad_keys_port_stop_waiting(self_in);
+}
@@ -20,3 +20,9 @@ typedef struct {
 } keypad_keys_obj_t;
 
 void keypad_keys_scan(keypad_keys_obj_t *self);
+
+// Ports that can interrupt on pin edges implement these. While every key is released, Keys
+// then stops scanning until the port calls keypad_wake_scanner() from the interrupt.
+// wait_for_press returns false if it can't watch the pins.
+bool keypad_keys_port_wait_for_press(keypad_keys_obj_t *self);
+void keypad_keys_port_stop_waiting(keypad_keys_obj_t *self);
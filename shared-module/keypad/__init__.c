@@ -19,6 +19,15 @@ supervisor_lock_t keypad_scanners_linked_list_lock;
 static void keypad_scan_now(keypad_scanner_obj_t *self, uint64_t now);
 static void keypad_scan_maybe(keypad_scanner_obj_t *self, uint64_t now);
 
+// A tick is only needed when the next scanner is due, not every tick.
+static supervisor_deadline_t keypad_deadline;
+
+static void keypad_scan_at(uint64_t ticks) {
+    if (!keypad_deadline.pending || ticks < keypad_deadline.ticks) {
+        supervisor_deadline_set(&keypad_deadline, ticks);
+    }
+}
+
 void keypad_tick(void) {
     // Fast path. Return immediately there are no scanners.
     if (!MP_STATE_VM(keypad_scanners_linked_list)) {
@@ -31,9 +40,15 @@ void keypad_tick(void) {
         mp_obj_t scanner = MP_STATE_VM(keypad_scanners_linked_list);
         while (scanner) {
             keypad_scan_maybe(scanner, now);
+            if (!((keypad_scanner_obj_t *)scanner)->idle) {
+                keypad_scan_at(((keypad_scanner_obj_t *)scanner)->next_scan_ticks);
+            }
             scanner = ((keypad_scanner_obj_t *)scanner)->next;
         }
         supervisor_release_lock(&keypad_scanners_linked_list_lock);
+    } else {
+        // Try again on the next tick.
+        keypad_scan_at(port_get_raw_ticks(NULL) + 1);
     }
 }
 
@@ -55,15 +70,14 @@ void keypad_register_scanner(keypad_scanner_obj_t *scanner) {
     scanner->next = MP_STATE_VM(keypad_scanners_linked_list);
     MP_STATE_VM(keypad_scanners_linked_list) = scanner;
     supervisor_release_lock(&keypad_scanners_linked_list_lock);
-
-    // One more request for ticks.
-    supervisor_enable_tick();
 }
 
 // Remove scanner from the list of active scanners.
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner) {
-    // One less request for ticks.
-    supervisor_disable_tick();
+    if (scanner->idle) {
+        scanner->funcs->wake(scanner);
+        scanner->idle = false;
+    }
 
     supervisor_acquire_lock(&keypad_scanners_linked_list_lock);
     if (MP_STATE_VM(keypad_scanners_linked_list) == scanner) {
@@ -98,24 +112,62 @@ void keypad_construct_common(keypad_scanner_obj_t *self, mp_float_t interval, si
     self->debounce_threshold = debounce_threshold;
 
     self->never_reset = false;
+    self->idle = false;
 
     // Add self to the list of active keypad scanners.
     keypad_register_scanner(self);
     keypad_scan_now(self, port_get_raw_ticks(NULL));
 }
 
+// When every key is released and done debouncing, a scanner that can wait for a pin change
+// stops scheduling scans, so an idle keypad doesn't keep the board awake.
+static void keypad_maybe_sleep(keypad_scanner_obj_t *self) {
+    if (self->funcs->sleep == NULL || self->idle) {
+        return;
+    }
+    size_t key_count = common_hal_keypad_generic_get_key_count(self);
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        if (self->debounce_counter[key_number] != -self->debounce_threshold) {
+            return;
+        }
+    }
+    if (self->funcs->sleep(self)) {
+        self->idle = true;
+    }
+}
+
 static void keypad_scan_now(keypad_scanner_obj_t *self, uint64_t now) {
     self->next_scan_ticks = now + self->interval_ticks;
     self->funcs->scan_now(self, supervisor_ticks_ms());
+    keypad_maybe_sleep(self);
+    if (!self->idle) {
+        keypad_scan_at(self->next_scan_ticks);
+    }
 }
 
 static void keypad_scan_maybe(keypad_scanner_obj_t *self, uint64_t now) {
-    if (now < self->next_scan_ticks) {
+    if (self->idle || now < self->next_scan_ticks) {
         return;
     }
     keypad_scan_now(self, now);
 }
 
+static void keypad_wake_callback(void *self_in) {
+    keypad_scanner_obj_t *self = self_in;
+    if (!self->idle) {
+        return;
+    }
+    self->funcs->wake(self);
+    self->idle = false;
+    // Scan on the next tick.
+    self->next_scan_ticks = 0;
+    keypad_scan_at(0);
+}
+
+void keypad_wake_scanner(keypad_scanner_obj_t *self) {
+    background_callback_add(&self->wake_callback, keypad_wake_callback, self);
+}
+
 bool keypad_debounce(keypad_scanner_obj_t *self, mp_uint_t key_number, bool current) {
     if (current) {
         if ((self->debounce_counter[key_number] < self->debounce_threshold) &&
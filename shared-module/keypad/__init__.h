@@ -7,11 +7,17 @@
 #pragma once
 
 #include "py/obj.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/lock.h"
 
 typedef struct _keypad_scanner_funcs_t {
     void (*scan_now)(void *self_in, mp_obj_t timestamp);
     size_t (*get_key_count)(void *self_in);
+    // Optional. Arrange for keypad_wake_scanner() to be called when a key may have been
+    // pressed, and return true, or return false if that isn't possible right now.
+    bool (*sleep)(void *self_in);
+    // Undo sleep(). Required when sleep is provided.
+    void (*wake)(void *self_in);
 } keypad_scanner_funcs_t;
 
 // All scanners must begin with these common fields.
@@ -26,7 +32,10 @@ typedef struct _keypad_scanner_funcs_t {
     struct _keypad_eventqueue_obj_t *events; \
     mp_uint_t interval_ticks; \
     uint8_t debounce_threshold; \
-    bool never_reset
+    bool never_reset; \
+    /* True while waiting for keypad_wake_scanner() instead of scanning on ticks. */ \
+    bool idle; \
+    background_callback_t wake_callback
 
 typedef struct _keypad_scanner_obj_t {
     KEYPAD_SCANNER_COMMON_FIELDS;
@@ -41,6 +50,8 @@ void keypad_register_scanner(keypad_scanner_obj_t *scanner);
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner);
 void keypad_construct_common(keypad_scanner_obj_t *scanner, mp_float_t interval, size_t max_events, uint8_t debounce_cycles);
 bool keypad_debounce(keypad_scanner_obj_t *self, mp_uint_t key_number, bool current);
+// Safe to call from an interrupt.
+void keypad_wake_scanner(keypad_scanner_obj_t *self);
 void keypad_never_reset(keypad_scanner_obj_t *self);
 
 size_t common_hal_keypad_generic_get_key_count(void *scanner);
@@ -0,0 +1,86 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared-bindings/mdns/RemoteService.h"
+#include "shared-bindings/mdns/Server.h"
+#include "shared-module/mdns/__init__.h"
+#include "supervisor/shared/tick.h"
+
+// Records may say they last much longer, but a cached result older than this
+// is never used.
+#define MAX_TTL_S (24 * 60 * 60)
+
+// Keys are "<service_type>.<protocol>". Each value is a tuple of when the find
+// finished, when its first record expires, both in ms ticks, and its results.
+static mp_obj_t cache_key(const char *service_type, const char *protocol) {
+    vstr_t vstr;
+    vstr_init(&vstr, strlen(service_type) + strlen(protocol) + 2);
+    vstr_add_str(&vstr, service_type);
+    vstr_add_char(&vstr, '.');
+    vstr_add_str(&vstr, protocol);
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
+mp_obj_t mdns_cache_lookup(const char *service_type, const char *protocol, mp_float_t max_age) {
+    if (max_age <= 0 || MP_STATE_VM(mdns_find_cache) == MP_OBJ_NULL) {
+        return MP_OBJ_NULL;
+    }
+    mp_map_t *map = mp_obj_dict_get_map(MP_STATE_VM(mdns_find_cache));
+    mp_map_elem_t *elem = mp_map_lookup(map, cache_key(service_type, protocol), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return MP_OBJ_NULL;
+    }
+    size_t len;
+    mp_obj_t *entry;
+    mp_obj_tuple_get(elem->value, &len, &entry);
+    uint32_t now = supervisor_ticks_ms32();
+    uint32_t found = mp_obj_get_int_truncated(entry[0]);
+    uint32_t expires = mp_obj_get_int_truncated(entry[1]);
+    if ((int32_t)(expires - now) <= 0) {
+        mp_map_lookup(map, elem->key, MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+        return MP_OBJ_NULL;
+    }
+    if (now - found > max_age * 1000) {
+        return MP_OBJ_NULL;
+    }
+    return entry[2];
+}
+
+void mdns_cache_store(const char *service_type, const char *protocol, mp_obj_t results) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(results, &len, &items);
+    // With no records, nothing says how long the answer holds.
+    uint32_t ttl = len > 0 ? MAX_TTL_S : 0;
+    for (size_t i = 0; i < len; i++) {
+        ttl = MIN(ttl, mdns_remoteservice_get_ttl(MP_OBJ_TO_PTR(items[i])));
+    }
+    if (ttl == 0) {
+        return;
+    }
+    if (MP_STATE_VM(mdns_find_cache) == MP_OBJ_NULL) {
+        MP_STATE_VM(mdns_find_cache) = mp_obj_new_dict(1);
+    }
+    uint32_t now = supervisor_ticks_ms32();
+    mp_obj_t entry[] = {
+        mp_obj_new_int_from_uint(now),
+        mp_obj_new_int_from_uint(now + ttl * 1000),
+        results,
+    };
+    mp_obj_dict_store(MP_STATE_VM(mdns_find_cache), cache_key(service_type, protocol),
+        mp_obj_new_tuple(MP_ARRAY_SIZE(entry), entry));
+}
+
+void mdns_reset(void) {
+    MP_STATE_VM(mdns_find_cache) = MP_OBJ_NULL;
+    mdns_server_browse_reset();
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t mdns_find_cache);
@@ -0,0 +1,18 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// Returns the results of the last find() for the service if it finished at most
+// max_age seconds ago and none of its records have expired, or MP_OBJ_NULL.
+mp_obj_t mdns_cache_lookup(const char *service_type, const char *protocol, mp_float_t max_age);
+// Remembers a tuple of RemoteService found for the service until the first of
+// their records expires.
+void mdns_cache_store(const char *service_type, const char *protocol, mp_obj_t results);
+
+void mdns_reset(void);
@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/binary.h"
@@ -28,21 +29,46 @@ typedef struct _msgpack_stream_t {
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
     int errcode;
+    // When stream_obj is MP_OBJ_NULL, data is read from or written to buf
+    // starting at pos.
+    byte *buf;
+    size_t len;
+    size_t pos;
+    // For returning bin data as memoryviews of buf: the start of the GC
+    // block holding buf, and the offset of buf in it. mv_base is NULL to copy.
+    void *mv_base;
+    size_t mv_offset;
 } msgpack_stream_t;
 
 static msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0, NULL, 0, 0, NULL, 0};
+    return s;
+}
+
+static msgpack_stream_t get_buffer_stream(byte *buf, size_t len, size_t offset) {
+    msgpack_stream_t s = {MP_OBJ_NULL, NULL, NULL, 0, buf, len, offset, NULL, 0};
     return s;
 }
 
 ////////////////////////////////////////////////////////////////
 // readers
 
-static void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
+static void read_bytes(msgpack_stream_t *s, void *buf, mp_uint_t size) {
     if (size == 0) {
         return;
     }
+    if (s->stream_obj == MP_OBJ_NULL) {
+        if (s->pos == s->len) {
+            mp_raise_msg(&mp_type_EOFError, NULL);
+        }
+        if (size > s->len - s->pos) {
+            mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+        }
+        memcpy(buf, s->buf + s->pos, size);
+        s->pos += size;
+        return;
+    }
     mp_uint_t ret = s->read(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -57,13 +83,13 @@ static void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
 
 static uint8_t read1(msgpack_stream_t *s) {
     uint8_t res = 0;
-    read(s, &res, 1);
+    read_bytes(s, &res, 1);
     return res;
 }
 
 static uint16_t read2(msgpack_stream_t *s) {
     uint16_t res = 0;
-    read(s, &res, 2);
+    read_bytes(s, &res, 2);
     int n = 1;
     if (*(char *)&n == 1) {
         res = __builtin_bswap16(res);
@@ -73,7 +99,7 @@ static uint16_t read2(msgpack_stream_t *s) {
 
 static uint32_t read4(msgpack_stream_t *s) {
     uint32_t res = 0;
-    read(s, &res, 4);
+    read_bytes(s, &res, 4);
     int n = 1;
     if (*(char *)&n == 1) {
         res = __builtin_bswap32(res);
@@ -83,7 +109,7 @@ static uint32_t read4(msgpack_stream_t *s) {
 
 static uint64_t read8(msgpack_stream_t *s) {
     uint64_t res = 0;
-    read(s, &res, 8);
+    read_bytes(s, &res, 8);
     int n = 1;
     if (*(char *)&n == 1) {
         res = __builtin_bswap64(res);
@@ -110,7 +136,15 @@ static size_t read_size(msgpack_stream_t *s, uint8_t len_index) {
 ////////////////////////////////////////////////////////////////
 // writers
 
-static void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
+static void write_bytes(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
+    if (s->stream_obj == MP_OBJ_NULL) {
+        if (size > s->len - s->pos) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+        }
+        memcpy(s->buf + s->pos, buf, size);
+        s->pos += size;
+        return;
+    }
     mp_uint_t ret = s->write(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -121,7 +155,7 @@ static void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
 }
 
 static void write1(msgpack_stream_t *s, uint8_t obj) {
-    write(s, &obj, 1);
+    write_bytes(s, &obj, 1);
 }
 
 static void write2(msgpack_stream_t *s, uint16_t obj) {
@@ -129,7 +163,7 @@ static void write2(msgpack_stream_t *s, uint16_t obj) {
     if (*(char *)&n == 1) {
         obj = __builtin_bswap16(obj);
     }
-    write(s, &obj, 2);
+    write_bytes(s, &obj, 2);
 }
 
 static void write4(msgpack_stream_t *s, uint32_t obj) {
@@ -137,7 +171,7 @@ static void write4(msgpack_stream_t *s, uint32_t obj) {
     if (*(char *)&n == 1) {
         obj = __builtin_bswap32(obj);
     }
-    write(s, &obj, 4);
+    write_bytes(s, &obj, 4);
 }
 
 // compute and write msgpack size code (array structures)
@@ -192,7 +226,7 @@ static void pack_int(msgpack_stream_t *s, int32_t x) {
 static void pack_bin(msgpack_stream_t *s, const uint8_t *data, size_t len) {
     write_size(s, 0xc4, len);
     if (len > 0) {
-        write(s, data, len);
+        write_bytes(s, data, len);
     }
 }
 
@@ -212,7 +246,7 @@ static void pack_ext(msgpack_stream_t *s, int8_t code, const uint8_t *data, size
     }
     write1(s, code);    // type byte
     if (len > 0) {
-        write(s, data, len);
+        write_bytes(s, data, len);
     }
 }
 
@@ -223,7 +257,7 @@ static void pack_str(msgpack_stream_t *s, const char *str, size_t len) {
         write_size(s, 0xd9, len);
     }
     if (len > 0) {
-        write(s, str, len);
+        write_bytes(s, str, len);
     }
 }
 
@@ -293,11 +327,12 @@ static void pack(mp_obj_t obj, msgpack_stream_t *s, mp_obj_t default_handler) {
             pack(next->value, s, default_handler);
         }
     } else if (mp_obj_is_float(obj)) {
-        union Float { mp_float_t f;
+        // Always packed as float32, even where mp_float_t is double.
+        union Float { float f;
                       uint32_t u;
         };
         union Float data;
-        data.f = mp_obj_float_get(obj);
+        data.f = (float)mp_obj_float_get(obj);
         write1(s, 0xca);
         write4(s, data.u);
     } else if (obj == mp_const_none) {
@@ -343,15 +378,26 @@ static mp_obj_t unpack_array_elements(msgpack_stream_t *s, size_t size, mp_obj_t
 }
 
 static mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
+    if (s->mv_base != NULL && s->mv_offset + s->pos <= ((1LL << MP_OBJ_ARRAY_FREE_SIZE_BITS) - 1)) {
+        // Make a memoryview of the source rather than copying. It refers to
+        // the start of the buffer's GC block so that it keeps the block alive.
+        if (size > s->len - s->pos) {
+            mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+        }
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(mp_obj_new_memoryview('B', size, s->mv_base));
+        view->free = s->mv_offset + s->pos;
+        s->pos += size;
+        return MP_OBJ_FROM_PTR(view);
+    }
     vstr_t vstr;
     vstr_init_len(&vstr, size);
     byte *p = (byte *)vstr.buf;
     // read in chunks: (some drivers - e.g. UART) limit the
     // maximum number of bytes that can be read at once
-    // read(s, p, size);
+    // read_bytes(s, p, size);
     while (size > 0) {
         int n = size > 256 ? 256 : size;
-        read(s, p, n);
+        read_bytes(s, p, n);
         size -= n;
         p += n;
     }
@@ -382,7 +428,7 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b11111;
         // allocate on stack; len < 32
         char str[len];
-        read(s, &str, len);
+        read_bytes(s, &str, len);
         return mp_obj_new_str(str, len);
     }
     if ((code & 0b11110000) == 0b10010000) {
@@ -394,7 +440,9 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b1111;
         mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
         for (size_t i = 0; i < len; i++) {
-            mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+            // The key comes first, and argument evaluation order is unspecified.
+            mp_obj_t key = unpack(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
         }
         return MP_OBJ_FROM_PTR(d);
     }
@@ -429,12 +477,12 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             return mp_obj_new_int_from_ll((int64_t)read8(s));
         case 0xca: { // float
             union Float {
-                mp_float_t f;
+                float f;
                 uint32_t u;
             };
             union Float data;
             data.u = read4(s);
-            return mp_obj_new_float(data.f);
+            return mp_obj_new_float_from_f(data.f);
         }
         case 0xcb: { // double
             union Double {
@@ -453,7 +501,7 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             vstr_t vstr;
             vstr_init_len(&vstr, size);
             byte *p = (byte *)vstr.buf;
-            read(s, p, size);
+            read_bytes(s, p, size);
             return mp_obj_new_str_from_vstr(&vstr);
         }
         case 0xde:
@@ -462,7 +510,8 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             size_t len = read_size(s, code - 0xde + 1);
             mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
             for (size_t i = 0; i < len; i++) {
-                mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+                mp_obj_t key = unpack(s, ext_hook, use_list);
+                mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
             }
             return MP_OBJ_FROM_PTR(d);
         }
@@ -502,3 +551,30 @@ mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
     return unpack(&stream, ext_hook, use_list);
 }
+
+size_t common_hal_msgpack_pack_into(mp_obj_t obj, byte *buf, size_t len, size_t offset, mp_obj_t default_handler) {
+    msgpack_stream_t stream = get_buffer_stream(buf, len, offset);
+    pack(obj, &stream, default_handler);
+    return stream.pos;
+}
+
+mp_obj_t common_hal_msgpack_unpack_from(mp_obj_t buffer_obj, size_t *offset, mp_obj_t ext_hook, bool use_list, bool zero_copy) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
+    msgpack_stream_t stream = get_buffer_stream(bufinfo.buf, bufinfo.len, *offset);
+    if (zero_copy) {
+        if (mp_obj_is_type(buffer_obj, &mp_type_memoryview)) {
+            // A memoryview's items already point to the start of the block.
+            mp_obj_array_t *view = MP_OBJ_TO_PTR(buffer_obj);
+            if (mp_binary_get_size('@', bufinfo.typecode, NULL) == 1) {
+                stream.mv_base = view->items;
+                stream.mv_offset = view->free;
+            }
+        } else {
+            stream.mv_base = bufinfo.buf;
+        }
+    }
+    mp_obj_t result = unpack(&stream, ext_hook, use_list);
+    *offset = stream.pos;
+    return result;
+}
@@ -69,3 +69,78 @@ void common_hal_onewireio_onewire_write_bit(onewireio_onewire_obj_t *self,
     common_hal_mcu_delay_us(bit? 64 : 10);
     common_hal_mcu_enable_interrupts();
 }
+
+void common_hal_onewireio_onewire_read(onewireio_onewire_obj_t *self, uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t byte = 0;
+        for (int bit = 0; bit < 8; bit++) {
+            byte |= common_hal_onewireio_onewire_read_bit(self) << bit;
+        }
+        buf[i] = byte;
+    }
+}
+
+void common_hal_onewireio_onewire_write(onewireio_onewire_obj_t *self, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        for (int bit = 0; bit < 8; bit++) {
+            common_hal_onewireio_onewire_write_bit(self, (buf[i] >> bit) & 1);
+        }
+    }
+}
+
+bool common_hal_onewireio_onewire_select(onewireio_onewire_obj_t *self, const uint8_t *rom) {
+    if (common_hal_onewireio_onewire_reset(self)) {
+        return true;
+    }
+    if (rom == NULL) {
+        const uint8_t skip_rom = ONEWIRE_SKIP_ROM;
+        common_hal_onewireio_onewire_write(self, &skip_rom, 1);
+    } else {
+        const uint8_t match_rom = ONEWIRE_MATCH_ROM;
+        common_hal_onewireio_onewire_write(self, &match_rom, 1);
+        common_hal_onewireio_onewire_write(self, rom, ONEWIRE_ROM_LENGTH);
+    }
+    return false;
+}
+
+// This is the search from https://www.analog.com/en/resources/app-notes/1wire-search-algorithm.html
+// *last_discrepancy is the last bit where the previous search took the 0
+// branch. It starts past the end of the ROM and is -1 once every device has
+// been found.
+bool common_hal_onewireio_onewire_search_next(onewireio_onewire_obj_t *self, uint8_t command,
+    uint8_t rom[ONEWIRE_ROM_LENGTH], int *last_discrepancy) {
+    if (*last_discrepancy < 0 || common_hal_onewireio_onewire_reset(self)) {
+        return false;
+    }
+    common_hal_onewireio_onewire_write(self, &command, 1);
+    int discrepancy = -1;
+    for (int i = 0; i < ONEWIRE_ROM_LENGTH * 8; i++) {
+        bool id_bit = common_hal_onewireio_onewire_read_bit(self);
+        bool complement = common_hal_onewireio_onewire_read_bit(self);
+        bool direction;
+        if (id_bit && complement) {
+            // Nothing answered.
+            return false;
+        } else if (id_bit != complement) {
+            direction = id_bit;
+        } else {
+            // Devices differ here.
+            if (i < *last_discrepancy) {
+                direction = (rom[i / 8] >> (i % 8)) & 1;
+            } else {
+                direction = i == *last_discrepancy;
+            }
+            if (!direction) {
+                discrepancy = i;
+            }
+        }
+        if (direction) {
+            rom[i / 8] |= 1 << (i % 8);
+        } else {
+            rom[i / 8] &= ~(1 << (i % 8));
+        }
+        common_hal_onewireio_onewire_write_bit(self, direction);
+    }
+    *last_discrepancy = discrepancy;
+    return true;
+}
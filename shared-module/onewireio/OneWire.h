@@ -10,6 +10,13 @@
 
 #include "py/obj.h"
 
+#define ONEWIRE_ROM_LENGTH (8)
+
+#define ONEWIRE_SEARCH_ROM (0xf0)
+#define ONEWIRE_ALARM_SEARCH (0xec)
+#define ONEWIRE_MATCH_ROM (0x55)
+#define ONEWIRE_SKIP_ROM (0xcc)
+
 typedef struct {
     mp_obj_base_t base;
     digitalio_digitalinout_obj_t pin;
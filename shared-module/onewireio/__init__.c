@@ -4,4 +4,16 @@
 //
 // SPDX-License-Identifier: MIT
 
-// Nothing now.
+#include "shared-bindings/onewireio/__init__.h"
+
+// Dallas/Maxim CRC-8, polynomial x^8 + x^5 + x^4 + 1, shifted out LSB first.
+uint8_t common_hal_onewireio_crc8(const uint8_t *data, size_t len) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8c : crc >> 1;
+        }
+    }
+    return crc;
+}
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
 #include "py/obj.h"
@@ -115,6 +116,57 @@ mp_obj_t common_hal_os_listdir(const char *path) {
     return dir_list;
 }
 
+typedef struct {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    mp_vfs_mount_t *vfs;
+    mp_obj_t dir;
+    mp_obj_t iter;
+} os_ilistdir_stat_it_t;
+
+// For filesystems other than FAT, stat each entry as it's listed.
+static mp_obj_t os_ilistdir_stat_it_iternext(mp_obj_t self_in) {
+    os_ilistdir_stat_it_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t next = mp_iternext(self->iter);
+    if (next == MP_OBJ_STOP_ITERATION) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_obj_t *entry;
+    mp_obj_get_array_fixed_n(next, 4, &entry);
+
+    size_t dir_len;
+    const char *dir = mp_obj_str_get_data(self->dir, &dir_len);
+    vstr_t path;
+    vstr_init(&path, dir_len + 1 + 16);
+    vstr_add_strn(&path, dir, dir_len);
+    if (dir_len == 0 || dir[dir_len - 1] != '/') {
+        vstr_add_char(&path, '/');
+    }
+    vstr_add_str(&path, mp_obj_str_get_str(entry[0]));
+    mp_obj_t path_obj = mp_obj_new_str_from_vstr(&path);
+    mp_obj_t *stat;
+    mp_obj_get_array_fixed_n(mp_vfs_proxy_call(self->vfs, MP_QSTR_stat, 1, &path_obj), 10, &stat);
+
+    mp_obj_t items[4] = { entry[0], entry[1], stat[6], stat[8] };
+    return mp_obj_new_tuple(4, items);
+}
+
+mp_obj_t common_hal_os_ilistdir_stat(const char *path) {
+    mp_obj_t path_out;
+    mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
+    #if MICROPY_VFS_FAT
+    if (vfs != MP_VFS_NONE && vfs != MP_VFS_ROOT && mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+        return fat_vfs_ilistdir_stat(vfs->obj, path_out);
+    }
+    #endif
+    os_ilistdir_stat_it_t *iter = mp_obj_malloc(os_ilistdir_stat_it_t, &mp_type_polymorph_iter);
+    iter->iternext = os_ilistdir_stat_it_iternext;
+    iter->iter = mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &path_out);
+    iter->vfs = vfs;
+    iter->dir = path_out;
+    return MP_OBJ_FROM_PTR(iter);
+}
+
 void common_hal_os_mkdir(const char *path) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
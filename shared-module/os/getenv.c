@@ -22,13 +22,32 @@
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/reload_filter.h"
 
 #define GETENV_PATH "/settings.toml"
 
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
-typedef FIL file_arg;
-static bool open_file(const char *name, file_arg *active_file) {
+
+#if CIRCUITPY_OS_GETENV_CACHE && !defined(UNIX)
+#include "supervisor/port_heap.h"
+#endif
+
+typedef struct {
+    FIL fp;
+    #if CIRCUITPY_OS_GETENV_CACHE
+    // When set, bytes come from the cached settings instead of fp.
+    const uint8_t *text;
+    size_t pos;
+    size_t len;
+    #endif
+} file_arg;
+
+static bool open_file(const char *name, file_arg *opened) {
+    FIL *active_file = &opened->fp;
+    #if CIRCUITPY_OS_GETENV_CACHE
+    opened->text = NULL;
+    #endif
     #if defined(UNIX)
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
@@ -48,26 +67,49 @@ static bool open_file(const char *name, file_arg *active_file) {
     }
     FATFS *fatfs = &fs_mount->fatfs;
     FRESULT result = f_open(fatfs, active_file, name, FA_READ);
-    return result == FR_OK;
+    if (result != FR_OK) {
+        return false;
+    }
+    reload_filter_track_file(active_file);
+    return true;
     #endif
 }
 static void close_file(file_arg *active_file) {
     // nothing
 }
 static bool is_eof(file_arg *active_file) {
-    return f_eof(active_file) || f_error(active_file);
+    #if CIRCUITPY_OS_GETENV_CACHE
+    if (active_file->text != NULL) {
+        return active_file->pos >= active_file->len;
+    }
+    #endif
+    return f_eof(&active_file->fp) || f_error(&active_file->fp);
 }
 
 // Return 0 if there is no next character (EOF).
-static uint8_t get_next_byte(FIL *active_file) {
+static uint8_t get_next_byte(file_arg *active_file) {
+    #if CIRCUITPY_OS_GETENV_CACHE
+    if (active_file->text != NULL) {
+        if (active_file->pos >= active_file->len) {
+            return 0;
+        }
+        return active_file->text[active_file->pos++];
+    }
+    #endif
     uint8_t character = 0;
     UINT quantity_read;
     // If there's an error or quantity_read is 0, character will remain 0.
-    f_read(active_file, &character, 1, &quantity_read);
+    f_read(&active_file->fp, &character, 1, &quantity_read);
     return character;
 }
 static void seek_eof(file_arg *active_file) {
-    f_lseek(active_file, f_size(active_file));
+    #if CIRCUITPY_OS_GETENV_CACHE
+    if (active_file->text != NULL) {
+        active_file->pos = active_file->len;
+        return;
+    }
+    #endif
+    f_lseek(&active_file->fp, f_size(&active_file->fp));
 }
 
 // For a fixed buffer, record the required size rather than throwing
@@ -265,8 +307,213 @@ static mp_int_t read_value(file_arg *active_file, vstr_t *buf, bool *quoted) {
     }
 }
 
+#if CIRCUITPY_OS_GETENV_CACHE
+// settings.toml is read into RAM once, along with a hash table of where each
+// key's line starts, so that the many lookups at startup don't each scan the
+// file. Any write to a FAT filesystem drops the cache. Files too big to cache
+// are scanned as before.
+#define GETENV_CACHE_MAX_SIZE (2048)
+
+typedef struct {
+    // The masked qstr hash of the key, or 0 for an empty slot.
+    uint16_t hash;
+    uint16_t line_start;
+} getenv_cache_slot_t;
+
+static struct {
+    // The filesystem the cache is for, or NULL if there is no cache.
+    FATFS *fs;
+    DWORD fs_id;
+    bool missing;
+    // NULL if the file is missing or too big.
+    getenv_cache_slot_t *slots;
+    size_t num_slots;
+    const uint8_t *text;
+    size_t len;
+} getenv_cache;
+
+static void *cache_malloc(size_t size) {
+    #if defined(UNIX)
+    return malloc(size);
+    #else
+    return port_malloc(size, false);
+    #endif
+}
+
+static void cache_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    #if defined(UNIX)
+    free(ptr);
+    #else
+    port_free(ptr);
+    #endif
+}
+
+void os_getenv_cache_invalidate(void) {
+    // Only forget the cache here, since writes may come from a USB task. The
+    // memory is freed by the next lookup.
+    getenv_cache.fs = NULL;
+}
+
+static FATFS *settings_fs(void) {
+    #if defined(UNIX)
+    const char *path_out;
+    mp_vfs_mount_t *vfs = mp_vfs_lookup_path(GETENV_PATH, &path_out);
+    if (vfs == MP_VFS_NONE || vfs == MP_VFS_ROOT || !mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+        return NULL;
+    }
+    fs_user_mount_t *fs_mount = MP_OBJ_TO_PTR(vfs->obj);
+    #else
+    fs_user_mount_t *fs_mount = filesystem_circuitpy();
+    if (fs_mount == NULL) {
+        return NULL;
+    }
+    #endif
+    return &fs_mount->fatfs;
+}
+
+// Sets the key of the line at pos: everything before the first "=", less
+// surrounding whitespace, as key_matches() sees it. Returns false if the line
+// has no key.
+static bool cache_key_at(const uint8_t *text, size_t len, size_t pos, size_t *key_start, size_t *key_len) {
+    size_t start = pos;
+    while (pos < len && text[pos] != '\n' && text[pos] != '=') {
+        pos++;
+    }
+    if (pos == len || text[pos] != '=') {
+        return false;
+    }
+    while (pos > start && unichar_isspace(text[pos - 1])) {
+        pos--;
+    }
+    *key_start = start;
+    *key_len = pos - start;
+    return true;
+}
+
+static getenv_cache_slot_t *cache_index(const uint8_t *text, size_t len, size_t *num_slots_out) {
+    // Every line might hold a key, and the table is kept at most half full.
+    size_t num_lines = 1;
+    for (size_t i = 0; i < len; i++) {
+        num_lines += text[i] == '\n';
+    }
+    size_t num_slots = 4;
+    while (num_slots < 2 * num_lines) {
+        num_slots *= 2;
+    }
+    getenv_cache_slot_t *slots = cache_malloc(num_slots * sizeof(getenv_cache_slot_t));
+    if (slots == NULL) {
+        return NULL;
+    }
+    memset(slots, 0, num_slots * sizeof(getenv_cache_slot_t));
+    size_t mask = num_slots - 1;
+    size_t line_start = 0;
+    while (line_start < len) {
+        size_t pos = line_start;
+        while (pos < len && text[pos] != '\n' && unichar_isspace(text[pos])) {
+            pos++;
+        }
+        if (pos < len && text[pos] == '[') {
+            // Tables aren't searched.
+            break;
+        }
+        size_t key_start, key_len;
+        if (cache_key_at(text, len, pos, &key_start, &key_len)) {
+            uint16_t hash = qstr_compute_hash(text + key_start, key_len);
+            // Linear probing keeps a repeated key after its first line, which
+            // is the one a scan finds.
+            size_t i = hash & mask;
+            while (slots[i].hash != 0) {
+                i = (i + 1) & mask;
+            }
+            slots[i].hash = hash;
+            slots[i].line_start = line_start;
+        }
+        const uint8_t *newline = memchr(text + pos, '\n', len - pos);
+        line_start = newline == NULL ? len : (size_t)(newline - text) + 1;
+    }
+    *num_slots_out = num_slots;
+    return slots;
+}
+
+static void cache_fill(FATFS *fs) {
+    cache_free(getenv_cache.slots);
+    cache_free((void *)getenv_cache.text);
+    getenv_cache.slots = NULL;
+    getenv_cache.text = NULL;
+    getenv_cache.missing = false;
+
+    file_arg file;
+    if (!open_file(GETENV_PATH, &file)) {
+        getenv_cache.missing = true;
+    } else if (f_size(&file.fp) <= GETENV_CACHE_MAX_SIZE) {
+        size_t len = f_size(&file.fp);
+        uint8_t *text = cache_malloc(len);
+        UINT quantity_read;
+        if (text != NULL && f_read(&file.fp, text, len, &quantity_read) == FR_OK && quantity_read == len) {
+            getenv_cache.slots = cache_index(text, len, &getenv_cache.num_slots);
+        }
+        if (getenv_cache.slots != NULL) {
+            getenv_cache.text = text;
+            getenv_cache.len = len;
+        } else {
+            cache_free(text);
+        }
+    }
+    close_file(&file);
+    getenv_cache.fs = fs;
+    getenv_cache.fs_id = fs->id;
+}
+
+// Returns true if the cache has the answer, in *result. On GETENV_OK,
+// active_file reads from just after the key's "=".
+static bool cache_lookup(const char *key, file_arg *active_file, os_getenv_err_t *result) {
+    FATFS *fs = settings_fs();
+    if (fs == NULL) {
+        return false;
+    }
+    if (getenv_cache.fs != fs || getenv_cache.fs_id != fs->id) {
+        cache_fill(fs);
+    }
+    if (getenv_cache.missing) {
+        *result = GETENV_ERR_OPEN;
+        return true;
+    }
+    if (getenv_cache.slots == NULL) {
+        return false;
+    }
+    active_file->text = getenv_cache.text;
+    active_file->len = getenv_cache.len;
+    uint16_t hash = qstr_compute_hash((const byte *)key, strlen(key));
+    size_t mask = getenv_cache.num_slots - 1;
+    for (size_t i = hash & mask; getenv_cache.slots[i].hash != 0; i = (i + 1) & mask) {
+        if (getenv_cache.slots[i].hash != hash) {
+            continue;
+        }
+        active_file->pos = getenv_cache.slots[i].line_start;
+        if (key_matches(active_file, key)) {
+            *result = GETENV_OK;
+            return true;
+        }
+    }
+    *result = GETENV_ERR_NOT_FOUND;
+    return true;
+}
+#endif
+
 static os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t *buf, bool *quoted) {
     file_arg active_file;
+    #if CIRCUITPY_OS_GETENV_CACHE
+    os_getenv_err_t cached_result;
+    if (strcmp(path, GETENV_PATH) == 0 && cache_lookup(key, &active_file, &cached_result)) {
+        if (cached_result == GETENV_OK) {
+            cached_result = read_value(&active_file, buf, quoted);
+        }
+        return cached_result;
+    }
+    #endif
     if (!open_file(path, &active_file)) {
         return GETENV_ERR_OPEN;
     }
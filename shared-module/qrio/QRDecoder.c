@@ -116,43 +116,164 @@ static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_p
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+static inline uint8_t pixel_at(const void *buf, size_t i, qrio_pixel_policy_t policy) {
+    const uint8_t *src = buf;
+    const uint16_t *src16 = buf;
+    switch (policy) {
+        case QRIO_RGB565:
+            return (src16[i] >> 3) & 0xfc;
+        case QRIO_RGB565_SWAPPED:
+            return (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+        case QRIO_EVERY_BYTE:
+            return src[i];
+        case QRIO_ODD_BYTES:
+            return src[2 * i + 1];
+        case QRIO_EVEN_BYTES:
+        default:
+            return src[2 * i];
+    }
+}
+
+// Copy region of the image into q, averaging scale x scale blocks. q is only
+// resized when the region's size changes.
+static void quirc_fill_region(qrdecoder_qrdecoder_obj_t *self, struct quirc *q, const void *buf, qrio_pixel_policy_t policy, const qrio_region_t *region, int scale) {
+    int image_width = shared_module_qrio_qrdecoder_get_width(self);
+    int width = region->width / scale;
+    int height = region->height / scale;
+    int q_width, q_height;
+    quirc_begin(q, &q_width, &q_height);
+    if (q_width != width || q_height != height) {
+        quirc_resize(q, width, height);
+    }
+    uint8_t *framebuffer = quirc_begin(q, NULL, NULL);
+    int area = scale * scale;
+    for (int y = 0; y < height; y++) {
+        size_t row = (size_t)(region->y + y * scale) * image_width + region->x;
+        for (int x = 0; x < width; x++) {
+            int sum = 0;
+            for (int j = 0; j < scale; j++) {
+                size_t i = row + j * image_width + x * scale;
+                for (int k = 0; k < scale; k++) {
+                    sum += pixel_at(buf, i + k, policy);
+                }
+            }
+            *framebuffer++ = sum / area;
+        }
+    }
+    quirc_end(q);
+}
+
+// Find codes in roi of the image, shrunk by scale, and return the quirc that
+// holds them.
+static struct quirc *quirc_scan(qrdecoder_qrdecoder_obj_t *self, const void *buf, qrio_pixel_policy_t policy, const qrio_region_t *roi, int scale) {
+    if (scale == 1 && roi->x == 0 && roi->y == 0 &&
+        roi->width == shared_module_qrio_qrdecoder_get_width(self) &&
+        roi->height == shared_module_qrio_qrdecoder_get_height(self)) {
+        quirc_fill_buffer(self, (void *)buf, policy);
+        return self->quirc;
+    }
+    if (self->coarse == NULL) {
+        self->coarse = quirc_new();
+    }
+    quirc_fill_region(self, self->coarse, buf, policy, roi, scale);
+    return self->coarse;
+}
+
+// The full resolution area around a code found in a scaled pass, with some
+// margin. The size is rounded up so that similar codes share a size and the
+// fine pass isn't reallocated for every frame.
+static void candidate_region(qrdecoder_qrdecoder_obj_t *self, const struct quirc_code *code, const qrio_region_t *roi, int scale, qrio_region_t *region) {
+    int x1 = code->corners[0].x, x2 = x1;
+    int y1 = code->corners[0].y, y2 = y1;
+    for (int i = 1; i < 4; i++) {
+        x1 = MIN(x1, code->corners[i].x);
+        x2 = MAX(x2, code->corners[i].x);
+        y1 = MIN(y1, code->corners[i].y);
+        y2 = MAX(y2, code->corners[i].y);
+    }
+    int margin = MAX(x2 - x1, y2 - y1) / 4 + 1;
+    x1 = roi->x + (x1 - margin) * scale;
+    y1 = roi->y + (y1 - margin) * scale;
+    x2 = roi->x + (x2 + margin + 1) * scale;
+    y2 = roi->y + (y2 + margin + 1) * scale;
+
+    int image_width = shared_module_qrio_qrdecoder_get_width(self);
+    int image_height = shared_module_qrio_qrdecoder_get_height(self);
+    region->width = MIN((x2 - x1 + 31) & ~31, image_width);
+    region->height = MIN((y2 - y1 + 31) & ~31, image_height);
+    region->x = MAX(0, MIN(x1, image_width - region->width));
+    region->y = MAX(0, MIN(y1, image_height - region->height));
+}
+
+static void append_info(mp_obj_t result, const struct quirc_data *data) {
+    mp_obj_t payload = mp_obj_new_bytes(data->payload, data->payload_len);
+    // Overlapping candidates can find the same code twice.
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(result, &len, &items);
+    for (size_t i = 0; i < len; i++) {
+        mp_obj_tuple_t *info = MP_OBJ_TO_PTR(items[i]);
+        if (mp_obj_equal(info->items[0], payload)) {
+            return;
+        }
+    }
+    mp_obj_t elems[2] = {
+        payload,
+        data_type(data->data_type),
+    };
+    mp_obj_list_append(result, namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems));
+}
+
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_region_t *roi, int scale) {
+    struct quirc *q = quirc_scan(self, bufinfo->buf, policy, roi, scale);
+    int count = quirc_count(q);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
-        mp_obj_t code_obj;
-        if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
+        quirc_extract(q, i, &self->code);
+        if (quirc_decode(&self->code, &self->data) == QUIRC_SUCCESS) {
+            append_info(result, &self->data);
             continue;
         }
-        mp_obj_t elems[2] = {
-            mp_obj_new_bytes(self->data.payload, self->data.payload_len),
-            data_type(self->data.data_type),
-        };
-        code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems);
-        mp_obj_list_append(result, code_obj);
+        if (scale == 1) {
+            continue;
+        }
+        // Too small to read when scaled down, so look again at full resolution
+        // around where it was found.
+        qrio_region_t region;
+        candidate_region(self, &self->code, roi, scale, &region);
+        if (self->fine == NULL) {
+            self->fine = quirc_new();
+        }
+        quirc_fill_region(self, self->fine, bufinfo->buf, policy, &region, 1);
+        int fine_count = quirc_count(self->fine);
+        for (int j = 0; j < fine_count; j++) {
+            quirc_extract(self->fine, j, &self->code);
+            if (quirc_decode(&self->code, &self->data) == QUIRC_SUCCESS) {
+                append_info(result, &self->data);
+            }
+        }
     }
     return result;
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_region_t *roi, int scale) {
+    struct quirc *q = quirc_scan(self, bufinfo->buf, policy, roi, scale);
+    int count = quirc_count(q);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
+        quirc_extract(q, i, &self->code);
         mp_obj_t code_obj;
+        // Positions are reported in the coordinates of the whole image.
         mp_obj_t elems[9] = {
-            mp_obj_new_int(self->code.corners[0].x),
-            mp_obj_new_int(self->code.corners[0].y),
-            mp_obj_new_int(self->code.corners[1].x),
-            mp_obj_new_int(self->code.corners[1].y),
-            mp_obj_new_int(self->code.corners[2].x),
-            mp_obj_new_int(self->code.corners[2].y),
-            mp_obj_new_int(self->code.corners[3].x),
-            mp_obj_new_int(self->code.corners[3].y),
+            mp_obj_new_int(roi->x + self->code.corners[0].x * scale),
+            mp_obj_new_int(roi->y + self->code.corners[0].y * scale),
+            mp_obj_new_int(roi->x + self->code.corners[1].x * scale),
+            mp_obj_new_int(roi->y + self->code.corners[1].y * scale),
+            mp_obj_new_int(roi->x + self->code.corners[2].x * scale),
+            mp_obj_new_int(roi->y + self->code.corners[2].y * scale),
+            mp_obj_new_int(roi->x + self->code.corners[3].x * scale),
+            mp_obj_new_int(roi->y + self->code.corners[3].y * scale),
             mp_obj_new_int(self->code.size),
         };
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrposition_type_obj, 9, 0, elems);
@@ -10,9 +10,18 @@
 #include "lib/quirc/lib/quirc.h"
 #include "shared-bindings/qrio/PixelPolicy.h"
 
+typedef struct {
+    int x, y, width, height;
+} qrio_region_t;
+
 typedef struct qrio_qrdecoder_obj {
     mp_obj_base_t base;
+    // Sized to the whole image.
     struct quirc *quirc;
+    // Created on first use and kept, so repeated region-of-interest and
+    // downscaled decodes of same-sized frames don't allocate.
+    struct quirc *coarse;
+    struct quirc *fine;
     struct quirc_code code;
     struct quirc_data data;
 } qrdecoder_qrdecoder_obj_t;
@@ -22,5 +31,7 @@ int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+// roi is the part of the image to search, and scale how much to shrink it by
+// for the first pass.
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_region_t *roi, int scale);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_region_t *roi, int scale);
@@ -69,6 +69,16 @@ mp_uint_t shared_modules_random_getrandbits(uint8_t n) {
     return yasmarang() & mask;
 }
 
+void shared_modules_random_randbytes(uint8_t *buf, size_t len) {
+    while (len > 0) {
+        uint32_t r = yasmarang();
+        size_t n = MIN(len, sizeof(r));
+        memcpy(buf, &r, n);
+        buf += n;
+        len -= n;
+    }
+}
+
 mp_int_t shared_modules_random_randrange(mp_int_t start, mp_int_t stop, mp_int_t step) {
     mp_int_t n;
     if (step > 0) {
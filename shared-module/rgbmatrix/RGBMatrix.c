@@ -24,6 +24,19 @@ extern Protomatter_core *_PM_protoPtr;
 
 static void common_hal_rgbmatrix_rgbmatrix_construct1(rgbmatrix_rgbmatrix_obj_t *self, mp_obj_t framebuffer);
 
+// Convert the framebuffer into the bitplanes that aren't being shown, and ask
+// for them to be shown. Unlike _PM_swapbuffer_maybe(), this doesn't wait for the
+// refresh interrupt to reach the end of the frame and make the swap. Other code
+// runs meanwhile, and only the next conversion has to wait if it comes first.
+static void rgbmatrix_convert_and_swap(rgbmatrix_rgbmatrix_obj_t *self) {
+    while (self->protomatter.swapBuffers) {
+    }
+    _PM_convert_565(&self->protomatter, self->bufinfo.buf, self->width);
+    if (self->protomatter.doubleBuffer) {
+        self->protomatter.swapBuffers = 1;
+    }
+}
+
 void common_hal_rgbmatrix_rgbmatrix_construct(rgbmatrix_rgbmatrix_obj_t *self, int width, int bit_depth, uint8_t rgb_count, uint8_t *rgb_pins, uint8_t addr_count, uint8_t *addr_pins, uint8_t clock_pin, uint8_t latch_pin, uint8_t oe_pin, bool doublebuffer, mp_obj_t framebuffer, int8_t tile, bool serpentine, void *timer) {
     self->width = width;
     self->bit_depth = bit_depth;
@@ -84,8 +97,7 @@ static void common_hal_rgbmatrix_rgbmatrix_construct1(rgbmatrix_rgbmatrix_obj_t
         stat = _PM_begin(&self->protomatter);
 
         if (stat == PROTOMATTER_OK) {
-            _PM_convert_565(&self->protomatter, self->bufinfo.buf, self->width);
-            _PM_swapbuffer_maybe(&self->protomatter);
+            rgbmatrix_convert_and_swap(self);
         }
     }
 
@@ -197,10 +209,12 @@ void rgbmatrix_rgbmatrix_collect_ptrs(rgbmatrix_rgbmatrix_obj_t *self) {
 void common_hal_rgbmatrix_rgbmatrix_set_paused(rgbmatrix_rgbmatrix_obj_t *self, bool paused) {
     if (paused && !self->paused) {
         _PM_stop(&self->protomatter);
+        // The interrupt won't make a pending swap now. The bitplanes it would
+        // have shown are converted again on resume.
+        self->protomatter.swapBuffers = 0;
     } else if (!paused && self->paused) {
         _PM_resume(&self->protomatter);
-        _PM_convert_565(&self->protomatter, self->bufinfo.buf, self->width);
-        _PM_swapbuffer_maybe(&self->protomatter);
+        rgbmatrix_convert_and_swap(self);
     }
     self->paused = paused;
 }
@@ -211,8 +225,7 @@ bool common_hal_rgbmatrix_rgbmatrix_get_paused(rgbmatrix_rgbmatrix_obj_t *self)
 
 void common_hal_rgbmatrix_rgbmatrix_refresh(rgbmatrix_rgbmatrix_obj_t *self) {
     if (!self->paused) {
-        _PM_convert_565(&self->protomatter, self->bufinfo.buf, self->width);
-        _PM_swapbuffer_maybe(&self->protomatter);
+        rgbmatrix_convert_and_swap(self);
     }
 }
 
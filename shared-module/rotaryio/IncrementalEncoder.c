@@ -5,13 +5,28 @@
 // SPDX-License-Identifier: MIT
 
 #if CIRCUITPY_ROTARYIO && CIRCUITPY_ROTARYIO_SOFTENCODER
+#include <stdlib.h>
+
 #include "shared-bindings/rotaryio/IncrementalEncoder.h"
 #include "shared-module/rotaryio/IncrementalEncoder.h"
 #include "common-hal/rotaryio/IncrementalEncoder.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/time/__init__.h"
+
+// Ports with a finer clock than the supervisor tick can timestamp edges with it.
+MP_WEAK uint64_t shared_module_softencoder_timestamp_ns(void) {
+    return common_hal_time_monotonic_ns();
+}
 
 void shared_module_softencoder_state_init(rotaryio_incrementalencoder_obj_t *self, uint8_t quiescent_state) {
     self->state = quiescent_state;
     self->sub_count = 0;
+    self->window_start_ns = shared_module_softencoder_timestamp_ns();
+    self->last_edge_ns = self->window_start_ns;
+    self->velocity_window_ns = 5000000;
+    self->velocity_duration_ns = 0;
+    self->window_edges = 0;
+    self->velocity_edges = 0;
     common_hal_rotaryio_incrementalencoder_set_position(self, 0);
 }
 
@@ -41,6 +56,20 @@ void shared_module_softencoder_state_update(rotaryio_incrementalencoder_obj_t *s
 
     int8_t sub_incr = transitions[idx];
 
+    // Velocity is the edges counted over a window that starts and ends on an
+    // edge, so the timestamp resolution matters less the longer the window is.
+    if (sub_incr != 0) {
+        uint64_t now = shared_module_softencoder_timestamp_ns();
+        self->last_edge_ns = now;
+        self->window_edges += sub_incr;
+        if (now - self->window_start_ns >= self->velocity_window_ns) {
+            self->velocity_edges = self->window_edges;
+            self->velocity_duration_ns = now - self->window_start_ns;
+            self->window_start_ns = now;
+            self->window_edges = 0;
+        }
+    }
+
     self->sub_count += sub_incr;
 
     if (self->sub_count >= self->divisor) {
@@ -67,4 +96,37 @@ mp_int_t common_hal_rotaryio_incrementalencoder_get_divisor(rotaryio_incremental
 void common_hal_rotaryio_incrementalencoder_set_divisor(rotaryio_incrementalencoder_obj_t *self, mp_int_t divisor) {
     self->divisor = divisor;
 }
+
+mp_float_t common_hal_rotaryio_incrementalencoder_get_velocity(rotaryio_incrementalencoder_obj_t *self) {
+    common_hal_mcu_disable_interrupts();
+    int32_t edges = self->velocity_edges;
+    uint32_t duration_ns = self->velocity_duration_ns;
+    uint64_t last_edge_ns = self->last_edge_ns;
+    common_hal_mcu_enable_interrupts();
+
+    if (edges == 0 || duration_ns == 0) {
+        return MICROPY_FLOAT_CONST(0.0);
+    }
+    mp_float_t edges_per_s = (mp_float_t)edges * MICROPY_FLOAT_CONST(1e9) / duration_ns;
+    // When the edges stop, the speed can be no more than one edge in the
+    // time since the last one, so the estimate falls towards zero.
+    uint64_t since_edge_ns = shared_module_softencoder_timestamp_ns() - last_edge_ns;
+    if (since_edge_ns > duration_ns / (uint32_t)abs(edges)) {
+        mp_float_t limit = MICROPY_FLOAT_CONST(1e9) / since_edge_ns;
+        if (edges_per_s > limit) {
+            edges_per_s = limit;
+        } else if (edges_per_s < -limit) {
+            edges_per_s = -limit;
+        }
+    }
+    return edges_per_s / self->divisor;
+}
+
+mp_float_t common_hal_rotaryio_incrementalencoder_get_velocity_window(rotaryio_incrementalencoder_obj_t *self) {
+    return self->velocity_window_ns / MICROPY_FLOAT_CONST(1e9);
+}
+
+void common_hal_rotaryio_incrementalencoder_set_velocity_window(rotaryio_incrementalencoder_obj_t *self, mp_float_t window) {
+    self->velocity_window_ns = (uint32_t)(window * MICROPY_FLOAT_CONST(1e9));
+}
 #endif
@@ -8,6 +8,7 @@
 
 #include "common-hal/rotaryio/IncrementalEncoder.h"
 
+uint64_t shared_module_softencoder_timestamp_ns(void);
 void shared_module_softencoder_state_init(rotaryio_incrementalencoder_obj_t *self, uint8_t quiescent_state);
 void shared_module_softencoder_state_update(rotaryio_incrementalencoder_obj_t *self, uint8_t new_state);
 mp_int_t common_hal_rotaryio_incrementalencoder_get_position(rotaryio_incrementalencoder_obj_t *self);
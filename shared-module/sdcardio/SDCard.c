@@ -119,6 +119,8 @@ static int exit_cmd25(sdcardio_sdcard_obj_t *self) {
     if (self->in_cmd25) {
         DEBUG_PRINT("exit cmd25\n");
         self->in_cmd25 = false;
+        // The last block written may still be programming.
+        wait_for_ready(self);
         return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
     }
     return 0;
@@ -329,17 +331,31 @@ int common_hal_sdcardio_sdcard_get_blockcount(sdcardio_sdcard_obj_t *self) {
     return self->sectors;
 }
 
-static int readinto(sdcardio_sdcard_obj_t *self, void *buf, size_t size) {
-    uint8_t aux[2] = {0, 0};
-    while (aux[0] != 0xfe) {
-        common_hal_busio_spi_read(self->bus, aux, 1, 0xff);
+static void wait_for_data_token(sdcardio_sdcard_obj_t *self) {
+    uint8_t token = 0;
+    while (token != TOKEN_DATA) {
+        common_hal_busio_spi_read(self->bus, &token, 1, 0xff);
     }
+}
 
-    common_hal_busio_spi_read(self->bus, buf, size, 0xff);
+// Read the data blocks of a CMD18 transfer. The CRC of each block is read in
+// the same transfer as the byte after it, which is often already the start
+// token of the next block. Then that block needs no polling, and each block
+// takes two SPI transfers instead of at least three.
+static void read_multiple(sdcardio_sdcard_obj_t *self, uint8_t *buf, uint32_t nblocks) {
+    uint8_t aux[3];
+    bool have_token = false;
+    while (nblocks--) {
+        if (!have_token) {
+            wait_for_data_token(self);
+        }
+        common_hal_busio_spi_read(self->bus, buf, 512, 0xff);
+        buf += 512;
 
-    // Read checksum and throw it away
-    common_hal_busio_spi_read(self->bus, aux, sizeof(aux), 0xff);
-    return 0;
+        // Read checksum and throw it away
+        common_hal_busio_spi_read(self->bus, aux, nblocks > 0 ? 3 : 2, 0xff);
+        have_token = nblocks > 0 && aux[2] == TOKEN_DATA;
+    }
 }
 
 mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
@@ -356,13 +372,8 @@ mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t st
     } else {
         //  Use CMD18 to read multiple blocks
         r = block_cmd(self, 18, start_block, NULL, 0, true, true);
-        uint8_t *ptr = buf;
-        while (nblocks-- && r >= 0) {
-            r = readinto(self, ptr, 512);
-            if (r != 0) {
-                break;
-            }
-            ptr += 512;
+        if (r >= 0) {
+            read_multiple(self, buf, nblocks);
         }
 
         // End the multi-block read
@@ -426,12 +437,9 @@ static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
-
-    // Success
+    // Don't wait for the card to finish programming the block. The next
+    // block, command or sync waits for it, so the caller can get the next
+    // data ready in the meantime.
     return 0;
 }
 
@@ -444,6 +452,18 @@ mp_uint_t sdcardio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t s
 
     if (!self->in_cmd25 || start_block != self->next_block) {
         DEBUG_PRINT("entering CMD25 at %d\n", (int)start_block);
+        if (nblocks > 1) {
+            //  ACMD23: let the card pre-erase the blocks about to be written.
+            //  This is only a hint, so more blocks may still follow.
+            int r = cmd(self, 55, 0, NULL, 0, true, true);
+            if (r >= 0) {
+                r = cmd(self, 23, nblocks, NULL, 0, true, true);
+            }
+            if (r < 0) {
+                extraclock_and_unlock_bus(self);
+                return r;
+            }
+        }
         //  Use CMD25 to write multiple block
         int r = block_cmd(self, 25, start_block, NULL, 0, true, true);
         if (r < 0) {
@@ -475,6 +495,10 @@ int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
     // deinit check is in lock_and_configure_bus()
     lock_and_configure_bus(self);
     int r = exit_cmd25(self);
+    if (r >= 0) {
+        // Don't return until the data has been programmed.
+        r = wait_for_ready(self);
+    }
     extraclock_and_unlock_bus(self);
     return r;
 }
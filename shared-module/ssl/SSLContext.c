@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/ssl/SSLContext.h"
 #include "shared-bindings/ssl/SSLSocket.h"
 
@@ -12,12 +14,73 @@
 
 #include "lib/mbedtls_config/crt_bundle.h"
 
+// A kept state was configured from the old settings, so changing them drops it.
+static void drop_spare_state(ssl_sslcontext_obj_t *self) {
+    if (self->spare_state != NULL) {
+        ssl_sslsocket_state_free(self->spare_state);
+        self->spare_state = NULL;
+    }
+}
+
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
+    self->spare_state = NULL;
+    self->reuse_connection_state = false;
     common_hal_ssl_sslcontext_set_default_verify_paths(self);
+    for (size_t i = 0; i < SSL_SESSION_CACHE_SIZE; i++) {
+        self->session_cache[i].hostname[0] = '\0';
+        mbedtls_ssl_session_init(&self->session_cache[i].session);
+    }
+    self->session_cache_next = 0;
+}
+
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self) {
+    for (size_t i = 0; i < SSL_SESSION_CACHE_SIZE; i++) {
+        self->session_cache[i].hostname[0] = '\0';
+        mbedtls_ssl_session_free(&self->session_cache[i].session);
+    }
+    drop_spare_state(self);
+}
+
+static ssl_session_cache_entry_t *find_session(ssl_sslcontext_obj_t *self, const char *hostname) {
+    for (size_t i = 0; i < SSL_SESSION_CACHE_SIZE; i++) {
+        if (strcmp(self->session_cache[i].hostname, hostname) == 0) {
+            return &self->session_cache[i];
+        }
+    }
+    return NULL;
+}
+
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname) {
+    if (hostname == NULL || hostname[0] == '\0') {
+        return;
+    }
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    if (entry != NULL) {
+        // If the server no longer knows the session, it does a full handshake.
+        mbedtls_ssl_set_session(ssl, &entry->session);
+    }
+}
+
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, const mbedtls_ssl_context *ssl, const char *hostname) {
+    if (hostname == NULL || hostname[0] == '\0' || strlen(hostname) >= sizeof(self->session_cache[0].hostname)) {
+        return;
+    }
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    if (entry == NULL) {
+        entry = &self->session_cache[self->session_cache_next];
+        self->session_cache_next = (self->session_cache_next + 1) % SSL_SESSION_CACHE_SIZE;
+    }
+    entry->hostname[0] = '\0';
+    mbedtls_ssl_session_free(&entry->session);
+    mbedtls_ssl_session_init(&entry->session);
+    if (mbedtls_ssl_get_session(ssl, &entry->session) == 0) {
+        strcpy(entry->hostname, hostname);
+    }
 }
 
 void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
     const char *cadata) {
+    drop_spare_state(self);
     self->crt_bundle_attach = NULL;
     self->use_global_ca_store = false;
     self->cacert_buf = (const unsigned char *)cadata;
@@ -25,6 +88,7 @@ void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
 }
 
 void common_hal_ssl_sslcontext_set_default_verify_paths(ssl_sslcontext_obj_t *self) {
+    drop_spare_state(self);
     self->crt_bundle_attach = crt_bundle_attach;
     self->use_global_ca_store = true;
     self->cacert_buf = NULL;
@@ -39,7 +103,19 @@ void common_hal_ssl_sslcontext_set_check_hostname(ssl_sslcontext_obj_t *self, bo
     self->check_name = value;
 }
 
+bool common_hal_ssl_sslcontext_get_reuse_connection_state(ssl_sslcontext_obj_t *self) {
+    return self->reuse_connection_state;
+}
+
+void common_hal_ssl_sslcontext_set_reuse_connection_state(ssl_sslcontext_obj_t *self, bool value) {
+    self->reuse_connection_state = value;
+    if (!value) {
+        drop_spare_state(self);
+    }
+}
+
 void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_buffer_info_t *cert_buf, mp_buffer_info_t *key_buf) {
+    drop_spare_state(self);
     self->cert_buf = *cert_buf;
     self->key_buf = *key_buf;
 }
@@ -10,6 +10,17 @@
 #include "py/obj.h"
 #include "mbedtls/ssl.h"
 
+// Client sessions from recent handshakes, so that reconnecting to the same
+// server can resume instead of repeating the whole handshake.
+#define SSL_SESSION_CACHE_SIZE (2)
+
+typedef struct {
+    char hostname[64];
+    mbedtls_ssl_session session;
+} ssl_session_cache_entry_t;
+
+struct ssl_sslsocket_state;
+
 typedef struct {
     mp_obj_base_t base;
     bool check_name, use_global_ca_store;
@@ -17,4 +28,13 @@ typedef struct {
     size_t cacert_bytes;
     int (*crt_bundle_attach)(mbedtls_ssl_config *conf);
     mp_buffer_info_t cert_buf, key_buf;
+    ssl_session_cache_entry_t session_cache[SSL_SESSION_CACHE_SIZE];
+    uint8_t session_cache_next;
+    // A closed connection's mbedtls state, kept for the next wrap_socket()
+    // when reuse_connection_state is set.
+    struct ssl_sslsocket_state *spare_state;
+    bool reuse_connection_state;
 } ssl_sslcontext_obj_t;
+
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname);
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, const mbedtls_ssl_context *ssl, const char *hostname);
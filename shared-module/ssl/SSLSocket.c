@@ -12,10 +12,12 @@
 #include "shared/runtime/interrupt_char.h"
 #include "shared/netutils/netutils.h"
 #include "py/mperrno.h"
+#include "py/gc.h"
 #include "py/mphal.h"
 #include "py/objstr.h"
 #include "py/runtime.h"
 #include "py/stream.h"
+#include "supervisor/shared/progress.h"
 #include "supervisor/shared/tick.h"
 
 #include "shared-bindings/socketpool/enum.h"
@@ -210,131 +212,186 @@ static int urandom_adapter(void *unused, unsigned char *buf, size_t n) {
 }
 #endif
 
-ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t *self,
-    mp_obj_t socket, bool server_side, const char *server_hostname) {
+void ssl_sslsocket_state_free(ssl_sslsocket_state_t *state) {
+    mbedtls_pk_free(&state->pkey);
+    mbedtls_x509_crt_free(&state->cert);
+    mbedtls_x509_crt_free(&state->cacert);
+    mbedtls_ssl_free(&state->ssl);
+    mbedtls_ssl_config_free(&state->conf);
+    mbedtls_ctr_drbg_free(&state->ctr_drbg);
+    mbedtls_entropy_free(&state->entropy);
+}
 
-    mp_int_t socket_type = mp_obj_get_int(mp_load_attr(socket, MP_QSTR_type));
-    if (socket_type != SOCKETPOOL_SOCK_STREAM) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("Invalid socket for TLS"));
+static NORETURN void raise_setup_error(int ret) {
+    if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED) {
+        mp_raise_type(&mp_type_MemoryError);
+    } else if (ret == MBEDTLS_ERR_PK_BAD_INPUT_DATA) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid key"));
+    } else if (ret == MBEDTLS_ERR_X509_BAD_INPUT_DATA) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid cert"));
+    } else {
+        mbedtls_raise_error(ret);
     }
+}
 
-    ssl_sslsocket_obj_t *o = mp_obj_malloc_with_finaliser(ssl_sslsocket_obj_t, &ssl_sslsocket_type);
-    o->ssl_context = self;
-    o->sock_obj = socket;
-    o->poll_mask = 0;
-
-    mp_load_method(socket, MP_QSTR_accept, o->accept_args);
-    mp_load_method(socket, MP_QSTR_bind, o->bind_args);
-    mp_load_method(socket, MP_QSTR_close, o->close_args);
-    mp_load_method(socket, MP_QSTR_connect, o->connect_args);
-    mp_load_method(socket, MP_QSTR_listen, o->listen_args);
-    mp_load_method(socket, MP_QSTR_recv_into, o->recv_into_args);
-    mp_load_method(socket, MP_QSTR_send, o->send_args);
-    mp_load_method(socket, MP_QSTR_settimeout, o->settimeout_args);
-    mp_load_method(socket, MP_QSTR_setsockopt, o->setsockopt_args);
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+// The largest fragment length code whose records fit the receive buffer.
+static unsigned char max_frag_len_code(void) {
+    if (MBEDTLS_SSL_IN_CONTENT_LEN >= 16384) {
+        return MBEDTLS_SSL_MAX_FRAG_LEN_NONE;
+    } else if (MBEDTLS_SSL_IN_CONTENT_LEN >= 4096) {
+        return MBEDTLS_SSL_MAX_FRAG_LEN_4096;
+    } else if (MBEDTLS_SSL_IN_CONTENT_LEN >= 2048) {
+        return MBEDTLS_SSL_MAX_FRAG_LEN_2048;
+    } else if (MBEDTLS_SSL_IN_CONTENT_LEN >= 1024) {
+        return MBEDTLS_SSL_MAX_FRAG_LEN_1024;
+    }
+    return MBEDTLS_SSL_MAX_FRAG_LEN_512;
+}
+#endif
 
-    mbedtls_ssl_init(&o->ssl);
-    mbedtls_ssl_config_init(&o->conf);
-    mbedtls_x509_crt_init(&o->cacert);
-    mbedtls_x509_crt_init(&o->cert);
-    mbedtls_pk_init(&o->pkey);
-    mbedtls_ctr_drbg_init(&o->ctr_drbg);
+// Set up a new connection state, with buffers, from the context's settings.
+static int state_setup(ssl_sslcontext_obj_t *self, ssl_sslsocket_state_t *st, bool server_side) {
+    st->server_side = server_side;
+    mbedtls_ssl_init(&st->ssl);
+    mbedtls_ssl_config_init(&st->conf);
+    mbedtls_x509_crt_init(&st->cacert);
+    mbedtls_x509_crt_init(&st->cert);
+    mbedtls_pk_init(&st->pkey);
+    mbedtls_ctr_drbg_init(&st->ctr_drbg);
     #ifdef MBEDTLS_DEBUG_C
     // Debug level (0-4) 1=warning, 2=info, 3=debug, 4=verbose
     mbedtls_debug_set_threshold(4);
     #endif
 
-    mbedtls_entropy_init(&o->entropy);
+    mbedtls_entropy_init(&st->entropy);
     const byte seed[] = "upy";
-    int ret = mbedtls_ctr_drbg_seed(&o->ctr_drbg, mbedtls_entropy_func, &o->entropy, seed, sizeof(seed));
+    int ret = mbedtls_ctr_drbg_seed(&st->ctr_drbg, mbedtls_entropy_func, &st->entropy, seed, sizeof(seed));
     if (ret != 0) {
-        goto cleanup;
+        return ret;
     }
 
-    ret = mbedtls_ssl_config_defaults(&o->conf,
+    ret = mbedtls_ssl_config_defaults(&st->conf,
         server_side ? MBEDTLS_SSL_IS_SERVER : MBEDTLS_SSL_IS_CLIENT,
         MBEDTLS_SSL_TRANSPORT_STREAM,
         MBEDTLS_SSL_PRESET_DEFAULT);
     if (ret != 0) {
-        goto cleanup;
+        return ret;
     }
 
     if (self->crt_bundle_attach != NULL) {
-        mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
-        self->crt_bundle_attach(&o->conf);
+        mbedtls_ssl_conf_authmode(&st->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        self->crt_bundle_attach(&st->conf);
     } else if (self->cacert_buf && self->cacert_bytes) {
-        ret = mbedtls_x509_crt_parse(&o->cacert, self->cacert_buf, self->cacert_bytes);
+        ret = mbedtls_x509_crt_parse(&st->cacert, self->cacert_buf, self->cacert_bytes);
         if (ret != 0) {
-            goto cleanup;
+            return ret;
         }
-        mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
-        mbedtls_ssl_conf_ca_chain(&o->conf, &o->cacert, NULL);
+        mbedtls_ssl_conf_authmode(&st->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        mbedtls_ssl_conf_ca_chain(&st->conf, &st->cacert, NULL);
 
     } else {
-        mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_NONE);
+        mbedtls_ssl_conf_authmode(&st->conf, MBEDTLS_SSL_VERIFY_NONE);
     }
-    mbedtls_ssl_conf_rng(&o->conf, mbedtls_ctr_drbg_random, &o->ctr_drbg);
+    mbedtls_ssl_conf_rng(&st->conf, mbedtls_ctr_drbg_random, &st->ctr_drbg);
     #ifdef MBEDTLS_DEBUG_C
-    mbedtls_ssl_conf_dbg(&o->conf, mbedtls_debug, NULL);
+    mbedtls_ssl_conf_dbg(&st->conf, mbedtls_debug, NULL);
     #endif
-
-    ret = mbedtls_ssl_setup(&o->ssl, &o->conf);
-    if (ret != 0) {
-        goto cleanup;
-    }
-
-    if (server_hostname != NULL) {
-        ret = mbedtls_ssl_set_hostname(&o->ssl, server_hostname);
+    #if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    if (!server_side) {
+        // Ask the server not to send records larger than the receive buffer.
+        ret = mbedtls_ssl_conf_max_frag_len(&st->conf, max_frag_len_code());
         if (ret != 0) {
-            goto cleanup;
+            return ret;
         }
     }
-
-    mbedtls_ssl_set_bio(&o->ssl, o, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
+    #endif
 
     if (self->cert_buf.buf != NULL) {
         #if MBEDTLS_VERSION_MAJOR >= 3
-        ret = mbedtls_pk_parse_key(&o->pkey, self->key_buf.buf, self->key_buf.len + 1, NULL, 0, urandom_adapter, NULL);
+        ret = mbedtls_pk_parse_key(&st->pkey, self->key_buf.buf, self->key_buf.len + 1, NULL, 0, urandom_adapter, NULL);
         #else
-        ret = mbedtls_pk_parse_key(&o->pkey, self->key_buf.buf, self->key_buf.len + 1, NULL, 0);
+        ret = mbedtls_pk_parse_key(&st->pkey, self->key_buf.buf, self->key_buf.len + 1, NULL, 0);
         #endif
         if (ret != 0) {
-            goto cleanup;
+            return ret;
         }
-        ret = mbedtls_x509_crt_parse(&o->cert, self->cert_buf.buf, self->cert_buf.len + 1);
+        ret = mbedtls_x509_crt_parse(&st->cert, self->cert_buf.buf, self->cert_buf.len + 1);
         if (ret != 0) {
-            goto cleanup;
+            return ret;
         }
 
-        ret = mbedtls_ssl_conf_own_cert(&o->conf, &o->cert, &o->pkey);
+        ret = mbedtls_ssl_conf_own_cert(&st->conf, &st->cert, &st->pkey);
         if (ret != 0) {
-            goto cleanup;
+            return ret;
         }
     }
-    return o;
-cleanup:
-    mbedtls_pk_free(&o->pkey);
-    mbedtls_x509_crt_free(&o->cert);
-    mbedtls_x509_crt_free(&o->cacert);
-    mbedtls_ssl_free(&o->ssl);
-    mbedtls_ssl_config_free(&o->conf);
-    mbedtls_ctr_drbg_free(&o->ctr_drbg);
-    mbedtls_entropy_free(&o->entropy);
 
-    if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED) {
-        mp_raise_type(&mp_type_MemoryError);
-    } else if (ret == MBEDTLS_ERR_PK_BAD_INPUT_DATA) {
-        mp_raise_ValueError(MP_ERROR_TEXT("invalid key"));
-    } else if (ret == MBEDTLS_ERR_X509_BAD_INPUT_DATA) {
-        mp_raise_ValueError(MP_ERROR_TEXT("invalid cert"));
+    return mbedtls_ssl_setup(&st->ssl, &st->conf);
+}
+
+ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t *self,
+    mp_obj_t socket, bool server_side, const char *server_hostname) {
+
+    mp_int_t socket_type = mp_obj_get_int(mp_load_attr(socket, MP_QSTR_type));
+    if (socket_type != SOCKETPOOL_SOCK_STREAM) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Invalid socket for TLS"));
+    }
+
+    ssl_sslsocket_obj_t *o = mp_obj_malloc_with_finaliser(ssl_sslsocket_obj_t, &ssl_sslsocket_type);
+    o->ssl_context = self;
+    o->sock_obj = socket;
+    o->poll_mask = 0;
+
+    mp_load_method(socket, MP_QSTR_accept, o->accept_args);
+    mp_load_method(socket, MP_QSTR_bind, o->bind_args);
+    mp_load_method(socket, MP_QSTR_close, o->close_args);
+    mp_load_method(socket, MP_QSTR_connect, o->connect_args);
+    mp_load_method(socket, MP_QSTR_listen, o->listen_args);
+    mp_load_method(socket, MP_QSTR_recv_into, o->recv_into_args);
+    mp_load_method(socket, MP_QSTR_send, o->send_args);
+    mp_load_method(socket, MP_QSTR_settimeout, o->settimeout_args);
+    mp_load_method(socket, MP_QSTR_setsockopt, o->setsockopt_args);
+
+    int ret;
+    ssl_sslsocket_state_t *st = self->spare_state;
+    if (st != NULL && st->server_side == server_side) {
+        // Reuse the state, and its buffers, from an earlier connection.
+        self->spare_state = NULL;
+        o->state = st;
+        ret = mbedtls_ssl_session_reset(&st->ssl);
     } else {
-        mbedtls_raise_error(ret);
+        st = m_new_obj(ssl_sslsocket_state_t);
+        o->state = st;
+        ret = state_setup(self, st, server_side);
+    }
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    if (server_hostname != NULL) {
+        ret = mbedtls_ssl_set_hostname(&st->ssl, server_hostname);
+        if (ret != 0) {
+            goto cleanup;
+        }
+        ssl_sslcontext_resume_session(self, &st->ssl, server_hostname);
     }
+
+    mbedtls_ssl_set_bio(&st->ssl, o, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
+    return o;
+cleanup:
+    o->closed = true;
+    o->state = NULL;
+    ssl_sslsocket_state_free(st);
+    raise_setup_error(ret);
 }
 
 mp_uint_t common_hal_ssl_sslsocket_recv_into(ssl_sslsocket_obj_t *self, uint8_t *buf, mp_uint_t len) {
+    if (self->closed) {
+        mp_raise_OSError(MP_EBADF);
+    }
     self->poll_mask = 0;
-    int ret = mbedtls_ssl_read(&self->ssl, buf, len);
+    int ret = mbedtls_ssl_read(&self->state->ssl, buf, len);
     DEBUG_PRINT("recv_into mbedtls_ssl_read() -> %d\n", ret);
     if (ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
         DEBUG_PRINT("returning %d\n", 0);
@@ -353,8 +410,11 @@ mp_uint_t common_hal_ssl_sslsocket_recv_into(ssl_sslsocket_obj_t *self, uint8_t
 }
 
 mp_uint_t common_hal_ssl_sslsocket_send(ssl_sslsocket_obj_t *self, const uint8_t *buf, mp_uint_t len) {
+    if (self->closed) {
+        mp_raise_OSError(MP_EBADF);
+    }
     self->poll_mask = 0;
-    int ret = mbedtls_ssl_write(&self->ssl, buf, len);
+    int ret = mbedtls_ssl_write(&self->state->ssl, buf, len);
     DEBUG_PRINT("send mbedtls_ssl_write() -> %d\n", ret);
     if (ret >= 0) {
         DEBUG_PRINT("returning %d\n", ret);
@@ -377,52 +437,62 @@ void common_hal_ssl_sslsocket_close(ssl_sslsocket_obj_t *self) {
     }
     self->closed = true;
     ssl_socket_close(self);
-    mbedtls_pk_free(&self->pkey);
-    mbedtls_x509_crt_free(&self->cert);
-    mbedtls_x509_crt_free(&self->cacert);
-    mbedtls_ssl_free(&self->ssl);
-    mbedtls_ssl_config_free(&self->conf);
-    mbedtls_ctr_drbg_free(&self->ctr_drbg);
-    mbedtls_entropy_free(&self->entropy);
+    ssl_sslsocket_state_t *st = self->state;
+    self->state = NULL;
+    ssl_sslcontext_obj_t *context = self->ssl_context;
+    // Finalisers run with the heap locked, and by then the context may be
+    // finalised too, so only an explicit close hands the state back.
+    if (context->reuse_connection_state && context->spare_state == NULL && !gc_is_locked()) {
+        context->spare_state = st;
+    } else {
+        ssl_sslsocket_state_free(st);
+    }
+}
+
+static const char *ssl_hostname(const mbedtls_ssl_context *ssl) {
+    #if MBEDTLS_VERSION_MAJOR >= 3
+    return ssl->MBEDTLS_PRIVATE(hostname);
+    #else
+    return ssl->hostname;
+    #endif
 }
 
 static void do_handshake(ssl_sslsocket_obj_t *self) {
     int ret;
-    while ((ret = mbedtls_ssl_handshake(&self->ssl)) != 0) {
+    supervisor_long_operation_begin();
+    while ((ret = mbedtls_ssl_handshake(&self->state->ssl)) != 0) {
         if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            supervisor_long_operation_end();
             goto cleanup;
         }
+        // Each return for more data means a handshake message went through.
+        supervisor_progress();
         RUN_BACKGROUND_TASKS;
         if (MP_STATE_THREAD(mp_pending_exception) != MP_OBJ_NULL) {
+            supervisor_long_operation_end();
             mp_handle_pending(true);
+            supervisor_long_operation_begin();
         }
         mp_hal_delay_ms(1);
     }
+    supervisor_long_operation_end();
 
+    if (self->ssl_context != NULL) {
+        ssl_sslcontext_save_session(self->ssl_context, &self->state->ssl, ssl_hostname(&self->state->ssl));
+    }
     return;
 
 cleanup:
     self->closed = true;
-    mbedtls_pk_free(&self->pkey);
-    mbedtls_x509_crt_free(&self->cert);
-    mbedtls_x509_crt_free(&self->cacert);
-    mbedtls_ssl_free(&self->ssl);
-    mbedtls_ssl_config_free(&self->conf);
-    mbedtls_ctr_drbg_free(&self->ctr_drbg);
-    mbedtls_entropy_free(&self->entropy);
-
-    if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED) {
-        mp_raise_type(&mp_type_MemoryError);
-    } else if (ret == MBEDTLS_ERR_PK_BAD_INPUT_DATA) {
-        mp_raise_ValueError(MP_ERROR_TEXT("invalid key"));
-    } else if (ret == MBEDTLS_ERR_X509_BAD_INPUT_DATA) {
-        mp_raise_ValueError(MP_ERROR_TEXT("invalid cert"));
-    } else {
-        mbedtls_raise_error(ret);
-    }
+    ssl_sslsocket_state_free(self->state);
+    self->state = NULL;
+    raise_setup_error(ret);
 }
 
 void common_hal_ssl_sslsocket_connect(ssl_sslsocket_obj_t *self, mp_obj_t addr_in) {
+    if (self->closed) {
+        mp_raise_OSError(MP_EBADF);
+    }
     ssl_socket_connect(self, addr_in);
     do_handshake(self);
 }
@@ -462,8 +532,11 @@ void common_hal_ssl_sslsocket_settimeout(ssl_sslsocket_obj_t *self, mp_obj_t tim
 static bool poll_common(ssl_sslsocket_obj_t *self, uintptr_t arg) {
     // Take into account that the library might have buffered data already
     int has_pending = 0;
+    if (self->closed) {
+        return false;
+    }
     if (arg & MP_STREAM_POLL_RD) {
-        has_pending = mbedtls_ssl_check_pending(&self->ssl);
+        has_pending = mbedtls_ssl_check_pending(&self->state->ssl);
         if (has_pending) {
             // Shortcut if we only need to read and we have buffered data, no need to go to the underlying socket
             return true;
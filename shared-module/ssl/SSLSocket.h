@@ -18,10 +18,9 @@
 #include "mbedtls/entropy.h"
 #include "mbedtls/ctr_drbg.h"
 
-typedef struct ssl_sslsocket_obj {
-    mp_obj_base_t base;
-    mp_obj_t sock_obj;
-    ssl_sslcontext_obj_t *ssl_context;
+// The mbedtls state of one connection. It is allocated apart from the socket
+// so that its SSLContext can keep it, record buffers and all, for the next one.
+typedef struct ssl_sslsocket_state {
     mbedtls_entropy_context entropy;
     mbedtls_ctr_drbg_context ctr_drbg;
     mbedtls_ssl_context ssl;
@@ -29,6 +28,15 @@ typedef struct ssl_sslsocket_obj {
     mbedtls_x509_crt cacert;
     mbedtls_x509_crt cert;
     mbedtls_pk_context pkey;
+    bool server_side;
+} ssl_sslsocket_state_t;
+
+typedef struct ssl_sslsocket_obj {
+    mp_obj_base_t base;
+    mp_obj_t sock_obj;
+    ssl_sslcontext_obj_t *ssl_context;
+    // NULL once closed.
+    ssl_sslsocket_state_t *state;
     uintptr_t poll_mask;
     bool closed;
     mp_obj_t accept_args[2];
@@ -41,3 +49,5 @@ typedef struct ssl_sslsocket_obj {
     mp_obj_t setsockopt_args[5];
     mp_obj_t settimeout_args[3];
 } ssl_sslsocket_obj_t;
+
+void ssl_sslsocket_state_free(ssl_sslsocket_state_t *state);
@@ -0,0 +1,436 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/KeyValueStore.h"
+#include "shared-bindings/storage/Partition.h"
+
+// Bank header: magic, a sequence number that goes up with each compaction, and
+// a CRC-16 of both. The valid bank with the highest sequence number is the
+// active one. The header is written after the records, so a bank whose
+// compaction was cut short is never used.
+#define KVS_MAGIC (0x3253564b) // "KVS2"
+#define KVS_BANK_HEADER_SIZE (12)
+
+// Record: key length, flags, value length (little endian), key, value, CRC-16.
+// An erased key length byte marks the end of the log.
+#define KVS_RECORD_HEADER_SIZE (4)
+#define KVS_RECORD_OVERHEAD (KVS_RECORD_HEADER_SIZE + 2)
+#define KVS_FLAG_DELETE (0x01)
+// More records of the same update() follow. None of them take effect until the
+// record without this flag has been read back intact.
+#define KVS_FLAG_MORE (0x02)
+
+typedef struct {
+    mp_obj_t key;
+    const char *key_data;
+    size_t key_len;
+    bool remove;
+    mp_buffer_info_t value;
+} kvs_change_t;
+
+static uint16_t kvs_crc16(uint16_t crc, const uint8_t *data, size_t len) {
+    // CRC-16/CCITT
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint32_t kvs_get_u32(const uint8_t *buf) {
+    return buf[0] | buf[1] << 8 | buf[2] << 16 | (uint32_t)buf[3] << 24;
+}
+
+static void kvs_put_u32(uint8_t *buf, uint32_t value) {
+    buf[0] = value;
+    buf[1] = value >> 8;
+    buf[2] = value >> 16;
+    buf[3] = value >> 24;
+}
+
+static uint32_t kvs_record_size(size_t key_len, size_t value_len) {
+    return KVS_RECORD_OVERHEAD + key_len + value_len;
+}
+
+static uint32_t kvs_bank_address(storage_keyvaluestore_obj_t *self, uint16_t bank) {
+    return self->start + bank * self->bank_size;
+}
+
+static mp_map_t *kvs_map(storage_keyvaluestore_obj_t *self) {
+    return mp_obj_dict_get_map(self->index);
+}
+
+static void kvs_read(storage_keyvaluestore_obj_t *self, uint32_t address, uint8_t *buf, uint32_t len) {
+    if (!common_hal_storage_partition_read(self->partition, address, buf, len)) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
+// Program bytes that are already erased.
+static void kvs_write(storage_keyvaluestore_obj_t *self, uint32_t address, const uint8_t *buf, uint32_t len) {
+    if (!common_hal_storage_partition_write(self->partition, address, buf, len, false)) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
+static void kvs_erase(storage_keyvaluestore_obj_t *self, uint16_t bank) {
+    if (!common_hal_storage_partition_erase(self->partition, kvs_bank_address(self, bank))) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
+static void kvs_put_bank_header(uint8_t header[KVS_BANK_HEADER_SIZE], uint32_t seq) {
+    kvs_put_u32(header, KVS_MAGIC);
+    kvs_put_u32(header + 4, seq);
+    uint16_t crc = kvs_crc16(0xffff, header, 8);
+    header[8] = crc;
+    header[9] = crc >> 8;
+    header[10] = 0xff;
+    header[11] = 0xff;
+}
+
+static bool kvs_blank(storage_keyvaluestore_obj_t *self, uint32_t address, uint32_t len) {
+    uint8_t buf[32];
+    while (len > 0) {
+        uint32_t n = MIN(len, sizeof(buf));
+        kvs_read(self, address, buf, n);
+        for (uint32_t i = 0; i < n; i++) {
+            if (buf[i] != 0xff) {
+                return false;
+            }
+        }
+        address += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Size of the record at offset in the active bank.
+static uint32_t kvs_size_at(storage_keyvaluestore_obj_t *self, uint32_t offset) {
+    uint8_t header[KVS_RECORD_HEADER_SIZE];
+    kvs_read(self, kvs_bank_address(self, self->bank) + offset, header, sizeof(header));
+    return kvs_record_size(header[0], header[2] | header[3] << 8);
+}
+
+static bool kvs_record_valid(storage_keyvaluestore_obj_t *self, uint32_t address, uint32_t size) {
+    uint8_t buf[32];
+    uint16_t crc = 0xffff;
+    uint32_t end = address + size - 2;
+    while (address < end) {
+        uint32_t n = MIN(end - address, sizeof(buf));
+        kvs_read(self, address, buf, n);
+        crc = kvs_crc16(crc, buf, n);
+        address += n;
+    }
+    kvs_read(self, end, buf, 2);
+    return crc == (buf[0] | buf[1] << 8);
+}
+
+// Fill in the CRC of the record in buf.
+static void kvs_seal_record(uint8_t *buf, uint32_t size) {
+    uint16_t crc = kvs_crc16(0xffff, buf, size - 2);
+    buf[size - 2] = crc;
+    buf[size - 1] = crc >> 8;
+}
+
+static uint32_t kvs_put_record(uint8_t *buf, const kvs_change_t *change, uint8_t flags) {
+    size_t value_len = change->value.len;
+    if (change->remove) {
+        flags |= KVS_FLAG_DELETE;
+    }
+    buf[0] = change->key_len;
+    buf[1] = flags;
+    buf[2] = value_len;
+    buf[3] = value_len >> 8;
+    memcpy(buf + KVS_RECORD_HEADER_SIZE, change->key_data, change->key_len);
+    if (value_len > 0) {
+        memcpy(buf + KVS_RECORD_HEADER_SIZE + change->key_len, change->value.buf, value_len);
+    }
+    uint32_t size = kvs_record_size(change->key_len, value_len);
+    kvs_seal_record(buf, size);
+    return size;
+}
+
+// Point key at the record at offset in the active bank, or drop it if offset is 0.
+static void kvs_index_update(storage_keyvaluestore_obj_t *self, mp_obj_t key, uint32_t offset, uint32_t size) {
+    mp_map_t *map = kvs_map(self);
+    mp_map_elem_t *elem = mp_map_lookup(map, key, MP_MAP_LOOKUP);
+    if (elem != NULL) {
+        self->live_bytes -= kvs_size_at(self, MP_OBJ_SMALL_INT_VALUE(elem->value));
+    }
+    if (offset == 0) {
+        mp_map_lookup(map, key, MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+        return;
+    }
+    mp_map_lookup(map, key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = MP_OBJ_NEW_SMALL_INT(offset);
+    self->live_bytes += size;
+}
+
+static void kvs_apply(storage_keyvaluestore_obj_t *self, uint32_t offset) {
+    uint8_t header[KVS_RECORD_HEADER_SIZE];
+    uint8_t key[STORAGE_KEYVALUESTORE_MAX_KEY_LEN];
+    uint32_t address = kvs_bank_address(self, self->bank) + offset;
+    kvs_read(self, address, header, sizeof(header));
+    kvs_read(self, address + KVS_RECORD_HEADER_SIZE, key, header[0]);
+    mp_obj_t key_obj = mp_obj_new_str((const char *)key, header[0]);
+    uint32_t size = kvs_record_size(header[0], header[2] | header[3] << 8);
+    kvs_index_update(self, key_obj, (header[1] & KVS_FLAG_DELETE) ? 0 : offset, size);
+}
+
+// Rebuild the index from the log in the active bank.
+static void kvs_scan(storage_keyvaluestore_obj_t *self) {
+    uint32_t base = kvs_bank_address(self, self->bank);
+    uint32_t offset = KVS_BANK_HEADER_SIZE;
+    uint32_t batch_start = offset;
+    while (offset + KVS_RECORD_OVERHEAD <= self->bank_size) {
+        uint8_t header[KVS_RECORD_HEADER_SIZE];
+        kvs_read(self, base + offset, header, sizeof(header));
+        if (header[0] == 0xff) {
+            break;
+        }
+        uint32_t size = kvs_record_size(header[0], header[2] | header[3] << 8);
+        if (header[0] == 0 || header[0] > STORAGE_KEYVALUESTORE_MAX_KEY_LEN ||
+            offset + size > self->bank_size || !kvs_record_valid(self, base + offset, size)) {
+            // A write was interrupted. Everything before it is intact.
+            self->needs_compact = true;
+            break;
+        }
+        offset += size;
+        if ((header[1] & KVS_FLAG_MORE) == 0) {
+            for (uint32_t o = batch_start; o < offset; o += kvs_size_at(self, o)) {
+                kvs_apply(self, o);
+            }
+            batch_start = offset;
+        }
+    }
+    if (batch_start != offset) {
+        // An update() was cut short. Its records must not be followed by new
+        // ones, which would complete it.
+        self->needs_compact = true;
+    }
+    if (!self->needs_compact && !kvs_blank(self, base + offset, self->bank_size - offset)) {
+        // A write was cut short before its first byte was programmed, so the
+        // space after the log can't be appended to.
+        self->needs_compact = true;
+    }
+    self->write_offset = offset;
+}
+
+// Erase bank and make image its contents. The header is written last, so the
+// bank only becomes valid once all of its records are in place.
+static void kvs_write_bank(storage_keyvaluestore_obj_t *self, uint16_t bank, const uint8_t *image, uint32_t used, uint32_t seq) {
+    uint32_t address = kvs_bank_address(self, bank);
+    kvs_erase(self, bank);
+    if (used > KVS_BANK_HEADER_SIZE) {
+        kvs_write(self, address + KVS_BANK_HEADER_SIZE, image + KVS_BANK_HEADER_SIZE, used - KVS_BANK_HEADER_SIZE);
+    }
+    uint8_t header[KVS_BANK_HEADER_SIZE];
+    kvs_put_bank_header(header, seq);
+    kvs_write(self, address, header, sizeof(header));
+}
+
+static bool kvs_changes_key(const kvs_change_t *changes, size_t n, mp_obj_t key) {
+    for (size_t i = 0; i < n; i++) {
+        if (mp_obj_equal(changes[i].key, key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Write the live records, with changes applied, into the next bank and switch to it.
+static void kvs_compact(storage_keyvaluestore_obj_t *self, const kvs_change_t *changes, size_t n) {
+    mp_map_t *map = kvs_map(self);
+    uint32_t base = kvs_bank_address(self, self->bank);
+    uint8_t *image = m_new(uint8_t, self->bank_size);
+    uint32_t *offsets = m_new(uint32_t, map->alloc + n);
+    uint32_t used = KVS_BANK_HEADER_SIZE;
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (!mp_map_slot_is_filled(map, i) || kvs_changes_key(changes, n, map->table[i].key)) {
+            continue;
+        }
+        uint32_t offset = MP_OBJ_SMALL_INT_VALUE(map->table[i].value);
+        uint32_t size = kvs_size_at(self, offset);
+        kvs_read(self, base + offset, image + used, size);
+        if (image[used + 1] & KVS_FLAG_MORE) {
+            // The new bank is committed as a whole, so the record must not
+            // wait for the rest of the update() it was written by.
+            image[used + 1] &= ~KVS_FLAG_MORE;
+            kvs_seal_record(image + used, size);
+        }
+        offsets[i] = used;
+        used += size;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (!changes[i].remove) {
+            offsets[map->alloc + i] = used;
+            used += kvs_put_record(image + used, &changes[i], 0);
+        }
+    }
+
+    uint16_t next = (self->bank + 1) % self->bank_count;
+    kvs_write_bank(self, next, image, used, self->seq + 1);
+
+    // The new bank is in place, so move the index over to it.
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (mp_map_slot_is_filled(map, i) && !kvs_changes_key(changes, n, map->table[i].key)) {
+            map->table[i].value = MP_OBJ_NEW_SMALL_INT(offsets[i]);
+        }
+    }
+    size_t alloc = map->alloc;
+    for (size_t i = 0; i < n; i++) {
+        if (changes[i].remove) {
+            mp_map_lookup(map, changes[i].key, MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+        } else {
+            mp_map_lookup(map, changes[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value =
+                MP_OBJ_NEW_SMALL_INT(offsets[alloc + i]);
+        }
+    }
+    self->bank = next;
+    self->seq++;
+    self->write_offset = used;
+    self->live_bytes = used - KVS_BANK_HEADER_SIZE;
+    self->needs_compact = false;
+
+    m_del(uint32_t, offsets, alloc + n);
+    m_del(uint8_t, image, self->bank_size);
+}
+
+void common_hal_storage_keyvaluestore_construct(storage_keyvaluestore_obj_t *self, storage_partition_obj_t *partition, uint32_t start_block, uint32_t block_count) {
+    self->partition = partition;
+    self->bank_size = common_hal_storage_partition_get_block_size(partition);
+    self->start = start_block * self->bank_size;
+    self->bank_count = block_count;
+    self->index = mp_obj_new_dict(0);
+    self->live_bytes = 0;
+    self->needs_compact = false;
+
+    bool found = false;
+    for (uint16_t bank = 0; bank < self->bank_count; bank++) {
+        uint8_t header[KVS_BANK_HEADER_SIZE];
+        uint8_t expected[KVS_BANK_HEADER_SIZE];
+        kvs_read(self, kvs_bank_address(self, bank), header, sizeof(header));
+        uint32_t seq = kvs_get_u32(header + 4);
+        kvs_put_bank_header(expected, seq);
+        if (memcmp(header, expected, sizeof(header)) == 0 && (!found || (int32_t)(seq - self->seq) > 0)) {
+            found = true;
+            self->bank = bank;
+            self->seq = seq;
+        }
+    }
+
+    if (!found) {
+        // Not a store yet, so start an empty one in the first bank.
+        kvs_write_bank(self, 0, NULL, KVS_BANK_HEADER_SIZE, 1);
+        self->bank = 0;
+        self->seq = 1;
+        self->write_offset = KVS_BANK_HEADER_SIZE;
+        return;
+    }
+    kvs_scan(self);
+}
+
+mp_obj_t common_hal_storage_keyvaluestore_get(storage_keyvaluestore_obj_t *self, mp_obj_t key) {
+    mp_map_elem_t *elem = mp_map_lookup(kvs_map(self), key, MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return MP_OBJ_NULL;
+    }
+    uint32_t address = kvs_bank_address(self, self->bank) + MP_OBJ_SMALL_INT_VALUE(elem->value);
+    uint8_t header[KVS_RECORD_HEADER_SIZE];
+    kvs_read(self, address, header, sizeof(header));
+    size_t value_len = header[2] | header[3] << 8;
+    vstr_t vstr;
+    vstr_init_len(&vstr, value_len);
+    kvs_read(self, address + KVS_RECORD_HEADER_SIZE + header[0], (uint8_t *)vstr.buf, value_len);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+
+bool common_hal_storage_keyvaluestore_contains(storage_keyvaluestore_obj_t *self, mp_obj_t key) {
+    return mp_map_lookup(kvs_map(self), key, MP_MAP_LOOKUP) != NULL;
+}
+
+size_t common_hal_storage_keyvaluestore_get_len(storage_keyvaluestore_obj_t *self) {
+    return kvs_map(self)->used;
+}
+
+mp_obj_t common_hal_storage_keyvaluestore_keys(storage_keyvaluestore_obj_t *self) {
+    mp_map_t *map = kvs_map(self);
+    mp_obj_t keys = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (mp_map_slot_is_filled(map, i)) {
+            mp_obj_list_append(keys, map->table[i].key);
+        }
+    }
+    return keys;
+}
+
+uint32_t common_hal_storage_keyvaluestore_get_free(storage_keyvaluestore_obj_t *self) {
+    return self->bank_size - KVS_BANK_HEADER_SIZE - self->live_bytes;
+}
+
+void common_hal_storage_keyvaluestore_update(storage_keyvaluestore_obj_t *self, size_t n, const mp_obj_t *keys, const mp_obj_t *values) {
+    if (n == 0) {
+        return;
+    }
+    kvs_change_t *changes = m_new(kvs_change_t, n);
+    uint32_t append = 0;
+    mp_int_t live_after = self->live_bytes;
+    for (size_t i = 0; i < n; i++) {
+        kvs_change_t *change = &changes[i];
+        change->key = keys[i];
+        change->key_data = mp_obj_str_get_data(keys[i], &change->key_len);
+        mp_arg_validate_length_range(change->key_len, 1, STORAGE_KEYVALUESTORE_MAX_KEY_LEN, MP_QSTR_key);
+        change->remove = values[i] == mp_const_none;
+        if (change->remove) {
+            change->value.buf = NULL;
+            change->value.len = 0;
+        } else {
+            mp_get_buffer_raise(values[i], &change->value, MP_BUFFER_READ);
+            mp_arg_validate_length_max(change->value.len, UINT16_MAX, MP_QSTR_value);
+        }
+        uint32_t size = kvs_record_size(change->key_len, change->value.len);
+        append += size;
+        mp_map_elem_t *elem = mp_map_lookup(kvs_map(self), keys[i], MP_MAP_LOOKUP);
+        if (elem != NULL) {
+            live_after -= kvs_size_at(self, MP_OBJ_SMALL_INT_VALUE(elem->value));
+        }
+        if (!change->remove) {
+            live_after += size;
+        }
+    }
+
+    if (!self->needs_compact && self->write_offset + append <= self->bank_size) {
+        // Append the records with a single write. A partial write leaves the
+        // last record without a valid CRC, so none of them take effect.
+        uint8_t *buf = m_new(uint8_t, append);
+        uint32_t used = 0;
+        for (size_t i = 0; i < n; i++) {
+            used += kvs_put_record(buf + used, &changes[i], i + 1 < n ? KVS_FLAG_MORE : 0);
+        }
+        kvs_write(self, kvs_bank_address(self, self->bank) + self->write_offset, buf, append);
+        m_del(uint8_t, buf, append);
+
+        uint32_t offset = self->write_offset;
+        for (size_t i = 0; i < n; i++) {
+            uint32_t size = kvs_record_size(changes[i].key_len, changes[i].value.len);
+            kvs_index_update(self, changes[i].key, changes[i].remove ? 0 : offset, size);
+            offset += size;
+        }
+        self->write_offset = offset;
+    } else {
+        if (KVS_BANK_HEADER_SIZE + live_after > self->bank_size) {
+            mp_raise_OSError(MP_ENOSPC);
+        }
+        kvs_compact(self, changes, n);
+    }
+    m_del(kvs_change_t, changes, n);
+}
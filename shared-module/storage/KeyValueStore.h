@@ -0,0 +1,36 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/storage/Partition.h"
+
+#define STORAGE_KEYVALUESTORE_MAX_KEY_LEN (64)
+
+// The store uses a ring of erase blocks in a partition. Each block is a bank
+// that holds a log of records, and one of them is active. Records are
+// appended to the active bank without erasing. When it fills, the live records
+// are copied into the next block in the ring, which becomes active once its
+// header is written. So each block is only erased once per trip around the
+// ring, and the old bank is intact until the new one is complete.
+typedef struct {
+    mp_obj_base_t base;
+    storage_partition_obj_t *partition;
+    // Maps each key to the offset of its latest record within the active bank.
+    mp_obj_t index;
+    // Partition address of the first block.
+    uint32_t start;
+    uint32_t bank_size;
+    uint32_t seq;
+    uint32_t write_offset;
+    // Total size of the records the index points at.
+    uint32_t live_bytes;
+    uint16_t bank_count;
+    uint16_t bank;
+    // Set when the log ends in a partial record or an unfinished update.
+    bool needs_compact;
+} storage_keyvaluestore_obj_t;
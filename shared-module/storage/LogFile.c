@@ -0,0 +1,313 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "extmod/vfs.h"
+#include "lib/oofatfs/ff.h"
+#include "lib/oofatfs/diskio.h"
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/LogFile.h"
+#include "supervisor/filesystem.h"
+
+#if CIRCUITPY_STORAGE_LOGFILE
+
+// The file is preallocated once. Its first sector is a header, and the rest
+// hold fixed-size slots that are filled in order and wrap around as a ring.
+// Each slot starts with the record's little-endian sequence number. Appends
+// write whole sectors straight to the block device, so the FAT and the
+// directory entry never change after the file is created.
+
+#define SECTOR_SIZE (STORAGE_LOGFILE_SECTOR_SIZE)
+#define SLOT_HEADER_SIZE (4)
+#define SLOT_SIZE(self) (SLOT_HEADER_SIZE + (self)->record_size)
+
+typedef struct {
+    char magic[8];
+    uint32_t record_size;
+    uint32_t capacity;
+} logfile_header_t;
+
+static const char logfile_magic[8] = "CPYLOG\x01";
+
+static void check_mounted(storage_logfile_obj_t *self) {
+    for (mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table); vfs != NULL; vfs = vfs->next) {
+        if (MP_OBJ_TO_PTR(vfs->obj) == self->vfs) {
+            return;
+        }
+    }
+    mp_raise_OSError(MP_ENODEV);
+}
+
+// Map a sector of the file to a sector of the volume using the cluster map.
+static DWORD file_sector_lba(storage_logfile_obj_t *self, uint32_t file_sector) {
+    FATFS *fs = &self->vfs->fatfs;
+    DWORD cluster = file_sector / fs->csize;
+    DWORD *tbl = self->cltbl + 1;
+    for (DWORD ncl = *tbl++; ncl != 0; ncl = *tbl++) {
+        if (cluster < ncl) {
+            return fs->database + (*tbl + cluster - 2) * fs->csize + file_sector % fs->csize;
+        }
+        cluster -= ncl;
+        tbl++;
+    }
+    mp_raise_OSError(MP_EIO);
+}
+
+static void read_sector(storage_logfile_obj_t *self, uint32_t file_sector, uint8_t *buf) {
+    if (disk_read(self->vfs, buf, file_sector_lba(self, file_sector), 1) != RES_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
+static void write_sector(storage_logfile_obj_t *self, uint32_t file_sector, const uint8_t *buf) {
+    DWORD lba = file_sector_lba(self, file_sector);
+    if (disk_write(self->vfs, buf, lba, 1) != RES_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    // Don't let FatFs serve an old copy of the sector from its window.
+    FATFS *fs = &self->vfs->fatfs;
+    if (fs->winsect == lba) {
+        fs->winsect = (DWORD)-1;
+    }
+}
+
+// Record sector i is file sector i + 1, after the header.
+static void read_record_sector(storage_logfile_obj_t *self, uint32_t sector, uint8_t *buf) {
+    read_sector(self, sector + 1, buf);
+}
+
+static uint32_t slot_sequence(storage_logfile_obj_t *self, const uint8_t *sector, uint32_t slot) {
+    const uint8_t *p = sector + slot * SLOT_SIZE(self);
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void flush_buffer(storage_logfile_obj_t *self) {
+    if (self->buffer_dirty) {
+        write_sector(self, self->buffer_sector + 1, self->buffer);
+        self->buffer_dirty = false;
+    }
+}
+
+static void map_file(storage_logfile_obj_t *self, FIL *fp) {
+    DWORD temp_table[2];
+    temp_table[0] = MP_ARRAY_SIZE(temp_table);
+    fp->cltbl = temp_table;
+    f_lseek(fp, CREATE_LINKMAP);
+    DWORD size = temp_table[0];
+    self->cltbl = m_new(DWORD, size);
+    self->cltbl[0] = size;
+    fp->cltbl = self->cltbl;
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    fp->cltbl = NULL;
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+}
+
+static void create_file(storage_logfile_obj_t *self, const char *path) {
+    if (!filesystem_is_writable_by_python(self->vfs)) {
+        mp_raise_OSError(MP_EROFS);
+    }
+    FATFS *fs = &self->vfs->fatfs;
+    uint32_t record_sectors = self->capacity / self->slots_per_sector;
+    FSIZE_t size = (FSIZE_t)(record_sectors + 1) * SECTOR_SIZE;
+
+    // Seeking past the end of a file opened for writing allocates its clusters.
+    FIL fp;
+    FRESULT res = f_open(fs, &fp, path, FA_WRITE | FA_CREATE_ALWAYS);
+    if (res == FR_OK) {
+        res = f_lseek(&fp, size);
+        if (res == FR_OK && f_tell(&fp) != size) {
+            res = FR_DENIED;
+        }
+        FRESULT close_res = f_close(&fp);
+        if (res == FR_OK) {
+            res = close_res;
+        }
+    }
+    if (res == FR_OK) {
+        res = f_open(fs, &fp, path, FA_READ);
+    }
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+    map_file(self, &fp);
+    f_close(&fp);
+
+    // The clusters may hold old data, so clear every slot before writing the
+    // header. A file without a header is recreated the next time.
+    memset(self->buffer, 0, SECTOR_SIZE);
+    for (uint32_t i = 0; i < record_sectors; i++) {
+        write_sector(self, i + 1, self->buffer);
+    }
+    logfile_header_t *header = (logfile_header_t *)self->buffer;
+    memcpy(header->magic, logfile_magic, sizeof(header->magic));
+    header->record_size = self->record_size;
+    header->capacity = self->capacity;
+    write_sector(self, 0, self->buffer);
+    disk_ioctl(self->vfs, CTRL_SYNC, NULL);
+    memset(self->buffer, 0, SECTOR_SIZE);
+}
+
+// Sector 0 holds the first slots of the current lap, and the sectors after it
+// continue the sequence until the one being filled. Binary search for that
+// sector, then count its filled slots.
+static void find_newest(storage_logfile_obj_t *self) {
+    uint32_t spp = self->slots_per_sector;
+    read_record_sector(self, 0, self->buffer);
+    uint32_t first = slot_sequence(self, self->buffer, 0);
+    self->buffer_sector = 0;
+    self->buffer_dirty = false;
+    if (first == 0) {
+        self->sequence = 0;
+        return;
+    }
+    uint32_t lo = 0;
+    uint32_t hi = self->capacity / spp;
+    while (hi - lo > 1) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        read_record_sector(self, mid, self->buffer);
+        if (slot_sequence(self, self->buffer, 0) == first + mid * spp) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    read_record_sector(self, lo, self->buffer);
+    uint32_t base = first + lo * spp;
+    uint32_t filled = 1;
+    while (filled < spp && slot_sequence(self, self->buffer, filled) == base + filled) {
+        filled++;
+    }
+    self->buffer_sector = lo;
+    self->sequence = base + filled - 1;
+}
+
+void common_hal_storage_logfile_construct(storage_logfile_obj_t *self, const char *path, mp_int_t record_size, mp_int_t record_count) {
+    const char *path_under_mount;
+    mp_vfs_mount_t *mount = mp_vfs_lookup_path(path, &path_under_mount);
+    if (mount == MP_VFS_NONE || mount == MP_VFS_ROOT || !mp_obj_is_type(mount->obj, &mp_fat_vfs_type)) {
+        mp_arg_error_invalid(MP_QSTR_path);
+    }
+    self->vfs = MP_OBJ_TO_PTR(mount->obj);
+    #if FF_MAX_SS != FF_MIN_SS
+    if (self->vfs->fatfs.ssize != SECTOR_SIZE) {
+        mp_arg_error_invalid(MP_QSTR_path);
+    }
+    #endif
+
+    self->record_size = record_size;
+    self->slots_per_sector = SECTOR_SIZE / SLOT_SIZE(self);
+    uint32_t record_sectors = (record_count + self->slots_per_sector - 1) / self->slots_per_sector;
+    self->capacity = record_sectors * self->slots_per_sector;
+
+    // Use the existing file if it has a valid header.
+    FIL fp;
+    bool valid = false;
+    if (f_open(&self->vfs->fatfs, &fp, path_under_mount, FA_READ) == FR_OK) {
+        FSIZE_t size = f_size(&fp);
+        map_file(self, &fp);
+        f_close(&fp);
+        if (size >= (FSIZE_t)(record_sectors + 1) * SECTOR_SIZE) {
+            read_sector(self, 0, self->buffer);
+            logfile_header_t *header = (logfile_header_t *)self->buffer;
+            valid = memcmp(header->magic, logfile_magic, sizeof(header->magic)) == 0;
+            if (valid && (header->record_size != self->record_size || header->capacity != self->capacity)) {
+                self->cltbl = NULL;
+                mp_raise_ValueError_varg(MP_ERROR_TEXT("%q and %q do not match %q"),
+                    MP_QSTR_record_size, MP_QSTR_record_count, MP_QSTR_path);
+            }
+        }
+    }
+    if (!valid) {
+        create_file(self, path_under_mount);
+    }
+    find_newest(self);
+}
+
+bool common_hal_storage_logfile_deinited(storage_logfile_obj_t *self) {
+    return self->cltbl == NULL;
+}
+
+void common_hal_storage_logfile_deinit(storage_logfile_obj_t *self) {
+    if (common_hal_storage_logfile_deinited(self)) {
+        return;
+    }
+    common_hal_storage_logfile_flush(self);
+    m_del(DWORD, self->cltbl, self->cltbl[0]);
+    self->cltbl = NULL;
+}
+
+void common_hal_storage_logfile_append(storage_logfile_obj_t *self, const uint8_t *data, size_t len) {
+    check_mounted(self);
+    uint32_t slot = self->sequence % self->capacity;
+    uint32_t sector = slot / self->slots_per_sector;
+    uint32_t index = slot % self->slots_per_sector;
+    if (sector != self->buffer_sector) {
+        flush_buffer(self);
+        // Start from the sector's current contents. Its later slots still
+        // hold the oldest records from the previous lap.
+        read_record_sector(self, sector, self->buffer);
+        self->buffer_sector = sector;
+    }
+    self->sequence++;
+    uint8_t *p = self->buffer + index * SLOT_SIZE(self);
+    p[0] = self->sequence;
+    p[1] = self->sequence >> 8;
+    p[2] = self->sequence >> 16;
+    p[3] = self->sequence >> 24;
+    memcpy(p + SLOT_HEADER_SIZE, data, len);
+    memset(p + SLOT_HEADER_SIZE + len, 0, self->record_size - len);
+    self->buffer_dirty = true;
+    // Write each sector as soon as it is full.
+    if (index == self->slots_per_sector - 1) {
+        flush_buffer(self);
+    }
+}
+
+void common_hal_storage_logfile_read(storage_logfile_obj_t *self, uint32_t index, uint8_t *data) {
+    check_mounted(self);
+    uint32_t sequence = self->sequence - common_hal_storage_logfile_get_length(self) + 1 + index;
+    uint32_t slot = (sequence - 1) % self->capacity;
+    uint32_t sector = slot / self->slots_per_sector;
+    uint32_t slot_index = slot % self->slots_per_sector;
+    uint8_t sector_buf[SECTOR_SIZE];
+    const uint8_t *src = self->buffer;
+    if (sector != self->buffer_sector) {
+        read_record_sector(self, sector, sector_buf);
+        src = sector_buf;
+    }
+    if (slot_sequence(self, src, slot_index) != sequence) {
+        mp_raise_OSError(MP_EIO);
+    }
+    memcpy(data, src + slot_index * SLOT_SIZE(self) + SLOT_HEADER_SIZE, self->record_size);
+}
+
+void common_hal_storage_logfile_flush(storage_logfile_obj_t *self) {
+    check_mounted(self);
+    flush_buffer(self);
+    disk_ioctl(self->vfs, CTRL_SYNC, NULL);
+}
+
+uint32_t common_hal_storage_logfile_get_length(storage_logfile_obj_t *self) {
+    return MIN(self->sequence, self->capacity);
+}
+
+uint32_t common_hal_storage_logfile_get_capacity(storage_logfile_obj_t *self) {
+    return self->capacity;
+}
+
+uint32_t common_hal_storage_logfile_get_record_size(storage_logfile_obj_t *self) {
+    return self->record_size;
+}
+
+uint32_t common_hal_storage_logfile_get_sequence(storage_logfile_obj_t *self) {
+    return self->sequence;
+}
+
+#endif // CIRCUITPY_STORAGE_LOGFILE
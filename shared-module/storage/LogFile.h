@@ -0,0 +1,29 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "extmod/vfs_fat.h"
+
+#define STORAGE_LOGFILE_SECTOR_SIZE (512)
+
+typedef struct {
+    mp_obj_base_t base;
+    fs_user_mount_t *vfs;
+    // FatFs cluster link map of the file, used to find its sectors.
+    DWORD *cltbl;
+    uint32_t record_size;
+    uint32_t slots_per_sector;
+    uint32_t capacity;
+    // Sequence number of the newest record. Records are numbered from 1, so
+    // this is also the number of records ever appended.
+    uint32_t sequence;
+    // Index (within the record area) of the sector held in buffer.
+    uint32_t buffer_sector;
+    bool buffer_dirty;
+    uint8_t buffer[STORAGE_LOGFILE_SECTOR_SIZE];
+} storage_logfile_obj_t;
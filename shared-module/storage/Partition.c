@@ -0,0 +1,55 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/Partition.h"
+#include "supervisor/filesystem.h"
+#include "supervisor/flash.h"
+
+void common_hal_storage_partition_construct(storage_partition_obj_t *self) {
+    if (supervisor_flash_partition_get_size() == 0) {
+        // The board doesn't reserve a partition.
+        mp_raise_OSError(MP_ENODEV);
+    }
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    if (data_drive_vfs() != NULL) {
+        // The data drive's filesystem owns the partition.
+        mp_raise_OSError(MP_EBUSY);
+    }
+    #endif
+}
+
+uint32_t common_hal_storage_partition_get_size(storage_partition_obj_t *self) {
+    return supervisor_flash_partition_get_size();
+}
+
+uint32_t common_hal_storage_partition_get_block_size(storage_partition_obj_t *self) {
+    return SUPERVISOR_FLASH_PARTITION_ERASE_SIZE;
+}
+
+const uint8_t *common_hal_storage_partition_get_mapped(storage_partition_obj_t *self) {
+    return supervisor_flash_partition_get_mapped();
+}
+
+bool common_hal_storage_partition_read(storage_partition_obj_t *self, uint32_t address, uint8_t *dest, uint32_t len) {
+    return supervisor_flash_partition_read(address, dest, len);
+}
+
+bool common_hal_storage_partition_write(storage_partition_obj_t *self, uint32_t address, const uint8_t *src, uint32_t len, bool erase) {
+    if (erase) {
+        for (uint32_t a = address; a < address + len; a += SUPERVISOR_FLASH_PARTITION_ERASE_SIZE) {
+            if (!supervisor_flash_partition_erase(a)) {
+                return false;
+            }
+        }
+    }
+    return supervisor_flash_partition_prog(address, src, len);
+}
+
+bool common_hal_storage_partition_erase(storage_partition_obj_t *self, uint32_t address) {
+    return supervisor_flash_partition_erase(address);
+}
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "py/builtin.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/obj.h"
@@ -18,6 +19,7 @@
 #include "shared-bindings/storage/__init__.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/flash.h"
+#include "supervisor/shared/progress.h"
 
 #if CIRCUITPY_USB_DEVICE
 #include "supervisor/usb.h"
@@ -126,6 +128,18 @@ bool common_hal_storage_disable_usb_drive(void) {
 bool common_hal_storage_enable_usb_drive(void) {
     return usb_drive_set_enabled(true);
 }
+
+#if CIRCUITPY_STORAGE_DATA_DRIVE
+void common_hal_storage_enable_data_drive(void) {
+    // The number of drives is fixed once the host has enumerated us.
+    if (data_drive_vfs() == NULL && tud_connected()) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
+    }
+    if (!data_drive_enable()) {
+        mp_raise_OSError(MP_ENODEV);
+    }
+}
+#endif
 #else
 bool common_hal_storage_disable_usb_drive(void) {
     return false;
@@ -202,6 +216,10 @@ void common_hal_storage_mount(mp_obj_t vfs_obj, const char *mount_path, bool rea
     mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table);
     vfs->next = *vfsp;
     *vfsp = vfs;
+
+    #if MICROPY_MODULE_PATH_CACHE
+    mp_module_path_cache_invalidate();
+    #endif
 }
 
 void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
@@ -224,6 +242,10 @@ void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
         MP_STATE_VM(vfs_cur) = MP_VFS_ROOT;
     }
 
+    #if MICROPY_MODULE_PATH_CACHE
+    mp_module_path_cache_invalidate();
+    #endif
+
     // call the underlying object to do any unmounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_umount, 0, NULL);
 }
@@ -256,6 +278,10 @@ void common_hal_storage_remount(const char *mount_path, bool readonly, bool disa
     }
     #endif
 
+    #if CIRCUITPY_BLOCKDEV_CACHE_SECTORS > 0
+    mp_vfs_blockdev_cache_flush(NULL);
+    #endif
+
     filesystem_set_internal_writable_by_usb(readonly);
     filesystem_set_internal_concurrent_write_protection(!disable_concurrent_write_protection);
 }
@@ -268,8 +294,27 @@ void common_hal_storage_erase_filesystem(bool extended) {
     #if CIRCUITPY_STORAGE_EXTEND
     supervisor_flash_set_extended(extended);
     #endif
+    // Formatting writes the whole FAT, which can take longer than the watchdog timeout.
+    supervisor_long_operation_begin();
     (void)filesystem_init(false, true);  // Force a re-format. Ignore failure.
+    supervisor_long_operation_end();
     common_hal_mcu_on_next_reset(RUNMODE_NORMAL);
     common_hal_mcu_reset();
     // We won't actually get here, since we're resetting.
 }
+
+#if CIRCUITPY_LITTLEFS
+void common_hal_storage_erase_filesystem_littlefs(void) {
+    #if CIRCUITPY_USB_DEVICE
+    usb_disconnect();
+    #endif
+    mp_hal_delay_ms(1000);
+    // Any error is raised before the reset so it can be seen.
+    supervisor_long_operation_begin();
+    filesystem_format_littlefs();
+    supervisor_long_operation_end();
+    common_hal_mcu_on_next_reset(RUNMODE_NORMAL);
+    common_hal_mcu_reset();
+    // We won't actually get here, since we're resetting.
+}
+#endif
@@ -12,6 +12,7 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
 
 static void struct_validate_format(char fmt) {
     #if MICROPY_NONSTANDARD_TYPECODES
@@ -51,44 +52,36 @@ static mp_uint_t get_fmt_num(const char **p) {
     return val;
 }
 
-static mp_uint_t calcsize_items(const char *fmt) {
-    mp_uint_t cnt = 0;
-    while (*fmt) {
-        int num = 1;
-        if (unichar_isdigit(*fmt)) {
-            num = get_fmt_num(&fmt);
-            if (*fmt == 's') {
-                num = 1;
-            }
-        }
-        // Pad bytes are skipped and don't get included in the item count.
-        if (*fmt != 'x') {
-            cnt += num;
-        }
-        fmt++;
-    }
-    return cnt;
-}
-
-mp_uint_t shared_modules_struct_calcsize(mp_obj_t fmt_in) {
-    const char *fmt = mp_obj_str_get_str(fmt_in);
-    char fmt_type = get_fmt_type(&fmt);
-
-    mp_uint_t size;
-    for (size = 0; *fmt; fmt++) {
-
+// Parse fmt into ops, which must have room for strlen(fmt) entries, or just
+// count the ops if ops is NULL. Returns the number of ops.
+size_t shared_modules_struct_parse(const char *fmt, char *fmt_type, struct_op_t *ops) {
+    *fmt_type = get_fmt_type(&fmt);
+    size_t num_ops = 0;
+    for (; *fmt; fmt++) {
         struct_validate_format(*fmt);
 
         mp_uint_t cnt = 1;
         if (unichar_isdigit(*fmt)) {
             cnt = get_fmt_num(&fmt);
         }
+        if (ops != NULL) {
+            ops[num_ops].count = cnt;
+            ops[num_ops].code = *fmt;
+        }
+        num_ops++;
+    }
+    return num_ops;
+}
 
-        if (*fmt == 's') {
+mp_uint_t shared_modules_struct_ops_size(char fmt_type, const struct_op_t *ops, size_t num_ops) {
+    mp_uint_t size = 0;
+    for (size_t n = 0; n < num_ops; n++) {
+        mp_uint_t cnt = ops[n].count;
+        if (ops[n].code == 's') {
             size += cnt;
         } else {
             mp_uint_t align;
-            size_t sz = mp_binary_get_size(fmt_type, *fmt, &align);
+            size_t sz = mp_binary_get_size(fmt_type, ops[n].code, &align);
             while (cnt--) {
                 // Apply alignment
                 size = (size + align - 1) & ~(align - 1);
@@ -99,26 +92,27 @@ mp_uint_t shared_modules_struct_calcsize(mp_obj_t fmt_in) {
     return size;
 }
 
-void shared_modules_struct_pack_into(mp_obj_t fmt_in, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args) {
-    const char *fmt = mp_obj_str_get_str(fmt_in);
-    char fmt_type = get_fmt_type(&fmt);
-    const mp_uint_t total_sz = shared_modules_struct_calcsize(fmt_in);
-
-    if (p + total_sz > end_p) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+mp_uint_t shared_modules_struct_ops_num_items(const struct_op_t *ops, size_t num_ops) {
+    mp_uint_t cnt = 0;
+    for (size_t n = 0; n < num_ops; n++) {
+        // Pad bytes are skipped and don't get included in the item count.
+        if (ops[n].code == 's') {
+            cnt += 1;
+        } else if (ops[n].code != 'x') {
+            cnt += ops[n].count;
+        }
     }
+    return cnt;
+}
 
+// The caller has checked that the buffer at p is big enough.
+void shared_modules_struct_pack_ops(char fmt_type, const struct_op_t *ops, size_t num_ops, byte *p, size_t n_args, const mp_obj_t *args) {
     size_t i = 0;
     byte *p_base = p;
-    while (*fmt) {
-        mp_uint_t sz = 1;
-        struct_validate_format(*fmt);
-
-        if (unichar_isdigit(*fmt)) {
-            sz = get_fmt_num(&fmt);
-        }
-
-        if (*fmt == 's') {
+    for (size_t n = 0; n < num_ops; n++) {
+        char code = ops[n].code;
+        mp_uint_t sz = ops[n].count;
+        if (code == 's') {
             if (i < n_args) {
                 mp_buffer_info_t bufinfo;
                 mp_get_buffer_raise(args[i], &bufinfo, MP_BUFFER_READ);
@@ -134,29 +128,210 @@ void shared_modules_struct_pack_into(mp_obj_t fmt_in, byte *p, byte *end_p, size
         } else {
             while (sz--) {
                 // Pad bytes don't have a corresponding argument.
-                if (*fmt == 'x') {
-                    mp_binary_set_val(fmt_type, *fmt, MP_OBJ_NEW_SMALL_INT(0), p_base, &p);
+                if (code == 'x') {
+                    mp_binary_set_val(fmt_type, code, MP_OBJ_NEW_SMALL_INT(0), p_base, &p);
                 } else {
                     if (i < n_args) {
-                        mp_binary_set_val(fmt_type, *fmt, args[i], p_base, &p);
+                        mp_binary_set_val(fmt_type, code, args[i], p_base, &p);
                     }
                     i++;
                 }
             }
         }
-        fmt++;
     }
     (void)mp_arg_validate_length(n_args, i, MP_QSTR_values);
 }
 
-mp_obj_tuple_t *shared_modules_struct_unpack_from(mp_obj_t fmt_in, byte *p, byte *end_p, bool exact_size) {
+// The caller has checked that the buffer at p is big enough.
+void shared_modules_struct_unpack_ops(char fmt_type, const struct_op_t *ops, size_t num_ops, byte *p, mp_obj_t *items) {
+    byte *p_base = p;
+    size_t i = 0;
+    for (size_t n = 0; n < num_ops; n++) {
+        char code = ops[n].code;
+        mp_uint_t sz = ops[n].count;
+        if (code == 's') {
+            items[i++] = mp_obj_new_bytes(p, sz);
+            p += sz;
+        } else {
+            while (sz--) {
+                mp_obj_t item = mp_binary_get_val(fmt_type, code, p_base, &p);
+                // Pad bytes are not stored.
+                if (code != 'x') {
+                    items[i++] = item;
+                }
+            }
+        }
+    }
+}
 
-    const char *fmt = mp_obj_str_get_str(fmt_in);
-    char fmt_type = get_fmt_type(&fmt);
-    const mp_uint_t num_items = calcsize_items(fmt);
-    const mp_uint_t total_sz = shared_modules_struct_calcsize(fmt_in);
-    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_items, NULL));
+// Where a field of each record goes when unpacking into columns.
+typedef struct {
+    void *buf;          // typed column storage, or NULL for a list column
+    mp_obj_t *items;    // list column items
+    size_t offset;      // offset of the field within a record
+    mp_uint_t size;     // size of the field, or its length for 's'
+    size_t elem_size;   // size of one element of buf
+    char code;
+    char typecode;
+    bool copy;          // field and column hold the same kind of value
+} struct_column_t;
+
+// Classify a struct code or array typecode as a signed ('i') or unsigned ('u')
+// integer, a float ('f'), or something else (0).
+static char struct_code_kind(char code) {
+    switch (code) {
+        case 'b':
+        case 'h':
+        case 'i':
+        case 'l':
+        case 'q':
+            return 'i';
+        case BYTEARRAY_TYPECODE:
+        case 'B':
+        case 'H':
+        case 'I':
+        case 'L':
+        case 'Q':
+            return 'u';
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case 'f':
+        case 'd':
+            return 'f';
+        #endif
+        default:
+            return 0;
+    }
+}
 
+static void struct_store_column(const struct_column_t *col, char fmt_type, bool big_endian, byte *src, size_t index) {
+    if (col->items != NULL) {
+        if (col->code == 's') {
+            col->items[index] = mp_obj_new_bytes(src, col->size);
+        } else {
+            byte *p = src;
+            col->items[index] = mp_binary_get_val(fmt_type, col->code, src, &p);
+        }
+        return;
+    }
+    if (col->copy) {
+        // Same representation, only the byte order may differ.
+        byte *dest = (byte *)col->buf + index * col->elem_size;
+        if (big_endian == MP_ENDIANNESS_BIG) {
+            memcpy(dest, src, col->size);
+        } else {
+            for (size_t i = 0; i < col->size; i++) {
+                dest[i] = src[col->size - 1 - i];
+            }
+        }
+        return;
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    char field_kind = struct_code_kind(col->code);
+    if (struct_code_kind(col->typecode) == 'f' && field_kind != 0) {
+        // Convert a number to a float column without boxing it.
+        long long raw = mp_binary_get_int(col->size, field_kind == 'i', big_endian, src);
+        double val;
+        if (col->code == 'f') {
+            union {
+                uint32_t i;
+                float f;
+            } fpu = {raw};
+            val = fpu.f;
+        } else if (col->code == 'd') {
+            union {
+                uint64_t i;
+                double f;
+            } fpu = {raw};
+            val = fpu.f;
+        } else if (field_kind == 'u') {
+            val = (double)(unsigned long long)raw;
+        } else {
+            val = (double)raw;
+        }
+        if (col->typecode == 'f') {
+            ((float *)col->buf)[index] = (float)val;
+        } else {
+            ((double *)col->buf)[index] = val;
+        }
+        return;
+    }
+    #endif
+    // Anything else goes through an object, which checks for overflow.
+    byte *p = src;
+    mp_binary_set_val_array(col->typecode, col->buf, index, mp_binary_get_val(fmt_type, col->code, src, &p));
+}
+
+// Unpack consecutive records starting at p into columns, one per item of the
+// format, stopping at the end of the buffer or of the shortest column. A column
+// is a writable buffer such as an array, a list, or None to skip that item.
+// Returns the number of records unpacked.
+size_t shared_modules_struct_unpack_columns_ops(char fmt_type, const struct_op_t *ops, size_t num_ops, byte *p, byte *end_p, size_t n_columns, const mp_obj_t *columns) {
+    const mp_uint_t num_items = shared_modules_struct_ops_num_items(ops, num_ops);
+    const mp_uint_t size = shared_modules_struct_ops_size(fmt_type, ops, num_ops);
+    mp_arg_validate_length(n_columns, num_items, MP_QSTR_columns);
+    mp_arg_validate_int_min(size, 1, MP_QSTR_size);
+
+    size_t n_records = p < end_p ? (size_t)(end_p - p) / size : 0;
+    struct_column_t *cols = mp_local_alloc(num_items * sizeof(struct_column_t));
+    size_t n_cols = 0;
+    size_t offset = 0;
+    size_t i = 0;
+    for (size_t n = 0; n < num_ops; n++) {
+        char code = ops[n].code;
+        mp_uint_t cnt = ops[n].count;
+        mp_uint_t sz = cnt;
+        size_t align = 1;
+        if (code == 's') {
+            cnt = 1;
+        } else {
+            sz = mp_binary_get_size(fmt_type, code, &align);
+        }
+        while (cnt--) {
+            offset = (offset + align - 1) & ~(align - 1);
+            if (code != 'x' && columns[i++] != mp_const_none) {
+                struct_column_t *col = &cols[n_cols++];
+                mp_obj_t column = columns[i - 1];
+                col->offset = offset;
+                col->size = sz;
+                col->code = code;
+                col->copy = false;
+                size_t len;
+                if (mp_obj_is_type(column, &mp_type_list)) {
+                    col->buf = NULL;
+                    mp_obj_get_array(column, &len, &col->items);
+                } else {
+                    mp_buffer_info_t bufinfo;
+                    mp_get_buffer_raise(column, &bufinfo, MP_BUFFER_WRITE);
+                    col->buf = bufinfo.buf;
+                    col->items = NULL;
+                    col->typecode = bufinfo.typecode;
+                    col->elem_size = mp_binary_get_size('@', bufinfo.typecode, NULL);
+                    col->copy = col->elem_size == sz && struct_code_kind(code) != 0
+                        && struct_code_kind(code) == struct_code_kind(bufinfo.typecode);
+                    len = bufinfo.len / col->elem_size;
+                }
+                if (len < n_records) {
+                    n_records = len;
+                }
+            }
+            offset += sz;
+        }
+    }
+
+    if (fmt_type == '@') {
+        fmt_type = MP_ENDIANNESS_BIG ? '>' : '<';
+    }
+    bool big_endian = fmt_type == '>';
+    for (size_t r = 0; r < n_records; r++, p += size) {
+        for (size_t c = 0; c < n_cols; c++) {
+            struct_store_column(&cols[c], fmt_type, big_endian, p + cols[c].offset, r);
+        }
+    }
+    mp_local_free(cols);
+    return n_records;
+}
+
+static void struct_check_size(byte *p, byte *end_p, mp_uint_t total_sz, bool exact_size) {
     // If exact_size, make sure the buffer is exactly the right size.
     // Otherwise just make sure it's big enough.
     if (exact_size) {
@@ -168,32 +343,79 @@ mp_obj_tuple_t *shared_modules_struct_unpack_from(mp_obj_t fmt_in, byte *p, byte
             mp_raise_RuntimeError(MP_ERROR_TEXT("buffer too small"));
         }
     }
+}
 
-    byte *p_base = p;
-    for (uint i = 0; i < num_items;) {
-        mp_uint_t sz = 1;
+mp_uint_t shared_modules_struct_calcsize(mp_obj_t fmt_in) {
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type;
+    size_t num_ops = shared_modules_struct_parse(fmt, &fmt_type, NULL);
+    struct_op_t *ops = mp_local_alloc(num_ops * sizeof(struct_op_t));
+    shared_modules_struct_parse(fmt, &fmt_type, ops);
+    mp_uint_t size = shared_modules_struct_ops_size(fmt_type, ops, num_ops);
+    mp_local_free(ops);
+    return size;
+}
 
-        struct_validate_format(*fmt);
+void shared_modules_struct_pack_into(mp_obj_t fmt_in, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args) {
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type;
+    size_t num_ops = shared_modules_struct_parse(fmt, &fmt_type, NULL);
+    struct_op_t *ops = mp_local_alloc(num_ops * sizeof(struct_op_t));
+    shared_modules_struct_parse(fmt, &fmt_type, ops);
+    const mp_uint_t total_sz = shared_modules_struct_ops_size(fmt_type, ops, num_ops);
 
-        if (unichar_isdigit(*fmt)) {
-            sz = get_fmt_num(&fmt);
-        }
-        mp_obj_t item;
-        if (*fmt == 's') {
-            item = mp_obj_new_bytes(p, sz);
-            p += sz;
-            res->items[i++] = item;
-        } else {
-            while (sz--) {
-                item = mp_binary_get_val(fmt_type, *fmt, p_base, &p);
-                // Pad bytes are not stored.
-                if (*fmt != 'x') {
-                    res->items[i++] = item;
-                }
-            }
-        }
-        fmt++;
+    if (p + total_sz > end_p) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
     }
+
+    shared_modules_struct_pack_ops(fmt_type, ops, num_ops, p, n_args, args);
+    mp_local_free(ops);
+}
+
+mp_obj_tuple_t *shared_modules_struct_unpack_from(mp_obj_t fmt_in, byte *p, byte *end_p, bool exact_size) {
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type;
+    size_t num_ops = shared_modules_struct_parse(fmt, &fmt_type, NULL);
+    struct_op_t *ops = mp_local_alloc(num_ops * sizeof(struct_op_t));
+    shared_modules_struct_parse(fmt, &fmt_type, ops);
+    const mp_uint_t num_items = shared_modules_struct_ops_num_items(ops, num_ops);
+    const mp_uint_t total_sz = shared_modules_struct_ops_size(fmt_type, ops, num_ops);
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_items, NULL));
+
+    struct_check_size(p, end_p, total_sz, exact_size);
+    shared_modules_struct_unpack_ops(fmt_type, ops, num_ops, p, res->items);
+    mp_local_free(ops);
     return res;
+}
+
+size_t shared_modules_struct_unpack_columns(mp_obj_t fmt_in, byte *p, byte *end_p, size_t n_columns, const mp_obj_t *columns) {
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type;
+    size_t num_ops = shared_modules_struct_parse(fmt, &fmt_type, NULL);
+    struct_op_t *ops = mp_local_alloc(num_ops * sizeof(struct_op_t));
+    shared_modules_struct_parse(fmt, &fmt_type, ops);
+    size_t n_records = shared_modules_struct_unpack_columns_ops(fmt_type, ops, num_ops, p, end_p, n_columns, columns);
+    mp_local_free(ops);
+    return n_records;
+}
+
+// struct.Struct
+
+void shared_modules_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format) {
+    self->format = format;
+    shared_modules_struct_parse(mp_obj_str_get_str(format), &self->fmt_type, self->ops);
+    self->size = shared_modules_struct_ops_size(self->fmt_type, self->ops, self->num_ops);
+    self->num_items = shared_modules_struct_ops_num_items(self->ops, self->num_ops);
+}
+
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args) {
+    if (p + self->size > end_p) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+    }
+    shared_modules_struct_pack_ops(self->fmt_type, self->ops, self->num_ops, p, n_args, args);
+}
 
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, byte *end_p, bool exact_size, mp_obj_t *items) {
+    struct_check_size(p, end_p, self->size, exact_size);
+    shared_modules_struct_unpack_ops(self->fmt_type, self->ops, self->num_ops, p, items);
 }
@@ -5,6 +5,27 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
-char get_fmt_type(const char **fmt);
-mp_uint_t get_fmt_num(const char **p);
-mp_uint_t calcsize_items(const char *fmt);
+#include "py/obj.h"
+
+// One format character with its repeat count, or its length for 's'.
+typedef struct {
+    mp_uint_t count;
+    char code;
+} struct_op_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t format;
+    mp_uint_t size;
+    mp_uint_t num_items;
+    size_t num_ops;
+    char fmt_type;
+    struct_op_t ops[];
+} struct_struct_obj_t;
+
+size_t shared_modules_struct_parse(const char *fmt, char *fmt_type, struct_op_t *ops);
+mp_uint_t shared_modules_struct_ops_size(char fmt_type, const struct_op_t *ops, size_t num_ops);
+mp_uint_t shared_modules_struct_ops_num_items(const struct_op_t *ops, size_t num_ops);
+void shared_modules_struct_pack_ops(char fmt_type, const struct_op_t *ops, size_t num_ops, byte *p, size_t n_args, const mp_obj_t *args);
+void shared_modules_struct_unpack_ops(char fmt_type, const struct_op_t *ops, size_t num_ops, byte *p, mp_obj_t *items);
+size_t shared_modules_struct_unpack_columns_ops(char fmt_type, const struct_op_t *ops, size_t num_ops, byte *p, byte *end_p, size_t n_columns, const mp_obj_t *columns);
@@ -99,7 +99,8 @@ void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj)
 }
 
 void synthio_biquad_filter_reset(biquad_filter_state *st) {
-    memset(&st->x, 0, 4 * sizeof(int16_t));
+    memset(&st->x, 0, sizeof(st->x));
+    memset(&st->y, 0, sizeof(st->y));
 }
 
 void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples) {
@@ -129,3 +130,11 @@ void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, siz
     st->y[0] = y0;
     st->y[1] = y1;
 }
+
+void synthio_biquad_filter_cascade(biquad_filter_state *st, size_t n_sections, int32_t *buffer, size_t n_samples) {
+    // Each section goes over the whole block before the next one starts, so
+    // its coefficients and history can stay in registers.
+    for (; n_sections; --n_sections, ++st) {
+        synthio_biquad_filter_samples(st, buffer, n_samples);
+    }
+}
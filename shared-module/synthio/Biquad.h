@@ -18,3 +18,5 @@ typedef struct {
 void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj);
 void synthio_biquad_filter_reset(biquad_filter_state *st);
 void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples);
+// Runs buffer through n_sections filters, one after the other.
+void synthio_biquad_filter_cascade(biquad_filter_state *st, size_t n_sections, int32_t *buffer, size_t n_samples);
@@ -0,0 +1,47 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/synthio/BiquadCascade.h"
+#include "shared-module/synthio/__init__.h"
+
+void common_hal_synthio_biquad_cascade_construct(synthio_biquad_cascade_obj_t *self, mp_obj_t filters) {
+    size_t n_sections;
+    mp_obj_t *items;
+    mp_obj_tuple_get(filters, &n_sections, &items);
+
+    self->filters = filters;
+    self->n_sections = n_sections;
+    for (size_t i = 0; i < n_sections; i++) {
+        synthio_biquad_filter_assign(&self->sections[i], items[i]);
+        synthio_biquad_filter_reset(&self->sections[i]);
+    }
+}
+
+mp_obj_t common_hal_synthio_biquad_cascade_get_filters(synthio_biquad_cascade_obj_t *self) {
+    return self->filters;
+}
+
+void common_hal_synthio_biquad_cascade_reset(synthio_biquad_cascade_obj_t *self) {
+    for (size_t i = 0; i < self->n_sections; i++) {
+        synthio_biquad_filter_reset(&self->sections[i]);
+    }
+}
+
+void common_hal_synthio_biquad_cascade_process(synthio_biquad_cascade_obj_t *self, int16_t *samples, size_t n_samples) {
+    int32_t work[SYNTHIO_MAX_DUR];
+    while (n_samples) {
+        size_t n = MIN(n_samples, SYNTHIO_MAX_DUR);
+        for (size_t i = 0; i < n; i++) {
+            work[i] = samples[i];
+        }
+        synthio_biquad_filter_cascade(self->sections, self->n_sections, work, n);
+        for (size_t i = 0; i < n; i++) {
+            samples[i] = MIN(32767, MAX(-32768, work[i]));
+        }
+        samples += n;
+        n_samples -= n;
+    }
+}
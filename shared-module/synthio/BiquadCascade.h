@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/synthio/Biquad.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t filters; // tuple of Biquad
+    size_t n_sections;
+    biquad_filter_state sections[];
+} synthio_biquad_cascade_obj_t;
@@ -5,10 +5,18 @@
 // SPDX-License-Identifier: MIT
 
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/synthio/LFO.h"
 #include "shared-bindings/synthio/Note.h"
 #include "shared-bindings/synthio/Synthesizer.h"
 #include "shared-module/synthio/Note.h"
+#if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_MIDI
+#include "shared-bindings/usb_midi/PortIn.h"
+#endif
+
+// Most MIDI bytes to act on for each buffer, so that a flood of input cannot
+// hold up the audio.
+#define SYNTHIO_MIDI_IN_MAX_BYTES (256)
 
 
 
@@ -18,10 +26,13 @@ void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
 
     synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
     self->blocks = mp_obj_new_list(0, NULL);
+    self->midi_in = mp_const_none;
+    self->midi_channel = -1;
 }
 
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self) {
     synthio_synth_deinit(&self->synth);
+    self->midi_in = mp_const_none;
 }
 bool common_hal_synthio_synthesizer_deinited(synthio_synthesizer_obj_t *self) {
     return synthio_synth_deinited(&self->synth);
@@ -50,6 +61,10 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
     }
     self->synth.span.dur = SYNTHIO_MAX_DUR;
 
+    // A stereo buffer is only synthesized once, so only poll on the first request for it.
+    if ((single_channel_output ? channel : 0) != self->synth.other_channel) {
+        synthio_synthesizer_poll_midi_in(self);
+    }
 
     synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? channel : 0);
 
@@ -179,3 +194,113 @@ envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_ob
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self) {
     return self->blocks;
 }
+
+mp_obj_t common_hal_synthio_synthesizer_get_midi_in(synthio_synthesizer_obj_t *self) {
+    return self->midi_in;
+}
+
+void common_hal_synthio_synthesizer_set_midi_in(synthio_synthesizer_obj_t *self, mp_obj_t midi_in) {
+    bool batched = false;
+    if (midi_in != mp_const_none) {
+        const mp_stream_p_t *stream = mp_get_stream_raise(midi_in, MP_STREAM_OP_READ | MP_STREAM_OP_IOCTL);
+        int errcode;
+        // A stream that can't be polled, such as io.BytesIO, never waits for data.
+        batched = stream->ioctl(midi_in, MP_STREAM_POLL, MP_STREAM_POLL_RD, &errcode) == MP_STREAM_ERROR;
+        #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_MIDI
+        // usb_midi.PortIn returns whatever has arrived instead of waiting for more.
+        batched |= mp_obj_is_type(midi_in, &usb_midi_portin_type);
+        #endif
+    }
+    self->midi_in = midi_in;
+    self->midi_in_batched = batched;
+    self->midi_status = 0;
+    self->midi_data_count = 0;
+}
+
+mp_int_t common_hal_synthio_synthesizer_get_midi_channel(synthio_synthesizer_obj_t *self) {
+    return self->midi_channel;
+}
+
+void common_hal_synthio_synthesizer_set_midi_channel(synthio_synthesizer_obj_t *self, mp_int_t channel) {
+    self->midi_channel = channel;
+}
+
+static void midi_in_message(synthio_synthesizer_obj_t *self, uint8_t status, uint8_t data0, uint8_t data1) {
+    if (self->midi_channel >= 0 && (status & 0xf) != self->midi_channel) {
+        return;
+    }
+    switch (status >> 4) {
+        case 8: // Note Off
+            synthio_span_change_note(&self->synth, MP_OBJ_NEW_SMALL_INT(data0), SYNTHIO_SILENCE);
+            break;
+        case 9: // Note On, or Note Off if the velocity is 0
+            if (data1 == 0) {
+                synthio_span_change_note(&self->synth, MP_OBJ_NEW_SMALL_INT(data0), SYNTHIO_SILENCE);
+            } else {
+                synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, MP_OBJ_NEW_SMALL_INT(data0));
+            }
+            break;
+        case 11: // Control Change
+            if (data0 == 120 || data0 == 123) { // All Sound Off, All Notes Off
+                common_hal_synthio_synthesizer_release_all(self);
+            }
+            break;
+    }
+}
+
+static void midi_in_byte(synthio_synthesizer_obj_t *self, uint8_t b) {
+    if (b >= 0xf8) {
+        // System Real Time messages may come between the bytes of any other message.
+        return;
+    }
+    if (b >= 0xf0) {
+        // System Exclusive and System Common messages cancel running status. Their
+        // data bytes are skipped because there is no status to go with them.
+        self->midi_status = 0;
+        return;
+    }
+    if (b & 0x80) {
+        self->midi_status = b;
+        self->midi_data_count = 0;
+        return;
+    }
+    if (self->midi_status == 0) {
+        return;
+    }
+    self->midi_data[self->midi_data_count++] = b;
+    uint8_t kind = self->midi_status >> 4;
+    uint8_t length = (kind == 12 || kind == 13) ? 1 : 2;
+    if (self->midi_data_count == length) {
+        self->midi_data_count = 0;
+        midi_in_message(self, self->midi_status, self->midi_data[0], self->midi_data[1]);
+    }
+}
+
+void synthio_synthesizer_poll_midi_in(synthio_synthesizer_obj_t *self) {
+    if (self->midi_in == mp_const_none) {
+        return;
+    }
+    const mp_stream_p_t *stream = mp_get_stream(self->midi_in);
+    uint8_t buf[64];
+    size_t total = 0;
+    while (total < SYNTHIO_MIDI_IN_MAX_BYTES) {
+        int errcode;
+        size_t len = sizeof(buf);
+        if (!self->midi_in_batched) {
+            // Only read what is known to be there, a byte at a time, so the read can't block.
+            mp_uint_t ready = stream->ioctl(self->midi_in, MP_STREAM_POLL, MP_STREAM_POLL_RD, &errcode);
+            if (ready == MP_STREAM_ERROR || !(ready & MP_STREAM_POLL_RD)) {
+                return;
+            }
+            len = 1;
+        }
+        mp_uint_t n = stream->read(self->midi_in, buf, len, &errcode);
+        if (n == MP_STREAM_ERROR || n == 0) {
+            return;
+        }
+        for (size_t i = 0; i < n; i++) {
+            midi_in_byte(self, buf[i]);
+        }
+        total += n;
+    }
+}
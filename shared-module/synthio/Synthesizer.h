@@ -15,6 +15,16 @@ typedef struct {
     mp_obj_base_t base;
     synthio_synth_t synth;
     mp_obj_t blocks;
+    // Stream that MIDI messages are read from, or None.
+    mp_obj_t midi_in;
+    // Channel to respond to, 0 to 15, or -1 for all channels.
+    int8_t midi_channel;
+    // Running status, or 0 if there is none.
+    uint8_t midi_status;
+    uint8_t midi_data[2];
+    uint8_t midi_data_count;
+    // Whether reads from midi_in return at once, so several bytes may be read together.
+    bool midi_in_batched;
 } synthio_synthesizer_obj_t;
 
 
@@ -29,6 +39,9 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
     uint8_t **buffer,
     uint32_t *buffer_length); // length in bytes
 
+// Reads and acts on any MIDI messages waiting on midi_in.
+void synthio_synthesizer_poll_midi_in(synthio_synthesizer_obj_t *self);
+
 void synthio_synthesizer_get_buffer_structure(synthio_synthesizer_obj_t *self, bool single_channel_output,
     bool *single_buffer, bool *samples_signed,
     uint32_t *max_buffer_length, uint8_t *spacing);
@@ -155,7 +155,34 @@ int16_t mix_down_sample(int32_t sample) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
+    if (note_obj == mp_const_none) {
+        return mp_const_none;
+    }
+    if (!mp_obj_is_small_int(note_obj)) {
+        synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
+        return note->filter_obj;
+    }
+    return mp_const_none;
+}
+
+static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+    if (synth_chan == 1) {
+        for (size_t i = 0; i < dur; i++) {
+            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
+        }
+    } else {
+        for (size_t i = 0; i < dur; i++) {
+            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
+            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+        }
+    }
+}
+
+// Renders one note and sums it, scaled by its loudness, into out_buffer32.
+// tmp_buffer32 holds the note on its own when it has to be ring modulated or
+// filtered before summing; otherwise the waveform is summed in directly.
+static void synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t dur, int16_t loudness[2]) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->sample_rate;
@@ -209,8 +236,8 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t accum = synth->accum[chan];
 
     if (dds_rate > lim / 2) {
-        // beyond nyquist, can't play note
-        return false;
+        // beyond nyquist, can't play note, so don't filter or sum it in
+        return;
     }
 
     // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
@@ -218,6 +245,34 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         accum = accum % lim + offset;
     }
 
+    mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
+    if (!ring_dds_rate && filter_obj == mp_const_none) {
+        // Nothing to do between the waveform and the sum, so skip tmp_buffer32.
+        if (synth->channel_count == 1) {
+            for (uint16_t i = 0; i < dur; i++) {
+                accum += dds_rate;
+                if (accum > lim) {
+                    accum = accum - lim + offset;
+                }
+                int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+                out_buffer32[i] += (waveform[idx] * loudness[0]) >> 16;
+            }
+        } else {
+            for (uint16_t i = 0; i < dur; i++) {
+                accum += dds_rate;
+                if (accum > lim) {
+                    accum = accum - lim + offset;
+                }
+                int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+                int32_t sample = waveform[idx];
+                *out_buffer32++ += (sample * loudness[0]) >> 16;
+                *out_buffer32++ += (sample * loudness[1]) >> 16;
+            }
+        }
+        synth->accum[chan] = accum;
+        return;
+    }
+
     // first, fill with waveform
     for (uint16_t i = 0; i < dur; i++) {
         accum += dds_rate;
@@ -226,17 +281,12 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             accum = accum - lim + offset;
         }
         int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+        tmp_buffer32[i] = waveform[idx];
     }
     synth->accum[chan] = accum;
 
-    if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
-        }
-
+    // beyond nyquist, can't play ring (but the main sound is still summed)
+    if (ring_dds_rate && ring_dds_rate <= lim / 2) {
         // now modulate by ring and accumulate
         accum = synth->ring_accum[chan];
         offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
@@ -254,36 +304,22 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
                 accum = accum - lim + offset;
             }
             int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768;
-            out_buffer32[i] = wi;
+            int16_t wi = (ring_waveform[idx] * tmp_buffer32[i]) / 32768;
+            tmp_buffer32[i] = wi;
         }
         synth->ring_accum[chan] = accum;
     }
-    return true;
-}
 
-static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
-    if (note_obj == mp_const_none) {
-        return mp_const_none;
-    }
-    if (!mp_obj_is_small_int(note_obj)) {
+    if (filter_obj != mp_const_none) {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-        return note->filter_obj;
-    }
-    return mp_const_none;
-}
-
-static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
-    if (synth_chan == 1) {
-        for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
-        }
-    } else {
-        for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+        if (mp_obj_is_type(filter_obj, &synthio_block_biquad_type_obj)) {
+            common_hal_synthio_block_biquad_tick(filter_obj, &note->filter_state);
         }
+        synthio_biquad_filter_samples(&note->filter_state, tmp_buffer32, dur);
     }
+
+    // adjust loudness by envelope
+    sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
 }
 
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
@@ -321,23 +357,7 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
-            // for some other reason, such as being above nyquist, note
-            // couldn't be synthed, so don't filter or sum it in
-            continue;
-        }
-
-        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
-        if (filter_obj != mp_const_none) {
-            synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-            if (mp_obj_is_type(filter_obj, &synthio_block_biquad_type_obj)) {
-                common_hal_synthio_block_biquad_tick(filter_obj, &note->filter_state);
-            }
-            synthio_biquad_filter_samples(&note->filter_state, tmp_buffer32, dur);
-        }
-
-        // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
+        synth_note_into_buffer(synth, chan, out_buffer32, tmp_buffer32, dur, loudness);
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -18,10 +18,11 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/uheap/__init__.h"
+#include "shared-module/uheap/__init__.h"
 
 #define VERIFY_PTR(ptr) ( \
-    (void *)ptr >= (void *)MP_STATE_MEM(gc_pool_start)         /* must be above start of pool */ \
-    && (void *)ptr < (void *)MP_STATE_MEM(gc_pool_end)            /* must be below end of pool */ \
+    (void *)ptr >= (void *)MP_STATE_MEM(area).gc_pool_start         /* must be above start of pool */ \
+    && (void *)ptr < (void *)MP_STATE_MEM(area).gc_pool_end            /* must be below end of pool */ \
     )
 
 static void indent(uint8_t levels) {
@@ -65,7 +66,7 @@ static uint32_t string_size(uint8_t indent_level, mp_obj_t obj) {
 
 static uint32_t map_size(uint8_t indent_level, const mp_map_t *map) {
     uint32_t total_size = gc_nbytes(map->table);
-    for (int i = 0; i < map->used; i++) {
+    for (size_t i = 0; i < map->used; i++) {
         uint32_t this_size = 0;
         indent(indent_level);
         if (map->table[i].key != NULL) {
@@ -112,19 +113,13 @@ static uint32_t function_size(uint8_t indent_level, mp_obj_t obj) {
         return 0;
     } else if (mp_obj_is_type(obj, &mp_type_fun_bc)) {
         mp_obj_fun_bc_t *fn = MP_OBJ_TO_PTR(obj);
-        uint32_t total_size = gc_nbytes(fn) + gc_nbytes(fn->bytecode) + gc_nbytes(fn->const_table);
-        #if MICROPY_DEBUG_PRINTERS
-        mp_printf(&mp_plat_print, "BYTECODE START\n");
-        mp_bytecode_print(fn, fn->bytecode, gc_nbytes(fn->bytecode), fn->const_table);
-        mp_printf(&mp_plat_print, "BYTECODE END\n");
-        #endif
-        return total_size;
+        return gc_nbytes(fn) + gc_nbytes(fn->bytecode);
     #if MICROPY_EMIT_NATIVE
     } else if (mp_obj_is_type(obj, &mp_type_fun_native)) {
         return 0;
     #endif
     #if MICROPY_EMIT_NATIVE
-    } else if (mp_obj_is_type(obj, &mp_obj_fun_viper_t)) {
+    } else if (mp_obj_is_type(obj, &mp_type_fun_viper)) {
         return 0;
     #endif
     #if MICROPY_EMIT_THUMB
@@ -195,8 +190,8 @@ static uint32_t type_size(uint8_t indent_level, mp_obj_type_t *type) {
     // // these are for dynamically created types (classes)
     // struct _mp_obj_tuple_t *bases_tuple;
     // struct _mp_obj_dict_t *locals_dict;
-    if (type->locals_dict != NULL) {
-        total_size += dict_size(indent_level, type->locals_dict);
+    if (MP_OBJ_TYPE_HAS_SLOT(type, locals_dict)) {
+        total_size += dict_size(indent_level, MP_OBJ_TYPE_GET_SLOT(type, locals_dict));
     }
 
     indent(indent_level);
@@ -270,3 +265,106 @@ uint32_t shared_module_uheap_info(mp_obj_t obj) {
     }
     return object_size(0, obj);
 }
+
+// Allocation profiler. Every Nth allocation is attributed to the line of
+// Python code that was executing, and kept in a ring of the latest samples.
+
+typedef struct {
+    qstr source_file;
+    uint32_t line;
+    size_t n_bytes;
+} uheap_sample_t;
+
+static uheap_sample_t uheap_samples[CIRCUITPY_UHEAP_PROFILE_SAMPLES];
+// Total number of samples taken since the profiler was started.
+static size_t uheap_sample_count;
+// Sample every Nth allocation; 0 when the profiler is stopped.
+static size_t uheap_sample_every;
+static size_t uheap_sample_countdown;
+
+void uheap_track_allocation(size_t n_bytes) {
+    if (uheap_sample_every == 0 || --uheap_sample_countdown > 0) {
+        return;
+    }
+    uheap_sample_countdown = uheap_sample_every;
+
+    uheap_sample_t *sample = &uheap_samples[uheap_sample_count % CIRCUITPY_UHEAP_PROFILE_SAMPLES];
+    uheap_sample_count++;
+    sample->source_file = MP_QSTRnull;
+    sample->line = 0;
+    sample->n_bytes = n_bytes;
+
+    // Allocations made outside of any bytecode, for example by native code
+    // or the compiler at the top level, have no source line.
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        return;
+    }
+    const byte *ip = code_state->fun_bc->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *line_info_top = ip + n_info;
+    const byte *bytecode_start = ip + n_info + n_cell;
+    ip = mp_decode_uint_skip(ip);
+    for (size_t i = 0; i < n_pos_args + n_kwonly_args; ++i) {
+        ip = mp_decode_uint_skip(ip);
+    }
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    sample->source_file = code_state->fun_bc->context->constants.qstr_table[0];
+    #else
+    sample->source_file = code_state->fun_bc->context->constants.source_file;
+    #endif
+    sample->line = mp_bytecode_get_source_line(ip, line_info_top, code_state->ip - bytecode_start);
+    // Silence unused variable warnings from the prelude decoding macros.
+    (void)n_state;
+    (void)n_exc_stack;
+    (void)scope_flags;
+    (void)n_def_pos_args;
+}
+
+void shared_module_uheap_profile_start(size_t every) {
+    uheap_sample_every = 0;
+    uheap_sample_count = 0;
+    uheap_sample_countdown = every;
+    uheap_sample_every = every;
+}
+
+void shared_module_uheap_profile_stop(void) {
+    uheap_sample_every = 0;
+}
+
+mp_obj_t shared_module_uheap_profile(void) {
+    // Don't sample the allocations made while building the result.
+    size_t every = uheap_sample_every;
+    uheap_sample_every = 0;
+
+    mp_obj_t result = mp_obj_new_dict(0);
+    mp_map_t *map = mp_obj_dict_get_map(result);
+    size_t n_samples = MIN(uheap_sample_count, CIRCUITPY_UHEAP_PROFILE_SAMPLES);
+    for (size_t i = 0; i < n_samples; i++) {
+        const uheap_sample_t *sample = &uheap_samples[i];
+        mp_obj_t key_items[2] = {
+            sample->source_file == MP_QSTRnull ? mp_const_none : MP_OBJ_NEW_QSTR(sample->source_file),
+            mp_obj_new_int_from_uint(sample->line),
+        };
+        mp_obj_t key = mp_obj_new_tuple(2, key_items);
+        mp_map_elem_t *elem = mp_map_lookup(map, key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+        size_t count = 1;
+        size_t n_bytes = sample->n_bytes;
+        if (elem->value != MP_OBJ_NULL) {
+            size_t len;
+            mp_obj_t *value_items;
+            mp_obj_tuple_get(elem->value, &len, &value_items);
+            count += mp_obj_get_int(value_items[0]);
+            n_bytes += mp_obj_get_int(value_items[1]);
+        }
+        mp_obj_t value_items[2] = {
+            mp_obj_new_int_from_uint(count),
+            mp_obj_new_int_from_uint(n_bytes),
+        };
+        elem->value = mp_obj_new_tuple(2, value_items);
+    }
+
+    uheap_sample_every = every;
+    return result;
+}
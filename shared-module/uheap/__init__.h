@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2016 Scott Shawcroft
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stddef.h>
+
+// Number of allocation samples kept by the profiler.
+#ifndef CIRCUITPY_UHEAP_PROFILE_SAMPLES
+#define CIRCUITPY_UHEAP_PROFILE_SAMPLES (64)
+#endif
+
+// Called by the GC for every allocation, to sample it for the profiler.
+void uheap_track_allocation(size_t n_bytes);
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "shared-bindings/usb/core/Device.h"
+#include "shared-bindings/usb/core/Transfer.h"
 
 #include "tusb_config.h"
 
@@ -26,6 +27,7 @@ void tuh_mount_cb(uint8_t dev_addr) {
 
 void tuh_umount_cb(uint8_t dev_addr) {
     _mounted_devices &= ~(1 << dev_addr);
+    usb_core_transfers_device_removed(dev_addr);
 }
 
 static xfer_result_t _xfer_result;
@@ -265,6 +267,25 @@ mp_int_t common_hal_usb_core_device_read(usb_core_device_obj_t *self, mp_int_t e
     return _xfer(&xfer, timeout);
 }
 
+mp_obj_t common_hal_usb_core_device_submit(usb_core_device_obj_t *self, mp_int_t endpoint, mp_obj_t buffer) {
+    if (!_open_endpoint(self, endpoint)) {
+        mp_raise_usb_core_USBError(NULL);
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, (endpoint & TUSB_DIR_IN_MASK) ? MP_BUFFER_WRITE : MP_BUFFER_READ);
+
+    usb_core_transfer_obj_t *transfer = mp_obj_malloc(usb_core_transfer_obj_t, &usb_core_transfer_type);
+    transfer->buffer = buffer;
+    transfer->data = bufinfo.buf;
+    transfer->len = bufinfo.len;
+    transfer->actual_length = 0;
+    transfer->device_number = self->device_number;
+    transfer->endpoint = endpoint;
+    transfer->result = XFER_RESULT_SUCCESS;
+    usb_core_transfer_submit(transfer);
+    return MP_OBJ_FROM_PTR(transfer);
+}
+
 mp_int_t common_hal_usb_core_device_ctrl_transfer(usb_core_device_obj_t *self,
     mp_int_t bmRequestType, mp_int_t bRequest,
     mp_int_t wValue, mp_int_t wIndex,
@@ -0,0 +1,152 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb/core/Transfer.h"
+
+#include "tusb_config.h"
+
+#include "lib/tinyusb/src/host/usbh.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared/runtime/interrupt_char.h"
+#include "shared-bindings/usb/core/__init__.h"
+#include "supervisor/shared/tick.h"
+
+// TinyUSB runs one transfer per endpoint at a time. The rest wait here and the
+// next is started from the completion callback of the one before, without a
+// round trip through Python.
+
+static void _remove(usb_core_transfer_obj_t *transfer) {
+    usb_core_transfer_obj_t **link = (usb_core_transfer_obj_t **)&MP_STATE_VM(usb_core_transfers_linked_list);
+    while (*link != NULL) {
+        if (*link == transfer) {
+            *link = transfer->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    transfer->next = NULL;
+}
+
+static void _finish(usb_core_transfer_obj_t *transfer, xfer_result_t result, uint32_t actual_length) {
+    transfer->actual_length = actual_length;
+    transfer->result = result;
+    _remove(transfer);
+    transfer->state = USB_CORE_TRANSFER_DONE;
+}
+
+static void _start_next(uint8_t device_number, uint8_t endpoint);
+
+static void _transfer_done_cb(tuh_xfer_t *xfer) {
+    // Called from the TinyUSB background task, not an interrupt.
+    usb_core_transfer_obj_t *transfer = (usb_core_transfer_obj_t *)xfer->user_data;
+    _finish(transfer, xfer->result, xfer->actual_len);
+    _start_next(transfer->device_number, transfer->endpoint);
+}
+
+static void _start_next(uint8_t device_number, uint8_t endpoint) {
+    usb_core_transfer_obj_t *transfer = MP_STATE_VM(usb_core_transfers_linked_list);
+    while (transfer != NULL) {
+        if (transfer->device_number == device_number && transfer->endpoint == endpoint) {
+            if (transfer->state == USB_CORE_TRANSFER_ACTIVE) {
+                return;
+            }
+            tuh_xfer_t xfer = {
+                .daddr = device_number,
+                .ep_addr = endpoint,
+                .buffer = transfer->data,
+                .buflen = transfer->len,
+                .complete_cb = _transfer_done_cb,
+                .user_data = (uintptr_t)transfer,
+            };
+            transfer->state = USB_CORE_TRANSFER_ACTIVE;
+            if (tuh_edpt_xfer(&xfer)) {
+                return;
+            }
+            // Busy with a synchronous read() or write(), or the device is gone.
+            usb_core_transfer_obj_t *failed = transfer;
+            transfer = transfer->next;
+            _finish(failed, XFER_RESULT_FAILED, 0);
+            continue;
+        }
+        transfer = transfer->next;
+    }
+}
+
+void usb_core_transfer_submit(usb_core_transfer_obj_t *transfer) {
+    transfer->state = USB_CORE_TRANSFER_QUEUED;
+    transfer->next = NULL;
+    usb_core_transfer_obj_t **link = (usb_core_transfer_obj_t **)&MP_STATE_VM(usb_core_transfers_linked_list);
+    while (*link != NULL) {
+        link = &(*link)->next;
+    }
+    *link = transfer;
+    _start_next(transfer->device_number, transfer->endpoint);
+}
+
+void usb_core_transfers_device_removed(uint8_t device_number) {
+    usb_core_transfer_obj_t *transfer = MP_STATE_VM(usb_core_transfers_linked_list);
+    while (transfer != NULL) {
+        usb_core_transfer_obj_t *next = transfer->next;
+        if (transfer->device_number == device_number) {
+            _finish(transfer, XFER_RESULT_FAILED, 0);
+        }
+        transfer = next;
+    }
+}
+
+void usb_core_transfers_reset(void) {
+    usb_core_transfer_obj_t *transfer = MP_STATE_VM(usb_core_transfers_linked_list);
+    while (transfer != NULL) {
+        if (transfer->state == USB_CORE_TRANSFER_ACTIVE) {
+            tuh_edpt_abort_xfer(transfer->device_number, transfer->endpoint);
+        }
+        transfer = transfer->next;
+    }
+    MP_STATE_VM(usb_core_transfers_linked_list) = NULL;
+}
+
+bool common_hal_usb_core_transfer_get_done(usb_core_transfer_obj_t *self) {
+    return self->state == USB_CORE_TRANSFER_DONE;
+}
+
+mp_int_t common_hal_usb_core_transfer_wait(usb_core_transfer_obj_t *self, mp_int_t timeout) {
+    uint32_t start_time = supervisor_ticks_ms32();
+    while (self->state != USB_CORE_TRANSFER_DONE) {
+        if (mp_hal_is_interrupted()) {
+            return 0;
+        }
+        if (timeout != 0 && supervisor_ticks_ms32() - start_time >= (uint32_t)timeout) {
+            // The transfer stays queued so it can be waited on again.
+            mp_raise_usb_core_USBTimeoutError();
+        }
+        // The background tasks include TinyUSB, which finishes transfers.
+        RUN_BACKGROUND_TASKS;
+    }
+    if (self->result == XFER_RESULT_STALLED) {
+        mp_raise_usb_core_USBError(MP_ERROR_TEXT("Pipe error"));
+    }
+    if (self->result == XFER_RESULT_SUCCESS) {
+        return self->actual_length;
+    }
+    return 0;
+}
+
+void common_hal_usb_core_transfer_cancel(usb_core_transfer_obj_t *self) {
+    if (self->state == USB_CORE_TRANSFER_DONE) {
+        return;
+    }
+    bool was_active = self->state == USB_CORE_TRANSFER_ACTIVE;
+    if (was_active) {
+        tuh_edpt_abort_xfer(self->device_number, self->endpoint);
+    }
+    _finish(self, XFER_RESULT_FAILED, 0);
+    if (was_active) {
+        _start_next(self->device_number, self->endpoint);
+    }
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t usb_core_transfers_linked_list);
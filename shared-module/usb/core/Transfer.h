@@ -0,0 +1,37 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+enum {
+    USB_CORE_TRANSFER_QUEUED,
+    USB_CORE_TRANSFER_ACTIVE,
+    USB_CORE_TRANSFER_DONE,
+};
+
+typedef struct usb_core_transfer_obj {
+    mp_obj_base_t base;
+    // Queued and active transfers are linked in submission order.
+    struct usb_core_transfer_obj *next;
+    // Keeps the buffer alive until the transfer is done.
+    mp_obj_t buffer;
+    uint8_t *data;
+    uint32_t len;
+    volatile uint32_t actual_length;
+    uint8_t device_number;
+    uint8_t endpoint;
+    volatile uint8_t state;
+    volatile uint8_t result;  // xfer_result_t, once done
+} usb_core_transfer_obj_t;
+
+// Queue transfer and start it if its endpoint is idle.
+void usb_core_transfer_submit(usb_core_transfer_obj_t *transfer);
+// Finish every transfer to a device that was unplugged.
+void usb_core_transfers_device_removed(uint8_t device_number);
+// Stop all transfers before the heap goes away.
+void usb_core_transfers_reset(void);
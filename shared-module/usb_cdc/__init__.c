@@ -339,7 +339,11 @@ static const uint8_t usb_vendor_descriptor_template[] = {
     0xFF,        // 18 bEndpointAddress (IN/D2H) [SET AT RUNTIME: 0x80 | number]
 #define VENDOR_IN_ENDPOINT_INDEX 18
     0x02,        // 19 bmAttributes (Bulk)
+    #if USB_HIGHSPEED
+    0x00, 0x02,  // 20,21  wMaxPacketSize 512
+    #else
     0x40, 0x00,  // 20, 21 wMaxPacketSize 64
+    #endif
     0x0          // 22  bInterval 0
 };
 
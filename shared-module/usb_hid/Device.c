@@ -199,28 +199,52 @@ uint16_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self) {
     return self->usage;
 }
 
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id) {
+bool common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id, bool wait) {
     // report_id and len have already been validated for this device.
     size_t id_idx = get_report_id_idx(self, report_id);
 
     mp_arg_validate_length(len, self->in_report_lengths[id_idx], MP_QSTR_report);
 
-    // Wait until interface is ready, timeout = 2 seconds
     uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
-    while ((supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready()) {
+
+    if (usb_hid_report_queue_enabled()) {
+        if (tud_suspended()) {
+            tud_remote_wakeup();
+            return false;
+        }
+        // Wait for a free slot, timeout = 2 seconds
+        while (!usb_hid_report_queue_push(report_id, report, len)) {
+            if (!wait) {
+                return false;
+            }
+            if (supervisor_ticks_ms64() >= end_ticks) {
+                mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB busy"));
+            }
+            RUN_BACKGROUND_TASKS;
+        }
+        return true;
+    }
+
+    // Wait until interface is ready, timeout = 2 seconds
+    while (wait && (supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready()) {
         RUN_BACKGROUND_TASKS;
     }
 
     if (!tud_suspended()) {
         if (!tud_hid_ready()) {
+            if (!wait) {
+                return false;
+            }
             mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB busy"));
         }
 
         if (!tud_hid_report(report_id, report, len)) {
             mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB error"));
         }
+        return true;
     } else {
         tud_remote_wakeup();
+        return false;
     }
 }
 
@@ -7,6 +7,9 @@
 #include <string.h>
 
 #include "tusb.h"
+#if CFG_TUSB_OS == OPT_OS_FREERTOS
+#include "device/usbd_pvt.h"
+#endif
 
 #include "py/gc.h"
 #include "py/runtime.h"
@@ -46,6 +49,7 @@ static const uint8_t usb_hid_descriptor_template[] = {
     0x03,        // 21 bmAttributes (Interrupt)
     0x40, 0x00,  // 22,23  wMaxPacketSize 64
     0x08,        // 24 bInterval 8 (unit depends on device speed)
+#define HID_IN_INTERVAL_INDEX (24)
 
     0x07,        // 25 bLength
     0x05,        // 26 bDescriptorType (Endpoint)
@@ -54,6 +58,7 @@ static const uint8_t usb_hid_descriptor_template[] = {
     0x03,        // 28 bmAttributes (Interrupt)
     0x40, 0x00,  // 29,30 wMaxPacketSize 64
     0x08,        // 31 bInterval 8 (unit depends on device speed)
+#define HID_OUT_INTERVAL_INDEX (31)
 };
 
 #define MAX_HID_DEVICES 8
@@ -71,6 +76,19 @@ static uint8_t hid_boot_device;
 // Whether a boot device was requested by a SET_PROTOCOL request from the host.
 static bool hid_boot_device_requested;
 
+// bInterval for both endpoints, or 0 to keep the template's. Set by usb_hid.enable().
+static uint8_t hid_interval;
+
+// IN reports queued by send_report() and sent one per poll as the host takes them.
+// The queue is allocated outside the VM heap when USB starts, so it has one free
+// slot beyond hid_report_queue_depth to tell full from empty.
+// Each entry is: report length, report id, report bytes.
+static uint8_t hid_report_queue_depth;
+static uint8_t *hid_report_queue;
+static size_t hid_report_queue_entry_size;
+static volatile uint8_t hid_report_queue_head;
+static volatile uint8_t hid_report_queue_tail;
+
 // This tuple is store in usb_hid.devices.
 static mp_obj_tuple_t *hid_devices_tuple;
 
@@ -135,7 +153,7 @@ void usb_hid_set_defaults(void) {
     hid_boot_device = 0;
     hid_boot_device_requested = false;
     common_hal_usb_hid_enable(
-        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0);
+        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0, 0, 0);
 }
 
 // This is the interface descriptor, not the report descriptor.
@@ -183,6 +201,11 @@ size_t usb_hid_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *desc
     descriptor_counts->num_out_endpoints++;
     descriptor_counts->current_endpoint++;
 
+    if (hid_interval != 0) {
+        descriptor_buf[HID_IN_INTERVAL_INDEX] = hid_interval;
+        descriptor_buf[HID_OUT_INTERVAL_INDEX] = hid_interval;
+    }
+
     return sizeof(usb_hid_descriptor_template);
 }
 
@@ -200,10 +223,25 @@ static void usb_hid_set_devices_from_hid_devices(void) {
 }
 
 bool common_hal_usb_hid_disable(void) {
-    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0);
+    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0, 0, 0);
+}
+
+// Shortest bInterval whose polling period is no longer than interval_us.
+static uint8_t interval_for_us(uint32_t interval_us) {
+    #if USB_HIGHSPEED
+    // 2**(bInterval - 1) microframes of 125 us each.
+    uint8_t interval = 1;
+    while (interval < 16 && (125u << interval) <= interval_us) {
+        interval++;
+    }
+    return interval;
+    #else
+    // Frames of 1 ms each.
+    return MAX(1, MIN(255, interval_us / 1000));
+    #endif
 }
 
-bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
+bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device, uint8_t report_queue_depth, uint32_t poll_interval_us) {
     // We can't change the devices once we're connected.
     if (tud_connected()) {
         return false;
@@ -215,6 +253,8 @@ bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
     num_hid_devices = num_devices;
 
     hid_boot_device = boot_device;
+    hid_report_queue_depth = report_queue_depth;
+    hid_interval = poll_interval_us == 0 ? 0 : interval_for_us(poll_interval_us);
 
     // Remember the devices in static storage so they live across VMs.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
@@ -285,6 +325,60 @@ void usb_hid_build_report_descriptor(void) {
         // We don't need it any more and it will get lost when the heap goes away.
         device->report_descriptor = NULL;
     }
+
+    if (hid_report_queue_depth > 0) {
+        // Boot keyboard reports are the longest a boot device can send.
+        size_t max_report_length = 8;
+        for (mp_int_t i = 0; i < num_hid_devices; i++) {
+            for (size_t id_idx = 0; id_idx < hid_devices[i].num_report_ids; id_idx++) {
+                max_report_length = MAX(max_report_length, hid_devices[i].in_report_lengths[id_idx]);
+            }
+        }
+        hid_report_queue_entry_size = 2 + max_report_length;
+        hid_report_queue = port_malloc((hid_report_queue_depth + 1) * hid_report_queue_entry_size, false);
+        hid_report_queue_head = 0;
+        hid_report_queue_tail = 0;
+    }
+}
+
+bool usb_hid_report_queue_enabled(void) {
+    return hid_report_queue != NULL;
+}
+
+// Start sending the oldest queued report if the IN endpoint is free. TinyUSB
+// copies the report, so its slot is free as soon as the transfer starts.
+static void usb_hid_report_queue_send_next(void *param) {
+    (void)param;
+    uint8_t head = hid_report_queue_head;
+    if (head == hid_report_queue_tail || !tud_hid_ready()) {
+        return;
+    }
+    uint8_t *entry = hid_report_queue + head * hid_report_queue_entry_size;
+    if (tud_hid_report(entry[1], entry + 2, entry[0])) {
+        hid_report_queue_head = head == hid_report_queue_depth ? 0 : head + 1;
+    }
+}
+
+bool usb_hid_report_queue_push(uint8_t report_id, const uint8_t *report, uint8_t len) {
+    uint8_t tail = hid_report_queue_tail;
+    uint8_t next_tail = tail == hid_report_queue_depth ? 0 : tail + 1;
+    if (next_tail == hid_report_queue_head) {
+        return false;
+    }
+    uint8_t *entry = hid_report_queue + tail * hid_report_queue_entry_size;
+    entry[0] = len;
+    entry[1] = report_id;
+    memcpy(entry + 2, report, len);
+    hid_report_queue_tail = next_tail;
+
+    #if CFG_TUSB_OS == OPT_OS_FREERTOS
+    // TinyUSB runs in its own task. Only ever send from there so that a report
+    // is never started twice.
+    usbd_defer_func(usb_hid_report_queue_send_next, NULL, false);
+    #else
+    usb_hid_report_queue_send_next(NULL);
+    #endif
+    return true;
 }
 
 void usb_hid_gc_collect(void) {
@@ -327,6 +421,13 @@ uint8_t const *tud_hid_descriptor_report_cb(uint8_t itf) {
     return (uint8_t *)hid_report_descriptor;
 }
 
+// Invoked when the host has taken an IN report, so the next queued one can go in the same poll slot.
+void tud_hid_report_complete_cb(uint8_t instance, uint8_t const *report, uint16_t len) {
+    if (hid_report_queue != NULL) {
+        usb_hid_report_queue_send_next(NULL);
+    }
+}
+
 // Callback invoked when we receive a SET_PROTOCOL request.
 // Protocol is either HID_PROTOCOL_BOOT (0) or HID_PROTOCOL_REPORT (1)
 void tud_hid_set_protocol_cb(uint8_t instance, uint8_t protocol) {
@@ -26,3 +26,6 @@ void usb_hid_build_report_descriptor(void);
 bool usb_hid_get_device_with_report_id(uint8_t report_id, usb_hid_device_obj_t **device_out, size_t *id_idx_out);
 
 void usb_hid_gc_collect(void);
+
+bool usb_hid_report_queue_enabled(void);
+bool usb_hid_report_queue_push(uint8_t report_id, const uint8_t *report, uint8_t len);
@@ -0,0 +1,42 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb_vendor/Bulk.h"
+
+#include "tusb.h"
+
+size_t common_hal_usb_vendor_bulk_readinto(usb_vendor_bulk_obj_t *self, uint8_t *data, size_t len) {
+    if (!tud_vendor_n_mounted(self->idx)) {
+        return 0;
+    }
+    return tud_vendor_n_read(self->idx, data, len);
+}
+
+size_t common_hal_usb_vendor_bulk_write(usb_vendor_bulk_obj_t *self, const uint8_t *data, size_t len) {
+    if (!tud_vendor_n_mounted(self->idx)) {
+        return 0;
+    }
+    // Queue what fits and start sending it right away. TinyUSB moves the FIFO
+    // into the endpoint in max size packets while Python fills it again.
+    uint32_t num_written = tud_vendor_n_write(self->idx, data, len);
+    tud_vendor_n_write_flush(self->idx);
+    return num_written;
+}
+
+uint32_t common_hal_usb_vendor_bulk_get_in_waiting(usb_vendor_bulk_obj_t *self) {
+    return tud_vendor_n_mounted(self->idx) ? tud_vendor_n_available(self->idx) : 0;
+}
+
+uint32_t common_hal_usb_vendor_bulk_get_out_waiting(usb_vendor_bulk_obj_t *self) {
+    if (!tud_vendor_n_mounted(self->idx)) {
+        return 0;
+    }
+    return CFG_TUD_VENDOR_TX_BUFSIZE - tud_vendor_n_write_available(self->idx);
+}
+
+bool common_hal_usb_vendor_bulk_get_connected(usb_vendor_bulk_obj_t *self) {
+    return tud_vendor_n_mounted(self->idx);
+}
@@ -0,0 +1,133 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "shared-bindings/usb_vendor/__init__.h"
+#include "shared-bindings/usb_vendor/Bulk.h"
+#include "supervisor/usb.h"
+
+#if CIRCUITPY_USB_VENDOR
+#include "shared-module/usb_cdc/__init__.h"
+#endif
+
+#include "tusb.h"
+
+static const uint8_t usb_vendor_bulk_descriptor_template[] = {
+    // Vendor Interface Descriptor
+    0x09,        // 0 bLength
+    0x04,        // 1 bDescriptorType (Interface)
+    0xFF,        // 2 bInterfaceNumber  [SET AT RUNTIME]
+#define BULK_INTERFACE_INDEX 2
+    0x00,        // 3 bAlternateSetting
+    0x02,        // 4 bNumEndpoints 2
+    0xFF,        // 5 bInterfaceClass: Vendor Specific
+    0x00,        // 6 bInterfaceSubClass: NONE
+    0x00,        // 7 bInterfaceProtocol: NONE
+    0xFF,        // 8 iInterface (String Index)
+#define BULK_INTERFACE_STRING_INDEX 8
+
+    // Bulk OUT Endpoint Descriptor
+    0x07,        // 9 bLength
+    0x05,        // 10 bDescriptorType (Endpoint)
+    0xFF,        // 11 bEndpointAddress (OUT/H2D) [SET AT RUNTIME: number]
+#define BULK_OUT_ENDPOINT_INDEX 11
+    0x02,        // 12 bmAttributes (Bulk)
+    #if USB_HIGHSPEED
+    0x00, 0x02,  // 13,14  wMaxPacketSize 512
+    #else
+    0x40, 0x00,  // 13,14  wMaxPacketSize 64
+    #endif
+    0x00,        // 15  bInterval 0
+
+    // Bulk IN Endpoint Descriptor
+    0x07,        // 16 bLength
+    0x05,        // 17 bDescriptorType (Endpoint)
+    0xFF,        // 18 bEndpointAddress (IN/D2H) [SET AT RUNTIME: 0x80 | number]
+#define BULK_IN_ENDPOINT_INDEX 18
+    0x02,        // 19 bmAttributes (Bulk)
+    #if USB_HIGHSPEED
+    0x00, 0x02,  // 20,21  wMaxPacketSize 512
+    #else
+    0x40, 0x00,  // 20,21  wMaxPacketSize 64
+    #endif
+    0x00,        // 22  bInterval 0
+};
+
+static const char bulk_interface_name[] = USB_INTERFACE_NAME " Bulk";
+
+// .idx is set when the descriptor is built.
+static usb_vendor_bulk_obj_t usb_vendor_bulk_obj = {
+    .base.type = &usb_vendor_bulk_type,
+};
+
+static bool usb_vendor_bulk_is_enabled;
+
+void usb_vendor_bulk_set_defaults(void) {
+    common_hal_usb_vendor_disable();
+}
+
+bool usb_vendor_bulk_enabled(void) {
+    return usb_vendor_bulk_is_enabled;
+}
+
+size_t usb_vendor_bulk_descriptor_length(void) {
+    return sizeof(usb_vendor_bulk_descriptor_template);
+}
+
+size_t usb_vendor_bulk_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
+    memcpy(descriptor_buf, usb_vendor_bulk_descriptor_template, sizeof(usb_vendor_bulk_descriptor_template));
+
+    // TinyUSB numbers vendor interfaces in descriptor order, and the WebUSB
+    // serial interface comes first when it is present.
+    usb_vendor_bulk_obj.idx = 0;
+    #if CIRCUITPY_USB_VENDOR
+    if (usb_vendor_enabled()) {
+        usb_vendor_bulk_obj.idx = 1;
+    }
+    #endif
+
+    descriptor_buf[BULK_INTERFACE_INDEX] = descriptor_counts->current_interface;
+    descriptor_counts->current_interface++;
+
+    descriptor_buf[BULK_IN_ENDPOINT_INDEX] = 0x80 | descriptor_counts->current_endpoint;
+    descriptor_counts->num_in_endpoints++;
+    // Some TinyUSB devices have issues with bi-directional endpoints
+    #ifdef TUD_ENDPOINT_ONE_DIRECTION_ONLY
+    descriptor_counts->current_endpoint++;
+    #endif
+    descriptor_buf[BULK_OUT_ENDPOINT_INDEX] = descriptor_counts->current_endpoint;
+    descriptor_counts->num_out_endpoints++;
+    descriptor_counts->current_endpoint++;
+
+    usb_add_interface_string(*current_interface_string, bulk_interface_name);
+    descriptor_buf[BULK_INTERFACE_STRING_INDEX] = *current_interface_string;
+    (*current_interface_string)++;
+
+    return sizeof(usb_vendor_bulk_descriptor_template);
+}
+
+bool common_hal_usb_vendor_disable(void) {
+    // We can't change the descriptors once we're connected.
+    if (tud_connected()) {
+        return false;
+    }
+    usb_vendor_bulk_is_enabled = false;
+    usb_vendor_set_bulk(mp_const_none);
+    return true;
+}
+
+bool common_hal_usb_vendor_enable(void) {
+    // We can't change the descriptors once we're connected.
+    if (tud_connected()) {
+        return false;
+    }
+    usb_vendor_bulk_is_enabled = true;
+    usb_vendor_set_bulk(MP_OBJ_FROM_PTR(&usb_vendor_bulk_obj));
+    return true;
+}
@@ -0,0 +1,16 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/mpconfig.h"
+#include "supervisor/usb.h"
+
+bool usb_vendor_bulk_enabled(void);
+void usb_vendor_bulk_set_defaults(void);
+
+size_t usb_vendor_bulk_descriptor_length(void);
+size_t usb_vendor_bulk_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string);
@@ -19,7 +19,15 @@ void shared_module_usb_video_uvcframebuffer_get_bufinfo(usb_video_uvcframebuffer
 }
 
 void shared_module_usb_video_uvcframebuffer_refresh(usb_video_uvcframebuffer_obj_t *self) {
-    shared_module_usb_video_swapbuffers();
+    shared_module_usb_video_swapbuffers(NULL);
+}
+
+void shared_module_usb_video_uvcframebuffer_swapbuffers(usb_video_uvcframebuffer_obj_t *self, uint8_t *dirty_row_bitmap) {
+    shared_module_usb_video_swapbuffers(dirty_row_bitmap);
+}
+
+int shared_module_usb_video_uvcframebuffer_get_frame_rate(usb_video_uvcframebuffer_obj_t *self) {
+    return usb_video_frame_rate;
 }
 
 int shared_module_usb_video_uvcframebuffer_get_width(usb_video_uvcframebuffer_obj_t *self) {
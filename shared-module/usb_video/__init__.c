@@ -4,12 +4,14 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/mpstate.h"
 #include "py/runtime.h"
 #include <stdint.h>
 #include "class/video/video_device.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/usb_video/__init__.h"
 #include "shared-module/bitmapfilter/macros.h"
+#include "shared/runtime/interrupt_char.h"
 #include "shared-module/usb_video/__init__.h"
 #include "shared-module/usb_video/uvc_usb_descriptors.h"
 #include "supervisor/background_callback.h"
@@ -17,18 +19,39 @@
 #include "device/usbd.h"
 
 static bool do_convert = true;
+// The back buffer holds a converted frame that hasn't been sent yet.
+static bool frame_ready = false;
 static unsigned frame_num = 0;
 static unsigned tx_busy = 0;
 static unsigned interval_ms = 1000 / DEFAULT_FRAME_RATE;
 
-// TODO must dynamically allocate this, otherwise everyone pays for it
-static uint8_t *frame_buffer_yuyv;
+// With double buffering, frames are converted into the back buffer while the
+// front one is being sent. Otherwise both refer to the same buffer.
+static uint8_t *frame_buffer_yuyv[2];
+// One bit per row, set for rows of each YUY2 buffer that are older than the
+// same row of the RGB565 framebuffer.
+static uint8_t *frame_buffer_dirty_rows[2];
+static uint8_t frame_buffer_count;
+static uint8_t front_buffer, back_buffer;
 uint16_t *usb_video_framebuffer_rgb565;
 
+// A frame passed to send(). It is sent as is, instead of the framebuffer.
+static const uint8_t *user_frame;
+static bool user_frame_sending;
+
 static bool usb_video_is_enabled = false;
 uint16_t usb_video_frame_width, usb_video_frame_height;
+uint8_t usb_video_frame_rate = DEFAULT_FRAME_RATE;
+
+static size_t frame_size(void) {
+    return usb_video_frame_width * usb_video_frame_height * 2;
+}
+
+static size_t dirty_rows_size(void) {
+    return (usb_video_frame_height + 7) / 8;
+}
 
-bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height) {
+bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height, mp_int_t frame_rate, bool double_buffered) {
     if (tud_connected()) {
         return false;
     }
@@ -43,20 +66,35 @@ bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height)
 
     usb_video_frame_width = frame_width;
     usb_video_frame_height = frame_height;
-
-    size_t framebuffer_size = usb_video_frame_width * usb_video_frame_height * 2;
-    frame_buffer_yuyv = port_malloc(framebuffer_size, false);
+    usb_video_frame_rate = frame_rate;
+    interval_ms = 1000 / frame_rate;
+
+    size_t framebuffer_size = frame_size();
+    frame_buffer_count = double_buffered ? 2 : 1;
+    bool allocated = true;
+    for (int i = 0; i < frame_buffer_count; i++) {
+        frame_buffer_yuyv[i] = port_malloc(framebuffer_size, false);
+        frame_buffer_dirty_rows[i] = port_malloc(dirty_rows_size(), false);
+        allocated = allocated && frame_buffer_yuyv[i] && frame_buffer_dirty_rows[i];
+    }
     uint32_t *frame_buffer_rgb565_uint32 = port_malloc(framebuffer_size, false);
     usb_video_framebuffer_rgb565 = (uint16_t *)frame_buffer_rgb565_uint32;
 
-    if (!frame_buffer_yuyv || !usb_video_framebuffer_rgb565) {
-        // this will free either of the buffers allocated just above, in
-        // case one succeeded and the other failed.
+    if (!allocated || !usb_video_framebuffer_rgb565) {
+        // this will free any of the buffers allocated just above, in
+        // case some succeeded and others failed.
         shared_module_usb_video_disable();
-        m_malloc_fail(2 * framebuffer_size);
+        m_malloc_fail((frame_buffer_count + 1) * framebuffer_size);
+    }
+    for (int i = 0; i < frame_buffer_count; i++) {
+        memset(frame_buffer_yuyv[i], 0, framebuffer_size);
+        memset(frame_buffer_dirty_rows[i], 0xff, dirty_rows_size());
     }
-    memset(frame_buffer_yuyv, 0, framebuffer_size);
     memset(usb_video_framebuffer_rgb565, 0, framebuffer_size);
+    front_buffer = 0;
+    back_buffer = frame_buffer_count - 1;
+    do_convert = true;
+    frame_ready = false;
 
     usb_video_is_enabled = true;
 
@@ -68,9 +106,13 @@ bool shared_module_usb_video_disable(void) {
         return false;
     }
     usb_video_is_enabled = false;
-    port_free(frame_buffer_yuyv);
+    for (int i = 0; i < 2; i++) {
+        port_free(frame_buffer_yuyv[i]);
+        port_free(frame_buffer_dirty_rows[i]);
+        frame_buffer_yuyv[i] = NULL;
+        frame_buffer_dirty_rows[i] = NULL;
+    }
     port_free(usb_video_framebuffer_rgb565);
-    frame_buffer_yuyv = NULL;
     usb_video_framebuffer_rgb565 = NULL;
     return true;
 }
@@ -87,18 +129,10 @@ size_t usb_video_descriptor_length(void) {
     #endif
 }
 
-static void convert_framebuffer_maybe(void) {
-    if (!do_convert) {
-        return; // new data not ready yet
-    }
-    do_convert = false; // assumes this happens via background, not interrupt
-
-    uint8_t *dest = frame_buffer_yuyv;
-    uint16_t *src = usb_video_framebuffer_rgb565;
-
-    for (int i = 0; i < usb_video_frame_width * usb_video_frame_height / 2; i++) {
-        uint16_t p1 = IMAGE_GET_RGB565_PIXEL_FAST(src, 0);
-        uint16_t p2 = IMAGE_GET_RGB565_PIXEL_FAST(src, 1);
+static void convert_row(uint8_t *dest, const uint16_t *src, bool swapped) {
+    for (int i = 0; i < usb_video_frame_width / 2; i++) {
+        uint16_t p1 = swapped ? IMAGE_GET_RGB565_PIXEL_FAST(src, 0) : src[0];
+        uint16_t p2 = swapped ? IMAGE_GET_RGB565_PIXEL_FAST(src, 1) : src[1];
         src += 2;
 
         int y1 = COLOR_RGB565_TO_Y(p1);
@@ -116,17 +150,96 @@ static void convert_framebuffer_maybe(void) {
     }
 }
 
-void shared_module_usb_video_swapbuffers(void) {
+static void convert_framebuffer_maybe(void) {
+    if (!do_convert) {
+        return; // new data not ready yet
+    }
+    if (back_buffer == front_buffer && tx_busy) {
+        return; // the only buffer is still being sent
+    }
+    do_convert = false; // assumes this happens via background, not interrupt
+
+    // Only rows that changed since this buffer was last converted.
+    uint8_t *dirty = frame_buffer_dirty_rows[back_buffer];
+    uint8_t *dest = frame_buffer_yuyv[back_buffer];
+    for (int y = 0; y < usb_video_frame_height; y++) {
+        if (dirty[y / 8] & (1 << (y & 7))) {
+            convert_row(dest + y * usb_video_frame_width * 2, usb_video_framebuffer_rgb565 + y * usb_video_frame_width, true);
+        }
+    }
+    memset(dirty, 0, dirty_rows_size());
+    frame_ready = true;
+}
+
+static void mark_rows_dirty(const uint8_t *dirty_row_bitmap) {
+    for (int i = 0; i < frame_buffer_count; i++) {
+        for (size_t j = 0; j < dirty_rows_size(); j++) {
+            frame_buffer_dirty_rows[i][j] |= dirty_row_bitmap ? dirty_row_bitmap[j] : 0xff;
+        }
+    }
+}
+
+void shared_module_usb_video_swapbuffers(const uint8_t *dirty_row_bitmap) {
+    mark_rows_dirty(dirty_row_bitmap);
     do_convert = true;
 }
 
+static void drop_user_frame(void) {
+    user_frame = NULL;
+    user_frame_sending = false;
+    MP_STATE_VM(usb_video_user_frame) = MP_OBJ_NULL;
+}
+
+bool shared_module_usb_video_get_busy(void) {
+    return user_frame != NULL;
+}
+
+static void wait_while(bool (*busy)(void)) {
+    while (busy() && tud_video_n_streaming(0, 0)) {
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return;
+        }
+    }
+}
+
+void shared_module_usb_video_send(mp_obj_t frame_obj, const uint8_t *frame) {
+    wait_while(shared_module_usb_video_get_busy);
+    if (!tud_video_n_streaming(0, 0)) {
+        // Nothing is receiving, so there is nothing to send to.
+        return;
+    }
+    MP_STATE_VM(usb_video_user_frame) = frame_obj;
+    user_frame = frame;
+}
+
+static bool only_buffer_busy(void) {
+    return back_buffer == front_buffer && tx_busy;
+}
+
+void shared_module_usb_video_send_bitmap(displayio_bitmap_t *bitmap, bool swapped) {
+    wait_while(only_buffer_busy);
+    uint8_t *dest = frame_buffer_yuyv[back_buffer];
+    for (int y = 0; y < usb_video_frame_height; y++) {
+        convert_row(dest + y * usb_video_frame_width * 2, (uint16_t *)(bitmap->data + y * bitmap->stride), swapped);
+    }
+    // The framebuffer is shown again once it is refreshed, in full.
+    mark_rows_dirty(NULL);
+    do_convert = false;
+    frame_ready = true;
+}
+
+void usb_video_reset(void) {
+    drop_user_frame();
+}
+
 size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
     usb_add_interface_string(*current_interface_string, "CircuitPython UVC");
     const uint8_t usb_video_descriptor[] = {
         #if CFG_TUD_VIDEO_STREAMING_BULK
-        TUD_VIDEO_CAPTURE_DESCRIPTOR_UNCOMPR_BULK(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, DEFAULT_FRAME_RATE, 64, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
+        TUD_VIDEO_CAPTURE_DESCRIPTOR_UNCOMPR_BULK(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, usb_video_frame_rate, 64, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
         #else
-        TUD_VIDEO_CAPTURE_DESCRIPTOR_UNCOMPR(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, DEFAULT_FRAME_RATE, CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
+        TUD_VIDEO_CAPTURE_DESCRIPTOR_UNCOMPR(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, usb_video_frame_rate, CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
         #endif
     };
     (*current_interface_string)++;
@@ -142,6 +255,26 @@ size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *de
 
 background_callback_t usb_video_cb;
 
+static void send_next_frame(void) {
+    const uint8_t *frame;
+    bool sending_user_frame = user_frame != NULL;
+    if (sending_user_frame) {
+        frame = user_frame;
+    } else {
+        convert_framebuffer_maybe();
+        if (frame_ready) {
+            front_buffer = back_buffer;
+            back_buffer = (front_buffer + 1) % frame_buffer_count;
+            frame_ready = false;
+        }
+        frame = frame_buffer_yuyv[front_buffer];
+    }
+    if (tud_video_n_frame_xfer(0, 0, (void *)frame, frame_size())) {
+        tx_busy = 1;
+        user_frame_sending = sending_user_frame;
+    }
+}
+
 static void usb_video_cb_fun(void *unused) {
     (void)unused;
 
@@ -151,15 +284,20 @@ static void usb_video_cb_fun(void *unused) {
     if (!tud_video_n_streaming(0, 0)) {
         already_sent = 0;
         frame_num = 0;
+        tx_busy = 0;
+        drop_user_frame();
         return;
     }
 
+    if (frame_buffer_count > 1) {
+        // The back buffer isn't being sent, so convert into it right away.
+        convert_framebuffer_maybe();
+    }
+
     if (!already_sent) {
         already_sent = 1;
         start_ms = supervisor_ticks_ms32();
-        convert_framebuffer_maybe();
-        bool result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
-        (void)result;
+        send_next_frame();
     }
 
     unsigned cur = supervisor_ticks_ms32();
@@ -173,9 +311,7 @@ static void usb_video_cb_fun(void *unused) {
     }
     start_ms += interval_ms;
 
-    convert_framebuffer_maybe();
-    bool result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
-    (void)result;
+    send_next_frame();
 }
 
 
@@ -190,6 +326,9 @@ void tud_video_frame_xfer_complete_cb(uint_fast8_t ctl_idx, uint_fast8_t stm_idx
     (void)stm_idx;
     usb_video_task();
     tx_busy = 0;
+    if (user_frame_sending) {
+        drop_user_frame();
+    }
     /* flip buffer */
     ++frame_num;
 }
@@ -202,3 +341,5 @@ int tud_video_commit_cb(uint_fast8_t ctl_idx, uint_fast8_t stm_idx,
     interval_ms = parameters->dwFrameInterval / 10000;
     return VIDEO_ERROR_NONE;
 }
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t usb_video_user_frame);
@@ -16,6 +16,8 @@ bool usb_video_enabled(void);
 size_t usb_video_descriptor_length(void);
 size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string);
 void usb_video_task(void);
+void usb_video_reset(void);
 
 extern uint16_t usb_video_frame_width, usb_video_frame_height;
+extern uint8_t usb_video_frame_rate;
 extern uint16_t *usb_video_framebuffer_rgb565;
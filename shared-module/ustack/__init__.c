@@ -5,11 +5,14 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/mpstate.h"
+#include "py/runtime.h"
 #include "py/stackctrl.h"
 
 #include "shared-bindings/ustack/__init__.h"
+#include "shared-module/ustack/__init__.h"
 
 #if MICROPY_MAX_STACK_USAGE
 uint32_t shared_module_ustack_max_stack_usage(void) {
@@ -30,3 +33,126 @@ uint32_t shared_module_ustack_stack_size() {
 uint32_t shared_module_ustack_stack_usage() {
     return mp_stack_usage();
 }
+
+#if MICROPY_ENABLE_PYSTACK
+#if MICROPY_MAX_STACK_USAGE
+uint32_t shared_module_ustack_max_pystack_usage(void) {
+    return MP_STATE_THREAD(pystack_max) - MP_STATE_THREAD(pystack_start);
+}
+#endif
+
+uint32_t shared_module_ustack_pystack_size(void) {
+    return MP_STATE_THREAD(pystack_end) - MP_STATE_THREAD(pystack_start);
+}
+
+uint32_t shared_module_ustack_pystack_usage(void) {
+    return mp_pystack_usage();
+}
+#endif
+
+// Stack profiler. Every call to a bytecode function notes how much C stack and
+// pystack were in use once the function's frame was set up, and keeps the
+// deepest of each per function. Functions are keyed by name rather than by
+// address, because function objects may be freed and their memory reused.
+
+typedef struct {
+    qstr source_file;
+    qstr name;
+    uint32_t max_stack;
+    uint32_t max_pystack;
+} ustack_entry_t;
+
+bool ustack_profiling;
+static ustack_entry_t ustack_entries[CIRCUITPY_USTACK_PROFILE_FUNCTIONS];
+// Depths of calls to functions that didn't fit in ustack_entries.
+static ustack_entry_t ustack_overflow;
+
+static void update_entry(ustack_entry_t *entry, uint32_t stack, uint32_t pystack) {
+    entry->max_stack = MAX(entry->max_stack, stack);
+    entry->max_pystack = MAX(entry->max_pystack, pystack);
+}
+
+void ustack_record_call(const mp_obj_fun_bc_t *fun) {
+    uint32_t stack = mp_stack_usage();
+    #if MICROPY_ENABLE_PYSTACK
+    uint32_t pystack = mp_pystack_usage();
+    #else
+    uint32_t pystack = 0;
+    #endif
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    qstr source_file = fun->context->constants.qstr_table[0];
+    #else
+    qstr source_file = fun->context->constants.source_file;
+    #endif
+    qstr name = mp_obj_fun_get_name(MP_OBJ_FROM_PTR(fun));
+
+    // Open addressing with linear probing, keyed on the function's name.
+    size_t start = (name ^ (source_file << 5)) % CIRCUITPY_USTACK_PROFILE_FUNCTIONS;
+    for (size_t i = 0; i < CIRCUITPY_USTACK_PROFILE_FUNCTIONS; i++) {
+        ustack_entry_t *entry = &ustack_entries[(start + i) % CIRCUITPY_USTACK_PROFILE_FUNCTIONS];
+        if (entry->name == MP_QSTRnull) {
+            entry->source_file = source_file;
+            entry->name = name;
+        } else if (entry->name != name || entry->source_file != source_file) {
+            continue;
+        }
+        update_entry(entry, stack, pystack);
+        return;
+    }
+    update_entry(&ustack_overflow, stack, pystack);
+}
+
+void shared_module_ustack_profile_start(void) {
+    ustack_profiling = false;
+    memset(ustack_entries, 0, sizeof(ustack_entries));
+    memset(&ustack_overflow, 0, sizeof(ustack_overflow));
+    ustack_profiling = true;
+}
+
+void shared_module_ustack_profile_stop(void) {
+    ustack_profiling = false;
+}
+
+static mp_obj_t entry_tuple(const ustack_entry_t *entry) {
+    mp_obj_t items[4] = {
+        entry->name == MP_QSTRnull ? mp_const_none : MP_OBJ_NEW_QSTR(entry->source_file),
+        entry->name == MP_QSTRnull ? mp_const_none : MP_OBJ_NEW_QSTR(entry->name),
+        mp_obj_new_int_from_uint(entry->max_stack),
+        mp_obj_new_int_from_uint(entry->max_pystack),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+
+mp_obj_t shared_module_ustack_profile(void) {
+    // Don't record the calls made while building the result.
+    bool profiling = ustack_profiling;
+    ustack_profiling = false;
+
+    // Sort by decreasing C stack depth.
+    ustack_entry_t entries[CIRCUITPY_USTACK_PROFILE_FUNCTIONS];
+    size_t n = 0;
+    for (size_t i = 0; i < CIRCUITPY_USTACK_PROFILE_FUNCTIONS; i++) {
+        ustack_entry_t entry = ustack_entries[i];
+        if (entry.name == MP_QSTRnull) {
+            continue;
+        }
+        size_t j = n;
+        while (j > 0 && entries[j - 1].max_stack < entry.max_stack) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = entry;
+        n++;
+    }
+
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < n; i++) {
+        mp_obj_list_append(result, entry_tuple(&entries[i]));
+    }
+    if (ustack_overflow.max_stack > 0) {
+        mp_obj_list_append(result, entry_tuple(&ustack_overflow));
+    }
+
+    ustack_profiling = profiling;
+    return result;
+}
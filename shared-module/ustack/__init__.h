@@ -0,0 +1,28 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "py/objfun.h"
+
+// Number of distinct Python functions the stack profiler can keep depths for.
+#ifndef CIRCUITPY_USTACK_PROFILE_FUNCTIONS
+#define CIRCUITPY_USTACK_PROFILE_FUNCTIONS (32)
+#endif
+
+extern bool ustack_profiling;
+
+void ustack_record_call(const mp_obj_fun_bc_t *fun);
+
+// Called by the VM for every call to a bytecode function, once its frame is
+// allocated.
+static inline void ustack_track_call(const mp_obj_fun_bc_t *fun) {
+    if (ustack_profiling) {
+        ustack_record_call(fun);
+    }
+}
@@ -57,6 +57,9 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 
     self->points_list = points_list;
     self->len = 2 * len;
+
+    self->crossings = gc_realloc(self->crossings, 2 * len * sizeof(int32_t), true);
+    self->crossings_valid = false;
 }
 
 
@@ -65,6 +68,8 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->crossings = NULL;
+    self->crossings_valid = false;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -141,14 +146,39 @@ void common_hal_vectorio_polygon_get_area(void *polygon, displayio_area_t *area)
 }
 
 
-// <0 if the point is to the left of the line vector
-//  0 if the point is on the line
-// >0 if the point is to the right of the line vector
-__attribute__((always_inline)) static inline int line_side(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t px, int16_t py) {
-    return (px - x1) * (y2 - y1)
-           - (py - y1) * (x2 - x1);
+// Rounds a / b up for b > 0.
+static inline int32_t ceil_div(int32_t a, int32_t b) {
+    return a >= 0 ? (a + b - 1) / b : -(-a / b);
 }
 
+// Finds the edges that cross row y, once per row rather than once per pixel.
+// A point is wound up by an upward edge, or down by a downward edge, when it
+// is to the left of the edge vector:
+//   (px - x1) * (y2 - y1) - (py - y1) * (x2 - x1) < 0 (upward), > 0 (downward)
+// Both hold exactly for the px below the x computed here, so the winding
+// number of any point in the row is the sum over the edges it is left of.
+static void _compute_crossings(vectorio_polygon_t *self, int16_t y) {
+    uint16_t count = 0;
+    int16_t x1 = self->points_list[self->len - 2];
+    int16_t y1 = self->points_list[self->len - 1];
+    for (uint16_t i = 0; i < self->len; i += 2) {
+        int16_t x2 = self->points_list[i];
+        int16_t y2 = self->points_list[i + 1];
+        int32_t offset = (y - y1) * (x2 - x1);
+        if (y1 <= y && y2 > y) {
+            self->crossings[count++] = x1 + ceil_div(offset, y2 - y1);
+            self->crossings[count++] = 1;
+        } else if (y1 > y && y2 <= y) {
+            self->crossings[count++] = x1 + ceil_div(-offset, y1 - y2);
+            self->crossings[count++] = -1;
+        }
+        x1 = x2;
+        y1 = y2;
+    }
+    self->crossings_len = count;
+    self->crossings_y = y;
+    self->crossings_valid = true;
+}
 
 uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y) {
     VECTORIO_POLYGON_DEBUG("%p polygon get_pixel %d, %d\n", obj, x, y);
@@ -158,30 +188,16 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
         return 0;
     }
 
+    if (!self->crossings_valid || self->crossings_y != y) {
+        _compute_crossings(self, y);
+    }
     int16_t winding_number = 0;
-    int16_t x1 = self->points_list[0];
-    int16_t y1 = self->points_list[1];
-    for (uint16_t i = 2; i <= self->len + 1; ++i) {
-        VECTORIO_POLYGON_DEBUG("  {(%3d, %3d),", x1, y1);
-        int16_t x2 = self->points_list[i % self->len];
-        ++i;
-        int16_t y2 = self->points_list[i % self->len];
-        VECTORIO_POLYGON_DEBUG(" (%3d, %3d)}\n", x2, y2);
-        if (y1 <= y) {
-            if (y2 > y && line_side(x1, y1, x2, y2, x, y) < 0) {
-                // Wind up, point is to the left of the edge vector
-                ++winding_number;
-                VECTORIO_POLYGON_DEBUG("    wind:%2d winding_number:%2d\n", 1, winding_number);
-            }
-        } else if (y2 <= y && line_side(x1, y1, x2, y2, x, y) > 0) {
-            // Wind down, point is to the right of the edge vector
-            --winding_number;
-            VECTORIO_POLYGON_DEBUG("    wind:%2d winding_number:%2d\n", -1, winding_number);
+    for (uint16_t i = 0; i < self->crossings_len; i += 2) {
+        if (x < self->crossings[i]) {
+            winding_number += self->crossings[i + 1];
         }
-
-        x1 = x2;
-        y1 = y2;
     }
+    VECTORIO_POLYGON_DEBUG("    winding_number:%2d\n", winding_number);
     return winding_number == 0 ? 0 : self->color_index;
 }
 
@@ -17,6 +17,12 @@ typedef struct {
     int16_t *points_list;
     uint16_t len;
     uint16_t color_index;
+    // The edges crossing row crossings_y, as pairs of [x, winding]: points
+    // with a smaller x are wound by winding. Has room for every edge.
+    int32_t *crossings;
+    uint16_t crossings_len;
+    int16_t crossings_y;
+    bool crossings_valid;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
 } vectorio_polygon_t;
@@ -12,9 +12,15 @@
 
 #include "shared-bindings/watchdog/WatchDogTimer.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/shared/progress.h"
+#include "supervisor/shared/tick.h"
+
+static size_t long_operation_count;
+static uint64_t last_progress_feed_ms;
 
 void watchdog_reset(void) {
     watchdog_watchdogtimer_obj_t *self = &common_hal_mcu_watchdogtimer_obj;
+    long_operation_count = 0;
     if (self->mode == WATCHDOGMODE_RESET) {
         mp_obj_t exception = pyexec_result()->exception;
         if (exception != MP_OBJ_NULL &&
@@ -25,3 +31,29 @@ void watchdog_reset(void) {
     }
     common_hal_watchdog_deinit(self);
 }
+
+void supervisor_long_operation_begin(void) {
+    long_operation_count++;
+    supervisor_progress();
+}
+
+void supervisor_long_operation_end(void) {
+    if (long_operation_count > 0) {
+        long_operation_count--;
+    }
+}
+
+void supervisor_progress(void) {
+    watchdog_watchdogtimer_obj_t *self = &common_hal_mcu_watchdogtimer_obj;
+    if (long_operation_count == 0 || self->mode == WATCHDOGMODE_NONE) {
+        return;
+    }
+    // Progress can be reported for every block written, so only feed a few
+    // times per timeout.
+    uint64_t now = supervisor_ticks_ms64();
+    if (now - last_progress_feed_ms < (uint64_t)(self->timeout * 250)) {
+        return;
+    }
+    last_progress_feed_ms = now;
+    common_hal_watchdog_feed(self);
+}
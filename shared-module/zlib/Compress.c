@@ -0,0 +1,299 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// DEFLATE compressor: LZ77 with hash chains, coded with the fixed Huffman
+// codes so that no code tables have to be built or sent. The output is a
+// single block, so compress() can be called any number of times before
+// flush().
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Compress.h"
+
+#include "lib/uzlib/uzlib.h"
+
+#define MATCH_LEN_MIN (3)
+#define MATCH_LEN_MAX (258)
+
+// Indexed by level. A chain is not followed further than max_chain entries,
+// or once a match of nice_length is found.
+static const uint16_t level_max_chain[10] = { 0, 4, 8, 16, 32, 64, 128, 256, 1024, 4096 };
+static const uint16_t level_nice_length[10] = { 0, 8, 16, 32, 64, 128, 128, 258, 258, 258 };
+
+static const uint16_t length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+void common_hal_zlib_compress_construct(zlib_compress_obj_t *self, mp_int_t level, mp_int_t wbits, mp_int_t mem_level) {
+    if (level < 0) {
+        level = 6;
+    }
+    self->max_chain = level_max_chain[level];
+    self->nice_length = level_nice_length[level];
+    self->wbits = wbits;
+    if (wbits < 0) {
+        wbits = -wbits;
+    } else if (wbits > 16) {
+        wbits -= 16;
+    }
+    self->window_size = 1 << wbits;
+    self->hash_bits = mem_level + 3;
+    self->window = m_new(uint8_t, 2 * self->window_size);
+    self->prev = m_new0(uint16_t, self->window_size);
+    self->head = m_new0(uint16_t, 1 << self->hash_bits);
+    self->fill = 0;
+    self->pos = 0;
+    self->bits = 0;
+    self->bit_count = 0;
+    self->input_size = 0;
+    self->checksum = self->wbits > 16 ? ~0 : 1;
+    self->started = false;
+    self->finished = false;
+}
+
+static void put_byte(vstr_t *out, uint8_t b) {
+    vstr_add_byte(out, b);
+}
+
+// Bits go out least significant first.
+static void put_bits(zlib_compress_obj_t *self, vstr_t *out, uint32_t bits, size_t n) {
+    self->bits |= bits << self->bit_count;
+    self->bit_count += n;
+    while (self->bit_count >= 8) {
+        put_byte(out, self->bits & 0xff);
+        self->bits >>= 8;
+        self->bit_count -= 8;
+    }
+}
+
+// Huffman codes go out most significant first.
+static void put_code(zlib_compress_obj_t *self, vstr_t *out, uint32_t code, size_t n) {
+    uint32_t reversed = 0;
+    for (size_t i = 0; i < n; i++) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    put_bits(self, out, reversed, n);
+}
+
+// Fixed literal/length code, RFC 1951 section 3.2.6.
+static void put_symbol(zlib_compress_obj_t *self, vstr_t *out, uint16_t symbol) {
+    if (symbol < 144) {
+        put_code(self, out, 0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        put_code(self, out, 0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        put_code(self, out, symbol - 256, 7);
+    } else {
+        put_code(self, out, 0xc0 + symbol - 280, 8);
+    }
+}
+
+static void put_match(zlib_compress_obj_t *self, vstr_t *out, size_t length, size_t distance) {
+    size_t code = 28;
+    while (length < length_base[code]) {
+        code--;
+    }
+    put_symbol(self, out, 257 + code);
+    put_bits(self, out, length - length_base[code], length_extra[code]);
+
+    code = 29;
+    while (distance < dist_base[code]) {
+        code--;
+    }
+    put_code(self, out, code, 5);
+    put_bits(self, out, distance - dist_base[code], dist_extra[code]);
+}
+
+static void put_header(zlib_compress_obj_t *self, vstr_t *out) {
+    if (self->wbits > 16) {
+        static const uint8_t gzip_header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+        vstr_add_strn(out, (const char *)gzip_header, sizeof(gzip_header));
+    } else if (self->wbits > 0) {
+        uint8_t cmf = ((self->wbits - 8) << 4) | 8;
+        // FLEVEL is informational; 2 is the default.
+        uint8_t flg = 2 << 6;
+        flg += 31 - (cmf * 256 + flg) % 31;
+        put_byte(out, cmf);
+        put_byte(out, flg);
+    }
+    // BFINAL = 1, BTYPE = 01 (fixed Huffman codes)
+    put_bits(self, out, 0x3, 3);
+}
+
+static inline size_t hash3(zlib_compress_obj_t *self, const uint8_t *p) {
+    uint32_t v = (p[0] << 16) | (p[1] << 8) | p[2];
+    return (v * 2654435761u) >> (32 - self->hash_bits);
+}
+
+// Insert pos into the hash chains and return the previous position with
+// the same hash.
+static size_t insert(zlib_compress_obj_t *self, size_t pos) {
+    size_t h = hash3(self, self->window + pos);
+    size_t candidate = self->head[h];
+    self->prev[pos & (self->window_size - 1)] = candidate;
+    self->head[h] = pos;
+    return candidate;
+}
+
+static size_t longest_match(zlib_compress_obj_t *self, size_t candidate, size_t *distance) {
+    const uint8_t *window = self->window;
+    size_t pos = self->pos;
+    size_t max_len = MIN(self->fill - pos, MATCH_LEN_MAX);
+    // Matches can't reach back further than the window. Position 0 is never
+    // used as a candidate since 0 also means "none".
+    size_t limit = pos > self->window_size ? pos - self->window_size : 0;
+    size_t best_len = 0;
+    size_t chain = self->max_chain;
+    while (candidate > limit && chain-- > 0) {
+        // Quick rejection: the byte that would make this match longer than
+        // the best so far must match.
+        if (window[candidate + best_len] == window[pos + best_len]) {
+            size_t len = 0;
+            while (len < max_len && window[candidate + len] == window[pos + len]) {
+                len++;
+            }
+            if (len > best_len) {
+                best_len = len;
+                *distance = pos - candidate;
+                if (len >= self->nice_length || len == max_len) {
+                    break;
+                }
+            }
+        }
+        size_t next = self->prev[candidate & (self->window_size - 1)];
+        if (next >= candidate) {
+            // The slot was reused by a later position.
+            break;
+        }
+        candidate = next;
+    }
+    return best_len >= MATCH_LEN_MIN ? best_len : 0;
+}
+
+// Encode the buffered input from pos up to fill.
+static void deflate_window(zlib_compress_obj_t *self, vstr_t *out) {
+    while (self->pos < self->fill) {
+        size_t length = 0;
+        size_t distance = 0;
+        if (self->fill - self->pos >= MATCH_LEN_MIN) {
+            size_t candidate = insert(self, self->pos);
+            if (self->max_chain > 0) {
+                length = longest_match(self, candidate, &distance);
+            }
+        }
+        if (length == 0) {
+            put_symbol(self, out, self->window[self->pos]);
+            self->pos++;
+            continue;
+        }
+        put_match(self, out, length, distance);
+        size_t end = self->pos + length;
+        self->pos++;
+        for (; self->pos < end; self->pos++) {
+            if (self->fill - self->pos >= MATCH_LEN_MIN) {
+                insert(self, self->pos);
+            }
+        }
+    }
+}
+
+// Drop the older half of the window to make room for more input.
+static void slide_window(zlib_compress_obj_t *self) {
+    size_t w = self->window_size;
+    memmove(self->window, self->window + w, w);
+    self->fill -= w;
+    self->pos -= w;
+    size_t head_size = 1 << self->hash_bits;
+    for (size_t i = 0; i < head_size; i++) {
+        self->head[i] = self->head[i] >= w ? self->head[i] - w : 0;
+    }
+    for (size_t i = 0; i < w; i++) {
+        self->prev[i] = self->prev[i] >= w ? self->prev[i] - w : 0;
+    }
+}
+
+void common_hal_zlib_compress_compress(zlib_compress_obj_t *self, const uint8_t *data, size_t len, vstr_t *out) {
+    if (self->finished) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Compress object already flushed"));
+    }
+    if (!self->started) {
+        put_header(self, out);
+        self->started = true;
+    }
+    if (self->wbits > 16) {
+        self->checksum = uzlib_crc32(data, len, self->checksum);
+    } else if (self->wbits > 0) {
+        self->checksum = uzlib_adler32(data, len, self->checksum);
+    }
+    self->input_size += len;
+
+    while (len > 0) {
+        if (self->fill == 2 * self->window_size) {
+            slide_window(self);
+        }
+        size_t n = MIN(len, 2 * self->window_size - self->fill);
+        memcpy(self->window + self->fill, data, n);
+        self->fill += n;
+        data += n;
+        len -= n;
+        deflate_window(self, out);
+    }
+}
+
+void common_hal_zlib_compress_flush(zlib_compress_obj_t *self, vstr_t *out) {
+    if (self->finished) {
+        return;
+    }
+    if (!self->started) {
+        put_header(self, out);
+        self->started = true;
+    }
+    // End of block, then pad to a byte boundary.
+    put_symbol(self, out, 256);
+    if (self->bit_count > 0) {
+        put_byte(out, self->bits);
+    }
+    self->bit_count = 0;
+    self->bits = 0;
+
+    if (self->wbits > 16) {
+        uint32_t trailer[2] = { ~self->checksum, self->input_size };
+        for (size_t i = 0; i < 2; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                put_byte(out, trailer[i] >> (8 * j));
+            }
+        }
+    } else if (self->wbits > 0) {
+        for (int j = 3; j >= 0; j--) {
+            put_byte(out, self->checksum >> (8 * j));
+        }
+    }
+    self->finished = true;
+
+    // The window and hash chains are no longer needed.
+    m_del(uint8_t, self->window, 2 * self->window_size);
+    m_del(uint16_t, self->prev, self->window_size);
+    m_del(uint16_t, self->head, 1 << self->hash_bits);
+    self->window = NULL;
+    self->prev = NULL;
+    self->head = NULL;
+}
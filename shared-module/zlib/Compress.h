@@ -0,0 +1,33 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    // The last window_size bytes of input are kept for matching, with room
+    // for another window_size bytes of new input after them.
+    uint8_t *window;
+    // Most recent position with each hash, and the previous position with the
+    // same hash as each position in the window. 0 is "none".
+    uint16_t *head;
+    uint16_t *prev;
+    size_t window_size;
+    size_t fill;
+    size_t pos;
+    uint32_t checksum;
+    uint32_t input_size;
+    uint32_t bits;
+    uint8_t bit_count;
+    uint8_t hash_bits;
+    uint16_t max_chain;
+    uint16_t nice_length;
+    int8_t wbits;
+    bool started;
+    bool finished;
+} zlib_compress_obj_t;
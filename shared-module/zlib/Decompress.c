@@ -0,0 +1,213 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// Incremental decompression with uzlib. uzlib can't stop partway through a
+// symbol to wait for more input, so output is made in steps of at most
+// STEP_SIZE bytes. A step that runs out of input is undone, and then redone
+// up to the last complete symbol. The input that is left is kept until the
+// next call.
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Decompress.h"
+
+#define STEP_SIZE (512)
+
+// Called by uzlib when it has read all of the current input.
+static int read_source(TINF_DATA *d) {
+    zlib_decompress_obj_t *self = d->self;
+    if (!self->reading_data && self->data < self->data_end) {
+        // Done with the pending input; go on to the new data.
+        self->reading_data = true;
+        d->source = self->data;
+        d->source_limit = self->data_end;
+        return *d->source++;
+    }
+    if (self->starved_dest == NULL) {
+        self->starved_dest = d->dest;
+    }
+    return -1;
+}
+
+static void allocate_ring(zlib_decompress_obj_t *self, size_t window_bits) {
+    self->ring_size = (1 << window_bits) + STEP_SIZE;
+    self->ring = m_new(uint8_t, self->ring_size);
+    self->decomp.dict_ring = self->ring;
+    self->decomp.dict_size = self->ring_size;
+    self->decomp.dict_idx = 0;
+}
+
+void common_hal_zlib_decompress_construct(zlib_decompress_obj_t *self, mp_int_t wbits) {
+    self->wbits = wbits;
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    uzlib_uncompress_init(&self->decomp, NULL, 0);
+    self->decomp.self = self;
+    self->decomp.source_read_cb = read_source;
+    self->ring = NULL;
+    self->pending = NULL;
+    self->pending_len = 0;
+    self->pending_alloc = 0;
+    self->unconsumed_tail = mp_const_empty_bytes;
+    self->unused_data = mp_const_empty_bytes;
+    self->eof = false;
+    // Raw deflate has no header; the others have their window allocated
+    // once the header has been read.
+    self->header_done = wbits < 0;
+    if (self->header_done) {
+        allocate_ring(self, -wbits);
+    }
+}
+
+typedef enum {
+    STEP_OK,
+    STEP_NEED_INPUT,
+} step_result_t;
+
+static int run_decoder(zlib_decompress_obj_t *self) {
+    TINF_DATA *d = &self->decomp;
+    if (self->header_done) {
+        return uzlib_uncompress_chksum(d);
+    }
+    if (self->wbits >= 16) {
+        return uzlib_gzip_parse_header(d);
+    }
+    return uzlib_zlib_parse_header(d);
+}
+
+// Decode up to limit bytes onto out.
+static step_result_t step(zlib_decompress_obj_t *self, vstr_t *out, size_t limit) {
+    TINF_DATA *d = &self->decomp;
+    size_t start_len = out->len;
+    memcpy(&self->saved, d, sizeof(*d));
+    bool saved_reading_data = self->reading_data;
+
+    uint8_t *dest = (uint8_t *)vstr_add_len(out, limit);
+    d->dest_start = d->dest = dest;
+    d->dest_limit = dest + limit;
+    self->starved_dest = NULL;
+    int st = run_decoder(self);
+
+    if (self->starved_dest != NULL) {
+        // Go back, and if there was complete output before the input ran
+        // out, make just that.
+        size_t complete = self->header_done ? self->starved_dest - dest : 0;
+        memcpy(d, &self->saved, sizeof(*d));
+        self->reading_data = saved_reading_data;
+        out->len = start_len;
+        if (complete == 0) {
+            return STEP_NEED_INPUT;
+        }
+        dest = (uint8_t *)vstr_add_len(out, complete);
+        d->dest_start = d->dest = dest;
+        d->dest_limit = dest + complete;
+        self->starved_dest = NULL;
+        st = run_decoder(self);
+        if (self->starved_dest != NULL) {
+            // The decoder stops at dest_limit before reading any further, so
+            // it can't run out again.
+            mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(TINF_DATA_ERROR));
+        }
+    }
+    if (st < 0) {
+        mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+    }
+    out->len = start_len + (d->dest - dest);
+
+    if (!self->header_done) {
+        self->header_done = true;
+        size_t window_bits;
+        if (self->wbits >= 16) {
+            window_bits = self->wbits - 16;
+        } else {
+            // uzlib_zlib_parse_header returns the window size from the header.
+            window_bits = MAX(st + 8, self->wbits);
+        }
+        allocate_ring(self, window_bits);
+    } else if (st == TINF_DONE) {
+        self->eof = true;
+    }
+    return STEP_OK;
+}
+
+static void keep_pending(zlib_decompress_obj_t *self, const uint8_t *src, size_t len) {
+    if (len > self->pending_alloc) {
+        self->pending = m_renew(uint8_t, self->pending, self->pending_alloc, len);
+        self->pending_alloc = len;
+    }
+    memmove(self->pending, src, len);
+    self->pending_len = len;
+}
+
+void common_hal_zlib_decompress_decompress(zlib_decompress_obj_t *self, const uint8_t *data, size_t len, size_t max_length, vstr_t *out) {
+    if (self->eof) {
+        // CPython keeps anything after the end of the stream.
+        if (len > 0) {
+            mp_obj_t tail = mp_obj_new_bytes(data, len);
+            self->unused_data = mp_binary_op(MP_BINARY_OP_ADD, self->unused_data, tail);
+        }
+        return;
+    }
+    TINF_DATA *d = &self->decomp;
+    d->source = self->pending;
+    d->source_limit = self->pending + self->pending_len;
+    self->reading_data = false;
+    self->data = data;
+    self->data_end = data + len;
+
+    bool need_input = false;
+    while (!self->eof) {
+        size_t limit = STEP_SIZE;
+        if (max_length > 0) {
+            if (out->len >= max_length) {
+                break;
+            }
+            limit = MIN(limit, max_length - out->len);
+        }
+        if (step(self, out, limit) == STEP_NEED_INPUT) {
+            need_input = true;
+            break;
+        }
+    }
+
+    // Sort out the input that is left.
+    const uint8_t *data_left = self->reading_data ? d->source : data;
+    size_t data_left_len = self->data_end - data_left;
+    size_t pending_left_len = self->reading_data ? 0 : (size_t)(d->source_limit - d->source);
+    if (self->eof) {
+        vstr_t unused;
+        vstr_init(&unused, pending_left_len + data_left_len);
+        vstr_add_strn(&unused, (const char *)d->source, pending_left_len);
+        vstr_add_strn(&unused, (const char *)data_left, data_left_len);
+        self->unused_data = mp_obj_new_bytes_from_vstr(&unused);
+        self->unconsumed_tail = mp_const_empty_bytes;
+        self->pending_len = 0;
+    } else if (need_input) {
+        // Everything that is left is the start of an incomplete symbol.
+        if (pending_left_len > 0) {
+            keep_pending(self, d->source, pending_left_len);
+            size_t new_len = pending_left_len + data_left_len;
+            if (new_len > self->pending_alloc) {
+                self->pending = m_renew(uint8_t, self->pending, self->pending_alloc, new_len);
+                self->pending_alloc = new_len;
+            }
+            memcpy(self->pending + pending_left_len, data_left, data_left_len);
+            self->pending_len = new_len;
+        } else {
+            keep_pending(self, data_left, data_left_len);
+        }
+        self->unconsumed_tail = mp_const_empty_bytes;
+    } else {
+        // Stopped at max_length. As in CPython, the caller passes
+        // unconsumed_tail to the next call.
+        keep_pending(self, d->source, pending_left_len);
+        self->unconsumed_tail = mp_obj_new_bytes(data_left, data_left_len);
+    }
+    // Don't keep pointers to the caller's buffer.
+    d->source = d->source_limit = NULL;
+    self->data = self->data_end = NULL;
+}
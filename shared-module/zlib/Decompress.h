@@ -0,0 +1,41 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "lib/uzlib/uzlib.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    TINF_DATA decomp;
+    // decomp as it was before the current step, to go back to when the
+    // input runs out partway through a symbol.
+    TINF_DATA saved;
+    // History for back references. It is longer than the window by the most
+    // a step can write, so that a step that is undone never overwrites
+    // history that is still needed.
+    uint8_t *ring;
+    size_t ring_size;
+    // Input that has been given to decompress() but not decoded yet because
+    // it ends partway through a symbol.
+    uint8_t *pending;
+    size_t pending_len;
+    size_t pending_alloc;
+    // The data passed to the current decompress() call. It is read after the
+    // pending input.
+    const uint8_t *data;
+    const uint8_t *data_end;
+    // Where output was when the input ran out, or NULL.
+    uint8_t *starved_dest;
+    mp_obj_t unconsumed_tail;
+    mp_obj_t unused_data;
+    int8_t wbits;
+    bool reading_data;
+    bool header_done;
+    bool eof;
+} zlib_decompress_obj_t;
@@ -108,6 +108,22 @@ static int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                 module_fun = mp_make_function_from_proto_fun(frozen->proto_fun, ctx, NULL);
             } else
             #endif
+            #if MICROPY_MODULE_COMPILE_CACHE
+            // Files such as code.py are cached like imported modules, so a board
+            // waking from deep sleep doesn't compile them again.
+            if ((exec_flags & EXEC_FLAG_SOURCE_IS_FILENAME) && input_kind == MP_PARSE_FILE_INPUT &&
+                strlen(source) > 3 && strcmp((const char *)source + strlen(source) - 3, ".py") == 0) {
+                qstr source_name = qstr_from_str(source);
+                #if MICROPY_PY___FILE__
+                mp_store_global(MP_QSTR___file__, MP_OBJ_NEW_QSTR(source_name));
+                #endif
+                mp_compiled_module_t cm;
+                cm.context = m_new_obj(mp_module_context_t);
+                cm.context->module.globals = mp_globals_get();
+                mp_compile_cache_load_or_compile(source_name, &cm);
+                module_fun = mp_make_function_from_proto_fun(cm.rc, cm.context, NULL);
+            } else
+            #endif
             {
                 #if MICROPY_ENABLE_COMPILER
                 mp_lexer_t *lex;
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /** Background callbacks are a linked list of tasks to call in the background.
  *
@@ -32,15 +33,39 @@
  * supervisor_enable_tick() and disabled with supervisor_disable_tick(). When
  * enabled, a timer will schedule a callback to supervisor_background_tick(),
  * which includes port_background_tick(), every millisecond.
+ *
+ * Callbacks run in order of priority. Set `priority` before the first add to
+ * move a callback out of the normal class. Real time callbacks (audio buffer
+ * refills, USB) run first, and also ahead of lower priority callbacks still
+ * waiting in the same run. Bulk callbacks (display refresh, filesystem
+ * flushes) run last, and can be limited to CIRCUITPY_BACKGROUND_BULK_BUDGET_US
+ * per run, after the first, with the rest left for the next run.
  */
+typedef enum {
+    BACKGROUND_CALLBACK_PRIORITY_NORMAL = 0,
+    BACKGROUND_CALLBACK_PRIORITY_REALTIME,
+    BACKGROUND_CALLBACK_PRIORITY_BULK,
+    BACKGROUND_CALLBACK_PRIORITY_COUNT,
+} background_callback_priority_t;
+
 typedef void (*background_callback_fun)(void *data);
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
     struct background_callback *prev;
+    uint8_t priority; // background_callback_priority_t
 } background_callback_t;
 
+/* Time spent running the callbacks of one priority. */
+typedef struct {
+    uint32_t runs;
+    uint64_t total_us;
+    uint32_t max_us;
+    // Number of times bulk callbacks were left for a later run.
+    uint32_t deferred;
+} background_callback_stats_t;
+
 /* Add a background callback for which 'fun' and 'data' were previously set */
 void background_callback_add_core(background_callback_t *cb);
 
@@ -64,6 +89,10 @@ bool background_callback_pending(void);
 /* During soft reset, remove all pending callbacks and clear the critical section flag */
 void background_callback_reset(void);
 
+/* Copy out the run time accounting for one priority, or reset all of it. */
+void background_callback_get_stats(background_callback_priority_t priority, background_callback_stats_t *stats);
+void background_callback_reset_stats(void);
+
 /* Sometimes background callbacks must be blocked.  Use these functions to
  * bracket the section of code where this is the case.  These calls nest, and
  * begins must be balanced with ends.
@@ -13,10 +13,26 @@
 extern volatile bool filesystem_flush_requested;
 
 void filesystem_background(void);
-void filesystem_tick(void);
+// Flush CIRCUITPY CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS from now, unless a flush is already due.
+void filesystem_flush_later(void);
 bool filesystem_init(bool create_allowed, bool force_create);
 void filesystem_flush(void);
 bool filesystem_present(void);
+#if CIRCUITPY_LITTLEFS
+void filesystem_mount_littlefs(void);
+void filesystem_format_littlefs(void);
+#endif
+#if CIRCUITPY_STORAGE_DATA_DRIVE
+// Mounts the flash partition's FAT filesystem at /data for Python and presents
+// it as a second, read-only USB drive. It's formatted first if needed. Returns
+// false if the board has no partition or it can't be mounted.
+bool data_drive_enable(void);
+// NULL until the data drive is enabled.
+fs_user_mount_t *data_drive_vfs(void);
+void data_drive_flush(void);
+// Whether the data drive has changed on flash since the last call.
+bool data_drive_take_changed(void);
+#endif
 void filesystem_set_internal_writable_by_usb(bool usb_writable);
 void filesystem_set_internal_concurrent_write_protection(bool concurrent_write_protection);
 void filesystem_set_writable_by_usb(fs_user_mount_t *vfs, bool usb_writable);
@@ -9,6 +9,7 @@
 #include <stdbool.h>
 
 #include "py/mpconfig.h"
+#include "py/obj.h"
 
 #if INTERNAL_FLASH_FILESYSTEM
 #include "supervisor/shared/internal_flash.h"
@@ -32,3 +33,30 @@ void supervisor_flash_release_cache(void);
 void supervisor_flash_set_extended(bool extended);
 bool supervisor_flash_get_extended(void);
 void supervisor_flash_update_extended(void);
+
+#if CIRCUITPY_LITTLEFS
+// Byte-addressed access to the CIRCUITPY region, used for LittleFS. Erases
+// are SPI_FLASH_ERASE_SIZE sectors. These return true on success.
+uint32_t supervisor_flash_raw_get_size(void);
+bool supervisor_flash_raw_read(uint32_t address, uint8_t *dest, uint32_t len);
+bool supervisor_flash_raw_prog(uint32_t address, const uint8_t *src, uint32_t len);
+bool supervisor_flash_raw_erase(uint32_t address);
+
+// Block device over the raw region with erase-sized blocks, for VfsLfs2.
+mp_obj_t supervisor_flash_raw_blockdev(void);
+bool supervisor_flash_raw_is_littlefs(void);
+#endif
+
+#if CIRCUITPY_STORAGE_PARTITION
+// A region of flash outside CIRCUITPY that the board reserves for user data.
+// Its size is 0 when the board doesn't reserve one. Addresses are relative to
+// the start of the partition. These return true on success.
+#define SUPERVISOR_FLASH_PARTITION_ERASE_SIZE (4096)
+uint32_t supervisor_flash_partition_get_size(void);
+bool supervisor_flash_partition_read(uint32_t address, uint8_t *dest, uint32_t len);
+bool supervisor_flash_partition_prog(uint32_t address, const uint8_t *src, uint32_t len);
+bool supervisor_flash_partition_erase(uint32_t address);
+// Returns where the partition is mapped into the address space for reading,
+// or NULL if it can't be.
+const uint8_t *supervisor_flash_partition_get_mapped(void);
+#endif
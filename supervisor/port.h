@@ -52,12 +52,24 @@ uint32_t port_get_saved_word(void);
 // tick is 32 subticks (for a resolution of 1/32768 or 30.5ish microseconds.)
 uint64_t port_get_raw_ticks(uint8_t *subticks);
 
+// Get the time since start up in microseconds, from the same clock as port_get_raw_ticks.
+// A default weak implementation is provided that is only as fine as a subtick. Ports with a
+// microsecond timer should override it.
+uint64_t port_get_raw_us(void);
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void);
 
 // Disable 1/1024 second tick.
 void port_disable_tick(void);
 
+// Call supervisor_tick() once, from an interrupt, after the given number of ticks. This lets
+// the supervisor sleep until its next deadline instead of running the 1/1024 second tick. A
+// later call replaces the earlier one and 0 cancels it. Must not disturb the 1/1024 second tick
+// or port_interrupt_after_ticks(). Return false if not supported, and the supervisor will keep
+// the 1/1024 second tick running while it has deadlines instead.
+bool port_tick_after_ticks(uint32_t ticks);
+
 // Wake the CPU after the given number of ticks or sooner. Only the last call to this will apply.
 // Only the common sleep routine should use it.
 void port_interrupt_after_ticks(uint32_t ticks);
@@ -66,6 +78,11 @@ void port_interrupt_after_ticks(uint32_t ticks);
 // may not be a system level sleep.
 void port_idle_until_interrupt(void);
 
+// Enter light sleep for the given number of ticks, keeping RAM and the state of
+// peripherals, and return once awake. Return false without sleeping if light
+// sleep isn't supported or an active peripheral needs its clock.
+bool port_light_sleep_for_ticks(uint32_t ticks);
+
 // Execute port specific actions during background tick. Only if ticks are enabled.
 void port_background_tick(void);
 
@@ -108,3 +125,7 @@ void port_boot_info(void);
 // Some ports want to mark additional pointers as gc roots.
 // A default weak implementation is provided that does nothing.
 void port_gc_collect(void);
+
+// The CPU's free running cycle counter, such as DWT CYCCNT on Cortex-M or
+// CCOUNT on Xtensa. Ports that set CIRCUITPY_PERF_COUNTERS must implement this.
+uint32_t port_get_cpu_cycles(void);
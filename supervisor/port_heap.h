@@ -20,8 +20,18 @@
 // implementation to use by default.
 void port_heap_init(void);
 
+// Ports with slower external RAM, such as PSRAM, put allocations of at least
+// CIRCUITPY_SLOW_RAM_THRESHOLD bytes there first and smaller ones in internal
+// RAM first.
 void *port_malloc(size_t size, bool dma_capable);
 
+// Allocate from internal RAM first regardless of size, for memory that is used
+// often such as the start of the VM heap. Same as port_malloc() by default.
+void *port_malloc_fast(size_t size);
+
+// True if ptr is in slower external RAM. False by default.
+bool port_heap_is_slow(const void *ptr);
+
 void port_free(void *ptr);
 
 void *port_realloc(void *ptr, size_t size);
@@ -11,10 +11,16 @@
 #include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/perf.h"
+#include "supervisor/shared/trace.h"
 #include "supervisor/shared/tick.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
-static volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+// One list per priority, each run first in first out.
+static volatile background_callback_t *volatile callback_head[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+static volatile background_callback_t *volatile callback_tail[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+
+static background_callback_stats_t callback_stats[BACKGROUND_CALLBACK_PRIORITY_COUNT];
 
 #ifndef CALLBACK_CRITICAL_BEGIN
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
@@ -26,21 +32,32 @@ static volatile background_callback_t *volatile callback_head, *volatile callbac
 MP_WEAK void PLACE_IN_ITCM(port_wake_main_task)(void) {
 }
 
+static inline uint8_t callback_priority(background_callback_t *cb) {
+    return cb->priority < BACKGROUND_CALLBACK_PRIORITY_COUNT ? cb->priority : BACKGROUND_CALLBACK_PRIORITY_NORMAL;
+}
+
+// Queued callbacks have prev set, except the head of a list. The head of a
+// list taken to be run has prev pointing to itself.
+static inline bool callback_queued(background_callback_t *cb) {
+    return cb->prev || callback_head[callback_priority(cb)] == cb;
+}
+
 void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
     CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
+    if (callback_queued(cb)) {
         CALLBACK_CRITICAL_END;
         return;
     }
+    uint8_t priority = callback_priority(cb);
     cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
+    cb->prev = (background_callback_t *)callback_tail[priority];
+    if (callback_tail[priority]) {
+        callback_tail[priority]->next = cb;
     }
-    if (!callback_head) {
-        callback_head = cb;
+    if (!callback_head[priority]) {
+        callback_head[priority] = cb;
     }
-    callback_tail = cb;
+    callback_tail[priority] = cb;
     CALLBACK_CRITICAL_END;
 
     port_wake_main_task();
@@ -53,11 +70,48 @@ void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, backgrou
 }
 
 inline bool background_callback_pending(void) {
-    return callback_head != NULL;
+    return callback_head[BACKGROUND_CALLBACK_PRIORITY_REALTIME] != NULL ||
+           callback_head[BACKGROUND_CALLBACK_PRIORITY_NORMAL] != NULL ||
+           callback_head[BACKGROUND_CALLBACK_PRIORITY_BULK] != NULL;
 }
 
 static int background_prevention_count;
 
+// Time in subticks of 1/32768 second.
+static uint64_t PLACE_IN_ITCM(subticks_now)(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+}
+
+// Take the whole list for a priority. Must be in the callback critical section.
+static background_callback_t *PLACE_IN_ITCM(take_list)(uint8_t priority) {
+    background_callback_t *cb = (background_callback_t *)callback_head[priority];
+    callback_head[priority] = NULL;
+    callback_tail[priority] = NULL;
+    if (cb) {
+        cb->prev = cb;
+    }
+    return cb;
+}
+
+// Put a taken list back in front of anything queued since. Must be in the
+// callback critical section.
+static void PLACE_IN_ITCM(return_list)(uint8_t priority, background_callback_t * cb) {
+    background_callback_t *last = cb;
+    while (last->next) {
+        last = last->next;
+    }
+    last->next = (background_callback_t *)callback_head[priority];
+    if (callback_head[priority]) {
+        callback_head[priority]->prev = last;
+    } else {
+        callback_tail[priority] = last;
+    }
+    cb->prev = NULL;
+    callback_head[priority] = cb;
+}
+
 void PLACE_IN_ITCM(background_callback_run_all)() {
     port_background_task();
     if (!background_callback_pending()) {
@@ -69,26 +123,90 @@ void PLACE_IN_ITCM(background_callback_run_all)() {
         return;
     }
     ++background_prevention_count;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
-    while (cb) {
+    uint32_t perf_start = perf_begin();
+    trace_event(TRACE_EVENT_BACKGROUND_START, 0);
+    uint64_t start = subticks_now();
+    // Only run what is queued now. Anything queued while running waits for
+    // the next call, except real time callbacks, which go ahead of the rest.
+    background_callback_t *taken[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+    for (uint8_t priority = 0; priority < BACKGROUND_CALLBACK_PRIORITY_COUNT; priority++) {
+        taken[priority] = take_list(priority);
+    }
+    static const uint8_t order[] = {
+        BACKGROUND_CALLBACK_PRIORITY_REALTIME,
+        BACKGROUND_CALLBACK_PRIORITY_NORMAL,
+        BACKGROUND_CALLBACK_PRIORITY_BULK,
+    };
+    bool bulk_ran = false;
+    size_t i = 0;
+    while (i < MP_ARRAY_SIZE(order)) {
+        uint8_t priority = order[i];
+        background_callback_t *cb = taken[priority];
+        if (!cb) {
+            i++;
+            continue;
+        }
+        #if CIRCUITPY_BACKGROUND_BULK_BUDGET_US > 0
+        // Bulk work always makes some progress, but leaves the rest for later
+        // once this call has used its budget.
+        if (priority == BACKGROUND_CALLBACK_PRIORITY_BULK && bulk_ran &&
+            (subticks_now() - start) * 1000000 / 32768 > CIRCUITPY_BACKGROUND_BULK_BUDGET_US) {
+            return_list(priority, cb);
+            callback_stats[priority].deferred++;
+            break;
+        }
+        #endif
         background_callback_t *next = cb->next;
+        if (next) {
+            next->prev = next;
+        }
+        taken[priority] = next;
         cb->next = cb->prev = NULL;
         background_callback_fun fun = cb->fun;
         void *data = cb->data;
         CALLBACK_CRITICAL_END;
         // Leave the critical section in order to run the callback function
         if (fun) {
+            uint64_t fun_start = subticks_now();
             fun(data);
+            uint32_t us = (subticks_now() - fun_start) * 1000000 / 32768;
+            background_callback_stats_t *stats = &callback_stats[priority];
+            stats->runs++;
+            stats->total_us += us;
+            if (us > stats->max_us) {
+                stats->max_us = us;
+            }
         }
         CALLBACK_CRITICAL_BEGIN;
-        cb = next;
+        if (priority == BACKGROUND_CALLBACK_PRIORITY_BULK) {
+            bulk_ran = true;
+        }
+        if (priority != BACKGROUND_CALLBACK_PRIORITY_REALTIME &&
+            callback_head[BACKGROUND_CALLBACK_PRIORITY_REALTIME]) {
+            taken[BACKGROUND_CALLBACK_PRIORITY_REALTIME] = take_list(BACKGROUND_CALLBACK_PRIORITY_REALTIME);
+            i = 0;
+        }
     }
+    (void)start;
+    (void)bulk_ran;
+    perf_end(PERF_COUNTER_BACKGROUND, perf_start);
+    trace_event(TRACE_EVENT_BACKGROUND_END, 0);
     --background_prevention_count;
     CALLBACK_CRITICAL_END;
 }
 
+void background_callback_get_stats(background_callback_priority_t priority, background_callback_stats_t *stats) {
+    CALLBACK_CRITICAL_BEGIN;
+    *stats = callback_stats[priority];
+    CALLBACK_CRITICAL_END;
+}
+
+void background_callback_reset_stats(void) {
+    CALLBACK_CRITICAL_BEGIN;
+    memset(callback_stats, 0, sizeof(callback_stats));
+    CALLBACK_CRITICAL_END;
+}
+
 void background_callback_prevent() {
     CALLBACK_CRITICAL_BEGIN;
     ++background_prevention_count;
@@ -104,33 +222,35 @@ void background_callback_allow() {
 
 // Filter out queued callbacks if they are allocated on the heap.
 void background_callback_reset() {
-    background_callback_t *new_head = NULL;
-    background_callback_t **previous_next = &new_head;
-    background_callback_t *new_tail = NULL;
     CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = NULL;
-        // Unlink any callbacks that are allocated on the python heap or if they
-        // reference data on the python heap. The python heap will be disappear
-        // soon after this.
-        if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
-            cb->prev = NULL; // Used to indicate a callback isn't queued.
-        } else {
-            // Set .next of the previous callback.
-            *previous_next = cb;
-            // Set our .next for the next callback.
-            previous_next = &cb->next;
-            // Set our prev to the last callback.
-            cb->prev = new_tail;
-            // Now we're the tail of the list.
-            new_tail = cb;
+    for (uint8_t priority = 0; priority < BACKGROUND_CALLBACK_PRIORITY_COUNT; priority++) {
+        background_callback_t *new_head = NULL;
+        background_callback_t **previous_next = &new_head;
+        background_callback_t *new_tail = NULL;
+        background_callback_t *cb = (background_callback_t *)callback_head[priority];
+        while (cb) {
+            background_callback_t *next = cb->next;
+            cb->next = NULL;
+            // Unlink any callbacks that are allocated on the python heap or if they
+            // reference data on the python heap. The python heap will be disappear
+            // soon after this.
+            if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
+                cb->prev = NULL; // Used to indicate a callback isn't queued.
+            } else {
+                // Set .next of the previous callback.
+                *previous_next = cb;
+                // Set our .next for the next callback.
+                previous_next = &cb->next;
+                // Set our prev to the last callback.
+                cb->prev = new_tail;
+                // Now we're the tail of the list.
+                new_tail = cb;
+            }
+            cb = next;
         }
-        cb = next;
+        callback_head[priority] = new_head;
+        callback_tail[priority] = new_tail;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
     background_prevention_count = 0;
     CALLBACK_CRITICAL_END;
 }
@@ -150,9 +270,11 @@ void background_callback_gc_collect(void) {
     // It's necessary to traverse the whole list here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    for (uint8_t priority = 0; priority < BACKGROUND_CALLBACK_PRIORITY_COUNT; priority++) {
+        background_callback_t *cb = (background_callback_t *)callback_head[priority];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
     }
 }
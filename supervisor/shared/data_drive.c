@@ -0,0 +1,180 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// The data drive is a FAT filesystem in the board's reserved flash partition.
+// Python owns it and writes to it at /data, while USB presents it to the host
+// as a second, read-only drive. Because the host never writes it and Python
+// never writes CIRCUITPY's blocks through it, both can be active at once.
+
+#include <string.h>
+
+#include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
+#include "lib/oofatfs/ff.h"
+#include "py/builtin.h"
+#include "py/mpstate.h"
+#include "supervisor/filesystem.h"
+#include "supervisor/flash.h"
+#include "supervisor/port_heap.h"
+
+#define SECTOR_SIZE (SUPERVISOR_FLASH_PARTITION_ERASE_SIZE)
+#define NO_SECTOR (0xffffffff)
+
+static fs_user_mount_t _data_vfs;
+static mp_vfs_mount_t _data_mount;
+
+// One erase sector is cached so that 512 byte FAT sectors can be rewritten.
+static uint8_t *_cache;
+static uint32_t _cache_sector = NO_SECTOR;
+static bool _cache_dirty;
+
+// Set when new data reaches flash, so the host can be told to reread.
+static volatile bool _changed;
+
+static void data_drive_flush_cache(void) {
+    if (!_cache_dirty) {
+        return;
+    }
+    if (supervisor_flash_partition_erase(_cache_sector)) {
+        supervisor_flash_partition_prog(_cache_sector, _cache, SECTOR_SIZE);
+    }
+    _cache_dirty = false;
+    _changed = true;
+}
+
+static mp_uint_t data_drive_read_blocks(mp_obj_t self, uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        uint32_t address = (block_num + i) * FILESYSTEM_BLOCK_SIZE;
+        uint8_t *block = dest + i * FILESYSTEM_BLOCK_SIZE;
+        uint32_t sector = address & ~(SECTOR_SIZE - 1);
+        if (sector == _cache_sector) {
+            memcpy(block, _cache + (address - sector), FILESYSTEM_BLOCK_SIZE);
+        } else if (!supervisor_flash_partition_read(address, block, FILESYSTEM_BLOCK_SIZE)) {
+            return 1; // error
+        }
+    }
+    return 0; // success
+}
+
+static mp_uint_t data_drive_write_blocks(mp_obj_t self, const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        uint32_t address = (block_num + i) * FILESYSTEM_BLOCK_SIZE;
+        uint32_t sector = address & ~(SECTOR_SIZE - 1);
+        if (sector != _cache_sector) {
+            data_drive_flush_cache();
+            _cache_sector = NO_SECTOR;
+            if (!supervisor_flash_partition_read(sector, _cache, SECTOR_SIZE)) {
+                return 1; // error
+            }
+            _cache_sector = sector;
+        }
+        memcpy(_cache + (address - sector), src + i * FILESYSTEM_BLOCK_SIZE, FILESYSTEM_BLOCK_SIZE);
+        _cache_dirty = true;
+    }
+    return 0; // success
+}
+
+static bool data_drive_ioctl(mp_obj_t self, size_t cmd, size_t arg, mp_int_t *out_value) {
+    if (out_value != NULL) {
+        *out_value = 0;
+    }
+    switch (cmd) {
+        case MP_BLOCKDEV_IOCTL_INIT:
+            break;
+        case MP_BLOCKDEV_IOCTL_DEINIT:
+        case MP_BLOCKDEV_IOCTL_SYNC:
+            data_drive_flush_cache();
+            break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            *out_value = supervisor_flash_partition_get_size() / FILESYSTEM_BLOCK_SIZE;
+            break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            *out_value = FILESYSTEM_BLOCK_SIZE;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+bool data_drive_enable(void) {
+    if (_data_vfs.base.type != NULL) {
+        return true;
+    }
+    if (supervisor_flash_partition_get_size() < 64 * SECTOR_SIZE) {
+        // No partition, or too small for a FAT filesystem worth having.
+        return false;
+    }
+    if (_cache == NULL) {
+        _cache = port_malloc(SECTOR_SIZE, false);
+        if (_cache == NULL) {
+            return false;
+        }
+    }
+
+    fs_user_mount_t *vfs = &_data_vfs;
+    vfs->base.type = &mp_fat_vfs_type;
+    vfs->blockdev.flags = MP_BLOCKDEV_FLAG_NATIVE | MP_BLOCKDEV_FLAG_HAVE_IOCTL;
+    vfs->blockdev.block_size = FILESYSTEM_BLOCK_SIZE;
+    vfs->fatfs.drv = vfs;
+    vfs->blockdev.readblocks[0] = mp_const_none;
+    vfs->blockdev.readblocks[1] = mp_const_none;
+    vfs->blockdev.readblocks[2] = (mp_obj_t)data_drive_read_blocks; // native version
+    vfs->blockdev.writeblocks[0] = mp_const_none;
+    vfs->blockdev.writeblocks[1] = mp_const_none;
+    vfs->blockdev.writeblocks[2] = (mp_obj_t)data_drive_write_blocks; // native version
+    vfs->blockdev.u.ioctl[0] = mp_const_none;
+    vfs->blockdev.u.ioctl[1] = mp_const_none;
+    vfs->blockdev.u.ioctl[2] = (mp_obj_t)data_drive_ioctl; // native version
+
+    FRESULT res = f_mount(&vfs->fatfs);
+    if (res == FR_NO_FILESYSTEM) {
+        uint8_t working_buf[FF_MAX_SS];
+        res = f_mkfs(&vfs->fatfs, FM_FAT | FM_SFD, 0, working_buf, sizeof(working_buf));
+        if (res == FR_OK) {
+            res = f_setlabel(&vfs->fatfs, "DATA");
+        }
+        data_drive_flush_cache();
+    }
+    if (res != FR_OK) {
+        vfs->base.type = NULL;
+        return false;
+    }
+
+    // Link the mount in just before CIRCUITPY, which is always last. That
+    // keeps it behind any heap allocated mounts, so it survives the VM ending.
+    mp_vfs_mount_t *mount = &_data_mount;
+    mount->str = "/data";
+    mount->len = 5;
+    mount->obj = MP_OBJ_FROM_PTR(vfs);
+    mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table);
+    while (*vfsp != NULL && (*vfsp)->next != NULL) {
+        vfsp = &(*vfsp)->next;
+    }
+    mount->next = *vfsp;
+    *vfsp = mount;
+    #if MICROPY_MODULE_PATH_CACHE
+    mp_module_path_cache_invalidate();
+    #endif
+    return true;
+}
+
+fs_user_mount_t *data_drive_vfs(void) {
+    if (_data_vfs.base.type == NULL) {
+        return NULL;
+    }
+    return &_data_vfs;
+}
+
+void data_drive_flush(void) {
+    data_drive_flush_cache();
+}
+
+bool data_drive_take_changed(void) {
+    bool changed = _changed;
+    _changed = false;
+    return changed;
+}
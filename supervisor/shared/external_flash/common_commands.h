@@ -9,10 +9,13 @@
 #define CMD_READ_DATA 0x03
 #define CMD_FAST_READ_DATA 0x0B
 #define CMD_SECTOR_ERASE 0x20
+#define CMD_BLOCK_ERASE_32K 0x52
+#define CMD_BLOCK_ERASE_64K 0xd8
 // #define CMD_SECTOR_ERASE CMD_READ_JEDEC_ID
 #define CMD_DISABLE_WRITE 0x04
 #define CMD_ENABLE_WRITE 0x06
 #define CMD_PAGE_PROGRAM 0x02
+#define CMD_QUAD_PAGE_PROGRAM 0x32
 // #define CMD_PAGE_PROGRAM CMD_READ_JEDEC_ID
 #define CMD_READ_STATUS 0x05
 #define CMD_READ_STATUS2 0x35
@@ -87,7 +87,7 @@ static bool write_flash(uint32_t address, const uint8_t *data, uint32_t data_len
     if (!flash_device->no_erase_cmd) {
         // Only do this if the device has an erase command
         bool all_ones = true;
-        for (uint16_t i = 0; i < data_length; i++) {
+        for (uint32_t i = 0; i < data_length; i++) {
             if (data[i] != 0xff) {
                 all_ones = false;
                 break;
@@ -135,7 +135,7 @@ static bool page_erased(uint32_t sector_address) {
     uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
     if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
         for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+            if (full_buffer[i] != 0xff) {
                 return false;
             }
         }
@@ -164,6 +164,21 @@ static bool erase_sector(uint32_t sector_address) {
     return true;
 }
 
+// Erases size bytes starting at address with a single command. size must be
+// one of the erase sizes below and address must be aligned to it.
+static bool erase_region(uint32_t address, uint32_t size) {
+    if (size == SPI_FLASH_ERASE_SIZE) {
+        return erase_sector(address);
+    }
+    if (flash_device->no_erase_cmd) {
+        return true;
+    }
+    if (!wait_for_flash_ready() || !write_enable()) {
+        return false;
+    }
+    return spi_flash_sector_command(size == SPI_FLASH_BLOCK_ERASE_64K_SIZE ? CMD_BLOCK_ERASE_64K : CMD_BLOCK_ERASE_32K, address);
+}
+
 // Sector is really 24 bits.
 static bool copy_block(uint32_t src_address, uint32_t dest_address) {
     // Copy page by page to minimize RAM buffer.
@@ -542,23 +557,157 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+// Whether the current contents of the block are in the cache rather than flash.
+static bool block_cached(uint32_t block) {
+    uint32_t address = block * FILESYSTEM_BLOCK_SIZE;
+    return current_sector == (address & ~(SPI_FLASH_ERASE_SIZE - 1)) &&
+           (dirty_mask & (1 << (block % BLOCKS_PER_SECTOR))) != 0;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    if (flash_device == NULL || block_num + num_blocks > supervisor_flash_get_block_count()) {
+        return 1; // error
+    }
+    while (num_blocks > 0) {
+        // Read each run of blocks that live in flash with a single command,
+        // rather than one command per block.
+        uint32_t run = 0;
+        while (run < num_blocks && !block_cached(block_num + run)) {
+            run++;
+        }
+        if (run == 0) {
+            if (!external_flash_read_block(dest, block_num)) {
+                return 1; // error
+            }
+            run = 1;
+        } else if (!read_flash(block_num * FILESYSTEM_BLOCK_SIZE, dest, run * FILESYSTEM_BLOCK_SIZE)) {
             return 1; // error
         }
+        dest += run * FILESYSTEM_BLOCK_SIZE;
+        block_num += run;
+        num_blocks -= run;
     }
     return 0; // success
 }
 
+// Returns the largest erase size that starts at address and fits in length
+// bytes, or 0 if no whole erase sector does.
+static uint32_t whole_erase_size(uint32_t address, uint32_t length) {
+    static const uint32_t erase_sizes[] = {
+        SPI_FLASH_BLOCK_ERASE_64K_SIZE,
+        SPI_FLASH_BLOCK_ERASE_32K_SIZE,
+        SPI_FLASH_ERASE_SIZE,
+    };
+    for (size_t i = 0; i < MP_ARRAY_SIZE(erase_sizes); i++) {
+        if (address % erase_sizes[i] == 0 && length >= erase_sizes[i]) {
+            return erase_sizes[i];
+        }
+    }
+    return 0;
+}
+
+// Writes a run of blocks that replaces whole erase sectors. The old contents
+// don't need to be preserved so the sectors are erased with the largest
+// command that fits and then programmed directly, without going through the
+// cache.
+static bool write_whole_sectors(const uint8_t *src, uint32_t address, uint32_t size) {
+    // Anything cached for these sectors is being replaced.
+    if (current_sector != NO_SECTOR_LOADED &&
+        current_sector >= address && current_sector < address + size) {
+        current_sector = NO_SECTOR_LOADED;
+        dirty_mask = 0;
+    }
+    if (!erase_region(address, size)) {
+        return false;
+    }
+    // Program page by page so that pages of all 1s are skipped.
+    for (uint32_t offset = 0; offset < size; offset += SPI_FLASH_PAGE_SIZE) {
+        if (!write_flash(address + offset, src + offset, SPI_FLASH_PAGE_SIZE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
-            return 1; // error
+    if (flash_device == NULL || block_num + num_blocks > supervisor_flash_get_block_count()) {
+        return 1; // error
+    }
+    while (num_blocks > 0) {
+        uint32_t address = block_num * FILESYSTEM_BLOCK_SIZE;
+        uint32_t erase_size = whole_erase_size(address, num_blocks * FILESYSTEM_BLOCK_SIZE);
+        if (erase_size > 0) {
+            if (!write_whole_sectors(src, address, erase_size)) {
+                return 1; // error
+            }
+        } else {
+            if (!external_flash_write_block(src, block_num)) {
+                return 1; // error
+            }
+            erase_size = FILESYSTEM_BLOCK_SIZE;
         }
+        uint32_t blocks_written = erase_size / FILESYSTEM_BLOCK_SIZE;
+        src += erase_size;
+        block_num += blocks_written;
+        num_blocks -= blocks_written;
     }
     return 0; // success
 }
 
+#if CIRCUITPY_LITTLEFS
+// Byte-addressed access to the CIRCUITPY region for LittleFS, which does its
+// own erase management and so bypasses the sector cache above. The scratch
+// sector at the end of flash stays outside the region.
+uint32_t supervisor_flash_raw_get_size(void) {
+    return supervisor_flash_get_block_count() * FILESYSTEM_BLOCK_SIZE;
+}
+
+static bool raw_prepare(uint32_t address, uint32_t len) {
+    if (flash_device == NULL || address + len > supervisor_flash_raw_get_size()) {
+        return false;
+    }
+    // Write back anything FAT left in the cache so the two views agree.
+    if (current_sector != NO_SECTOR_LOADED) {
+        supervisor_flash_release_cache();
+    }
+    return true;
+}
+
+bool supervisor_flash_raw_read(uint32_t address, uint8_t *dest, uint32_t len) {
+    if (!raw_prepare(address, len)) {
+        return false;
+    }
+    return read_flash(address, dest, len);
+}
+
+bool supervisor_flash_raw_prog(uint32_t address, const uint8_t *src, uint32_t len) {
+    if (!raw_prepare(address, len)) {
+        return false;
+    }
+    // Page programs wrap within the page, so split at page boundaries.
+    while (len > 0) {
+        uint32_t chunk = SPI_FLASH_PAGE_SIZE - (address % SPI_FLASH_PAGE_SIZE);
+        if (chunk > len) {
+            chunk = len;
+        }
+        if (!wait_for_flash_ready() || !write_enable() ||
+            !spi_flash_write_data(address, (uint8_t *)src, chunk)) {
+            return false;
+        }
+        address += chunk;
+        src += chunk;
+        len -= chunk;
+    }
+    return wait_for_flash_ready();
+}
+
+bool supervisor_flash_raw_erase(uint32_t address) {
+    if ((address % SPI_FLASH_ERASE_SIZE) != 0 || !raw_prepare(address, SPI_FLASH_ERASE_SIZE)) {
+        return false;
+    }
+    return erase_sector(address) && wait_for_flash_ready();
+}
+#endif
+
 void MP_WEAK external_flash_setup(void) {
 }
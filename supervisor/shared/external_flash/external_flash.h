@@ -16,6 +16,9 @@
 // These are common across all NOR Flash.
 #define SPI_FLASH_ERASE_SIZE (1 << 12)
 #define SPI_FLASH_PAGE_SIZE (256)
+// Larger block erases, used when a write replaces a whole aligned block.
+#define SPI_FLASH_BLOCK_ERASE_32K_SIZE (1 << 15)
+#define SPI_FLASH_BLOCK_ERASE_64K_SIZE (1 << 16)
 
 #define SPI_FLASH_SYSTICK_MASK    (0x1ff) // 512ms
 #define SPI_FLASH_IDLE_TICK(tick) (((tick) & SPI_FLASH_SYSTICK_MASK) == 2)
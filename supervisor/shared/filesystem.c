@@ -11,36 +11,51 @@
 #include "lib/oofatfs/diskio.h"
 
 #include "py/mpstate.h"
+#if CIRCUITPY_LITTLEFS
+#include "extmod/vfs_lfs.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#endif
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
+#include "supervisor/shared/perf.h"
+#include "supervisor/shared/trace.h"
+#include "supervisor/shared/tick.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
+#if CIRCUITPY_LITTLEFS
+static bool _internal_littlefs;
+#endif
 
-static volatile uint32_t filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
 volatile bool filesystem_flush_requested = false;
 
+static void filesystem_flush_due(void) {
+    // Flushed by filesystem_background() from the tick this is called in.
+    filesystem_flush_requested = true;
+}
+
+static supervisor_deadline_t filesystem_flush_deadline = { .fun = filesystem_flush_due };
+
 void filesystem_background(void) {
     if (filesystem_flush_requested) {
-        filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+        uint32_t perf_start = perf_begin();
+        trace_event(TRACE_EVENT_FLUSH_START, 0);
         // Flush but keep caches
         supervisor_flash_flush();
         filesystem_flush_requested = false;
+        perf_end(PERF_COUNTER_FLUSH, perf_start);
+        trace_event(TRACE_EVENT_FLUSH_END, 0);
     }
 }
 
-inline void filesystem_tick(void) {
-    if (filesystem_flush_interval_ms == 0) {
-        // 0 means not turned on.
-        return;
-    }
-    if (filesystem_flush_interval_ms == 1) {
-        filesystem_flush_requested = true;
-        filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
-    } else {
-        filesystem_flush_interval_ms--;
+void filesystem_flush_later(void) {
+    #if CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS > 0
+    if (!filesystem_flush_deadline.pending) {
+        supervisor_deadline_set_after_ms(&filesystem_flush_deadline, CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS);
     }
+    #endif
 }
 
 
@@ -82,6 +97,14 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 
     // try to mount the flash
     FRESULT res = f_mount(&vfs_fat->fatfs);
+    #if CIRCUITPY_LITTLEFS
+    // Don't format over a LittleFS filesystem. It has no FAT view, so it is
+    // mounted by filesystem_mount_littlefs() each time the VM starts instead.
+    _internal_littlefs = res == FR_NO_FILESYSTEM && !force_create && supervisor_flash_raw_is_littlefs();
+    if (_internal_littlefs) {
+        return true;
+    }
+    #endif
     if ((res == FR_NO_FILESYSTEM && create_allowed) || force_create) {
         // No filesystem so create a fresh one, or reformat has been requested.
         uint8_t working_buf[FF_MAX_SS];
@@ -166,12 +189,76 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     return true;
 }
 
+#if CIRCUITPY_LITTLEFS
+// VfsLfs2 arguments for the raw CIRCUITPY region: program whole flash pages.
+static void littlefs_args(mp_obj_t args[3]) {
+    args[0] = supervisor_flash_raw_blockdev();
+    args[1] = MP_OBJ_NEW_QSTR(MP_QSTR_progsize);
+    args[2] = MP_OBJ_NEW_SMALL_INT(SPI_FLASH_PAGE_SIZE);
+}
+
+static mp_obj_t littlefs_new(void) {
+    mp_obj_t args[3];
+    littlefs_args(args);
+    return MP_OBJ_TYPE_GET_SLOT(&mp_type_vfs_lfs2, make_new)(&mp_type_vfs_lfs2, 1, 1, args);
+}
+
+// Mount the LittleFS CIRCUITPY at /. The mount lives on the heap, so stop_mp()
+// drops it with the other heap mounts and this is repeated for every VM.
+void filesystem_mount_littlefs(void) {
+    if (!_internal_littlefs) {
+        return;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_vfs_mount_t *vfs = m_new_obj(mp_vfs_mount_t);
+        vfs->str = "/";
+        vfs->len = 1;
+        vfs->obj = littlefs_new();
+        vfs->next = MP_STATE_VM(vfs_mount_table);
+        MP_STATE_VM(vfs_mount_table) = vfs;
+        MP_STATE_VM(vfs_cur) = vfs;
+        nlr_pop();
+    }
+    // If the mount fails, the VM runs without a root filesystem.
+}
+
+// Format the CIRCUITPY region as LittleFS and create the same starter files
+// as a fresh FAT filesystem. Needs the VM and raises on failure.
+void filesystem_format_littlefs(void) {
+    mp_obj_t args[3];
+    littlefs_args(args);
+    mp_obj_t mkfs = mp_load_attr(MP_OBJ_FROM_PTR(&mp_type_vfs_lfs2), MP_QSTR_mkfs);
+    mp_call_function_n_kw(mkfs, 1, 1, args);
+
+    mp_obj_t vfs = littlefs_new();
+    mp_obj_t dest[4];
+    mp_load_method(vfs, MP_QSTR_mkdir, dest);
+    dest[2] = mp_obj_new_str("/lib", 4);
+    mp_call_method_n_kw(1, 0, dest);
+
+    static const char code_py[] = "print(\"Hello World!\")\n";
+    mp_load_method(vfs, MP_QSTR_open, dest);
+    dest[2] = mp_obj_new_str("/code.py", 8);
+    dest[3] = mp_obj_new_str("w", 1);
+    mp_obj_t file = mp_call_method_n_kw(2, 0, dest);
+    mp_stream_write(file, code_py, sizeof(code_py) - 1, MP_STREAM_RW_WRITE);
+    mp_stream_close(file);
+}
+#endif
+
 void PLACE_IN_ITCM(filesystem_flush)(void) {
-    // Reset interval before next flush.
-    filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    uint32_t perf_start = perf_begin();
+    trace_event(TRACE_EVENT_FLUSH_START, 0);
+    supervisor_deadline_cancel(&filesystem_flush_deadline);
     supervisor_flash_flush();
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    data_drive_flush();
+    #endif
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
+    perf_end(PERF_COUNTER_FLUSH, perf_start);
+    trace_event(TRACE_EVENT_FLUSH_END, 0);
 }
 
 void filesystem_set_internal_writable_by_usb(bool writable) {
@@ -211,11 +298,17 @@ void filesystem_set_concurrent_write_protection(fs_user_mount_t *vfs, bool concu
 }
 
 bool filesystem_present(void) {
+    #if CIRCUITPY_LITTLEFS
+    if (_internal_littlefs) {
+        return true;
+    }
+    #endif
     return _mp_vfs.len > 0;
 }
 
 fs_user_mount_t *filesystem_circuitpy(void) {
-    if (!filesystem_present()) {
+    // Only a FAT CIRCUITPY is visible to the workflows.
+    if (_mp_vfs.len == 0) {
         return NULL;
     }
     return &_internal_vfs;
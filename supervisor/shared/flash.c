@@ -5,10 +5,15 @@
 // SPDX-License-Identifier: MIT
 #include "supervisor/flash.h"
 
+#include <string.h>
+
 #include "extmod/vfs_fat.h"
+#include "py/mperrno.h"
 #include "py/runtime.h"
 #include "lib/oofatfs/ff.h"
+#include "supervisor/filesystem.h"
 #include "supervisor/flash.h"
+#include "supervisor/shared/progress.h"
 #include "supervisor/shared/tick.h"
 
 #define VFS_INDEX 0
@@ -106,24 +111,22 @@ static mp_uint_t flash_write_blocks(mp_obj_t self, const uint8_t *src, uint32_t
         return 0;
     } else {
         if (!filesystem_dirty) {
-            // Turn on ticks so that we can flush after a period of time elapses.
-            supervisor_enable_tick();
+            // Flush after a period of time elapses.
+            filesystem_flush_later();
             filesystem_dirty = true;
         }
+        supervisor_progress();
         return supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
     }
 }
 
 void PLACE_IN_ITCM(supervisor_flash_flush)(void) {
+    supervisor_progress();
     #if INTERNAL_FLASH_FILESYSTEM
     port_internal_flash_flush();
     #else
     supervisor_external_flash_flush();
     #endif
-    // Turn off ticks now that our filesystem has been flushed.
-    if (filesystem_dirty) {
-        supervisor_disable_tick();
-    }
     filesystem_dirty = false;
 }
 
@@ -211,3 +214,99 @@ void supervisor_flash_init_vfs(fs_user_mount_t *vfs) {
     vfs->blockdev.u.ioctl[1] = (mp_obj_t)&supervisor_flash_obj;
     vfs->blockdev.u.ioctl[2] = (mp_obj_t)flash_ioctl; // native version
 }
+
+#if CIRCUITPY_LITTLEFS
+// Raw view of the CIRCUITPY region for LittleFS, with erase-sized blocks and
+// no fake MBR. It follows the extended block protocol: readblocks and
+// writeblocks take a byte offset, and ioctl handles BLOCK_ERASE.
+#define RAW_BLOCK_SIZE (SPI_FLASH_ERASE_SIZE)
+
+const mp_obj_type_t supervisor_flash_raw_type;
+static const mp_obj_base_t supervisor_flash_raw_obj = {&supervisor_flash_raw_type};
+
+mp_obj_t supervisor_flash_raw_blockdev(void) {
+    return MP_OBJ_FROM_PTR(&supervisor_flash_raw_obj);
+}
+
+static uint32_t raw_address(size_t n_args, const mp_obj_t *args) {
+    uint32_t address = mp_obj_get_int(args[1]) * RAW_BLOCK_SIZE;
+    if (n_args > 3) {
+        address += mp_obj_get_int(args[3]);
+    }
+    return address;
+}
+
+static mp_obj_t supervisor_flash_raw_readblocks(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    bool ok = supervisor_flash_raw_read(raw_address(n_args, args), bufinfo.buf, bufinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_flash_raw_readblocks_obj, 3, 4, supervisor_flash_raw_readblocks);
+
+static mp_obj_t supervisor_flash_raw_writeblocks(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+    uint32_t address = raw_address(n_args, args);
+    bool ok = true;
+    if (n_args == 3) {
+        // Without an offset, whole blocks are replaced, so erase them first.
+        for (uint32_t a = address; ok && a < address + bufinfo.len; a += RAW_BLOCK_SIZE) {
+            ok = supervisor_flash_raw_erase(a);
+        }
+    }
+    ok = ok && supervisor_flash_raw_prog(address, bufinfo.buf, bufinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_flash_raw_writeblocks_obj, 3, 4, supervisor_flash_raw_writeblocks);
+
+static mp_obj_t supervisor_flash_raw_ioctl(mp_obj_t self, mp_obj_t cmd_in, mp_obj_t arg_in) {
+    mp_int_t cmd = mp_obj_get_int(cmd_in);
+    switch (cmd) {
+        case MP_BLOCKDEV_IOCTL_INIT:
+        case MP_BLOCKDEV_IOCTL_DEINIT:
+        case MP_BLOCKDEV_IOCTL_SYNC:
+            // Programs and erases complete before returning.
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            return MP_OBJ_NEW_SMALL_INT(supervisor_flash_raw_get_size() / RAW_BLOCK_SIZE);
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            return MP_OBJ_NEW_SMALL_INT(RAW_BLOCK_SIZE);
+        case MP_BLOCKDEV_IOCTL_BLOCK_ERASE: {
+            bool ok = supervisor_flash_raw_erase(mp_obj_get_int(arg_in) * RAW_BLOCK_SIZE);
+            return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+        }
+        default:
+            return mp_const_none;
+    }
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(supervisor_flash_raw_ioctl_obj, supervisor_flash_raw_ioctl);
+
+static const mp_rom_map_elem_t supervisor_flash_raw_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&supervisor_flash_raw_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&supervisor_flash_raw_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&supervisor_flash_raw_ioctl_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(supervisor_flash_raw_locals_dict, supervisor_flash_raw_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    supervisor_flash_raw_type,
+    MP_QSTR_Flash,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &supervisor_flash_raw_locals_dict
+    );
+
+// LittleFS keeps a superblock at the start of each of the first two blocks,
+// with the magic string after the revision count and tag.
+bool supervisor_flash_raw_is_littlefs(void) {
+    for (uint32_t block = 0; block < 2; block++) {
+        uint8_t magic[8];
+        if (supervisor_flash_raw_read(block * RAW_BLOCK_SIZE + 8, magic, sizeof(magic)) &&
+            memcmp(magic, "littlefs", sizeof(magic)) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
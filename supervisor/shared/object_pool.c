@@ -0,0 +1,160 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "supervisor/shared/object_pool.h"
+
+#include "supervisor/port_heap.h"
+
+#define SLOTS_PER_CHUNK (32)
+#define ALL_SLOTS (0xffffffff)
+
+typedef struct object_pool_chunk {
+    struct object_pool_chunk *next;
+    object_pool_t *pool;
+    // One bit per slot.
+    uint32_t used;
+    uint32_t marked;
+    uint32_t traced;
+    // Word aligned, so that the GC can trace the slots.
+    void *slots[];
+} object_pool_chunk_t;
+
+// The chunks of every pool.
+static object_pool_chunk_t *chunks;
+// The range of addresses the chunks cover, so that most pointers the GC finds
+// can be ruled out without walking the chunks.
+static uintptr_t chunks_start = UINTPTR_MAX;
+static uintptr_t chunks_end;
+// Set when a slot is marked, until its contents are traced.
+static bool trace_needed;
+
+static size_t chunk_size(object_pool_t *pool) {
+    return sizeof(object_pool_chunk_t) + SLOTS_PER_CHUNK * pool->slot_size;
+}
+
+static void *slot_ptr(object_pool_chunk_t *chunk, size_t slot) {
+    return (uint8_t *)chunk->slots + slot * chunk->pool->slot_size;
+}
+
+static void update_range(void) {
+    chunks_start = UINTPTR_MAX;
+    chunks_end = 0;
+    for (object_pool_chunk_t *chunk = chunks; chunk != NULL; chunk = chunk->next) {
+        uintptr_t start = (uintptr_t)chunk->slots;
+        chunks_start = MIN(chunks_start, start);
+        chunks_end = MAX(chunks_end, start + SLOTS_PER_CHUNK * chunk->pool->slot_size);
+    }
+}
+
+// Returns the chunk holding ptr and sets *slot, or NULL if ptr isn't the start
+// of a slot.
+static object_pool_chunk_t *find_slot(void *ptr, size_t *slot) {
+    uintptr_t p = (uintptr_t)ptr;
+    if (p < chunks_start || p >= chunks_end) {
+        return NULL;
+    }
+    for (object_pool_chunk_t *chunk = chunks; chunk != NULL; chunk = chunk->next) {
+        uintptr_t offset = p - (uintptr_t)chunk->slots;
+        size_t slot_size = chunk->pool->slot_size;
+        if (offset < SLOTS_PER_CHUNK * slot_size) {
+            if (offset % slot_size != 0) {
+                return NULL;
+            }
+            *slot = offset / slot_size;
+            return chunk;
+        }
+    }
+    return NULL;
+}
+
+void *object_pool_alloc(object_pool_t *pool) {
+    object_pool_chunk_t *chunk = chunks;
+    while (chunk != NULL && (chunk->pool != pool || chunk->used == ALL_SLOTS)) {
+        chunk = chunk->next;
+    }
+    if (chunk == NULL) {
+        chunk = port_malloc(chunk_size(pool), false);
+        if (chunk == NULL) {
+            return m_malloc(pool->slot_size);
+        }
+        chunk->pool = pool;
+        chunk->used = 0;
+        chunk->marked = 0;
+        chunk->traced = 0;
+        chunk->next = chunks;
+        chunks = chunk;
+        update_range();
+    }
+    size_t slot = __builtin_ctz(~chunk->used);
+    chunk->used |= 1u << slot;
+    void *ptr = slot_ptr(chunk, slot);
+    memset(ptr, 0, pool->slot_size);
+    return ptr;
+}
+
+void object_pool_free(void *ptr) {
+    size_t slot;
+    object_pool_chunk_t *chunk = find_slot(ptr, &slot);
+    if (chunk == NULL) {
+        m_free(ptr);
+        return;
+    }
+    chunk->used &= ~(1u << slot);
+}
+
+void object_pool_mark(void *ptr) {
+    size_t slot;
+    object_pool_chunk_t *chunk = find_slot(ptr, &slot);
+    if (chunk == NULL) {
+        return;
+    }
+    uint32_t bit = 1u << slot;
+    if ((chunk->used & bit) && !(chunk->marked & bit)) {
+        chunk->marked |= bit;
+        trace_needed = true;
+    }
+}
+
+bool object_pool_trace(void) {
+    if (!trace_needed) {
+        return false;
+    }
+    trace_needed = false;
+    for (object_pool_chunk_t *chunk = chunks; chunk != NULL; chunk = chunk->next) {
+        uint32_t untraced = chunk->marked & ~chunk->traced;
+        while (untraced != 0) {
+            size_t slot = __builtin_ctz(untraced);
+            untraced &= ~(1u << slot);
+            chunk->traced |= 1u << slot;
+            // This may mark more slots, and set trace_needed again.
+            gc_collect_root(slot_ptr(chunk, slot), chunk->pool->slot_size / sizeof(void *));
+        }
+    }
+    return true;
+}
+
+void object_pool_sweep(void) {
+    bool freed_chunk = false;
+    object_pool_chunk_t **chunkp = &chunks;
+    while (*chunkp != NULL) {
+        object_pool_chunk_t *chunk = *chunkp;
+        chunk->used &= chunk->marked;
+        chunk->marked = 0;
+        chunk->traced = 0;
+        if (chunk->used == 0) {
+            *chunkp = chunk->next;
+            port_free(chunk);
+            freed_chunk = true;
+        } else {
+            chunkp = &chunk->next;
+        }
+    }
+    if (freed_chunk) {
+        update_range();
+    }
+}
@@ -0,0 +1,61 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "py/gc.h"
+#include "py/obj.h"
+
+// Fixed size slots for native objects that are created very often, such as
+// keypad.Event. Slots come in chunks from the port heap, so allocating one
+// doesn't search the VM heap or fragment it.
+//
+// Slots are still garbage collected. The GC marks a slot when it finds a
+// pointer to its start, traces the slot's contents like any heap object and
+// frees unmarked slots when it sweeps. Pooled objects must not need a
+// finaliser. When the port heap is full, objects come from the VM heap as
+// usual.
+typedef struct {
+    size_t slot_size;
+} object_pool_t;
+
+// Slots are a whole number of words, so that every slot is word aligned.
+#define OBJECT_POOL(name, type) \
+    object_pool_t name = { .slot_size = (sizeof(type) + sizeof(void *) - 1) & ~(sizeof(void *) - 1) }
+
+#if CIRCUITPY_OBJECT_POOL
+// Returns a zeroed slot. Raises MemoryError if there is no memory anywhere.
+void *object_pool_alloc(object_pool_t *pool);
+// Frees an object from object_pool_alloc() now rather than at the next collection.
+void object_pool_free(void *ptr);
+
+// Called by the GC for every pointer that isn't into the VM heap.
+void object_pool_mark(void *ptr);
+// Traces the contents of slots marked since the last call. Returns true if
+// there were any, since tracing may mark more.
+bool object_pool_trace(void);
+// Frees unmarked slots, and chunks with no slots in use.
+void object_pool_sweep(void);
+#else
+static inline void *object_pool_alloc(object_pool_t *pool) {
+    return m_malloc(pool->slot_size);
+}
+static inline void object_pool_free(void *ptr) {
+    m_free(ptr);
+}
+#endif
+
+// Like mp_obj_malloc() but from a pool.
+#define object_pool_obj_malloc(pool, struct_type, obj_type) ((struct_type *)object_pool_obj_malloc_helper(pool, obj_type))
+
+static inline void *object_pool_obj_malloc_helper(object_pool_t *pool, const mp_obj_type_t *type) {
+    mp_obj_base_t *base = (mp_obj_base_t *)object_pool_alloc(pool);
+    base->type = type;
+    return base;
+}
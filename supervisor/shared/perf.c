@@ -0,0 +1,35 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "supervisor/shared/perf.h"
+
+static uint64_t counters[PERF_COUNTER_COUNT];
+static uint32_t last_cycles;
+static uint32_t cycles_high;
+
+uint64_t perf_cycles(void) {
+    uint32_t now = port_get_cpu_cycles();
+    if (now < last_cycles) {
+        cycles_high++;
+    }
+    last_cycles = now;
+    return ((uint64_t)cycles_high << 32) | now;
+}
+
+void perf_end(perf_counter_t counter, uint32_t start) {
+    // Wraps correctly for sections shorter than the counter's period.
+    counters[counter] += (uint32_t)perf_cycles() - start;
+}
+
+uint64_t perf_counter_get(perf_counter_t counter) {
+    return counters[counter];
+}
+
+void perf_counters_reset(void) {
+    memset(counters, 0, sizeof(counters));
+}
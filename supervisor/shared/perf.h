@@ -0,0 +1,52 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+
+// CPU cycles spent in parts of the runtime, so that CPU time can be split
+// between Python code and the runtime. Sections may nest: background work
+// includes any display refresh or USB work it runs.
+typedef enum {
+    PERF_COUNTER_GC,
+    PERF_COUNTER_BACKGROUND,
+    PERF_COUNTER_DISPLAY,
+    PERF_COUNTER_USB,
+    PERF_COUNTER_FLUSH,
+    PERF_COUNTER_COUNT,
+} perf_counter_t;
+
+#if CIRCUITPY_PERF_COUNTERS
+#include "supervisor/port.h"
+
+// The CPU cycle count extended to 64 bits. The port's counter is usually 32
+// bits, so it must be read at least once per wrap, which the counted
+// sections do while the VM runs.
+uint64_t perf_cycles(void);
+
+// Time a section with:
+//     uint32_t start = perf_begin();
+//     ...
+//     perf_end(PERF_COUNTER_GC, start);
+static inline uint32_t perf_begin(void) {
+    return port_get_cpu_cycles();
+}
+void perf_end(perf_counter_t counter, uint32_t start);
+
+uint64_t perf_counter_get(perf_counter_t counter);
+void perf_counters_reset(void);
+#else
+static inline uint32_t perf_begin(void) {
+    return 0;
+}
+static inline void perf_end(perf_counter_t counter, uint32_t start) {
+    (void)counter;
+    (void)start;
+}
+#endif
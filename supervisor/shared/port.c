@@ -23,9 +23,24 @@ MP_WEAK void port_wake_main_task_from_isr(void) {
 MP_WEAK void port_yield(void) {
 }
 
+MP_WEAK bool port_tick_after_ticks(uint32_t ticks) {
+    return false;
+}
+
+MP_WEAK bool port_light_sleep_for_ticks(uint32_t ticks) {
+    return false;
+}
+
 MP_WEAK void port_boot_info(void) {
 }
 
+MP_WEAK uint64_t port_get_raw_us(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    // A subtick is 1/32768 seconds, and 1000000 / 32768 is 15625 / 512.
+    return (ticks * 32 + subticks) * 15625 / 512;
+}
+
 MP_WEAK void port_heap_init(void) {
     uint32_t *heap_bottom = port_heap_get_bottom();
     uint32_t *heap_top = port_heap_get_top();
@@ -38,6 +53,14 @@ MP_WEAK void *port_malloc(size_t size, bool dma_capable) {
     return block;
 }
 
+MP_WEAK void *port_malloc_fast(size_t size) {
+    return port_malloc(size, false);
+}
+
+MP_WEAK bool port_heap_is_slow(const void *ptr) {
+    return false;
+}
+
 MP_WEAK void port_free(void *ptr) {
     tlsf_free(heap, ptr);
 }
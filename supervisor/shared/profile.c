@@ -0,0 +1,128 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "supervisor/shared/profile.h"
+
+#include "py/bc.h"
+#include "py/gc.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "py/runtime.h"
+
+// A statistical profiler: every tick, note which bytecode function is running.
+// The tick only records the function object's address, because the frame it
+// reads may be torn down at any moment. Addresses are checked against the heap
+// when the results are collected.
+
+typedef struct {
+    const void *fun;
+    uint32_t samples;
+} profile_entry_t;
+
+static profile_entry_t profile_entries[CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS];
+// Samples taken while no bytecode was running, or whose function didn't fit
+// in profile_entries.
+static uint32_t profile_unattributed;
+static volatile bool profile_running;
+
+void supervisor_profile_tick(void) {
+    if (!profile_running) {
+        return;
+    }
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        profile_unattributed++;
+        return;
+    }
+    const void *fun = code_state->fun_bc;
+    // Open addressing with linear probing, keyed on the function's address.
+    size_t start = ((uintptr_t)fun >> 4) % CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS;
+    for (size_t i = 0; i < CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS; i++) {
+        profile_entry_t *entry = &profile_entries[(start + i) % CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS];
+        if (entry->fun == fun) {
+            entry->samples++;
+            return;
+        }
+        if (entry->fun == NULL) {
+            entry->fun = fun;
+            entry->samples = 1;
+            return;
+        }
+    }
+    profile_unattributed++;
+}
+
+void supervisor_profile_start(void) {
+    profile_running = false;
+    memset(profile_entries, 0, sizeof(profile_entries));
+    profile_unattributed = 0;
+    profile_running = true;
+}
+
+void supervisor_profile_stop(void) {
+    profile_running = false;
+}
+
+static bool profile_fun_is_valid(const void *fun) {
+    // gc_nbytes() is 0 unless fun is the start of a live heap block.
+    if (gc_nbytes(fun) < sizeof(mp_obj_fun_bc_t)) {
+        return false;
+    }
+    const mp_obj_type_t *type = ((const mp_obj_base_t *)fun)->type;
+    return type == &mp_type_fun_bc || type == &mp_type_gen_wrap;
+}
+
+mp_obj_t supervisor_profile_result(void) {
+    // Take a consistent copy, then sort it by decreasing sample count.
+    bool running = profile_running;
+    profile_running = false;
+    profile_entry_t entries[CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS];
+    memcpy(entries, profile_entries, sizeof(entries));
+    uint32_t unattributed = profile_unattributed;
+    profile_running = running;
+
+    size_t n = 0;
+    for (size_t i = 0; i < CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS; i++) {
+        if (entries[i].fun == NULL) {
+            continue;
+        }
+        if (!profile_fun_is_valid(entries[i].fun)) {
+            unattributed += entries[i].samples;
+            continue;
+        }
+        profile_entry_t entry = entries[i];
+        size_t j = n;
+        while (j > 0 && entries[j - 1].samples < entry.samples) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = entry;
+        n++;
+    }
+
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < n; i++) {
+        const mp_obj_fun_bc_t *fun = entries[i].fun;
+        #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+        qstr source_file = fun->context->constants.qstr_table[0];
+        #else
+        qstr source_file = fun->context->constants.source_file;
+        #endif
+        mp_obj_t items[3] = {
+            MP_OBJ_NEW_QSTR(source_file),
+            MP_OBJ_NEW_QSTR(mp_obj_fun_get_name(MP_OBJ_FROM_PTR(fun))),
+            mp_obj_new_int_from_uint(entries[i].samples),
+        };
+        mp_obj_list_append(result, mp_obj_new_tuple(3, items));
+    }
+    if (unattributed > 0) {
+        mp_obj_t items[3] = { mp_const_none, mp_const_none, mp_obj_new_int_from_uint(unattributed) };
+        mp_obj_list_append(result, mp_obj_new_tuple(3, items));
+    }
+    return result;
+}
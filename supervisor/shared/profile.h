@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// Number of distinct Python functions the profiler can count samples for.
+#ifndef CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS
+#define CIRCUITPY_SUPERVISOR_PROFILE_FUNCTIONS (32)
+#endif
+
+// Called from supervisor_tick(), usually in an interrupt, to take a sample.
+void supervisor_profile_tick(void);
+
+void supervisor_profile_start(void);
+void supervisor_profile_stop(void);
+// Returns a list of (source_file, function_name, samples), busiest first.
+mp_obj_t supervisor_profile_result(void);
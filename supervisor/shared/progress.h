@@ -0,0 +1,28 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/mpconfig.h"
+
+// Long C operations that the VM waits on, such as erasing the filesystem or a
+// TLS handshake, can outlast a tight watchdog timeout. They are bracketed by
+// supervisor_long_operation_begin() and _end(), and call supervisor_progress()
+// each time they get a step further. The watchdog is fed on progress only
+// inside a bracket, so progress made for someone else, like USB writing the
+// filesystem, doesn't hide a VM that is stuck.
+#if CIRCUITPY_WATCHDOG
+void supervisor_long_operation_begin(void);
+void supervisor_long_operation_end(void);
+void supervisor_progress(void);
+#else
+static inline void supervisor_long_operation_begin(void) {
+}
+static inline void supervisor_long_operation_end(void) {
+}
+static inline void supervisor_progress(void) {
+}
+#endif
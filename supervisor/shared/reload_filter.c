@@ -0,0 +1,257 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "supervisor/shared/reload_filter.h"
+
+#include "lib/oofatfs/diskio.h"
+
+#define MAX_FILE_ENTRIES (32)
+#define MAX_FILE_EXTENTS (32)
+#define MAX_DIR_EXTENTS (16)
+#define MAX_PATH_LEN (128)
+#define DIR_ENTRY_SIZE (32)
+#define DIR_ENTRY_ATTR (11)
+// Attribute bits of a long name entry, as in ff.c.
+#define ATTR_LONG_NAME (0x0F)
+#define ATTR_MASK (0x3F)
+
+// Cluster chains are read into a linkmap: its size, (length, first cluster)
+// pairs and a terminating 0.
+#define LINKMAP_SIZE (1 + 2 * 8 + 1)
+
+typedef struct {
+    DWORD first_sector;
+    DWORD sector_count;
+} extent_t;
+
+typedef struct {
+    DWORD sector;
+    uint16_t offset;
+} dir_entry_t;
+
+// Only the filesystem code.py runs from is tracked.
+static FATFS *tracked_fs;
+// Something didn't fit, so every write needs a reload.
+static bool overflowed;
+
+static dir_entry_t file_entries[MAX_FILE_ENTRIES];
+static uint8_t num_file_entries;
+static extent_t file_extents[MAX_FILE_EXTENTS];
+static uint8_t num_file_extents;
+static extent_t dir_extents[MAX_DIR_EXTENTS];
+static uint8_t num_dir_extents;
+
+// Imports look up several names in each directory of the path, so skip
+// opening the same directory again.
+static char last_dir_path[MAX_PATH_LEN];
+
+// The previous contents of a directory sector the host is rewriting. Static
+// because the write callback may run on a small USB task stack.
+static uint8_t old_sector[FF_MIN_SS];
+
+static DWORD cluster_to_sector(FATFS *fs, DWORD cluster) {
+    return fs->database + (DWORD)fs->csize * (cluster - 2);
+}
+
+static bool in_extents(const extent_t *extents, uint8_t count, DWORD sector) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (sector - extents[i].first_sector < extents[i].sector_count) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void add_extent(extent_t *extents, uint8_t *count, uint8_t max, DWORD first_sector, DWORD sector_count) {
+    if (*count == max) {
+        overflowed = true;
+        return;
+    }
+    extents[*count].first_sector = first_sector;
+    extents[*count].sector_count = sector_count;
+    (*count)++;
+}
+
+// Add the sectors of obj's cluster chain. cltbl is the chain's linkmap if the
+// caller already has one, or NULL to read it here.
+static void add_chain(FATFS *fs, const FFOBJID *obj, DWORD *cltbl, extent_t *extents, uint8_t *count, uint8_t max) {
+    DWORD linkmap[LINKMAP_SIZE];
+    if (cltbl == NULL) {
+        // f_lseek() builds a linkmap for any object with a chain, so borrow a
+        // scratch FIL for directories and for files opened without one.
+        FIL fp;
+        memset(&fp, 0, sizeof(fp));
+        fp.obj = *obj;
+        linkmap[0] = LINKMAP_SIZE;
+        fp.cltbl = linkmap;
+        if (f_lseek(&fp, CREATE_LINKMAP) != FR_OK) {
+            overflowed = true;
+            return;
+        }
+        cltbl = linkmap;
+    }
+    for (DWORD *fragment = cltbl + 1; fragment[0] != 0; fragment += 2) {
+        add_extent(extents, count, max, cluster_to_sector(fs, fragment[1]), fragment[0] * fs->csize);
+    }
+}
+
+void reload_filter_reset(FATFS *fs) {
+    tracked_fs = fs;
+    overflowed = false;
+    num_file_entries = 0;
+    num_file_extents = 0;
+    num_dir_extents = 0;
+    last_dir_path[0] = '\0';
+    if (fs != NULL) {
+        // code.py and the import path start here.
+        reload_filter_track_lookup(fs, "/", true);
+    }
+}
+
+void reload_filter_track_file(FIL *fp) {
+    FATFS *fs = fp->obj.fs;
+    if (fs != tracked_fs || overflowed) {
+        return;
+    }
+    uint16_t offset = fp->dir_ptr - fs->win;
+    for (uint8_t i = 0; i < num_file_entries; i++) {
+        if (file_entries[i].sector == fp->dir_sect && file_entries[i].offset == offset) {
+            return;
+        }
+    }
+    if (num_file_entries == MAX_FILE_ENTRIES) {
+        overflowed = true;
+        return;
+    }
+    file_entries[num_file_entries].sector = fp->dir_sect;
+    file_entries[num_file_entries].offset = offset;
+    num_file_entries++;
+    if (fp->obj.sclust != 0) {
+        add_chain(fs, &fp->obj, fp->cltbl, file_extents, &num_file_extents, MAX_FILE_EXTENTS);
+    }
+}
+
+static void strip_last_name(char *path) {
+    char *slash = strrchr(path, '/');
+    if (slash == NULL) {
+        path[0] = '\0';
+    } else {
+        // Keep the root's slash.
+        slash[slash == path ? 1 : 0] = '\0';
+    }
+}
+
+void reload_filter_track_lookup(FATFS *fs, const char *path, bool is_dir) {
+    if (fs != tracked_fs || overflowed) {
+        return;
+    }
+    size_t len = strlen(path);
+    if (len >= MAX_PATH_LEN) {
+        overflowed = true;
+        return;
+    }
+    char dir_path[MAX_PATH_LEN];
+    memcpy(dir_path, path, len + 1);
+    if (!is_dir) {
+        strip_last_name(dir_path);
+    }
+    if (strcmp(dir_path, last_dir_path) == 0) {
+        return;
+    }
+    strcpy(last_dir_path, dir_path);
+
+    // Open the directory, or the closest one that exists, where it would be
+    // created.
+    FF_DIR dir;
+    while (f_opendir(fs, &dir, dir_path) != FR_OK) {
+        if (dir_path[0] == '\0' || strcmp(dir_path, "/") == 0) {
+            overflowed = true;
+            return;
+        }
+        strip_last_name(dir_path);
+    }
+
+    DWORD first_sector;
+    if (dir.obj.sclust == 0) {
+        // The FAT12/16 root directory sits in its own area before the data.
+        first_sector = fs->dirbase;
+    } else {
+        first_sector = cluster_to_sector(fs, dir.obj.sclust);
+    }
+    for (uint8_t i = 0; i < num_dir_extents; i++) {
+        if (dir_extents[i].first_sector == first_sector) {
+            f_closedir(&dir);
+            return;
+        }
+    }
+    if (dir.obj.sclust == 0) {
+        add_extent(dir_extents, &num_dir_extents, MAX_DIR_EXTENTS, fs->dirbase, fs->database - fs->dirbase);
+    } else {
+        add_chain(fs, &dir.obj, NULL, dir_extents, &num_dir_extents, MAX_DIR_EXTENTS);
+    }
+    f_closedir(&dir);
+}
+
+static bool is_tracked_entry(DWORD sector, uint16_t offset) {
+    for (uint8_t i = 0; i < num_file_entries; i++) {
+        if (file_entries[i].sector == sector && file_entries[i].offset == offset) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Changes to the size, time or clusters of a file nothing opened don't
+// matter. Any other change to a searched directory might.
+static bool dir_sector_needs_reload(FATFS *fs, DWORD sector, const uint8_t *new_sector) {
+    if (disk_read(fs->drv, old_sector, sector, 1) != RES_OK) {
+        return true;
+    }
+    for (uint16_t offset = 0; offset < FF_MIN_SS; offset += DIR_ENTRY_SIZE) {
+        const uint8_t *old_entry = old_sector + offset;
+        const uint8_t *new_entry = new_sector + offset;
+        if (memcmp(old_entry, new_entry, DIR_ENTRY_SIZE) == 0) {
+            continue;
+        }
+        if (is_tracked_entry(sector, offset) ||
+            // Name, including the free and deleted markers, or attributes.
+            memcmp(old_entry, new_entry, DIR_ENTRY_ATTR + 1) != 0 ||
+            // Long name entries change only when names do.
+            (old_entry[DIR_ENTRY_ATTR] & ATTR_MASK) == ATTR_LONG_NAME) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool reload_filter_write_needs_reload(FATFS *fs, uint32_t lba, const uint8_t *buffer, uint32_t block_count) {
+    if (fs != tracked_fs || overflowed) {
+        return true;
+    }
+    #if FF_MAX_SS != FF_MIN_SS
+    if (fs->ssize != FF_MIN_SS) {
+        return true;
+    }
+    #endif
+    for (uint32_t i = 0; i < block_count; i++) {
+        DWORD sector = lba + i;
+        if (sector < fs->fatbase) {
+            // Partition table or boot sector: the host may be reformatting.
+            return true;
+        }
+        if (in_extents(file_extents, num_file_extents, sector)) {
+            return true;
+        }
+        if (in_extents(dir_extents, num_dir_extents, sector) &&
+            dir_sector_needs_reload(fs, sector, buffer + i * FF_MIN_SS)) {
+            return true;
+        }
+    }
+    // The FAT itself, and data of files nothing opened.
+    return false;
+}
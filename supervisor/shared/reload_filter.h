@@ -0,0 +1,44 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+#include "lib/oofatfs/ff.h"
+
+// Decides whether a USB write to CIRCUITPY can change anything code.py used,
+// so that saving an unrelated file doesn't restart it.
+//
+// While code.py runs, the sectors it depends on are recorded: the data and
+// directory entry of every file it opened for reading (which includes every
+// module it imported), and every directory it searched or listed. A host write
+// needs a reload if it touches that data, changes one of those entries, or
+// creates, removes or renames any entry in one of those directories, since
+// that can change what an import finds. When the records overflow, every
+// write needs a reload, as before.
+#if CIRCUITPY_AUTORELOAD_FILTER
+// Start recording for a new run of code.py on fs.
+void reload_filter_reset(FATFS *fs);
+// Python opened fp read-only.
+void reload_filter_track_file(FIL *fp);
+// Python looked up path, or listed it when is_dir is true.
+void reload_filter_track_lookup(FATFS *fs, const char *path, bool is_dir);
+// Called before the host writes block_count blocks of buffer at lba.
+bool reload_filter_write_needs_reload(FATFS *fs, uint32_t lba, const uint8_t *buffer, uint32_t block_count);
+#else
+static inline void reload_filter_reset(FATFS *fs) {
+}
+static inline void reload_filter_track_file(FIL *fp) {
+}
+static inline void reload_filter_track_lookup(FATFS *fs, const char *path, bool is_dir) {
+}
+static inline bool reload_filter_write_needs_reload(FATFS *fs, uint32_t lba, const uint8_t *buffer, uint32_t block_count) {
+    return true;
+}
+#endif
@@ -4,16 +4,20 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <inttypes.h>
 #include <stdarg.h>
 #include <string.h>
 
+#include "py/misc.h"
 #include "py/mpconfig.h"
 #include "py/mphal.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "shared-bindings/terminalio/Terminal.h"
 #include "supervisor/shared/serial.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
 #if CIRCUITPY_SERIAL_BLE
@@ -63,6 +67,68 @@ static bool _serial_console_write_disabled;
 // Set to true to temporarily discard writes to the display terminal only.
 static bool _serial_display_write_disabled;
 
+// When set, writes are hashed into it instead of being sent anywhere.
+static uint32_t *_serial_write_hash;
+
+#if CIRCUITPY_TERMINALIO && CIRCUITPY_SERIAL_DISPLAY_BUFFER_SIZE > 0
+// Drawing text on the display terminal can take much longer than sending it
+// anywhere else, so it is queued here and drawn from a background callback
+// instead of holding up print().
+static char _display_buffer[CIRCUITPY_SERIAL_DISPLAY_BUFFER_SIZE];
+static size_t _display_buffer_start;
+static size_t _display_buffer_used;
+// Bytes discarded because the buffer was full.
+static uint32_t _display_dropped;
+static background_callback_t _display_callback = { .priority = BACKGROUND_CALLBACK_PRIORITY_BULK };
+
+static void display_buffer_draw(void *data) {
+    (void)data;
+    int errcode;
+    // Draw a limited amount at a time so that other background work isn't held up.
+    char chunk[CIRCUITPY_SERIAL_DISPLAY_DRAW_CHUNK];
+    size_t len = MIN(_display_buffer_used, sizeof(chunk));
+    for (size_t i = 0; i < len; i++) {
+        chunk[i] = _display_buffer[(_display_buffer_start + i) % sizeof(_display_buffer)];
+    }
+    // Don't split a UTF-8 character between chunks.
+    while (len > 1 && len < _display_buffer_used &&
+           (_display_buffer[(_display_buffer_start + len) % sizeof(_display_buffer)] & 0xc0) == 0x80) {
+        len--;
+    }
+    // Output may be written from an interrupt.
+    common_hal_mcu_disable_interrupts();
+    _display_buffer_start = (_display_buffer_start + len) % sizeof(_display_buffer);
+    _display_buffer_used -= len;
+    common_hal_mcu_enable_interrupts();
+    common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)chunk, len, &errcode);
+
+    if (_display_buffer_used > 0) {
+        background_callback_add_core(&_display_callback);
+    } else if (_display_dropped > 0) {
+        // Say where text is missing once everything before it has been drawn.
+        len = snprintf(chunk, sizeof(chunk), "\r\n[%" PRIu32 " bytes dropped]\r\n", _display_dropped);
+        _display_dropped = 0;
+        common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)chunk, MIN(len, sizeof(chunk)), &errcode);
+    }
+}
+
+static void display_buffer_write(const char *text, uint32_t length) {
+    common_hal_mcu_disable_interrupts();
+    size_t space = sizeof(_display_buffer) - _display_buffer_used;
+    if (length > space) {
+        _display_dropped += length - space;
+        length = space;
+    }
+    size_t end = _display_buffer_start + _display_buffer_used;
+    for (size_t i = 0; i < length; i++) {
+        _display_buffer[(end + i) % sizeof(_display_buffer)] = text[i];
+    }
+    _display_buffer_used += length;
+    common_hal_mcu_enable_interrupts();
+    background_callback_add(&_display_callback, display_buffer_draw, NULL);
+}
+#endif
+
 #if CIRCUITPY_CONSOLE_UART
 static void console_uart_print_strn(void *env, const char *str, size_t len) {
     (void)env;
@@ -323,6 +389,16 @@ uint32_t serial_write_substring(const char *text, uint32_t length) {
         return 0;
     }
 
+    if (_serial_write_hash != NULL) {
+        // FNV-1a
+        uint32_t hash = *_serial_write_hash;
+        for (uint32_t i = 0; i < length; i++) {
+            hash = (hash ^ (uint8_t)text[i]) * 16777619;
+        }
+        *_serial_write_hash = hash;
+        return length;
+    }
+
     // See https://github.com/micropython/micropython/pull/11850 for the motivation for returning
     // the number of chars written.
 
@@ -330,9 +406,13 @@ uint32_t serial_write_substring(const char *text, uint32_t length) {
     uint32_t length_sent = length;
 
     #if CIRCUITPY_TERMINALIO
-    int errcode;
     if (!_serial_display_write_disabled) {
+        #if CIRCUITPY_SERIAL_DISPLAY_BUFFER_SIZE > 0
+        display_buffer_write(text, length);
+        #else
+        int errcode;
         length_sent = common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+        #endif
     }
     #endif
 
@@ -409,3 +489,9 @@ bool serial_display_write_disable(bool disabled) {
     _serial_display_write_disabled = disabled;
     return now;
 }
+
+uint32_t *serial_write_hash(uint32_t *hash) {
+    uint32_t *now = _serial_write_hash;
+    _serial_write_hash = hash;
+    return now;
+}
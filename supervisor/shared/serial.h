@@ -32,6 +32,11 @@ bool serial_connected(void);
 bool serial_console_write_disable(bool disabled);
 bool serial_display_write_disable(bool disabled);
 
+// While hash is not NULL, writes are folded into *hash with FNV-1a instead of
+// being sent anywhere, to find out whether output would differ from before.
+// Returns the previous value.
+uint32_t *serial_write_hash(uint32_t *hash);
+
 // These have no-op versions that are weak and the port can override. They work
 // in tandem with the cross-port mechanics like USB and BLE.
 void port_serial_early_init(void);
@@ -12,6 +12,7 @@
 #include "supervisor/background_callback.h"
 #include "supervisor/shared/serial.h"
 #include "supervisor/shared/status_bar.h"
+#include "supervisor/shared/tick.h"
 
 #if CIRCUITPY_TERMINALIO
 #include "shared-module/terminalio/Terminal.h"
@@ -30,22 +31,59 @@ static background_callback_t status_bar_background_cb;
 static bool _forced_dirty = false;
 static bool _suspended = false;
 
+// Hash of the last status bar sent, and where it went, or 0 if it has been cleared.
+static uint32_t _last_hash = 0;
+static uint64_t _last_update_ms = 0;
+
+#if CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS > 0
+static void status_bar_deadline_due(void) {
+    background_callback_add_core(&status_bar_background_cb);
+}
+
+static supervisor_deadline_t status_bar_deadline = { .fun = status_bar_deadline_due };
+#endif
+
 // Clear if possible, but give up if we can't do it now.
 void supervisor_status_bar_clear(void) {
     if (!_suspended) {
         serial_write("\x1b" "]0;" "\x1b" "\\");
+        _last_hash = 0;
     }
 }
 
+static void status_bar_write(void) {
+    // Neighboring "..." "..." are concatenated by the compiler. Without this separation, the hex code
+    // doesn't get terminated after two following characters and the value is invalid.
+    // This is the OSC command to set the title and the icon text. It can be up to 255 characters
+    // but some may be cut off.
+    serial_write("\x1b" "]0;");
+    serial_write("🐍");
+
+    #if CIRCUITPY_WEB_WORKFLOW
+    supervisor_web_workflow_status();
+    serial_write(" | ");
+    #endif
+
+    #if CIRCUITPY_BLE_FILE_SERVICE || CIRCUITPY_SERIAL_BLE
+    supervisor_bluetooth_status();
+    serial_write(" | ");
+    #endif
+
+    supervisor_execution_status();
+    serial_write(" | ");
+    serial_write(MICROPY_GIT_TAG);
+    // Send string terminator
+    serial_write("\x1b" "\\");
+}
+
 void supervisor_status_bar_update(void) {
     if (_suspended) {
         supervisor_status_bar_request_update(true);
         return;
     }
+    bool forced = _forced_dirty;
     _forced_dirty = false;
 
-    shared_module_supervisor_status_bar_updated(&shared_module_supervisor_status_bar_obj);
-
     // Disable status bar console writes if supervisor.status_bar.console is False.
     // Also disable if there is no serial connection now. This avoids sending part
     // of the status bar update if the serial connection comes up during the update.
@@ -57,6 +95,25 @@ void supervisor_status_bar_update(void) {
     bool disable_display_writes =
         !shared_module_supervisor_status_bar_get_display(&shared_module_supervisor_status_bar_obj);
 
+    if (disable_console_writes && disable_display_writes) {
+        // There's nowhere to show it, so don't even work out what it would say.
+        return;
+    }
+
+    // Only send the status bar when it, or where it is going, has changed, unless
+    // a new connection needs it.
+    uint32_t hash = 2166136261u ^ (disable_console_writes ? 1 : 0) ^ (disable_display_writes ? 2 : 0);
+    uint32_t *prev_hash = serial_write_hash(&hash);
+    status_bar_write();
+    serial_write_hash(prev_hash);
+    if (hash == _last_hash && !forced) {
+        return;
+    }
+    _last_hash = hash;
+    _last_update_ms = supervisor_ticks_ms64();
+
+    shared_module_supervisor_status_bar_updated(&shared_module_supervisor_status_bar_obj);
+
     // Suppress writes to console and/or display if status bar is not enabled for either or both.
     bool prev_console_disable = false;
     bool prev_display_disable = false;
@@ -68,28 +125,7 @@ void supervisor_status_bar_update(void) {
         prev_display_disable = serial_display_write_disable(true);
     }
 
-    // Neighboring "..." "..." are concatenated by the compiler. Without this separation, the hex code
-    // doesn't get terminated after two following characters and the value is invalid.
-    // This is the OSC command to set the title and the icon text. It can be up to 255 characters
-    // but some may be cut off.
-    serial_write("\x1b" "]0;");
-    serial_write("🐍");
-
-    #if CIRCUITPY_WEB_WORKFLOW
-    supervisor_web_workflow_status();
-    serial_write(" | ");
-    #endif
-
-    #if CIRCUITPY_BLE_FILE_SERVICE || CIRCUITPY_SERIAL_BLE
-    supervisor_bluetooth_status();
-    serial_write(" | ");
-    #endif
-
-    supervisor_execution_status();
-    serial_write(" | ");
-    serial_write(MICROPY_GIT_TAG);
-    // Send string terminator
-    serial_write("\x1b" "\\");
+    status_bar_write();
 
     // Restore writes to console and/or display.
     if (disable_console_writes) {
@@ -115,9 +151,21 @@ static void status_bar_background(void *data) {
     dirty = dirty || supervisor_bluetooth_status_dirty();
     #endif
 
-    if (dirty) {
-        supervisor_status_bar_update();
+    if (!dirty) {
+        return;
+    }
+
+    #if CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS > 0
+    // Changes that come in quick succession, such as while a network connects,
+    // are shown together once the interval is up.
+    uint64_t since = supervisor_ticks_ms64() - _last_update_ms;
+    if (since < CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS) {
+        supervisor_deadline_set_after_ms(&status_bar_deadline, CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS - since);
+        return;
     }
+    #endif
+
+    supervisor_status_bar_update();
 }
 
 void supervisor_status_bar_start(void) {
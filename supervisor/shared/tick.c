@@ -14,6 +14,7 @@
 #include "supervisor/background_callback.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/stack.h"
+#include "supervisor/shared/trace.h"
 
 #if CIRCUITPY_BLEIO_HCI
 #include "common-hal/_bleio/__init__.h"
@@ -27,6 +28,14 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_AUTO_LIGHT_SLEEP_MS > 0 && CIRCUITPY_USB_DEVICE
+#include "supervisor/usb.h"
+#endif
+
+#if CIRCUITPY_SUPERVISOR_PROFILE
+#include "supervisor/shared/profile.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 
 #if CIRCUITPY_WATCHDOG
@@ -38,13 +47,22 @@
 
 static volatile uint64_t PLACE_IN_DTCM_BSS(background_ticks);
 
-static background_callback_t tick_callback;
+// Ticks drive display refresh and filesystem flushes, so they are bulk work.
+static background_callback_t tick_callback = { .priority = BACKGROUND_CALLBACK_PRIORITY_BULK };
 
 static volatile uint64_t last_finished_tick = 0;
 
 static volatile size_t tick_enable_count = 0;
 
+// Pending deadlines, earliest first.
+static supervisor_deadline_t *deadline_head = NULL;
+
+// Whether the port's 1/1024 second tick is running, either because it was
+// asked for or because the port can't interrupt for a single deadline.
+static bool tick_running = false;
+
 static void supervisor_background_tick(void *unused) {
+    trace_event(TRACE_EVENT_TICK_START, 0);
     port_start_background_tick();
 
     assert_heap_ok();
@@ -66,22 +84,75 @@ static void supervisor_background_tick(void *unused) {
     last_finished_tick = port_get_raw_ticks(NULL);
 
     port_finish_background_tick();
+    trace_event(TRACE_EVENT_TICK_END, 0);
 }
 
 bool supervisor_background_ticks_ok(void) {
     return port_get_raw_ticks(NULL) - last_finished_tick < 1024;
 }
 
-void supervisor_tick(void) {
-    #if CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS > 0
-    filesystem_tick();
-    #endif
+// Run the tick the way the current requests need: every tick, once at the
+// earliest deadline, or not at all. Must be called with interrupts disabled.
+static void supervisor_tick_schedule(void) {
+    uint32_t after = 0;
+    if (tick_enable_count == 0 && deadline_head != NULL) {
+        uint64_t now = port_get_raw_ticks(NULL);
+        after = 1;
+        if (deadline_head->ticks > now + 1) {
+            after = MIN(deadline_head->ticks - now, UINT32_MAX);
+        }
+    }
+    // Stop the tick before asking for a single one, in case the port shares a timer.
+    if (tick_enable_count == 0 && tick_running) {
+        port_disable_tick();
+        tick_running = false;
+    }
+    bool single = port_tick_after_ticks(after);
+    if ((tick_enable_count > 0 || (after > 0 && !single)) && !tick_running) {
+        port_enable_tick();
+        tick_running = true;
+    }
+}
 
+// Remove the deadlines that have passed and call their functions.
+static void supervisor_deadline_run(void) {
+    uint64_t now = port_get_raw_ticks(NULL);
+    bool expired = false;
+    while (true) {
+        common_hal_mcu_disable_interrupts();
+        supervisor_deadline_t *deadline = deadline_head;
+        if (deadline == NULL || deadline->ticks > now) {
+            // A single tick may come early, so ask again when nothing was due.
+            if (expired || !tick_running) {
+                supervisor_tick_schedule();
+            }
+            common_hal_mcu_enable_interrupts();
+            return;
+        }
+        deadline_head = deadline->next;
+        deadline->next = NULL;
+        deadline->pending = false;
+        common_hal_mcu_enable_interrupts();
+        expired = true;
+        // fun may set the deadline again.
+        if (deadline->fun != NULL) {
+            deadline->fun();
+        }
+    }
+}
 
+void supervisor_tick(void) {
+    if (deadline_head != NULL) {
+        supervisor_deadline_run();
+    }
     #if CIRCUITPY_KEYPAD
     keypad_tick();
     #endif
 
+    #if CIRCUITPY_SUPERVISOR_PROFILE
+    supervisor_profile_tick();
+    #endif
+
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -96,6 +167,37 @@ uint32_t supervisor_ticks_ms32() {
     return supervisor_ticks_ms64();
 }
 
+uint64_t supervisor_ticks_us64() {
+    return port_get_raw_us();
+}
+
+#if CIRCUITPY_AUTO_LIGHT_SLEEP_MS > 0
+// Light sleep for up to the given number of ticks, if nothing needs the CPU
+// awake before then. Returns false if the caller should idle instead.
+static bool supervisor_light_sleep(uint64_t ticks) {
+    // A running tick means something, such as audio or HCI, polls from it.
+    if (tick_enable_count > 0 || background_callback_pending()) {
+        return false;
+    }
+    #if CIRCUITPY_USB_DEVICE
+    // The host would see the device drop off the bus.
+    if (usb_connected()) {
+        return false;
+    }
+    #endif
+    common_hal_mcu_disable_interrupts();
+    if (deadline_head != NULL) {
+        uint64_t now = port_get_raw_ticks(NULL);
+        ticks = deadline_head->ticks > now ? MIN(ticks, deadline_head->ticks - now) : 0;
+    }
+    common_hal_mcu_enable_interrupts();
+    if (ticks * 1000 < CIRCUITPY_AUTO_LIGHT_SLEEP_MS * 1024) {
+        return false;
+    }
+    return port_light_sleep_for_ticks(MIN(ticks, UINT32_MAX));
+}
+#endif
+
 void mp_hal_delay_ms(mp_uint_t delay_ms) {
     uint64_t start_tick = port_get_raw_ticks(NULL);
     // Adjust the delay to ticks vs ms.
@@ -113,6 +215,12 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
         if (remaining < 1) {
             break;
         }
+        #if CIRCUITPY_AUTO_LIGHT_SLEEP_MS > 0
+        if (supervisor_light_sleep(remaining)) {
+            remaining = end_tick - port_get_raw_ticks(NULL);
+            continue;
+        }
+        #endif
         port_interrupt_after_ticks(remaining);
         // Idle until an interrupt happens.
         port_idle_until_interrupt();
@@ -120,12 +228,27 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
     }
 }
 
+// Called by mp_event_wait_ms() and mp_event_wait_indefinite() after they've run
+// the background tasks. A negative timeout means no timeout.
+void supervisor_event_wait_ms(mp_int_t timeout_ms) {
+    mp_int_t wait_ms = CIRCUITPY_EVENT_WAIT_MAX_MS;
+    if (timeout_ms >= 0 && timeout_ms < wait_ms) {
+        wait_ms = timeout_ms;
+    }
+    if (wait_ms <= 0 || background_callback_pending() || mp_hal_is_interrupted()) {
+        return;
+    }
+    port_interrupt_after_ticks((wait_ms * 1024 + 999) / 1000);
+    // Background callbacks wake the main task, which ends the wait early.
+    port_idle_until_interrupt();
+}
+
 void supervisor_enable_tick(void) {
     common_hal_mcu_disable_interrupts();
-    if (tick_enable_count == 0) {
-        port_enable_tick();
-    }
     tick_enable_count++;
+    if (tick_enable_count == 1) {
+        supervisor_tick_schedule();
+    }
     common_hal_mcu_enable_interrupts();
 }
 
@@ -135,7 +258,57 @@ void supervisor_disable_tick(void) {
         tick_enable_count--;
     }
     if (tick_enable_count == 0) {
-        port_disable_tick();
+        supervisor_tick_schedule();
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+// Unlink a pending deadline. Must be called with interrupts disabled.
+static void supervisor_deadline_remove(supervisor_deadline_t *deadline) {
+    supervisor_deadline_t **link = &deadline_head;
+    while (*link != NULL) {
+        if (*link == deadline) {
+            *link = deadline->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    deadline->next = NULL;
+    deadline->pending = false;
+}
+
+void supervisor_deadline_set(supervisor_deadline_t *deadline, uint64_t ticks) {
+    common_hal_mcu_disable_interrupts();
+    if (deadline->pending) {
+        supervisor_deadline_remove(deadline);
+    }
+    deadline->ticks = ticks;
+    deadline->pending = true;
+    supervisor_deadline_t **link = &deadline_head;
+    while (*link != NULL && (*link)->ticks <= ticks) {
+        link = &(*link)->next;
+    }
+    deadline->next = *link;
+    *link = deadline;
+    // Only a new earliest deadline changes when the next tick is needed.
+    if (deadline_head == deadline) {
+        supervisor_tick_schedule();
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+void supervisor_deadline_set_after_ms(supervisor_deadline_t *deadline, uint32_t ms) {
+    supervisor_deadline_set(deadline, port_get_raw_ticks(NULL) + ((uint64_t)ms * 1024 + 999) / 1000);
+}
+
+void supervisor_deadline_cancel(supervisor_deadline_t *deadline) {
+    common_hal_mcu_disable_interrupts();
+    if (deadline->pending) {
+        bool was_first = deadline_head == deadline;
+        supervisor_deadline_remove(deadline);
+        if (was_first) {
+            supervisor_tick_schedule();
+        }
     }
     common_hal_mcu_enable_interrupts();
 }
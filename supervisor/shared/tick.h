@@ -33,9 +33,48 @@ extern uint32_t supervisor_ticks_ms32(void);
  */
 extern uint64_t supervisor_ticks_ms64(void);
 
+/** @brief Get the full time in microseconds
+ *
+ * This is the same clock as supervisor_ticks_ms64. It has microsecond resolution on
+ * ports with a microsecond timer and 1/32768 second resolution otherwise. It is safe
+ * to call in an interrupt context, so drivers can use it to timestamp events.
+ */
+extern uint64_t supervisor_ticks_us64(void);
+
+/** @brief Keep supervisor_tick running every tick
+ *
+ * Requests nest. Use a deadline instead when work is only due at known times,
+ * so the board can sleep in between.
+ */
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
+/** @brief A request for supervisor_tick to run at a given time
+ *
+ * Pending deadlines are kept in order, and the port is asked to interrupt for
+ * the earliest one only, so a board with nothing but deadlines doesn't wake
+ * every tick. Once the deadline passes, it is removed and fun, if set, is
+ * called from supervisor_tick, so it must be safe to call from an interrupt.
+ * Deadlines are one shot; set again to repeat. The struct must stay allocated
+ * while pending, so keep it out of the VM heap or cancel it in the owner's
+ * reset.
+ */
+typedef struct supervisor_deadline {
+    uint64_t ticks;
+    void (*fun)(void);
+    struct supervisor_deadline *next;
+    bool pending;
+} supervisor_deadline_t;
+
+/** @brief Set (or move) a deadline to the given raw tick count */
+extern void supervisor_deadline_set(supervisor_deadline_t *deadline, uint64_t ticks);
+
+/** @brief Set (or move) a deadline to the given number of milliseconds from now */
+extern void supervisor_deadline_set_after_ms(supervisor_deadline_t *deadline, uint32_t ms);
+
+/** @brief Remove a deadline if it is pending */
+extern void supervisor_deadline_cancel(supervisor_deadline_t *deadline);
+
 /**
  * @brief Return true if tick-based background tasks ran within the last 1s
  *
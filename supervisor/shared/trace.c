@@ -0,0 +1,91 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "supervisor/shared/trace.h"
+
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Processor.h"
+#include "supervisor/linker.h"
+#include "supervisor/port.h"
+
+#if (CIRCUITPY_TRACE_RECORDS & (CIRCUITPY_TRACE_RECORDS - 1)) != 0
+#error "CIRCUITPY_TRACE_RECORDS must be a power of two"
+#endif
+
+volatile bool trace_enabled;
+
+static trace_record_t records[CIRCUITPY_TRACE_RECORDS];
+// Total records written since trace_start(). The ring holds the last ones.
+static uint32_t record_count;
+static uint32_t reference_timestamp;
+static uint64_t reference_us;
+
+static uint32_t timestamp_now(void) {
+    #if CIRCUITPY_PERF_COUNTERS
+    return port_get_cpu_cycles();
+    #else
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+    #endif
+}
+
+void PLACE_IN_ITCM(trace_record)(trace_event_t event, uint16_t arg) {
+    common_hal_mcu_disable_interrupts();
+    trace_record_t *record = &records[record_count % CIRCUITPY_TRACE_RECORDS];
+    record_count++;
+    record->timestamp = timestamp_now();
+    record->event = event;
+    record->arg = arg;
+    common_hal_mcu_enable_interrupts();
+}
+
+void trace_start(void) {
+    trace_enabled = false;
+    record_count = 0;
+    trace_enabled = true;
+}
+
+void trace_stop(void) {
+    if (!trace_enabled) {
+        return;
+    }
+    trace_enabled = false;
+    // Taken at the end rather than the start, because the oldest records may
+    // have been overwritten and timestamps only unwrap from one record to the next.
+    common_hal_mcu_disable_interrupts();
+    reference_timestamp = timestamp_now();
+    reference_us = port_get_raw_us();
+    common_hal_mcu_enable_interrupts();
+}
+
+void trace_dump(void (*write)(void *context, const void *buf, size_t len), void *context) {
+    uint32_t count = MIN(record_count, CIRCUITPY_TRACE_RECORDS);
+    trace_header_t header = {
+        .magic = {'C', 'P', 'T', 'R'},
+        .version = 2,
+        .record_size = sizeof(trace_record_t),
+        #if CIRCUITPY_PERF_COUNTERS
+        .timestamp_hz = common_hal_mcu_processor_get_frequency(),
+        #else
+        .timestamp_hz = 32768,
+        #endif
+        .record_count = count,
+        .dropped = record_count - count,
+        .reference_timestamp = reference_timestamp,
+        .reference_us = reference_us,
+    };
+    write(context, &header, sizeof(header));
+    // The oldest record is the next one to be overwritten.
+    size_t first = (record_count - count) % CIRCUITPY_TRACE_RECORDS;
+    size_t first_part = MIN(count, CIRCUITPY_TRACE_RECORDS - first);
+    write(context, &records[first], first_part * sizeof(trace_record_t));
+    if (first_part < count) {
+        write(context, &records[0], (count - first_part) * sizeof(trace_record_t));
+    }
+}
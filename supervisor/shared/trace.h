@@ -0,0 +1,94 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+
+// Runtime events for the trace. tools/decode_trace.py has the same list.
+typedef enum {
+    TRACE_EVENT_VM_START = 1,
+    TRACE_EVENT_VM_END,
+    TRACE_EVENT_GC_START,
+    TRACE_EVENT_GC_END,
+    TRACE_EVENT_BACKGROUND_START,
+    TRACE_EVENT_BACKGROUND_END,
+    TRACE_EVENT_TICK_START,
+    TRACE_EVENT_TICK_END,
+    TRACE_EVENT_USB_START,
+    TRACE_EVENT_USB_END,
+    TRACE_EVENT_DISPLAY_START,
+    TRACE_EVENT_DISPLAY_END,
+    TRACE_EVENT_FLUSH_START,
+    TRACE_EVENT_FLUSH_END,
+    // arg is the DMA channel.
+    TRACE_EVENT_DMA_ISR,
+    // arg is the key number, with bit 15 set for a press.
+    TRACE_EVENT_KEYPAD,
+    // arg is the count recorded for the interval, up to 65535.
+    TRACE_EVENT_COUNT,
+    // arg is the pulse length in microseconds. Stamped when the pulse is read
+    // out of the hardware, which may be a little after it ended.
+    TRACE_EVENT_PULSE,
+    // arg is the number of frames dropped before this one, up to 65535.
+    TRACE_EVENT_FRAME,
+    // arg is the value passed to supervisor.trace_mark().
+    TRACE_EVENT_MARK,
+} trace_event_t;
+
+typedef struct {
+    // CPU cycles when the port has a cycle counter, otherwise 1/32768 seconds.
+    uint32_t timestamp;
+    uint16_t event;
+    uint16_t arg;
+} trace_record_t;
+
+// Written before the records by trace_dump(). All fields are little endian.
+typedef struct {
+    char magic[4]; // "CPTR"
+    uint8_t version;
+    uint8_t record_size;
+    uint16_t reserved;
+    uint32_t timestamp_hz;
+    uint32_t record_count;
+    // Records overwritten because the ring was full.
+    uint32_t dropped;
+    // A record timestamp and the supervisor_ticks_us64() time taken together
+    // when recording stopped, so records can be placed on the same clock as
+    // time.monotonic_ns(). Both are zero if recording never started.
+    uint32_t reference_timestamp;
+    uint64_t reference_us;
+} trace_header_t;
+
+#if CIRCUITPY_TRACE
+extern volatile bool trace_enabled;
+
+void trace_record(trace_event_t event, uint16_t arg);
+
+// Safe to call from interrupts. Costs one load and branch while tracing is off.
+static inline void trace_event(trace_event_t event, uint16_t arg) {
+    if (trace_enabled) {
+        trace_record(event, arg);
+    }
+}
+
+// Clears the ring and starts recording.
+void trace_start(void);
+void trace_stop(void);
+
+// Calls write with the header and then the records, oldest first. Call it
+// with tracing stopped, so that the writes don't overwrite what they send.
+void trace_dump(void (*write)(void *context, const void *buf, size_t len), void *context);
+#else
+static inline void trace_event(trace_event_t event, uint16_t arg) {
+    (void)event;
+    (void)arg;
+}
+#endif
@@ -89,6 +89,55 @@ static int get_nbits(bitstream_state_t *st, int n) {
     return r;
 }
 
+// Canonical Huffman decoding, a bit at a time.
+static int decode_value_slow(bitstream_state_t *st) {
+    uint32_t bits = 0;
+    uint8_t bit_length = 0;
+    uint32_t max_code = lengths[0];
+    uint32_t searched_length = lengths[0];
+    while (true) {
+        bits = (bits << 1) | next_bit(st);
+        bit_length += 1;
+        if (max_code > 0 && bits < max_code) {
+            break;
+        }
+        max_code = (max_code << 1) + lengths[bit_length];
+        searched_length += lengths[bit_length];
+    }
+    return values[searched_length + bits - max_code];
+}
+
+#if decompress_table_bits > 0
+static void skip_bits(bitstream_state_t *st, int n) {
+    uint8_t used = __builtin_clz(st->bit) - 24 + n;
+    st->ptr += used / 8;
+    st->bit = 0x80 >> (used % 8);
+}
+
+// Most codes are decoded with one lookup. Only the byte the code starts in is
+// read unless the code goes on into the next, so that reading never goes past
+// the end of the string.
+static int decode_value(bitstream_state_t *st) {
+    uint8_t used = __builtin_clz(st->bit) - 24;
+    uint8_t available = 8 - used;
+    uint32_t window = (uint32_t)(uint8_t)(st->ptr[0] << used) << 8;
+    uint16_t entry = decompress_table[window >> (16 - decompress_table_bits)];
+    uint8_t length = entry >> 12;
+    if (available < decompress_table_bits && (length == 0 || length > available)) {
+        window |= (uint32_t)st->ptr[1] << used;
+        entry = decompress_table[window >> (16 - decompress_table_bits)];
+        length = entry >> 12;
+    }
+    if (length == 0) {
+        return decode_value_slow(st);
+    }
+    skip_bits(st, length);
+    return values[entry & 0xfff];
+}
+#else
+#define decode_value decode_value_slow
+#endif
+
 // note: the vstr must be a fixed-buffer vstr that matches the decompressed length of the string
 static void decompress_vstr(mp_rom_error_text_t compressed, vstr_t *decompressed) {
     bitstream_state_t b = {
@@ -99,20 +148,7 @@ static void decompress_vstr(mp_rom_error_text_t compressed, vstr_t *decompressed
     size_t alloc = decompressed->alloc - 1;
     // Stop one early because the last byte is always NULL.
     for (; decompressed->len < alloc;) {
-        uint32_t bits = 0;
-        uint8_t bit_length = 0;
-        uint32_t max_code = lengths[0];
-        uint32_t searched_length = lengths[0];
-        while (true) {
-            bits = (bits << 1) | next_bit(&b);
-            bit_length += 1;
-            if (max_code > 0 && bits < max_code) {
-                break;
-            }
-            max_code = (max_code << 1) + lengths[bit_length];
-            searched_length += lengths[bit_length];
-        }
-        int v = values[searched_length + bits - max_code];
+        int v = decode_value(&b);
         if (v == 1) {
             qstr q = get_nbits(&b, translation_qstr_bits) + 1; // honestly no idea why "+1"...
             vstr_add_str(decompressed, qstr_str(q));
@@ -123,11 +159,42 @@ static void decompress_vstr(mp_rom_error_text_t compressed, vstr_t *decompressed
 }
 
 
+// Without a GIL, threads could see an entry half written.
+#if CIRCUITPY_MESSAGE_DECOMPRESS_CACHE > 0 && !(MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL)
+#define DECOMPRESS_CACHE (1)
+// Code that raises often tends to raise the same few short messages.
+#define DECOMPRESS_CACHE_MAX_LENGTH (48)
+
+typedef struct {
+    mp_rom_error_text_t compressed;
+    char text[DECOMPRESS_CACHE_MAX_LENGTH];
+} decompress_cache_entry_t;
+
+static decompress_cache_entry_t decompress_cache[CIRCUITPY_MESSAGE_DECOMPRESS_CACHE];
+#else
+#define DECOMPRESS_CACHE (0)
+#endif
+
 char *decompress(mp_rom_error_text_t compressed, char *decompressed) {
+    uint16_t length = decompress_length(compressed);
+    #if DECOMPRESS_CACHE
+    decompress_cache_entry_t *entry = &decompress_cache[((uintptr_t)compressed) % CIRCUITPY_MESSAGE_DECOMPRESS_CACHE];
+    if (entry->compressed == compressed) {
+        memcpy(decompressed, entry->text, length);
+        return decompressed;
+    }
+    #endif
     vstr_t vstr;
-    vstr_init_fixed_buf(&vstr, decompress_length(compressed), decompressed);
+    vstr_init_fixed_buf(&vstr, length, decompressed);
     decompress_vstr(compressed, &vstr);
-    return vstr_null_terminated_str(&vstr);
+    char *result = vstr_null_terminated_str(&vstr);
+    #if DECOMPRESS_CACHE
+    if (length <= DECOMPRESS_CACHE_MAX_LENGTH) {
+        memcpy(entry->text, result, length);
+        entry->compressed = compressed;
+    }
+    #endif
+    return result;
 }
 
 #if CIRCUITPY_TRANSLATE_OBJECT == 1
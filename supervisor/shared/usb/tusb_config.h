@@ -112,7 +112,7 @@ extern "C" {
 #define CFG_TUD_MSC                 CIRCUITPY_USB_MSC
 #define CFG_TUD_HID                 CIRCUITPY_USB_HID
 #define CFG_TUD_MIDI                CIRCUITPY_USB_MIDI
-#define CFG_TUD_VENDOR              CIRCUITPY_USB_VENDOR
+#define CFG_TUD_VENDOR              (CIRCUITPY_USB_VENDOR + CIRCUITPY_USB_VENDOR_BULK)
 #define CFG_TUD_CUSTOM_CLASS        0
 
 /*------------------------------------------------------------------*/
@@ -121,6 +121,25 @@ extern "C" {
 
 // Product revision string included in Inquiry response, max 4 bytes
 #define CFG_TUD_MSC_PRODUCT_REV     "1.0"
+
+// usb_vendor.Bulk streams whole packets, so give it full size high speed
+// packets and FIFOs that hold two of them: one the host is moving while Python
+// fills or drains the other.
+#if CIRCUITPY_USB_VENDOR_BULK
+#ifndef CFG_TUD_VENDOR_EPSIZE
+#if USB_HIGHSPEED
+#define CFG_TUD_VENDOR_EPSIZE       512
+#else
+#define CFG_TUD_VENDOR_EPSIZE       64
+#endif
+#endif
+#ifndef CFG_TUD_VENDOR_RX_BUFSIZE
+#define CFG_TUD_VENDOR_RX_BUFSIZE   (2 * CFG_TUD_VENDOR_EPSIZE)
+#endif
+#ifndef CFG_TUD_VENDOR_TX_BUFSIZE
+#define CFG_TUD_VENDOR_TX_BUFSIZE   (2 * CFG_TUD_VENDOR_EPSIZE)
+#endif
+#endif
 #endif
 
 // --------------------------------------------------------------------+
@@ -7,6 +7,8 @@
 #include "py/objstr.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
+#include "supervisor/shared/perf.h"
+#include "supervisor/shared/trace.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
 #include "shared/readline/readline.h"
@@ -34,6 +36,10 @@
 #include "shared-module/usb_midi/__init__.h"
 #endif
 
+#if CIRCUITPY_USB_VENDOR_BULK
+#include "shared-module/usb_vendor/__init__.h"
+#endif
+
 #if CIRCUITPY_USB_VIDEO
 #include "shared-module/usb_video/__init__.h"
 #endif
@@ -46,6 +52,15 @@ bool usb_enabled(void) {
     return tusb_inited();
 }
 
+// True when a host has reset the bus since it was last suspended or unplugged.
+bool usb_connected(void) {
+    #if CIRCUITPY_USB_DEVICE
+    return usb_enabled() && tud_connected();
+    #else
+    return false;
+    #endif
+}
+
 MP_WEAK void post_usb_init(void) {
 }
 
@@ -112,6 +127,10 @@ void usb_set_defaults(void) {
     #if CIRCUITPY_USB_MIDI
     usb_midi_set_defaults();
     #endif
+
+    #if CIRCUITPY_USB_VENDOR_BULK
+    usb_vendor_bulk_set_defaults();
+    #endif
     #endif
 };
 
@@ -130,6 +149,8 @@ void usb_setup_with_vm(void) {
 
 void usb_background(void) {
     if (usb_enabled()) {
+        uint32_t perf_start = perf_begin();
+        trace_event(TRACE_EVENT_USB_START, 0);
         #if CFG_TUSB_OS == OPT_OS_NONE || CFG_TUSB_OS == OPT_OS_PICO
         tud_task();
         #if CIRCUITPY_USB_HOST || CIRCUITPY_MAX3421E
@@ -150,6 +171,8 @@ void usb_background(void) {
         #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_VIDEO
         usb_video_task();
         #endif
+        perf_end(PERF_COUNTER_USB, perf_start);
+        trace_event(TRACE_EVENT_USB_END, 0);
     }
 }
 
@@ -157,7 +180,7 @@ uint32_t tusb_time_millis_api(void) {
     return supervisor_ticks_ms32();
 }
 
-static background_callback_t usb_callback;
+static background_callback_t usb_callback = { .priority = BACKGROUND_CALLBACK_PRIORITY_REALTIME };
 static void usb_background_do(void *unused) {
     usb_background();
 }
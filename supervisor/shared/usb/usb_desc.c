@@ -28,6 +28,10 @@
 #include "shared-bindings/storage/__init__.h"
 #endif
 
+#if CIRCUITPY_USB_VENDOR_BULK
+#include "shared-module/usb_vendor/__init__.h"
+#endif
+
 #if CIRCUITPY_USB_VIDEO
 #include "shared-module/usb_video/__init__.h"
 #endif
@@ -160,6 +164,12 @@ static bool usb_build_configuration_descriptor(void) {
     }
     #endif
 
+    #if CIRCUITPY_USB_VENDOR_BULK
+    if (usb_vendor_bulk_enabled()) {
+        total_descriptor_length += usb_vendor_bulk_descriptor_length();
+    }
+    #endif
+
     #if CIRCUITPY_USB_VIDEO
     if (usb_video_enabled()) {
         total_descriptor_length += usb_video_descriptor_length();
@@ -245,6 +255,14 @@ static bool usb_build_configuration_descriptor(void) {
     }
     #endif
 
+    #if CIRCUITPY_USB_VENDOR_BULK
+    // Must follow the WebUSB interface: TinyUSB numbers vendor interfaces in order.
+    if (usb_vendor_bulk_enabled()) {
+        descriptor_buf_remaining += usb_vendor_bulk_add_descriptor(
+            descriptor_buf_remaining, &descriptor_counts, &current_interface_string);
+    }
+    #endif
+
     #if CIRCUITPY_USB_VIDEO
     if (usb_video_enabled()) {
         descriptor_buf_remaining += usb_video_add_descriptor(
@@ -17,14 +17,31 @@
 #include "shared-module/storage/__init__.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/reload_filter.h"
 
 #define MSC_FLASH_BLOCK_SIZE    512
 
+#if CIRCUITPY_STORAGE_DATA_DRIVE
+// LUN 1 is the data drive. It's read-only over USB because Python writes it.
+#define DATA_DRIVE_LUN (1)
+static bool ejected[2] = {true, true};
+static bool locked[2] = {false, false};
+
+uint8_t tud_msc_get_maxlun_cb(void) {
+    return data_drive_vfs() != NULL ? 2 : 1;
+}
+#else
 static bool ejected[1] = {true};
 static bool locked[1] = {false};
+#endif
 
 // The root FS is always at the end of the list.
 static fs_user_mount_t *get_vfs(int lun) {
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    if (lun == DATA_DRIVE_LUN) {
+        return data_drive_vfs();
+    }
+    #endif
     // TODO(tannewt): Return the mount which matches the lun where 0 is the end
     // and is counted in reverse.
     if (lun > 0) {
@@ -37,6 +54,12 @@ static fs_user_mount_t *get_vfs(int lun) {
     while (current_mount->next != NULL) {
         current_mount = current_mount->next;
     }
+    #if CIRCUITPY_LITTLEFS
+    // A LittleFS CIRCUITPY can't be presented over USB.
+    if (mp_obj_get_type(current_mount->obj) != &mp_fat_vfs_type) {
+        return NULL;
+    }
+    #endif
     return current_mount->obj;
 }
 
@@ -115,6 +138,11 @@ bool tud_msc_is_writable_cb(uint8_t lun) {
     if (lun > 1) {
         return false;
     }
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    if (lun == DATA_DRIVE_LUN) {
+        return false;
+    }
+    #endif
 
     fs_user_mount_t *vfs = get_vfs(lun);
     if (vfs == NULL) {
@@ -153,17 +181,28 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buff
 
 // Callback invoked when received WRITE10 command.
 // Process data in buffer to disk's storage and return number of written bytes
+// Set by a write that could change a file or directory code.py used.
+static bool msc_write_needs_reload;
+
 int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize) {
-    (void)lun;
     (void)offset;
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    if (lun == DATA_DRIVE_LUN) {
+        return -1;
+    }
+    #endif
     autoreload_suspend(AUTORELOAD_SUSPEND_USB);
 
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
+    // Decide before writing, while the old directory entries can still be read.
+    if (reload_filter_write_needs_reload(&vfs->fatfs, lba, buffer, block_count)) {
+        msc_write_needs_reload = true;
+    }
     disk_write(vfs, buffer, lba, block_count);
     // Since by getting here we assume the mount is read-only to
-    // MicroPython let's update the cached FatFs sector if it's the one
+    // MicroPython let's update the cached FatFs sector if it's one
     // we just wrote.
     #if FF_MAX_SS != FF_MIN_SS
     if (vfs->fatfs.ssize == MSC_FLASH_BLOCK_SIZE) {
@@ -171,7 +210,7 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     // The compiler can optimize this away.
     if (FF_MAX_SS == FILESYSTEM_BLOCK_SIZE) {
         #endif
-        if (lba == vfs->fatfs.winsect && lba > 0) {
+        if (vfs->fatfs.winsect - lba < block_count && vfs->fatfs.winsect > 0) {
             memcpy(vfs->fatfs.win,
                 buffer + MSC_FLASH_BLOCK_SIZE * (vfs->fatfs.winsect - lba),
                 MSC_FLASH_BLOCK_SIZE);
@@ -186,9 +225,14 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 void tud_msc_write10_complete_cb(uint8_t lun) {
     (void)lun;
 
-    // This write is complete; initiate an autoreload.
+    // This write is complete; initiate an autoreload if it could change what
+    // code.py uses. Once one is pending, later writes keep pushing it back
+    // until the host is done.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
-    autoreload_trigger();
+    if (msc_write_needs_reload || autoreload_pending()) {
+        msc_write_needs_reload = false;
+        autoreload_trigger();
+    }
 }
 
 // Invoked when received SCSI_CMD_INQUIRY
@@ -217,6 +261,14 @@ bool tud_msc_test_unit_ready_cb(uint8_t lun) {
         tud_msc_set_sense(lun, SCSI_SENSE_NOT_READY, 0x3A, 0x00);
         return false;
     }
+    #if CIRCUITPY_STORAGE_DATA_DRIVE
+    if (lun == DATA_DRIVE_LUN && data_drive_take_changed()) {
+        // 0x28 is "medium may have changed". It makes the host drop its cached
+        // view of the drive and reread what Python has written.
+        tud_msc_set_sense(lun, SCSI_SENSE_UNIT_ATTENTION, 0x28, 0x00);
+        return false;
+    }
+    #endif
 
     return true;
 }
@@ -21,6 +21,7 @@
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 #include "supervisor/shared/web_workflow/websocket.h"
@@ -50,6 +51,12 @@
 #include "shared-module/os/__init__.h"
 #endif
 
+// File transfers use a buffer of this size from the port heap, and fall back
+// to a small stack buffer when it can't be allocated.
+#ifndef CIRCUITPY_WEB_WORKFLOW_TRANSFER_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_TRANSFER_SIZE (4096)
+#endif
+
 enum request_state {
     STATE_METHOD,
     STATE_PATH,
@@ -68,6 +75,8 @@ typedef struct {
     char header_value[256];
     char origin[64];        // We store the origin so we can reply back with it.
     char host[64];          // We store the host to check against origin.
+    char range[32];         // Range header of a GET, parsed once the file size is known.
+    char if_none_match[64]; // ETags the client already has cached.
     size_t content_length;
     size_t offset;
     uint64_t timestamp_ms;
@@ -544,7 +553,7 @@ static void _reply_access_control(socketpool_socket_obj_t *socket, _request *req
         "HTTP/1.1 204 No Content\r\n",
         "Content-Length: 0\r\n",
         "Access-Control-Expose-Headers: Access-Control-Allow-Methods\r\n",
-        "Access-Control-Allow-Headers: X-Timestamp, X-Destination, Content-Type, Authorization\r\n",
+        "Access-Control-Allow-Headers: X-Timestamp, X-Destination, Content-Type, Authorization, Range\r\n",
         "Access-Control-Allow-Methods:GET, OPTIONS, PUT, DELETE, MOVE", NULL);
     _send_str(socket, "\r\n");
     _cors_header(socket, request);
@@ -736,12 +745,83 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     _send_chunk(socket, "");
 }
 
+static uint8_t *_transfer_buffer_alloc(uint8_t *fallback, size_t *size) {
+    uint8_t *buffer = port_malloc(CIRCUITPY_WEB_WORKFLOW_TRANSFER_SIZE, false);
+    if (buffer == NULL) {
+        return fallback;
+    }
+    *size = CIRCUITPY_WEB_WORKFLOW_TRANSFER_SIZE;
+    return buffer;
+}
+
+static void _transfer_buffer_free(uint8_t *buffer, uint8_t *fallback) {
+    if (buffer != fallback) {
+        port_free(buffer);
+    }
+}
+
+// Parses a single "bytes=first-last", "bytes=first-" or "bytes=-suffix" range.
+// Returns false for anything else, in which case the whole file is sent. When
+// the range is valid but can't be satisfied, first is set past the end.
+static bool _parse_range(const char *range, uint32_t length, uint32_t *first, uint32_t *last) {
+    const char *prefix = "bytes=";
+    if (strncmp(range, prefix, strlen(prefix)) != 0) {
+        return false;
+    }
+    const char *start = range + strlen(prefix);
+    char *end;
+    if (*start == '-') {
+        uint32_t suffix = strtoul(start + 1, &end, 10);
+        if (end == start + 1 || *end != '\0') {
+            return false;
+        }
+        *first = suffix == 0 ? length : (suffix >= length ? 0 : length - suffix);
+        *last = length - 1;
+        return true;
+    }
+    *first = strtoul(start, &end, 10);
+    if (end == start || *end != '-') {
+        return false;
+    }
+    start = end + 1;
+    *last = length - 1;
+    if (*start != '\0') {
+        uint32_t requested_last = strtoul(start, &end, 10);
+        if (end == start || *end != '\0' || requested_last < *first) {
+            return false;
+        }
+        *last = MIN(*last, requested_last);
+    }
+    return true;
+}
+
 static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
-    uint32_t total_length = f_size(active_file);
+    uint32_t file_length = f_size(active_file);
+    uint32_t first = 0;
+    uint32_t last = 0;
+    bool partial = request->range[0] != '\0' && _parse_range(request->range, file_length, &first, &last);
 
-    _send_str(socket, "HTTP/1.1 200 OK\r\n");
     mp_print_t _socket_print = {socket, _print_raw};
+    if (partial && first >= file_length) {
+        _send_str(socket, "HTTP/1.1 416 Range Not Satisfiable\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes */%u\r\n", file_length);
+        _send_str(socket, "Content-Length: 0\r\n");
+        _cors_header(socket, request);
+        _send_final_str(socket, "\r\n");
+        return;
+    }
+
+    uint32_t total_length = file_length;
+    if (partial) {
+        total_length = last - first + 1;
+        f_lseek(active_file, first);
+        _send_str(socket, "HTTP/1.1 206 Partial Content\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes %u-%u/%u\r\n", first, last, file_length);
+    } else {
+        _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    }
     mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+    _send_str(socket, "Accept-Ranges: bytes\r\n");
     // TODO: Make this a table to save space.
     if (_endswith(filename, ".txt") || _endswith(filename, ".py") || _endswith(filename, ".toml")) {
         _send_strs(socket, "Content-Type:", "text/plain", ";charset=UTF-8\r\n", NULL);
@@ -757,42 +837,26 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
 
+    uint8_t small_buffer[64];
+    size_t buffer_size = sizeof(small_buffer);
+    uint8_t *buffer = _transfer_buffer_alloc(small_buffer, &buffer_size);
+
     uint32_t total_read = 0;
-    int nodelay_ok = -1;
-    while (total_read < total_length) {
-        uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
-        total_read += quantity_read;
-        // When getting near the end of the file, disable Nagle's combining algorithm so that
-        // data is sent immediately.
-        if (total_length - total_read < 64) {
-            int nodelay = 1;
-            // Returns 0 when it works.
-            nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
-        }
-        uint32_t send_offset = 0;
-        while (send_offset < quantity_read) {
-            int sent = socketpool_socket_send(socket, data_buffer + send_offset, quantity_read - send_offset);
-            if (sent < 0) {
-                if (sent == -MP_EAGAIN) {
-                    sent = 0;
-                } else {
-                    break;
-                }
-            }
-            send_offset += sent;
+    while (total_read < total_length && common_hal_socketpool_socket_get_connected(socket)) {
+        UINT quantity_read;
+        FRESULT result = f_read(active_file, buffer, MIN(buffer_size, total_length - total_read), &quantity_read);
+        if (result != FR_OK || quantity_read == 0) {
+            break;
         }
+        total_read += quantity_read;
+        // Flush the last chunk so that it is sent immediately.
+        web_workflow_send_raw(socket, total_read == total_length, buffer, quantity_read);
     }
+    _transfer_buffer_free(buffer, small_buffer);
+
     if (total_read < total_length) {
         socketpool_socket_close(socket);
     }
-
-    // Re-enable Nagle's algorithm when done sending.
-    if (nodelay_ok == 0) {
-        int nodelay = 0;
-        nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
-    }
 }
 
 static void _reply_with_devices_json(socketpool_socket_obj_t *socket, _request *request) {
@@ -1025,12 +1089,15 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     f_truncate(&active_file);
     f_rewind(&active_file);
 
+    uint8_t small_buffer[64];
+    size_t buffer_size = sizeof(small_buffer);
+    uint8_t *buffer = _transfer_buffer_alloc(small_buffer, &buffer_size);
+
     size_t total_read = 0;
     bool error = false;
     while (total_read < request->content_length && !error) {
-        uint8_t bytes[64];
-        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
-        int len = socketpool_socket_recv_into(socket, bytes, read_len);
+        size_t read_len = MIN(buffer_size, request->content_length - total_read);
+        int len = socketpool_socket_recv_into(socket, buffer, read_len);
         if (len < 0) {
             if (len == -MP_EAGAIN) {
                 continue;
@@ -1040,12 +1107,13 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
         }
         total_read += len;
         UINT actual;
-        f_write(&active_file, bytes, len, &actual);
+        f_write(&active_file, buffer, len, &actual);
         if (actual < (UINT)len) {
             error = true;
             break;
         }
     }
+    _transfer_buffer_free(buffer, small_buffer);
 
     f_close(&active_file);
     filesystem_unlock(fs_mount);
@@ -1061,7 +1129,7 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     }
 }
 
-#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type;
+#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type; extern const char *filename##_etag;
 
 STATIC_FILE(code_html);
 STATIC_FILE(directory_html);
@@ -1075,7 +1143,18 @@ STATIC_FILE(serial_html);
 STATIC_FILE(serial_js);
 STATIC_FILE(blinka_32x32_ico);
 
-static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type) {
+static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type, const char *etag) {
+    // The static files only change with the firmware, so the client can keep
+    // them as long as it checks back. A matching ETag needs no body.
+    if (strstr(request->if_none_match, etag) != NULL) {
+        _send_strs(socket,
+            "HTTP/1.1 304 Not Modified\r\n",
+            "ETag: ", etag, "\r\n",
+            "Cache-Control: no-cache\r\n",
+            "\r\n", NULL);
+        return;
+    }
+
     uint32_t total_length = response_len;
     char encoded_len[10];
     snprintf(encoded_len, sizeof(encoded_len), "%" PRIu32, total_length);
@@ -1085,11 +1164,13 @@ static void _reply_static(socketpool_socket_obj_t *socket, _request *request, co
         "Content-Encoding: gzip\r\n",
         "Content-Length: ", encoded_len, "\r\n",
         "Content-Type: ", content_type, "\r\n",
+        "ETag: ", etag, "\r\n",
+        "Cache-Control: no-cache\r\n",
         "\r\n", NULL);
     web_workflow_send_raw(socket, true, response, response_len);
 }
 
-#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type)
+#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type, filename##_etag)
 
 static void _reply_websocket_upgrade(socketpool_socket_obj_t *socket, _request *request) {
     // Compute accept key
@@ -1388,6 +1469,8 @@ static void _reset_request(_request *request) {
     request->state = STATE_METHOD;
     request->origin[0] = '\0';
     request->host[0] = '\0';
+    request->range[0] = '\0';
+    request->if_none_match[0] = '\0';
     request->content_length = 0;
     request->offset = 0;
     request->timestamp_ms = 0;
@@ -1507,6 +1590,12 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                     } else if (strcasecmp(request->header_key, "Origin") == 0) {
                         strncpy(request->origin, request->header_value, sizeof(request->origin) - 1);
                         request->origin[sizeof(request->origin) - 1] = '\0';
+                    } else if (strcasecmp(request->header_key, "Range") == 0) {
+                        strncpy(request->range, request->header_value, sizeof(request->range) - 1);
+                        request->range[sizeof(request->range) - 1] = '\0';
+                    } else if (strcasecmp(request->header_key, "If-None-Match") == 0) {
+                        strncpy(request->if_none_match, request->header_value, sizeof(request->if_none_match) - 1);
+                        request->if_none_match[sizeof(request->if_none_match) - 1] = '\0';
                     } else if (strcasecmp(request->header_key, "X-Timestamp") == 0) {
                         request->timestamp_ms = strtoull(request->header_value, NULL, 10);
                     } else if (strcasecmp(request->header_key, "Upgrade") == 0) {
@@ -11,7 +11,7 @@ void filesystem_background(void) {
     return;
 }
 
-void filesystem_tick(void) {
+void filesystem_flush_later(void) {
     return;
 }
 
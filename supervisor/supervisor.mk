@@ -24,6 +24,18 @@ SRC_SUPERVISOR = \
 # For tlsf
 CFLAGS += -D_DEBUG=0
 
+ifeq ($(CIRCUITPY_OBJECT_POOL),1)
+SRC_SUPERVISOR += supervisor/shared/object_pool.c
+endif
+
+ifeq ($(CIRCUITPY_PERF_COUNTERS),1)
+SRC_SUPERVISOR += supervisor/shared/perf.c
+endif
+
+ifeq ($(CIRCUITPY_TRACE),1)
+SRC_SUPERVISOR += supervisor/shared/trace.c
+endif
+
 NO_USB ?= $(wildcard supervisor/usb.c)
 
 
@@ -66,6 +78,12 @@ ifeq ($(DISABLE_FILESYSTEM),1)
 SRC_SUPERVISOR += supervisor/stub/filesystem.c
 else
 SRC_SUPERVISOR += supervisor/shared/filesystem.c
+  ifeq ($(CIRCUITPY_STORAGE_DATA_DRIVE),1)
+    SRC_SUPERVISOR += supervisor/shared/data_drive.c
+  endif
+  ifeq ($(CIRCUITPY_AUTORELOAD_FILTER),1)
+    SRC_SUPERVISOR += supervisor/shared/reload_filter.c
+  endif
 endif
 
 # Choose which flash filesystem impl to use.
@@ -103,6 +121,10 @@ ifneq ($(wildcard supervisor/serial.c),)
   SRC_SUPERVISOR += supervisor/serial.c
 endif
 
+ifeq ($(CIRCUITPY_SUPERVISOR_PROFILE),1)
+  SRC_SUPERVISOR += supervisor/shared/profile.c
+endif
+
 ifeq ($(CIRCUITPY_STATUS_BAR),1)
   SRC_SUPERVISOR += \
     supervisor/shared/status_bar.c \
@@ -176,12 +198,21 @@ ifeq ($(CIRCUITPY_TINYUSB),1)
   endif
 
 
-  ifeq ($(CIRCUITPY_USB_VENDOR), 1)
+  ifeq ($(call enable-if-any,$(CIRCUITPY_USB_VENDOR) $(CIRCUITPY_USB_VENDOR_BULK)), 1)
     SRC_SUPERVISOR += \
       lib/tinyusb/src/class/vendor/vendor_device.c \
 
   endif
 
+  ifeq ($(CIRCUITPY_USB_VENDOR_BULK), 1)
+    SRC_SUPERVISOR += \
+      shared-bindings/usb_vendor/__init__.c \
+      shared-bindings/usb_vendor/Bulk.c \
+      shared-module/usb_vendor/__init__.c \
+      shared-module/usb_vendor/Bulk.c \
+
+  endif
+
   ifeq ($(CIRCUITPY_TINYUSB_HOST), 1)
     SRC_SUPERVISOR += \
       lib/tinyusb/src/host/hub.c \
@@ -46,6 +46,7 @@ typedef struct {
 
 // Shared implementation.
 bool usb_enabled(void);
+bool usb_connected(void);
 void usb_add_interface_string(uint8_t interface_string_index, const char str[]);
 bool usb_build_descriptors(const usb_identification_t *identification);
 void usb_disconnect(void);
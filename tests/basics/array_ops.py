@@ -0,0 +1,92 @@
+# test arithmetic over whole arrays (CircuitPython extension)
+try:
+    import array
+    from array import array as A
+
+    array.add
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+# add, with saturation at the destination type
+a = A("h", [1, 2, 3, 32000, -32000])
+b = A("h", [10, 20, 30, 1000, -1000])
+d = A("h", [0] * 5)
+array.add(d, a, b)
+print(d)
+array.add(d, a, 100)
+print(d)
+d8 = A("B", [0] * 5)
+array.add(d8, A("B", [1, 2, 250, 255, 0]), A("B", [1, 2, 10, 255, 0]))
+print(d8)
+array.add(d8, d8, -3)
+print(d8)
+
+# in place, on odd lengths and unaligned memoryviews
+a = A("b", range(-60, 63, 7))
+array.add(a, a, a)
+print(a)
+m = memoryview(A("h", range(9)))[1:]
+array.add(m, m, m)
+print(list(m))
+
+# mul and scale
+d = A("h", [0] * 5)
+array.mul(d, A("h", [1, -2, 300, 400, -500]), A("h", [2, 3, 200, -100, 100]))
+print(d)
+array.mul(d, d, 2)
+print(d)
+f = A("f", [0] * 4)
+array.mul(f, A("h", [1, 2, 3, 4]), 0.5)
+print(f)
+array.scale(d, A("B", [0, 1, 2, 3, 255]), 100, -128)
+print(d)
+
+# type conversion, rounding floats to the nearest integer
+h = A("h", [0] * 6)
+array.scale(h, A("f", [0.4, 0.6, -2.5, 1e9, -1e9, float("nan")]))
+print(h)
+u = A("B", [0] * 4)
+array.scale(u, A("h", [-1, 0, 128, 300]))
+print(u)
+array.scale(f, A("B", [0, 64, 128, 255]), 1 / 255)
+print([round(x, 3) for x in f])
+
+# bytes and bytearray are 'B'
+array.add(u, b"\x01\x02\x03\x04", bytearray(4))
+print(u)
+
+# reductions
+a = A("h", [5, -3, 12, 7, -8, -1])
+print(array.min(a), array.max(a), array.sum(a), array.mean(a))
+f = A("f", [0.5, -1.5, 2.5])
+print(array.min(f), array.max(f), array.sum(f), array.mean(f))
+print(array.sum(A("I", [0xFFFFFFFF] * 4)))
+print(array.sum(A("b")))
+print(array.dot(A("h", [1, 2, 3]), A("h", [4, 5, 6])))
+print(array.dot(A("h", [30000] * 4), A("h", [30000] * 4)))
+print(array.dot(A("f", [0.5, 2]), A("h", [4, 5])))
+
+# errors
+for args in ((A("h", [0] * 2), A("h", [1, 2, 3]), 1), (A("h", [0] * 3), A("h", [1, 2, 3]), A("h", [1]))):
+    try:
+        array.add(*args)
+    except ValueError:
+        print("ValueError")
+try:
+    array.add(b"\x00", b"\x00", 1)
+except TypeError:
+    print("TypeError")
+try:
+    array.sum([1, 2])
+except TypeError:
+    print("TypeError")
+for fn in (array.min, array.max, array.mean):
+    try:
+        fn(A("h"))
+    except ValueError:
+        print("ValueError")
+try:
+    array.scale(d, d, "x")
+except TypeError:
+    print("TypeError")
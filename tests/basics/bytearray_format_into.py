@@ -0,0 +1,36 @@
+# bytearray.format_into appends formatted text in place
+try:
+    bytearray().format_into
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+ba = bytearray(b"id=")
+print(ba.format_into("{}:{:.2f},", 7, 1.5), ba)
+print(ba.format_into(b"{x}{{}}", x=b"z"), ba)
+print(ba.format_into("{0!r}{0}", "q"), ba)
+
+# nothing is added when formatting fails
+try:
+    ba.format_into("{}{}{}", 1, 2)
+except IndexError:
+    print("IndexError", ba)
+
+
+class Bad:
+    def __str__(self):
+        raise ValueError
+
+
+try:
+    ba.format_into("abc{}", Bad())
+except ValueError:
+    print("ValueError", ba)
+
+ba = bytearray()
+for i in range(100):
+    ba.format_into("{},", i)
+print(len(ba), ba[-10:])
+
+# only bytearray has it
+print(hasattr(b"", "format_into"), hasattr("", "format_into"))
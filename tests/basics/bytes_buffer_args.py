@@ -0,0 +1,22 @@
+# bytes methods taking a memoryview or other buffer as the argument
+
+try:
+    b"".find(memoryview(b""))
+except (NameError, TypeError):
+    print("SKIP")
+    raise SystemExit
+
+b = b"\x01\x02hello,world\x02"
+m = memoryview(b)
+print(b.find(m[2:4]), b.rfind(m[2:3]), b.index(m[3:5]), b.rindex(m[4:5]))
+print(b.startswith(m[0:2]), b.startswith(m[1:3]), b.endswith(m[-1:]))
+print(b.split(m[7:8]), b.rsplit(m[7:8], 1))
+print(b.strip(m[0:2]), b.lstrip(bytearray(b"\x01")))
+print(b.replace(m[2:7], memoryview(b"HI")))
+print(b.find(bytearray(b"lo")))
+
+# str methods still need a str
+try:
+    "abc".find(memoryview(b"a"))
+except TypeError:
+    print("TypeError")
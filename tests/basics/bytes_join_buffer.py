@@ -0,0 +1,31 @@
+# bytes.join takes any object with the buffer protocol
+try:
+    memoryview
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+print(b",".join([b"a", bytearray(b"b"), memoryview(b"cd"), b""]))
+print(bytearray(b",").join([b"1", memoryview(bytearray(b"2"))]))
+print(b"".join(iter([b"x", b"y"])))
+
+# a single item is returned as-is when it has the result type
+s = "abc"
+print("".join([s]) is s)
+print(b"-".join((b"xy",)))
+ba = bytearray(b"xy")
+print(bytearray(b"-").join([ba]) is ba)
+
+# str and bytes don't mix
+try:
+    b",".join(["a"])
+except TypeError:
+    print("TypeError")
+try:
+    ",".join([b"a"])
+except TypeError:
+    print("TypeError")
+try:
+    b",".join([1])
+except TypeError:
+    print("TypeError")
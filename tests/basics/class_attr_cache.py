@@ -0,0 +1,77 @@
+# Test that attribute loads through the class hierarchy see changes to classes.
+
+
+class A:
+    x = 1
+
+    def f(self):
+        return "A.f"
+
+
+class B(A):
+    pass
+
+
+class C(B):
+    pass
+
+
+c = C()
+for _ in range(3):
+    print(c.f(), c.x)
+
+# shadow in an intermediate class
+B.f = lambda self: "B.f"
+B.x = 2
+print(c.f(), c.x)
+
+# shadow in the instance
+c.x = 3
+print(c.x)
+del c.x
+print(c.x)
+
+# remove from the intermediate class
+del B.f
+del B.x
+print(c.f(), c.x)
+
+# grow the class dict so its table is reallocated
+for i in range(20):
+    setattr(A, "a%d" % i, i)
+print(c.f(), c.x, c.a19)
+
+# replace the method in place
+A.f = lambda self: "new A.f"
+print(c.f())
+
+# remove the attribute altogether
+del A.f
+try:
+    c.f()
+except AttributeError:
+    print("AttributeError")
+
+
+# classmethod, staticmethod and property found through the cache
+class D:
+    @classmethod
+    def cm(cls):
+        return cls.__name__
+
+    @staticmethod
+    def sm():
+        return "sm"
+
+    @property
+    def p(self):
+        return "p"
+
+
+class E(D):
+    pass
+
+
+e = E()
+for _ in range(2):
+    print(e.cm(), e.sm(), e.p)
@@ -0,0 +1,92 @@
+# test deques of raw numbers (CircuitPython extension)
+try:
+    from collections import deque
+    from array import array
+
+    deque((), 2, typecode="h")
+except (ImportError, TypeError):
+    print("SKIP")
+    raise SystemExit
+
+d = deque((), 4, typecode="h")
+for i in range(6):
+    d.append(i * 100)
+print(list(d), len(d), d.sum(), d.mean(), d.min(), d.max())
+d.appendleft(-7)
+print(list(d), d.sum(), d[0], d[-1])
+d[1] = 1000
+print(list(d), d.sum())
+print(d.pop(), d.popleft(), list(d), d.sum())
+
+# extend from a buffer of the same type, and from other iterables
+d = deque((), 5, typecode="h")
+d.extend(array("h", range(8)))
+print(list(d), d.sum())
+d.extend([100, 200])
+print(list(d), d.sum())
+d.extend(array("b", [1]))
+print(list(d), d.sum())
+
+# copy_into, across the end of the ring and into other types
+a = array("h", [0] * 6)
+print(d.copy_into(a), a)
+f = array("f", [0] * 3)
+print(d.copy_into(f), f)
+
+# floats
+d = deque([0.5, 1.5], 3, typecode="f")
+d.append(2.5)
+d.append(3.5)
+print(list(d), d.sum(), d.mean(), d.min(), d.max())
+for i in range(100):
+    d.append(0.25)
+print(d.sum(), d.mean())
+
+# bytes fill a 'B' deque
+d = deque(b"\x01\x02\x03", 2, typecode="B")
+print(list(d), d.sum())
+
+# values are stored as the type, and must fit it
+d = deque((), 2, typecode="b")
+d.append(-128)
+print(list(d))
+try:
+    d.append("x")
+except TypeError:
+    print("TypeError")
+d[0] = 5
+print(list(d), d.sum())
+try:
+    d[0] = "x"
+except TypeError:
+    print("TypeError")
+print(list(d), d.sum())
+
+# overflow checking
+d = deque((), 2, 1, typecode="H")
+try:
+    d.extend(array("H", [1, 2, 3]))
+except IndexError:
+    print("IndexError")
+print(list(d))
+
+# errors
+for tc in ("", "x", "O", "hh"):
+    try:
+        deque((), 2, typecode=tc)
+    except ValueError:
+        print("ValueError")
+try:
+    deque((), 2).sum()
+except ValueError:
+    print("ValueError")
+for fn in ("mean", "min", "max"):
+    try:
+        getattr(deque((), 2, typecode="i"), fn)()
+    except IndexError:
+        print("IndexError")
+
+# object deques can still copy into buffers
+d = deque([1, 2, 3], 3)
+a = array("i", [0] * 4)
+print(d.copy_into(a), a)
@@ -0,0 +1,55 @@
+# test dicts with many insertions and deletions, which exercises growing the
+# table, reusing deleted entries and rebuilding without them
+
+d = {}
+for i in range(200):
+    d["key%d" % i] = i
+print(len(d), d["key0"], d["key199"])
+
+# delete every other key and check the rest are still found
+for i in range(0, 200, 2):
+    del d["key%d" % i]
+print(len(d), "key0" in d, "key1" in d, d["key199"])
+print(sorted(d.values()) == list(range(1, 200, 2)))
+
+# steady insert/delete at a fixed size
+d = {}
+for i in range(1000):
+    d[i] = i * i
+    if i >= 10:
+        del d[i - 10]
+print(len(d), sorted(d.items()))
+
+# delete and re-add the same key repeatedly
+d = {"a": 1, "b": 2, "c": 3}
+for i in range(50):
+    del d["b"]
+    d["b"] = i
+print(sorted(d.items()))
+
+# mixed key types, including keys that compare equal
+d = {}
+for k in (1, 2.5, "x", b"y", (1, 2), None, -7, 123456):
+    d[k] = repr(k)
+print(d[1], d[2.5], d["x"], d[b"y"], d[(1, 2)], d[None], d[-7], d[123456])
+d[True] = "true"
+d[1.0] = "float"
+print(len(d), d[1])
+del d[True]
+print(1 in d, True in d, len(d))
+
+# popitem empties the dict
+d = {i: i for i in range(30)}
+while d:
+    k, v = d.popitem()
+    assert k == v
+print(len(d))
+
+# copy keeps all the entries and is independent
+d = {str(i): i for i in range(40)}
+for i in range(0, 40, 3):
+    del d[str(i)]
+c = d.copy()
+c["new"] = 1
+del c["1"]
+print(len(d), len(c), "1" in d, "new" in d, c["38"])
@@ -0,0 +1,84 @@
+# Test generators and coroutines after they finish, when their state may be
+# reused by new ones.
+
+
+def gen(n):
+    cell = [n]
+
+    def get():
+        return cell[0]
+
+    for i in range(n):
+        yield get() + i
+    return n
+
+
+def fail():
+    yield 1
+    raise ValueError("fail")
+
+
+g = gen(2)
+print(list(g), list(g))
+print("gen" in str(g))
+try:
+    next(g)
+except StopIteration as e:
+    print("StopIteration", e.args)
+print(g.close())
+
+f = fail()
+print(next(f))
+try:
+    next(f)
+except ValueError as e:
+    print("ValueError", e)
+print(list(f))
+
+
+# A closure made by a generator outlives it.
+def make():
+    v = 1
+
+    def get():
+        return v
+
+    yield get
+    v = 2
+
+
+getters = []
+for i in range(3):
+    getters += list(make())
+for i in range(20):
+    list(gen(i % 5))
+print([get() for get in getters])
+
+
+async def inner(a):
+    return a * 2
+
+
+async def outer(n):
+    total = 0
+    for i in range(n):
+        total += await inner(i)
+    return total
+
+
+def run(coro):
+    try:
+        coro.send(None)
+    except StopIteration as e:
+        return e.value
+
+
+# Many generators of several sizes in flight and finishing.
+its = [gen(i % 7) for i in range(30)]
+total = 0
+for i in range(200):
+    total += run(outer(i % 4))
+    it = its[i % 30]
+    total += sum(it)
+    its[i % 30] = gen(i % 5)
+print(total)
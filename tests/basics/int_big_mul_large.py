@@ -0,0 +1,46 @@
+# test multiplying and pow() of ints big enough to take the fast paths
+
+# a simple generator of reproducible big numbers
+seed = 12345
+
+
+def rand_bits(bits):
+    global seed
+    r = 0
+    for _ in range((bits + 29) // 30):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        r = (r << 30) | (seed >> 1)
+    return r >> ((bits + 29) // 30 * 30 - bits) | 1 << (bits - 1)
+
+
+# balanced and unbalanced operands, of both signs
+for a in (100, 600, 1100, 2500):
+    for b in (40, 600, 1100, 2500, 6000):
+        x = rand_bits(a)
+        y = rand_bits(b)
+        p = x * y
+        print(a, b, p % 1000000007, p >> (a + b - 64))
+        print(-x * y == -p, x * -y == -p, -x * -y == p)
+        print(p // x == y, p // y == x)
+
+# squares, and numbers with all digits set
+for n in (700, 1024, 2049):
+    x = rand_bits(n)
+    print(x * x == x**2, (x * x) % 998244353)
+    z = (1 << n) - 1
+    print(z * z == (1 << 2 * n) - (1 << n + 1) + 1)
+
+# pow() with an odd modulus
+for m_bits in (3, 100, 1024):
+    m = rand_bits(m_bits) | 1
+    for e_bits in (1, 17, 300):
+        x = rand_bits(m_bits + 10)
+        e = rand_bits(e_bits)
+        r = pow(x, e, m)
+        print(m_bits, e_bits, r % 1000000007)
+        print(pow(-x, e, m), pow(x, e, -m), pow(-x, e, -m))
+        print(pow(x, e, m + 1) % 1000000007)
+
+# pow() with results of 0 and 1
+m = (1 << 700) + 1
+print(pow(m, 5, m), pow(m + 1, 1000, m), pow(-1, 3, m) == m - 1, pow(2, 1400, m))
@@ -0,0 +1,39 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+import io
+
+try:
+    io.BytesIO
+    io.BufferedReader
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+data = b"first line\nsecond\n\nlast line without newline"
+
+buf = io.BufferedReader(io.BytesIO(data), 8)
+print(buf.readline())
+print(buf.read(3))
+print(buf.readline())
+print(buf.readline())
+print(buf.readline(4))
+print(buf.readline())
+print(buf.readline())
+print(buf.read())
+
+# readinto, and reads bigger than the buffer
+buf = io.BufferedReader(io.BytesIO(data), 4)
+b = bytearray(6)
+print(buf.readinto(b), b)
+print(buf.read(2), buf.read(20))
+
+# iteration and readlines, with the default buffer size
+print(list(io.BufferedReader(io.BytesIO(data))))
+print(io.BufferedReader(io.BytesIO(data), 1).readlines())
+
+with io.BufferedReader(io.BytesIO(b"x")) as buf:
+    print(buf.read())
+
+try:
+    io.BufferedReader(io.BytesIO(), 0)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,37 @@
+# BytesIO.getbuffer returns a writable view of the contents
+import io
+
+try:
+    io.BytesIO().getbuffer
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+b = io.BytesIO()
+b.write(b"hello ")
+b.write(b"world")
+m = b.getbuffer()
+print(bytes(m), len(m))
+m[0] = ord("H")
+print(b.getvalue())
+
+# writing in place is seen through the view
+b.seek(0)
+b.write(b"J")
+print(bytes(m))
+
+# growing moves the data, the view keeps the old contents
+b.seek(0, 2)
+b.write(b"!" * 100)
+print(bytes(m), len(b.getvalue()))
+
+# a BytesIO made from bytes copies them before exporting
+src = b"const"
+b = io.BytesIO(src)
+m = b.getbuffer()
+m[0] = ord("K")
+print(bytes(m), b.getvalue(), src)
+
+# the view stays valid after close
+b.close()
+print(bytes(m))
@@ -0,0 +1,53 @@
+# test that list.sort is stable and calls key once per item
+
+# equal keys keep their order, also when reversed
+l = [(i % 3, i) for i in range(20)]
+print(sorted(l, key=lambda t: t[0]))
+print(sorted(l, key=lambda t: t[0], reverse=True))
+
+# long runs, in and out of order
+l = list(range(200)) + list(range(100, 0, -1)) + [i % 5 for i in range(300)]
+s = sorted(l)
+print(s == sorted(s), s[:10], s[-3:], len(s))
+print(sorted([(i // 50, -i) for i in range(500)], key=lambda t: t[0])[45:55])
+
+calls = 0
+
+
+def key(x):
+    global calls
+    calls += 1
+    return -x
+
+
+l = list(range(1000))
+l.sort(key=key)
+print(calls, l[:3], l[-3:])
+
+
+# a comparison that raises, such as in the middle of a merge, leaves every
+# item in the list
+compares = 0
+
+
+class C:
+    def __init__(self, v):
+        self.v = v
+
+    def __lt__(self, other):
+        global compares
+        compares -= 1
+        if compares == 0:
+            raise ValueError
+        return self.v < other.v
+
+
+values = [i * 7 % 101 for i in range(300)]
+for n in (500, 1700, 1850, 2000):
+    l = [C(v) for v in values]
+    compares = n
+    try:
+        l.sort()
+    except ValueError:
+        print("ValueError")
+    print(len(l), sorted(c.v for c in l) == sorted(values))
@@ -0,0 +1,50 @@
+# Test binary operations with a small int constant on the right-hand side, which
+# may be specialised by the compiler, on a range of left-hand sides.
+
+# small ints, including results that overflow the small int range
+for x in (0, 1, -1, 0x3FFFFFFF, -0x40000000, 0x3FFFFFFFFFFF, 1 << 70):
+    print(x + 1, x - 1, x + 1000, x - 1000, x < 1, x > 1, x == 1)
+    print(x + -1, x - -200, x < -1, x > -1, x == -1)
+    y = x
+    y += 1
+    print(y)
+
+# other types
+print(1.5 + 1, 1.5 - 1, 1.5 < 2, 1.5 > 2, 1.0 == 1)
+print(True + 1, False - 1, True == 1)
+print("a" == 1)
+
+
+class A:
+    def __add__(self, other):
+        return "add %d" % other
+
+    def __iadd__(self, other):
+        return "iadd %d" % other
+
+    def __sub__(self, other):
+        return "sub %d" % other
+
+    def __lt__(self, other):
+        return "lt %d" % other
+
+    def __gt__(self, other):
+        return "gt %d" % other
+
+    def __eq__(self, other):
+        return "eq %d" % other
+
+
+a = A()
+print(a + 1, a - 2, a < 3, a > 4, a == 5)
+a += 6
+print(a)
+
+try:
+    "a" + 1
+except TypeError:
+    print("TypeError")
+try:
+    None < 1
+except TypeError:
+    print("TypeError")
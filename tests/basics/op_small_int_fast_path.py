@@ -0,0 +1,39 @@
+# test binary ops and comparisons on small ints, including results that
+# overflow the small int range and mixed operand types
+
+# values either side of the 31-bit and 63-bit small int limits
+big = 1 << 62
+vals = [0, 1, -1, 7, -13, 0x3FFFFFFF, -0x40000000, 0x3FFFFFFFFFFFFFFF, -0x4000000000000000]
+
+for a in vals:
+    for b in vals:
+        print(a, b, a + b, a - b, a * b, a | b, a ^ b, a & b)
+        print(a < b, a > b, a == b, a <= b, a >= b, a != b)
+
+# inplace variants
+x = 0x3FFFFFFF
+x += 1
+print(x)
+x -= 0x7FFFFFFF
+print(x)
+x *= x
+print(x)
+x = 6
+x |= 9
+x ^= 3
+x &= 12
+print(x)
+
+# carry on into big ints then back
+n = big
+for i in range(4):
+    n = n * 2 - big
+    print(n)
+
+# mixed types still go through the generic path
+print(1 + True, 2 * False, 3 == 3.0, 4 < 4.5, 5 & True)
+print([1] * 3, 3 * "ab")
+try:
+    1 + "a"
+except TypeError:
+    print("TypeError")
@@ -141,3 +141,81 @@ for i in range(0, len(plaintext), 16):
     output = memoryview(plaintext)[i : i + 16]
     print(str(hexlify(output), ""))
 print()
+
+print("CTR-streamed")
+# Pieces of any length continue the key stream, in place.
+plaintext = unhexlify(
+    "6bc1bee22e409f96e93d7e117393172a"
+    "ae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52ef"
+    "f69f2445df4f9b17ad2b417be66c3710"
+)
+key = unhexlify("2b7e151628aed2a6abf7158809cf4f3c")
+counter = unhexlify("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff")
+buf = bytearray(plaintext)
+cipher = aesio.AES(key, aesio.MODE_CTR, IV=counter)
+for start, end in ((0, 5), (5, 21), (21, 64)):
+    piece = memoryview(buf)[start:end]
+    cipher.encrypt_into(piece, piece)
+print(str(hexlify(buf), ""))
+print()
+
+print("GCM")
+# Test cases 1, 2, 4 and 5 from "The Galois/Counter Mode of Operation (GCM)"
+
+
+def gcm(key, iv, aad, plaintext, piece=None):
+    key = unhexlify(key)
+    iv = unhexlify(iv)
+    aad = unhexlify(aad)
+    plaintext = unhexlify(plaintext)
+    piece = piece or max(len(plaintext), 1)
+    cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+    cipher.update(aad)
+    cyphertext = bytearray(len(plaintext))
+    for i in range(0, len(plaintext), piece):
+        cipher.encrypt_into(plaintext[i : i + piece], memoryview(cyphertext)[i : i + piece])
+    tag = cipher.digest()
+    print(str(hexlify(cyphertext), ""))
+    print(str(hexlify(tag), ""))
+
+    cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+    cipher.update(aad)
+    decrypted = bytearray(cyphertext)
+    cipher.decrypt_into(decrypted, decrypted)
+    cipher.verify(tag)
+    print(decrypted == plaintext)
+    try:
+        cipher.verify(bytes(16))
+    except ValueError:
+        print("ValueError")
+
+
+gcm("00000000000000000000000000000000", "000000000000000000000000", "", "")
+gcm(
+    "00000000000000000000000000000000",
+    "000000000000000000000000",
+    "",
+    "00000000000000000000000000000000",
+)
+key = "feffe9928665731c6d6a8f9467308308"
+plaintext = (
+    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+    "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39"
+)
+aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2"
+gcm(key, "cafebabefacedbaddecaf888", aad, plaintext)
+gcm(key, "cafebabefacedbaddecaf888", aad, plaintext, 7)
+gcm(key, "cafebabefacedbad", aad, plaintext)
+
+cipher = aesio.AES(unhexlify(key), aesio.MODE_GCM, IV=unhexlify("cafebabefacedbaddecaf888"))
+cipher.encrypt_into(b"x", bytearray(1))
+try:
+    cipher.update(b"too late")
+except ValueError:
+    print("ValueError")
+cipher = aesio.AES(unhexlify(key), aesio.MODE_CTR)
+try:
+    cipher.digest()
+except ValueError:
+    print("ValueError")
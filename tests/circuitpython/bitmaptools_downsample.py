@@ -0,0 +1,37 @@
+import displayio
+import bitmaptools
+
+# 8x4 RGB565 source: left half white, right half pure red
+src = displayio.Bitmap(8, 4, 65536)
+for y in range(4):
+    for x in range(8):
+        src[x, y] = 0xFFFF if x < 4 else 0xF800
+
+# grayscale, binned 2x2
+gray = displayio.Bitmap(4, 2, 256)
+bitmaptools.downsample(gray, src, displayio.Colorspace.RGB565, factor=2)
+print([gray[x, 0] for x in range(4)])
+
+# crop one block out of the middle, averaging white and red
+one = displayio.Bitmap(1, 1, 256)
+bitmaptools.downsample(one, src, displayio.Colorspace.RGB565, x=3, y=1, factor=2)
+print(one[0, 0])
+
+# color stays in RGB565
+color = displayio.Bitmap(2, 1, 65536)
+bitmaptools.downsample(color, src, displayio.Colorspace.RGB565, factor=4)
+print(hex(color[0, 0]), hex(color[1, 0]))
+
+# L8 to L8
+l8 = displayio.Bitmap(4, 4, 256)
+for i in range(16):
+    l8[i] = i * 16
+small = displayio.Bitmap(2, 2, 256)
+bitmaptools.downsample(small, l8, displayio.Colorspace.L8, factor=2)
+print([small[i] for i in range(4)])
+
+# region must fit in the source
+try:
+    bitmaptools.downsample(gray, src, displayio.Colorspace.RGB565, x=1, factor=2)
+except ValueError as e:
+    print("ValueError", e)
@@ -0,0 +1,50 @@
+import array
+import dsp
+
+taps = array.array("f", [0.5, 0.25, 0.125, 0.125])
+fir = dsp.FIR(taps)
+print(fir.decimation)
+
+# the impulse response is the taps themselves
+impulse = array.array("f", [1] + [0] * 7)
+out = array.array("f", [0] * 8)
+print(list(fir.filter(impulse, out)))
+
+# filtering in blocks gives the same result as filtering all at once
+data = array.array("f", [(i * 37) % 11 - 5 for i in range(40)])
+fir.reset()
+whole = fir.filter(data, array.array("f", [0] * 40))
+fir.reset()
+pieces = []
+for start, end in ((0, 3), (3, 4), (4, 25), (25, 40)):
+    block = array.array("f", data[start:end])
+    pieces.extend(fir.filter(block, array.array("f", [0] * len(block))))
+print(pieces == list(whole))
+
+# decimation keeps every n-th output of the undecimated filter
+decimator = dsp.FIR(taps, decimation=4)
+print(decimator.decimation)
+pieces = []
+for start in range(0, 40, 8):
+    pieces.extend(decimator.filter(array.array("f", data[start : start + 8]), array.array("f", [0] * 2)))
+print(pieces == list(whole)[::4])
+
+try:
+    decimator.filter(array.array("f", [0] * 6), array.array("f", [0] * 2))
+except ValueError as e:
+    print(e)
+
+try:
+    fir.filter(data, data)
+except ValueError as e:
+    print(e)
+
+try:
+    fir.filter(data, array.array("f", [0] * 4))
+except ValueError as e:
+    print(e)
+
+try:
+    dsp.FIR(array.array("f"))
+except ValueError as e:
+    print(e)
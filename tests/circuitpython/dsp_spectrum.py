@@ -0,0 +1,51 @@
+import array
+import math
+import dsp
+
+
+def dft(x):
+    n = len(x)
+    out = []
+    for k in range(n // 2 + 1):
+        re = sum(x[i] * math.cos(2 * math.pi * k * i / n) for i in range(n))
+        im = -sum(x[i] * math.sin(2 * math.pi * k * i / n) for i in range(n))
+        out.append((re, im))
+    return out
+
+
+# rfft matches a direct DFT, in the CMSIS packed layout
+for n in (2, 4, 8, 64):
+    x = array.array("f", [math.sin(i * 1.3) + (i % 5) * 0.25 for i in range(n)])
+    ref = dft(x)
+    y = dsp.rfft(x, array.array("f", [0] * n))
+    err = max(abs(y[0] - ref[0][0]), abs(y[1] - ref[n // 2][0]))
+    for k in range(1, n // 2):
+        err = max(err, abs(y[2 * k] - ref[k][0]), abs(y[2 * k + 1] - ref[k][1]))
+    print(n, err < 1e-3 * n)
+
+# in place, a pure tone lands in a single bin of the power spectrum
+x = array.array("f", [math.cos(2 * math.pi * 5 * i / 32) for i in range(32)])
+dsp.rfft(x)
+power = dsp.power_spectrum(x)
+print(len(power), [round(p) for p in power])
+
+# window shapes match the numpy definitions
+for kind in (dsp.Window.HANN, dsp.Window.HAMMING, dsp.Window.BLACKMAN):
+    w = array.array("f", [1] * 9)
+    dsp.window(w, kind)
+    print(kind, " ".join("%.4f" % (round(v, 4) + 0) for v in w))
+
+try:
+    dsp.rfft(array.array("f", [0] * 12))
+except ValueError as e:
+    print(e)
+
+try:
+    dsp.rfft(array.array("h", [0] * 16))
+except ValueError as e:
+    print(e)
+
+try:
+    dsp.power_spectrum(array.array("f", [0] * 16), array.array("f", [0] * 4))
+except ValueError as e:
+    print(e)
@@ -0,0 +1,67 @@
+# Test gnssio parsing NMEA sentences and UBX messages.
+import struct
+
+import gnssio
+
+receiver = gnssio.Receiver()
+fix = gnssio.Fix()
+print(fix.valid, receiver.read_fix(fix))
+
+# Sentences may be split anywhere.
+gga = b"$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n"
+receiver.feed(gga[:20])
+print(receiver.read_fix(fix))
+receiver.feed(gga[20:])
+print(receiver.read_fix(fix), receiver.read_fix(fix))
+print(fix.valid, fix.quality, fix.satellites)
+print(round(fix.latitude, 4), round(fix.longitude, 4), fix.altitude, round(fix.dop, 2))
+
+receiver.feed(b"$GNRMC,123520,A,3346.1234,S,15112.5678,W,022.4,084.4,230394,003.1,W*7F\r\n")
+receiver.read_fix(fix)
+print(fix.valid, round(fix.latitude, 4), round(fix.longitude, 4))
+print(round(fix.speed, 2), round(fix.course, 1))
+
+# A wrong checksum is counted and the sentence dropped.
+receiver.feed(b"$GPGGA,123521,0000.000,N,00000.000,E,1,08,0.9,545.4,M,46.9,M,,*00\r\n")
+print(receiver.read_fix(fix), receiver.checksum_errors)
+
+# An invalid RMC leaves the position alone.
+receiver.feed(b"$GPRMC,123522,V,,,,,,,230394,,*3B\r\n")
+receiver.read_fix(fix)
+print(fix.valid, round(fix.latitude, 4))
+
+
+def ubx(cls, id, payload):
+    body = struct.pack("<BBH", cls, id, len(payload)) + payload
+    ck_a = ck_b = 0
+    for b in body:
+        ck_a = (ck_a + b) & 0xFF
+        ck_b = (ck_b + ck_a) & 0xFF
+    return b"\xb5\x62" + body + bytes((ck_a, ck_b))
+
+
+pvt = bytearray(92)
+struct.pack_into("<HBBBBBB", pvt, 4, 2024, 5, 6, 7, 8, 9, 0x03)
+struct.pack_into("<BBBB", pvt, 20, 3, 0x03, 0, 12)
+struct.pack_into("<ii", pvt, 24, -1225000000, 374000000)
+struct.pack_into("<i", pvt, 36, 12345)
+struct.pack_into("<ii", pvt, 60, 1500, 9000000)
+struct.pack_into("<H", pvt, 76, 150)
+message = ubx(0x01, 0x07, pvt)
+# Other messages and noise between them are skipped.
+receiver.feed(ubx(0x01, 0x35, b"\x00" * 8) + b"noise" + message)
+print(receiver.read_fix(fix))
+print(fix.valid, fix.quality, fix.satellites)
+print(fix.latitude, fix.longitude, fix.altitude)
+print(fix.speed, fix.course, fix.dop)
+
+bad = bytearray(message)
+bad[-1] ^= 1
+receiver.feed(bad)
+print(receiver.read_fix(fix), receiver.checksum_errors)
+
+receiver.deinit()
+try:
+    receiver.feed(gga)
+except ValueError as e:
+    print("ValueError")
@@ -0,0 +1,23 @@
+try:
+    import msgpack
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+buf = bytearray(16)
+end = msgpack.pack_into([1, b"ab", "c"], buf, 2)
+print(end, bytes(buf[2:end]))
+print(msgpack.unpack_from(buf, 2))
+
+obj, end = msgpack.unpack_from(buf, 2, zero_copy=True)
+print(type(obj[1]).__name__, bytes(obj[1]), end)
+buf[6] = ord("x")
+print(bytes(obj[1]))
+
+obj, end = msgpack.unpack_from(memoryview(buf)[2:end], zero_copy=True)
+print(bytes(obj[1]), end)
+
+try:
+    msgpack.pack_into(b"abcdef", bytearray(4))
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,55 @@
+# test struct.iter_unpack and unpack_columns_into
+import struct
+from array import array
+
+data = struct.pack("<hBxf", 1, 2, 0.5) + struct.pack("<hBxf", -3, 4, 1.25) + struct.pack("<hBxf", 5, 255, -2.0)
+print(list(struct.iter_unpack("<hBxf", data)))
+s = struct.Struct("<hBxf")
+it = s.iter_unpack(memoryview(data))
+print(next(it), list(it))
+try:
+    struct.iter_unpack("<hBxf", data[1:])
+except ValueError as e:
+    print("ValueError")
+try:
+    struct.iter_unpack("", data)
+except ValueError as e:
+    print("ValueError")
+
+# columns: typed arrays, widening, a list and skipped values
+a = array("h", [0] * 3)
+b = array("i", [0] * 3)
+c = array("d", [0] * 3)
+print(struct.unpack_columns_into("<hBxf", data, 0, (a, b, c)), a, b, c)
+lst = [None] * 2
+f = array("f", [0] * 3)
+print(s.unpack_columns_into([lst, None, f], data, s.size), lst, f)
+print(s.unpack_columns_into([None, None, None], data, -s.size))
+
+# big endian and native formats, int to float column
+be = struct.pack(">HI", 513, 70000) * 2
+h = array("H", [0, 0])
+d = array("f", [0, 0])
+print(struct.unpack_columns_into(">HI", be, 0, [h, d]), h, d)
+nat = struct.pack("@bi", -1, -70000) * 2
+ba = bytearray(2)
+i = array("i", [0, 0])
+print(struct.unpack_columns_into("@bi", nat, 0, [i, i]), i)
+print(struct.unpack_columns_into("Bi", struct.pack("Bi", 200, 1), 0, [ba, None]), ba)
+
+# bytes fields go into lists
+print(struct.unpack_columns_into("2sB", b"ab\x01cd\x02", 0, [lst, ba]), lst, ba)
+
+# values that don't fit the column raise
+try:
+    struct.unpack_columns_into("<h", b"\xff\xff", 0, [bytearray(1)])
+except OverflowError:
+    print("OverflowError")
+try:
+    struct.unpack_columns_into("<hB", data, 0, [a])
+except ValueError:
+    print("ValueError")
+try:
+    struct.unpack_columns_into("<h", data, 0, [b"xx"])
+except TypeError:
+    print("TypeError")
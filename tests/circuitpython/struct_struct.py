@@ -0,0 +1,26 @@
+# test struct.Struct, which compiles its format once
+import struct
+s = struct.Struct("<hI2sxf")
+print(s.size, s.format, struct.calcsize("<hI2sxf"))
+b = s.pack(-2, 70000, b"ab", 1.5)
+print(b, b == struct.pack("<hI2sxf", -2, 70000, b"ab", 1.5))
+print(s.unpack(b), s.unpack_from(b"zz" + b, 2), s.unpack_from(b"zz" + b, -s.size))
+buf = bytearray(s.size + 1)
+s.pack_into(buf, 1, 3, 4, b"c", 2.0)
+print(buf)
+out = [None] * 4
+s.unpack_from_into(out, buf, 1)
+print(out)
+try:
+    s.unpack_from_into([0], buf, 1)
+except ValueError as e:
+    print("ValueError")
+try:
+    s.unpack(b"x")
+except RuntimeError as e:
+    print(e)
+try:
+    s.pack(1)
+except ValueError as e:
+    print("ValueError")
+print(struct.Struct("3B").unpack(b"\x01\x02\x03"), struct.Struct(">").size)
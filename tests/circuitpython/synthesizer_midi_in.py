@@ -0,0 +1,44 @@
+import io
+import audiocore
+import synthio
+
+
+def step(data=b""):
+    s.midi_in = io.BytesIO(data)
+    audiocore.get_buffer(s)
+    print(s.pressed)
+
+
+s = synthio.Synthesizer(sample_rate=8000)
+print(s.midi_in, s.midi_channel)
+
+# Note On, then a second Note On using running status
+step(b"\x90\x3c\x40\x40\x40")
+# Note On with velocity 0 releases
+step(b"\x90\x3c\x00")
+# Note Off, with a real time Clock byte in the middle of it
+step(b"\x80\x40\xf8\x7f")
+# System Exclusive data is ignored and cancels running status
+step(b"\x91\x30\x7f\xf0\x31\x7f\xf7\x32\x7f")
+# All Notes Off
+step(b"\xb1\x7b\x00")
+
+# Only the selected channel is played
+s.midi_channel = 2
+print(s.midi_channel)
+step(b"\x90\x3c\x40\x92\x3e\x40")
+s.midi_channel = None
+step(b"\x90\x3c\x40")
+
+try:
+    s.midi_channel = 16
+except ValueError as e:
+    print("ValueError")
+
+try:
+    s.midi_in = 42
+except OSError as e:
+    print("OSError")
+
+s.midi_in = None
+print(s.midi_in)
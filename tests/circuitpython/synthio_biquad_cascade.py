@@ -0,0 +1,46 @@
+import array
+from synthio import BiquadCascade, Synthesizer
+
+synth = Synthesizer(sample_rate=8000)
+lpf = synth.low_pass_filter(400)
+hpf = synth.high_pass_filter(50)
+
+cascade = BiquadCascade((hpf, lpf))
+print(len(cascade.filters))
+
+# a step: the high pass removes the DC part and the low pass smooths the edge
+step = array.array("h", [0] * 8 + [16000] * 56)
+cascade.process(step)
+print(list(step))
+
+# filtering in two pieces gives the same result as filtering all at once
+cascade.reset()
+data = array.array("h", [(i * 7919) % 20001 - 10000 for i in range(600)])
+whole = array.array("h", data)
+cascade.process(whole)
+cascade.reset()
+first = array.array("h", data[:250])
+second = array.array("h", data[250:])
+cascade.process(first)
+cascade.process(second)
+print(list(first) + list(second) == list(whole))
+
+# a single filter is accepted without a tuple
+single = BiquadCascade(lpf)
+print(single.filters == (lpf,))
+
+# a square wave at the centre of a band pass filter is clipped to 16 bits
+peak = BiquadCascade(synth.band_pass_filter(1000, 2))
+loud = array.array("h", [32767, 32767, 32767, 32767, -32768, -32768, -32768, -32768] * 25)
+peak.process(loud)
+print(max(loud), min(loud))
+
+try:
+    cascade.process(bytearray(4))
+except ValueError as e:
+    print(e)
+
+try:
+    BiquadCascade((lpf, 1))
+except TypeError as e:
+    print(e)
@@ -0,0 +1,37 @@
+# Test the allocation profiler of uheap.
+
+try:
+    import uheap
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def churn():
+    out = []
+    for i in range(20):
+        out.append([i, i])  # line 13
+    return out
+
+
+uheap.profile_start()
+churn()
+uheap.profile_stop()
+churn()
+
+hist = uheap.profile()
+count, total = hist[(__file__, 13)]
+print(count >= 20, total >= 20 * 2 * 4)
+print(all(isinstance(k[1], int) and v[0] > 0 for k, v in hist.items()))
+
+# Sampling every Nth allocation records fewer samples.
+uheap.profile_start(10)
+churn()
+uheap.profile_stop()
+count, total = uheap.profile()[(__file__, 13)]
+print(0 < count < 20)
+
+try:
+    uheap.profile_start(0)
+except ValueError:
+    print("ValueError")
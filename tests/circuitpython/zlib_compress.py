@@ -0,0 +1,43 @@
+try:
+    import zlib
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+data = "".join("%d: sensor ok, temp=%d\n" % (i, i % 7) for i in range(200)).encode()
+
+for wbits in (15, -15, 31, 9):
+    for level in (0, 1, 6, 9):
+        packed = zlib.compress(data, level, wbits)
+        print(wbits, level, zlib.decompress(packed, wbits) == data, len(packed) < len(data) + 32)
+
+# Streaming compression in pieces.
+c = zlib.compressobj(6, 8, 15, 4)
+packed = b""
+for i in range(0, len(data), 100):
+    packed += c.compress(data[i : i + 100])
+packed += c.flush()
+print(zlib.decompress(packed) == data)
+
+# Streaming decompression with bounded output.
+d = zlib.decompressobj()
+out = b""
+for i in range(0, len(packed), 13):
+    chunk = d.decompress(packed[i : i + 13], 64)
+    while True:
+        assert len(chunk) <= 64
+        out += chunk
+        if not d.unconsumed_tail:
+            break
+        chunk = d.decompress(d.unconsumed_tail, 64)
+while not d.eof:
+    chunk = d.decompress(b"", 64)
+    if not chunk:
+        break
+    out += chunk
+out += d.flush()
+print(out == data, d.eof)
+
+# Data after the end of the stream.
+d = zlib.decompressobj()
+print(d.decompress(zlib.compress(b"hello") + b"extra") == b"hello", d.unused_data)
@@ -0,0 +1,14 @@
+try:
+    import binascii
+
+    binascii.crc_hqx
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+print(hex(binascii.crc_hqx(b"123456789", 0)))
+print(hex(binascii.crc_hqx(b"123456789", 0xFFFF)))
+print(hex(binascii.crc_hqx(b"", 0x1234)))
+print(hex(binascii.crc_hqx(bytes(range(256)), 0)))
+print(hex(binascii.crc_hqx(bytes(range(128, 256)), binascii.crc_hqx(bytes(range(128)), 0))))
+print(hex(binascii.crc_hqx(b"\xff" * 100, 0x1D0F)))
@@ -0,0 +1,39 @@
+try:
+    import bisect
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+a = [1, 2, 2, 2, 5, 8]
+for x in (0, 2, 3, 8, 9):
+    print(x, bisect.bisect_left(a, x), bisect.bisect_right(a, x), bisect.bisect(a, x))
+print(bisect.bisect_left(a, 2, 2), bisect.bisect_right(a, 2, 0, 3), bisect.bisect_left(a, 2, hi=1))
+print(bisect.bisect_left((1.5, 2.5), 2), bisect.bisect_right(["a", "c"], "b"))
+
+b = []
+for x in (5, 1, 4, 1, 3):
+    bisect.insort(b, x)
+print(b)
+bisect.insort_left(b, 4)
+bisect.insort_right(b, 0, 0, 0)
+print(b)
+
+# key function
+recs = [(1, "a"), (3, "b"), (5, "c")]
+print(bisect.bisect_left(recs, 3, key=lambda r: r[0]), bisect.bisect_right(recs, 3, key=lambda r: r[0]))
+bisect.insort(recs, (4, "d"), key=lambda r: r[0])
+bisect.insort_left(recs, (3, "e"), key=lambda r: r[0])
+print(recs)
+
+# other sequences
+from array import array
+print(bisect.bisect(array("h", [1, 3, 5]), 4), bisect.bisect_left(range(0, 100, 10), 35))
+
+try:
+    bisect.bisect(a, 1, -1)
+except ValueError:
+    print("ValueError")
+try:
+    bisect.insort((1, 2), 3)
+except AttributeError:
+    print("AttributeError")
@@ -0,0 +1,44 @@
+try:
+    from heapq import PriorityQueue
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+q = PriorityQueue()
+print(len(q), bool(q))
+for p, item in ((5, "e"), (1, "a"), (3, "c"), (1, "a2"), (4.5, "d"), (-2, "z"), (3, "c2")):
+    q.push(p, item)
+print(len(q), bool(q), q.peek(), q.peek_priority())
+out = []
+while q:
+    out.append((q.peek_priority(), q.pop()))
+print(out)
+
+# grows beyond its initial capacity and keeps insertion order for ties
+q = PriorityQueue(2)
+for i in range(20):
+    q.push(i % 4, i)
+print([q.pop() for _ in range(len(q))])
+
+q.push(1.25, None)
+q.push(1, "int")
+print(q.pop(), q.peek_priority())
+q.clear()
+print(len(q))
+
+try:
+    q.pop()
+except IndexError:
+    print("IndexError")
+try:
+    q.peek()
+except IndexError:
+    print("IndexError")
+try:
+    q.push("x", 1)
+except TypeError:
+    print("TypeError")
+try:
+    PriorityQueue(-1)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,18 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+import io, json
+
+# Test that load() leaves a seekable stream positioned just after the object
+# it decoded, even though it reads ahead.
+
+s = io.StringIO('{"a": 1} [2, 3] 45 "six"' + " " * 100 + "7")
+for _ in range(5):
+    print(json.load(s))
+
+s = io.BytesIO(b"[" + b",".join(b'"%d"' % i for i in range(200)) + b"]\ntail")
+print(len(json.load(s)), s.read())
+
+# a long dump() goes out through the stream in chunks
+b = io.BytesIO()
+obj = {"k": ["x" * 200, list(range(50))]}
+json.dump(obj, b)
+print(json.loads(b.getvalue()) == obj)
@@ -0,0 +1,31 @@
+# test the object_hook argument to json.load and json.loads
+
+try:
+    import io, json
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    json.loads("{}", object_hook=dict)
+except TypeError:
+    print("SKIP")
+    raise SystemExit
+
+# nested objects are passed to the hook innermost first
+print(json.loads('{"a": {"b": 1}, "c": [{"d": 2}, 3]}', object_hook=lambda d: sorted(d.items())))
+print(json.loads('[1, {"x": [2, {"y": 3}]}]', object_hook=len))
+print(json.loads("[[], {}]", object_hook=lambda d: "obj"))
+print(json.load(io.StringIO('{"k": 5}'), object_hook=lambda d: d["k"]))
+print(json.loads('{"k": 5}', object_hook=None))
+
+# each item of a large array can be consumed as soon as it is decoded
+ids = []
+
+
+def collect(d):
+    ids.append(d["id"])
+
+
+doc = "[" + ", ".join('{"id": %d}' % i for i in range(100)) + "]"
+print(json.load(io.StringIO(doc), object_hook=collect).count(None), ids == list(range(100)))
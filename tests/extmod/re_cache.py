@@ -0,0 +1,23 @@
+# test that patterns given as strings give the right matches when they are
+# reused, including after being evicted from any cache of compiled patterns
+
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+patterns = ["a+", "b+", r"\d+", "(c)(d)", "e|f", "[gh]+", "i*j", "k.l", "m?n"]
+subject = "xaabbb123cdfghhijkzlmn"
+for _ in range(3):
+    for p in patterns:
+        m = re.search(p, subject)
+        print(p, m.group(0), re.match(p, subject))
+    patterns.reverse()
+
+print(re.sub("[aeiou]", "-", "circuitpython"), re.sub("[aeiou]", "-", "micropython"))
+print(re.compile("o+").split("foo boo"), re.compile(b"o+").split(b"foo boo"))
+print(re.match(b"a+", b"aaab").group(0), re.match("a+", "aaab").group(0))
+
+# a pattern that takes a backtracking matcher a long time to reject
+print(re.match("(a|a)*b", "a" * 16))
@@ -0,0 +1,31 @@
+# test patterns that the Pike VM matcher handles without recursing or
+# backtracking
+
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# The backtracking matcher runs out of stack on this one.
+try:
+    re.match("(a*)*", "aaa")
+except RuntimeError:
+    print("SKIP")
+    raise SystemExit
+
+print(re.match("(a*)*", "aaa").group(0))
+print(re.match("(a*)+b", "aaab").group(0))
+print(re.match("(a*)*", "").group(0) == "")
+
+# long subjects that would need deep recursion to backtrack through
+subject = "ab" * 300 + "c"
+print(re.match("(a|b)*c", subject).group(0) == subject)
+print(re.search("(a|b)*d", subject))
+
+# exponential time for a backtracking matcher, linear here
+print(re.match("(x*)*y", "x" * 50))
+print(re.match("(x|x)*y", "x" * 50))
+
+m = re.search("(a+|b+)*c", "zzaabbac")
+print(m.group(0), m.group(1), m.start(), m.end())
@@ -8,3 +8,7 @@ try:
     re.match("(a*)*", "aaa")
 except RuntimeError:
     print("RuntimeError")
+else:
+    # CIRCUITPY-CHANGE: only the backtracking matcher recurses on this pattern.
+    # The Pike VM finds the match instead, which re_pikevm.py checks.
+    print("SKIP")
@@ -0,0 +1,80 @@
+# Test random access reads in fragmented files, which use the FatFs fast seek
+# cluster map when opened read-only.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.ERASE_BLOCK_SIZE + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.ERASE_BLOCK_SIZE + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # get number of blocks
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # get block size
+            return self.ERASE_BLOCK_SIZE
+
+
+try:
+    bdev = RAMBlockDevice(80)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+os.chdir("/ramdisk")
+
+
+def chunk(name, i):
+    return bytes((name + i * 7 + j) & 0xFF for j in range(512))
+
+
+# Interleave the writes so that both files are fragmented.
+with open("a", "wb") as fa, open("b", "wb") as fb:
+    for i in range(12):
+        fa.write(chunk(1, i))
+        fa.flush()
+        fb.write(chunk(2, i))
+        fb.flush()
+
+# A file within one cluster is also fine.
+with open("small", "wb") as f:
+    f.write(b"0123456789")
+
+for name, seed in (("a", 1), ("b", 2)):
+    with open(name, "rb") as f:
+        ok = True
+        for i in (11, 0, 5, 3, 10, 1, 7):
+            f.seek(i * 512 + 100)
+            ok = ok and f.read(8) == chunk(seed, i)[100:108]
+        f.seek(-4, 2)
+        ok = ok and f.read() == chunk(seed, 11)[-4:]
+        f.seek(0)
+        ok = ok and f.read() == b"".join(chunk(seed, i) for i in range(12))
+        print(name, ok)
+
+with open("small", "rb") as f:
+    f.seek(4)
+    print(f.read(3))
+    f.seek(-2, 2)
+    print(f.read())
+
+os.umount("/ramdisk")
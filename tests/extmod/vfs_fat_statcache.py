@@ -0,0 +1,73 @@
+# Test stat() of the entries of a directory, which FAT serves from the
+# directory left open by the previous lookup.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.ERASE_BLOCK_SIZE + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.ERASE_BLOCK_SIZE + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # get number of blocks
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # get block size
+            return self.ERASE_BLOCK_SIZE
+
+
+try:
+    bdev = RAMBlockDevice(80)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+
+vfs.mkdir("/logs")
+for i in range(12):
+    with vfs.open("/logs/log%d.txt" % i, "w") as f:
+        f.write("x" * i)
+
+# In listing order, out of order, and with different case.
+print([vfs.stat("/logs/" + name)[6] for name in sorted(e[0] for e in vfs.ilistdir("/logs"))])
+print([vfs.stat("/logs/log%d.txt" % i)[6] for i in (11, 3, 7, 0)])
+print(vfs.stat("/logs/LOG5.TXT")[6])
+
+# Changes to the directory are seen.
+vfs.remove("/logs/log4.txt")
+try:
+    vfs.stat("/logs/log4.txt")
+except OSError as e:
+    print("removed", e.errno)
+vfs.rename("/logs/log2.txt", "/logs/old.txt")
+print(vfs.stat("/logs/old.txt")[6])
+with vfs.open("/logs/log1.txt", "a") as f:
+    f.write("yyy")
+print(vfs.stat("/logs/log1.txt")[6])
+
+# The directory itself going away.
+for name in [e[0] for e in vfs.ilistdir("/logs")]:
+    vfs.remove("/logs/" + name)
+vfs.rmdir("/logs")
+try:
+    vfs.stat("/logs/log1.txt")
+except OSError as e:
+    print("gone", e.errno)
+print(vfs.stat("/")[0] & 0x4000 != 0)
@@ -0,0 +1,23 @@
+# test binary ops and comparisons on two floats
+
+vals = [0.0, -0.0, 1.5, -2.25, 256.0, float("inf"), float("-inf")]
+
+for a in vals:
+    for b in vals:
+        print(a, b, a + b, a - b, a * b)
+        print(a < b, a > b, a == b, a <= b, a >= b, a != b)
+
+# nan compares unequal even to itself
+nan = float("nan")
+print(nan == nan, nan != nan, nan < nan, nan >= nan)
+x = nan
+print(x == x, x is x)
+
+x = 1.0
+x += 0.5
+x -= 0.25
+x *= 4.0
+print(x)
+
+# mixed int/float still goes through the generic path
+print(1 + 0.5, 2.5 * 2, 3 == 3.0, 1.5 < 2)
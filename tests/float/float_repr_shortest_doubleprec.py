@@ -0,0 +1,23 @@
+# Test that repr gives the shortest digits that read back as the same float,
+# and that parsing rounds correctly.
+# Relies on double-precision floats.
+
+print(0.1 + 0.2, 1 / 3, 2 / 3, 1e23, 5e-324, 1.7976931348623157e308)
+print(repr(100.0), repr(1e16), repr(1e-5), repr(0.0001), repr(123456789012345680.0))
+print(float("8.8246784950289995e15"), float("9007199254740993"))
+print(float("2.2250738585072011e-308"), float("4.9406564584124654e-324"))
+print(float("1.00000000000000011102230246251565404236316680908203125"))
+print(float("0." + "9" * 30), float("1" * 30 + "e-10"))
+
+# Precision formats round the exact value.
+print("%.1f %.2f %.3f" % (0.25, 1.005, 2.0005))
+print("%.17g %.16e %.3e" % (0.1, 0.1, 12345.0))
+print("{:.1g} {:.2g} {:g}".format(-9.9, 99.9, 1e-5))
+
+# Round trips.
+x = 0.5
+for i in range(200):
+    x = x * 1.37 + 1e-3
+    assert float(repr(x)) == x
+    assert float(repr(1 / x)) == 1 / x
+print("ok")
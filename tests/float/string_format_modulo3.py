@@ -1,3 +1,3 @@
-# uPy and CPython outputs differ for the following
+# uPy without MICROPY_FLOAT_FAST_CONVERSION gives -10 and 100 for these
 print("%.1g" % -9.9)  # round up 'g' with '-' sign
 print("%.2g" % 99.9)  # round up
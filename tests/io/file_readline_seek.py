@@ -0,0 +1,27 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+# readline() reads seekable files ahead; check that the position is kept exact
+
+f = open("data/file1")
+lines = []
+positions = []
+while True:
+    line = f.readline()
+    if not line:
+        break
+    lines.append(line)
+    positions.append(f.tell())
+print(lines)
+print(positions)
+f.seek(0)
+print(f.readline(3), f.tell(), f.read(4))
+f.close()
+
+f = open("data/bigfile1", "rb")
+n = 0
+for line in f:
+    n += len(line)
+print(n, f.tell())
+f.seek(0)
+first = f.readline()
+print(len(first), f.tell(), f.read(5))
+f.close()
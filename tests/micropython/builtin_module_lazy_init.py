@@ -0,0 +1,25 @@
+# Test that a built-in module's __lazy_init__ runs on first use, not on import.
+
+try:
+    import example_package
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+print("imported")
+print(example_package.__name__)
+example_package.f()
+example_package.f()
+
+# Each import queues the module to be set up again before its next use.
+import example_package
+
+print("reimported")
+example_package.f()
+
+import example_package
+
+print("star import")
+from example_package import *
+
+f()
@@ -0,0 +1,36 @@
+# Test that gc.compact() keeps bytearray and array contents intact.
+
+import gc
+
+try:
+    gc.compact
+    import array
+except (AttributeError, ImportError):
+    print("SKIP")
+    raise SystemExit
+
+# Fragment the heap, keeping every other buffer.
+keep = []
+holes = []
+for i in range(40):
+    holes.append(bytearray(300))
+    keep.append(bytearray(bytes([i]) * 100))
+    holes.append([i] * 20)
+arr = array.array("i", range(100))
+src = bytearray(b"xyz" * 20)
+mv = memoryview(src)
+holes = None
+
+largest = gc.compact()
+print(type(largest), largest > 0)
+print(all(keep[i] == bytes([i]) * 100 for i in range(40)))
+print(sum(arr), src == b"xyz" * 20, bytes(mv[:3]))
+
+# Buffers keep working after being moved.
+keep[0].extend(b"abc")
+arr.append(100)
+print(keep[0][-4:], len(keep[0]), sum(arr))
+mv[0] = ord("X")
+print(src[:3])
+gc.compact()
+print(keep[0][-4:], sum(arr), src[:3])
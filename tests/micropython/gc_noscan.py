@@ -0,0 +1,36 @@
+# Test that the GC still traces objects stored in object arrays, and that
+# string, bytes and array data survive collections intact.
+
+import gc
+
+try:
+    import array
+
+    array.array("O", [None])
+except (ImportError, ValueError):
+    print("SKIP")
+    raise SystemExit
+
+# Objects reachable only through an object array must stay alive.
+objs = array.array("O", [[i, str(i) * 3] for i in range(20)])
+strs = [str(i) * 50 for i in range(20)]
+data = [bytes(range(i, i + 32)) for i in range(20)]
+nums = array.array("i", range(100))
+buf = bytearray(b"abc" * 40)
+
+for _ in range(3):
+    gc.collect()
+    junk = [bytearray(64) for _ in range(50)]
+
+print(all(objs[i] == [i, str(i) * 3] for i in range(20)))
+print(all(strs[i] == str(i) * 50 for i in range(20)))
+print(all(data[i] == bytes(range(i, i + 32)) for i in range(20)))
+print(sum(nums))
+print(buf == b"abc" * 40)
+
+# Growing an array keeps it working across collections.
+for i in range(100):
+    nums.append(i)
+    objs.append([i])
+gc.collect()
+print(sum(nums), len(objs), objs[-1])
@@ -0,0 +1,50 @@
+# Test gc.reserve(), which sets aside heap for when collection is disabled.
+
+import gc
+
+try:
+    gc.reserve
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+gc.collect()
+gc.reserve(4096)
+print(gc.reserve())
+
+
+# Fill the heap with collection disabled. The reserve stops the allocation
+# that would have failed from raising MemoryError.
+def fill():
+    blocks = [None] * 10000
+    n = 0
+    while gc.reserve() and n < len(blocks):
+        blocks[n] = bytearray(1024)
+        n += 1
+    return 0 < n < len(blocks)
+
+
+gc.disable()
+try:
+    print("reserve used", fill())
+except MemoryError:
+    print("MemoryError")
+
+# Re-enabling collection collects and sets the reserve aside again.
+gc.enable()
+print(gc.reserve())
+
+# Release it.
+gc.reserve(0)
+print(gc.reserve())
+
+try:
+    gc.reserve(-1)
+except ValueError:
+    print("ValueError")
+
+try:
+    gc.reserve(1 << 40)
+except MemoryError:
+    print("MemoryError")
+print(gc.reserve())
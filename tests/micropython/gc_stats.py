@@ -0,0 +1,28 @@
+# test gc.stats() allocation counters and free run histogram
+
+import gc
+
+try:
+    gc.stats
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+gc.collect()
+allocs, collections, collect_us, areas = gc.stats()
+print(allocs < 10, collect_us >= 0)
+
+# allocations are counted until the next collection
+junk = [bytearray(16) for _ in range(100)]
+print(gc.stats()[0] >= 100)
+gc.collect()
+stats = gc.stats()
+print(stats[0] < 10, stats[1] == collections + 1, stats[2] >= collect_us)
+
+# the areas and histogram agree with each other
+print(len(areas) >= 1)
+for total, free, max_free, free_runs in areas:
+    assert total > 0 and 0 <= max_free <= free <= total
+    assert all(isinstance(n, int) and n >= 0 for n in free_runs)
+    assert (sum(free_runs) == 0) == (free == 0)
+print(len(areas[0][3]))
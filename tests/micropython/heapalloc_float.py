@@ -0,0 +1,46 @@
+# Test that float arithmetic doesn't allocate when floats are immediate objects.
+
+import micropython
+
+try:
+    micropython.heap_lock
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def mul(a, b):
+    return a * b
+
+
+def integrate(n):
+    v = 0.0
+    p = 1.0
+    dt = 0.125
+    for i in range(n):
+        a = -p * 4.0 - v * 0.5
+        v += a * dt
+        p += v * dt
+    return p
+
+
+# Create the globals first so that storing them doesn't allocate.
+boxed = p = s = None
+
+# Floats are heap-allocated boxes with some object models.
+micropython.heap_lock()
+try:
+    mul(1.5, 3.0)
+    boxed = False
+except MemoryError:
+    boxed = True
+micropython.heap_unlock()
+if boxed:
+    print("SKIP")
+    raise SystemExit
+
+micropython.heap_lock()
+p = integrate(100)
+s = abs(p) < 1.0 and -p != p
+micropython.heap_unlock()
+print(s, p == integrate(100))
@@ -0,0 +1,70 @@
+# Test caching of compiled .py modules as .mpy files in __pycache__
+
+try:
+    import os, sys
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# We need a directory for testing that doesn't already exist.
+temp_dir = "micropy_cache_test_dir"
+try:
+    os.stat(temp_dir)
+    print("SKIP")
+    raise SystemExit
+except OSError:
+    pass
+
+
+def write_module(value):
+    with open(temp_dir + "/cc_mod.py", "w") as f:
+        f.write("x = {}\ndef f():\n    return 'f' + str(x)\n".format(value))
+
+
+def import_module():
+    sys.modules.pop("cc_mod", None)
+    import cc_mod
+
+    return cc_mod.x, cc_mod.f()
+
+
+def cleanup():
+    for name in ("/__pycache__/cc_mod.mpy", "/cc_mod.py"):
+        try:
+            os.remove(temp_dir + name)
+        except OSError:
+            pass
+    for name in ("/__pycache__", ""):
+        try:
+            os.rmdir(temp_dir + name)
+        except OSError:
+            pass
+
+
+os.mkdir(temp_dir)
+sys.path.insert(0, temp_dir)
+write_module(1)
+first = import_module()
+
+# The first import should have written the cache.
+try:
+    with open(temp_dir + "/__pycache__/cc_mod.mpy", "rb") as f:
+        magic = f.read(4)
+except OSError:
+    sys.path.pop(0)
+    cleanup()
+    print("SKIP")
+    raise SystemExit
+print(first)
+print(magic)
+
+# Importing again loads the cached code.
+print(import_module())
+
+# A source of a different size makes the cache stale.
+write_module(22)
+print(import_module())
+print(import_module())
+
+sys.path.pop(0)
+cleanup()
@@ -0,0 +1,71 @@
+# Test that modules imported again, as after a soft reload, see changes to their files
+
+try:
+    import os, sys
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# We need a directory for testing that doesn't already exist.
+temp_dir = "micropy_retain_test_dir"
+try:
+    os.stat(temp_dir)
+    print("SKIP")
+    raise SystemExit
+except OSError:
+    pass
+
+
+def write_file(name, text):
+    with open(temp_dir + "/" + name, "w") as f:
+        f.write(text)
+
+
+def import_modules():
+    for name in ("rt_mod", "rt_pkg", "rt_pkg.sub"):
+        sys.modules.pop(name, None)
+    import rt_mod
+    import rt_pkg.sub
+
+    return rt_mod.f(), rt_pkg.y, rt_pkg.sub.z
+
+
+def cleanup():
+    for name in (
+        "/rt_pkg/__pycache__/__init__.mpy",
+        "/rt_pkg/__pycache__/sub.mpy",
+        "/rt_pkg/__pycache__",
+        "/rt_pkg/__init__.py",
+        "/rt_pkg/sub.py",
+        "/rt_pkg",
+        "/__pycache__/rt_mod.mpy",
+        "/__pycache__",
+        "/rt_mod.py",
+        "",
+    ):
+        try:
+            os.remove(temp_dir + name)
+        except OSError:
+            try:
+                os.rmdir(temp_dir + name)
+            except OSError:
+                pass
+
+
+os.mkdir(temp_dir)
+os.mkdir(temp_dir + "/rt_pkg")
+sys.path.insert(0, temp_dir)
+write_file("rt_mod.py", "x = 1\ndef f():\n    return 'f' + str(x)\n")
+write_file("rt_pkg/__init__.py", "y = 'y1'\n")
+write_file("rt_pkg/sub.py", "z = 'z1'\n")
+print(import_modules())
+print(import_modules())
+
+# Files of a different size are imported again.
+write_file("rt_mod.py", "x = 22\ndef f():\n    return 'f' + str(x)\n")
+write_file("rt_pkg/sub.py", "z = 'z22'\n")
+print(import_modules())
+print(import_modules())
+
+sys.path.pop(0)
+cleanup()
@@ -0,0 +1,57 @@
+# Test that StopIteration doesn't record a traceback, but other exceptions do.
+
+import io, sys
+
+if not hasattr(sys, "print_exception"):
+    print("SKIP")
+    raise SystemExit
+
+
+def tb_lines(e):
+    buf = io.StringIO()
+    sys.print_exception(e, buf)
+    return [l for l in buf.getvalue().split("\n") if l.startswith("  File")]
+
+
+def gen():
+    return 42
+    yield
+
+
+class Iter:
+    def __next__(self):
+        raise StopIteration(7)
+
+
+def raise_value_error():
+    raise ValueError
+
+
+try:
+    next(gen())
+except StopIteration as e:
+    print(e.value, len(tb_lines(e)))
+
+try:
+    next(Iter())
+except StopIteration as e:
+    print(e.value, len(tb_lines(e)))
+
+try:
+    raise_value_error()
+except ValueError as e:
+    print(len(tb_lines(e)) > 0)
+
+# StopIteration still ends iteration and is still converted inside generators.
+print(list(gen()))
+
+
+def bad_gen():
+    raise StopIteration
+    yield
+
+
+try:
+    next(bad_gen())
+except RuntimeError as e:
+    print("RuntimeError", len(tb_lines(e)) > 0)
@@ -0,0 +1,49 @@
+# This tests attribute and method access on self, and arithmetic and comparisons
+# between a value and a small int constant, the patterns that superinstructions target.
+
+
+class Sensor:
+    def __init__(self):
+        self.value = 0
+
+    def read(self):
+        self.value = (self.value + 7) & 0xFF
+        return self.value
+
+
+class Driver:
+    def __init__(self):
+        self.sensor = Sensor()
+        self.count = 0
+
+    def poll(self, n):
+        total = 0
+        i = 0
+        while i < n:
+            v = self.sensor.read()
+            if v > 128:
+                total += v - 128
+            elif v == 0:
+                self.count += 1
+            i += 1
+        return total
+
+
+def test(n):
+    global result
+    result = Driver().poll(n)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (100, 10): (2000,),
+    (1000, 10): (20000,),
+    (5000, 10): (100000,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    return lambda: test(nloop), lambda: (nloop // 100, result)
@@ -0,0 +1,50 @@
+# This tests audiomixer rendering: the cost per block of mixing looped samples
+# on every voice at a level below one.
+# The result is None since CPython has no audiomixer.
+
+try:
+    import array
+    import audiocore
+    import audiomixer
+except ImportError:
+    audiomixer = None
+
+
+def make_mixer(nvoices):
+    mixer = audiomixer.Mixer(
+        voice_count=nvoices, buffer_size=2048, channel_count=1, sample_rate=22050
+    )
+    for i in range(nvoices):
+        data = array.array("h", [((j * (i + 1) * 997) & 0xFFFF) - 32768 for j in range(512)])
+        mixer.voice[i].level = 0.5
+        mixer.voice[i].play(audiocore.RawSample(data, sample_rate=22050), loop=True)
+    return mixer
+
+
+###########################################################################
+# Benchmark interface
+
+if audiomixer is None or not hasattr(audiocore, "get_buffer"):
+    bm_params = {}
+else:
+    bm_params = {
+        (50, 25): (200, 2),
+        (100, 25): (400, 2),
+        (1000, 100): (4000, 4),
+        (5000, 100): (20000, 4),
+    }
+
+
+def bm_setup(params):
+    nblocks, nvoices = params
+    mixer = make_mixer(nvoices)
+
+    def run():
+        for _ in range(nblocks):
+            audiocore.get_buffer(mixer)
+
+    def result():
+        mixer.deinit()
+        return nblocks * nvoices, None
+
+    return run, result
@@ -0,0 +1,51 @@
+# This tests bitmaptools drawing into a displayio.Bitmap: blits with and
+# without transparency, region fills and rotozoom, as used to compose sprites.
+# The result is None since CPython has no bitmaptools.
+
+try:
+    import bitmaptools
+    from displayio import Bitmap
+except ImportError:
+    bitmaptools = None
+
+
+def test(niter, size):
+    dest = Bitmap(size, size, 256)
+    sprite = Bitmap(size // 4, size // 4, 256)
+    for y in range(sprite.height):
+        for x in range(sprite.width):
+            sprite[x, y] = (x ^ y) & 0xFF
+    step = size // 8
+    for i in range(niter):
+        bitmaptools.fill_region(dest, 0, 0, size, size, i & 0xFF)
+        for y in range(0, size - sprite.height, step):
+            for x in range(0, size - sprite.width, step):
+                bitmaptools.blit(dest, sprite, x, y)
+                bitmaptools.blit(dest, sprite, x, y, skip_source_index=0)
+        bitmaptools.rotozoom(dest, sprite, angle=i / 8, scale=2.0)
+
+
+###########################################################################
+# Benchmark interface
+
+if bitmaptools is None:
+    bm_params = {}
+else:
+    bm_params = {
+        (50, 25): (20, 64),
+        (100, 100): (40, 96),
+        (1000, 1000): (400, 128),
+        (5000, 1000): (2000, 128),
+    }
+
+
+def bm_setup(params):
+    niter, size = params
+
+    def run():
+        test(niter, size)
+
+    def result():
+        return niter * size * size, None
+
+    return run, result
@@ -0,0 +1,108 @@
+# This tests displayio refreshes of a reference Group on the board's built in
+# display: a full screen background with sprites and shapes moving over it, so
+# every frame has several dirty areas to render and send.
+# Boards without board.DISPLAY skip it. The unix port's sim variant uses a
+# simulated framebuffer instead.
+# The result is None since CPython has no displayio.
+
+try:
+    import board
+    import displayio
+
+    display = board.DISPLAY
+except (ImportError, AttributeError):
+    try:
+        import displayio
+        import framebufferio
+        import simio
+
+        display = framebufferio.FramebufferDisplay(simio.Framebuffer(320, 240), auto_refresh=False)
+    except ImportError:
+        display = None
+
+try:
+    import vectorio
+except ImportError:
+    vectorio = None
+
+
+def make_group(nsprites):
+    width = display.width
+    height = display.height
+    palette = displayio.Palette(4)
+    palette[0] = 0x000000
+    palette[1] = 0x2040A0
+    palette[2] = 0xFFA000
+    palette[3] = 0x20C040
+
+    background = displayio.Bitmap(width // 8, height // 8, 2)
+    for y in range(background.height):
+        for x in range(background.width):
+            background[x, y] = (x ^ y) & 1
+    scaled = displayio.Group(scale=8)
+    scaled.append(displayio.TileGrid(background, pixel_shader=palette))
+    group = displayio.Group()
+    group.append(scaled)
+
+    sprite = displayio.Bitmap(16, 16, 4)
+    for y in range(16):
+        for x in range(16):
+            sprite[x, y] = 2 if (x - 8) * (x - 8) + (y - 8) * (y - 8) < 48 else 0
+    sprite_palette = displayio.Palette(4)
+    sprite_palette[2] = 0xFFA000
+    sprite_palette.make_transparent(0)
+    sprites = []
+    for i in range(nsprites):
+        tile_grid = displayio.TileGrid(sprite, pixel_shader=sprite_palette)
+        group.append(tile_grid)
+        sprites.append(tile_grid)
+    if vectorio is not None:
+        for i in range(nsprites // 2):
+            shape = vectorio.Circle(pixel_shader=palette, radius=6, color_index=3)
+            group.append(shape)
+            sprites.append(shape)
+    return group, sprites
+
+
+def move(sprites, frame):
+    width = display.width - 16
+    height = display.height - 16
+    for i, s in enumerate(sprites):
+        s.x = (frame * (i + 1) * 3) % width
+        s.y = (frame * (i + 2) * 2 + i * 11) % height
+
+
+###########################################################################
+# Benchmark interface
+
+if display is None:
+    bm_params = {}
+else:
+    # (frames, sprites)
+    bm_params = {
+        (50, 25): (10, 4),
+        (100, 50): (20, 8),
+        (1000, 100): (100, 16),
+    }
+
+
+def bm_setup(params):
+    nframes, nsprites = params
+    group, sprites = make_group(nsprites)
+    old_group = display.root_group
+    old_auto_refresh = display.auto_refresh
+    display.auto_refresh = False
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for frame in range(nframes):
+            move(sprites, frame)
+            display.refresh()
+
+    def result():
+        display.root_group = old_group
+        display.auto_refresh = old_auto_refresh
+        return nframes * display.width * display.height, None
+
+    return run, result
@@ -0,0 +1,85 @@
+# This tests FAT filesystem throughput: writing, reading back and deleting
+# files through VfsFat. The filesystem is on a RAM block device, so this
+# measures the VFS and FAT layers without the flash, and works everywhere.
+# The result is None since CPython has no VfsFat.
+
+try:
+    try:
+        from storage import VfsFat
+    except ImportError:
+        from os import VfsFat
+except ImportError:
+    VfsFat = None
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.mv = memoryview(self.data)
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = self.mv[start : start + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.mv[start : start + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+        return 0
+
+
+def test(fs, niter, file_size, chunk):
+    out = bytearray(chunk)
+    for i in range(chunk):
+        out[i] = i & 0xFF
+    buf = bytearray(chunk)
+    for i in range(niter):
+        name = "/file%d.bin" % (i & 3)
+        with fs.open(name, "wb") as f:
+            for _ in range(file_size // chunk):
+                f.write(out)
+        with fs.open(name, "rb") as f:
+            while f.readinto(buf):
+                pass
+        if i & 3 == 3:
+            for j in range(4):
+                fs.remove("/file%d.bin" % j)
+
+
+###########################################################################
+# Benchmark interface
+
+if VfsFat is None:
+    bm_params = {}
+else:
+    # (iterations, blocks on the device, file size, write and read chunk size)
+    bm_params = {
+        (50, 50): (40, 64, 4096, 512),
+        (100, 100): (80, 256, 16384, 512),
+        (1000, 1000): (800, 256, 16384, 512),
+        (5000, 1000): (4000, 256, 16384, 512),
+    }
+
+
+def bm_setup(params):
+    niter, blocks, file_size, chunk = params
+    bdev = RAMBlockDevice(blocks)
+    VfsFat.mkfs(bdev)
+    fs = VfsFat(bdev)
+
+    def run():
+        test(fs, niter, file_size, chunk)
+
+    def result():
+        return niter * file_size, None
+
+    return run, result
@@ -0,0 +1,79 @@
+# This tests bus round trips through the board's default buses: one byte
+# reads from the first device found on board.I2C(), and full duplex
+# transfers on board.SPI() with no chip select asserted, so no device acts on
+# them. Buses the board doesn't have are left out, and boards with neither,
+# including the unix port, skip it.
+# The result is None since CPython has no busio.
+
+i2c = None
+i2c_address = None
+spi = None
+try:
+    import board
+except ImportError:
+    board = None
+
+if board is not None:
+    try:
+        i2c = board.I2C()
+        while not i2c.try_lock():
+            pass
+        devices = i2c.scan()
+        i2c.unlock()
+        if devices:
+            i2c_address = devices[0]
+    except (AttributeError, RuntimeError, ValueError):
+        pass
+    try:
+        spi = board.SPI()
+    except (AttributeError, RuntimeError, ValueError):
+        pass
+
+
+def test(niter, nbytes):
+    small = bytearray(1)
+    out_buf = bytearray(nbytes)
+    in_buf = bytearray(nbytes)
+    if i2c_address is not None:
+        while not i2c.try_lock():
+            pass
+        try:
+            for _ in range(niter):
+                i2c.readfrom_into(i2c_address, small)
+        finally:
+            i2c.unlock()
+    if spi is not None:
+        while not spi.try_lock():
+            pass
+        try:
+            spi.configure(baudrate=1000000)
+            for _ in range(niter):
+                spi.write_readinto(out_buf, in_buf)
+        finally:
+            spi.unlock()
+
+
+###########################################################################
+# Benchmark interface
+
+if i2c_address is None and spi is None:
+    bm_params = {}
+else:
+    # (transfers per bus, SPI transfer size)
+    bm_params = {
+        (50, 10): (50, 16),
+        (100, 10): (100, 32),
+        (1000, 10): (1000, 64),
+    }
+
+
+def bm_setup(params):
+    niter, nbytes = params
+
+    def run():
+        test(niter, nbytes)
+
+    def result():
+        return niter, None
+
+    return run, result
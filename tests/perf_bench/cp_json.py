@@ -0,0 +1,49 @@
+# This tests json encoding and decoding of a small settings style document,
+# the kind of payload fetched from a web API.
+
+import json
+
+DOC = {
+    "name": "sensor",
+    "enabled": True,
+    "interval": 30,
+    "offset": None,
+    "tags": ["indoor", "humidity", "temperature"],
+    "readings": [[1, 2, 3], [4, 5, 6], [7, 8, 9], [10, 11, 12]],
+    "network": {"ssid": "circuitpython", "channel": 6, "retries": [1, 2, 4, 8]},
+}
+
+
+def test(niter):
+    total = 0
+    for i in range(niter):
+        DOC["interval"] = i
+        text = json.dumps(DOC)
+        doc = json.loads(text)
+        total += len(text) + doc["interval"] + len(doc["readings"])
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (200,),
+    (100, 10): (400,),
+    (1000, 10): (4000,),
+    (5000, 10): (20000,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter)
+
+    def result():
+        return niter, state
+
+    return run, result
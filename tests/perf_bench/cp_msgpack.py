@@ -0,0 +1,57 @@
+# This tests msgpack packing and unpacking of a small settings style document
+# through a stream.
+# The result is None since CPython has no msgpack module.
+
+try:
+    from io import BytesIO
+    import msgpack
+except ImportError:
+    msgpack = None
+
+DOC = {
+    "name": "sensor",
+    "enabled": True,
+    "interval": 30,
+    "offset": None,
+    "tags": ["indoor", "humidity", "temperature"],
+    "readings": [[1, 2, 3], [4, 5, 6], [7, 8, 9], [10, 11, 12]],
+    "blob": b"\x00\x01\x02\x03\x04\x05\x06\x07",
+    "network": {"ssid": "circuitpython", "channel": 6, "retries": [1, 2, 4, 8]},
+}
+
+
+def test(niter):
+    stream = BytesIO()
+    for i in range(niter):
+        DOC["interval"] = i
+        stream.seek(0)
+        msgpack.pack(DOC, stream)
+        stream.seek(0)
+        doc = msgpack.unpack(stream)
+        assert doc["interval"] == i
+
+
+###########################################################################
+# Benchmark interface
+
+if msgpack is None:
+    bm_params = {}
+else:
+    bm_params = {
+        (50, 10): (200,),
+        (100, 10): (400,),
+        (1000, 10): (4000,),
+        (5000, 10): (20000,),
+    }
+
+
+def bm_setup(params):
+    (niter,) = params
+
+    def run():
+        test(niter)
+
+    def result():
+        return niter, None
+
+    return run, result
@@ -0,0 +1,45 @@
+# This tests struct packing and unpacking of a sensor style record, into new
+# bytes objects and into a preallocated buffer.
+
+import struct
+
+FORMAT = "<HhhhIf8s"
+
+
+def test(niter):
+    s = struct.Struct(FORMAT)
+    buf = bytearray(s.size * 16)
+    total = 0
+    for i in range(niter):
+        packed = struct.pack(FORMAT, i & 0xFFFF, -i & 0x7FFF, 1, -1, i * 3, 0.5, b"name")
+        total += struct.unpack(FORMAT, packed)[4]
+        for j in range(16):
+            s.pack_into(buf, j * s.size, j, -j, i & 0x7FFF, 0, i, 1.25, b"value")
+        for j in range(16):
+            total += s.unpack_from(buf, j * s.size)[0]
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (100,),
+    (100, 10): (200,),
+    (1000, 10): (2000,),
+    (5000, 10): (10000,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter)
+
+    def result():
+        return niter, state
+
+    return run, result
@@ -0,0 +1,55 @@
+# This tests synthio rendering: the cost per block of a chord with an
+# envelope, an LFO and a filter, as the audio output pulls it.
+# The result is None since CPython has no synthio.
+
+try:
+    import array
+    import synthio
+    from audiocore import get_buffer
+except ImportError:
+    get_buffer = None
+
+
+def make_synth(nvoices):
+    waveform = array.array("h", [(i * 1024) - 32768 for i in range(64)])
+    envelope = synthio.Envelope(attack_time=0.01, release_time=0.1, sustain_level=0.8)
+    synth = synthio.Synthesizer(sample_rate=24000, channel_count=2, envelope=envelope)
+    lfo = synthio.LFO(rate=5, scale=0.02)
+    lpf = synth.low_pass_filter(2000)
+    notes = [
+        synthio.Note(
+            synthio.midi_to_hz(48 + 4 * i), waveform=waveform, bend=lfo, filter=lpf, panning=0.5
+        )
+        for i in range(nvoices)
+    ]
+    synth.press(notes)
+    return synth
+
+
+###########################################################################
+# Benchmark interface
+
+if get_buffer is None:
+    bm_params = {}
+else:
+    bm_params = {
+        (50, 25): (200, 4),
+        (100, 25): (400, 4),
+        (1000, 100): (4000, 8),
+        (5000, 100): (20000, 8),
+    }
+
+
+def bm_setup(params):
+    nblocks, nvoices = params
+    synth = make_synth(nvoices)
+
+    def run():
+        for _ in range(nblocks):
+            get_buffer(synth)
+
+    def result():
+        synth.deinit()
+        return nblocks * nvoices, None
+
+    return run, result
@@ -4,6 +4,7 @@
 # The MIT License (MIT)
 # Copyright (c) 2019 Damien P. George
 
+import json
 import os
 import subprocess
 import sys
@@ -89,7 +90,7 @@ def run_benchmark_on_target(target, script):
         return -1, -1, "CRASH: %r" % err
 
 
-def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
+def run_benchmarks(args, target, param_n, param_m, n_average, test_list, results):
     skip_complex = run_feature_test(target, "complex") != "complex"
     skip_native = run_feature_test(target, "native_check") != "native"
     target_had_error = False
@@ -106,6 +107,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
         )
         if skip:
             print("SKIP")
+            results[test_file] = {"status": "SKIP"}
             continue
 
         # Create test script
@@ -126,6 +128,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
             crash, test_script_target = prepare_script_for_target(args, script_text=test_script)
             if crash:
                 print("CRASH:", test_script_target)
+                results[test_file] = {"status": "CRASH"}
                 continue
         else:
             test_script_target = test_script
@@ -162,8 +165,11 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
                 error = "FAIL truth"
 
         if error is not None:
-            if not error.startswith("SKIP"):
+            if error.startswith("SKIP"):
+                results[test_file] = {"status": "SKIP"}
+            else:
                 target_had_error = True
+                results[test_file] = {"status": "ERROR", "error": error}
             print(error)
         else:
             t_avg, t_sd = compute_stats(times)
@@ -173,6 +179,14 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
                     t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
                 )
             )
+            results[test_file] = {
+                "status": "OK",
+                "time_us": t_avg,
+                "time_sd_percent": 100 * t_sd / t_avg,
+                "score": s_avg,
+                "score_sd_percent": 100 * s_sd / s_avg,
+                "times": times,
+            }
             if 0:
                 print("  times: ", times)
                 print("  scores:", scores)
@@ -183,6 +197,16 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
 
 
 def parse_output(filename):
+    if filename.endswith(".json"):
+        # Output of a previous run with --json
+        with open(filename) as f:
+            report = json.load(f)
+        data = [
+            (name, r["time_us"], r["time_sd_percent"], r["score"], r["score_sd_percent"])
+            for name, r in sorted(report["results"].items())
+            if r["status"] == "OK"
+        ]
+        return report["N"], report["M"], data
     with open(filename) as f:
         params = f.readline()
         n, m, _ = params.strip().split()
@@ -264,6 +288,9 @@ def main():
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
     cmd_parser.add_argument("--via-mpy", action="store_true", help="compile code to .mpy first")
     cmd_parser.add_argument("--mpy-cross-flags", default="", help="flags to pass to mpy-cross")
+    cmd_parser.add_argument(
+        "--json", metavar="FILE", help="also write the results to FILE as JSON, for -t and -s"
+    )
     cmd_parser.add_argument(
         "N", nargs=1, help="N parameter (approximate target CPU frequency in MHz)"
     )
@@ -307,7 +334,25 @@ def main():
 
     print("N={} M={} n_average={}".format(N, M, n_average))
 
-    target_had_error = run_benchmarks(args, target, N, M, n_average, tests)
+    results = {}
+    target_had_error = run_benchmarks(args, target, N, M, n_average, tests, results)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(
+                {
+                    "N": N,
+                    "M": M,
+                    "n_average": n_average,
+                    "target": args.device if args.pyboard else MICROPYTHON,
+                    "emit": args.emit,
+                    "results": results,
+                },
+                f,
+                indent=2,
+                sort_keys=True,
+            )
+            f.write("\n")
 
     if isinstance(target, pyboard.Pyboard):
         target.exit_raw_repl()
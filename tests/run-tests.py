@@ -607,11 +607,18 @@ def run_tests(pyb, tests, args, result_dir, num_threads=1):
         skip_tests.add("float/bytes_construct.py")  # requires fp32
         skip_tests.add("float/bytearray_construct.py")  # requires fp32
         skip_tests.add("float/float_format_ints_power10.py")  # requires fp32
+        # CIRCUITPY-CHANGE: these print digits that fp30 can't hold.
+        skip_tests.add("float/cmath_fun.py")  # requires fp32
+        skip_tests.add("float/float_format_ints.py")  # requires fp32
+        skip_tests.add("float/float_struct_e.py")  # requires fp32
+        # CIRCUITPY-CHANGE
+        skip_tests.add("misc/rge_sm.py")  # requires fp32
     if upy_float_precision < 64:
         skip_tests.add("float/float_divmod.py")  # tested by float/float_divmod_relaxed.py instead
         skip_tests.add("float/float2int_doubleprec_intbig.py")
         skip_tests.add("float/float_format_ints_doubleprec.py")
         skip_tests.add("float/float_parse_doubleprec.py")
+        skip_tests.add("float/float_repr_shortest_doubleprec.py")
 
     if not has_complex:
         skip_tests.add("float/complex1.py")
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Adafruit Industries LLC
+#
+# SPDX-License-Identifier: MIT
+
+"""Decode a runtime trace written by supervisor.trace_dump().
+
+Prints one event per line, or with --chrome writes Chrome trace event JSON
+that chrome://tracing and https://ui.perfetto.dev can show as a timeline.
+Times are from the first event, or with --monotonic in microseconds on the
+same clock as time.monotonic_ns() on the board.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+HEADER_V1 = struct.Struct("<4sBBHIII")
+HEADER = struct.Struct("<4sBBHIIIIQ")
+RECORD = struct.Struct("<IHH")
+
+# Same order as trace_event_t in supervisor/shared/trace.h.
+EVENTS = [
+    None,
+    "vm_start",
+    "vm_end",
+    "gc_start",
+    "gc_end",
+    "background_start",
+    "background_end",
+    "tick_start",
+    "tick_end",
+    "usb_start",
+    "usb_end",
+    "display_start",
+    "display_end",
+    "flush_start",
+    "flush_end",
+    "dma_isr",
+    "keypad",
+    "count",
+    "pulse",
+    "frame",
+    "mark",
+]
+
+
+def read_trace(data, monotonic=False):
+    magic, version, record_size, _, hz, count, dropped = HEADER_V1.unpack_from(data)
+    if magic != b"CPTR" or version not in (1, 2) or record_size != RECORD.size:
+        raise ValueError("not a version 1 or 2 CircuitPython trace")
+    if version == 1:
+        if monotonic:
+            raise ValueError("version 1 traces have no monotonic time")
+        header_size = HEADER_V1.size
+    else:
+        header_size = HEADER.size
+        reference_timestamp, reference_us = HEADER.unpack_from(data)[-2:]
+    events = []
+    high = 0
+    last = None
+    for i in range(count):
+        timestamp, event, arg = RECORD.unpack_from(data, header_size + i * RECORD.size)
+        # Timestamps are 32 bits, so unwrap them.
+        if last is not None and timestamp < last:
+            high += 1 << 32
+        last = timestamp
+        name = EVENTS[event] if event < len(EVENTS) else "event_%d" % event
+        events.append(((high + timestamp) * 1e6 / hz, name, arg))
+    if events and monotonic:
+        # The reference was taken after the last record.
+        reference = (high + last + ((reference_timestamp - last) & 0xFFFFFFFF)) * 1e6 / hz
+        events = [(t - reference + reference_us, name, arg) for t, name, arg in events]
+    elif events:
+        start = events[0][0]
+        events = [(t - start, name, arg) for t, name, arg in events]
+    return events, dropped
+
+
+def to_chrome(events):
+    trace = []
+    for t, name, arg in events:
+        base, _, kind = name.rpartition("_")
+        if kind == "start":
+            trace.append({"name": base, "ph": "B", "ts": t, "pid": 0, "tid": 0})
+        elif kind == "end":
+            trace.append({"name": base, "ph": "E", "ts": t, "pid": 0, "tid": 0})
+        else:
+            trace.append(
+                {"name": name, "ph": "i", "s": "g", "ts": t, "pid": 0, "tid": 1, "args": {"arg": arg}}
+            )
+    return {"traceEvents": trace, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("trace", help="file written by supervisor.trace_dump()")
+    parser.add_argument("--chrome", action="store_true", help="write Chrome trace event JSON")
+    parser.add_argument(
+        "--monotonic", action="store_true", help="show times on the time.monotonic_ns() clock"
+    )
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as f:
+        events, dropped = read_trace(f.read(), args.monotonic)
+
+    if args.chrome:
+        json.dump(to_chrome(events), sys.stdout)
+        return
+    if dropped:
+        print("# %d older events were overwritten" % dropped)
+    for t, name, arg in events:
+        print("%14.1f us  %-16s %d" % (t, name, arg))
+
+
+if __name__ == "__main__":
+    main()
@@ -97,6 +97,8 @@ for x, c in enumerate(filtered_characters):
 extra_characters = ""
 for c in filtered_characters:
     if c not in visible_ascii:
+        if ord(c) > 0xFFFF:
+            raise RuntimeError("character outside the basic multilingual plane")
         extra_characters += c
 
 c_file = args.output_c_file
@@ -359,6 +361,18 @@ displayio_bitmap_t supervisor_terminal_font_bitmap = {{
 )
 
 
+# filtered_characters is sorted, so these are in ascending order for binary search.
+c_file.write(
+    """\
+static const uint16_t supervisor_terminal_font_unicode_characters[{}] = {{
+    {}
+}};
+""".format(
+        max(1, len(extra_characters)),
+        ", ".join("0x{:04x}".format(ord(c)) for c in extra_characters) or "0",
+    )
+)
+
 c_file.write(
     """\
 const fontio_builtinfont_t supervisor_terminal_font = {{
@@ -366,11 +380,11 @@ const fontio_builtinfont_t supervisor_terminal_font = {{
     .bitmap = &supervisor_terminal_font_bitmap,
     .width = {},
     .height = {},
-    .unicode_characters = (const uint8_t*) "{}",
+    .unicode_characters = supervisor_terminal_font_unicode_characters,
     .unicode_characters_len = {}
 }};
 """.format(
-        tile_x, tile_y, extra_characters, len(extra_characters.encode("utf-8"))
+        tile_x, tile_y, len(extra_characters)
     )
 )
 
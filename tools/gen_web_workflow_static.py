@@ -4,6 +4,7 @@
 
 import argparse
 import gzip
+import hashlib
 import minify_html
 import jsmin
 import mimetypes
@@ -36,9 +37,12 @@ for f in args.files:
     clen = len(compressed)
     compressed = ", ".join([hex(x) for x in compressed])
     mime = mimetypes.guess_type(f.name)[0]
+    # Quoted as HTTP requires so it can be compared directly to If-None-Match.
+    etag = hashlib.sha1(uncompressed).hexdigest()[:16]
 
     c_file.write(f"// {f.name}\n")
     c_file.write(f"// Original length: {ulen} Compressed length: {clen}\n")
     c_file.write(f"const uint32_t {variable}_length = {clen};\n")
     c_file.write(f'const char* {variable}_content_type = "{mime}";\n')
+    c_file.write(f'const char* {variable}_etag = "\\"{etag}\\"";\n')
     c_file.write(f"const uint8_t {variable}[{clen}] = {{{compressed}}};\n\n")
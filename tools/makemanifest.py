@@ -71,6 +71,9 @@ def mkdir(filename):
 # - MP_FROZEN_STR_NAMES macro
 # - mp_frozen_str_sizes
 # - mp_frozen_str_content
+# CIRCUITPY-CHANGE
+# - MP_FROZEN_STR_NAMES_LEN macro
+# - mp_frozen_str_index
 def generate_frozen_str_content(modules):
     output = [
         b"#include <stdint.h>\n",
@@ -82,6 +85,23 @@ def generate_frozen_str_content(modules):
         output.append(b'"%s\\0" \\\n' % target_path.encode())
     output.append(b"\n")
 
+    # CIRCUITPY-CHANGE: the names in sorted order, as (offset in mp_frozen_names,
+    # entry number) pairs, so that they can be binary searched.
+    names = [target_path.encode() for _, target_path in modules]
+    offsets = []
+    offset = 0
+    for name in names:
+        offsets.append(offset)
+        offset += len(name) + 1
+    output.append(b"#define MP_FROZEN_STR_NAMES_LEN (%d)\n" % offset)
+    output.append(b"const uint16_t mp_frozen_str_index_len = %d;\n" % len(names))
+    output.append(b"const uint16_t mp_frozen_str_index[][2] = {\n")
+    for i in sorted(range(len(names)), key=lambda i: names[i]):
+        output.append(b"    {%d, %d},\n" % (offsets[i], i))
+    if not names:
+        output.append(b"    {0, 0},\n")
+    output.append(b"};\n")
+
     output.append(b"const uint32_t mp_frozen_str_sizes[] = { ")
 
     for full_path, _ in modules:
@@ -249,6 +269,9 @@ def main():
             b"};\n"
             b'const char mp_frozen_names[] = { MP_FROZEN_STR_NAMES "\\0"};\n'
             b"const mp_raw_code_t *const mp_frozen_mpy_content[] = {NULL};\n"
+            # CIRCUITPY-CHANGE
+            b"const uint16_t mp_frozen_mpy_index_len = 0;\n"
+            b"const uint16_t mp_frozen_mpy_index[][2] = {{0, 0}};\n"
         )
 
     # Generate output
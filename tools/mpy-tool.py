@@ -113,6 +113,10 @@ MP_NATIVE_ARCH_ARMV7EMSP = 7
 MP_NATIVE_ARCH_ARMV7EMDP = 8
 MP_NATIVE_ARCH_XTENSA = 9
 MP_NATIVE_ARCH_XTENSAWIN = 10
+MP_NATIVE_ARCH_RV32IMC = 11
+
+# CIRCUITPY-CHANGE: must match py/persistentcode.h
+MPY_FEATURE_SUPERINSTRUCTIONS = 0x80
 
 MP_PERSISTENT_OBJ_FUN_TABLE = 0
 MP_PERSISTENT_OBJ_NONE = 1
@@ -1083,6 +1087,7 @@ class RawCodeNative(RawCode):
             MP_NATIVE_ARCH_X64,
             MP_NATIVE_ARCH_XTENSA,
             MP_NATIVE_ARCH_XTENSAWIN,
+            MP_NATIVE_ARCH_RV32IMC,
         ):
             self.fun_data_attributes = '__attribute__((section(".text,\\"ax\\",@progbits # ")))'
         else:
@@ -1098,8 +1103,11 @@ class RawCodeNative(RawCode):
         ):
             # ARMV6 or Xtensa -- four byte align.
             self.fun_data_attributes += " __attribute__ ((aligned (4)))"
-        elif MP_NATIVE_ARCH_ARMV6M <= config.native_arch <= MP_NATIVE_ARCH_ARMV7EMDP:
-            # ARMVxxM -- two byte align.
+        elif (
+            MP_NATIVE_ARCH_ARMV6M <= config.native_arch <= MP_NATIVE_ARCH_ARMV7EMDP
+            or config.native_arch == MP_NATIVE_ARCH_RV32IMC
+        ):
+            # ARMVxxM or RV32IMC -- two byte align.
             self.fun_data_attributes += " __attribute__ ((aligned (2)))"
 
     def disassemble(self):
@@ -1358,6 +1366,9 @@ def read_mpy(filename):
         if header[1] != config.MPY_VERSION:
             raise MPYReadError(filename, "incompatible .mpy version")
         feature_byte = header[2]
+        # CIRCUITPY-CHANGE: fused opcodes are private to the build that wrote them
+        if feature_byte & MPY_FEATURE_SUPERINSTRUCTIONS:
+            raise MPYReadError(filename, "contains superinstructions")
         mpy_native_arch = feature_byte >> 2
         if mpy_native_arch != MP_NATIVE_ARCH_NONE:
             mpy_sub_version = feature_byte & 3
@@ -1509,6 +1520,14 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
         qstr_content += config.MICROPY_QSTR_BYTES_IN_LEN
         qstr_content += len(qbytes) + 1  # include NUL
     print("};")
+    # CIRCUITPY-CHANGE
+    if config.MICROPY_QSTR_POOL_INDEX:
+        print()
+        print("const uint16_t mp_qstr_frozen_const_index[] = {")
+        for slot in qstrutil.make_pool_index([qbytes for _, _, _, qbytes in new]):
+            print("    %d," % slot)
+            qstr_content += 2
+        print("};")
     print()
     print("extern const qstr_pool_t mp_qstr_const_pool;")
     print("const qstr_pool_t mp_qstr_frozen_const_pool = {")
@@ -1520,6 +1539,9 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
     if config.MICROPY_QSTR_BYTES_IN_HASH:
         print("    (qstr_hash_t *)mp_qstr_frozen_const_hashes,")
     print("    (qstr_len_t *)mp_qstr_frozen_const_lengths,")
+    # CIRCUITPY-CHANGE
+    if config.MICROPY_QSTR_POOL_INDEX:
+        print("    (uint16_t *)mp_qstr_frozen_const_index,")
     print("    {")
     for _, _, qstr, qbytes in new:
         print('        "%s",' % qstrutil.escape_bytes(qstr, qbytes))
@@ -1550,6 +1572,29 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
     print('    "\\0"')
     print("};")
 
+    # CIRCUITPY-CHANGE: define the names in sorted order, as (offset in
+    # mp_frozen_names, index in mp_frozen_mpy_content) pairs, so that they can be
+    # binary searched. Any string entries come first in mp_frozen_names.
+    print()
+    print("#ifndef MP_FROZEN_STR_NAMES_LEN")
+    print("#define MP_FROZEN_STR_NAMES_LEN (0)")
+    print("#endif")
+    names = [cm.source_file.str.encode() for cm in compiled_modules]
+    offsets = []
+    offset = 0
+    for name in names:
+        offsets.append(offset)
+        offset += len(name) + 1
+    if offset > 0xFFFF:
+        raise FreezeError(compiled_modules[-1], "frozen module names are over 64KiB")
+    print("const uint16_t mp_frozen_mpy_index_len = %d;" % len(names))
+    print("const uint16_t mp_frozen_mpy_index[][2] = {")
+    for i in sorted(range(len(names)), key=lambda i: names[i]):
+        print("    {MP_FROZEN_STR_NAMES_LEN + %d, %d}," % (offsets[i], i))
+    if not names:
+        print("    {0, 0},")
+    print("};")
+
     # Define the array of pointers to frozen module content.
     print()
     print("const mp_frozen_module_t *const mp_frozen_mpy_content[] = {")
@@ -1817,9 +1862,13 @@ def main():
         firmware_qstr_idents = set(qstrutil.static_qstr_list_ident) | set(extra_qstrs.keys())
         config.MICROPY_QSTR_BYTES_IN_LEN = int(qcfgs["BYTES_IN_LEN"])
         config.MICROPY_QSTR_BYTES_IN_HASH = int(qcfgs["BYTES_IN_HASH"])
+        # CIRCUITPY-CHANGE
+        config.MICROPY_QSTR_POOL_INDEX = int(qcfgs.get("POOL_INDEX", "0"))
     else:
         config.MICROPY_QSTR_BYTES_IN_LEN = 1
         config.MICROPY_QSTR_BYTES_IN_HASH = 1
+        # CIRCUITPY-CHANGE
+        config.MICROPY_QSTR_POOL_INDEX = 0
         firmware_qstr_idents = set(qstrutil.static_qstr_list_ident)
 
     # Create initial list of global qstrs.